@@ -0,0 +1,110 @@
+#ifndef ADPCM_SAMPLE_H
+#define ADPCM_SAMPLE_H
+
+#include <stdint.h>
+
+// IMA-ADPCM sample storage: 4 bits per sample, a quarter of 16-bit PCM.
+// The decoder state is stored at the start of every block so playback can
+// start or wrap a loop without decoding from the beginning of the sample.
+// Kept free of Arduino headers so the host encoder in tools/ can share it.
+const int ADPCM_BLOCK_SAMPLES = 256;
+
+struct AdpcmSample {
+  const uint8_t *codes;             // Two codes per byte, even samples in the low nibble
+  const int16_t *blockPredictors;   // Decoded value just before each block
+  const uint8_t *blockStepIndices;  // Step index at the start of each block
+  uint32_t length;                  // Samples
+};
+
+static const int16_t ADPCM_STEP_TABLE[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+  34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+  157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+  724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+  3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t ADPCM_INDEX_TABLE[16] = {
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+struct AdpcmState {
+  int32_t predictor;
+  int32_t stepIndex;
+};
+
+// The encoder runs the same function, so both sides track the same predictor
+inline int16_t adpcmDecodeNibble(AdpcmState &state, uint8_t code) {
+  int32_t step = ADPCM_STEP_TABLE[state.stepIndex];
+  int32_t diff = step >> 3;
+  if (code & 4) diff += step;
+  if (code & 2) diff += step >> 1;
+  if (code & 1) diff += step >> 2;
+  
+  state.predictor += (code & 8) ? -diff : diff;
+  if (state.predictor > 32767) state.predictor = 32767;
+  if (state.predictor < -32768) state.predictor = -32768;
+  
+  state.stepIndex += ADPCM_INDEX_TABLE[code];
+  if (state.stepIndex < 0) state.stepIndex = 0;
+  if (state.stepIndex > 88) state.stepIndex = 88;
+  return state.predictor;
+}
+
+// Streams an AdpcmSample for interpolated playback. Decoding only runs
+// forwards; moving backwards or more than a block ahead re-seeks from the
+// stored block state.
+class AdpcmDecoder {
+public:
+  // cachedCodes, if given, is a faster copy of the first cachedLength
+  // samples' codes
+  void reset(const AdpcmSample *sample, const uint8_t *cachedCodes = nullptr, uint32_t cachedLength = 0) {
+    this->sample = sample;
+    this->cachedCodes = cachedCodes;
+    this->cachedLength = cachedLength;
+    position = INT32_MAX;  // Forces a seek on the first moveTo()
+  }
+  
+  // Decodes until before() and last() hold samples index and index + 1
+  inline void moveTo(uint32_t index) {
+    int32_t target = index + 1;
+    if (target < position || target - position > ADPCM_BLOCK_SAMPLES) {
+      seek(index);
+    }
+    const uint8_t *codes = ((uint32_t)target < cachedLength) ? cachedCodes : sample->codes;
+    while (position < target) {
+      step(codes);
+    }
+  }
+  
+  int16_t before() const { return beforeValue; }
+  int16_t last() const { return lastValue; }
+
+private:
+  void seek(uint32_t index) {
+    uint32_t block = index / ADPCM_BLOCK_SAMPLES;
+    state.predictor = sample->blockPredictors[block];
+    state.stepIndex = sample->blockStepIndices[block];
+    position = (int32_t)(block * ADPCM_BLOCK_SAMPLES) - 1;
+    lastValue = state.predictor;
+  }
+  
+  inline void step(const uint8_t *codes) {
+    position++;
+    uint8_t code = (codes[position >> 1] >> ((position & 1) * 4)) & 0x0F;
+    beforeValue = lastValue;
+    lastValue = adpcmDecodeNibble(state, code);
+  }
+  
+  const AdpcmSample *sample;
+  const uint8_t *cachedCodes;
+  uint32_t cachedLength;  // Samples, even
+  AdpcmState state;
+  int32_t position;  // Index of lastValue
+  int16_t beforeValue;
+  int16_t lastValue;
+};
+
+#endif // ADPCM_SAMPLE_H
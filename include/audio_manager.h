@@ -2,29 +2,73 @@
 #define AUDIO_MANAGER_H
 
 #include <Audio.h>
+#include "config.h"
+#include "voice_renderer.h"
+
+// Shared voice pool, mixed four at a time into the master mixer
+const int NUM_SUBMIXERS = (NUM_VOICES + 3) / 4;
+const int MAX_SUBMIXERS = MAX_VOICES / 4;
+
+enum RenderMode {
+  RENDER_WAVETABLE,  // One AudioSynthWavetable per voice through the mixer tree
+  RENDER_FUSED       // AudioVoiceRenderer mixes every voice into stereo in one pass
+};
+
+// One velocity layer of the instrument, fused renderer only
+struct VelocityLayer {
+  uint8_t maxVelocity;  // Highest velocity this layer plays
+  const char *name;
+  RenderInstrument instrument;
+};
 
 class AudioManager {
   public:
     AudioManager();
-    void begin();
+    void begin(RenderMode mode);
     void playDrum(int drumNum, int peakValue);
+    void correctDrum(int drumNum, int firedPeak, int measuredPeak);
     void setVolume(float volume);
     void playDrumNote(int drumNum, int midiNote, int peakValue);   
-    void setDrum1Note(uint8_t midiNote) { drum1Note = midiNote; }   
-    void setDrum2Note(uint8_t midiNote) { drum2Note = midiNote; }
+    void setDrumNote(int drumIndex, uint8_t midiNote) { drumNotes[drumIndex] = midiNote; }
+    unsigned long getVoicesStolen() const { return voicesStolen; }
+    void benchmark();  // Blocks ~10s printing audio CPU use of both render paths and cold-hit update times
 
   private:
-    AudioSynthWavetable wavetable1;
-    AudioSynthWavetable wavetable2;
+    struct VoiceState {
+      int8_t drum;              // Drum index that last played the voice
+      uint8_t velocity;
+      unsigned long startTime;  // millis() when the note started
+    };
+
+    int peakToVelocity(int peakValue) const;
+    int allocateVoice(int drumIndex);
+    int quietestVoice(int drumIndex, unsigned long currentTime) const;
+    bool isVoicePlaying(int voice);
+    void startVoice(int voice, int midiNote, int velocity, int drumIndex);
+    void stopVoice(int voice);
+    void printLayerReport() const;
+    int connectBenchmarkGraph();
+    void stopBenchmarkVoices();
+    float benchmarkVoices(int count, const RenderInstrument *instrument);
+
+    RenderMode renderMode;
+    AudioVoiceRenderer renderer;
+    const VelocityLayer *layers;  // Softest first
+    int layerCount;
+    AudioSynthWavetable voices[MAX_VOICES];  // The live graph uses NUM_VOICES of them
+    AudioMixer4 subMixers[MAX_SUBMIXERS];
     AudioMixer4 mixer1;
     AudioOutputI2S i2s1;
-    AudioConnection* patchCord1;
-    AudioConnection* patchCord2;
-    AudioConnection* patchCord3;
-    AudioConnection* patchCord4;
+    AudioConnection* patchCords[NUM_VOICES + NUM_SUBMIXERS + 2];
+    // Only connected during benchmark(), to run the path begin() left idle.
+    // Static rather than new, as the heap is closed once setup() has finished.
+    AudioAmplifier benchmarkSink;
+    AudioConnection benchmarkCords[1 + MAX_VOICES + MAX_SUBMIXERS];
     AudioControlSGTL5000 sgtl5000_1;
-    uint8_t drum1Note;  
-    uint8_t drum2Note;
+    VoiceState voiceStates[NUM_VOICES];
+    int8_t lastVoice[NUM_DRUMS];  // Voice of each drum's latest note, for correctDrum()
+    uint8_t drumNotes[NUM_DRUMS];
+    unsigned long voicesStolen;
 };
 
 #endif // AUDIO_MANAGER_H
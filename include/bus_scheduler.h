@@ -0,0 +1,49 @@
+#ifndef BUS_SCHEDULER_H
+#define BUS_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "drum_trigger.h"
+
+// Work that can couple into the piezo inputs or stall the CPU mid-scan
+enum BusOperation {
+  BUS_DISPLAY,  // OLED frames on Wire1
+  BUS_EEPROM,   // Note saves, which program the flash
+  NUM_BUS_OPERATIONS
+};
+
+// Holds display and EEPROM traffic back while any drum is scanning and for
+// BUS_GUARD_MS after, the way the samples moved off the SD card to keep SPI
+// quiet. Nothing waits longer than BUS_MAX_DEFER_MS in all, so the UI still
+// updates while the drums are played continuously. An operation made of
+// several starts, like a frame sent page by page, runs until finished()
+// once it has been forced, instead of waiting again for each part.
+class BusScheduler {
+public:
+  BusScheduler();
+  void begin(DrumTrigger* const* drumTriggers, int count);
+  void update(unsigned long sampleClockUs);  // Call every loop after the sampler, with its clock
+  bool isDrumScanning() const { return scanning; }
+  // True when an operation that has work to do may start now
+  bool mayStart(BusOperation operation, unsigned long currentTime);
+  void finished(BusOperation operation);  // All its work is done, the next one waits afresh
+  unsigned long getDeferred(BusOperation operation) const { return deferred[operation]; }
+  unsigned long getForced(BusOperation operation) const { return forced[operation]; }
+  void printReport();
+
+private:
+  DrumTrigger* const* triggers;
+  int numTriggers;
+  bool scanning;
+  bool scanSeen;                           // False until the first scan, so boot is quiet
+  unsigned long sampleClock;               // As of the last update()
+  unsigned long lastScanEnd;               // Sample clock, us
+  unsigned long lastHitTimes[NUM_DRUMS];   // Each trigger's getHitTime() as last seen
+  unsigned long waitStart[NUM_BUS_OPERATIONS];  // millis()
+  bool waiting[NUM_BUS_OPERATIONS];
+  bool forcing[NUM_BUS_OPERATIONS];       // Past the deferral limit until finished()
+  unsigned long deferred[NUM_BUS_OPERATIONS];  // Operations that had to wait
+  unsigned long forced[NUM_BUS_OPERATIONS];    // Of those, started at the deferral limit
+};
+
+#endif // BUS_SCHEDULER_H
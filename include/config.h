@@ -5,11 +5,98 @@
 const int DRUM_PIN_1 = A0;
 const int DRUM_PIN_2 = A1;
 
+// Analog multiplexer (74HC4067) for more drum inputs. When enabled, every
+// drum is read through the mux on MUX_INPUT_PIN instead of DRUM_PIN_1/2.
+const bool USE_DRUM_MUX = false;
+const int MUX_CHANNELS = 8;                      // Up to 16
+const int MUX_INPUT_PIN = A0;
+const int MUX_ADC_CHANNEL = 7;                   // A0 = ADC1 input 7
+// S0-S3, clear of the audio shield (6, 7, 8, 10-13, 15, 18-21, 23), the
+// buttons, the OLED on 16/17 and A0/A12. 24 is a pad on the underside.
+const int MUX_SELECT_PINS[] = {0, 1, 22, 24};
+const int MUX_SAMPLE_PERIOD_US = 100;            // 10 kHz per channel at any channel count
+const int MUX_SETTLE_NS = 500;
+const int MUX_CONVERSION_NS = 2000;              // Budget for one 12-bit conversion, checked in beginMux()
+static_assert(MUX_SETTLE_NS + MUX_CONVERSION_NS < MUX_SAMPLE_PERIOD_US * 1000 / MUX_CHANNELS,
+              "Each mux tick must settle and finish its conversion before the next one starts");
+const int MUX_RING_SIZE = 256;                   // Samples per channel, power of two
+
+const int NUM_DRUMS = USE_DRUM_MUX ? MUX_CHANNELS : 2;
+const int DRUM_PINS[] = {DRUM_PIN_1, DRUM_PIN_2};
+
 // Trigger parameters
-const int THRESHOLD = 100;
+const int THRESHOLD = 100;  // Fixed threshold, or starting point when adaptive
 const int TRIGGER_VALUE = 100;
-const int SCAN_TIME = 5;
-const int MASK_TIME = 50;
+const unsigned long SCAN_TIME_US = 5000;   // Per-drum default, see DrumTrigger::setScanTime
+const unsigned long MASK_TIME_US = 10000;  // Per-drum default, see DrumTrigger::setMaskTime
+
+// Adaptive threshold: baseline + factor * noise, learned while the drum is idle
+const bool ADAPTIVE_THRESHOLD = true;
+const int NOISE_THRESHOLD_FACTOR = 6;    // Multiples of the mean absolute deviation
+const int NOISE_TRACK_SHIFT = 12;        // Averaging over ~4096 idle samples
+const int NOISE_CLIP_FACTOR = 2;         // Deviations count up to this many times the noise
+const int ADAPTIVE_THRESHOLD_MIN = 30;
+const int ADAPTIVE_THRESHOLD_MAX = 400;
+
+// Decaying retrigger threshold after each hit (per drum via DrumTrigger::setMaskDecay)
+const float MASK_DECAY_START = 0.8;        // Fraction of the last peak the threshold starts at
+const unsigned long MASK_DECAY_US = 30000; // Time constant of the threshold decay
+
+// Early fire trigger mode (TRIGGER_EARLY)
+#define DEFAULT_TRIGGER_MODE TRIGGER_PEAK
+const unsigned long EARLY_SLOPE_TIME_US = 200;  // Rising edge measured before firing
+const unsigned long EARLY_RISE_TIME_US = 600;   // Remaining rise time assumed when predicting
+const bool EARLY_FIRE_CORRECTION = true;        // Rescale the voice once the true peak is known
+
+// Crosstalk rejection: a hit on drum j is dropped if its peak is below
+// CROSSTALK_MATRIX[i][j] times the peak of a hit on drum i within the window.
+// Pairs not listed (mux drums beyond the first two) start at 0, i.e. off.
+const unsigned long CROSSTALK_WINDOW_US = 3000;
+const float CROSSTALK_MATRIX[NUM_DRUMS][NUM_DRUMS] = {
+  {0.0, 0.3},
+  {0.3, 0.0}
+};
+
+// Sampling backend
+#define DEFAULT_SAMPLER_MODE (USE_DRUM_MUX ? SAMPLER_MUX : SAMPLER_DMA)
+const int SAMPLE_PERIOD_US = 40;     // 25 kHz per drum in DMA mode
+const int SAMPLE_RING_SIZE = 1024;   // Sample pairs, must be a power of two
+const int SAMPLE_BLOCK_SIZE = 64;    // Samples handed to DrumTrigger at once
+const int DRUM_ADC_CHANNEL_1 = 7;    // A0 = input 7 on ADC1 and ADC2
+const int DRUM_ADC_CHANNEL_2 = 8;    // A1 = input 8 on ADC1 and ADC2
+const unsigned long COMPARE_IDLE_HOLD_MS = 200;  // Quiet time before SAMPLER_COMPARE re-arms
+const unsigned long COMPARE_NOISE_SAMPLE_MS = 10;  // Noise floor sampling while the compare is armed
+
+// Latency histograms (send 'l' over USB serial for a report, 'r' to reset)
+const uint32_t LATENCY_BIN_US = 100;
+const int LATENCY_BINS = 100;        // 0-10 ms, last bin also holds anything slower
+
+// Voice pool shared by all drums
+const int MAX_VOICES = 16;           // The mixer tree has 4 submixers of 4 voices; the b benchmark goes this far
+const int NUM_VOICES = 8;            // Up to MAX_VOICES
+static_assert(NUM_VOICES >= 1 && NUM_VOICES <= MAX_VOICES, "The mixer tree has 4 submixers of 4 voices");
+const int VOICES_PER_DRUM = 3;       // Overlapping decays allowed per drum
+const float VOICE_DECAY_MS = 1000;   // Decay time constant used to rank voices for stealing
+#define DEFAULT_RENDER_MODE RENDER_FUSED
+const float DRUM_PAN[NUM_DRUMS] = {0, 0};  // -1 left to 1 right, fused renderer only
+const bool USE_COMPRESSED_SAMPLES = true;  // IMA-ADPCM samples, fused renderer only
+const bool USE_MODAL_TAILS = false;        // Stored attacks with synthesized decays, compressed samples only
+#ifdef BENCHMARK_WAVETABLE_GRAPH
+const bool BENCHMARK_WAVETABLE = true;     // Set by env:teensy40_benchmark: b also times the wavetable graph
+#else
+const bool BENCHMARK_WAVETABLE = false;    // True links the 300 KB PCM sample and 8 more audio blocks
+#endif
+const float ATTACK_CACHE_MS = 20;          // Start of each sample copied from flash into DTCM, 0 to disable
+const uint32_t ATTACK_CACHE_BYTES = 8192;  // DTCM set aside for the attack cache, fused renderer only
+
+// Velocity layers (compressed samples only)
+const int SOFT_LAYER_MAX_VELOCITY = 80;   // Soft layer plays up to this velocity
+const int LAYER_CROSSFADE_WIDTH = 16;     // Velocity span blended across a layer boundary, 0 to switch hard
+
+// Deferred serial logging
+const int LOG_RING_SIZE = 64;       // Records, must be a power of two
+const int LOG_DRAIN_PER_CALL = 4;   // Records printed per idle loop at most
+const int LOG_MAX_LINE = 48;        // Serial buffer space needed to print one
 
 // Potentiometer pins
 const int POT_PIN_3 = A12;
@@ -30,28 +117,55 @@ const int NUM_BUTTONS = 5;
 // EEPROM Configuration
 #define EEPROM_MAGIC_NUMBER 0x42
 #define EEPROM_ADDR_MAGIC 0
-#define EEPROM_ADDR_DRUM1_NOTE 1
-#define EEPROM_ADDR_DRUM2_NOTE 2
+#define EEPROM_ADDR_DRUM1_NOTE 1  // Drum n note at EEPROM_ADDR_DRUM1_NOTE + n - 1
 
 // Default MIDI Notes (Perfect Fifth: C2 and G2)
 #define DEFAULT_DRUM1_NOTE 36  // C2
 #define DEFAULT_DRUM2_NOTE 43  // G2
 
+// Drums beyond the first two continue up in whole tones from drum 2
+inline uint8_t defaultDrumNote(int drumIndex) {
+    if (drumIndex == 0) {
+        return DEFAULT_DRUM1_NOTE;
+    }
+    return DEFAULT_DRUM2_NOTE + (drumIndex - 1) * 2;
+}
+
 // Menu Timeouts (milliseconds)
 #define MENU_TIMEOUT_MS 15000
 #define OVERLAY_TIMEOUT_MS 3000
 #define EEPROM_WRITE_DELAY_MS 30000
 
+// Display flushing (DisplayFlushMode), see DisplayManager::update()
+#define DEFAULT_DISPLAY_FLUSH FLUSH_PAGE
+
+// Quiet windows for display and EEPROM traffic (send 'q' for deferral counts)
+const unsigned long BUS_GUARD_MS = 20;        // After the last drum scan ends, in sample clock
+const unsigned long BUS_MAX_DEFER_MS = 200;   // Longest an operation is held back
+
 // Hit Dot Display Duration
 #define HIT_DOT_DURATION_MS 250
 
-// Convert MIDI note number to note name string (e.g., 60 -> "C3")
-inline String midiToNoteName(uint8_t midiNote) {
-    const char* noteNames[] = {"C", "C#", "D", "D#", "E", "F", 
-                                "F#", "G", "G#", "A", "A#", "B"};
-    int octave = (midiNote / 12) - 2;  // MIDI 60 = C3
-    int noteIndex = midiNote % 12;
-    return String(noteNames[noteIndex]) + String(octave);
+constexpr const char *NOTE_NAMES[12] = {"C", "C#", "D", "D#", "E", "F",
+                                        "F#", "G", "G#", "A", "A#", "B"};
+const int NOTE_NAME_SIZE = 5;  // Longest is "C#-2" plus the terminator
+
+// Write a MIDI note's name into buffer (e.g., 60 -> "C3") and return it.
+// No heap: buffer must hold NOTE_NAME_SIZE chars.
+inline const char *midiToNoteName(uint8_t midiNote, char *buffer) {
+    const char *name = NOTE_NAMES[midiNote % 12];
+    int octave = (midiNote / 12) - 2;  // MIDI 60 = C3, so -2 to 8
+    char *out = buffer;
+    while (*name) {
+        *out++ = *name++;
+    }
+    if (octave < 0) {
+        *out++ = '-';
+        octave = -octave;
+    }
+    *out++ = '0' + octave;
+    *out = '\0';
+    return buffer;
 }
 
 #endif // CONFIG_H
@@ -0,0 +1,28 @@
+#ifndef CROSSTALK_FILTER_H
+#define CROSSTALK_FILTER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "drum_trigger.h"
+
+class CrosstalkFilter {
+public:
+  CrosstalkFilter();
+  void begin(DrumTrigger* const* drumTriggers, int count);
+  void update();  // Call after the sampler and before hits are played
+  void setCoefficient(int fromDrum, int toDrum, float coefficient);
+  unsigned long getSuppressed(int drumIndex) const { return suppressed[drumIndex]; }
+
+private:
+  bool isCrosstalk(int drumIndex) const;
+
+  DrumTrigger* const* triggers;
+  int numTriggers;
+  float coefficients[NUM_DRUMS][NUM_DRUMS];
+  bool hasHit[NUM_DRUMS];
+  unsigned long hitTime[NUM_DRUMS];
+  int hitPeak[NUM_DRUMS];
+  unsigned long suppressed[NUM_DRUMS];
+};
+
+#endif // CROSSTALK_FILTER_H
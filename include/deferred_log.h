@@ -0,0 +1,45 @@
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+#include "config.h"
+
+enum LogType : uint8_t {
+  LOG_DRUM_HIT,     // id = drum, a = measured peak, b = predicted peak or -1
+  LOG_CROSSTALK,    // id = drum
+  LOG_BUTTON,       // id = button pin
+  LOG_POT,          // a = pot reading
+  LOG_VOLUME        // a = volume percent
+};
+
+// Fixed-size single-producer/single-consumer ring of compact log records.
+// Producers (loop context) pay a few stores; drain() formats and prints the
+// records later, only when the Serial buffer has room. When the ring is full
+// new records are dropped and counted instead of blocking.
+class DeferredLog {
+public:
+  DeferredLog();
+  void write(LogType type, uint8_t id, int16_t a = 0, int16_t b = 0);
+  void drain();  // Call when idle, prints at most LOG_DRAIN_PER_CALL records
+  unsigned long getDropped() const { return dropped; }
+
+private:
+  struct LogRecord {
+    LogType type;
+    uint8_t id;
+    int16_t a;
+    int16_t b;
+  };
+
+  void print(const LogRecord &record);
+
+  LogRecord records[LOG_RING_SIZE];
+  volatile uint32_t head;  // Written by the producer
+  volatile uint32_t tail;  // Written by drain()
+  volatile unsigned long dropped;
+  unsigned long droppedReported;
+};
+
+extern DeferredLog debugLog;
+
+#endif // DEFERRED_LOG_H
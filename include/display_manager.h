@@ -2,6 +2,8 @@
 #define DISPLAY_MANAGER_H
 
 #include <bus1_U8g2lib.h>
+#include "oled_transfer.h"
+#include "bus_scheduler.h"
 
 enum DisplayMode {
     DISPLAY_IDLE,
@@ -9,25 +11,47 @@ enum DisplayMode {
     DISPLAY_MENU
 };
 
+// How a finished frame reaches the panel
+enum DisplayFlushMode {
+  FLUSH_FRAME,          // All 8 pages in one DMA transfer
+  FLUSH_PAGE,           // One page per update() call, by DMA
+  FLUSH_PAGE_BLOCKING   // One page per update() call through U8g2 and Wire, ~3 ms each
+};
+
 
 class DisplayManager {
 public:
   DisplayManager();
-  void begin();
+  void begin(DisplayFlushMode mode, BusScheduler *busScheduler);
   void showSplash();
   void showDrumHit(int drumNum, int peakValue);
   void showButton(int buttonPin);
   void setDisplayMode(DisplayMode mode);
-  void showIdleScreen(bool drum1Hit, bool drum2Hit);  
+  void showIdleScreen(const bool *drumHits, int count);  
   void showVolumeOverlay(int volume);
-  void showMenu(int selectedDrum, uint8_t drum1Note, uint8_t drum2Note, bool drum1Hit, bool drum2Hit);  
-  void showHitDot(int drumIndex, bool state);
-  void update();  // Call every loop to handle animations/timeouts
+  void showMenu(int selectedDrum, const uint8_t *drumNotes, const bool *drumHits, int count);  
+  void showHitDot(int drumIndex, int count, bool state);
+  void update();  // Call every loop: sends a waiting frame, or its next page, when the scheduler allows
+  unsigned long getTransferFailures() const { return oled.getFailures(); }
 
 private:
+  void drawHitDots(const bool *drumHits, int count);
+  int hitDotX(int drumIndex, int count) const;
+  void flush();
+  bool dirtyColumns(int page, int &first, int &count);
+  void markSent(int page, int first, int count);
+
   U8G2_SSD1306_128X64_NONAME_F_HW_I2C display;
+  OledTransfer oled;
   DisplayMode currentMode;
   unsigned long lastUpdateTime;
+  DisplayFlushMode flushMode;
+  BusScheduler *scheduler;
+  bool framePending;  // Buffer changed while the last frame was still sending
+  int flushPage;      // Next page to send, OLED_PAGES once all are sent, -1 between frames
+  uint8_t sentFrame[OLED_PAGES * OLED_WIDTH];  // What the panel shows, as far as we know
+  uint8_t stalePages;  // Bit per page whose sentFrame copy can't be trusted
+  unsigned long failuresSeen;
 };
 
 #endif // DISPLAY_MANAGER_H
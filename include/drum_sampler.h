@@ -0,0 +1,51 @@
+#ifndef DRUM_SAMPLER_H
+#define DRUM_SAMPLER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "drum_trigger.h"
+
+enum SamplerMode {
+  SAMPLER_POLLED,  // analogRead() once per loop() iteration
+  SAMPLER_SYNC,    // Once per loop(), drum 1 on ADC1 and drum 2 on ADC2 together
+  SAMPLER_DMA,     // Timer-triggered ADC conversions streamed into a ring by DMA
+  SAMPLER_MUX,     // Timer interrupt scanning drums through an analog multiplexer
+  SAMPLER_COMPARE  // Idle on ADC hardware compare, SAMPLER_SYNC polling once woken
+};
+
+class DrumSampler {
+public:
+  DrumSampler();
+  void begin(DrumTrigger* const* drumTriggers, int count, SamplerMode samplerMode);
+  void update();  // Call every loop to feed new samples to the triggers
+  SamplerMode getMode() const { return mode; }
+  unsigned long getOverruns() const { return overruns; }
+  unsigned long getWakeups() const { return wakeups; }
+  unsigned long getMuxMisses() const;  // Mux ticks that found the ADC still converting
+  bool isAwake() const;
+  unsigned long getSampleClockUs();  // "Now" in the timebase the triggers see
+  int analogReadShared(uint8_t pin);  // analogRead() that is safe while compare is armed
+
+private:
+  void beginDMA();
+  void beginMux();
+  void armCompare();
+  void updateSync();
+  void updateDMA();
+  void updateMux();
+  void updateCompare();
+  uint32_t samplesWritten();
+
+  DrumTrigger* const* triggers;
+  int numTriggers;
+  SamplerMode mode;
+  uint32_t samplesRead;
+  uint32_t lastWritten;
+  unsigned long overruns;
+  unsigned long wakeups;
+  unsigned long lastActiveTime;
+  unsigned long lastNoiseSampleTime;  // millis() of the last noise sample taken while armed
+  uint16_t block[SAMPLE_BLOCK_SIZE];
+};
+
+#endif // DRUM_SAMPLER_H
@@ -3,26 +3,77 @@
 
 #include <Arduino.h>
 
+enum TriggerMode {
+  TRIGGER_PEAK,   // Fire at the end of the scan window with the measured peak
+  TRIGGER_EARLY   // Fire just after the threshold crossing with a predicted peak
+};
+
 class DrumTrigger {
 public:
+  DrumTrigger();  // Input set later by begin(pin, drumNumber)
   DrumTrigger(int pin, int drumNumber);
   void begin();
+  void begin(int pin, int drumNumber);
   void update();
-  int getPeakValue() const { return peakValue; }
+  void update(int value);  // Sample already converted by DrumSampler
+  void processBlock(const uint16_t* samples, int count, unsigned long firstSampleUs,
+                    unsigned long samplePeriodUs);
+  int getPeakValue() const { return firedPeak; }        // Peak the note was fired with
+  int getMeasuredPeak() const { return peakValue; }     // Peak seen over the scan window
   bool wasTriggered() const { return triggered; }
   void clearTriggered() { triggered = false; }
+  void cancelHit();  // Drop the current hit, e.g. as crosstalk from another drum
+  bool isScanning() const { return scanning; }
+  bool isIdle() const { return !scanning && lastHitPeak == 0; }  // No hit or ring-out
+  unsigned long getHitTime() const { return scanStartTime; }  // Threshold crossing
+  unsigned long getFireTime() const { return fireTime; }      // When triggered was set
+  bool wasPeakCorrected() const { return peakCorrected; }
+  void clearPeakCorrected() { peakCorrected = false; }
+  void setMode(TriggerMode triggerMode) { mode = triggerMode; }
+  TriggerMode getMode() const { return mode; }
   void setTriggerValue(int value);
+  void setScanTime(unsigned long us);
+  void setMaskTime(unsigned long us);
+  void setMaskDecay(float startRatio, unsigned long decayUs);
+  void setAdaptiveThreshold(bool enabled);
+  int getThreshold() const { return threshold; }
+  int getBaseline() const { return baselineQ16 >> 16; }
+  int getNoise() const { return noiseQ16 >> 16; }
+  unsigned long getScanTime() const { return scanTimeUs; }
+  unsigned long getMaskTime() const { return maskTimeUs; }
   int getDrumNumber() const { return drumNum; }
 
 private:
+  void processSample(int value, unsigned long currentTime);
+  int predictPeak(int value, unsigned long currentTime) const;
+  int retriggerLevel(unsigned long currentTime);
+  int fireLevel() const;
+  void trackNoise(int value);
+
   int drumPin;
   int drumNum;
   int triggerValue;
+  unsigned long scanTimeUs;
+  unsigned long maskTimeUs;
   unsigned long lastHitTime;
   bool scanning;
   unsigned long scanStartTime;
   int peakValue;
   bool triggered;
+  TriggerMode mode;
+  int crossingValue;
+  int firedPeak;
+  unsigned long fireTime;
+  bool firedEarly;
+  bool peakCorrected;
+  bool hitCancelled;
+  int lastHitPeak;
+  float maskDecayStart;
+  float maskDecayUs;
+  bool adaptiveThreshold;
+  int threshold;
+  int32_t baselineQ16;
+  int32_t noiseQ16;
 };
 
 #endif // DRUM_TRIGGER_H
@@ -8,22 +8,27 @@ public:
     EEPROMManager();
     void begin();
     
-    // Load notes from EEPROM, returns true if valid data found
-    bool loadNotes(uint8_t &drum1Note, uint8_t &drum2Note);
+    // Load one note per drum from EEPROM, returns true if valid data found
+    bool loadNotes(uint8_t *notes, int count);
     
     // Save note to EEPROM (with read-before-write)
     void saveNote(int drumIndex, uint8_t note);
     
-    // Check if write is needed and handle delayed write
+    // Check if write is needed and handle delayed write; a due write
+    // waits while writeAllowed is false
     void update(unsigned long currentTime, bool notesDirty, 
-                unsigned long lastNoteChange, uint8_t drum1Note, uint8_t drum2Note);
+                unsigned long lastNoteChange, const uint8_t *notes, int count,
+                bool writeAllowed = true);
+    bool isWriteDue(unsigned long currentTime) const {
+        return pendingWrite && currentTime >= writeScheduledTime;
+    }
 
 private:
-    void initializeEEPROM(uint8_t drum1Note, uint8_t drum2Note);
+    void initializeEEPROM(const uint8_t *notes, int count);
     bool validateNote(uint8_t note);
     
     bool pendingWrite;
     unsigned long writeScheduledTime;
 };
 
-#endif // EEPROM_MANAGER_H
\ No newline at end of file
+#endif // EEPROM_MANAGER_H
@@ -0,0 +1,17 @@
+#ifndef HEAP_GUARD_H
+#define HEAP_GUARD_H
+
+// Debug check that loop() never touches the heap. Build the
+// teensy40_heapcheck environment, which wraps malloc, calloc and realloc.
+// After armHeapGuard(), the first allocation is recorded, and
+// checkHeapGuard() prints its caller's address (look it up with
+// addr2line) and halts. In other builds both calls compile to nothing.
+#ifdef HEAP_GUARD
+void armHeapGuard();
+void checkHeapGuard();  // Call every loop
+#else
+inline void armHeapGuard() {}
+inline void checkHeapGuard() {}
+#endif
+
+#endif // HEAP_GUARD_H
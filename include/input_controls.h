@@ -11,8 +11,12 @@ public:
   int getPot3Value() const { return pot3Value; }
   int getButtonPressed() const { return buttonPressed; }
   void clearButtonPressed() { buttonPressed = -1; }
+  void setAnalogReader(int (*reader)(uint8_t pin)) { analogReader = reader; }
 
 private:
+  // analogRead() by default; replaced when the ADCs are shared with DrumSampler
+  int (*analogReader)(uint8_t pin);
+  
   // Pot values
   int pot3Value;
   int lastPot3Value;
@@ -0,0 +1,65 @@
+#ifndef LATENCY_MONITOR_H
+#define LATENCY_MONITOR_H
+
+#include <Arduino.h>
+#include <Audio.h>
+#include "config.h"
+
+// Stages timed from the sample that first crossed the threshold
+enum LatencyStage {
+  STAGE_SCAN_END,  // Trigger fired (end of scan, or early fire)
+  STAGE_PLAY,      // AudioManager::playDrum() returned
+  STAGE_AUDIO,     // Next audio library update after playDrum()
+  NUM_LATENCY_STAGES
+};
+
+// Zero-input node whose update() runs in the audio update interrupt, used
+// to timestamp the first audio block that can contain a new note
+class AudioUpdateProbe : public AudioStream {
+public:
+  AudioUpdateProbe() : AudioStream(0, nullptr), armed(false), stampCycles(0) { active = true; }
+  void arm() { armed = true; }
+  bool isArmed() const { return armed; }
+  uint32_t getStampCycles() const { return stampCycles; }
+  virtual void update();
+
+private:
+  volatile bool armed;
+  volatile uint32_t stampCycles;
+};
+
+class LatencyMonitor {
+public:
+  LatencyMonitor();
+  void hitFired(int drumIndex, unsigned long crossingAgeUs, unsigned long fireAgeUs);
+  void notePlayed(int drumIndex);
+  void update();  // Call every loop: collects audio stamps
+  void loopStarted();  // Call at the top of loop(): times each pass for the jitter report
+  void loopSleeping() { loopStartCycles = 0; }  // The next pass ends a sleep, not a pass
+  void printReport();
+  void reset();
+
+private:
+  struct Histogram {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sumUs;
+    uint16_t bins[LATENCY_BINS];
+  };
+
+  void record(int drumIndex, LatencyStage stage, uint32_t us);
+  void record(Histogram &h, uint32_t us);
+  void printHistogram(const Histogram &h);
+  uint32_t percentile(const Histogram &h, int percent) const;
+  uint32_t cyclesToUs(uint32_t cycles) const;
+
+  AudioUpdateProbe probe;
+  Histogram histograms[NUM_DRUMS][NUM_LATENCY_STAGES];
+  uint32_t crossingCycles[NUM_DRUMS];
+  bool audioPending[NUM_DRUMS];
+  uint32_t loopStartCycles;  // 0 until the first pass after a reset
+  Histogram loopPasses;
+};
+
+#endif // LATENCY_MONITOR_H
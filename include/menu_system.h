@@ -13,7 +13,7 @@ class MenuSystem {
 public:
     MenuSystem();
     
-    void begin(uint8_t initialDrum1Note, uint8_t initialDrum2Note);
+    void begin(const uint8_t *initialNotes);
     void update(unsigned long currentTime);
     
     // Button handling
@@ -22,21 +22,19 @@ public:
     // State queries
     bool isMenuActive() const { return state == MENU_ACTIVE; }
     int getSelectedDrum() const { return selectedDrum; }
-    uint8_t getDrum1Note() const { return drum1Note; }
-    uint8_t getDrum2Note() const { return drum2Note; }
+    uint8_t getDrumNote(int drumIndex) const { return drumNotes[drumIndex]; }
+    const uint8_t *getDrumNotes() const { return drumNotes; }
     bool areNotesDirty() const { return notesDirty; }
     unsigned long getLastNoteChange() const { return lastNoteChange; }
     
     // State setters
-    void setDrum1Note(uint8_t note) { drum1Note = note; }
-    void setDrum2Note(uint8_t note) { drum2Note = note; }
+    void setDrumNote(int drumIndex, uint8_t note) { drumNotes[drumIndex] = note; }
     void clearDirtyFlag() { notesDirty = false; }
     
 private:
     MenuState state;
-    int selectedDrum;  // 0 or 1
-    uint8_t drum1Note;
-    uint8_t drum2Note;
+    int selectedDrum;  // 0 to NUM_DRUMS - 1
+    uint8_t drumNotes[NUM_DRUMS];
     bool notesDirty;
     unsigned long lastMenuActivity;
     unsigned long lastNoteChange;
@@ -0,0 +1,29 @@
+#ifndef MODAL_TAIL_H
+#define MODAL_TAIL_H
+
+#include <stdint.h>
+
+// Synthesized decay for a sample that only stores its attack. Each partial
+// is a damped sinusoid fitted to the recording, so the tail follows the
+// played pitch without resampling. The stored attack fades out over
+// fadeLength samples from start while the tail fades in.
+// The converter writes its fitted partials straight into these structs.
+const int MAX_MODAL_PARTIALS = 16;
+
+// At the sample's root pitch
+struct ModalPartial {
+  float frequency;  // Hz
+  float decay;      // Nepers per second
+  float amplitude;  // Sample units at the tail start
+  float phase;      // Radians at the tail start
+};
+
+struct ModalTail {
+  const ModalPartial *partials;
+  uint8_t partialCount;
+  uint32_t start;       // Sample the tail starts at
+  uint32_t fadeLength;  // Samples
+  uint32_t length;      // Samples from the start until the tail has decayed
+};
+
+#endif // MODAL_TAIL_H
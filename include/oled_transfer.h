@@ -0,0 +1,34 @@
+#ifndef OLED_TRANSFER_H
+#define OLED_TRANSFER_H
+
+#include <Arduino.h>
+
+const int OLED_WIDTH = 128;
+const int OLED_PAGES = 8;  // 8-pixel rows, one U8g2 tile row each
+
+// Sends whole SSD1306 frames on Wire1 (LPI2C3) by DMA, so loop() carries on
+// while the ~25 ms transfer runs. U8g2 still initialises the display through
+// the Wire library; once begin() has run, every frame goes through here.
+class OledTransfer {
+public:
+  OledTransfer();
+  void begin(uint8_t i2cAddress);
+  bool isBusy();
+  // Copies a U8g2 full frame buffer (OLED_PAGES x OLED_WIDTH bytes) and
+  // starts sending it; the caller waits for isBusy() to clear first
+  void send(const uint8_t *buffer);
+  // Same for one page, or a run of its columns; a whole page is ~3 ms on the bus
+  void sendPage(const uint8_t *buffer, int page, int firstColumn = 0, int columns = OLED_WIDTH);
+  unsigned long getFailures() const { return failures; }
+
+private:
+  uint16_t *buildPage(const uint8_t *buffer, int page, int first, int count);
+  void start(uint16_t *words, unsigned int bytes);
+  void abort();
+
+  uint8_t address;
+  bool sending;
+  unsigned long failures;  // NACKs and bus errors, the frame is dropped
+};
+
+#endif // OLED_TRANSFER_H
@@ -0,0 +1,28 @@
+#ifndef SAMPLE_REFERENCE_H
+#define SAMPLE_REFERENCE_H
+
+#include <stdint.h>
+
+// What the converter expects each zone to sound like, written next to the
+// instrument tables as src/samples/<instrument>_reference.h. Only the native
+// tests include it, so it costs no flash.
+// The converter and the tests use the same window and checksum from here.
+const int REFERENCE_WINDOW_MS = 50;
+
+struct ZoneReference {
+  uint8_t rootNote;
+  uint32_t length;        // Samples stored
+  uint32_t checksum;      // sampleChecksum() of the samples as stored, after ADPCM decoding
+  const int16_t *levels;  // Converter's render at the root pitch, RMS in 0.01 dB per window; nullptr unless looped or synthesized
+  uint16_t levelCount;
+};
+
+const uint32_t SAMPLE_CHECKSUM_START = 2166136261u;
+
+// FNV-1a over each sample's two bytes, low byte first
+inline uint32_t sampleChecksum(uint32_t hash, int16_t sample) {
+  hash = (hash ^ ((uint16_t)sample & 0xFF)) * 16777619u;
+  return (hash ^ ((uint16_t)sample >> 8)) * 16777619u;
+}
+
+#endif // SAMPLE_REFERENCE_H
@@ -0,0 +1,124 @@
+#ifndef VOICE_RENDERER_H
+#define VOICE_RENDERER_H
+
+#include <Audio.h>
+#include "config.h"
+#include "adpcm_sample.h"
+#include "modal_tail.h"
+
+// Renders the whole voice pool straight into a stereo block pair, in place
+// of one AudioSynthWavetable per voice feeding the mixer tree. Voices play
+// AudioSynthWavetable instrument data with its DAHDSR volume envelope; the
+// vibrato and modulation LFOs are not applied. Samples may be stored as
+// IMA-ADPCM and are then decoded during render, and may store only their
+// attack and continue with a synthesized ModalTail. The start of each
+// sample can be copied into DTCM so a new note does not wait on flash.
+
+// Instrument data, optionally with one AdpcmSample per instrument sample
+// replacing its PCM data and one ModalTail per sample continuing it
+struct RenderInstrument {
+  const AudioSynthWavetable::instrument_data *data;
+  const AdpcmSample *compressed;
+  const ModalTail *tails;
+};
+
+const int MAX_CACHED_ATTACKS = 32;
+
+class AudioVoiceRenderer : public AudioStream {
+public:
+  AudioVoiceRenderer();
+  // A blend layer plays alongside, at blend (0-1) against 1 - blend for layer
+  void playNote(int voice, int midiNote, int velocity, float pan, const RenderInstrument &layer,
+                const RenderInstrument *blendLayer = nullptr, float blend = 0);
+  void stop(int voice);
+  void amplitude(int voice, float gain);  // Scales a sounding note, 0-1
+  void setMasterGain(float gain);
+  bool isPlaying(int voice) const { return voices[voice].envState != ENV_IDLE; }
+  // Copies the first ms of each of the instrument's samples into the attack
+  // cache, as far as ATTACK_CACHE_BYTES allows, and returns the bytes used
+  uint32_t cacheAttacks(const RenderInstrument &instrument, float ms);
+  void useAttackCache(bool enabled) { attackCacheEnabled = enabled; }  // Applies to new notes
+  uint32_t getWorstUpdateCycles() const { return worstUpdateCycles; }
+  void resetWorstUpdateCycles() { worstUpdateCycles = 0; }
+  virtual void update();
+
+private:
+  enum EnvelopeState : uint8_t {
+    ENV_IDLE,
+    ENV_DELAY,
+    ENV_ATTACK,
+    ENV_HOLD,
+    ENV_DECAY,
+    ENV_SUSTAIN,
+    ENV_RELEASE
+  };
+
+  // Damped sinusoid as y[n] = a1 y[n-1] - a2 y[n-2], coefficients in Q29
+  // and state in sample units << TAIL_SHIFT
+  struct Resonator {
+    int32_t a1;
+    int32_t a2;
+    int32_t y1;
+    int32_t y2;
+  };
+
+  // A sample's start, copied into the attack cache
+  struct CachedAttack {
+    const AudioSynthWavetable::sample_data *sample;
+    const void *data;          // PCM samples or ADPCM codes
+    uint32_t length;           // Samples
+  };
+
+  // Read position in one layer's sample
+  struct SampleCursor {
+    const AudioSynthWavetable::sample_data *sample;
+    const AdpcmSample *adpcm;  // nullptr for PCM samples
+    AdpcmDecoder decoder;
+    const int16_t *cachedPcm;  // nullptr when the PCM sample is not cached
+    uint32_t cachedPhaseEnd;   // Periods starting below this read only cached samples
+    uint32_t phase;
+    uint32_t phaseIncrement;
+    float gain;                // Velocity curve, sample attenuation and layer blend
+    bool sampleFinished;
+    bool finished;             // Sample and tail both done
+    Resonator resonators[MAX_MODAL_PARTIALS];
+    uint8_t resonatorCount;    // 0 without a tail
+    uint32_t tailDelay;        // Output samples until the tail starts
+    uint32_t tailRemaining;    // Output samples the tail lasts from there
+    float tailFade;
+    float tailFadeStep;        // Per envelope period
+  };
+
+  struct Voice {
+    SampleCursor cursors[2];   // The envelope comes from the first
+    uint8_t cursorCount;
+    float amplitude;
+    float panLeft;
+    float panRight;
+    float envLevel;
+    float envStep;        // Level change per envelope period, or decay multiplier
+    float envTarget;      // Sustain level the decay approaches
+    uint32_t envCount;    // Envelope periods left in the current stage
+    volatile EnvelopeState envState;
+  };
+
+  const CachedAttack *findCachedAttack(const AudioSynthWavetable::sample_data *sample) const;
+  void enterStage(Voice &v, EnvelopeState state);
+  void startCursor(SampleCursor &cursor, const RenderInstrument &layer, int midiNote, float gain);
+  void startTail(SampleCursor &cursor, const ModalTail &tail);
+  int readPcm(SampleCursor &c, int32_t *out);
+  int readAdpcm(SampleCursor &c, int32_t *out);
+  int addTail(SampleCursor &c, int32_t *out, int count);
+  void renderVoice(Voice &v, int32_t *left, int32_t *right);
+  void renderBlock();
+
+  Voice voices[MAX_VOICES];  // AudioManager plays NUM_VOICES of them, the benchmark all
+  float masterGain;
+  CachedAttack cachedAttacks[MAX_CACHED_ATTACKS];
+  int cachedAttackCount;
+  uint32_t attackCacheUsed;  // Bytes
+  bool attackCacheEnabled;
+  volatile uint32_t worstUpdateCycles;
+};
+
+#endif // VOICE_RENDERER_H
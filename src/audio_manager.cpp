@@ -1,73 +1,437 @@
 #include "audio_manager.h"
 #include "config.h"
-#include "simpletimp_samples.h"
+#include "samples/instruments.h"
 
-AudioManager::AudioManager() 
-  : patchCord1(nullptr), patchCord2(nullptr), 
-    patchCord3(nullptr), patchCord4(nullptr),
-    drum1Note(67), drum2Note(60) {
+// The soft layer is the same recording low-passed, until soft-hit samples exist
+static const VelocityLayer adpcmLayers[] = {
+  {SOFT_LAYER_MAX_VELOCITY, "soft", {&simpletimp_soft_adpcm, simpletimp_soft_adpcm_samples, nullptr}},
+  {127, "hard", {&simpletimp_adpcm, simpletimp_adpcm_samples, nullptr}},
+};
+
+// Only the first 150 ms of each sample is stored, the rest is synthesized
+static const VelocityLayer modalLayers[] = {
+  {SOFT_LAYER_MAX_VELOCITY, "soft", {&simpletimp_soft_modal, simpletimp_soft_modal_samples, simpletimp_soft_modal_tails}},
+  {127, "hard", {&simpletimp_modal, simpletimp_modal_samples, simpletimp_modal_tails}},
+};
+
+static const VelocityLayer pcmLayers[] = {
+  {127, "pcm", {&simpletimp, nullptr, nullptr}},
+};
+
+static uint32_t layerBytes(const RenderInstrument &instrument) {
+  uint32_t bytes = 0;
+  for (int i = 0; i < instrument.data->sample_count; i++) {
+    if (instrument.compressed != nullptr) {
+      uint32_t length = instrument.compressed[i].length;
+      uint32_t blocks = (length + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES;
+      bytes += (length + 1) / 2 + blocks * (sizeof(int16_t) + sizeof(uint8_t));
+    } else {
+      const AudioSynthWavetable::sample_data &s = instrument.data->samples[i];
+      bytes += ((s.MAX_PHASE >> (32 - s.INDEX_BITS)) + 1) * sizeof(int16_t);
+    }
+    if (instrument.tails != nullptr) {
+      bytes += instrument.tails[i].partialCount * sizeof(ModalPartial);
+    }
+  }
+  return bytes;
+}
+
+// Drops the start of each sample from the data cache, so the next note
+// reads it from flash as a first hit after a quiet spell would
+static void evictAttacks(const RenderInstrument &instrument) {
+  uint32_t samples = ATTACK_CACHE_MS * 44.1f;
+  for (int i = 0; i < instrument.data->sample_count; i++) {
+    if (instrument.compressed != nullptr) {
+      arm_dcache_delete((void *)instrument.compressed[i].codes, samples / 2);
+    } else {
+      arm_dcache_delete((void *)instrument.data->samples[i].sample, samples * sizeof(int16_t));
+    }
+  }
+}
+
+// Weight of the layer above a boundary, ramping across LAYER_CROSSFADE_WIDTH
+static float upperLayerWeight(int velocity, int boundaryVelocity) {
+  float weight = (velocity - (boundaryVelocity + 0.5f)) / LAYER_CROSSFADE_WIDTH + 0.5f;
+  return constrain(weight, 0.0f, 1.0f);
+}
+
+AudioManager::AudioManager() : renderMode(RENDER_WAVETABLE), layers(nullptr), layerCount(0), voicesStolen(0) {
+  for (int i = 0; i < NUM_VOICES + NUM_SUBMIXERS + 2; i++) {
+    patchCords[i] = nullptr;
+  }
+  for (int v = 0; v < NUM_VOICES; v++) {
+    voiceStates[v] = {-1, 0, 0};
+  }
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    drumNotes[i] = defaultDrumNote(i);
+    lastVoice[i] = -1;
+  }
 }
 
-void AudioManager::begin() {
-  // Initialize audio
-  AudioMemory(10);
+void AudioManager::begin(RenderMode mode) {
+  // Only the fused renderer can decode ADPCM
+  renderMode = USE_COMPRESSED_SAMPLES ? RENDER_FUSED : mode;
+  
+  // Initialize audio: one block per voice on top of the mixers and output,
+  // for as many voices as the benchmark's wavetable graph plays. The fused
+  // renderer only ever holds its stereo pair.
+  AudioMemory(8 + (BENCHMARK_WAVETABLE ? MAX_VOICES : NUM_VOICES));
   sgtl5000_1.enable();
   sgtl5000_1.volume(0.5);
   
-  // Create audio connections
-  patchCord1 = new AudioConnection(wavetable1, 0, mixer1, 0);
-  patchCord2 = new AudioConnection(wavetable2, 0, mixer1, 1);
-  patchCord3 = new AudioConnection(mixer1, 0, i2s1, 0); // Left
-  patchCord4 = new AudioConnection(mixer1, 0, i2s1, 1); // Right
+  // Testing the constant too lets the compiler drop the wavetable graph and,
+  // unless BENCHMARK_WAVETABLE keeps it for the benchmark, the PCM sample data
+  if (USE_COMPRESSED_SAMPLES || renderMode == RENDER_FUSED) {
+    patchCords[0] = new AudioConnection(renderer, 0, i2s1, 0); // Left
+    patchCords[1] = new AudioConnection(renderer, 1, i2s1, 1); // Right
+    if (USE_COMPRESSED_SAMPLES && USE_MODAL_TAILS) {
+      layers = modalLayers;
+      layerCount = sizeof(modalLayers) / sizeof(modalLayers[0]);
+    } else if (USE_COMPRESSED_SAMPLES) {
+      layers = adpcmLayers;
+      layerCount = sizeof(adpcmLayers) / sizeof(adpcmLayers[0]);
+    } else {
+      layers = pcmLayers;
+      layerCount = 1;
+    }
+    renderer.setMasterGain(0.5);
+    printLayerReport();
+    
+    uint32_t cached = 0;
+    for (int i = 0; i < layerCount; i++) {
+      cached += renderer.cacheAttacks(layers[i].instrument, ATTACK_CACHE_MS);
+    }
+    Serial.print("Attack cache: ");
+    Serial.print(cached);
+    Serial.println(" bytes in DTCM");
+    return;
+  }
   
-  // Setup mixer gains
-  mixer1.gain(0, 0.5); // Drum 1
-  mixer1.gain(1, 0.5); // Drum 2
-  mixer1.gain(2, 0);
-  mixer1.gain(3, 0);
+  // Create audio connections: voices -> submixers -> master -> both I2S channels
+  int cord = 0;
+  for (int v = 0; v < NUM_VOICES; v++) {
+    patchCords[cord++] = new AudioConnection(voices[v], 0, subMixers[v / 4], v % 4);
+  }
+  for (int m = 0; m < NUM_SUBMIXERS; m++) {
+    patchCords[cord++] = new AudioConnection(subMixers[m], 0, mixer1, m);
+  }
+  patchCords[cord++] = new AudioConnection(mixer1, 0, i2s1, 0); // Left
+  patchCords[cord++] = new AudioConnection(mixer1, 0, i2s1, 1); // Right
   
-  // Load timpani instrument into both wavetables
-  wavetable1.setInstrument(simpletimp);
-  wavetable2.setInstrument(simpletimp);
+  // Setup mixer gains: unity per voice, drum level set on the master
+  for (int i = 0; i < NUM_SUBMIXERS * 4; i++) {
+    subMixers[i / 4].gain(i % 4, (i < NUM_VOICES) ? 1.0 : 0);
+  }
+  for (int m = 0; m < 4; m++) {
+    mixer1.gain(m, (m < NUM_SUBMIXERS) ? 0.5 : 0);
+  }
   
-  // Set initial amplitude
-  wavetable1.amplitude(1.0);
-  wavetable2.amplitude(1.0);
+  // Load timpani instrument into every voice
+  for (int v = 0; v < NUM_VOICES; v++) {
+    voices[v].setInstrument(simpletimp);
+    voices[v].amplitude(1.0);
+  }
 }
 
-void AudioManager::playDrum(int drumNum, int peakValue) {
+int AudioManager::peakToVelocity(int peakValue) const {
   // Map peak value to MIDI velocity (0-127)
   int velocity = map(peakValue, TRIGGER_VALUE, 4095, 40, 127);
-  velocity = constrain(velocity, 40, 127);
+  return constrain(velocity, 40, 127);
+}
+
+void AudioManager::playDrum(int drumNum, int peakValue) {
+  playDrumNote(drumNum, drumNotes[drumNum - 1], peakValue);
+}
+
+void AudioManager::correctDrum(int drumNum, int firedPeak, int measuredPeak) {
+  // The note is already sounding at the predicted velocity. amplitude() tops
+  // out at 1.0, so over-predictions are pulled back fully and
+  // under-predictions are left as they are.
+  float gain = (float)peakToVelocity(measuredPeak) / peakToVelocity(firedPeak);
+  gain = constrain(gain, 0.0, 1.0);
   
-  if (drumNum == 1) {
-    wavetable1.playNote(drum1Note, velocity);
+  int voice = lastVoice[drumNum - 1];
+  if (voice < 0) {
+    return;
+  }
+  if (renderMode == RENDER_FUSED) {
+    renderer.amplitude(voice, gain);
   } else {
-    wavetable2.playNote(drum2Note, velocity);
+    voices[voice].amplitude(gain);
   }
 }
 
 void AudioManager::setVolume(float volume) {
   volume = constrain(volume, 0.0, 1.0);
   
-  if (volume < 0.01) {
-    // Mute by setting mixer gains to 0
-    mixer1.gain(0, 0);
-    mixer1.gain(1, 0);
-  } else {
-    // Apply volume via mixer gains
-    mixer1.gain(0, volume * 0.7);
-    mixer1.gain(1, volume * 0.7);
+  // Mute below 1%, otherwise apply volume via the master mixer gains
+  float gain = (volume < 0.01) ? 0 : volume * 0.7;
+  if (renderMode == RENDER_FUSED) {
+    renderer.setMasterGain(gain);
+    return;
+  }
+  for (int m = 0; m < NUM_SUBMIXERS; m++) {
+    mixer1.gain(m, gain);
   }
 }
 
 void AudioManager::playDrumNote(int drumNum, int midiNote, int peakValue) {
-  int velocity = map(peakValue, TRIGGER_VALUE, 4095, 40, 127);
-  velocity = constrain(velocity, 40, 127);
+  int velocity = peakToVelocity(peakValue);
+  
+  int drumIndex = drumNum - 1;
+  int voice = allocateVoice(drumIndex);
+  
+  voiceStates[voice] = {(int8_t)drumIndex, (uint8_t)velocity, millis()};
+  lastVoice[drumIndex] = voice;
+  startVoice(voice, midiNote, velocity, drumIndex);
+}
+
+bool AudioManager::isVoicePlaying(int voice) {
+  if (renderMode == RENDER_FUSED) {
+    return renderer.isPlaying(voice);
+  }
+  return voices[voice].isPlaying();
+}
+
+void AudioManager::startVoice(int voice, int midiNote, int velocity, int drumIndex) {
+  if (renderMode == RENDER_FUSED) {
+    int layer = 0;
+    while (layer < layerCount - 1 && velocity > layers[layer].maxVelocity) {
+      layer++;
+    }
+    
+    // Near a layer boundary the neighbouring layer is blended in
+    const RenderInstrument *blendLayer = nullptr;
+    float blend = 0;
+    if (LAYER_CROSSFADE_WIDTH > 0) {
+      if (layer + 1 < layerCount) {
+        blend = upperLayerWeight(velocity, layers[layer].maxVelocity);
+        blendLayer = &layers[layer + 1].instrument;
+      }
+      if (blend == 0 && layer > 0) {
+        blend = 1.0f - upperLayerWeight(velocity, layers[layer - 1].maxVelocity);
+        blendLayer = &layers[layer - 1].instrument;
+      }
+    }
+    
+    renderer.playNote(voice, midiNote, velocity, DRUM_PAN[drumIndex], layers[layer].instrument,
+                      (blend > 0) ? blendLayer : nullptr, blend);
+    return;
+  }
   
-  if (drumNum == 1) {
-    wavetable1.playNote(midiNote, velocity);
+  // Undo any correction left over from the voice's previous note
+  voices[voice].amplitude(1.0);
+  voices[voice].playNote(midiNote, velocity);
+}
+
+void AudioManager::stopVoice(int voice) {
+  if (renderMode == RENDER_FUSED) {
+    renderer.stop(voice);
   } else {
-    wavetable2.playNote(midiNote, velocity);
+    voices[voice].stop();
   }
-}
\ No newline at end of file
+}
+
+int AudioManager::allocateVoice(int drumIndex) {
+  unsigned long currentTime = millis();
+  
+  // A drum at its polyphony cap reuses one of its own voices, so a long
+  // roll on one drum cannot cut off the other drums' decays
+  int owned = 0;
+  for (int v = 0; v < NUM_VOICES; v++) {
+    if (voiceStates[v].drum == drumIndex && isVoicePlaying(v)) {
+      owned++;
+    }
+  }
+  int voice;
+  if (owned >= VOICES_PER_DRUM) {
+    voice = quietestVoice(drumIndex, currentTime);
+  } else {
+    for (int v = 0; v < NUM_VOICES; v++) {
+      if (!isVoicePlaying(v)) {
+        return v;
+      }
+    }
+    voice = quietestVoice(-1, currentTime);
+  }
+  
+  // The quietest voice may have finished since it was counted, which is no
+  // steal at all
+  if (isVoicePlaying(voice)) {
+    voicesStolen++;
+  }
+  return voice;
+}
+
+int AudioManager::quietestVoice(int drumIndex, unsigned long currentTime) const {
+  // Estimate each voice's level from its velocity and an exponential decay
+  // since the note started. Among equal velocities this picks the oldest.
+  int quietest = 0;
+  float quietestLevel = 1e9;
+  
+  for (int v = 0; v < NUM_VOICES; v++) {
+    if (drumIndex >= 0 && voiceStates[v].drum != drumIndex) {
+      continue;
+    }
+    
+    float age = currentTime - voiceStates[v].startTime;
+    float level = voiceStates[v].velocity * expf(-age / VOICE_DECAY_MS);
+    if (level < quietestLevel) {
+      quietestLevel = level;
+      quietest = v;
+    }
+  }
+  return quietest;
+}
+
+void AudioManager::printLayerReport() const {
+  uint32_t total = 0;
+  for (int i = 0; i < layerCount; i++) {
+    uint32_t bytes = layerBytes(layers[i].instrument);
+    total += bytes;
+    Serial.print("Layer ");
+    Serial.print(layers[i].name);
+    Serial.print(" (velocity <= ");
+    Serial.print(layers[i].maxVelocity);
+    Serial.print("): ");
+    Serial.print(bytes);
+    Serial.println(" bytes");
+  }
+  Serial.print("Sample data: ");
+  Serial.print(total);
+  Serial.println(" bytes");
+}
+
+// Connects whichever path begin() left idle: the wavetable graph up to
+// MAX_VOICES, and the fused renderer. An idle path costs next to nothing,
+// as silent voices transmit no blocks. Returns the cords used.
+int AudioManager::connectBenchmarkGraph() {
+  int cord = 0;
+  int firstVoice = 0;
+  int firstSubmixer = 0;
+  if (renderMode == RENDER_FUSED) {
+    benchmarkCords[cord++].connect(mixer1, 0, benchmarkSink, 0);
+  } else {
+    benchmarkCords[cord++].connect(renderer, 0, benchmarkSink, 0);
+    firstVoice = NUM_VOICES;
+    firstSubmixer = NUM_SUBMIXERS;
+  }
+  if (!BENCHMARK_WAVETABLE) {
+    return cord;
+  }
+  
+  for (int v = firstVoice; v < MAX_VOICES; v++) {
+    voices[v].setInstrument(simpletimp);
+    subMixers[v / 4].gain(v % 4, 1.0);
+    benchmarkCords[cord++].connect(voices[v], 0, subMixers[v / 4], v % 4);
+  }
+  for (int m = firstSubmixer; m < MAX_SUBMIXERS; m++) {
+    mixer1.gain(m, 0.5);
+    benchmarkCords[cord++].connect(subMixers[m], 0, mixer1, m);
+  }
+  return cord;
+}
+
+void AudioManager::stopBenchmarkVoices() {
+  for (int v = 0; v < MAX_VOICES; v++) {
+    renderer.stop(v);
+    voices[v].stop();
+    voices[v].amplitude(1.0);
+  }
+}
+
+// Audio CPU max (%) with count notes held at full velocity, on the fused
+// renderer playing instrument, or on the wavetable graph without one
+float AudioManager::benchmarkVoices(int count, const RenderInstrument *instrument) {
+  // Let earlier notes finish releasing
+  stopBenchmarkVoices();
+  delay(150);
+  AudioProcessorUsageMaxReset();
+  for (int v = 0; v < count; v++) {
+    int drum = v % NUM_DRUMS;
+    if (instrument != nullptr) {
+      renderer.playNote(v, drumNotes[drum], 127, DRUM_PAN[drum], *instrument);
+    } else {
+      voices[v].playNote(drumNotes[drum], 127);
+    }
+  }
+  delay(200);
+  return AudioProcessorUsageMax();
+}
+
+void AudioManager::benchmark() {
+  static const int voiceCounts[] = {2, 8, MAX_VOICES};
+  // The hard layer, unless the fused PCM column already covers it
+  const VelocityLayer *active = nullptr;
+  if (renderMode == RENDER_FUSED && (USE_COMPRESSED_SAMPLES || !BENCHMARK_WAVETABLE)) {
+    active = &layers[layerCount - 1];
+  }
+  
+  int cords = connectBenchmarkGraph();
+  Serial.println("Audio CPU max (%), notes held 200 ms:");
+  Serial.print("  voices");
+  if (BENCHMARK_WAVETABLE) {
+    Serial.print("  wavetable PCM  fused PCM");
+  }
+  if (active != nullptr) {
+    Serial.print("  fused ");
+    Serial.print(active->name);
+  }
+  Serial.println();
+  
+  for (int count : voiceCounts) {
+    Serial.print("  ");
+    Serial.print(count);
+    if (BENCHMARK_WAVETABLE) {
+      Serial.print("  ");
+      Serial.print(benchmarkVoices(count, nullptr));
+      Serial.print("  ");
+      Serial.print(benchmarkVoices(count, &pcmLayers[0].instrument));
+    }
+    if (active != nullptr) {
+      Serial.print("  ");
+      Serial.print(benchmarkVoices(count, &active->instrument));
+    }
+    Serial.println();
+  }
+  
+  stopBenchmarkVoices();
+  delay(150);
+  for (int i = 0; i < cords; i++) {
+    benchmarkCords[i].disconnect();
+  }
+  
+  if (renderMode != RENDER_FUSED) {
+    return;
+  }
+  
+  // Worst audio update over repeated cold hits on every drum at once
+  static const int TRIALS = 10;
+  Serial.println("Worst audio update after a cold hit (cycles):");
+  for (int cache = 1; cache >= 0; cache--) {
+    renderer.useAttackCache(cache);
+    uint32_t worst = 0;
+    for (int trial = 0; trial < TRIALS; trial++) {
+      for (int v = 0; v < NUM_VOICES; v++) {
+        stopVoice(v);
+      }
+      delay(150);
+      for (int i = 0; i < layerCount; i++) {
+        evictAttacks(layers[i].instrument);
+      }
+      renderer.resetWorstUpdateCycles();
+      for (int d = 0; d < NUM_DRUMS; d++) {
+        startVoice(d, drumNotes[d], 127, d);
+      }
+      delay(20);
+      worst = max(worst, renderer.getWorstUpdateCycles());
+    }
+    Serial.print(cache ? "  attack cache on: " : "  attack cache off: ");
+    Serial.println(worst);
+  }
+  renderer.useAttackCache(true);
+  
+  for (int v = 0; v < NUM_VOICES; v++) {
+    stopVoice(v);
+  }
+}
@@ -0,0 +1,91 @@
+#include "bus_scheduler.h"
+
+static const char *const operationNames[NUM_BUS_OPERATIONS] = {"display", "eeprom"};
+
+BusScheduler::BusScheduler()
+  : triggers(nullptr), numTriggers(0), scanning(false), scanSeen(false), sampleClock(0), lastScanEnd(0) {
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    lastHitTimes[i] = 0;
+  }
+  for (int i = 0; i < NUM_BUS_OPERATIONS; i++) {
+    waitStart[i] = 0;
+    waiting[i] = false;
+    forcing[i] = false;
+    deferred[i] = 0;
+    forced[i] = 0;
+  }
+}
+
+void BusScheduler::begin(DrumTrigger* const* drumTriggers, int count) {
+  triggers = drumTriggers;
+  numTriggers = min(count, NUM_DRUMS);
+  for (int i = 0; i < numTriggers; i++) {
+    lastHitTimes[i] = triggers[i]->getHitTime();
+  }
+}
+
+void BusScheduler::update(unsigned long sampleClockUs) {
+  sampleClock = sampleClockUs;
+  scanning = false;
+  
+  // The DMA sampler can hand a trigger a whole scan in one update, so a scan
+  // is also recognised by a new hit time. The guard runs from the scan's
+  // end in the triggers' own timebase, which covers the ringing after it.
+  for (int i = 0; i < numTriggers; i++) {
+    DrumTrigger *trigger = triggers[i];
+    scanning = scanning || trigger->isScanning();
+    if (trigger->isScanning() || trigger->getHitTime() != lastHitTimes[i]) {
+      lastHitTimes[i] = trigger->getHitTime();
+      unsigned long scanEnd = trigger->getHitTime() + trigger->getScanTime();
+      if (!scanSeen || (long)(scanEnd - lastScanEnd) > 0) {
+        lastScanEnd = scanEnd;
+      }
+      scanSeen = true;
+    }
+  }
+}
+
+bool BusScheduler::mayStart(BusOperation operation, unsigned long currentTime) {
+  if (forcing[operation]) {
+    return true;
+  }
+  long sinceScan = (long)(sampleClock - lastScanEnd);  // Negative while a fired scan is still running
+  bool quiet = !scanning && (!scanSeen || sinceScan >= (long)(BUS_GUARD_MS * 1000));
+  
+  if (!waiting[operation]) {
+    if (quiet) {
+      return true;
+    }
+    waiting[operation] = true;
+    waitStart[operation] = currentTime;
+    deferred[operation]++;
+    return false;
+  }
+  
+  // The wait lasts until finished(), so the limit covers the whole operation
+  if (quiet) {
+    return true;
+  }
+  if (currentTime - waitStart[operation] >= BUS_MAX_DEFER_MS) {
+    forcing[operation] = true;
+    forced[operation]++;
+    return true;
+  }
+  return false;
+}
+
+void BusScheduler::finished(BusOperation operation) {
+  waiting[operation] = false;
+  forcing[operation] = false;
+}
+
+void BusScheduler::printReport() {
+  Serial.println("Bus operations held for quiet windows: deferred forced");
+  for (int i = 0; i < NUM_BUS_OPERATIONS; i++) {
+    Serial.print(operationNames[i]);
+    Serial.print(": ");
+    Serial.print(deferred[i]);
+    Serial.print(" ");
+    Serial.println(forced[i]);
+  }
+}
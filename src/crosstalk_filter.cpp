@@ -0,0 +1,80 @@
+#include "crosstalk_filter.h"
+#include "deferred_log.h"
+
+CrosstalkFilter::CrosstalkFilter()
+  : triggers(nullptr), numTriggers(0) {
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    for (int j = 0; j < NUM_DRUMS; j++) {
+      coefficients[i][j] = CROSSTALK_MATRIX[i][j];
+    }
+    hasHit[i] = false;
+    hitTime[i] = 0;
+    hitPeak[i] = 0;
+    suppressed[i] = 0;
+  }
+}
+
+void CrosstalkFilter::begin(DrumTrigger* const* drumTriggers, int count) {
+  triggers = drumTriggers;
+  numTriggers = min(count, NUM_DRUMS);
+}
+
+void CrosstalkFilter::setCoefficient(int fromDrum, int toDrum, float coefficient) {
+  if (fromDrum >= 0 && fromDrum < NUM_DRUMS && toDrum >= 0 && toDrum < NUM_DRUMS) {
+    coefficients[fromDrum][toDrum] = constrain(coefficient, 0.0f, 1.0f);
+  }
+}
+
+void CrosstalkFilter::update() {
+  // Record every new hit first, so hits that land in the same sample block
+  // are judged against each other
+  for (int i = 0; i < numTriggers; i++) {
+    if (triggers[i]->wasTriggered()) {
+      hasHit[i] = true;
+      hitTime[i] = triggers[i]->getHitTime();
+      hitPeak[i] = triggers[i]->getPeakValue();
+    }
+  }
+
+  for (int i = 0; i < numTriggers; i++) {
+    if (triggers[i]->wasTriggered() && isCrosstalk(i)) {
+      triggers[i]->cancelHit();
+      suppressed[i]++;
+      debugLog.write(LOG_CROSSTALK, triggers[i]->getDrumNumber());
+    }
+  }
+}
+
+bool CrosstalkFilter::isCrosstalk(int drumIndex) const {
+  unsigned long time = hitTime[drumIndex];
+  int peak = hitPeak[drumIndex];
+
+  for (int j = 0; j < numTriggers; j++) {
+    float coefficient = coefficients[j][drumIndex];
+    if (j == drumIndex || coefficient <= 0) {
+      continue;
+    }
+
+    // A stronger hit on the other drum, either already fired or still in
+    // its scan window. Hit times share one timebase across drums, so the
+    // difference can go either way.
+    unsigned long otherTime;
+    int otherPeak;
+    if (triggers[j]->isScanning()) {
+      otherTime = triggers[j]->getHitTime();
+      otherPeak = triggers[j]->getMeasuredPeak();
+    } else if (hasHit[j]) {
+      otherTime = hitTime[j];
+      otherPeak = hitPeak[j];
+    } else {
+      continue;
+    }
+
+    unsigned long apart = (time - otherTime < otherTime - time) ? time - otherTime
+                                                                : otherTime - time;
+    if (apart <= CROSSTALK_WINDOW_US && peak < coefficient * otherPeak) {
+      return true;
+    }
+  }
+  return false;
+}
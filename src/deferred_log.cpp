@@ -0,0 +1,89 @@
+#include "deferred_log.h"
+
+DeferredLog debugLog;
+
+DeferredLog::DeferredLog()
+  : head(0), tail(0), dropped(0), droppedReported(0) {
+}
+
+void DeferredLog::write(LogType type, uint8_t id, int16_t a, int16_t b) {
+  uint32_t h = head;
+  if (h - tail >= (uint32_t)LOG_RING_SIZE) {
+    dropped++;
+    return;
+  }
+  
+  LogRecord &record = records[h & (LOG_RING_SIZE - 1)];
+  record.type = type;
+  record.id = id;
+  record.a = a;
+  record.b = b;
+  
+  // Publish the record only after its contents are written
+  asm volatile("dmb" ::: "memory");
+  head = h + 1;
+}
+
+void DeferredLog::drain() {
+  for (int i = 0; i < LOG_DRAIN_PER_CALL; i++) {
+    // Never let a slow host stall the loop
+    if (Serial.availableForWrite() < LOG_MAX_LINE) {
+      return;
+    }
+    
+    if (dropped != droppedReported) {
+      Serial.print("LOG: ");
+      Serial.print(dropped - droppedReported);
+      Serial.println(" records dropped");
+      droppedReported = dropped;
+      continue;
+    }
+    
+    uint32_t t = tail;
+    if (t == head) {
+      return;
+    }
+    
+    asm volatile("dmb" ::: "memory");
+    print(records[t & (LOG_RING_SIZE - 1)]);
+    tail = t + 1;
+  }
+}
+
+void DeferredLog::print(const LogRecord &record) {
+  switch (record.type) {
+    case LOG_DRUM_HIT:
+      Serial.print("DRUM ");
+      Serial.print(record.id);
+      Serial.print(" HIT! Peak: ");
+      Serial.print(record.a);
+      if (record.b >= 0) {
+        Serial.print(" Predicted: ");
+        Serial.print(record.b);
+      }
+      Serial.println();
+      break;
+      
+    case LOG_CROSSTALK:
+      Serial.print("DRUM ");
+      Serial.print(record.id);
+      Serial.println(" crosstalk suppressed");
+      break;
+      
+    case LOG_BUTTON:
+      Serial.print("BUTTON ");
+      Serial.print(record.id);
+      Serial.println(" PRESSED");
+      break;
+      
+    case LOG_POT:
+      Serial.print(" | Pot3: ");
+      Serial.println(record.a);
+      break;
+      
+    case LOG_VOLUME:
+      Serial.print("Volume: ");
+      Serial.println(record.a / 100.0);
+      break;
+  }
+}
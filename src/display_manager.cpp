@@ -3,22 +3,130 @@
 #include "config.h"
 
 DisplayManager::DisplayManager() 
-  : display(U8G2_R0, /* reset=*/ U8X8_PIN_NONE, /* clock=*/ 16, /* data=*/ 17) {
+  : display(U8G2_R0, /* reset=*/ U8X8_PIN_NONE, /* clock=*/ 16, /* data=*/ 17),
+    flushMode(FLUSH_FRAME), scheduler(nullptr), framePending(false), flushPage(-1), stalePages(0), failuresSeen(0) {
+  // display.begin() clears the panel
+  memset(sentFrame, 0, sizeof(sentFrame));
 }
 
-void DisplayManager::begin() {
+void DisplayManager::begin(DisplayFlushMode mode, BusScheduler *busScheduler) {
+  flushMode = mode;
+  scheduler = busScheduler;
+  
   // Initialize I2C bus 1
   Wire1.begin();
   
-  // Initialize display
+  // Initialize display, then send frames by DMA from here on
   display.begin();
+  if (flushMode != FLUSH_PAGE_BLOCKING) {
+    oled.begin(0x3C);  // U8g2's SSD1306 address
+  }
+}
+
+// Frames are sent in the background by update(), which loop() only calls
+// in a quiet window. One drawn while the previous is still on the bus goes
+// out once it finishes, and each loop() pass sends one page at most in the
+// page modes.
+void DisplayManager::flush() {
+  framePending = true;
+}
+
+// Finds the run of 8x8 tiles in a page that differ from what was last sent,
+// so an unchanged screen costs no bus traffic. Unchanged tiles between two
+// changed ones go too; that is cheaper than a second write and its header.
+bool DisplayManager::dirtyColumns(int page, int &first, int &count) {
+  if (stalePages & (1 << page)) {
+    first = 0;
+    count = OLED_WIDTH;
+    return true;
+  }
+  
+  const uint8_t *drawn = &display.getBufferPtr()[page * OLED_WIDTH];
+  const uint8_t *sent = &sentFrame[page * OLED_WIDTH];
+  int firstTile = -1;
+  int lastTile = -1;
+  for (int tile = 0; tile < OLED_WIDTH / 8; tile++) {
+    if (memcmp(&drawn[tile * 8], &sent[tile * 8], 8) != 0) {
+      if (firstTile < 0) {
+        firstTile = tile;
+      }
+      lastTile = tile;
+    }
+  }
+  
+  if (firstTile < 0) {
+    return false;
+  }
+  first = firstTile * 8;
+  count = (lastTile - firstTile + 1) * 8;
+  return true;
+}
+
+void DisplayManager::markSent(int page, int first, int count) {
+  int offset = page * OLED_WIDTH + first;
+  memcpy(&sentFrame[offset], &display.getBufferPtr()[offset], count);
+  stalePages &= ~(1 << page);
+}
+
+void DisplayManager::update() {
+  if (oled.isBusy()) {
+    return;
+  }
+  
+  // A failed transfer leaves the panel unknown, so resend everything
+  if (oled.getFailures() != failuresSeen) {
+    failuresSeen = oled.getFailures();
+    stalePages = 0xFF;
+    framePending = true;
+  }
+  
+  if (flushPage < 0 && framePending) {
+    flushPage = 0;
+    framePending = false;
+  }
+  
+  // Pages are read from the live buffer as they go out. A frame drawn
+  // part way through supplies the remaining pages and is then checked again
+  // whole. Unchanged pages are skipped without waiting for another pass.
+  int first;
+  int count;
+  while (flushPage >= 0 && flushPage < OLED_PAGES && !dirtyColumns(flushPage, first, count)) {
+    flushPage++;
+  }
+  
+  // The last transfer of the frame has completed
+  if (flushPage < 0 || flushPage == OLED_PAGES) {
+    flushPage = -1;
+    scheduler->finished(BUS_DISPLAY);
+    return;
+  }
+  
+  // Every transfer, resends included, waits for a quiet bus
+  if (!scheduler->mayStart(BUS_DISPLAY, millis())) {
+    return;
+  }
+  
+  if (flushMode == FLUSH_FRAME) {
+    oled.send(display.getBufferPtr());
+    memcpy(sentFrame, display.getBufferPtr(), sizeof(sentFrame));
+    stalePages = 0;
+    flushPage = OLED_PAGES;
+  } else {
+    if (flushMode == FLUSH_PAGE_BLOCKING) {
+      display.updateDisplayArea(first / 8, flushPage, count / 8, 1);
+    } else {
+      oled.sendPage(display.getBufferPtr(), flushPage, first, count);
+    }
+    markSent(flushPage, first, count);
+    flushPage++;
+  }
 }
 
 void DisplayManager::showSplash() {
   display.clearBuffer();
   display.setFont(u8g2_font_ncenB14_tr);
   display.drawStr(20, 35, "OrchLab");
-  display.sendBuffer();
+  flush();
 }
 
 void DisplayManager::showDrumHit(int drumNum, int peakValue) {
@@ -34,7 +142,7 @@ void DisplayManager::showDrumHit(int drumNum, int peakValue) {
   display.setCursor(0, 50);
   display.print("Peak: ");
   display.print(peakValue);
-  display.sendBuffer();
+  flush();
 }
 
 void DisplayManager::showButton(int buttonPin) {
@@ -44,7 +152,7 @@ void DisplayManager::showButton(int buttonPin) {
   display.setCursor(0, 50);
   display.print("Pin: ");
   display.print(buttonPin);
-  display.sendBuffer();
+  flush();
 }
 
 void DisplayManager::setDisplayMode(DisplayMode mode) {
@@ -52,25 +160,33 @@ void DisplayManager::setDisplayMode(DisplayMode mode) {
     lastUpdateTime = millis();
 }
 
-void DisplayManager::showIdleScreen(bool drum1Hit, bool drum2Hit) {
+int DisplayManager::hitDotX(int drumIndex, int count) const {
+    // Spread the dots evenly between x = 10 and x = 118
+    if (count < 2) {
+        return 64;
+    }
+    return 10 + drumIndex * 108 / (count - 1);
+}
+
+void DisplayManager::drawHitDots(const bool *drumHits, int count) {
+    // Hit dots at bottom - filled when active, empty when not
+    for (int i = 0; i < count; i++) {
+        if (drumHits[i]) {
+            display.drawDisc(hitDotX(i, count), 55, 3);  // Filled circle
+        } else {
+            display.drawCircle(hitDotX(i, count), 55, 3);  // Empty circle
+        }
+    }
+}
+
+void DisplayManager::showIdleScreen(const bool *drumHits, int count) {
     display.clearBuffer();
     display.setFont(u8g2_font_ncenB14_tr);
     display.drawStr(20, 35, "OrchLab");
     
-    // Draw hit dots at bottom - filled when active, empty when not
-    if (drum1Hit) {
-        display.drawDisc(10, 55, 3);  // Filled circle
-    } else {
-        display.drawCircle(10, 55, 3);  // Empty circle
-    }
+    drawHitDots(drumHits, count);
     
-    if (drum2Hit) {
-        display.drawDisc(118, 55, 3);  // Filled circle
-    } else {
-        display.drawCircle(118, 55, 3);  // Empty circle
-    }
-    
-    display.sendBuffer();
+    flush();
 }
 
 void DisplayManager::showVolumeOverlay(int volume) {
@@ -79,45 +195,37 @@ void DisplayManager::showVolumeOverlay(int volume) {
     display.drawStr(10, 25, "Volume:");
     display.setCursor(10, 45);
     display.print(volume);
-    display.sendBuffer();
+    flush();
 }
 
-void DisplayManager::showMenu(int selectedDrum, uint8_t drum1Note, uint8_t drum2Note, bool drum1Hit, bool drum2Hit) {
+void DisplayManager::showMenu(int selectedDrum, const uint8_t *drumNotes, const bool *drumHits, int count) {
     display.clearBuffer();
     display.setFont(u8g2_font_ncenB10_tr);
     
-    // Drum 1 line
-    String drum1Text = "Drum 1: " + midiToNoteName(drum1Note);
-    if (selectedDrum == 0) {
-        display.drawStr(0, 20, ">");
-    }
-    display.drawStr(15, 20, drum1Text.c_str());
+    // Two drum lines fit above the dots; scroll so the selected one is shown
+    int firstDrum = constrain(selectedDrum - 1, 0, max(count - 2, 0));
     
-    // Drum 2 line
-    String drum2Text = "Drum 2: " + midiToNoteName(drum2Note);
-    if (selectedDrum == 1) {
-        display.drawStr(0, 40, ">");
+    for (int line = 0; line < 2 && firstDrum + line < count; line++) {
+        int drum = firstDrum + line;
+        int y = 20 + line * 20;
+        
+        char noteName[NOTE_NAME_SIZE];
+        char drumText[24];  // Fixed buffers, so redrawing at 20Hz never allocates
+        snprintf(drumText, sizeof(drumText), "Drum %d: %s", drum + 1,
+                 midiToNoteName(drumNotes[drum], noteName));
+        if (selectedDrum == drum) {
+            display.drawStr(0, y, ">");
+        }
+        display.drawStr(15, y, drumText);
     }
-    display.drawStr(15, 40, drum2Text.c_str());
     
-    // Hit dots at bottom - filled when active, empty when not
-    if (drum1Hit) {
-        display.drawDisc(10, 55, 3);
-    } else {
-        display.drawCircle(10, 55, 3);
-    }
-    
-    if (drum2Hit) {
-        display.drawDisc(118, 55, 3);
-    } else {
-        display.drawCircle(118, 55, 3);
-    }
+    drawHitDots(drumHits, count);
     
-    display.sendBuffer();
+    flush();
 }
 
-void DisplayManager::showHitDot(int drumIndex, bool state) {
-    int x = (drumIndex == 0) ? 10 : 118;
+void DisplayManager::showHitDot(int drumIndex, int count, bool state) {
+    int x = hitDotX(drumIndex, count);
     int y = 55;
     
     if (state) {
@@ -125,5 +233,5 @@ void DisplayManager::showHitDot(int drumIndex, bool state) {
     } else {
         display.drawCircle(x, y, 3); // Empty circle
     }
-    display.sendBuffer();
-}
\ No newline at end of file
+    flush();
+}
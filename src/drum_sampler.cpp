@@ -0,0 +1,427 @@
+#include "drum_sampler.h"
+#include <DMAChannel.h>
+
+// PIT channel 3 paces the conversions. IntervalTimer allocates from channel 0
+// and skips any channel that is already running, so the two can coexist.
+#define SAMPLER_PIT_CHANNEL 3
+
+// Each PIT tick runs one ADC_ETC chain that converts both drum pins back to
+// back on ADC1. The packed result pair (drum 1 in the low half, drum 2 in the
+// high half) is copied into this ring by DMA. The ring lives in DTCM, so no
+// cache maintenance is needed before reading it.
+static volatile uint32_t sampleRing[SAMPLE_RING_SIZE]
+    __attribute__((aligned(SAMPLE_RING_SIZE * sizeof(uint32_t))));
+static DMAChannel sampleDma;
+static volatile uint32_t ringWraps = 0;
+
+static void sampleDmaIsr() {
+  sampleDma.clearInterrupt();
+  ringWraps++;
+  asm("dsb");
+}
+
+// In mux mode an IntervalTimer steps through the 74HC4067 channels, so each
+// channel is sampled every MUX_SAMPLE_PERIOD_US however many there are. Each
+// tick stores the conversion started on the previous tick, selects the next
+// channel, lets the mux output settle and starts its conversion.
+static IntervalTimer muxTimer;
+static volatile uint16_t muxRing[MUX_CHANNELS][MUX_RING_SIZE];
+static volatile uint32_t muxSweeps = 0;  // Completed passes over all channels
+static volatile int muxChannel = 0;
+static volatile uint32_t muxMisses = 0;  // Ticks whose conversion had not finished
+
+static void selectMuxChannel(int channel) {
+  for (int bit = 0; bit < 4; bit++) {
+    digitalWriteFast(MUX_SELECT_PINS[bit], (channel >> bit) & 1);
+  }
+}
+
+static void muxTick() {
+  // A conversion still running would otherwise be read as a stale result,
+  // so the channel repeats its last sample and the miss is counted
+  uint32_t slot = muxSweeps & (MUX_RING_SIZE - 1);
+  if (ADC1_HS & ADC_HS_COCO0) {
+    muxRing[muxChannel][slot] = ADC1_R0;
+  } else {
+    muxRing[muxChannel][slot] = muxRing[muxChannel][(slot - 1) & (MUX_RING_SIZE - 1)];
+    muxMisses++;
+  }
+
+  if (++muxChannel >= MUX_CHANNELS) {
+    muxChannel = 0;
+    muxSweeps++;
+  }
+
+  selectMuxChannel(muxChannel);
+  delayNanoseconds(MUX_SETTLE_NS);
+  ADC1_HC0 = ADC_HC_ADCH(MUX_ADC_CHANNEL);
+}
+
+// In compare mode each ADC converts one drum pin continuously with the
+// hardware compare enabled, so a result only completes (and interrupts) once
+// it reaches that drum's threshold. Nothing runs on the CPU until then.
+static volatile bool compareArmed = false;
+static volatile int wakeSamples[2] = {-1, -1};  // Conversions that crossed, -1 if none
+
+static void disarmCompare() {
+  ADC1_GC &= ~(ADC_GC_ACFE | ADC_GC_ACFGT | ADC_GC_ADCO);
+  ADC2_GC &= ~(ADC_GC_ACFE | ADC_GC_ACFGT | ADC_GC_ADCO);
+  ADC1_HC0 = ADC_HC_ADCH(31);  // Conversion disabled
+  ADC2_HC0 = ADC_HC_ADCH(31);
+  compareArmed = false;
+}
+
+static void compareIsr() {
+  // The conversion that crossed the threshold is the first sample of the
+  // hit, so keep it for the trigger before stopping the ADCs
+  if (ADC1_HS & ADC_HS_COCO0) {
+    wakeSamples[0] = ADC1_R0;
+  }
+  if (ADC2_HS & ADC_HS_COCO0) {
+    wakeSamples[1] = ADC2_R0;
+  }
+  disarmCompare();
+  asm("dsb");
+}
+
+static void xbarConnect(unsigned int input, unsigned int output) {
+  volatile uint16_t *xbar = &XBARA1_SEL0 + (output / 2);
+  uint16_t val = *xbar;
+  if (!(output & 1)) {
+    val = (val & 0xFF00) | input;
+  } else {
+    val = (val & 0x00FF) | (input << 8);
+  }
+  *xbar = val;
+}
+
+DrumSampler::DrumSampler()
+  : triggers(nullptr), numTriggers(0), mode(SAMPLER_POLLED),
+    samplesRead(0), lastWritten(0), overruns(0), wakeups(0), lastActiveTime(0),
+    lastNoiseSampleTime(0) {
+}
+
+void DrumSampler::begin(DrumTrigger* const* drumTriggers, int count, SamplerMode samplerMode) {
+  triggers = drumTriggers;
+  numTriggers = count;
+  mode = samplerMode;
+
+  // The ADC_ETC chain and the ADC1/ADC2 pairing are wired for exactly two drums
+  if ((mode == SAMPLER_SYNC || mode == SAMPLER_DMA || mode == SAMPLER_COMPARE) &&
+      numTriggers != 2) {
+    Serial.println("DMA, sync and compare sampling need two drums, falling back to polling");
+    mode = SAMPLER_POLLED;
+  }
+
+  if (mode == SAMPLER_DMA) {
+    beginDMA();
+  } else if (mode == SAMPLER_MUX) {
+    beginMux();
+  } else if (mode == SAMPLER_COMPARE) {
+    attachInterruptVector(IRQ_ADC1, compareIsr);
+    attachInterruptVector(IRQ_ADC2, compareIsr);
+    NVIC_ENABLE_IRQ(IRQ_ADC1);
+    NVIC_ENABLE_IRQ(IRQ_ADC2);
+    armCompare();
+  }
+}
+
+void DrumSampler::armCompare() {
+  // Drum 1 on ADC1, drum 2 on ADC2, each against its current threshold
+  ADC1_CV = ADC_CV_CV1(triggers[0]->getThreshold());
+  ADC2_CV = ADC_CV_CV1(triggers[1]->getThreshold());
+  compareArmed = true;
+  ADC1_GC |= ADC_GC_ACFE | ADC_GC_ACFGT | ADC_GC_ADCO;
+  ADC2_GC |= ADC_GC_ACFE | ADC_GC_ACFGT | ADC_GC_ADCO;
+  ADC1_HC0 = ADC_HC_AIEN | ADC_HC_ADCH(DRUM_ADC_CHANNEL_1);
+  ADC2_HC0 = ADC_HC_AIEN | ADC_HC_ADCH(DRUM_ADC_CHANNEL_2);
+}
+
+unsigned long DrumSampler::getSampleClockUs() {
+  switch (mode) {
+    case SAMPLER_DMA:
+      return samplesWritten() * SAMPLE_PERIOD_US;
+    case SAMPLER_MUX:
+      return muxSweeps * MUX_SAMPLE_PERIOD_US;
+    default:
+      return micros();
+  }
+}
+
+unsigned long DrumSampler::getMuxMisses() const {
+  return muxMisses;
+}
+
+bool DrumSampler::isAwake() const {
+  return mode != SAMPLER_COMPARE || !compareArmed;
+}
+
+int DrumSampler::analogReadShared(uint8_t pin) {
+  if (!compareArmed) {
+    return analogRead(pin);
+  }
+  
+  // A compare-gated ADC would never complete a conversion below the
+  // threshold, so step out of compare mode for the read
+  NVIC_DISABLE_IRQ(IRQ_ADC1);
+  NVIC_DISABLE_IRQ(IRQ_ADC2);
+  disarmCompare();
+  int value = analogRead(pin);
+  armCompare();
+  NVIC_ENABLE_IRQ(IRQ_ADC1);
+  NVIC_ENABLE_IRQ(IRQ_ADC2);
+  return value;
+}
+
+void DrumSampler::beginMux() {
+  numTriggers = min(numTriggers, MUX_CHANNELS);
+  
+  for (int bit = 0; bit < 4; bit++) {
+    pinMode(MUX_SELECT_PINS[bit], OUTPUT);
+  }
+  // The core leaves ADC1 set up for analogRead(), with 4x hardware
+  // averaging. That can outlast a tick at 16 channels, and a tick that writes
+  // HC0 while a conversion is running aborts it, so every tick after would
+  // miss. One 12-bit conversion with a short sample time on the 20 MHz
+  // asynchronous clock fits.
+  ADC1_GC &= ~ADC_GC_AVGE;
+  ADC1_GC |= ADC_GC_ADACKEN;
+  ADC1_CFG = ADC_CFG_MODE(2) | ADC_CFG_ADSTS(1) | ADC_CFG_ADHSC | ADC_CFG_ADICLK(3);
+  
+  selectMuxChannel(0);
+  delayMicroseconds(1);
+  
+  // Time one conversion against the budget the tick rate was checked with
+  uint32_t start = ARM_DWT_CYCCNT;
+  ADC1_HC0 = ADC_HC_ADCH(MUX_ADC_CHANNEL);
+  while (!(ADC1_HS & ADC_HS_COCO0)) {
+  }
+  uint32_t conversionNs = (ARM_DWT_CYCCNT - start) * 1000 / (F_CPU_ACTUAL / 1000000);
+  (void)ADC1_R0;
+  if (conversionNs > (uint32_t)MUX_CONVERSION_NS) {
+    Serial.print("Mux ADC conversion takes ");
+    Serial.print(conversionNs);
+    Serial.print(" ns, over the budget of ");
+    Serial.print(MUX_CONVERSION_NS);
+    Serial.println(" ns");
+  }
+  ADC1_HC0 = ADC_HC_ADCH(MUX_ADC_CHANNEL);
+  
+  // Above the audio library's interrupts so the sample rate stays fixed
+  muxTimer.priority(32);
+  muxTimer.begin(muxTick, (float)MUX_SAMPLE_PERIOD_US / MUX_CHANNELS);
+}
+
+void DrumSampler::beginDMA() {
+  // ADC1 takes its conversions from ADC_ETC instead of software writes to HC0
+  ADC1_CFG |= ADC_CFG_ADTRG;
+  ADC1_HC0 = ADC_HC_ADCH(16);
+  ADC1_HC1 = ADC_HC_ADCH(16);
+
+  // Chain of two conversions per trigger, one DMA request when both are done
+  ADC_ETC_CTRL = ADC_ETC_CTRL_TSC_BYPASS | ADC_ETC_CTRL_DMA_MODE_SEL |
+                 ADC_ETC_CTRL_TRIG_ENABLE(1);
+  ADC_ETC_TRIG0_CTRL = ADC_ETC_TRIG_CTRL_TRIG_CHAIN(1);
+  ADC_ETC_TRIG0_CHAIN_1_0 =
+      ADC_ETC_TRIG_CHAIN_HWTS0(1) | ADC_ETC_TRIG_CHAIN_CSEL0(DRUM_ADC_CHANNEL_1) |
+      ADC_ETC_TRIG_CHAIN_B2B0 |
+      ADC_ETC_TRIG_CHAIN_HWTS1(2) | ADC_ETC_TRIG_CHAIN_CSEL1(DRUM_ADC_CHANNEL_2) |
+      ADC_ETC_TRIG_CHAIN_B2B1;
+  ADC_ETC_DMA_CTRL = ADC_ETC_DMA_CTRL_TRIQ_ENABLE(0);
+
+  sampleDma.begin();
+  sampleDma.source(ADC_ETC_TRIG0_RESULT_1_0);
+  sampleDma.destinationCircular(sampleRing, sizeof(sampleRing));
+  sampleDma.triggerAtHardwareEvent(DMAMUX_SOURCE_ADC_ETC);
+  sampleDma.interruptAtCompletion();
+  sampleDma.attachInterrupt(sampleDmaIsr);
+  sampleDma.enable();
+
+  // Route the PIT trigger output through XBAR to ADC_ETC trigger 0
+  CCM_CCGR2 |= CCM_CCGR2_XBAR1(CCM_CCGR_ON);
+  xbarConnect(XBARA1_IN_PIT_TRIGGER3, XBARA1_OUT_ADC_ETC_TRIG00);
+
+  // PIT runs from the 24 MHz oscillator; trigger only, no interrupt
+  CCM_CCGR1 |= CCM_CCGR1_PIT(CCM_CCGR_ON);
+  PIT_MCR = 1;
+  IMXRT_PIT_CHANNELS[SAMPLER_PIT_CHANNEL].LDVAL = 24 * SAMPLE_PERIOD_US - 1;
+  IMXRT_PIT_CHANNELS[SAMPLER_PIT_CHANNEL].TCTRL = PIT_TCTRL_TEN;
+}
+
+uint32_t DrumSampler::samplesWritten() {
+  uint32_t wraps;
+  uint32_t position;
+  do {
+    wraps = ringWraps;
+    position = ((uint32_t)sampleDma.TCD->DADDR - (uint32_t)sampleRing) / sizeof(uint32_t);
+  } while (wraps != ringWraps);
+
+  uint32_t written = wraps * SAMPLE_RING_SIZE + position;
+
+  // DADDR can wrap a moment before the completion interrupt is serviced
+  if ((int32_t)(written - lastWritten) < 0) {
+    written += SAMPLE_RING_SIZE;
+  }
+  lastWritten = written;
+  return written;
+}
+
+void DrumSampler::update() {
+  switch (mode) {
+    case SAMPLER_POLLED:
+      for (int i = 0; i < numTriggers; i++) {
+        triggers[i]->update();
+      }
+      break;
+
+    case SAMPLER_SYNC:
+      updateSync();
+      break;
+
+    case SAMPLER_DMA:
+      updateDMA();
+      break;
+
+    case SAMPLER_MUX:
+      updateMux();
+      break;
+
+    case SAMPLER_COMPARE:
+      updateCompare();
+      break;
+  }
+}
+
+void DrumSampler::updateCompare() {
+  unsigned long currentTime = millis();
+  
+  // Armed: nothing to do until a drum crosses its threshold, except that the
+  // adaptive thresholds only learn from samples they are given. One pair
+  // every COMPARE_NOISE_SAMPLE_MS keeps them tracking the idle noise.
+  if (compareArmed) {
+    if (currentTime - lastNoiseSampleTime < COMPARE_NOISE_SAMPLE_MS) {
+      return;
+    }
+    lastNoiseSampleTime = currentTime;
+    
+    NVIC_DISABLE_IRQ(IRQ_ADC1);
+    NVIC_DISABLE_IRQ(IRQ_ADC2);
+    compareIsr();  // Keeps a crossing that completed just now
+    if (wakeSamples[0] < 0 && wakeSamples[1] < 0) {
+      updateSync();
+      if (triggers[0]->isIdle() && triggers[1]->isIdle()) {
+        armCompare();
+      }
+    }
+    NVIC_CLEAR_PENDING(IRQ_ADC1);
+    NVIC_CLEAR_PENDING(IRQ_ADC2);
+    NVIC_ENABLE_IRQ(IRQ_ADC1);
+    NVIC_ENABLE_IRQ(IRQ_ADC2);
+    if (compareArmed) {
+      return;
+    }
+  }
+  
+  if (lastActiveTime == 0) {
+    wakeups++;
+    lastActiveTime = currentTime;
+  }
+  
+  for (int drum = 0; drum < 2; drum++) {
+    if (wakeSamples[drum] >= 0) {
+      triggers[drum]->update(wakeSamples[drum]);
+      wakeSamples[drum] = -1;
+    }
+  }
+  updateSync();
+  
+  // Keep polling until both drums have been quiet for a while, then hand
+  // back to the compare hardware with the thresholds learned meanwhile
+  if (!triggers[0]->isIdle() || !triggers[1]->isIdle()) {
+    lastActiveTime = currentTime;
+  } else if (currentTime - lastActiveTime >= COMPARE_IDLE_HOLD_MS) {
+    lastActiveTime = 0;
+    armCompare();
+  }
+}
+
+void DrumSampler::updateMux() {
+  // Every channel has a sample for each completed sweep
+  uint32_t written = muxSweeps;
+  uint32_t pending = written - samplesRead;
+
+  if (pending > (uint32_t)MUX_RING_SIZE - 1) {
+    overruns++;
+    samplesRead = written - (MUX_RING_SIZE - 1);
+    pending = MUX_RING_SIZE - 1;
+  }
+
+  while (pending > 0) {
+    uint32_t start = samplesRead & (MUX_RING_SIZE - 1);
+    uint32_t count = pending;
+    if (count > (uint32_t)SAMPLE_BLOCK_SIZE) count = SAMPLE_BLOCK_SIZE;
+    if (count > MUX_RING_SIZE - start) count = MUX_RING_SIZE - start;
+
+    for (int drum = 0; drum < numTriggers; drum++) {
+      for (uint32_t i = 0; i < count; i++) {
+        block[i] = muxRing[drum][start + i];
+      }
+      triggers[drum]->processBlock(block, count, samplesRead * MUX_SAMPLE_PERIOD_US,
+                                   MUX_SAMPLE_PERIOD_US);
+    }
+
+    samplesRead += count;
+    pending -= count;
+  }
+}
+
+void DrumSampler::updateSync() {
+  // Start both conversions within a few cycles of each other. Each ADC is
+  // left in software-trigger mode, so analogRead() of the pot on ADC2 still
+  // works between calls.
+  __disable_irq();
+  ADC1_HC0 = ADC_HC_ADCH(DRUM_ADC_CHANNEL_1);
+  ADC2_HC0 = ADC_HC_ADCH(DRUM_ADC_CHANNEL_2);
+  __enable_irq();
+
+  // Both finish together, one conversion time after the start
+  while (!(ADC1_HS & ADC_HS_COCO0) || !(ADC2_HS & ADC_HS_COCO0)) {
+  }
+
+  int value1 = ADC1_R0;
+  int value2 = ADC2_R0;
+  triggers[0]->update(value1);
+  triggers[1]->update(value2);
+}
+
+void DrumSampler::updateDMA() {
+  uint32_t written = samplesWritten();
+  uint32_t pending = written - samplesRead;
+
+  // loop() stalled for longer than the ring holds; resume from the oldest
+  // sample that has not been overwritten yet
+  if (pending > (uint32_t)SAMPLE_RING_SIZE - 1) {
+    overruns++;
+    samplesRead = written - (SAMPLE_RING_SIZE - 1);
+    pending = SAMPLE_RING_SIZE - 1;
+  }
+
+  while (pending > 0) {
+    uint32_t start = samplesRead & (SAMPLE_RING_SIZE - 1);
+    uint32_t count = pending;
+    if (count > (uint32_t)SAMPLE_BLOCK_SIZE) count = SAMPLE_BLOCK_SIZE;
+    if (count > SAMPLE_RING_SIZE - start) count = SAMPLE_RING_SIZE - start;
+
+    for (int drum = 0; drum < 2; drum++) {
+      int shift = drum * 16;
+      for (uint32_t i = 0; i < count; i++) {
+        block[i] = (sampleRing[start + i] >> shift) & 0xFFF;
+      }
+      triggers[drum]->processBlock(block, count, samplesRead * SAMPLE_PERIOD_US,
+                                   SAMPLE_PERIOD_US);
+    }
+
+    samplesRead += count;
+    pending -= count;
+  }
+}
@@ -1,26 +1,69 @@
 #include "drum_trigger.h"
 #include "config.h"
+#include "deferred_log.h"
 
 DrumTrigger::DrumTrigger(int pin, int drumNumber) 
-  : drumPin(pin), drumNum(drumNumber), lastHitTime(0), 
+  : drumPin(pin), drumNum(drumNumber), triggerValue(TRIGGER_VALUE),
+    scanTimeUs(SCAN_TIME_US), maskTimeUs(MASK_TIME_US), lastHitTime(0),
     scanning(false), scanStartTime(0), peakValue(0), triggered(false),
-    triggerValue(TRIGGER_VALUE) {
+    mode(DEFAULT_TRIGGER_MODE), crossingValue(0), firedPeak(0), fireTime(0), firedEarly(false),
+    peakCorrected(false), hitCancelled(false), lastHitPeak(0), maskDecayStart(MASK_DECAY_START),
+    maskDecayUs(MASK_DECAY_US), adaptiveThreshold(ADAPTIVE_THRESHOLD),
+    threshold(THRESHOLD), baselineQ16(0), noiseQ16(0) {
+}
+
+DrumTrigger::DrumTrigger() : DrumTrigger(-1, 0) {
 }
 
 void DrumTrigger::begin() {
   pinMode(drumPin, INPUT);
 }
 
+void DrumTrigger::begin(int pin, int drumNumber) {
+  drumPin = pin;
+  drumNum = drumNumber;
+  begin();
+}
+
 void DrumTrigger::update() {
-  unsigned long currentTime = millis();
-  int value = analogRead(drumPin);
-  
-  // Process drum trigger
-  if (currentTime - lastHitTime >= MASK_TIME) {
-    if (!scanning && value > THRESHOLD) {
+  update(analogRead(drumPin));
+}
+
+void DrumTrigger::update(int value) {
+  processSample(value, micros());
+}
+
+void DrumTrigger::processBlock(const uint16_t* samples, int count, unsigned long firstSampleUs,
+                               unsigned long samplePeriodUs) {
+  // Time comes from the sample clock rather than micros(), so the scan and
+  // mask windows are the same however late the block is processed. Like
+  // micros() it wraps every ~71 minutes, which the unsigned subtractions in
+  // processSample() tolerate.
+  for (int i = 0; i < count; i++) {
+    processSample(samples[i], firstSampleUs + i * samplePeriodUs);
+  }
+}
+
+void DrumTrigger::processSample(int value, unsigned long currentTime) {
+  // Process drum trigger (all times in microseconds)
+  if (currentTime - lastHitTime >= maskTimeUs) {
+    // Evaluated every sample so the ring-out is marked over as soon as the
+    // envelope falls below the threshold, not only when the next hit arrives
+    int envelope = scanning ? 0 : retriggerLevel(currentTime);
+    
+    // Every sample outside a fired hit's mask and ring-out feeds the noise
+    // estimate, including scans that turn out too small to fire
+    if (adaptiveThreshold && lastHitPeak == 0) {
+      trackNoise(value);
+    }
+    
+    if (!scanning && value > threshold && value > envelope) {
       scanning = true;
       scanStartTime = currentTime;
       peakValue = value;
+      crossingValue = value;
+      firedEarly = false;
+      hitCancelled = false;
     }
     
     if (scanning) {
@@ -28,23 +71,130 @@ void DrumTrigger::update() {
         peakValue = value;
       }
       
-      if (currentTime - scanStartTime >= SCAN_TIME) {
-        Serial.print("DRUM ");
-        Serial.print(drumNum);
-        Serial.print(" HIT! Peak: ");
-        Serial.println(peakValue);
+      // Early mode fires as soon as the slope over the first part of the
+      // rising edge predicts a peak above the trigger value, instead of
+      // waiting for the whole scan window
+      if (mode == TRIGGER_EARLY && !firedEarly && !hitCancelled &&
+          currentTime - scanStartTime >= EARLY_SLOPE_TIME_US) {
+        int predicted = predictPeak(value, currentTime);
+        if (predicted >= fireLevel()) {
+          firedEarly = true;
+          firedPeak = predicted;
+          fireTime = currentTime;
+          triggered = true;
+        }
+      }
+      
+      if (currentTime - scanStartTime >= scanTimeUs) {
+        scanning = false;
+        
+        // A blip below the fire level is not a hit, so it opens no mask or
+        // ring-out and the noise estimate keeps learning through it
+        if (!firedEarly && !hitCancelled && peakValue < fireLevel()) {
+          return;
+        }
         
-        if (peakValue >= triggerValue) {
+        debugLog.write(LOG_DRUM_HIT, drumNum, peakValue, firedEarly ? firedPeak : -1);
+        
+        if (hitCancelled) {
+          // Already rejected, nothing to fire or correct
+        } else if (firedEarly) {
+          peakCorrected = EARLY_FIRE_CORRECTION;
+        } else {
+          firedPeak = peakValue;
+          fireTime = currentTime;
           triggered = true;
         }
         
-        scanning = false;
         lastHitTime = currentTime;
+        lastHitPeak = peakValue;
       }
     }
   }
 }
 
+int DrumTrigger::retriggerLevel(unsigned long currentTime) {
+  if (lastHitPeak == 0) {
+    return 0;
+  }
+  
+  // The ring-out of the last hit decays roughly exponentially through the
+  // conditioning board's peak detector. A new hit has to rise above an
+  // envelope that starts at a fraction of the last peak and decays a little
+  // slower than the ring-out, so rolls retrigger without double hits.
+  float sinceHit = currentTime - lastHitTime;
+  int level = lastHitPeak * maskDecayStart * expf(-sinceHit / maskDecayUs);
+  
+  // Once the envelope is below the noise threshold it no longer matters
+  if (level <= threshold) {
+    lastHitPeak = 0;
+  }
+  return level;
+}
+
+// With the adaptive threshold, a hit needs the same margin over the learned
+// threshold that TRIGGER_VALUE has over THRESHOLD, so a quiet channel gets
+// more sensitive as well as a noisy one less
+int DrumTrigger::fireLevel() const {
+  if (!adaptiveThreshold) {
+    return triggerValue;
+  }
+  return max(threshold + triggerValue - THRESHOLD, threshold);
+}
+
+void DrumTrigger::trackNoise(int value) {
+  // Running baseline and mean absolute deviation, both in 16.16 fixed point
+  // so steps of 1/4096 of an LSB still register. Each sample's pull is
+  // clipped rather than samples above the threshold being left out, so a
+  // hit only nudges the estimate while noise that really grows still raises
+  // the threshold over a few time constants.
+  int32_t sample = min(value, threshold) << 16;
+  baselineQ16 += (sample - baselineQ16) >> NOISE_TRACK_SHIFT;
+  int32_t clip = max(noiseQ16 * NOISE_CLIP_FACTOR, (int32_t)1 << 16);
+  int32_t deviation = min(abs(((int32_t)value << 16) - baselineQ16), clip);
+  noiseQ16 += (deviation - noiseQ16) >> NOISE_TRACK_SHIFT;
+  
+  int adapted = (baselineQ16 + NOISE_THRESHOLD_FACTOR * noiseQ16) >> 16;
+  threshold = constrain(adapted, ADAPTIVE_THRESHOLD_MIN, ADAPTIVE_THRESHOLD_MAX);
+}
+
+int DrumTrigger::predictPeak(int value, unsigned long currentTime) const {
+  // Extrapolate the rise seen since the threshold crossing over the rest of
+  // the rising edge. Harder hits rise faster, so the slope tracks the peak.
+  unsigned long elapsed = currentTime - scanStartTime;
+  if (elapsed == 0) {
+    return value;
+  }
+  long rise = (long)(value - crossingValue) * (long)EARLY_RISE_TIME_US / (long)elapsed;
+  return constrain(value + rise, (long)value, 4095L);
+}
+
+void DrumTrigger::cancelHit() {
+  triggered = false;
+  peakCorrected = false;
+  hitCancelled = true;
+}
+
 void DrumTrigger::setTriggerValue(int value) {
   triggerValue = constrain(value, 10, 1000);
 }
+
+void DrumTrigger::setScanTime(unsigned long us) {
+  scanTimeUs = constrain(us, 100UL, 20000UL);
+}
+
+void DrumTrigger::setMaskTime(unsigned long us) {
+  maskTimeUs = constrain(us, 0UL, 500000UL);
+}
+
+void DrumTrigger::setAdaptiveThreshold(bool enabled) {
+  adaptiveThreshold = enabled;
+  if (!enabled) {
+    threshold = THRESHOLD;
+  }
+}
+
+void DrumTrigger::setMaskDecay(float startRatio, unsigned long decayUs) {
+  maskDecayStart = constrain(startRatio, 0.0f, 2.0f);
+  maskDecayUs = constrain(decayUs, 1000UL, 1000000UL);
+}
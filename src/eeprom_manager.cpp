@@ -14,43 +14,44 @@ bool EEPROMManager::validateNote(uint8_t note) {
     return note <= 127;
 }
 
-void EEPROMManager::initializeEEPROM(uint8_t drum1Note, uint8_t drum2Note) {
+void EEPROMManager::initializeEEPROM(const uint8_t *notes, int count) {
     EEPROM.write(EEPROM_ADDR_MAGIC, EEPROM_MAGIC_NUMBER);
-    EEPROM.write(EEPROM_ADDR_DRUM1_NOTE, drum1Note);
-    EEPROM.write(EEPROM_ADDR_DRUM2_NOTE, drum2Note);
+    for (int i = 0; i < count; i++) {
+        EEPROM.write(EEPROM_ADDR_DRUM1_NOTE + i, notes[i]);
+    }
 }
 
-bool EEPROMManager::loadNotes(uint8_t &drum1Note, uint8_t &drum2Note) {
+bool EEPROMManager::loadNotes(uint8_t *notes, int count) {
     uint8_t magic = EEPROM.read(EEPROM_ADDR_MAGIC);
     
     if (magic == EEPROM_MAGIC_NUMBER) {
         // Valid EEPROM data exists
-        drum1Note = EEPROM.read(EEPROM_ADDR_DRUM1_NOTE);
-        drum2Note = EEPROM.read(EEPROM_ADDR_DRUM2_NOTE);
-        
-        // Validate the loaded values
-        if (!validateNote(drum1Note)) {
-            drum1Note = DEFAULT_DRUM1_NOTE;
-        }
-        if (!validateNote(drum2Note)) {
-            drum2Note = DEFAULT_DRUM2_NOTE;
+        for (int i = 0; i < count; i++) {
+            notes[i] = EEPROM.read(EEPROM_ADDR_DRUM1_NOTE + i);
+            
+            // Validate the loaded value. Drums added since the last save
+            // read back as erased cells (0xFF) and get their default.
+            if (!validateNote(notes[i])) {
+                notes[i] = defaultDrumNote(i);
+            }
         }
         
         return true;
     } else {
         // First boot or corrupted EEPROM - use defaults
-        drum1Note = DEFAULT_DRUM1_NOTE;
-        drum2Note = DEFAULT_DRUM2_NOTE;
+        for (int i = 0; i < count; i++) {
+            notes[i] = defaultDrumNote(i);
+        }
         
         // Initialize EEPROM with defaults
-        initializeEEPROM(drum1Note, drum2Note);
+        initializeEEPROM(notes, count);
         
         return false;
     }
 }
 
 void EEPROMManager::saveNote(int drumIndex, uint8_t note) {
-    int address = (drumIndex == 0) ? EEPROM_ADDR_DRUM1_NOTE : EEPROM_ADDR_DRUM2_NOTE;
+    int address = EEPROM_ADDR_DRUM1_NOTE + drumIndex;
     
     // Read before write to minimize EEPROM wear
     uint8_t currentValue = EEPROM.read(address);
@@ -60,7 +61,8 @@ void EEPROMManager::saveNote(int drumIndex, uint8_t note) {
 }
 
 void EEPROMManager::update(unsigned long currentTime, bool notesDirty, 
-                          unsigned long lastNoteChange, uint8_t drum1Note, uint8_t drum2Note) {
+                          unsigned long lastNoteChange, const uint8_t *notes, int count,
+                          bool writeAllowed) {
     // Check if we need to schedule a write
     if (notesDirty && !pendingWrite) {
         pendingWrite = true;
@@ -68,9 +70,10 @@ void EEPROMManager::update(unsigned long currentTime, bool notesDirty,
     }
     
     // Execute pending write if time has elapsed
-    if (pendingWrite && currentTime >= writeScheduledTime) {
-        saveNote(0, drum1Note);
-        saveNote(1, drum2Note);
+    if (isWriteDue(currentTime) && writeAllowed) {
+        for (int i = 0; i < count; i++) {
+            saveNote(i, notes[i]);
+        }
         pendingWrite = false;
     }
 }
\ No newline at end of file
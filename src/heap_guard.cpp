@@ -0,0 +1,61 @@
+#include "heap_guard.h"
+
+#ifdef HEAP_GUARD
+#include <Arduino.h>
+
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+}
+
+static volatile bool armed = false;
+static volatile uint32_t allocations = 0;
+static void *volatile firstCaller = nullptr;
+
+// Runs inside the allocator, possibly from an interrupt, so only records
+static void noteAllocation(void *caller) {
+  if (armed) {
+    if (allocations == 0) {
+      firstCaller = caller;
+    }
+    allocations++;
+  }
+}
+
+extern "C" {
+void *__wrap_malloc(size_t size) {
+  noteAllocation(__builtin_return_address(0));
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  noteAllocation(__builtin_return_address(0));
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  noteAllocation(__builtin_return_address(0));
+  return __real_realloc(ptr, size);
+}
+}
+
+void armHeapGuard() {
+  armed = true;
+}
+
+void checkHeapGuard() {
+  if (allocations == 0) {
+    return;
+  }
+  
+  armed = false;
+  Serial.print("HEAP GUARD: ");
+  Serial.print(allocations);
+  Serial.print(" allocation(s) after setup(), first called from 0x");
+  Serial.println((uint32_t)firstCaller, HEX);
+  Serial.flush();
+  while (true) {
+  }
+}
+#endif
@@ -1,8 +1,9 @@
 #include "input_controls.h"
 #include "config.h"
+#include "deferred_log.h"
 
 InputControls::InputControls() 
-  : pot3Value(0), lastPot3Value(0), 
+  : analogReader(analogRead), pot3Value(0), lastPot3Value(0), 
   lastPotRead(0), buttonPressed(-1) {
   
   for (int i = 0; i < NUM_BUTTONS; i++) {
@@ -20,7 +21,7 @@ void InputControls::begin() {
   }
   
   // Read initial pot values
-  pot3Value = analogRead(POT_PIN_3);
+  pot3Value = analogReader(POT_PIN_3);
   lastPot3Value = pot3Value;
 }
 
@@ -29,14 +30,13 @@ void InputControls::update() {
   
   // Read pots periodically and check for changes
   if (currentTime - lastPotRead >= POT_READ_INTERVAL) {
-    pot3Value = analogRead(POT_PIN_3);
+    pot3Value = analogReader(POT_PIN_3);
     lastPotRead = currentTime;
     
     // Only print if any pot changed significantly
     if (abs(pot3Value - lastPot3Value) > POT_CHANGE_THRESHOLD) {
       
-      Serial.print(" | Pot3: ");
-      Serial.println(pot3Value);
+      debugLog.write(LOG_POT, 0, pot3Value);
       
       lastPot3Value = pot3Value;
     }
@@ -47,9 +47,7 @@ void InputControls::update() {
     bool currentState = digitalRead(BUTTON_PINS[i]);
     
     if (currentState == LOW && lastButtonState[i] == HIGH) {
-      Serial.print("BUTTON ");
-      Serial.print(BUTTON_PINS[i]);
-      Serial.println(" PRESSED");
+      debugLog.write(LOG_BUTTON, BUTTON_PINS[i]);
       
       buttonPressed = BUTTON_PINS[i];
     }
@@ -0,0 +1,136 @@
+#include "latency_monitor.h"
+
+static const char *const stageNames[NUM_LATENCY_STAGES] = {"scan", "play", "audio"};
+
+void AudioUpdateProbe::update() {
+  if (armed) {
+    stampCycles = ARM_DWT_CYCCNT;
+    armed = false;
+  }
+}
+
+LatencyMonitor::LatencyMonitor() {
+  reset();
+}
+
+void LatencyMonitor::reset() {
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    for (int s = 0; s < NUM_LATENCY_STAGES; s++) {
+      memset(&histograms[i][s], 0, sizeof(Histogram));
+      histograms[i][s].minUs = UINT32_MAX;
+    }
+    crossingCycles[i] = 0;
+    audioPending[i] = false;
+  }
+  memset(&loopPasses, 0, sizeof(Histogram));
+  loopPasses.minUs = UINT32_MAX;
+  loopStartCycles = 0;
+}
+
+uint32_t LatencyMonitor::cyclesToUs(uint32_t cycles) const {
+  return cycles / (F_CPU_ACTUAL / 1000000);
+}
+
+void LatencyMonitor::hitFired(int drumIndex, unsigned long crossingAgeUs, unsigned long fireAgeUs) {
+  // Ages come from the trigger timebase (sample clock or micros()); turn the
+  // crossing into a cycle-counter timestamp so later stages are exact
+  uint32_t now = ARM_DWT_CYCCNT;
+  crossingCycles[drumIndex] = now - crossingAgeUs * (F_CPU_ACTUAL / 1000000);
+  record(drumIndex, STAGE_SCAN_END, crossingAgeUs - fireAgeUs);
+}
+
+void LatencyMonitor::notePlayed(int drumIndex) {
+  uint32_t now = ARM_DWT_CYCCNT;
+  record(drumIndex, STAGE_PLAY, cyclesToUs(now - crossingCycles[drumIndex]));
+  audioPending[drumIndex] = true;
+  probe.arm();
+}
+
+void LatencyMonitor::update() {
+  if (!probe.isArmed()) {
+    for (int i = 0; i < NUM_DRUMS; i++) {
+      if (audioPending[i]) {
+        record(i, STAGE_AUDIO, cyclesToUs(probe.getStampCycles() - crossingCycles[i]));
+        audioPending[i] = false;
+      }
+    }
+  }
+}
+
+// A pass covers everything loop() waits on, so the longest one bounds how
+// late a finished hit can be picked up, and the spread is the loop's jitter
+void LatencyMonitor::loopStarted() {
+  uint32_t now = ARM_DWT_CYCCNT;
+  if (loopStartCycles != 0) {
+    record(loopPasses, cyclesToUs(now - loopStartCycles));
+  }
+  loopStartCycles = now;
+}
+
+void LatencyMonitor::record(int drumIndex, LatencyStage stage, uint32_t us) {
+  record(histograms[drumIndex][stage], us);
+}
+
+void LatencyMonitor::record(Histogram &h, uint32_t us) {
+  h.count++;
+  h.sumUs += us;
+  h.minUs = min(h.minUs, us);
+  h.maxUs = max(h.maxUs, us);
+  
+  // Last bin collects everything beyond the histogram range
+  uint32_t bin = min(us / LATENCY_BIN_US, (uint32_t)(LATENCY_BINS - 1));
+  if (h.bins[bin] < UINT16_MAX) {
+    h.bins[bin]++;
+  }
+}
+
+uint32_t LatencyMonitor::percentile(const Histogram &h, int percent) const {
+  // Upper edge of the bin holding the requested rank
+  uint32_t rank = (h.count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int b = 0; b < LATENCY_BINS; b++) {
+    seen += h.bins[b];
+    if (seen >= rank) {
+      return (b + 1) * LATENCY_BIN_US;
+    }
+  }
+  return h.maxUs;
+}
+
+void LatencyMonitor::printReport() {
+  Serial.println("Latency from threshold crossing (us): n min mean p99 max");
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    for (int s = 0; s < NUM_LATENCY_STAGES; s++) {
+      const Histogram &h = histograms[i][s];
+      Serial.print("DRUM ");
+      Serial.print(i + 1);
+      Serial.print(" ");
+      Serial.print(stageNames[s]);
+      Serial.print(": ");
+      printHistogram(h);
+    }
+  }
+  
+  // Jitter is the spread between the fastest and slowest pass
+  Serial.print("Loop pass: ");
+  printHistogram(loopPasses);
+  if (loopPasses.count > 0) {
+    Serial.print("Loop jitter (us): ");
+    Serial.println(loopPasses.maxUs - loopPasses.minUs);
+  }
+}
+
+void LatencyMonitor::printHistogram(const Histogram &h) {
+  Serial.print(h.count);
+  if (h.count > 0) {
+    Serial.print(" ");
+    Serial.print(h.minUs);
+    Serial.print(" ");
+    Serial.print((uint32_t)(h.sumUs / h.count));
+    Serial.print(" ");
+    Serial.print(percentile(h, 99));
+    Serial.print(" ");
+    Serial.print(h.maxUs);
+  }
+  Serial.println();
+}
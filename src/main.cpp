@@ -1,28 +1,38 @@
 #include <Arduino.h>
 #include "config.h"
 #include "drum_trigger.h"
+#include "drum_sampler.h"
+#include "crosstalk_filter.h"
 #include "audio_manager.h"
 #include "display_manager.h"
 #include "input_controls.h"
 #include "menu_system.h"
 #include "eeprom_manager.h"
+#include "latency_monitor.h"
+#include "deferred_log.h"
+#include "bus_scheduler.h"
+#include "heap_guard.h"
 
-// Create instances
-DrumTrigger drum1(DRUM_PIN_1, 1);
-DrumTrigger drum2(DRUM_PIN_2, 2);
+// Create instances (drum triggers get their inputs in setup, and the other
+// modules take them through the drums pointer table)
+DrumTrigger drumTriggers[NUM_DRUMS];
+DrumTrigger* drums[NUM_DRUMS];
+DrumSampler sampler;
+CrosstalkFilter crosstalk;
 AudioManager audio;
 DisplayManager display;
 InputControls inputs;
 MenuSystem menu;
 EEPROMManager eepromManager;
+LatencyMonitor latency;
+BusScheduler busScheduler;
 
 // Pot state tracking with initialization flags
 int lastPot3ForVolume = -1;
 bool pot3Initialized = false;  // NEW
 
 // Hit timing for visual feedback
-unsigned long drum1HitTime = 0;
-unsigned long drum2HitTime = 0;
+unsigned long drumHitTimes[NUM_DRUMS];
 unsigned long lastDisplayUpdate = 0;
 
 // Display state
@@ -36,6 +46,51 @@ DisplayState displayState = STATE_IDLE;
 unsigned long overlayStartTime = 0;
 int overlayDrumIndex = 0;
 
+// Pot reads share ADC2 with the drum sampler's compare mode
+int sharedAnalogRead(uint8_t pin) {
+  return sampler.analogReadShared(pin);
+}
+
+// Things that went wrong since boot, none of which stop the system
+void printErrorCounts() {
+  Serial.print("Sampler overruns: ");
+  Serial.print(sampler.getOverruns());
+  Serial.print(" | Mux misses: ");
+  Serial.println(sampler.getMuxMisses());
+  Serial.print("Crosstalk suppressed:");
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    Serial.print(" DRUM ");
+    Serial.print(i + 1);
+    Serial.print(" ");
+    Serial.print(crosstalk.getSuppressed(i));
+  }
+  Serial.println();
+  Serial.print("Voices stolen: ");
+  Serial.print(audio.getVoicesStolen());
+  Serial.print(" | Display transfer failures: ");
+  Serial.println(display.getTransferFailures());
+}
+
+// 'l' prints the latency report and error counts, 'r' clears the latency
+// stats, 'b' runs the audio benchmark, 'q' prints how often display and
+// EEPROM traffic waited for a quiet window
+void handleSerialCommands() {
+  while (Serial.available() > 0) {
+    int command = Serial.read();
+    if (command == 'l') {
+      latency.printReport();
+      printErrorCounts();
+    } else if (command == 'r') {
+      latency.reset();
+      Serial.println("Latency stats reset");
+    } else if (command == 'b') {
+      audio.benchmark();
+    } else if (command == 'q') {
+      busScheduler.printReport();
+    }
+  }
+}
+
 void updateDisplay() {
   unsigned long currentTime = millis();
   
@@ -46,13 +101,15 @@ void updateDisplay() {
   }
   
   // Calculate hit states
-  bool drum1Active = (currentTime - drum1HitTime < HIT_DOT_DURATION_MS);
-  bool drum2Active = (currentTime - drum2HitTime < HIT_DOT_DURATION_MS);
+  bool drumActive[NUM_DRUMS];
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    drumActive[i] = (currentTime - drumHitTimes[i] < HIT_DOT_DURATION_MS);
+  }
   
   // Render based on current state
   switch (displayState) {
     case STATE_IDLE:
-      display.showIdleScreen(drum1Active, drum2Active);
+      display.showIdleScreen(drumActive, NUM_DRUMS);
       break;
       
     case STATE_VOLUME_OVERLAY:
@@ -61,10 +118,9 @@ void updateDisplay() {
       
     case STATE_MENU:
       display.showMenu(menu.getSelectedDrum(), 
-                      menu.getDrum1Note(), 
-                      menu.getDrum2Note(),
-                      drum1Active,
-                      drum2Active);
+                      menu.getDrumNotes(), 
+                      drumActive,
+                      NUM_DRUMS);
       break;
   }
 }
@@ -74,16 +130,23 @@ void setup() {
   analogReadResolution(12);
   
   // Initialize all subsystems
-  drum1.begin();
-  drum2.begin();
-  audio.begin();
-  display.begin();
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    int pin = USE_DRUM_MUX ? MUX_INPUT_PIN : DRUM_PINS[i];
+    drumTriggers[i].begin(pin, i + 1);
+    drums[i] = &drumTriggers[i];
+    drumHitTimes[i] = 0;
+  }
+  crosstalk.begin(drums, NUM_DRUMS);
+  busScheduler.begin(drums, NUM_DRUMS);
+  audio.begin(DEFAULT_RENDER_MODE);
+  display.begin(DEFAULT_DISPLAY_FLUSH, &busScheduler);
+  inputs.setAnalogReader(sharedAnalogRead);
   inputs.begin();
   eepromManager.begin();
   
   // Load notes from EEPROM
-  uint8_t drum1Note, drum2Note;
-  bool validData = eepromManager.loadNotes(drum1Note, drum2Note);
+  uint8_t drumNotes[NUM_DRUMS];
+  bool validData = eepromManager.loadNotes(drumNotes, NUM_DRUMS);
   
   if (validData) {
     Serial.println("Loaded notes from EEPROM");
@@ -92,58 +155,97 @@ void setup() {
   }
   
   // Initialize menu system with loaded notes
-  menu.begin(drum1Note, drum2Note);
+  menu.begin(drumNotes);
   
   // Set audio manager notes
-  audio.setDrum1Note(drum1Note);
-  audio.setDrum2Note(drum2Note);
-  
-  Serial.print("Drum 1: ");
-  Serial.print(midiToNoteName(drum1Note));
-  Serial.print(" (MIDI ");
-  Serial.print(drum1Note);
-  Serial.print(") | Drum 2: ");
-  Serial.print(midiToNoteName(drum2Note));
-  Serial.print(" (MIDI ");
-  Serial.print(drum2Note);
-  Serial.println(")");
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    audio.setDrumNote(i, drumNotes[i]);
+    
+    if (i > 0) {
+      Serial.print(" | ");
+    }
+    Serial.print("Drum ");
+    Serial.print(i + 1);
+    Serial.print(": ");
+    char noteName[NOTE_NAME_SIZE];
+    Serial.print(midiToNoteName(drumNotes[i], noteName));
+    Serial.print(" (MIDI ");
+    Serial.print(drumNotes[i]);
+    Serial.print(")");
+  }
+  Serial.println();
   
   // Show splash screen
   display.showSplash();
   Serial.println("Drum trigger system ready!");
   Serial.println("Hit the drums or press CENTER to enter menu...");
   
-  delay(2000);
+  // Frames are sent from update()
+  unsigned long splashStart = millis();
+  while (millis() - splashStart < 2000) {
+    display.update();
+  }
   
   // Initialize pot tracking values
   lastPot3ForVolume = inputs.getPot3Value();
   
   // Switch to idle screen after splash
   displayState = STATE_IDLE;
-  display.showIdleScreen(false, false);
+  bool noHits[NUM_DRUMS] = {};
+  display.showIdleScreen(noHits, NUM_DRUMS);
+  
+  // Sampling starts last. Only loop() drains the sample ring, which holds
+  // about 40 ms, so the codec setup and the splash would overrun it.
+  sampler.begin(drums, NUM_DRUMS, DEFAULT_SAMPLER_MODE);
+  
+  // Everything after this point must run without the heap
+  armHeapGuard();
 }
 
 void loop() {
+  // With the ADC compare armed there are no samples to process, so sleep
+  // until an interrupt: the compare itself, an audio block, USB or the 1 ms
+  // system tick. The UI below then runs once per wakeup, not every 100 us.
+  if (!sampler.isAwake()) {
+    latency.loopSleeping();
+    asm("wfi");
+  }
+  
   unsigned long currentTime = millis();
+  latency.loopStarted();
+  checkHeapGuard();
   
   // Update all subsystems
-  drum1.update();
-  drum2.update();
+  sampler.update();
+  bool sampling = sampler.isAwake();
+  if (sampling) {
+    crosstalk.update();
+    latency.update();
+  }
   inputs.update();
   menu.update(currentTime);
+  busScheduler.update(sampler.getSampleClockUs());
+  handleSerialCommands();
   
-  // Handle drum 1 triggers
-  if (drum1.wasTriggered()) {
-    drum1HitTime = currentTime;
-    audio.playDrum(1, drum1.getPeakValue());
-    drum1.clearTriggered();
-  }
-  
-  // Handle drum 2 triggers
-  if (drum2.wasTriggered()) {
-    drum2HitTime = currentTime;
-    audio.playDrum(2, drum2.getPeakValue());
-    drum2.clearTriggered();
+  // Handle drum triggers
+  for (int i = 0; i < NUM_DRUMS; i++) {
+    DrumTrigger *drum = drums[i];
+    
+    if (drum->wasTriggered()) {
+      unsigned long sampleClock = sampler.getSampleClockUs();
+      latency.hitFired(i, sampleClock - drum->getHitTime(), sampleClock - drum->getFireTime());
+      
+      drumHitTimes[i] = currentTime;
+      audio.playDrum(i + 1, drum->getPeakValue());
+      latency.notePlayed(i);
+      drum->clearTriggered();
+    }
+    
+    // Early-fired hits get their level corrected once the real peak is known
+    if (drum->wasPeakCorrected()) {
+      audio.correctDrum(i + 1, drum->getPeakValue(), drum->getMeasuredPeak());
+      drum->clearPeakCorrected();
+    }
   }
 
   // Handle button presses
@@ -157,8 +259,9 @@ void loop() {
       displayState = STATE_MENU;
       
       // Update audio manager with new notes whenever they change
-      audio.setDrum1Note(menu.getDrum1Note());
-      audio.setDrum2Note(menu.getDrum2Note());
+      for (int i = 0; i < NUM_DRUMS; i++) {
+        audio.setDrumNote(i, menu.getDrumNote(i));
+      }
     } else {
       displayState = STATE_IDLE;
     }
@@ -186,24 +289,36 @@ void loop() {
         display.showVolumeOverlay(volumePercent);
       }
       
-      Serial.print("Volume: ");
-      Serial.println(volume);
+      debugLog.write(LOG_VOLUME, 0, (int)(volume * 100));
     }
     
     lastPot3ForVolume = currentPot3;
     pot3Initialized = true;
   }
   
-  // Handle delayed EEPROM writes
+  // Handle delayed EEPROM writes, outside trigger scans
+  bool eepromDue = eepromManager.isWriteDue(currentTime);
+  bool eepromAllowed = !eepromDue || busScheduler.mayStart(BUS_EEPROM, currentTime);
   eepromManager.update(currentTime, menu.areNotesDirty(), 
                       menu.getLastNoteChange(),
-                      menu.getDrum1Note(), menu.getDrum2Note());
+                      menu.getDrumNotes(), NUM_DRUMS, eepromAllowed);
+  if (eepromDue && eepromAllowed) {
+    busScheduler.finished(BUS_EEPROM);  // The write completes inside update()
+  }
   
   // Update display (handles state transitions and hit dots)
   if (currentTime - lastDisplayUpdate > 50) {  // Update at ~20Hz
     updateDisplay();
     lastDisplayUpdate = currentTime;
   }
+  display.update();  // Asks busScheduler before each transfer
+  
+  // Print queued log records only while no drum is mid-scan
+  if (!busScheduler.isDrumScanning()) {
+    debugLog.drain();
+  }
   
-  delayMicroseconds(100);
+  if (sampling) {
+    delayMicroseconds(100);
+  }
 }
\ No newline at end of file
@@ -2,13 +2,16 @@
 
 MenuSystem::MenuSystem() 
     : state(MENU_IDLE), selectedDrum(0), 
-      drum1Note(DEFAULT_DRUM1_NOTE), drum2Note(DEFAULT_DRUM2_NOTE),
       notesDirty(false), lastMenuActivity(0), lastNoteChange(0) {
+    for (int i = 0; i < NUM_DRUMS; i++) {
+        drumNotes[i] = defaultDrumNote(i);
+    }
 }
 
-void MenuSystem::begin(uint8_t initialDrum1Note, uint8_t initialDrum2Note) {
-    drum1Note = initialDrum1Note;
-    drum2Note = initialDrum2Note;
+void MenuSystem::begin(const uint8_t *initialNotes) {
+    for (int i = 0; i < NUM_DRUMS; i++) {
+        drumNotes[i] = initialNotes[i];
+    }
     notesDirty = false;
 }
 
@@ -22,14 +25,14 @@ void MenuSystem::exitMenu() {
 }
 
 void MenuSystem::selectDrum(int drum) {
-    if (drum >= 0 && drum <= 1) {
+    if (drum >= 0 && drum < NUM_DRUMS) {
         selectedDrum = drum;
         lastMenuActivity = millis();
     }
 }
 
 void MenuSystem::adjustNote(int8_t delta) {
-    uint8_t *note = (selectedDrum == 0) ? &drum1Note : &drum2Note;
+    uint8_t *note = &drumNotes[selectedDrum];
     
     int newNote = *note + delta;
     
@@ -57,9 +60,9 @@ void MenuSystem::handleButtonPress(int buttonPin) {
         if (buttonPin == BTN_CENTER) {
             exitMenu();
         } else if (buttonPin == BTN_UP) {
-            selectDrum(0);
+            selectDrum(selectedDrum - 1);
         } else if (buttonPin == BTN_DOWN) {
-            selectDrum(1);
+            selectDrum(selectedDrum + 1);
         } else if (buttonPin == BTN_LEFT) {
             adjustNote(-1);
         } else if (buttonPin == BTN_RIGHT) {
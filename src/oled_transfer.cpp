@@ -0,0 +1,102 @@
+#include "oled_transfer.h"
+#include <DMAChannel.h>
+
+// Each page goes as one I2C write: START with the address, three
+// single-command control pairs setting the page and start column, the data
+// control byte, the pixels and STOP. Every entry is an LPI2C command word for
+// MTDR. U8g2 sets the SSD1306 to horizontal addressing (0x20 0x00), and these
+// page-mode commands still place the write there, as U8g2's own page updates
+// rely on. A write never runs past the end of its page, so the horizontal
+// mode's wrap to the next page is never used.
+const int PAGE_HEADER_WORDS = 8;
+const int PAGE_WORDS = PAGE_HEADER_WORDS + OLED_WIDTH + 1;
+
+// In DTCM, which DMA reads directly, so no cache maintenance is needed
+static uint16_t frameWords[OLED_PAGES * PAGE_WORDS];
+static DMAChannel oledDma;
+
+static const uint32_t LPI2C_ERRORS = LPI2C_MSR_NDF | LPI2C_MSR_ALF | LPI2C_MSR_FEF | LPI2C_MSR_PLTF;
+
+OledTransfer::OledTransfer() : address(0), sending(false), failures(0) {
+}
+
+void OledTransfer::begin(uint8_t i2cAddress) {
+  address = i2cAddress;
+
+  // 16-bit writes to MTDR carry the command and data together
+  oledDma.begin();
+  oledDma.destination(*(volatile uint16_t *)&LPI2C3_MTDR);
+  oledDma.triggerAtHardwareEvent(DMAMUX_SOURCE_LPI2C3);
+  oledDma.disableOnCompletion();
+  LPI2C3_MDER = LPI2C_MDER_TDDE;
+}
+
+bool OledTransfer::isBusy() {
+  if (!sending) {
+    return false;
+  }
+
+  // A NACK or lost arbitration stops the master with words still queued
+  if (LPI2C3_MSR & LPI2C_ERRORS) {
+    abort();
+    failures++;
+    return false;
+  }
+
+  // Done once DMA has queued every word and the last STOP has gone out
+  if (oledDma.complete() && (LPI2C3_MFSR & 0x07) == 0 && !(LPI2C3_MSR & LPI2C_MSR_MBF)) {
+    sending = false;
+  }
+  return sending;
+}
+
+// Builds the write for columns [first, first + count) of a page. Its header
+// sits just before the first column's data and its STOP just after the
+// last, so a whole page lands in the same words as in a full frame and a
+// partial one overwrites only words of that page it doesn't send.
+uint16_t *OledTransfer::buildPage(const uint8_t *buffer, int page, int first, int count) {
+  uint16_t *words = &frameWords[page * PAGE_WORDS + first];
+  words[0] = LPI2C_MTDR_CMD_START | (address << 1);
+  words[1] = 0x80;                   // Command follows, then another control byte
+  words[2] = 0xB0 | page;            // Page start
+  words[3] = 0x80;
+  words[4] = 0x10 | (first >> 4);    // Column high nibble
+  words[5] = 0x80;
+  words[6] = first & 0x0F;           // Column low nibble
+  words[7] = 0x40;                   // Display data until STOP
+
+  uint16_t *data = &words[PAGE_HEADER_WORDS];
+  const uint8_t *pixels = &buffer[page * OLED_WIDTH + first];
+  for (int x = 0; x < count; x++) {
+    data[x] = pixels[x];  // CMD 0: transmit
+  }
+  data[count] = LPI2C_MTDR_CMD_STOP;
+  return words;
+}
+
+void OledTransfer::send(const uint8_t *buffer) {
+  for (int page = 0; page < OLED_PAGES; page++) {
+    buildPage(buffer, page, 0, OLED_WIDTH);
+  }
+  start(frameWords, sizeof(frameWords));
+}
+
+void OledTransfer::sendPage(const uint8_t *buffer, int page, int firstColumn, int columns) {
+  uint16_t *words = buildPage(buffer, page, firstColumn, columns);
+  start(words, (PAGE_HEADER_WORDS + columns + 1) * sizeof(uint16_t));
+}
+
+void OledTransfer::start(uint16_t *words, unsigned int bytes) {
+  oledDma.clearComplete();
+  oledDma.sourceBuffer(words, bytes);
+  sending = true;
+  oledDma.enable();
+}
+
+void OledTransfer::abort() {
+  oledDma.disable();
+  oledDma.clearComplete();
+  LPI2C3_MCR |= LPI2C_MCR_RTF;  // Drop the rest of the frame
+  LPI2C3_MSR = LPI2C_ERRORS;
+  sending = false;
+}
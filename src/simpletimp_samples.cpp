@@ -1,9536 +0,0 @@
-#include "simpletimp_samples.h"
-
-static const uint32_t sample_0_simpletimp_timpani_g3[76032] = {
-0xffce0000,0xffb3ffb6,0x0035ffdf,0x0130009d,0x02c501f3,0x03de034e,0x048c0459,0x050104cd,
-0x048204d9,0x03770423,0x01490266,0xfdfdffe1,0xf99dfbe3,0xf3f2f6d7,0xf213f1f4,0xfdb9f61e,
-0x039c03a8,0x049701dc,0x098b092b,0x088e07a7,0x0a2c0aa4,0x09bb0918,0x095c0a30,0x0a28094e,
-0x0a730a5c,0x0ced0b9f,0x0f830dec,0x139c11b4,0x191915f8,0x1e651c0f,0x239420f3,0x284225f5,
-0x2c7b2ac7,0x2fb02e01,0x3235315a,0x34463355,0x350d34b9,0x339c356b,0x307b31bf,0x2c8a2df1,
-0x279d29b8,0x245c2587,0x1bb12007,0x166117d8,0x116b148f,0x0c300dd9,0x0cb00c62,0x09290b9c,
-0x03c805c9,0x09430537,0x12a60da8,0x1c2017dc,0x19c51b56,0x12fe1738,0x09d90eeb,0xfdfd03f4,
-0xf49ff975,0xeb91ef93,0xe5ace889,0xdf89e2e9,0xde5ade56,0xdc74dd8c,0xda51db80,0xd85dd91c,
-0xd838d828,0xd5e1d73d,0xd358d518,0xc903cf01,0xc2bac4ed,0xbaf1bfdc,0xb2f7b687,0xa9f0af20,
-0xa10fa502,0x99c69d4e,0x96ab97b0,0x96c49664,0x97f6976d,0x982d9864,0x958b9675,0x95fa960d,
-0x93009445,0x92bf92ea,0x90d691ea,0x8e848f72,0x91548f19,0x986f948e,0xa0b89ced,0xa481a2ee,
-0xaa2fa6ce,0xaf85ad17,0xb615b2a1,0xbc7ab963,0xc3d5bfd0,0xcb92c846,0xd3d6cecc,0xe00cda49,
-0xe7c1e43d,0xf032ebc6,0xf985f4a3,0x052aff2b,0x0e170a88,0x11170fce,0x156612d7,0x1c1f1872,
-0x228f1faa,0x29ea25cb,0x30ab2dd0,0x354a332b,0x35ea35f4,0x38193679,0x3bc03a3d,0x3adc3bf4,
-0x367c38cc,0x344c34a5,0x37353570,0x394c388a,0x3a1139e1,0x3ae13a1c,0x3f2f3cf0,0x42704117,
-0x453443b5,0x4cb7480a,0x5926526b,0x67176042,0x6d7f6bd9,0x692d6c55,0x613e6526,0x5e285ebb,
-0x60805ed2,0x65aa6309,0x653f66c6,0x5a7a6108,0x4914522d,0x390e4051,0x306a33c6,0x31ad2f7e,
-0x3f7e373a,0x525048e9,0x64095b50,0x73036c39,0x7bc07837,0x7dcd7da8,0x78b97c0b,0x6f0c7425,
-0x63e8699e,0x56a85d89,0x489f4f8f,0x3bea4222,0x30873636,0x25992ade,0x1b7420af,0x11ae166a,
-0x09890d37,0x03e006bb,0xfd34008f,0xf809fa7f,0xf157f526,0xe79becea,0xdb3be197,0xd035d567,
-0xc765cb5c,0xc1d1c419,0xbe6ec02f,0xbae3bc96,0xb888b995,0xb918b841,0xbb39ba29,0xbe41bc9d,
-0xc14ebfb1,0xc645c37f,0xcd21c995,0xd2abd085,0xd444d3b2,0xd4f2d4b9,0xd511d528,0xd2ced421,
-0xcfbbd162,0xcc2dcdd1,0xcb05cb42,0xccbecb61,0xd059ceaa,0xd1fad16e,0xd125d1ed,0xcf20cff4,
-0xd176cfa7,0xd84bd43d,0xe1ccdd33,0xe798e574,0xe777e851,0xe266e538,0xde37dfe0,0xde2ddd80,
-0xe2fadffb,0xec68e713,0xf8e2f298,0x02eefeba,0x06830559,0x07a60730,0x062f0758,0x050e054e,
-0x02e5046b,0x00110143,0xfc08fe80,0xf975f9e2,0xfd49faf2,0x0066ff4a,0x01c40143,0x00990182,
-0xfddeff82,0xf827fb02,0xf903f75c,0xfddbfb71,0x02db0076,0x0594047e,0x052e05f8,0x00910339,
-0xf890fcff,0xf1d2f478,0xedf9efe3,0xead9ec33,0xe947e9d2,0xea25e97a,0xeabbeabc,0xe7c7e9ca,
-0xe3f8e593,0xe1aae2d1,0xdef4e056,0xdc0edd75,0xda34daf3,0xda4ad9c4,0xdeb0dc12,0xe4aee197,
-0xeb9be819,0xf390ef4a,0xfdb2f89f,0x06640244,0x0e3d0a6d,0x13191141,0x135c13ab,0x11b9129e,
-0x108410e4,0x11b610d6,0x14e6130e,0x188c16e6,0x1af819d3,0x1d181c08,0x1f5c1e47,0x22a3208b,
-0x2a7e2615,0x34da2f6b,0x3fec3a8f,0x488b4499,0x4bbd4b24,0x49da4aff,0x477248b5,0x446a45df,
-0x414342d7,0x3e513fc2,0x3bc53cf9,0x3a053afb,0x399d398a,0x37c03967,0x330e354c,0x3009315f,
-0x2e7c2f40,0x2d772e22,0x2c152cb7,0x2b672c10,0x2c0e2bab,0x2c112c04,0x2bd22c37,0x29862b01,
-0x262827dd,0x220e2418,0x1eb72021,0x1c991d9b,0x1a791b6a,0x1891196c,0x178217b8,0x166d1751,
-0x140c156d,0x0fbc123d,0x08570c5b,0xfe5e03a5,0xf2d3f88e,0xe98fedb8,0xe2e5e618,0xdc3fdf8c,
-0xd683d936,0xd204d40d,0xcf2bd0ac,0xcb88cd7e,0xc5c6c8e9,0xbf03c27d,0xb8b7bbd0,0xb434b612,
-0xb3f8b377,0xb83eb5a0,0xbf3ebb94,0xc51bc250,0xc819c6f6,0xc975c8c5,0xca87ca4a,0xc93dca1f,
-0xc62ac7f4,0xc106c3b2,0xbcd8beb9,0xbb12bb99,0xbb87bb37,0xbf06bcf9,0xc537c1d5,0xcb0ec871,
-0xcfcacd6f,0xd3d7d1d9,0xd749d5ad,0xd975d89d,0xd944d99b,0xd7a9d88e,0xd630d6e7,0xd355d522,
-0xcf20d138,0xcbfecd66,0xcba0cb42,0xcf5acd09,0xd4bad1ce,0xda39d7ad,0xdd2bdc20,0xdc8bdd45,
-0xd9e1db5d,0xd7e5d8a8,0xd788d79a,0xd8e4d806,0xdc28da56,0xe09dde48,0xe3e0e2a5,0xe49fe48b,
-0xe336e459,0xdf75e16c,0xdc78dde8,0xd99fdaf5,0xd87cd8db,0xd732d7d4,0xd6bad6ad,0xd839d747,
-0xd9a1d901,0xda36da0c,0xda0dda26,0xd9ebd9f7,0xd962d9da,0xd76ad863,0xd599d689,0xd50cd512,
-0xd580d57b,0xd5e1d566,0xd79ed686,0xdde6da1b,0xe81ce2dc,0xf240ed3e,0xfd1ff7b4,0x075a01ff,
-0x13510d3b,0x204319c1,0x2c9c2675,0x367f3217,0x3bfe39c9,0x3efc3dd9,0x3e223ede,0x3d113d7b,
-0x3dee3d32,0x40853f1c,0x42334189,0x43f242e8,0x457f44c4,0x459845be,0x448b4513,0x41b4435c,
-0x3ef34023,0x3c413d9f,0x39de3af7,0x38b63929,0x37a73841,0x35ae36d5,0x3348349b,0x2f023169,
-0x29f42c78,0x254b2790,0x217d2331,0x212220bf,0x226321cc,0x22bc22bd,0x21db2253,0x20bf2145,
-0x1ea91fff,0x1b231cfb,0x181d1952,0x172b174a,0x19911843,0x1c1e1b13,0x1cc51ca5,0x1d161cfd,
-0x1c0e1cb0,0x1b301b8d,0x1beb1b22,0x1edc1d32,0x23e4211d,0x29f026ef,0x2f722ca5,0x33c431f7,
-0x349b34d4,0x31073333,0x2b972e50,0x26892904,0x213b23f3,0x1c731ebb,0x18e61a8f,0x165217ab,
-0x144f1534,0x14e11492,0x18a316a0,0x1f5d1c10,0x26cf2334,0x2d822a87,0x30fb2fa2,0x30e6318b,
-0x2d962f53,0x2b1f2bfd,0x294a2a53,0x25cb27af,0x224923f2,0x1ede2079,0x1c211d89,0x19361ac3,
-0x14a71707,0x0f761220,0x09400c6e,0x02dd05f2,0xfe3e0030,0xfc2afced,0xfaa6fb8b,0xf7d7f967,
-0xf446f606,0xf1dff2e3,0xf14cf14e,0xf187f176,0xf206f193,0xf44bf2ea,0xf95df67d,0x0030fcae,
-0x06070372,0x084a07af,0x064707c0,0x013903fd,0xfc17fe5b,0xfa7cfaea,0xfb79fac1,0xfd40fc6b,
-0xfdd9fdd5,0xfc78fd4c,0xfa0ffb51,0xf709f8aa,0xf239f4c3,0xed42efaa,0xe971eb2f,0xe6c4e80d,
-0xe2bee50a,0xde5ce072,0xdb50dc95,0xdb95dae8,0xe012dd64,0xe79be3a9,0xeda1eb04,0xeffaef2a,
-0xef8ff013,0xeda2ee8d,0xec31ecd8,0xea35eb6b,0xe8bfe91f,0xe8b5e8cf,0xe9f3e912,0xed55ebad,
-0xf02aeede,0xf1fcf149,0xf245f258,0xf116f1f1,0xef77f032,0xedaaee9e,0xebd7ecbc,0xea13eb05,
-0xe868e927,0xe729e7c5,0xe75ae6ce,0xebc8e92b,0xf23eeec5,0xfa84f633,0x0282fec7,0x06c90543,
-0x057106d0,0xff9402eb,0xf914fc35,0xf3bef645,0xf095f1c4,0xf010f00a,0xf1b1f09d,0xf5d4f35e,
-0xfcbcf8e5,0x069a0158,0x11cf0c2f,0x1cb21767,0x2782220e,0x32bd2d19,0x3d113840,0x4565416e,
-0x4cc64941,0x521e4fb9,0x54b453da,0x545154c7,0x5218536e,0x4e85506b,0x49c74c3b,0x444e4702,
-0x3d6a4145,0x33a338be,0x27d42dfd,0x1b8e2185,0x1100161b,0x084d0c4a,0x014f04d9,0xfab5fdc6,
-0xf4e0f7ce,0xef1bf1f5,0xeac1ecb8,0xe713e8d8,0xe3fce583,0xe030e22f,0xdbefde13,0xd8e3da17,
-0xd86dd85b,0xd829d8a0,0xd52cd70b,0xcee0d270,0xc758cafb,0xc269c472,0xc0e2c13a,0xc48bc1d1,
-0xccb5c85d,0xd5ded140,0xdcedd9c8,0xdf3fdeb1,0xdca4de8d,0xd597d98c,0xcd52d164,0xc78ac9e8,
-0xc53bc617,0xc3e0c4a7,0xc1e6c2f8,0xbf71c0a8,0xbdd5be6f,0xbda0bd81,0xbee8be29,0xc077bfc4,
-0xc141c10a,0xc086c10c,0xbf4bbff1,0xbe6ebeab,0xbf4cbe8b,0xc26cc09b,0xc745c4a4,0xcce9ca0f,
-0xd220cfa8,0xd6cad451,0xdd75d9de,0xe401e0db,0xe916e6d3,0xeba9eab3,0xeb80ebcf,0xeac2eb10,
-0xe9caea5c,0xe7e9e8e1,0xe51ae6b8,0xe0f6e33a,0xdbcbde6b,0xd670d918,0xd3d7d474,0xd6b3d4a5,
-0xddbcd9d1,0xe775e25d,0xf073ec72,0xf50bf352,0xf5e1f5ed,0xf2fdf4d1,0xef5bf10a,0xeda2ee34,
-0xee5bedaa,0xf17eefc9,0xf3bff300,0xf38af3d9,0xf0f6f2bd,0xecbeef0a,0xe7e0ea3a,0xe435e5f0,
-0xe1b0e2cb,0xe191e114,0xe45be2c6,0xe83de62e,0xebc0ea07,0xeef5ed60,0xf2c0f0b1,0xf70ff4e0,
-0xfba1f971,0xfeebfd65,0x01790067,0x02640241,0x016401f8,0xff550072,0xfe09fe6c,0xff2efe54,
-0x034b00d2,0x0a070671,0x11800dd4,0x18df1543,0x1db31be6,0x1fca1eec,0x200f2037,0x1e0f1f4a,
-0x1b911cba,0x19ad1a82,0x18e31920,0x1a081925,0x1cd81b31,0x22071f37,0x27a624c2,0x2d342a83,
-0x31e72fb0,0x34a0338f,0x358b3541,0x35843582,0x35f935a9,0x37083659,0x39413814,0x3b5d3a76,
-0x3c893c23,0x3db83d05,0x3f773e8d,0x431e40e9,0x49b5461b,0x51fe4ddb,0x58bf55b1,0x5bec5adb,
-0x5b7a5bf3,0x586c5a44,0x52fd55f5,0x4c5b4fc0,0x454448db,0x3ecb41d0,0x3a363c3c,0x37593897,
-0x34863600,0x30c032b6,0x2dae2ef3,0x2c5d2ce1,0x2bc82bf0,0x2bfd2bd0,0x2d472c65,0x30282e9f,
-0x333b31b6,0x360f34cd,0x376936fb,0x37d137b5,0x3685377d,0x32fd34ff,0x2e1630aa,0x28b62b43,
-0x248a2687,0x201d2252,0x1be31dde,0x18b51a19,0x177417be,0x186317ca,0x1a111945,0x1b951ac9,
-0x1dc11cab,0x1f6a1eca,0x200f1fee,0x1f621ff8,0x1e511eaa,0x1f331e7b,0x210f200c,0x22d521ea,
-0x24f923d8,0x26f7260f,0x274e276f,0x262f26ee,0x22aa24b8,0x1dd62071,0x18201b1c,0x12761504,
-0x0e60105a,0x0bde0cbb,0x0bee0b9c,0x0c700c58,0x0bf10c47,0x09fb0b3d,0x072a08a8,0x0362056f,
-0xfef00124,0xfa92fcc3,0xf542f814,0xef13f23d,0xe797eb7d,0xdf3ee37f,0xd81adb49,0xd4a0d5f3,
-0xd334d3c9,0xd242d2d5,0xceffd0f9,0xc913cc4c,0xc14ec56a,0xb915bd20,0xb15fb522,0xaafcadf4,
-0xa621a87b,0xa1dfa3d2,0x9f61a091,0x9d089e41,0x9b8e9c27,0x9aa89b2a,0x998c9a30,0x9902992b,
-0x99e69949,0x9c849af7,0xa05f9e58,0xa48ba26c,0xa9a4a6f5,0xafb4ac91,0xb6e8b330,0xbe85baae,
-0xc69fc262,0xd000cb21,0xdab7d520,0xe6f5e0a8,0xf35ced44,0xfe16f91a,0x0557024d,0x09070788,
-0x09ee09d1,0x08fb098c,0x08390892,0x08530825,0x08d6089b,0x09e8095b,0x0b2c0a91,0x0ce10c01,
-0x0e370da3,0x0e900e91,0x0cc70df6,0x08760ae3,0x023c058c,0xfbd5fee5,0xf725f937,0xf3fdf56d,
-0xf0eef287,0xed90ef36,0xeb7aec4d,0xeb04eafe,0xec57eb7c,0xef29ed93,0xf1ddf0c0,0xf254f25a,
-0xf1ddf21f,0xf176f19c,0xf159f14a,0xf226f197,0xf3f8f2f5,0xf67af534,0xf8d7f7e0,0xf8a6f917,
-0xf624f7c0,0xf0d9f3bb,0xeaecedd6,0xe579e82e,0xe0d8e2d1,0xdf7edfb9,0xe07bdfc9,0xe343e1aa,
-0xe686e4fa,0xe7f6e796,0xe705e7a8,0xe61de66c,0xe730e655,0xeae9e8d7,0xeefeed05,0xf247f0d9,
-0xf3a6f336,0xf35df38e,0xf25df303,0xf0baf19a,0xeefcefd1,0xee0eee78,0xeea6ee14,0xf088ef7f,
-0xf2d2f1ca,0xf322f333,0xf157f267,0xeffef070,0xef92efd3,0xef52ef52,0xf05befa5,0xf1b5f10f,
-0xf3d0f2a1,0xf760f55a,0xfdd9fa31,0x07b90279,0x12e40d4b,0x1d181852,0x23ee2121,0x24ea2511,
-0x222923f7,0x1d461fc7,0x18a01ace,0x144f1664,0x10de127d,0x0ea60fb7,0x0cb50da9,0x0bc90c1c,
-0x0c330bd1,0x0dc70ccd,0x0ff80ee2,0x113710b6,0x1053111e,0x0c730ece,0x05060905,0xfd1b00e2,
-0xf6f0f9bf,0xf327f49c,0xf313f2a4,0xf637f444,0xfd06f93a,0x05df0150,0x0f010a7d,0x162b1316,
-0x18be1825,0x1687181a,0x117e144a,0x0aee0e47,0x04620789,0xfef5018f,0xfb84fcd5,0xfb4efaf3,
-0xfe65fc7c,0x041800e9,0x0a8e0768,0x10b80dc6,0x1531133e,0x176b1691,0x178017ca,0x153c16a4,
-0x10c7133d,0x0a8d0de8,0x02da06cd,0xfbdeff25,0xf68df8fb,0xf28bf466,0xef6cf0d8,0xed11ee3c,
-0xeb62ec0a,0xeb1eeb12,0xec6ceb81,0xef43edb1,0xf2fdf11c,0xf6e2f507,0xf997f873,0xfae2fa6c,
-0xfb1dfb13,0xfaa5fb02,0xf9adfa24,0xf8e5f934,0xf97bf8f3,0xfc89fa9e,0x0275ff34,0x0a510640,
-0x11950e1e,0x172e14a5,0x1ad11944,0x1cfe1bf3,0x20021e44,0x24822226,0x291d26d8,0x2d862b52,
-0x32802fe4,0x39033585,0x40393cbf,0x46d74388,0x4d4a4a20,0x532d5041,0x58fb560d,0x5e045bb7,
-0x60055f74,0x5e815fbc,0x59ab5c76,0x51b25612,0x478e4cb6,0x3d7a426c,0x35c63926,0x31b6334b,
-0x30ec30fa,0x31e73146,0x31fa3237,0x30133136,0x2c252e63,0x275e29bd,0x23132523,0x203e216a,
-0x1f541fb5,0x1e811ef2,0x1cc11dc7,0x192e1b3d,0x144616c3,0x1059120e,0x0f3d0f61,0x11200fcf,
-0x14fe1303,0x17b016ad,0x17c51811,0x161116fc,0x14711525,0x14cb1454,0x16001561,0x16441651,
-0x13ab1577,0x0dca1116,0x05a109e3,0xfd91018c,0xf5cbf9aa,0xee15f1db,0xe76cea9d,0xe24fe494,
-0xe046e0cf,0xe23de0d4,0xe682e436,0xeb15e8d3,0xef72ed47,0xf3cbf19a,0xf805f607,0xfb10f9d6,
-0xfa62fb56,0xf4edf83d,0xeb88f092,0xe195e65b,0xda66dd5d,0xd955d902,0xde95db4d,0xe800e2f7,
-0xf27ded58,0xfaf8f721,0x006afe14,0x0337022b,0x03550385,0x02bd02f3,0x02a90295,0x02b202a5,
-0x02ca02c2,0x02c802d1,0x02100287,0x003a0145,0xfd22fedf,0xf839fae8,0xf1a0f53e,0xe939ed88,
-0xe005e4cc,0xd5f2db13,0xcc45d0f5,0xc434c804,0xbdf5c0da,0xb9bbbb8d,0xb845b8a9,0xb92bb872,
-0xbb90ba3f,0xbd6abcbd,0xbc7ebd56,0xb90cbafc,0xb46ab6ba,0xb116b26a,0xb0a0b068,0xb47bb1ff,
-0xbc0db7f0,0xc430c046,0xca2ec788,0xcd60cc11,0xceb0ce21,0xcebdced8,0xce5dce88,0xce01ce38,
-0xcdc6cdcc,0xce73ce03,0xd035cf2b,0xd36cd1a8,0xd7b6d573,0xdc0eda02,0xdefeddca,0xe039dfbc,
-0xe086e07b,0xe052e069,0xe10de07c,0xe256e1a9,0xe3afe303,0xe4dfe463,0xe4d9e50b,0xe308e41f,
-0xe11ae1f4,0xe0fae0c1,0xe315e1bc,0xe867e556,0xef28ebd9,0xf4fef242,0xf8f1f74c,0xfa06f9cd,
-0xf96bf9d8,0xf8c6f8f5,0xf9bdf90b,0xfbf8fab3,0x000bfdbf,0x05b702b7,0x0b8a08bf,0x10c60e36,
-0x15841344,0x195c1785,0x1ba01ab2,0x1ba31bd7,0x19e61aeb,0x176118ae,0x14b41611,0x12f413a4,
-0x122c1287,0x123f120f,0x136012b8,0x147613f6,0x149614ab,0x14211462,0x131213bd,0x10c61200,
-0x0e0e0f75,0x0ad30c85,0x06b608e7,0x02230464,0xfe420028,0xfa6bfc5e,0xf635f876,0xf0a4f382,
-0xeadeedc7,0xe5f6e820,0xe395e47c,0xe31be31c,0xe464e393,0xe6d2e57e,0xeabae88d,0xefd6ed40,
-0xf542f279,0xfb7bf84b,0x015afe84,0x06cc0418,0x0ae00931,0x0ca00bea,0x0d380d0e,0x0cc60d15,
-0x0c2f0c86,0x0c7e0c08,0x0f190d8a,0x13e6113e,0x1a5b16f4,0x20ba1db2,0x25902362,0x28172719,
-0x28c428aa,0x28292898,0x278927c8,0x27d0278a,0x2940286d,0x2bf82a85,0x2f3d2d90,0x328030e5,
-0x364a344a,0x3a403840,0x3d903c11,0x3fa53eac,0x41624093,0x42554200,0x42a7429b,0x41af4268,
-0x3f68409c,0x3c6b3dfa,0x39093aae,0x359e375d,0x323d33eb,0x2eff3090,0x2c212d87,0x29c02adc,
-0x273f2884,0x242e25d5,0x2147229c,0x1f452036,0x1d671e5f,0x1a4b1c03,0x15521819,0x0ecb122d,
-0x07e30b5e,0x00fb0465,0xfb31fddc,0xf6f1f8e3,0xf374f534,0xf034f1c8,0xed2eeeba,0xea41eba1,
-0xe807e910,0xe6ede73f,0xe80be71c,0xec01e9b2,0xf1d7eeac,0xf8d5f550,0xffa3fc44,0x05fa02fd,
-0x0a490878,0x0cde0bcc,0x0e650dbe,0x0fd10f01,0x1318111c,0x18cd15b8,0x1fbc1c3e,0x2634231a,
-0x2adc28c5,0x2da92c77,0x2e902e4e,0x2d702e53,0x29ba2be2,0x24042719,0x1cf32096,0x158c193a,
-0x0e3111e0,0x07110a8e,0x00b203b7,0xfbc6fdf7,0xf9b3fa46,0xfb21f9e0,0x0028fd5d,0x06930344,
-0x0c7c09bc,0x109b0ecb,0x12ff1202,0x13f013a2,0x14c6144d,0x15a71542,0x16c61616,0x181f177c,
-0x18951882,0x17b11851,0x158c16b7,0x1358146b,0x1176124f,0x102010cc,0x0e780f5d,0x0c780d84,
-0x09ef0b4b,0x06350831,0x01e0041f,0xfcfcff83,0xf7d3fa49,0xf41df5d5,0xf23af2e9,0xf1faf1f6,
-0xf346f25e,0xf610f495,0xf81bf745,0xf840f878,0xf69df78e,0xf3e4f55d,0xf140f278,0xef93f042,
-0xef42ef3e,0xf002ef8a,0xf147f0ad,0xf1cef1b6,0xf1fdf1ec,0xf1d0f1fa,0xf018f137,0xebaaee39,
-0xe4c6e87c,0xdbb9e085,0xd1cbd6bd,0xc8e1cd20,0xc247c533,0xbea9c023,0xbddabde8,0xbe82be30,
-0xbec1beab,0xbf3dbee6,0xc041bfba,0xc195c0e8,0xc31cc25d,0xc438c3bf,0xc478c472,0xc3e1c433,
-0xc35dc384,0xc3eac384,0xc553c474,0xc839c684,0xcd8aca88,0xd4f3d0ff,0xdd94d926,0xe62ce1e5,
-0xeddfea3b,0xf2f9f0ca,0xf575f476,0xf675f623,0xf5f4f65a,0xf50bf589,0xf355f45d,0xf00ff1e3,
-0xebc3ee0f,0xe641e921,0xe0ace366,0xdca9de5f,0xda87db5c,0xd9d4da05,0xd95fd998,0xd891d916,
-0xd6ead7d3,0xd47bd5d3,0xd1cfd320,0xd052d0d1,0xd13fd06c,0xd501d2e4,0xdab7d797,0xe18fde22,
-0xe768e4bc,0xeb78e9b1,0xeda0ecd0,0xeea3ee28,0xef47eefc,0xf036efb2,0xf1e5f0ef,0xf4dbf335,
-0xf873f69f,0xfb38f9ed,0xfd6cfc59,0xff58fe5e,0x01390052,0x02f60227,0x04160397,0x04470463,
-0x02c303c1,0xff54013e,0xfa41fcef,0xf4d2f778,0xefebf250,0xeb70eda2,0xe7efe97a,0xe64ae6df,
-0xe64ae623,0xe74be6ae,0xe8c5e801,0xea37e97a,0xec53eb23,0xeea2ed87,0xf078efa8,0xf1eff139,
-0xf376f299,0xf5c9f4a2,0xf82ff6fd,0xfa5df954,0xfc55fb68,0xfe2dfd3f,0xffbcff1c,0xffef0009,
-0xff86ffd0,0xff5dff65,0xffcfff84,0x014e0064,0x03c3026f,0x07260550,0x0b14091d,0x0f1e0d1a,
-0x12c51112,0x14c613ff,0x15391510,0x15dd1573,0x17e3169f,0x1b99199f,0x1fb81db4,0x22f7218a,
-0x24df240c,0x25a82562,0x25b325bb,0x25412575,0x25e02553,0x289026f2,0x2d772ad3,0x33a2305d,
-0x3a0c36fc,0x3ed33cb8,0x40c74042,0x3fa940a1,0x3bff3e21,0x375739af,0x32d73506,0x2f1630d4,
-0x2c432d89,0x2a3a2b1d,0x29692991,0x29432956,0x28bf290e,0x27762831,0x259e2698,0x23ac24c2,
-0x217d22a3,0x1f19205b,0x1cf61df5,0x1b201c03,0x19c91a5c,0x195b197c,0x18cc1911,0x17f81867,
-0x17761796,0x17bd1798,0x180717e0,0x1822181e,0x17aa1814,0x162c170e,0x1453153b,0x136a13ac,
-0x13a21362,0x153a142f,0x1855169b,0x1d101a71,0x24062048,0x2c072808,0x331c2fd4,0x376b35a6,
-0x38973862,0x36e9380f,0x3381356a,0x2e66313f,0x26ec2b0a,0x1cf92234,0x12011776,0x07a50cb6,
-0xff1f0309,0xfa2ffc1f,0xf928f941,0xfaf5f9c7,0xfdddfc63,0x00efff6a,0x04e402c4,0x090806fc,
-0x0c3c0ac8,0x0d670d18,0x0c870d1a,0x0a550b85,0x07f70908,0x064f06fd,0x06700614,0x0889074c,
-0x0b4f09ea,0x0d8b0c8e,0x0da20ddf,0x0b570cca,0x071f0958,0x016f046d,0xfb1bfe3f,0xf576f82f,
-0xf0a3f2f6,0xed21eeb7,0xeb4bec0a,0xea97ead2,0xeabdea99,0xeb15eaec,0xebb4eb4a,0xed97ec71,
-0xf109ef27,0xf53df315,0xf9a9f784,0xfd5afb9d,0xffdafeca,0x00470053,0xfe73ff95,0xfbc0fd1c,
-0xf8f8fa54,0xf6e4f7cc,0xf5bff63c,0xf529f575,0xf412f4c8,0xf1fcf330,0xee7bf06e,0xea4dec4c,
-0xe748e884,0xe688e692,0xe7f6e71d,0xe997e8cf,0xeb2fea67,0xed18ec17,0xef4aee2d,0xf1b1f066,
-0xf46cf303,0xf6eef5bc,0xf94ef826,0xfb7afa7c,0xfdbbfc91,0x00c1ff21,0x0456027b,0x0809063e,
-0x0b00098c,0x0d260c28,0x0e680de8,0x0e750ea4,0x0d110df4,0x0a570be7,0x05b80852,0xfecf027c,
-0xf6b7fad5,0xeea2f2a1,0xe73aeace,0xe114e3f8,0xdca1dea3,0xd96ddae0,0xd7a1d860,0xd676d6ff,
-0xd619d62e,0xd6a9d655,0xd800d727,0xda98d932,0xdde5dc38,0xe0fddf8c,0xe33ee236,0xe546e422,
-0xe825e69b,0xebd6e9ed,0xefffeddc,0xf3e9f20b,0xf62bf54d,0xf63af67c,0xf42bf584,0xefdef23f,
-0xea11ed16,0xe3f4e70e,0xddd3e0e1,0xd828dae3,0xd3f3d5d3,0xd1abd298,0xd163d147,0xd2bad1e1,
-0xd562d3d9,0xda15d77f,0xe003dd09,0xe640e30e,0xebe6e94f,0xef2fede5,0xf05befff,0xefa1f02b,
-0xeeaaef0a,0xefb4eed0,0xf363f14a,0xf7daf598,0xfba8f9ea,0xfdbdfd01,0xfd6ffde0,0xfb15fc6c,
-0xf840f9a9,0xf60bf6fb,0xf5baf5a5,0xf6faf63b,0xf7c7f792,0xf65ff75b,0xf2a4f4cf,0xeccfefef,
-0xe5a5e954,0xde2ee1e6,0xd7d9dac6,0xd3d4d586,0xd210d2b7,0xd16cd19e,0xd1dad181,0xd338d27b,
-0xd57bd42b,0xd934d736,0xddfbdb76,0xe371e0a9,0xe93ee64e,0xef5aec35,0xf5d8f28f,0xfcaff940,
-0x0322000a,0x083505dc,0x0b990a22,0x0d530c9d,0x0e080dc5,0x0dce0e11,0x0c7a0d3e,0x0a7d0b8f,
-0x08170954,0x054606b6,0x021e03b7,0xff250097,0xfca6fdd5,0xfa70fb96,0xf790f92a,0xf3f5f5b6,
-0xf104f254,0xf03bf040,0xf281f0ff,0xf73bf4a6,0xfd18fa20,0x027effea,0x069304b3,0x09b30845,
-0x0beb0aef,0x0dc40cd2,0x0fd90eb6,0x120e10ee,0x14171311,0x15ff151b,0x17a416ca,0x1964188c,
-0x1b451a51,0x1e011c80,0x21661fa1,0x25d5237c,0x2a56282b,0x2de42c3a,0x30052f47,0x2f362ff5,
-0x2ba02dbb,0x253628c5,0x1d992157,0x17ed1a64,0x15441637,0x15b61510,0x18d21718,0x1cfc1ac9,
-0x20f01f22,0x232f2248,0x23d123b3,0x235223ac,0x223822e2,0x20852168,0x1ee21fb2,0x1e1c1e4b,
-0x1ec91e45,0x20db1fa0,0x245e226b,0x28682664,0x2cc62a85,0x31ec2f3d,0x372a349c,0x3b093953,
-0x3ce73c49,0x3c4a3ce5,0x399e3b1f,0x35bf37d0,0x30f3336f,0x2be22e5e,0x2798298c,0x25012615,
-0x2463248d,0x24d92482,0x25aa2542,0x25ff25eb,0x259125e0,0x244a24f3,0x23e123dc,0x24de2439,
-0x270a25e0,0x28fe282a,0x29862971,0x28ca294d,0x2769281f,0x25b226a6,0x2332248a,0x207e21e4,
-0x1d871f02,0x1ad51c1e,0x187819aa,0x1671176e,0x14bf1594,0x13c8141b,0x141e13c7,0x154814b3,
-0x162615c5,0x169d1675,0x166d16a0,0x157d15fc,0x144614ea,0x12d6139e,0x10db11eb,0x0dd90f7b,
-0x09e70bfb,0x04a10771,0xff4901d7,0xfb02fd0d,0xf76bf917,0xf502f603,0xf40bf464,0xf3f9f3e9,
-0xf3e3f3e9,0xf2a3f381,0xef27f129,0xea15ecc7,0xe483e747,0xe01ae214,0xdd37de81,0xdbafdc5d,
-0xda68db0a,0xd94cd9dd,0xd7f1d8b1,0xd611d70a,0xd414d502,0xd2c6d347,0xd2dad295,0xd40fd35d,
-0xd5f8d4f0,0xd866d723,0xdb06d9b2,0xdde8dc75,0xe08ddf62,0xe24de183,0xe3c4e31e,0xe3f9e410,
-0xe331e3a7,0xe181e27f,0xde95e027,0xdb82dcfa,0xd889d9fc,0xd65ed74d,0xd546d5bc,0xd505d511,
-0xd52ed515,0xd561d542,0xd54bd56d,0xd4eed51e,0xd4abd4ba,0xd4a9d49d,0xd53dd4db,0xd65ed5d8,
-0xd702d6d0,0xd6c2d708,0xd5c4d64f,0xd49dd52a,0xd3bbd422,0xd38ad38f,0xd3bfd38d,0xd466d40e,
-0xd4c5d4aa,0xd47ed4c1,0xd38ed414,0xd23cd2e2,0xd1a0d1bf,0xd292d1ee,0xd56fd3ba,0xda97d7c1,
-0xe187ddda,0xe962e567,0xf133ed51,0xf874f4f3,0xfd99fb5a,0x00a6ff5c,0x01de017f,0x018501d7,
-0x01280145,0x01e1014d,0x03f602bf,0x06740540,0x08300781,0x087f0874,0x08590866,0x0829082c,
-0x08780838,0x093908d5,0x099e0989,0x090b0986,0x07240843,0x03bd05a6,0xfe920166,0xf7a9fb55,
-0xefc1f3ba,0xe746eb9a,0xdefde2f9,0xd914dba4,0xd6b2d782,0xd791d6c1,0xdb60d92c,0xe0a1ddfc,
-0xe56be33e,0xe809e705,0xe8b3e89b,0xe78be84f,0xe5cde6af,0xe400e4cd,0xe3b7e399,0xe552e45c,
-0xe81be699,0xec1ce9f6,0xf0c1ee58,0xf5bdf33a,0xfa71f833,0xff07fcad,0x043a018d,0x0a190705,
-0x10dd0d67,0x17f51468,0x1e471b4d,0x22b120b8,0x2549243a,0x264025f1,0x26b12678,0x271326df,
-0x274a2734,0x27a22778,0x27f027d0,0x27d627f5,0x26e52778,0x2541262c,0x23032433,0x206421be,
-0x1db91f1a,0x1b451c61,0x19a01a64,0x188e18f2,0x18a81872,0x1a24192d,0x1ce31b52,0x211c1ebc,
-0x264223b3,0x2a172870,0x2b5c2b12,0x2a3a2b12,0x273928eb,0x22b22515,0x1d762024,0x17ec1aab,
-0x12bd1542,0x0dee1060,0x08d70b60,0x048d0687,0x01d702f9,0x00860109,0x006c0049,0x019300f2,
-0x02b00234,0x0363030e,0x03780395,0x0279030e,0x010a01bf,0x002c0084,0xfff6ffec,0x00c50039,
-0x0265017c,0x048c036c,0x066f05a3,0x06e106cc,0x05f70697,0x03b50501,0x00a80242,0xfd20feed,
-0xfa0ffb7f,0xf79cf8b5,0xf5ebf6a8,0xf4e8f556,0xf415f480,0xf391f3b9,0xf440f3c5,0xf64bf521,
-0xf938f7b0,0xfca0faee,0xffb3fe31,0x027e011f,0x05790402,0x08820703,0x0ba10a09,0x0eb80d3b,
-0x11eb103e,0x150d139d,0x16ac1607,0x177c1732,0x17631790,0x167b16fe,0x15e31608,0x16a51607,
-0x19a717c8,0x1f5b1c37,0x264822c7,0x2c302987,0x2f9e2e50,0x3001302e,0x2d552f0f,0x283f2b0b,
-0x21c72516,0x1b721e7d,0x173518fe,0x153b15f0,0x151814f8,0x16571593,0x187d1763,0x1aea19af,
-0x1cd01bf7,0x1dd11d59,0x1eac1e49,0x1eef1eda,0x1e351eb8,0x1c221d57,0x18941a8f,0x13b3163b,
-0x0e201102,0x07b10b0a,0x00d90443,0xfa5efd93,0xf51ef77c,0xf27cf37f,0xf269f22b,0xf414f318,
-0xf6d6f55a,0xfa73f8a5,0xfdd6fc35,0x006eff4a,0x01fb015a,0x027f025e,0x02930290,0x02e102b1,
-0x03990321,0x04fe0440,0x06c205dd,0x086007a4,0x091908de,0x08f6091a,0x084b08a7,0x07e00801,
-0x07ea07db,0x082d0807,0x0871084b,0x091e08b7,0x09ec097f,0x0ad60a5d,0x0bb60b41,0x0ba20bce,
-0x0a890b3a,0x07f2097a,0x035605dd,0xfd3f0066,0xf6fcfa0d,0xf1f8f442,0xeef5f034,0xedeeee35,
-0xee38edfc,0xeeabee77,0xeec0eecf,0xede7ee70,0xecaced46,0xeb12ebf2,0xe942ea2f,0xe7c0e872,
-0xe6c1e729,0xe638e66a,0xe67de640,0xe7bce701,0xea28e8ba,0xed73ebd0,0xf0fbef27,0xf491f2d2,
-0xf795f620,0xf98ef8bd,0xf9f3f9ed,0xf97df9cd,0xf8ccf91d,0xf7f4f861,0xf742f79e,0xf671f6e6,
-0xf55af5f3,0xf3a7f4a2,0xf11bf280,0xedc3ef88,0xe9d4ebd9,0xe5a2e7b0,0xe1f8e3b2,0xdeffe059,
-0xdd09dddc,0xdb86dc37,0xd970da80,0xd76ad861,0xd537d661,0xd279d3e8,0xcf3ed0f2,0xcb6dcd63,
-0xc770c969,0xc3fcc5a1,0xc1cbc2af,0xc12fc154,0xc1a6c147,0xc30cc247,0xc45ec3c4,0xc594c4f6,
-0xc63bc609,0xc609c636,0xc54dc5bb,0xc4ccc4e3,0xc591c510,0xc742c63f,0xca5ec898,0xcf3ecc93,
-0xd57dd23e,0xdc7ad8f4,0xe3bfe01f,0xeabde74f,0xf0d8edef,0xf5ecf37d,0xf9cef818,0xfc7bfb47,
-0xfe2afd7b,0xfe58fe63,0xfd9efe15,0xfc05fce0,0xfa96fb36,0xfa1ffa44,0xfac7fa50,0xfc10fb5a,
-0xfdf5fcfb,0x0011fefb,0x01e70102,0x033e029c,0x047003cb,0x05e8052a,0x06e90683,0x06fa070c,
-0x05e20697,0x038904e6,0xffe101cf,0xfc05fde9,0xf932fa65,0xf82ef874,0xf8b9f845,0xfa53f972,
-0xfc5cfb54,0xfec1fd75,0x02100045,0x068d042d,0x0b9a0904,0x10780e24,0x14511293,0x16ba15c3,
-0x17381738,0x161016d5,0x133a14de,0x0efc112f,0x0a930cb0,0x070f08a7,0x054d05e2,0x05ae053a,
-0x07900682,0x09c608b6,0x0b520aaa,0x0bc30bab,0x0b130b8f,0x09a50a73,0x081f08db,0x06b90761,
-0x05c8062a,0x05ad059c,0x067f05f6,0x07bc070d,0x09760892,0x0b740a75,0x0d800c80,0x0f470e76,
-0x10730ff7,0x114610db,0x12a311d3,0x155c13d5,0x19be175b,0x1f411c67,0x25372238,0x2ae82814,
-0x2ffe2d80,0x347f3244,0x3865368a,0x3b4a39fb,0x3d003c4e,0x3da53d75,0x3d923db9,0x3ca03d2f,
-0x3ad43be5,0x378a3974,0x328e3538,0x2ce02fae,0x27ae2a2c,0x240e259e,0x22fa2327,0x2440235d,
-0x26782550,0x28772783,0x2963290a,0x293f2970,0x287928f4,0x272827e4,0x25ab2660,0x242b24f3,
-0x225a2355,0x2043214d,0x1df91f24,0x1ba71cca,0x19461a7d,0x16c217f9,0x14571585,0x12351344,
-0x10951152,0x0f6c1006,0x0e130ecd,0x0c840d5f,0x0a6b0b7f,0x082d094e,0x05bd06fd,0x036f048c,
-0x011e0245,0xfe60ffd7,0xfacbfcaa,0xf70bf8e5,0xf3b4f53f,0xf139f256,0xefd2f065,0xef5eef7d,
-0xef60ef5c,0xef9aef69,0xf046eff0,0xf0def08a,0xf1d2f155,0xf2e4f25f,0xf3b6f36d,0xf37ef3b3,
-0xf31df345,0xf2f5f2fc,0xf3aef333,0xf4faf450,0xf66cf5b0,0xf82af73f,0xfa1ff912,0xfcbafb63,
-0xffa4fe29,0x02900115,0x05f20420,0x0a1107ec,0x0e850c48,0x12801098,0x16061453,0x194a17b4,
-0x1c241acb,0x1e4d1d56,0x1fd21f1c,0x215d2098,0x228921fe,0x231522e3,0x22c02303,0x21ae2247,
-0x201620f5,0x1dfb1f12,0x1b3a1cbe,0x171c194c,0x11fd14a4,0x0c070f16,0x05bd08e0,0xff6b029a,
-0xf8defc25,0xf228f58d,0xeaecee95,0xe383e747,0xdbcadfb1,0xd4bbd817,0xcf22d1c4,0xcaecccdc,
-0xc806c95a,0xc5fec6d5,0xc4c9c558,0xc397c432,0xc29cc30c,0xc258c24c,0xc391c2c7,0xc575c475,
-0xc7c6c691,0xca63c906,0xcd52cbd9,0xd004ceb2,0xd28ed14e,0xd4c7d3b4,0xd6aad5b7,0xd836d78d,
-0xd918d8c4,0xd935d92f,0xd93bd939,0xd9c5d973,0xdaa2da2d,0xdbffdb40,0xddcfdcd3,0xe048def3,
-0xe373e1c5,0xe756e548,0xebbee97b,0xf026edf0,0xf3fcf230,0xf6a6f57f,0xf776f74c,0xf6aef73d,
-0xf471f5c0,0xf130f2cd,0xedeaef7b,0xeb02ec6d,0xe8c5e9c2,0xe7f5e832,0xe8a9e82c,0xeaaee977,
-0xee0cec2f,0xf248f01c,0xf60bf44b,0xf88ff78f,0xf92ef91b,0xf8dcf917,0xf8a1f89a,0xf959f8d1,
-0xfbc6fa57,0xff86fd8e,0x03c00199,0x079b05c1,0x0a9d0937,0x0d3d0bef,0x0fbd0e77,0x12721114,
-0x152d13d3,0x176e1663,0x18e4183c,0x19901955,0x198a19ab,0x18ac1939,0x16d617dd,0x13f11582,
-0x0ffe1218,0x0b5d0dbe,0x06b508fb,0x02980491,0xff8e00e7,0xfdeafe8d,0xfd59fd97,0xfc9afd12,
-0xfaccfbe0,0xf77af94f,0xf2c2f549,0xed90f024,0xe8cceb27,0xe447e679,0xe039e228,0xdcdfde72,
-0xda6ddb87,0xd915d995,0xd988d911,0xdbdeda76,0xe01dddc2,0xe5cbe2d8,0xec4ae900,0xf2a2ef95,
-0xf79df552,0xfaa3f965,0xfbc6fb64,0xfbf2fbe3,0xfc2ffbf8,0xfd64fc99,0xffbefe6a,0x03270155,
-0x06ee050d,0x0aa008c2,0x0e510c8e,0x11190fe0,0x12d31216,0x1369133f,0x12fb134b,0x122a1291,
-0x115a11bd,0x10e11107,0x112010df,0x122d1195,0x136f12e1,0x13b513bb,0x13111372,0x11ca1291,
-0x0f9010c0,0x0d5f0e6d,0x0bac0c73,0x0ae00b26,0x0b160af0,0x0c3c0b83,0x0e040d17,0x0fdd0eea,
-0x11d310dc,0x13b312c3,0x15781491,0x172a165a,0x188117eb,0x18e118d1,0x185a18ae,0x178b17ed,
-0x17411750,0x17b21769,0x18a31827,0x19d31936,0x1b171a78,0x1c501bad,0x1d551cd1,0x1e981df6,
-0x1fb71f32,0x205e201d,0x204e206d,0x1fae2005,0x1e521f19,0x1c141d45,0x18e31a98,0x151c1703,
-0x11651336,0x0e310fb6,0x0bd90cdf,0x0a670afe,0x09eb0a12,0x0a1709f0,0x0aa10a5b,0x0aca0ac6,
-0x0a340a9f,0x088c098e,0x05a8073f,0x024a03f0,0xff9000d4,0xfdd4fe8c,0xfcebfd51,0xfc29fc8b,
-0xfba5fbe2,0xfb34fb6a,0xfb23fb12,0xfbccfb60,0xfd84fc80,0x0024feba,0x033701a2,0x06e104fd,
-0x0b1a08f4,0x0f480d3c,0x13001137,0x15e41488,0x18271719,0x1a40193b,0x1c671b5b,0x1df11d3f,
-0x1e6c1e5b,0x1daa1e27,0x1be21cdd,0x19271a96,0x1608179a,0x12d3146b,0x10591178,0x0ea30f65,
-0x0d670dfa,0x0ccb0cfd,0x0cb00cb5,0x0cc50cba,0x0ca90cd2,0x0b650c31,0x08800a1e,0x04650694,
-0xff9d0207,0xfb23fd40,0xf7eff960,0xf64af6e5,0xf657f61f,0xf788f6da,0xf95df85a,0xfbc3fa80,
-0xfe83fd18,0x01900009,0x04b60325,0x07c0064d,0x0a8c0937,0x0cd90bd1,0x0e6e0dc1,0x0f310ee6,
-0x0f2d0f4d,0x0e290eca,0x0bf80d3c,0x08d20a74,0x05af0737,0x0281040c,0x00030124,0xfe09ff06,
-0xfbfafd05,0xfa20fb0d,0xf7fef926,0xf517f69e,0xf1c0f37b,0xee58effa,0xeb99ecdd,0xe97dea72,
-0xe7d4e8ae,0xe5f4e6ec,0xe396e4df,0xe0e6e241,0xdea4dfa5,0xdd8bddf8,0xdda7dd76,0xdeacde17,
-0xdfcddf36,0xe0e4e055,0xe247e17d,0xe434e32c,0xe6b6e559,0xe9f1e846,0xed18eb9b,0xef11ee55,
-0xeef2ef41,0xed11ee27,0xea83ebce,0xe886e963,0xe842e828,0xe98ee8cd,0xebb9ea96,0xee8eed17,
-0xf14ff001,0xf2f8f25f,0xf353f34e,0xf2f7f331,0xf225f29e,0xf0e0f18c,0xef2df015,0xed63ee3d,
-0xebd0ec87,0xeb7feb77,0xec46ebbf,0xee0aed15,0xf021ef24,0xf1bbf0f9,0xf286f241,0xf23cf278,
-0xf198f1ee,0xf0eaf148,0xf027f08c,0xefafefe6,0xef3cef82,0xee6beedb,0xed85ee04,0xec34ecf5,
-0xea41eb54,0xe7f0e927,0xe59ce6c6,0xe353e46c,0xe19be267,0xe0dde121,0xe11be0e3,0xe1f0e17b,
-0xe2e1e26e,0xe3bde34e,0xe3fce3eb,0xe3ace3e1,0xe349e379,0xe307e319,0xe34ce312,0xe449e3be,
-0xe5a1e4f1,0xe751e66c,0xe927e834,0xeae2ea04,0xecceebc5,0xef33ede8,0xf266f0b0,0xf69ef45b,
-0xfbbef925,0x00a3fe4a,0x04b202c8,0x07900651,0x08a40857,0x08520898,0x075c07e8,0x062506be,
-0x059105c1,0x05cd0596,0x066a060f,0x074406ca,0x08b407e1,0x0af209b4,0x0db40c52,0x101f0f08,
-0x11a61107,0x120011f7,0x110a11ae,0x0f141030,0x0c9a0de9,0x0a3a0b5c,0x084c092e,0x07180798,
-0x06ec06e4,0x07780723,0x08b00806,0x0a51097c,0x0c0e0b35,0x0ce00c9d,0x0c850cde,0x0a990bc6,
-0x06fa08f8,0x023a04b4,0xfd00ff9d,0xf80bfa5f,0xf499f615,0xf30ff396,0xf3cef321,0xf669f4e6,
-0xfa34f838,0xfe55fc40,0x021d004b,0x054e03ca,0x07e206ac,0x09f30907,0x0b3f0ab7,0x0bdb0b97,
-0x0c300c0f,0x0c730c4c,0x0d270cb5,0x0e7c0db9,0x10180f49,0x11cc10ec,0x13be12ba,0x15d314cf,
-0x179c16cb,0x19001859,0x19dd197a,0x1a601a25,0x1b041aa8,0x1c1d1b89,0x1d431cb3,0x1e1c1dba,
-0x1e321e44,0x1d621df0,0x1bd51c9c,0x1a671b0a,0x19da19f7,0x1ace1a0c,0x1d7c1bf2,0x216e1f50,
-0x267723c9,0x2c072936,0x31752ed3,0x35f633ef,0x38ae37a3,0x38da3920,0x36b4380f,0x32cb34f3,
-0x2dae304e,0x28732b0a,0x235f25e2,0x1eb220f5,0x1a2b1c6b,0x15cd17f8,0x11a013b1,0x0dbc0f9e,
-0x0a280be8,0x06d80879,0x03d30553,0x015f028d,0xff750062,0xfeb4fef3,0xfeecfeb0,0x0036ff6c,
-0x02d00154,0x06ac0496,0x0bb60903,0x116f0e8f,0x16eb142f,0x1be41967,0x20241e25,0x233a21cd,
-0x251d2458,0x25b2259b,0x24ce2576,0x21fb23a4,0x1d9f1ff8,0x18601b11,0x130215aa,0x0e17107b,
-0x098f0bca,0x04e30742,0xffd00268,0xfa84fd2f,0xf52af7d6,0xf024f299,0xebf7ede5,0xe924ea63,
-0xe781e82a,0xe729e72d,0xe7f7e770,0xe996e8ae,0xeb7cea8f,0xed2cec54,0xeed7edff,0xf0f1efc8,
-0xf3b7f23c,0xf6d7f53d,0xf98df84d,0xfb55fa9b,0xfc04fbd5,0xfbfffc09,0xfc0afbfd,0xfc84fc2e,
-0xfe17fd23,0x0099ff44,0x032201ed,0x04ef0424,0x0566055b,0x040d04f3,0x00b702a5,0xfbb0fe68,
-0xf5b2f8ba,0xefa0f2ab,0xe9f6ecbe,0xe4cce754,0xe006e266,0xdbbaddc7,0xd890d9f0,0xd69ed772,
-0xd57cd5e6,0xd4fbd527,0xd49ad4c5,0xd3ead44c,0xd2bed360,0xd180d211,0xd0a2d0fb,0xd0a6d08f,
-0xd15bd0e7,0xd2f8d209,0xd55bd425,0xd78dd68c,0xd917d86c,0xd9ded98f,0xda9bda2d,0xdc51db5a,
-0xdee8dd89,0xe209e06f,0xe524e3a1,0xe815e699,0xead2e977,0xed95ec38,0xf014eee8,0xf25ef135,
-0xf4b8f38c,0xf6e6f5de,0xf907f7ec,0xfafffa15,0xfc0afb9c,0xfc12fc2b,0xfaf3fbaa,0xf912fa15,
-0xf713f80d,0xf578f63a,0xf486f4e6,0xf475f460,0xf53ff4be,0xf6d5f5f8,0xf8a9f7cb,0xf9acf945,
-0xf979f9bb,0xf7f0f8df,0xf574f6c8,0xf293f404,0xefa9f111,0xed57ee5e,0xebfcec89,0xeb7beb9b,
-0xebaaeb8c,0xebfeebd2,0xebfaec0e,0xeb3cebb9,0xe982ea74,0xe760e87a,0xe5abe675,0xe569e551,
-0xe777e61c,0xec13e97b,0xf2dfef3a,0xfafaf6c6,0x02e5ff14,0x0929063f,0x0d480b78,0x0f520e87,
-0x0f710f97,0x0e110ee6,0x0c230d15,0x0abd0b57,0x0a5f0a70,0x0b310aaf,0x0cd90c00,0x0f0a0df0,
-0x1103101c,0x11f1119c,0x11f81216,0x112b11ad,0x0ff01084,0x0efa0f69,0x0e010e76,0x0d110d7b,
-0x0c540c9f,0x0c550c33,0x0d030c98,0x0e180d7d,0x0f740ec1,0x109d100f,0x114b110e,0x10d2113a,
-0x0ef31008,0x0c4b0db9,0x09410ac2,0x06a007db,0x04ed05a1,0x042e0477,0x042f0418,0x05170489,
-0x069d05c3,0x08560777,0x0a19092b,0x0c1e0b24,0x0e290d30,0x0fb70f02,0x106a102f,0x104e1072,
-0x0fa31000,0x0edd0f3a,0x0e550e87,0x0e3e0e34,0x0e800e47,0x0eaa0ea5,0x0e4f0e88,0x0d6d0df0,
-0x0c440cdb,0x0b4f0bbd,0x0aec0b0d,0x0b510b06,0x0c360bb7,0x0ce60ca2,0x0cb90cee,0x0b050c19,
-0x07c40992,0x03bd05d0,0xffa101a7,0xfca9fdf3,0xfb86fbd3,0xfc2bfba7,0xfddbfcf0,0x0060fefa,
-0x039901e5,0x0710055e,0x0a0608a3,0x0c590b4b,0x0e120d4c,0x0f480ecf,0x0f990f89,0x0f610f84,
-0x0eef0f2f,0x0e7a0eb7,0x0db50e27,0x0c590d18,0x0a7b0b74,0x08a5097f,0x07880800,0x077b0754,
-0x08eb080c,0x0b3d09f9,0x0d880c76,0x0ec30e56,0x0e650ecd,0x0c210d7b,0x087f0a6b,0x0478067c,
-0x00c6028e,0xfdf2ff3c,0xfc20fce6,0xfb57fba6,0xfb40fb35,0xfb80fb4b,0xfc4bfbcd,0xfd9cfce8,
-0xff64fe72,0x01a90075,0x04b30326,0x08670680,0x0cac0a7a,0x11700ef8,0x169113f1,0x1bc4192e,
-0x20791e34,0x24322277,0x26a42594,0x2798274f,0x2707277e,0x24ef2621,0x21c42370,0x1e4a2006,
-0x1adc1c95,0x1734190f,0x13951556,0x105011e3,0x0d800ed9,0x0ae40c2f,0x07cd096e,0x044e0610,
-0x00a6027a,0xfd14fedc,0xfa4afb8b,0xf892f94c,0xf80ff831,0xf88cf834,0xf9f1f926,0xfbe3fae7,
-0xfdcdfce0,0xff22fe95,0xff3dff5d,0xfdbafeb4,0xfaa8fc51,0xf707f8e4,0xf34cf528,0xf011f19b,
-0xeda9eeba,0xec30ecdb,0xebaeebd1,0xec38ebd4,0xedbbece0,0xefa0eea2,0xf16ff08f,0xf2a2f217,
-0xf393f31b,0xf412f3e8,0xf41cf41f,0xf467f438,0xf54af4c3,0xf6baf5f9,0xf813f773,0xf8f8f892,
-0xf962f947,0xf92ef956,0xf891f8e7,0xf7a5f82a,0xf615f6ea,0xf435f514,0xf2cef366,0xf23df268,
-0xf2eef273,0xf4acf3b1,0xf736f5dc,0xfa41f8ac,0xfda0fbee,0x0118ff61,0x042902b7,0x06da058e,
-0x09020805,0x0a3809ba,0x0a6c0a6f,0x09cb0a2a,0x08dd0953,0x083f0879,0x0818081d,0x087f083e,
-0x092008cd,0x09a00966,0x09c409c5,0x095809a4,0x083a08e2,0x06880778,0x04720593,0x021c0352,
-0xff7500d1,0xfc8cfe0a,0xf97efaff,0xf693f7fe,0xf3d2f528,0xf130f27f,0xee67efd3,0xeb2cece3,
-0xe705e931,0xe1eae492,0xdc3edf1c,0xd66cd945,0xd169d3c6,0xcdabcf61,0xcb05cc3b,0xc967ca18,
-0xc8e4c90a,0xc8fac8e4,0xc965c91f,0xca41c9cb,0xcb6dcace,0xcd09cc2d,0xced5cdf6,0xd061cfa1,
-0xd1eed12b,0xd380d2af,0xd588d46b,0xd82dd6bc,0xdbd8d9d7,0xe09ade1b,0xe607e343,0xeb6be8cc,
-0xeffaedd9,0xf351f1d7,0xf563f489,0xf5eaf5d3,0xf593f5cd,0xf53ef563,0xf584f54f,0xf6a9f5ff,
-0xf893f78d,0xfb21f9ca,0xfdeffc94,0x0042ff30,0x01a4010e,0x0248020d,0x025e025d,0x0240024a,
-0x02320239,0x0230022d,0x01f2021d,0x00fd0198,0xfef5000b,0xfc31fda6,0xf938fab2,0xf6a8f7d2,
-0xf51df5ad,0xf4caf4c2,0xf5d8f528,0xf7c1f6bc,0xf9f1f8da,0xfc33fb15,0xfed6fd78,0x01e4005b,
-0x051c038b,0x083606a8,0x0b6709cb,0x0e920cfc,0x117c100b,0x140f12d3,0x160b1525,0x173b16bc,
-0x17581767,0x167c1702,0x14de15bc,0x129713cf,0x0fd61149,0x0cbd0e53,0x09b30b3d,0x071c0856,
-0x051005fc,0x04030463,0x04680401,0x063b0528,0x097107b0,0x0d740b6e,0x114e0f6f,0x14561303,
-0x15a6153d,0x151b15a3,0x12cc1421,0x0f92113d,0x0c540de0,0x09e40af3,0x08c00928,0x08b8088d,
-0x0a10092b,0x0c4b0b1a,0x0ed90d88,0x1152101c,0x1348125b,0x14b51409,0x15c2154e,0x162e1609,
-0x161a162e,0x15cf15f5,0x15a515aa,0x15d915b9,0x16a5162d,0x18201740,0x1ae7195f,0x1e621c9d,
-0x22082032,0x25e523fb,0x299827c2,0x2d422b6e,0x30d72f10,0x34203284,0x36f83590,0x395f3837,
-0x3ae63a38,0x3afd3b21,0x39ab3a79,0x3712387f,0x33353549,0x2e0a30c7,0x27b02b0a,0x20872433,
-0x18cd1ca5,0x11871517,0x0b1b0e3c,0x05bf084d,0x019a0384,0xfea2fff7,0xfd06fda4,0xfcf9fcd3,
-0xfe8afd83,0x01a4ffe2,0x05a7038e,0x09f307cc,0x0de00c02,0x11090f8d,0x137a1253,0x14ec1458,
-0x14e31506,0x13881464,0x10a91242,0x0c8d0ebc,0x07d40a38,0x03580578,0xffcf016d,0xfd9dfe7d,
-0xfd30fd30,0xfe2ffd85,0xfffcff0f,0x01a800df,0x029a0242,0x02be02cd,0x01f0027f,0xffea0117,
-0xfcb3fe74,0xf882faaa,0xf42ff647,0xf0d9f257,0xef33efca,0xef78ef1b,0xf141f031,0xf39df269,
-0xf5d7f4c0,0xf74ff6aa,0xf7dbf7a6,0xf7d9f7ec,0xf7a4f7ba,0xf7d5f7b3,0xf89bf826,0xf9e3f935,
-0xfb38faa1,0xfba9fb9b,0xfabafb5a,0xf85ff9b7,0xf4e3f6b3,0xf0d4f2e1,0xece8eed4,0xe970eb18,
-0xe6b9e7fb,0xe4c5e5ad,0xe384e40d,0xe2d6e31b,0xe2c8e2b9,0xe36fe304,0xe459e3df,0xe5afe4fc,
-0xe74fe676,0xe93ce835,0xeb7dea55,0xeda3ec9c,0xef6fee93,0xf0c6f029,0xf19cf13e,0xf1f1f1cf,
-0xf1e9f1f5,0xf1d7f1e6,0xf1a5f1cc,0xf0fef160,0xefedf08d,0xee68ef34,0xecf3edac,0xeb7eec38,
-0xea4eead6,0xe9a7e9e3,0xe938e970,0xe8b0e902,0xe7c0e859,0xe5eae6eb,0xe366e4c1,0xe049e1ec,
-0xdcbbde8b,0xd96edafd,0xd6ead80d,0xd568d5ff,0xd521d51c,0xd5f6d56e,0xd781d6ac,0xd962d86a,
-0xdb5cda5c,0xdd5fdc61,0xdf5ede58,0xe19ee074,0xe426e2e2,0xe6dee585,0xe9a8e84a,0xec3feafd,
-0xee7ced73,0xf04cef72,0xf200f12c,0xf3d4f2e2,0xf61cf4f5,0xf85df74b,0xfa80f97c,0xfc92fb8e,
-0xfea3fd9f,0x00b8ffa6,0x02b501c1,0x04300376,0x051d04a8,0x0585055e,0x05a805a0,0x05a705a2,
-0x05a105ad,0x05c605af,0x065e05fa,0x07d60707,0x0a1c08e2,0x0cff0b82,0x10600ea9,0x141c1237,
-0x17a715f7,0x1a6f1930,0x1bf81b5f,0x1c161c42,0x1adc1ba1,0x187719c6,0x154316ed,0x116e136d,
-0x0ce40f2e,0x08550a98,0x03fd0619,0x005f0218,0xfd53fec8,0xfaf9fc11,0xf93bfa0d,0xf7daf889,
-0xf661f723,0xf4f3f5a4,0xf3a1f44e,0xf26df307,0xf1a1f1fb,0xf15bf16b,0xf197f163,0xf29df1fc,
-0xf49af381,0xf77bf5f0,0xfac4f91a,0xfe0afc69,0x00edff8b,0x034d022d,0x04e6042f,0x05910558,
-0x0552058d,0x04b6050a,0x045c0482,0x04bd0477,0x060d0544,0x08230705,0x0a85094c,0x0d300bd6,
-0x0fa90e82,0x1151109e,0x11f311c2,0x11d511fa,0x116d119b,0x1194115b,0x12a811f1,0x14b3138c,
-0x173c15f4,0x19831864,0x1af21a52,0x1b9b1b58,0x1b961ba6,0x1b1d1b74,0x1a751ad6,0x198e1a15,
-0x1871190c,0x175217db,0x16a916ed,0x169e1695,0x175f16ee,0x18b31802,0x1a471983,0x1b5c1ae6,
-0x1b781b99,0x19ff1af2,0x16d51897,0x127a14ba,0x0de5101f,0x09e80bc8,0x06e0084a,0x048305a0,
-0x02b90396,0x0174020b,0x007100e7,0xffb00011,0xfeeeff4d,0xfe2bfe8b,0xfdbbfde2,0xfde7fdb6,
-0xfe86fe2a,0xff81fefd,0x0089000f,0x013800f1,0x012c0157,0x004400d3,0xfeb5ff87,0xfd46fdf1,
-0xfc49fcb7,0xfbe7fbf7,0xfc9cfc21,0xfe1afd41,0x0032ff15,0x02cd0176,0x05b00440,0x08700723,
-0x0aa5099d,0x0beb0b69,0x0bc20c03,0x09df0b00,0x068e0854,0x02c304bc,0xfea500b3,0xfb47fcd3,
-0xf926fa0f,0xf851f89a,0xf8b3f866,0xf9eef939,0xfb89fab9,0xfd2bfc5b,0xff15fe0e,0x016e003c,
-0x043902c7,0x071b05ae,0x099c086d,0x0bb70ab5,0x0d800cac,0x0f280e61,0x10510fcc,0x10d710ab,
-0x10b410d6,0x0ff9105c,0x0f240f89,0x0e650ebd,0x0dd20e11,0x0da90da9,0x0dfa0dc5,0x0ea60e46,
-0x0fa30f1e,0x10dc1041,0x11d61169,0x11fd1206,0x10dd119f,0x0e560fbf,0x0ab60ca5,0x063f0886,
-0x016e03d8,0xfc7dfeea,0xf7dbfa1e,0xf444f5e8,0xf1ecf2f4,0xf100f150,0xf156f109,0xf2d4f1f5,
-0xf559f3f8,0xf874f6d9,0xfb86f9f8,0xfeb0fd1c,0x0185002c,0x03bd02ba,0x056904a1,0x06ba061c,
-0x077d0736,0x07620789,0x067f0718,0x04cc05c2,0x029703be,0x00590179,0xfe34ff41,0xfc65fd3a,
-0xfaf0fb95,0xf9fafa66,0xf96af99d,0xf9b9f97c,0xfaa6fa27,0xfb88fb1d,0xfbf9fbcd,0xfbcffbfc,
-0xfafdfb7c,0xf96cfa57,0xf70bf854,0xf3dbf592,0xef9cf1d0,0xeaa0ed2d,0xe552e7f0,0xe07ce2d4,
-0xdc98de60,0xda33db36,0xd920d97c,0xd977d921,0xdac7da00,0xdca2dbad,0xdec5dda5,0xe12ddff7,
-0xe379e258,0xe585e490,0xe753e676,0xe925e83f,0xeafaea0c,0xed21ebfe,0xefedee67,0xf37bf19e,
-0xf79bf586,0xfba1f9a3,0xff44fd82,0x025200e5,0x0438036c,0x04ab04aa,0x0399044f,0x014f0293,
-0xfe5affe6,0xfb01fcb0,0xf7a3f94d,0xf493f610,0xf1dff328,0xf003f0ce,0xef1eef73,0xeecbeeeb,
-0xeeabeec3,0xee1eee7c,0xecabed81,0xea74eba5,0xe7c1e92c,0xe4eae649,0xe28ee3a1,0xe130e1b2,
-0xe111e0f2,0xe1f1e160,0xe3a2e2ad,0xe5aee4a5,0xe762e69d,0xe823e7e7,0xe7b1e814,0xe5d7e6e9,
-0xe30be47f,0xe01de191,0xddc8ded9,0xdcaddd0d,0xdd5fdcc6,0xe00cde7a,0xe448e202,0xe93fe6ba,
-0xee2cebba,0xf2d4f08d,0xf6ebf4f1,0xfa6af8b9,0xfda0fc16,0x00a7ff2d,0x03c50239,0x06fd055d,
-0x0a4e089f,0x0d970c04,0x106b0f1e,0x124c1185,0x12e312bb,0x124c12bf,0x10ce11a4,0x0ea50fc3,
-0x0c3d0d71,0x0a130b19,0x087c0935,0x079e07fc,0x0759076f,0x0734074f,0x069006f5,0x052205ec,
-0x03280427,0x012e0224,0xff46002a,0xfdc2fe70,0xfcc8fd31,0xfc48fc6a,0xfc6cfc48,0xfd74fcd5,
-0xff50fe4d,0x02150096,0x056b03b1,0x08e00732,0x0c430a8b,0x0fc60dff,0x133f118a,0x168e14f4,
-0x19941813,0x1c9e1b1f,0x1f801e0a,0x227520fa,0x252623d5,0x27432651,0x284227e8,0x27d7283a,
-0x2620271b,0x23a124f7,0x20942221,0x1dd81f1b,0x1c241cd6,0x1b761bb2,0x1bac1b73,0x1c7d1c0d,
-0x1d3c1ced,0x1d6b1d68,0x1cf31d42,0x1c0f1c8f,0x1af01b83,0x19d21a63,0x18fd1959,0x18be18c8,
-0x192118d8,0x19e91981,0x1a481a1f,0x1a2e1a48,0x19d21a04,0x1934198f,0x184918cf,0x170217b8,
-0x150a161e,0x124c13cc,0x0efa10b2,0x0b7f0d3a,0x089309e6,0x06c20786,0x06210646,0x06bd0654,
-0x082e0763,0x0a360928,0x0c870b53,0x0ef80dbb,0x11441020,0x13251243,0x148213e0,0x157d1513,
-0x15bb15c5,0x14f1156c,0x13d11462,0x12b81342,0x11fc124d,0x11ff11e2,0x12f3125e,0x146d13a4,
-0x1608153f,0x172c16af,0x174e1766,0x160b16db,0x133414cd,0x0f17114b,0x0a090cab,0x04b60763,
-0xffa90226,0xfb52fd5c,0xf828f992,0xf656f716,0xf593f5d7,0xf55af561,0xf570f559,0xf5aff590,
-0xf5d5f5cb,0xf5c8f5d5,0xf593f5ba,0xf551f565,0xf55ef54f,0xf5d3f590,0xf6b9f636,0xf836f767,
-0xfa68f930,0xfd63fbd2,0x0117ff26,0x0531031a,0x09140731,0x0c040aab,0x0d890cfa,0x0d760dad,
-0x0c030ce9,0x097e0ae1,0x065d07fb,0x031f04c6,0xffda017d,0xfca3fe3e,0xf96bfb15,0xf62af7c7,
-0xf2edf490,0xefdef15e,0xed5dee86,0xebd1ec7d,0xeaebeb50,0xeaa0eab3,0xeac5eaaa,0xeb28eaf3,
-0xeb9aeb5c,0xec2bebdd,0xecd9ec7d,0xedbeed49,0xeec6ee45,0xefe1ef56,0xf091f049,0xf0b6f0b4,
-0xf023f084,0xeee1ef95,0xed6eee26,0xec28ecc1,0xeaf5eb83,0xe9acea57,0xe802e8e3,0xe606e717,
-0xe38de4e2,0xe0c3e231,0xde14df59,0xdbdfdce2,0xda6cdb07,0xd9cdda07,0xd984d9a8,0xd96dd978,
-0xd99ad981,0xda2ad9d5,0xdb28da99,0xdca8dbde,0xde77dd8b,0xe073df71,0xe260e169,0xe40be338,
-0xe554e4b5,0xe643e5ca,0xe70ee6a4,0xe7d1e773,0xe8c8e845,0xea0ee965,0xeb85eac9,0xece9ec3e,
-0xedf7ed7e,0xee4cee37,0xed88ee16,0xeb89ecab,0xe864ea10,0xe49fe68a,0xe0e4e2b5,0xddf9df53,
-0xdc65dcf5,0xdc70dc3c,0xddaddcee,0xdff0deb4,0xe305e166,0xe6b7e4c9,0xeb11e8ce,0xefd8ed6d,
-0xf499f243,0xf944f6f7,0xfd93fb84,0x014fff81,0x048502f8,0x076305fd,0x0a1908be,0x0cc80b71,
-0x0f550e1a,0x11bd108e,0x139812c1,0x145a141f,0x13e61449,0x12661343,0x105e1171,0x0e360f3f,
-0x0c4d0d3a,0x0b0a0b99,0x0a390a9b,0x098e09e4,0x08db0930,0x0805086d,0x0724078b,0x068e06ca,
-0x0691066a,0x079b06f1,0x099c087a,0x0c750af2,0x10180e33,0x1449122c,0x18731664,0x1c381a67,
-0x1f001dbb,0x20cc200d,0x21782149,0x21032166,0x1f672059,0x1cc41e30,0x19491b1b,0x15211744,
-0x108f12de,0x0bdb0e2e,0x074d098b,0x03230532,0xff7e0145,0xfcaffdfa,0xfab0fb98,0xf98cfa01,
-0xf934f94d,0xf9b4f954,0xfb30fa4d,0xfd8bfc53,0x0026fedf,0x02a30166,0x04f303d3,0x06c205ea,
-0x08060776,0x08d10872,0x091f08ff,0x095b093f,0x09b90981,0x0a610a05,0x0b8a0ae8,0x0d4c0c61,
-0x0f540e4e,0x1199106e,0x140e12cc,0x16ad155d,0x190c17e9,0x1ade1a09,0x1bfe1b88,0x1c511c48,
-0x1b841c12,0x19b21ab4,0x173b1883,0x14a015e1,0x126a136d,0x10e81192,0x103d107c,0x10581034,
-0x10e9109a,0x118f1137,0x122211de,0x1275125c,0x12801289,0x120d125f,0x10e2118e,0x0f1d1014,
-0x0c9d0df5,0x098f0b21,0x064707eb,0x032904ab,0x006001b9,0xfe03ff20,0xfc5bfd14,0xfb89fbd3,
-0xfb9dfb7b,0xfc6ffbed,0xfde1fd15,0xff8dfeb8,0x00ec0047,0x01b8016c,0x018901cb,0x0046010a,
-0xfe1fff45,0xfb9bfce2,0xf92afa58,0xf738f81f,0xf617f687,0xf5f4f5e8,0xf6e0f64b,0xf8d6f7c6,
-0xfb78fa1d,0xfe8bfcf2,0x01e00032,0x051d038a,0x07e70697,0x09e60903,0x0ae20a8a,0x0abd0af3,
-0x09990a47,0x07e308be,0x05f306f6,0x03d004ee,0x01a102b6,0xffb500a3,0xfe52fee7,0xfddffdf0,
-0xfe84fe08,0x0066ff48,0x038201d9,0x07120547,0x0a8008dc,0x0d200c00,0x0e340de5,0x0d590e01,
-0x0af50c54,0x07c20966,0x04aa062e,0x0240035b,0x00c60166,0x00470066,0x00ac005e,0x01c7011a,
-0x03720284,0x0589047c,0x077b0692,0x08ea0848,0x09c40973,0x09ee09ee,0x099f09da,0x08ed094b,
-0x07f7086a,0x06e3076d,0x05cb065c,0x0476052c,0x02ac039f,0x004e018a,0xfd8ffefb,0xfabafc2b,
-0xf809f95e,0xf5acf6dc,0xf3c1f4a8,0xf245f2e6,0xf17cf1c6,0xf125f13f,0xf0e9f10a,0xf05bf0b3,
-0xef4befea,0xedc3ee9b,0xebc9ecc9,0xe9c6eac5,0xe835e8e9,0xe782e7b5,0xe7dee794,0xe8dee84a,
-0xea73e997,0xecb3eb7e,0xef97ee1d,0xf2def139,0xf637f48d,0xf977f7d5,0xfca4fb1c,0xff2dfe0b,
-0x00e80022,0x019c015d,0x017b01a3,0x00cc0133,0xfff20062,0xff16ff7a,0xfeedfee2,0xffa3ff31,
-0x00fe003e,0x02f201ed,0x04d703e8,0x063d05a1,0x0690068f,0x05930638,0x034e049c,0xffee01b9,
-0xfc23fe07,0xf84cfa31,0xf4c2f67f,0xf1a6f326,0xef12f053,0xecc2ede7,0xeac1ebc2,0xe897e9b7,
-0xe623e767,0xe39ce4d5,0xe134e265,0xdefde005,0xdd62de14,0xdcb5dced,0xdd07dcbb,0xde51dd97,
-0xe038df3d,0xe27ce14f,0xe4dae3a9,0xe73de612,0xe98de862,0xebfdeabe,0xee89ed33,0xf134efd7,
-0xf3cdf282,0xf5faf4f7,0xf777f6d0,0xf84df7f4,0xf881f882,0xf82df863,0xf7bff800,0xf725f779,
-0xf64cf6c0,0xf4e1f5ad,0xf2c8f3ea,0xefeff168,0xecb3ee63,0xe958eb05,0xe647e7b6,0xe415e512,
-0xe2b0e347,0xe234e251,0xe274e23a,0xe34ae2c3,0xe4dbe3fc,0xe6f5e5d9,0xe9a4e83a,0xece9eb37,
-0xf0edeed2,0xf57af321,0xfa18f7bf,0xfe83fc57,0x0263008d,0x052a03ec,0x06d30620,0x07ac0755,
-0x081007e8,0x08400828,0x0892086b,0x093808de,0x0a1a09ab,0x0ad70a85,0x0b540b1f,0x0b990b7f,
-0x0be20bba,0x0c690c12,0x0d620cd3,0x0ee00e18,0x10c60fc9,0x130211e0,0x1536142b,0x172c1640,
-0x18f01820,0x1a4319a8,0x1b101abd,0x1b371b31,0x1af51b22,0x1a091a98,0x18511949,0x15a71718,
-0x123c13fb,0x0ead1076,0x0b3f0ce3,0x086609b8,0x0656074c,0x04f00592,0x0464048d,0x04860465,
-0x051204c4,0x05da0573,0x06960644,0x06fc06cb,0x07240713,0x06fe0718,0x06c406d8,0x06b406ad,
-0x075706e8,0x090f0807,0x0c150a6d,0x10050dfb,0x14751231,0x18c216b3,0x1c381aa0,0x1e831d84,
-0x1fb91f45,0x1ff41ff7,0x1f711fc9,0x1eb41f1a,0x1dd31e42,0x1cfd1d64,0x1c311c97,0x1b7b1bd7,
-0x1aad1b1c,0x19cb1a42,0x188e193a,0x16e017ba,0x150f15f8,0x1328141d,0x1158123e,0x0fdb108c,
-0x0ebe0f3e,0x0e1c0e58,0x0df80dfc,0x0e1b0e04,0x0e880e44,0x0f5d0ee6,0x10970ff5,0x12001151,
-0x135d12b3,0x14bc140d,0x15ec155e,0x16f8167f,0x17f01779,0x19001872,0x1a1b198f,0x1b2e1aa7,
-0x1c1e1bac,0x1cab1c6c,0x1cc81cc0,0x1c541ca5,0x1b641be6,0x1a431ad6,0x191619b4,0x17da187a,
-0x1672172d,0x14f315b2,0x1396143b,0x1297130e,0x1210123e,0x12511221,0x130a12a0,0x13f41374,
-0x14e71472,0x15bc155e,0x15fe15f3,0x157115d0,0x13fb14d6,0x11a512ec,0x0e731026,0x0a7d0c92,
-0x05dd0840,0x00d40363,0xfb9dfe40,0xf66ef8fb,0xf16ff3dd,0xecf1ef1c,0xe920eaec,0xe651e795,
-0xe45de544,0xe2e7e39d,0xe1a0e245,0xe033e0f8,0xde52df54,0xdbfddd32,0xd97ddac0,0xd734d846,
-0xd5a4d651,0xd534d545,0xd61cd57e,0xd835d704,0xdb43d9a7,0xdec0dcfe,0xe221e081,0xe510e3af,
-0xe711e62e,0xe7d3e79c,0xe751e7b8,0xe598e692,0xe336e46c,0xe0fbe203,0xdfa3e02b,0xdfa7df77,
-0xe125e03d,0xe3f4e263,0xe7efe5dd,0xecb0ea46,0xf1a1ef30,0xf64af404,0xfa36f85a,0xfcfbfbc0,
-0xfe5bfddc,0xfdf0fe61,0xfbfcfd17,0xf8f8fa8a,0xf56ff738,0xf1daf395,0xeed5f042,0xeceeedc0,
-0xec27ec75,0xec42ec1a,0xed08ec91,0xee52ed9e,0xefb6ef0a,0xf0eaf057,0xf1b9f166,0xf1edf1ec,
-0xf16df1c3,0xf037f0e7,0xee5cef5f,0xec1bed3c,0xe9c5eaeb,0xe79de8b1,0xe5a8e69b,0xe3ebe4bc,
-0xe275e320,0xe16fe1d9,0xe134e139,0xe1d7e162,0xe35ce28a,0xe55ae452,0xe76ce667,0xe95ce86e,
-0xeae3ea3c,0xeb81eb51,0xeb2beb6e,0xea45eac3,0xe930e9be,0xe83be8a3,0xe7a5e7de,0xe79de783,
-0xe855e7e0,0xe996e8eb,0xeb36ea5f,0xed07ec16,0xef1dee0f,0xf12ff022,0xf365f241,0xf5c9f492,
-0xf83ff705,0xfad3f98d,0xfd70fc1b,0x0029fed0,0x02f70186,0x05cc0461,0x087e072f,0x0aee09c5,
-0x0d110c06,0x0eaa0de9,0x0f940f35,0x0fc20fb7,0x0fb10fc4,0x0f9f0fab,0x0f980f9a,0x0fb40f9f,
-0x0f9e0fb0,0x0f2e0f72,0x0e3d0ece,0x0cf40d9e,0x0b700c37,0x09ff0aaf,0x08ee0964,0x089908af,
-0x090208c0,0x09f60969,0x0b220a7f,0x0c540bb8,0x0d6d0ce9,0x0e3d0dd7,0x0ebe0e92,0x0efe0eea,
-0x0f480f20,0x0fe10f8c,0x11101062,0x12e911e9,0x153f1403,0x17911667,0x19bc18aa,0x1b7c1ab3,
-0x1c8c1c1a,0x1ca81cbd,0x1ba81c51,0x195e1aae,0x163017dd,0x128d1463,0x0ed710a7,0x0bb80d2d,
-0x09700a79,0x081808a0,0x080e07e8,0x092d0883,0x0b220a16,0x0d7f0c47,0x0fcd0ea7,0x11d910de,
-0x136712b3,0x145813f8,0x14c914a2,0x14df14e3,0x14e614ea,0x14c614e0,0x145e14a4,0x134b13e6,
-0x1177127c,0x0edf103a,0x0c020d70,0x09370a91,0x06af07e4,0x04830591,0x02d0039e,0x01b10235,
-0x011e015f,0x0115010a,0x01440129,0x0186015c,0x020001b4,0x028a023f,0x034902de,0x046503c5,
-0x05e10510,0x079306b5,0x09550877,0x0aec0a22,0x0c2e0ba1,0x0ce50c9a,0x0d130d13,0x0cb80cfa,
-0x0c0d0c6f,0x0b500baa,0x0ad30b04,0x0a7e0aa1,0x0a6f0a69,0x0aa70a81,0x0b010acf,0x0b5b0b2f,
-0x0b6b0b7a,0x0aa80b2e,0x08d509e7,0x060a078a,0x028c045e,0xfeeb00af,0xfb9afd29,0xf929fa41,
-0xf7e5f867,0xf7def7be,0xf901f849,0xfaf8f9ea,0xfd7cfc2c,0x0062fee4,0x034601db,0x05a20494,
-0x07250686,0x07c10791,0x07c807cd,0x078007a3,0x07600767,0x07c2077c,0x08ab0828,0x09ad092d,
-0x0a350a07,0x09c70a1f,0x08360927,0x057006f2,0x01ec03bd,0xfe19000b,0xfa6cfc38,0xf735f8c1,
-0xf47bf5c2,0xf264f359,0xf107f196,0xf07ef0a7,0xf08bf074,0xf113f0c4,0xf1e5f178,0xf2dff25e,
-0xf3f4f36a,0xf509f47d,0xf60ef592,0xf6e9f681,0xf79df748,0xf84df7f8,0xf921f8af,0xfa39f9a0,
-0xfb88fad3,0xfd1dfc48,0xfef1fdff,0x010bfff9,0x032f0219,0x055d0444,0x07820672,0x09850888,
-0x0b7a0a86,0x0d580c75,0x0ed50e25,0x0fae0f5e,0x0f9b0fc7,0x0e7c0f2c,0x0c540d8b,0x09460ae6,
-0x05970778,0x01b803a8,0xfe22ffdb,0xfb10fc7e,0xf88df9b3,0xf690f778,0xf547f5d2,0xf4b0f4e3,
-0xf49bf49d,0xf4dbf4b9,0xf569f521,0xf629f5cd,0xf6fdf6a0,0xf790f75c,0xf796f7aa,0xf6e7f74c,
-0xf5bbf65f,0xf422f4fb,0xf221f32e,0xeff1f10f,0xedcdeed9,0xebf2eccd,0xeab4eb39,0xea17ea48,
-0xea3cea0b,0xeafbea89,0xec1aeb88,0xed49ecb6,0xee93ede8,0xefffef4d,0xf12ef0a1,0xf21ef1b3,
-0xf2f3f295,0xf3e0f364,0xf4f3f468,0xf60ef582,0xf726f69d,0xf83af7b8,0xf929f8bd,0xf9def996,
-0xfa59fa19,0xfacdfa8f,0xfb19fafc,0xfb22fb28,0xfadefb04,0xfa3ffa97,0xf95ff9cf,0xf83ef8cf,
-0xf6bff786,0xf4fff5e1,0xf326f411,0xf15ff246,0xefd7f09f,0xee91ef3c,0xed7bee16,0xec6fecfe,
-0xeb64ebee,0xea57ead5,0xe970e9d8,0xe91be931,0xe979e92d,0xeab3ea03,0xec94eb94,0xef0cedc1,
-0xf1d4f063,0xf4e3f351,0xf80cf670,0xfb4ef9ae,0xfe75fce7,0x012affdf,0x0314023b,0x03f103a6,
-0x039503de,0x020502f3,0xff4d00cc,0xfbdcfd9f,0xf83dfa0d,0xf50df68f,0xf2b8f3d0,0xf175f1fe,
-0xf144f13c,0xf220f194,0xf3b6f2cf,0xf5dff4bb,0xf83df708,0xfa87f966,0xfc8efb93,0xfe04fd61,
-0xfeb6fe76,0xfee0fed9,0xfe77febf,0xfdabfe22,0xfc89fd22,0xfb43fbef,0xf9f3fa9a,0xf8baf955,
-0xf79af827,0xf6b4f722,0xf5e9f64e,0xf53bf58f,0xf487f4e1,0xf3e1f42f,0xf39df3b2,0xf40bf3c6,
-0xf51ef489,0xf68ef5d3,0xf81df754,0xf960f8c8,0xf9f8f9c3,0xf9b5f9e9,0xf910f968,0xf87cf8bc,
-0xf85df85f,0xf90bf887,0xfad8f9c3,0xfdbdfc26,0x018bff89,0x05c5039e,0x09fa07e0,0x0da30be3,
-0x109d0f29,0x132b11ea,0x15831456,0x17b0169c,0x1a0218cf,0x1c841b43,0x1efd1dc4,0x214a2027,
-0x23722267,0x2550246b,0x26f4262c,0x287427c1,0x298c290f,0x2a2b29ec,0x2a572a4b,0x29f42a38,
-0x292b2999,0x282f28a6,0x275227bb,0x26a426f7,0x2626265e,0x25c925f4,0x2565259a,0x24d42519,
-0x24202478,0x23ac23d9,0x239d2393,0x23fe23bc,0x24ac244f,0x25512506,0x25932586,0x251f257f,
-0x23ab248f,0x216d22a8,0x1ea02010,0x1b8e1d16,0x18921a03,0x15e6172a,0x13ad14b3,0x11fd12b6,
-0x10ac113e,0x0fa71021,0x0ea60f22,0x0dd30e3f,0x0d050d6f,0x0c440ca8,0x0b8b0bed,0x0a9c0b1c,
-0x09790a0c,0x084008dc,0x071507b1,0x060a0682,0x05240593,0x048504c8,0x04290450,0x04420423,
-0x049c046e,0x04c704b3,0x04b704c3,0x047704a1,0x0412044c,0x037803d9,0x028e0316,0x013601fe,
-0xff630066,0xfd17fe4f,0xfa8afbd8,0xf82df94f,0xf668f736,0xf559f5c7,0xf51bf526,0xf550f52b,
-0xf5aff584,0xf5eff5d6,0xf5d3f5e4,0xf586f5a9,0xf561f56a,0xf59ef56f,0xf669f5f7,0xf794f6f8,
-0xf8d1f838,0xfa06f96c,0xfb0ffa92,0xfbc4fb70,0xfc1bfbfb,0xfc2afc31,0xfbd5fc13,0xfb0cfb7e,
-0xfa27faa2,0xf973f9c5,0xf919f939,0xf95af926,0xfa59f9c1,0xfbf8fb15,0xfe05fcf9,0x004fff28,
-0x025d015c,0x03de0333,0x04bd0468,0x04d604e4,0x040a048a,0x0276034b,0x0036016a,0xfd70fee2,
-0xfa6dfbf6,0xf73af8d1,0xf435f5bb,0xf138f2c0,0xee1defb6,0xeadaec7f,0xe783e930,0xe422e5cb,
-0xe0ebe280,0xde06df6e,0xdb8edcb9,0xd99fda83,0xd80dd8c5,0xd6ebd768,0xd60ad677,0xd575d5ae,
-0xd510d540,0xd4efd4f9,0xd50fd4ff,0xd574d538,0xd655d5dc,0xd7d5d708,0xd9dfd8cb,0xdc66db1e,
-0xdf36ddcb,0xe21ce0b3,0xe4bce37d,0xe6fbe5e7,0xe8e7e806,0xeab2e9d5,0xec72eb98,0xee53ed6b,
-0xf02def45,0xf205f11b,0xf3c0f2ec,0xf52bf487,0xf610f5aa,0xf67ef656,0xf674f67f,0xf5fcf63d,
-0xf528f59b,0xf416f4a3,0xf2e2f374,0xf1bbf240,0xf111f14d,0xf0f7f0ee,0xf144f113,0xf1c0f183,
-0xf203f1eb,0xf1fdf20a,0xf1a2f1da,0xf10bf15f,0xf064f0b6,0xefebf01b,0xefceefc5,0xf00fefe4,
-0xf073f041,0xf107f0bf,0xf1e3f176,0xf310f272,0xf4a4f3ca,0xf69cf596,0xf8a1f792,0xfa96f997,
-0xfc97fb8c,0xfeabfda6,0x00c5ffaf,0x031401ea,0x05750448,0x079e068e,0x09680894,0x0a860a0a,
-0x0af00ad3,0x0aab0ae4,0x0a140a6b,0x098f09c9,0x097c0979,0x09e009a3,0x0ae70a54,0x0c6f0ba4,
-0x0e5a0d58,0x106d0f5d,0x125d1160,0x13f91339,0x14f5148a,0x1514151e,0x142b14c0,0x123a1353,
-0x0fa21100,0x0ce00e3d,0x0ad00bbd,0x09a30a1a,0x096a0966,0x0a0709a2,0x0b160a8e,0x0c3b0bad,
-0x0d270cbc,0x0dae0d7d,0x0dc40dc9,0x0d4f0d96,0x0c740ced,0x0b680bf0,0x0a5c0ad9,0x098f09eb,
-0x09240946,0x09700937,0x0a7209e3,0x0c050b2d,0x0dea0ce6,0x10360f07,0x12a71165,0x14fd13dc,
-0x16bc15ef,0x178f1747,0x172f1787,0x15ab168a,0x134d1490,0x109511f2,0x0e050f40,0x0c2c0cff,
-0x0b360b8f,0x0b490b20,0x0c5d0bb1,0x0e600d43,0x10c10f8e,0x13311202,0x150c143d,0x15d01598,
-0x153115a8,0x1341145d,0x104311dd,0x0d0c0ea7,0x0a410b8f,0x087d0942,0x07f90814,0x08e80852,
-0x0af009cf,0x0da60c3f,0x109a0f22,0x134411fb,0x15691465,0x169f161d,0x16bd16d3,0x15c5165c,
-0x14161507,0x120c1314,0x10291114,0x0eba0f68,0x0df10e3b,0x0dc70dcd,0x0dea0dcf,0x0e010dfd,
-0x0de20dfe,0x0d680db1,0x0c910cff,0x0b7e0c0c,0x0a3c0ae6,0x08e30999,0x077a0836,0x063d06d9,
-0x053105b9,0x044604ba,0x037f03ea,0x02cc0326,0x02260275,0x01af01ed,0x0153017a,0x01540148,
-0x01850164,0x01d601a9,0x01f701ea,0x018501d3,0x002400f4,0xfdd7ff1c,0xfa87fc4b,0xf679f889,
-0xf235f453,0xee30f017,0xeae0ec67,0xe884e98b,0xe727e7ad,0xe6d5e6df,0xe765e701,0xe8ace7f3,
-0xea66e984,0xec3beb58,0xedd3ed09,0xef47ee91,0xf0aceff6,0xf231f16d,0xf40bf313,0xf669f523,
-0xf95cf7ca,0xfccffb06,0x0075fea4,0x03ed0240,0x06e00588,0x08f10811,0x09e9099b,0x098c09e2,
-0x082508f6,0x05e20729,0x03230491,0x005c01ba,0xfdc0ff01,0xfba5fca6,0xf9f2fab8,0xf8bef942,
-0xf805f855,0xf7a1f7c7,0xf78cf797,0xf7b9f7a0,0xf803f7de,0xf866f832,0xf8f9f8a7,0xf9c6f955,
-0xfaedfa4b,0xfc4efb8f,0xfde5fd0f,0xff38fe9b,0x0015ffb7,0x0038003e,0xff64ffec,0xfdbcfea9,
-0xfb81fcab,0xf92dfa52,0xf713f815,0xf583f634,0xf4a2f4fa,0xf479f478,0xf508f4aa,0xf66df5a0,
-0xf88af763,0xfb30f9ce,0xfe0bfc95,0x00e6ff87,0x03650236,0x055e047c,0x0686060a,0x06dd06d0,
-0x064a06a9,0x053d05d7,0x03bc0482,0x020b02e5,0x00440129,0xfe8cff5f,0xfce8fdb3,0xfb65fc2a,
-0xf9f5faa7,0xf88ef944,0xf74df7eb,0xf64af6c3,0xf58af5df,0xf50ff541,0xf503f4f7,0xf595f534,
-0xf6faf633,0xf8ecf7e6,0xfb39fa0d,0xfd61fc58,0xfeeafe3e,0xff98ff5d,0xff66ff98,0xfe6bff01,
-0xfcf1fdbe,0xfb47fc1d,0xf99efa7a,0xf7f3f8c5,0xf65ef725,0xf4d0f59b,0xf342f40d,0xf1b5f27f,
-0xf023f0f3,0xee99ef5b,0xed25ede0,0xebe7ec80,0xeaeceb5d,0xea43ea90,0xe9c0e9fd,0xe932e977,
-0xe871e8d1,0xe771e7f6,0xe62ce6d2,0xe4b5e576,0xe34ae405,0xe20de2a2,0xe138e196,0xe0e8e109,
-0xe136e0f8,0xe259e1b3,0xe435e337,0xe6a4e55f,0xe963e7ee,0xec36eacd,0xeeb5ed82,0xf0d7efd6,
-0xf281f1c2,0xf3a1f31f,0xf483f41e,0xf54df4e7,0xf63df5bb,0xf73bf6be,0xf833f7b8,0xf932f8b3,
-0xfa1af9ab,0xfb03fa8e,0xfbf6fb73,0xfcfcfc6b,0xfe4efd94,0xffe9ff08,0x01cf00cb,0x03ec02d7,
-0x05ff04f5,0x07e506fc,0x096f08bf,0x0a3c09ef,0x0a3e0a57,0x09930a05,0x08600909,0x06ec07a5,
-0x059c0635,0x04a60512,0x04590468,0x04ee0481,0x0694059a,0x096507dc,0x0d1a0b28,0x11590f30,
-0x1585137e,0x18ef1761,0x1aec1a21,0x1b1a1b39,0x19c91a99,0x175a18ac,0x146f15ee,0x118612f7,
-0x0f00103a,0x0cdd0de1,0x0b2c0bf1,0x09c80a6c,0x08970924,0x077b0801,0x06a706fe,0x063d066a,
-0x0654063e,0x06c5068e,0x07570711,0x079d0788,0x075d0795,0x066c06fc,0x04ed05c2,0x031a040a,
-0x01010213,0xff2e0005,0xfdf1fe6e,0xfdc9fdac,0xfef8fe2d,0x01910018,0x055b0355,0x09e80793,
-0x0ead0c4a,0x132e10f7,0x170b1536,0x1a2118a7,0x1c9e1b79,0x1e8a1da4,0x20111f60,0x213120ab,
-0x21f721a5,0x225c2232,0x2286227b,0x226d227c,0x22422259,0x22262235,0x22122214,0x22012209,
-0x21d921ee,0x218921b5,0x20f3214e,0x2018208e,0x1f041f98,0x1dbf1e6b,0x1c471d0f,0x1a8b1b73,
-0x18cd19a9,0x170517e0,0x153b1626,0x13731456,0x11b71294,0x0ff110cf,0x0e2b0f02,0x0c650d49,
-0x0adc0b98,0x09ac0a3c,0x08e10941,0x086508a2,0x08240846,0x07e50806,0x07d407dc,0x080507eb,
-0x08710832,0x092108bd,0x09fd098c,0x0ab80a5e,0x0b470b00,0x0b9d0b77,0x0bd90bb1,0x0c460c04,
-0x0d080c9b,0x0e170d8f,0x0f710ec1,0x10cb1021,0x12051176,0x12b01272,0x129d12c3,0x11b81248,
-0x0ff510f3,0x0d790ecd,0x0a670c02,0x06de08b0,0x02ee04f2,0xfe9700c9,0xfa03fc54,0xf52cf7a1,
-0xf016f2a8,0xeafaed7e,0xe606e873,0xe196e3b6,0xdddadfa3,0xdb07dc51,0xd911d9f5,0xd7dfd862,
-0xd75ed78c,0xd75fd74e,0xd7b0d77f,0xd83bd7f8,0xd8ccd88b,0xd92ed905,0xd962d94c,0xd98dd973,
-0xd9dfd9a6,0xdab5da32,0xdc74db70,0xdf54ddc7,0xe316e123,0xe75ce535,0xeb92e97b,0xef73ed9b,
-0xf28bf119,0xf4a7f3bc,0xf5caf557,0xf62ff616,0xf63df638,0xf64af63d,0xf686f65a,0xf70af6bc,
-0xf7def76b,0xf8f8f861,0xfa34f992,0xfb73fadb,0xfc63fbf9,0xfcd8fcac,0xfcbffcdb,0xfc1efc81,
-0xfb0ffba6,0xf989fa50,0xf7d7f8ae,0xf5ecf6e0,0xf3e8f4ef,0xf1c9f2df,0xefb1f0be,0xedb9eeaf,
-0xebfbecd1,0xea9eeb40,0xe9abea1b,0xe90ee951,0xe8b5e8da,0xe882e895,0xe861e875,0xe825e84d,
-0xe7dee802,0xe78de7b4,0xe732e758,0xe6dae6f7,0xe69ae6b3,0xe6a3e69c,0xe6f4e6c8,0xe795e73f,
-0xe876e802,0xe981e8fb,0xeaa1ea12,0xebebeb3e,0xed55ec9d,0xeec3edff,0xf04aef89,0xf1b1f0fd,
-0xf2cff248,0xf392f339,0xf40cf3d7,0xf444f434,0xf44ef44e,0xf44ff457,0xf452f455,0xf45df459,
-0xf475f46e,0xf484f481,0xf473f488,0xf420f455,0xf3b9f3e9,0xf37bf391,0xf36ef365,0xf3ddf392,
-0xf4d0f443,0xf62cf571,0xf7c5f6f7,0xf963f89b,0xfad8fa28,0xfbfafb6c,0xfce6fc72,0xfd91fd48,
-0xfe0dfdd5,0xfe6bfe40,0xfed5fea4,0xff71ff17,0x003effd2,0x015900c3,0x02c00204,0x04890393,
-0x06a00585,0x091907d0,0x0bec0a74,0x0f050d6f,0x122a1099,0x152013ad,0x17a2166b,0x19b018ba,
-0x1b351a85,0x1c4f1bd2,0x1d211cb4,0x1de61d81,0x1ec11e58,0x1f981f38,0x20672001,0x212720ca,
-0x21cd217d,0x224c2211,0x22b52277,0x234922f5,0x23bf2383,0x241023ed,0x24392428,0x23f6242e,
-0x232423a2,0x21802268,0x1f15205f,0x1bf61d99,0x18701a3d,0x14b3168b,0x114112e6,0x0e570fae,
-0x0c310d27,0x0af60b75,0x0ab00abf,0x0b060acf,0x0b8d0b50,0x0c080bdb,0x0c3d0c32,0x0c080c2c,
-0x0b740bc2,0x0aba0b1c,0x0a060a53,0x099909bf,0x09b00986,0x0a6909ef,0x0bbb0af9,0x0d540c87,
-0x0ed10e15,0x0fe60f70,0x1048102e,0x0fba101a,0x0e830f34,0x0c9a0da0,0x0a3a0b71,0x07bd0901,
-0x05780694,0x039f047d,0x025002df,0x01af01eb,0x018f018f,0x01f701b8,0x02eb0269,0x04380385,
-0x059d04eb,0x06e70647,0x07f0077d,0x08970856,0x089008ab,0x07de084f,0x065e073b,0x04310555,
-0x01ab02f0,0xff0b0050,0xfcc1fdd1,0xfb40fbdf,0xfad5fae3,0xfb9afb13,0xfd82fc72,0x004efed5,
-0x039401f3,0x06da053e,0x09d6085f,0x0c640b2f,0x0e530d69,0x0fa90f14,0x1032100a,0x0fd21022,
-0x0e800f44,0x0c520d89,0x09600aeb,0x05ff07b5,0x0251042c,0xfeba0087,0xfb59fcff,0xf845f9b9,
-0xf5c2f6f0,0xf3c8f4b9,0xf239f2f4,0xf11ff1a1,0xf064f0b7,0xefe3f01d,0xefa7efc1,0xefb8efa3,
-0xf007efd2,0xf05bf030,0xf0d8f092,0xf190f129,0xf28cf20c,0xf3c1f323,0xf544f480,0xf72cf62e,
-0xf960f841,0xfb9dfa7b,0xfd8ffc9e,0xff38fe76,0x0035ffd1,0x00860071,0x003a0072,0xff6dffe5,
-0xfe73feef,0xfdb0fe05,0xfd47fd67,0xfd6afd4a,0xfe0bfdaa,0xff1ffe8a,0x0039ffac,0x010b00b3,
-0x0131013d,0x008800fc,0xff0effdf,0xfd1cfe2a,0xfb01fc0f,0xf947fa1d,0xf83bf8aa,0xf7aff7e6,
-0xf799f795,0xf7cdf7ac,0xf802f7e5,0xf800f80a,0xf7aaf7d6,0xf737f77a,0xf6b8f6fa,0xf662f68b,
-0xf661f658,0xf6bdf680,0xf77df70b,0xf87ef7f5,0xf989f909,0xfa74fa0f,0xfb21fad6,0xfb97fb62,
-0xfbc9fbb2,0xfbb4fbc1,0xfb63fb91,0xfad4fb1d,0xfa22fa7c,0xf963f9c6,0xf8a2f901,0xf7edf844,
-0xf752f79c,0xf6d0f70b,0xf64df68f,0xf5cdf611,0xf535f583,0xf4a8f4eb,0xf42ff469,0xf3e6f408,
-0xf3e0f3d1,0xf432f3fd,0xf4bdf475,0xf560f513,0xf5e0f5a8,0xf64cf624,0xf6a3f679,0xf6fdf6cd,
-0xf77cf731,0xf84cf7d8,0xf951f8c1,0xfa93f9e7,0xfbf6fb3e,0xfd62fcae,0xfebdfe13,0xffdeff4e,
-0x00b60057,0x010100f8,0x00b000f8,0xffaa004b,0xfdf9fee1,0xfbd8fcee,0xf99cfab5,0xf796f886,
-0xf603f6b8,0xf507f56d,0xf4b5f4c7,0xf510f4d4,0xf5edf573,0xf71ef684,0xf854f7b8,0xf978f8eb,
-0xfa6bf9fe,0xfb0bface,0xfb29fb36,0xfac8fb13,0xf9c5fa5b,0xf80cf8fe,0xf5caf6f9,0xf329f47c,
-0xf079f1ce,0xedd8ef1c,0xeb96eca6,0xea15eab6,0xe97ee9a7,0xe9e7e98c,0xeb6fea87,0xee1aecaf,
-0xf1bfefd3,0xf5e9f3d3,0xfa31f81e,0xfe20fc3c,0x0154ffd6,0x03a0029e,0x04cc0462,0x04c804f7,
-0x03b00461,0x01c102cb,0xff26007d,0xfc30fda5,0xf956fab7,0xf6e4f810,0xf515f5ea,0xf3f8f471,
-0xf3a4f3bc,0xf401f3bf,0xf4fef46b,0xf648f596,0xf7a9f706,0xf8c2f83e,0xf96af91f,0xf990f98f,
-0xf958f982,0xf8d7f919,0xf85af89d,0xf802f82e,0xf7f1f7f1,0xf854f818,0xf911f8ab,0xfa4af9a6,
-0xfbeffb15,0xfe02fcea,0x009dff3b,0x03b00215,0x07320561,0x0aff0914,0x0ebe0ce1,0x123e1084,
-0x153613cc,0x17671671,0x1894181c,0x18c818cf,0x182e188b,0x170e17b3,0x15af1663,0x1472150d,
-0x13b01402,0x13a81397,0x146213f4,0x15cd1507,0x17af16b1,0x19cf18b4,0x1bd41ace,0x1d991cbf,
-0x1ee71e50,0x1faf1f60,0x1feb1fdc,0x1fab1fd7,0x1f011f66,0x1df91e8a,0x1cb81d69,0x1b4d1c07,
-0x19b01a87,0x180b18dc,0x16721739,0x14fa15ae,0x13b0144f,0x12941317,0x11891212,0x10721101,
-0x0f330fd5,0x0d9f0e6e,0x0bdc0cbd,0x0a030ae9,0x087a092e,0x076707e2,0x06be0704,0x06880696,
-0x06af0695,0x070706d9,0x0794074d,0x086207f1,0x099a08f2,0x0b570a63,0x0d880c60,0x10220ecb,
-0x13001188,0x160c1483,0x193717a2,0x1c5d1ace,0x1f7a1df7,0x223a20eb,0x247b2374,0x25f72557,
-0x268e265e,0x2618266e,0x249b2578,0x221e237b,0x1ec12089,0x1ace1cd5,0x168c18bb,0x121d1454,
-0x0dc50fee,0x09b30bb2,0x05c707b3,0x022303ea,0xfea80066,0xfb6afcfe,0xf88ef9eb,0xf633f74e,
-0xf47ef53d,0xf370f3d4,0xf2e9f316,0xf2d2f2cb,0xf30df2de,0xf36ef338,0xf3ecf398,0xf4a9f43b,
-0xf5bef528,0xf722f66a,0xf8d0f7f4,0xfaa6f9bb,0xfc68fb92,0xfe16fd4e,0xff8dfeda,0x0096001f,
-0x013600f6,0x01580157,0x00f10138,0x00030087,0xfec0ff6d,0xfd23fdf3,0xfb51fc3b,0xf99cfa68,
-0xf838f8dd,0xf73ff7ae,0xf696f6df,0xf637f658,0xf5f5f611,0xf5c0f5dd,0xf596f5aa,0xf543f56b,
-0xf49bf4f5,0xf38af41d,0xf1fdf2dd,0xefe4f106,0xed47eeb0,0xea0eebc3,0xe646e839,0xe233e444,
-0xde29e02b,0xda7cdc3f,0xd772d8da,0xd54bd63f,0xd435d4a3,0xd405d402,0xd499d442,0xd5aad51d,
-0xd6f6d654,0xd839d79e,0xd98bd8e3,0xdae0da38,0xdc3fdb93,0xdd99dced,0xdedede3b,0xdfffdf6b,
-0xe116e086,0xe245e1a4,0xe3bde2f6,0xe59be49e,0xe7d7e6ae,0xea72e91c,0xed47ebdf,0xf00eeeb5,
-0xf25ef14d,0xf411f34f,0xf512f4ad,0xf555f54a,0xf50ef543,0xf448f4b9,0xf35cf3d3,0xf26ef2e7,
-0xf1b5f204,0xf13af17a,0xf106f119,0xf113f10b,0xf13ff131,0xf14df14d,0xf13ef147,0xf0f8f11b,
-0xf08ff0c3,0xf01bf049,0xefe4eff4,0xf033eff7,0xf116f08c,0xf29bf1bb,0xf49df38d,0xf6f2f5bb,
-0xf952f826,0xfb8bfa77,0xfd81fc8b,0xfef3fe4a,0xffdcff77,0x004c0026,0x005f0060,0x003e0051,
-0x0002001f,0xffc7ffe3,0xff96ffaa,0xff9cff90,0xffd1ffab,0x0056000e,0x00fb00aa,0x017b0144,
-0x01c301b0,0x01a901c4,0x01230172,0x004300c0,0xff49ffc1,0xfe83fee6,0xfe19fe3d,0xfe6cfe30,
-0xff8ffee5,0x01820073,0x042302c2,0x072305a1,0x0a2c08a7,0x0cf00ba1,0x0f4d0e3d,0x10e41032,
-0x11d0116d,0x122d1208,0x121c1229,0x11df11ff,0x11a411bd,0x118c1194,0x119f118d,0x11a211a2,
-0x11a011a3,0x115b117f,0x10e51126,0x103f1098,0x0fa60ff4,0x0efc0f5a,0x0e700eb0,0x0dce0e20,
-0x0d1e0d67,0x0c950cd8,0x0c4f0c6d,0x0c7c0c5b,0x0d1c0cbf,0x0e210d93,0x0f8c0ecb,0x11281058,
-0x12c911f9,0x143b1389,0x158214e7,0x168b160f,0x178e170c,0x186d17fd,0x193b18d4,0x19d3198a,
-0x1a2819fd,0x1a311a35,0x19ac19fe,0x18a8193b,0x172417ef,0x15461636,0x1350144a,0x1173125c,
-0x0fe410a4,0x0e990f38,0x0d990e16,0x0cd20d2f,0x0c1f0c7d,0x0b570bb9,0x0a760ae8,0x099e0a04,
-0x08db0936,0x0828087a,0x07a907e8,0x07420778,0x07020723,0x06ee06ef,0x070106f7,0x07350718,
-0x07870760,0x07dc07b4,0x082d0806,0x087c0852,0x08cd08ab,0x09410909,0x09e4098f,0x0a9b0a41,
-0x0b590afa,0x0c010bb9,0x0c760c4b,0x0c8a0c8d,0x0c2d0c63,0x0b670bd1,0x0a740aeb,0x095609e1,
-0x084208c9,0x074a07c1,0x06a506e5,0x0654066e,0x06670650,0x06ef069d,0x07c50754,0x08dd084a,
-0x0a1b0987,0x0b3b0ab3,0x0c340bc2,0x0cd20c8e,0x0d0c0cff,0x0cc70cfb,0x0c030c76,0x0ab80b6f,
-0x08e209dc,0x068507c2,0x03a60520,0x00760214,0xfd14fec7,0xf9adfb61,0xf64df7f7,0xf33cf4b6,
-0xf0a2f1d9,0xeee9efac,0xee19ee60,0xee70ee26,0xefaaeef4,0xf17cf088,0xf390f282,0xf572f48d,
-0xf6e1f63f,0xf79df756,0xf7adf7b8,0xf70ff774,0xf5eaf687,0xf441f520,0xf251f34f,0xf04ef14a,
-0xee82ef60,0xed12edc0,0xec15ec86,0xeb98ebcd,0xeb98eb88,0xec0cebc4,0xecd2ec63,0xee00ed64,
-0xef7beeb1,0xf131f050,0xf316f227,0xf4e8f408,0xf673f5b8,0xf793f70f,0xf863f806,0xf8f9f8b2,
-0xf959f92d,0xf988f975,0xf999f994,0xf999f9a0,0xf987f98e,0xf968f978,0xf949f959,0xf946f947,
-0xf97af95e,0xf9d4f99f,0xfa72fa1b,0xfb2dfacc,0xfbf9fb90,0xfc8ffc41,0xfce1fcbd,0xfce9fce6,
-0xfcb1fccd,0xfc16fc69,0xfb46fba8,0xfa8afae8,0xfa07fa41,0xf9eff9ed,0xfa59fa15,0xfb3dfac2,
-0xfc66fbd1,0xfda8fd0c,0xfec9fe49,0xff89ff2f,0xffe6ffbc,0xffd7ffe3,0xff7fffaf,0xff0cff48,
-0xfea9fed9,0xfe69fe8c,0xfe3ffe4e,0xfe44fe43,0xfe1efe2c,0xfdc7fdf4,0xfd34fd84,0xfc5ffcd4,
-0xfb42fbda,0xfa07faa2,0xf8d2f968,0xf7e7f84a,0xf762f792,0xf751f747,0xf792f76c,0xf7f6f7c4,
-0xf863f830,0xf8b4f894,0xf8ddf8cb,0xf8cef8e6,0xf884f8b9,0xf7e7f83e,0xf721f788,0xf62df6a7,
-0xf527f5a5,0xf40bf493,0xf307f380,0xf22df28a,0xf1aaf1dd,0xf186f18c,0xf1d7f1a5,0xf272f21d,
-0xf356f2df,0xf465f3e4,0xf57bf4f5,0xf671f602,0xf744f6e5,0xf7ebf799,0xf881f82b,0xf91bf8c3,
-0xf9d5f969,0xfae4fa53,0xfc4efb8f,0xfde9fd1b,0xff7ffebc,0x00ed0042,0x01ee0180,0x02770245,
-0x026c0285,0x01d40233,0x00b80156,0xff2afffe,0xfd0ffe2c,0xfa90fbd8,0xf7ebf93d,0xf563f6a0,
-0xf312f42a,0xf147f216,0xf02ef0a5,0xefeeeff3,0xf08af024,0xf209f12c,0xf44af315,0xf711f5a4,
-0xf9faf88b,0xfc9afb5a,0xfea8fdb1,0x0018ff74,0x00ce0088,0x010000f9,0x00de00f9,0x00a000c4,
-0x0060007b,0x00450047,0x00660045,0x00d90096,0x016e0120,0x025001dc,0x034302ca,0x043903c0,
-0x04f904a7,0x0560053c,0x054a0563,0x04b1050b,0x03940431,0x020902d9,0x00530135,0xfe69ff5a,
-0xfcb4fd87,0xfb5afbf9,0xfa96fae2,0xfa70fa70,0xfae4fa95,0xfbd3fb48,0xfcfdfc5e,0xfe42fd99,
-0xff55fecc,0x0034ffc5,0x00ef0096,0x01980144,0x024701f1,0x02e00292,0x03720326,0x03f503ad,
-0x04780439,0x052804d2,0x062e05aa,0x07b106e8,0x09930896,0x0bdd0aa6,0x0e8f0d21,0x119a0ffe,
-0x14fe1348,0x188816c0,0x1c0e1a47,0x1f631db6,0x227e20fa,0x252c23e4,0x2739264f,0x289c2804,
-0x293228fb,0x2934293b,0x28b82903,0x27fa2861,0x2702277f,0x25ff267e,0x24df2570,0x23bb244a,
-0x229c232e,0x215f220c,0x200020be,0x1e801f48,0x1ccb1da4,0x1b041beb,0x192f1a17,0x175e184b,
-0x15811670,0x13b7149e,0x11e912cf,0x10411117,0x0eb60f78,0x0d5a0e03,0x0c210caf,0x0b3f0ba4,
-0x0aa20ae7,0x0a7a0a82,0x0ac10a8b,0x0b700b0f,0x0c7b0bf0,0x0dba0d1e,0x0ee70e59,0x0fb10f57,
-0x101c0ff6,0x1002101f,0x0f6f0fbd,0x0ea00f00,0x0db50e29,0x0cc60d37,0x0be60c50,0x0b320b81,
-0x0ac30aef,0x0a910aa0,0x0a670a71,0x0a510a5f,0x0a3a0a47,0x09dd0a1b,0x09150980,0x08040898,
-0x06930755,0x04db05bb,0x030303f2,0x01230218,0xff4b0035,0xfd98fe6f,0xfbe1fcc4,0xfa1dfb02,
-0xf84af934,0xf66ef759,0xf49af583,0xf2f2f3bf,0xf161f21d,0xf02df0bd,0xef3aefae,0xee90eedb,
-0xee2eee4e,0xee13ee15,0xee0cee0a,0xee17ee1a,0xee05ee12,0xedb0eddf,0xed10ed63,0xec22ec9e,
-0xeadceb88,0xe962ea24,0xe7e7e8ab,0xe691e73a,0xe59ce607,0xe552e567,0xe5c7e576,0xe6cbe635,
-0xe852e783,0xea13e932,0xebd6eafa,0xed5aeca2,0xee59edeb,0xee9bee8a,0xee1aee72,0xecbaed7c,
-0xeacdebd0,0xe888e9ae,0xe645e769,0xe44de53b,0xe2fbe390,0xe265e296,0xe2bee274,0xe3f3e340,
-0xe5e2e4d5,0xe847e70c,0xead9e993,0xed18ec0d,0xeec4edfe,0xefcfef5c,0xf032f009,0xeffef028,
-0xef2eefa0,0xee01ee9b,0xeca4ed53,0xeb52ebf5,0xea11eab3,0xe8f2e97a,0xe7f2e876,0xe6f6e773,
-0xe600e67d,0xe52fe58a,0xe4b0e4e6,0xe48ce48e,0xe4dde4aa,0xe595e52f,0xe6c5e61e,0xe869e78a,
-0xea6ae95e,0xecb0eb81,0xef34eded,0xf1cbf078,0xf458f318,0xf6b8f598,0xf8c6f7cd,0xfa75f9ac,
-0xfbdcfb31,0xfd18fc83,0xfe5afdbe,0xff9efefd,0x00ef0048,0x02320195,0x034002c0,0x040c03a5,
-0x04a70461,0x04f104d0,0x050a0508,0x0506050d,0x04d104f6,0x046704a1,0x03a3040c,0x02850320,
-0x010d01d8,0xff3d002d,0xfd32fe3a,0xfb00fc1d,0xf8b6f9de,0xf67cf799,0xf480f579,0xf2e2f3a9,
-0xf1c6f245,0xf135f169,0xf153f131,0xf20cf199,0xf347f297,0xf50ef418,0xf74af61d,0xf9fdf894,
-0xfd0bfb73,0x0055fea8,0x03a601ff,0x06c3053d,0x09950845,0x0c050ae4,0x0de20d0f,0x0f430ea8,
-0x101d0fbf,0x10911063,0x10c510b5,0x10bc10cb,0x108d10a9,0x10571074,0x1038104b,0x104a1047,
-0x10991075,0x110a10d0,0x118c1146,0x120d11cc,0x12461232,0x12511258,0x1227123c,0x11e51203,
-0x11b411c6,0x11b011ac,0x120f11c8,0x1306127a,0x14511397,0x15fe151c,0x17b916d5,0x194f1888,
-0x1a9019fc,0x1b751b0c,0x1bf01bc1,0x1bf21c00,0x1b891bc8,0x1b031b4c,0x1a571ab4,0x198d19f7,
-0x18a81920,0x17a41828,0x16811710,0x154f15e6,0x141e14ba,0x12f21389,0x11c6125a,0x10ce1144,
-0x0ffe105e,0x0f760fb3,0x0f230f45,0x0efc0f0c,0x0f060efa,0x0f430f1a,0x0fab0f70,0x10360fe8,
-0x10e51087,0x1196113c,0x126211fa,0x134b12d5,0x143d13cb,0x14ef149d,0x154b1528,0x1506153c,
-0x1413149e,0x125b134e,0x0ff6113e,0x0d0e0e96,0x09df0b7e,0x06a40845,0x03ac051c,0x014e0269,
-0xff9a0057,0xfe95ff01,0xfe25fe43,0xfe0efe0e,0xfe25fe19,0xfe43fe33,0xfe72fe5a,0xfe96fe84,
-0xfeabfea3,0xfe99feaa,0xfe65fe8b,0xfdeafe32,0xfd34fd98,0xfc74fcd4,0xfbc6fc18,0xfb61fb86,
-0xfb5afb52,0xfbccfb84,0xfc8afc1b,0xfd99fd0a,0xfec3fe27,0xffd6ff55,0x00bb004e,0x01650117,
-0x01d301a2,0x021501f5,0x021b021b,0x01ee0205,0x019a01c6,0x01320166,0x00ae00f2,0x00200061,
-0xff98ffda,0xff19ff54,0xfea9fede,0xfe6ffe86,0xfe72fe6b,0xfeb2fe90,0xff17fede,0xff84ff50,
-0xffc7ffab,0xffb3ffcf,0xff3aff88,0xfe6ffee6,0xfd23fdcd,0xfba2fc68,0xfa0bfad9,0xf855f936,
-0xf695f776,0xf4d9f5b9,0xf332f400,0xf198f266,0xf015f0de,0xeea9ef5e,0xed70ee0c,0xec63ece8,
-0xeb84ebeb,0xeae2eb2b,0xea7deaa2,0xea4cea58,0xea6fea53,0xead4ea95,0xeb8deb26,0xec88ec00,
-0xedb1ed1c,0xeef7ee51,0xf03fefa3,0xf16df0dd,0xf24cf1e7,0xf2d1f293,0xf30ff2fc,0xf307f314,
-0xf2c7f2f2,0xf275f2a0,0xf22cf24b,0xf20af211,0xf22af20c,0xf2b2f25d,0xf387f314,0xf4b4f41d,
-0xf5ecf54a,0xf73af695,0xf862f7d5,0xf974f8f5,0xfa3ef9e3,0xfabefa88,0xfb0afae2,0xfb21fb20,
-0xfb29fb27,0xfb0ffb1b,0xfafdfafa,0xfafcfaf0,0xfb15fb03,0xfb5afb31,0xfbb6fb85,0xfc50fbff,
-0xfd0cfcb0,0xfdf0fd84,0xfeeffe70,0x0008ff81,0x01120092,0x020e018b,0x02e50279,0x03990342,
-0x043103e4,0x04a0046b,0x04e404c3,0x04f104ee,0x04d004e6,0x049404b7,0x0426046a,0x036403d3,
-0x026802f0,0x013101db,0xffbd007c,0xfe3ffefa,0xfccafd79,0xfb81fc1c,0xfa88fafa,0xf9c6fa22,
-0xf959f984,0xf930f93e,0xf94ff935,0xf986f967,0xf9d1f9ad,0xfa0ff9f0,0xfa31fa2b,0xfa19fa33,
-0xf9cff9f8,0xf943f987,0xf89ff8f2,0xf7faf84f,0xf77cf7b4,0xf733f755,0xf732f730,0xf799f761,
-0xf83bf7e3,0xf911f89e,0xf9e2f97d,0xfa8efa3f,0xfae6fac6,0xfad0faec,0xfa20fa8a,0xf8f8f99a,
-0xf756f827,0xf579f666,0xf392f47a,0xf1ecf2b8,0xf0cdf148,0xf068f08c,0xf0c0f084,0xf1bff133,
-0xf35bf280,0xf540f446,0xf73ff64b,0xf900f82d,0xfa52f9c5,0xfb22fad0,0xfb64fb59,0xfb43fb5d,
-0xfb00fb25,0xfac5fadb,0xfacafab7,0xfb0ffad9,0xfb82fb47,0xfc16fbc8,0xfca3fc65,0xfd06fcdf,
-0xfd1efd1e,0xfcd5fd07,0xfc1dfc86,0xfb1efba2,0xfa0ffa9d,0xf8f4f980,0xf803f871,0xf765f7a5,
-0xf73bf73f,0xf78af751,0xf851f7e0,0xf98df8e0,0xfb3efa56,0xfd5bfc3d,0xffe7fe96,0x02ce014e,
-0x06120467,0x099007c1,0x0d310b5f,0x10c10ef8,0x14341282,0x176c15dc,0x1a3718e2,0x1c801b77,
-0x1e411d75,0x1f591ee2,0x1fdf1fad,0x1fbd1fe4,0x1f021f6b,0x1dc81e72,0x1c2b1d04,0x1a431b38,
-0x183a193a,0x162a172e,0x141a151f,0x1225131c,0x1043112d,0x0e820f65,0x0ce40db0,0x0b5b0c27,
-0x09f00aa8,0x089f0943,0x07a8081b,0x06f70741,0x06bb06c4,0x06e106b9,0x074c070d,0x07fa079f,
-0x08dd0863,0x09fd0969,0x0b5c0aa7,0x0ce70c19,0x0e820daf,0x102c0f55,0x119610ed,0x12c3123a,
-0x139f133f,0x141d13f0,0x1436143c,0x13e6141b,0x137913b7,0x12ec132e,0x126a129c,0x123a1247,
-0x125a123e,0x12f4129b,0x13f2135f,0x15571493,0x16e8161b,0x188e17bb,0x1a31196e,0x1b941aee,
-0x1ca91c33,0x1d551d0c,0x1da21d8e,0x1d861daa,0x1d081d61,0x1c331cab,0x1af11ba2,0x194a1a29,
-0x17311851,0x14cc1609,0x123a138f,0x0f9b10f2,0x0d140e57,0x0acf0beb,0x08e109d0,0x073a0809,
-0x05cf067a,0x045d050d,0x02d30398,0x00fd01ec,0xfef6fffb,0xfcd9fde3,0xfacffbc9,0xf911f9ec,
-0xf7c4f865,0xf6daf744,0xf669f690,0xf65ef651,0xf692f66e,0xf6eef6bd,0xf758f725,0xf7c5f78d,
-0xf82bf7fd,0xf873f84f,0xf89bf88c,0xf899f893,0xf868f887,0xf81bf843,0xf7ccf7fe,0xf77af7a8,
-0xf724f752,0xf6ccf6f4,0xf67cf6a9,0xf648f65a,0xf614f62b,0xf5b9f5e3,0xf53ef585,0xf478f4e2,
-0xf384f406,0xf260f2fa,0xf10df1c0,0xef99f053,0xee0feed4,0xec7aed41,0xeae6ebad,0xe950ea1b,
-0xe7c7e88b,0xe65fe718,0xe501e5ac,0xe3e8e470,0xe30fe378,0xe276e2ba,0xe22ae242,0xe210e217,
-0xe219e20c,0xe23ae21c,0xe26ae249,0xe2a5e282,0xe2e3e2c4,0xe322e305,0xe375e34c,0xe3d2e3a3,
-0xe456e410,0xe50be4a8,0xe607e57f,0xe772e6b0,0xe942e84e,0xeb61ea48,0xeda0ec84,0xefc8eeb5,
-0xf1adf0c1,0xf321f278,0xf40cf3a8,0xf431f438,0xf3bcf405,0xf2b2f34d,0xf14cf20c,0xefb5f085,
-0xee37eef2,0xecf4ed89,0xec18ec7a,0xebadebd5,0xebb9eba8,0xec36ebe3,0xed0dec9a,0xee09ed88,
-0xeef2ee85,0xef9eef5b,0xefe3efce,0xefbeefe1,0xef4fef90,0xeea9eefa,0xee1aee5b,0xedb5ede0,
-0xed97ed9c,0xedc2eda5,0xee40edfb,0xeee3ee90,0xef81ef2f,0xefe0efbd,0xeff1efe7,0xefb9efd9,
-0xef4fef84,0xeee0ef13,0xeebbeec6,0xeee3eec3,0xefa5ef2f,0xf0e8f02d,0xf2d9f1c4,0xf555f3ff,
-0xf85cf6c5,0xfbdffa10,0xffbcfdcc,0x03a201b7,0x07730593,0x0b030947,0x0e200c9f,0x10c00f84,
-0x12ec11e3,0x14b313d7,0x1633157d,0x177516d9,0x18881800,0x19791901,0x1a2019d4,0x1a791a50,
-0x1a671a7a,0x19f81a3a,0x1932199c,0x182518b7,0x16c31772,0x153515fa,0x1368144e,0x11661271,
-0x0f43105c,0x0cfc0e32,0x0aae0bdc,0x086e0992,0x06550754,0x04790559,0x02d70394,0x018d022b,
-0x00ac0110,0x002b005e,0xffff0003,0x00290004,0x00a5005a,0x016e00fc,0x028801f3,0x04200349,
-0x06290518,0x088e0757,0x0b5709ef,0x0e690ce1,0x118a0fee,0x149e131c,0x1762160a,0x19d618ae,
-0x1bbd1adb,0x1d1a1c7d,0x1de41d8a,0x1e331e19,0x1e231e34,0x1dbe1df7,0x1d2f1d7b,0x1c8d1cde,
-0x1bf21c3e,0x1b491ba4,0x1aa31af8,0x19eb1a4b,0x190a197c,0x1818188d,0x1704178f,0x15b61658,
-0x144514fc,0x12b81375,0x113911f7,0x0ff01089,0x0f100f7b,0x0ea90ed3,0x0e980e99,0x0eb80ea3,
-0x0ee20ecf,0x0f0a0efc,0x0f270f19,0x0f460f35,0x0f590f4b,0x0f710f68,0x0f7b0f75,0x0f6c0f75,
-0x0f370f56,0x0ec40f0c,0x0e0a0e77,0x0cf80d90,0x0b930c50,0x09f20acb,0x082f0919,0x06510749,
-0x047a056d,0x02bd0399,0x012c01ee,0xffdf007a,0xfed5ff50,0xfe1cfe6a,0xfdb9fdd9,0xfdb1fda7,
-0xfe0dfdd1,0xfeaffe52,0xff70ff09,0x0042ffe1,0x010f00ab,0x01a3016b,0x01e601d3,0x01f301fa,
-0x01b101da,0x01280169,0x008e00df,0x0005003f,0xff7effbc,0xfee0ff2f,0xfe2ffe88,0xfd5efdcd,
-0xfc5afce6,0xfb31fbca,0xf9d5fa8e,0xf851f916,0xf6c4f791,0xf539f600,0xf3d3f47c,0xf280f322,
-0xf160f1ea,0xf071f0e2,0xefc7f014,0xef6eef8b,0xef76ef63,0xefccef8e,0xf07cf019,0xf178f0f8,
-0xf2a5f20c,0xf3cdf339,0xf4dcf45a,0xf5b7f54c,0xf63ff605,0xf68ff670,0xf6b2f6a3,0xf6e5f6c7,
-0xf713f6f3,0xf754f732,0xf7adf784,0xf81ff7e4,0xf896f85a,0xf910f8d5,0xf961f943,0xf977f977,
-0xf94cf970,0xf8f8f926,0xf881f8bc,0xf80bf843,0xf7c1f7e4,0xf797f7a7,0xf78af791,0xf78bf78e,
-0xf7b6f79c,0xf80df7db,0xf889f848,0xf93cf8d9,0xfa1cf99f,0xfb1efa96,0xfc24fb9b,0xfd25fcaa,
-0xfdd8fd8d,0xfe38fe10,0xfe2efe43,0xfdccfe0f,0xfd12fd7d,0xfbfefc97,0xfab4fb6a,0xf931f9f8,
-0xf7a2f86a,0xf60df6d4,0xf4aaf559,0xf3b0f423,0xf311f357,0xf2d9f2e7,0xf2f4f2e0,0xf35df32e,
-0xf3eff3ab,0xf49ff451,0xf54bf4fd,0xf5f7f5a1,0xf67ef63a,0xf6d8f6ad,0xf708f6ed,0xf708f703,
-0xf6eaf6f7,0xf6aff6c9,0xf66bf690,0xf60ef63c,0xf5b1f5df,0xf551f582,0xf4f9f523,0xf4a3f4cc,
-0xf453f47a,0xf40ff427,0xf3e1f3f2,0xf3d8f3d6,0xf3f9f3e5,0xf449f417,0xf4e5f48f,0xf5c6f54b,
-0xf6cbf641,0xf7f1f75a,0xf93bf892,0xfa73f9df,0xfb88fb08,0xfc70fbfe,0xfd2dfcd6,0xfdbcfd80,
-0xfe1dfdf3,0xfe5dfe45,0xfe72fe69,0xfe5efe6f,0xfe28fe40,0xfde4fe09,0xfd9ffdc5,0xfd4dfd78,
-0xfd10fd33,0xfcdbfcf4,0xfcccfcd1,0xfcfffce0,0xfd7bfd36,0xfe2afdcb,0xff00fe8f,0xffc6ff5c,
-0x006c0017,0x00da00a9,0x010700ff,0x00fb010b,0x00b800e1,0x0064008f,0x0010003c,0xffdbfff3,
-0xffd8ffde,0x0018ffee,0x009b004b,0x017300f9,0x027c01e9,0x038602ff,0x045d03f6,0x04e804ad,
-0x04fd04fe,0x04a104d4,0x03fa0457,0x02fc0383,0x01ef0277,0x00f1016d,0x0015007a,0xff86ffbf,
-0xff41ff5e,0xff4cff43,0xffb7ff7c,0x00540002,0x010600b0,0x01960159,0x01fb01d9,0x01ff0210,
-0x01ad01e1,0x010f0162,0x003800ac,0xff47ffbe,0xfe4bfeca,0xfd81fde4,0xfcd0fd2a,0xfc51fc8e,
-0xfbecfc1e,0xfb6efbab,0xfad4fb20,0xfa00fa6d,0xf8f9f981,0xf7e3f86e,0xf6e3f75e,0xf62cf67b,
-0xf5fdf60e,0xf669f61e,0xf77ef6dd,0xf926f845,0xfb5efa31,0xfde3fc94,0x0098ff38,0x034401f1,
-0x058b0478,0x07580684,0x088d0802,0x093508ee,0x0970095c,0x098f0981,0x09ac099a,0x09fa09ca,
-0x0a7c0a33,0x0b470ada,0x0c640bd0,0x0dc20d09,0x0f680e90,0x11561059,0x1376125e,0x15bc1494,
-0x181b16e8,0x1a4e1937,0x1c2a1b49,0x1db41d00,0x1ed01e56,0x1f911f3d,0x20031fd3,0x2051202e,
-0x208a2068,0x20ba209f,0x20fa20dd,0x21492128,0x21912179,0x21aa21ab,0x2171219c,0x20af2123,
-0x1f6f2022,0x1daa1e9c,0x1b7e1c9c,0x191c1a47,0x16b417dd,0x1454157c,0x121b132b,0x1019110b,
-0x0e4f0f28,0x0cab0d7c,0x0b1a0be1,0x09af0a5a,0x086708fc,0x074d07d2,0x066106ca,0x058d05f3,
-0x04e5052e,0x04550499,0x03f6041d,0x03b503cd,0x0393039f,0x038a0391,0x038b038a,0x03940396,
-0x03aa039f,0x03e703c4,0x04540419,0x050c04a9,0x060a0583,0x075d06ae,0x08e7081e,0x0aa409c1,
-0x0c700b8a,0x0e170d43,0x0f660ed1,0x103a0fdd,0x107f106b,0x1037106b,0x0f630fda,0x0e1e0ec9,
-0x0c7b0d51,0x0a860b87,0x0847096b,0x05c40710,0x031f0472,0x007c01d2,0xfde0ff37,0xfb75fcab,
-0xf93dfa55,0xf765f840,0xf5d7f693,0xf4b2f538,0xf3e2f443,0xf348f386,0xf2bef2fb,0xf236f27e,
-0xf18bf1e8,0xf0b9f123,0xefc5f042,0xeeb9ef34,0xedb4ee31,0xeccbed31,0xec19ec6a,0xebb8ebe3,
-0xeb8aeb9d,0xeb90eb87,0xebb3eba1,0xebf5ebca,0xec0fec0d,0xec06ec16,0xebc8ebfb,0xeb28eb8b,
-0xea37eab8,0xe91ce9a3,0xe808e88e,0xe72ce79b,0xe696e6e2,0xe66de67a,0xe6aee680,0xe755e6f2,
-0xe844e7c4,0xe95ce8c8,0xea8ee9f1,0xebb1eb2b,0xeca8ec36,0xed4ded06,0xed84ed76,0xed2ded6f,
-0xec49ecc9,0xead0eb9e,0xe8ede9e7,0xe6d7e7f1,0xe4a4e5bc,0xe285e38b,0xe0c3e193,0xdf65dffc,
-0xde93dee6,0xde47de54,0xde73de50,0xdeffdeab,0xdfd0df62,0xe0d4e050,0xe1f7e15f,0xe325e290,
-0xe44ee3af,0xe57ae4e3,0xe6ace614,0xe7e1e745,0xe916e880,0xea58e9bb,0xebb6eb05,0xed40ec75,
-0xeef8ee0f,0xf0edefe7,0xf316f200,0xf554f432,0xf79bf679,0xf9d6f8c5,0xfbd4fadc,0xfd78fcb1,
-0xfe9dfe17,0xff37ff04,0xff2dff4a,0xfeb6ff01,0xfdc9fe47,0xfcacfd40,0xfb9bfc21,0xfaadfb15,
-0xfa1ffa5a,0xfa0ffa0b,0xfa7efa3b,0xfb41fada,0xfc46fbbc,0xfd6cfcd5,0xfe8cfdff,0xff97ff0f,
-0x00860015,0x013f00e4,0x01db018c,0x0255021a,0x02c20287,0x033002f0,0x03b30368,0x046d0409,
-0x053b04cd,0x063005ac,0x074406b1,0x088b07df,0x09cc0920,0x0b100a6c,0x0c480bae,0x0d700ce6,
-0x0ea20e0c,0x0fc90f39,0x11031063,0x124e11a9,0x13b61300,0x15281470,0x16b415f1,0x1829176e,
-0x198218dd,0x1a9d1a16,0x1b6e1b08,0x1be51bb4,0x1be91bf2,0x1b6b1bb8,0x1a871afe,0x194419ed,
-0x17d5188d,0x165e1720,0x14df159c,0x13851440,0x122412d8,0x10bc1179,0x0f3b0fff,0x0da00e6a,
-0x0c030cc1,0x0a9c0b45,0x096f09f9,0x08b708fd,0x08680884,0x08880868,0x091008c5,0x09d80978,
-0x0ad40a61,0x0bdd0b5d,0x0cd10c60,0x0d870d31,0x0e000dc7,0x0e200e12,0x0de60e04,0x0d6e0dac,
-0x0ccf0d20,0x0c280c78,0x0ba00be6,0x0b480b70,0x0b370b3b,0x0b6f0b48,0x0bff0bb1,0x0cbc0c58,
-0x0d990d29,0x0e6e0e05,0x0f300ed0,0x0ff00f95,0x1096103f,0x113610e6,0x11be117e,0x12481206,
-0x12b61285,0x132d12f3,0x138e1360,0x13c713a7,0x13fb13e6,0x14061405,0x13e41402,0x136813b9,
-0x12a8131a,0x1190122b,0x102910e3,0x0e930f60,0x0cc00da8,0x0ae70bd2,0x08fc09f6,0x071a0800,
-0x053f0628,0x037b0455,0x01c90299,0x00430100,0xfeddff90,0xfd98fe3c,0xfc71fcfb,0xfb5cfbe6,
-0xfa7ffae1,0xf9e7fa27,0xf9baf9c5,0xfa08f9cf,0xfad6fa67,0xfc19fb6c,0xfda3fcdc,0xff48fe75,
-0x00eb001e,0x025b01a4,0x036602e8,0x042003d5,0x046f0455,0x0453046a,0x03d70420,0x03200384,
-0x022902a2,0x010a0192,0xffda006c,0xfeb3ff40,0xfd8afe1f,0xfc66fcf5,0xfb35fbcd,0xfa07faa2,
-0xf8c4f96a,0xf772f81f,0xf61df6c8,0xf4d2f576,0xf3bff444,0xf30bf35b,0xf2ccf2dc,0xf306f2d1,
-0xf3c2f351,0xf4d8f43c,0xf63bf580,0xf7b8f6f9,0xf91ff873,0xfa49f9c4,0xfb16fac8,0xfb69fb53,
-0xfb24fb5b,0xfa4dfad1,0xf8d8f9a7,0xf6f3f7f6,0xf4a5f5d7,0xf22ef369,0xefd8f0fc,0xeddeeecc,
-0xec4fed05,0xeb47ebb9,0xeacdeaf7,0xeac7eab6,0xeb3feaf2,0xec06eb9b,0xed08ec84,0xee19ed91,
-0xef03ee9c,0xefc9ef70,0xf052f020,0xf0a4f084,0xf0cef0b9,0xf106f0e7,0xf142f126,0xf1b1f16c,
-0xf24ff1f3,0xf31cf2b4,0xf413f395,0xf52ef4a0,0xf670f5cb,0xf7daf725,0xf95cf8a0,0xfadffa1e,
-0xfc43fb8e,0xfd6afcd2,0xfe63fded,0xff11fec2,0xff78ff4e,0xff84ff8a,0xff48ff70,0xfecbff18,
-0xfe15fe79,0xfd45fdb6,0xfc63fcd8,0xfb7bfbf3,0xfa87fb00,0xf985fa06,0xf877f907,0xf754f7e7,
-0xf62ef6bd,0xf50cf599,0xf412f489,0xf36bf3ae,0xf338f342,0xf388f354,0xf464f3e8,0xf5b3f502,
-0xf73af673,0xf8eaf817,0xfa7bf9ba,0xfbcefb2f,0xfcaffc4a,0xfd0bfce9,0xfcf8fd04,0xfcaffcce,
-0xfc4afc72,0xfc12fc24,0xfc14fc08,0xfc6efc33,0xfce8fcaa,0xfd8ffd31,0xfe3bfde3,0xfee3fe8f,
-0xff4cff1d,0xff7bff6d,0xff80ff85,0xff3aff65,0xfed4ff10,0xfe46fe95,0xfdacfe02,0xfd0bfd57,
-0xfc78fcbc,0xfbc0fc1a,0xfb04fb64,0xfa44faa6,0xf990f9e5,0xf8f4f93a,0xf892f8b2,0xf888f87f,
-0xf8dff8a7,0xf9bef946,0xfb29fa6b,0xfce7fbfe,0xfee9fde7,0x010ffffd,0x03060215,0x04c503ee,
-0x05f8056a,0x06b20666,0x06ec06da,0x06c406e1,0x06490692,0x05d00610,0x05570595,0x04de0519,
-0x047c04ab,0x0411044e,0x039e03d3,0x0304034e,0x023a029d,0x014901c1,0x005300ce,0xff5cffd6,
-0xfe85fee9,0xfde6fe2e,0xfda0fdbd,0xfd9bfd92,0xfddffdb8,0xfe47fe10,0xfec3fe81,0xff48ff06,
-0xffbcff86,0x001bfff3,0x005e003d,0x009a007e,0x00f300c3,0x01560121,0x01d90196,0x025d0217,
-0x02d60299,0x032e0302,0x037d0355,0x03a5038f,0x03a403ab,0x03740385,0x03200349,0x02c402ed,
-0x026d0293,0x023e0258,0x02360235,0x027e0258,0x032002c6,0x04110394,0x054e04ab,0x06be0602,
-0x08360776,0x099308e8,0x0aa20a1f,0x0b630b0c,0x0bab0b8c,0x0b740b9d,0x0ae30b3a,0x09fe0a7a,
-0x08e20975,0x07c2085b,0x06bf0742,0x05db0647,0x053a0581,0x04ea0504,0x04f304e2,0x05660525,
-0x062f05c5,0x074706b1,0x088b07e1,0x09e50939,0x0b4e0a97,0x0ca70bfc,0x0df40d4e,0x0f1e0e8d,
-0x10380fac,0x113b10b8,0x123b11bb,0x134612be,0x147313de,0x15c01516,0x173f167d,0x18d91809,
-0x1a6c19ab,0x1bea1b31,0x1d231c96,0x1e021d9e,0x1e6f1e4a,0x1e5d1e7a,0x1dc61e28,0x1ca81d4d,
-0x1b0b1be4,0x19001a0d,0x16b817e0,0x14631591,0x12351342,0x10571139,0x0ef60f8d,0x0e1e0e76,
-0x0dfd0dfb,0x0e5c0e18,0x0f540ed0,0x10900fea,0x11f81140,0x134012a9,0x143613d2,0x14c31490,
-0x14c814dd,0x1449149b,0x135013e1,0x11fe12af,0x106d1140,0x0e9d0f89,0x0cbf0dae,0x0acc0bc1,
-0x08cb09c8,0x06b307bd,0x0481059a,0x02430367,0x000b012f,0xfde4fef9,0xfbfbfcec,0xfa59fb1a,
-0xf924f9af,0xf84ef8a8,0xf7d8f804,0xf7a1f7b5,0xf7aff7a3,0xf7c9f7be,0xf7dbf7d7,0xf7dbf7e0,
-0xf7c9f7d6,0xf790f7ac,0xf731f766,0xf6b9f6fb,0xf61ef672,0xf580f5cf,0xf4cbf529,0xf40ef46b,
-0xf358f3b1,0xf296f2f6,0xf1b8f223,0xf0bbf143,0xef82f029,0xee24eeda,0xec7bed5c,0xea9deb96,
-0xe882e993,0xe639e769,0xe3d7e50e,0xe16fe2a3,0xdf2de050,0xdd2cde23,0xdbaadc5a,0xdab4db1a,
-0xda5ada6e,0xdaa2da6b,0xdb88db01,0xdcd6dc27,0xde77dda5,0xe03ddf59,0xe207e117,0xe3b6e2e0,
-0xe54ae487,0xe6a7e600,0xe7f5e74c,0xe942e8a3,0xea9ae9ec,0xec2beb5f,0xeddeecff,0xefb0eec6,
-0xf184f09e,0xf33df26d,0xf4b1f403,0xf5c4f54b,0xf663f612,0xf6a4f690,0xf684f698,0xf640f66c,
-0xf5e0f610,0xf58df5b9,0xf55af577,0xf54df557,0xf549f549,0xf54bf546,0xf52cf53f,0xf4d5f507,
-0xf453f495,0xf370f3e1,0xf251f2e4,0xf101f1ab,0xef9ef059,0xee48eef9,0xed08eda1,0xebefec74,
-0xeb10eb7d,0xea79eac2,0xea39ea56,0xea3dea33,0xeaa0ea60,0xeb51eaed,0xec4aebc0,0xed8fece9,
-0xef0dee4a,0xf0afefe2,0xf251f17f,0xf3c8f30c,0xf514f477,0xf618f59f,0xf6eaf682,0xf785f738,
-0xf817f7ca,0xf8cdf862,0xf9bcf934,0xfb05fa54,0xfca9fbcb,0xfe9dfd9e,0x00dcffbb,0x0332020a,
-0x05880463,0x07b7069f,0x099a08af,0x0b280a6c,0x0c520bcb,0x0d140cbd,0x0d660d48,0x0d660d72,
-0x0d320d59,0x0cdd0d04,0x0c7f0cb7,0x0c340c4c,0x0c0a0c1e,0x0c110c02,0x0c540c32,0x0cc80c8b,
-0x0d450d05,0x0dcb0d85,0x0e3c0df8,0x0e920e63,0x0ec80eaa,0x0ede0ed4,0x0ed40edd,0x0eb90ecf,
-0x0e6a0e97,0x0df80e3d,0x0d450da4,0x0c630cde,0x0b5d0bde,0x0a7a0ae4,0x09d70a1d,0x09b009b7,
-0x0a0609cb,0x0af10a66,0x0c690b95,0x0e3c0d48,0x10640f4e,0x127d1172,0x14791388,0x1611154f,
-0x173f16ba,0x180117a9,0x185f1841,0x1882187a,0x187d1881,0x18651872,0x1838184f,0x18101825,
-0x17ea17fd,0x17c517d7,0x179417a6,0x1771177d,0x176f176f,0x1790177d,0x17c417ad,0x17d917d5,
-0x17e617e0,0x17bb17da,0x172c177d,0x163d16c8,0x14cf159c,0x12ee13f5,0x10b211e7,0x0e390f82,
-0x0b9b0cec,0x09160a53,0x06b807de,0x04b505ac,0x031503de,0x01f5027a,0x016401a1,0x013d0141,
-0x016c0148,0x01cc0196,0x024c0205,0x02ca028a,0x032a02fd,0x03830354,0x03d703ae,0x04390404,
-0x04b70471,0x05560505,0x05fa05a4,0x06af0652,0x07600701,0x082007bf,0x08e2087d,0x09b3094c,
-0x0a930a20,0x0b6d0b02,0x0c350bd4,0x0cca0c87,0x0d240cfa,0x0d360d34,0x0cf80d1d,0x0c7d0cb7,
-0x0be00c33,0x0b0e0b81,0x0a3d0ab3,0x094909ce,0x085008d4,0x074107cf,0x061706b3,0x04df0579,
-0x0382042e,0x021202c2,0x00a80157,0xff3fffe9,0xfdeafe89,0xfcb1fd4b,0xfb98fc2b,0xfa88fb1a,
-0xf96ffa06,0xf869f8f2,0xf758f7e0,0xf655f6d6,0xf57cf5e3,0xf4c5f516,0xf42ff46d,0xf3c7f3ef,
-0xf36bf399,0xf311f33d,0xf295f2d9,0xf1eaf23a,0xf11df188,0xf04cf0bb,0xef86efef,0xeee2ef33,
-0xee75eea9,0xee4aee56,0xee56ee48,0xeea1ee7c,0xeefceece,0xef67ef38,0xefcfef9a,0xf026effc,
-0xf070f042,0xf0aaf08b,0xf0ecf0c5,0xf130f107,0xf199f15e,0xf222f1dd,0xf2ebf286,0xf3daf362,
-0xf4d6f461,0xf5c8f554,0xf6bbf64d,0xf79bf72d,0xf869f805,0xf910f8c3,0xf998f95b,0xf9eaf9cd,
-0xfa00fa00,0xf9c1f9ef,0xf926f986,0xf834f8bd,0xf6f1f79e,0xf583f63f,0xf409f4bf,0xf2c7f35b,
-0xf1c4f236,0xf130f168,0xf111f114,0xf160f128,0xf203f1ab,0xf2dbf26b,0xf3c2f351,0xf47af427,
-0xf4f6f4c2,0xf542f529,0xf569f554,0xf582f574,0xf5c7f59c,0xf646f5ff,0xf72bf6ad,0xf84df7bb,
-0xf996f8f4,0xfaf4fa51,0xfc31fb95,0xfd37fcbf,0xfde3fd9a,0xfe37fe18,0xfe1efe3a,0xfdc2fe00,
-0xfd1ffd77,0xfc55fcb4,0xfb87fbdf,0xfadffb20,0xfa70fa94,0xfa4cfa55,0xfa7cfa5e,0xfaf8fab5,
-0xfbb5fb50,0xfc92fc27,0xfd8cfd0c,0xfe90fe0d,0xffb0ff1c,0x00de004c,0x01fc0173,0x0309028b,
-0x03e60381,0x047e043f,0x04c704aa,0x04b004c4,0x04390481,0x036703d0,0x025402e3,0x00fe01ab,
-0xff940047,0xfe26fee3,0xfccdfd7a,0xfb93fc33,0xfa78fb0d,0xf971f9f6,0xf880f8f5,0xf794f806,
-0xf6c0f728,0xf5eef658,0xf53df592,0xf4a3f4eb,0xf44ff473,0xf434f441,0xf470f444,0xf4fdf4ac,
-0xf5dff55e,0xf6fbf667,0xf860f7a6,0xf9dbf922,0xfb80faa9,0xfd18fc4e,0xfe91fdd2,0xffefff49,
-0x011a0087,0x02070198,0x02b1025f,0x031902eb,0x034c0335,0x03540355,0x034c035c,0x0326033e,
-0x0312031b,0x030e030a,0x031f030a,0x035e0333,0x03c3038a,0x045d040c,0x051604b9,0x05e70580,
-0x06af0650,0x07420700,0x079f077e,0x07b607b2,0x077c07a3,0x06ff0743,0x064a06ad,0x055f05d1,
-0x044a04d7,0x032803ad,0x021e02a1,0x014301a8,0x009b00e7,0x0042005e,0x001b0023,0x003d0029,
-0x0078005a,0x00cb00aa,0x010f00f1,0x0137012e,0x014b0147,0x014c014d,0x01410144,0x0145013b,
-0x01570147,0x0193016c,0x020a01c7,0x02960244,0x034502e6,0x040903ad,0x04db0474,0x059e0544,
-0x06520600,0x070a06b1,0x07b60759,0x0883081f,0x095608ed,0x0a4a09cb,0x0b510aca,0x0c760be0,
-0x0dab0d07,0x0ecc0e44,0x0fc40f50,0x10961035,0x111810dd,0x115e113c,0x11741169,0x11841183,
-0x11aa1197,0x11f511d0,0x126f122e,0x131212b8,0x13d41370,0x14bc1449,0x15a4152f,0x167b1619,
-0x172a16dc,0x179c1769,0x17ae17b0,0x17641797,0x16a11710,0x157b161f,0x140314d0,0x124f1332,
-0x10691164,0x0e7c0f73,0x0ca20d8f,0x0afd0bc4,0x09a90a3e,0x08b70918,0x08220856,0x07f207fe,
-0x081007f7,0x0874083d,0x08f108ad,0x09730935,0x09fc09c3,0x0a830a46,0x0b010ac4,0x0b630b2d,
-0x0bb40b8e,0x0be90bd1,0x0c060bfe,0x0c150c0d,0x0c2a0c18,0x0c510c3a,0x0c8f0c68,0x0cd00cb5,
-0x0d020ced,0x0d130d14,0x0cf60d0c,0x0c9f0ccf,0x0c0b0c61,0x0b360baa,0x0a340abf,0x08f2099b,
-0x078f0844,0x060106cb,0x04580525,0x02b20386,0x011f01df,0xffae0066,0xfe67fefd,0xfd59fddd,
-0xfc75fcd8,0xfbc1fc12,0xfb43fb71,0xfac7fb05,0xfa45fa88,0xf9c4fa0c,0xf927f97b,0xf87ef8da,
-0xf7c6f82c,0xf709f76e,0xf64ef6ab,0xf5bef5fc,0xf56bf58c,0xf53ff54a,0xf548f53e,0xf568f556,
-0xf58cf581,0xf59cf599,0xf586f59c,0xf54cf576,0xf4d5f524,0xf43ef48e,0xf373f3de,0xf291f306,
-0xf1a2f217,0xf0a1f11f,0xefa1f029,0xeeabef20,0xedcaee38,0xecfbed57,0xec64ecab,0xebe9ec1b,
-0xeb8bebb4,0xeb51eb6b,0xeb14eb36,0xeae4eafd,0xeaaaeac8,0xea76ea90,0xea42ea5c,0xea1aea29,
-0xe9e7ea00,0xe9c4e9d5,0xe99de9b1,0xe964e981,0xe909e939,0xe88ee8d1,0xe7f1e846,0xe714e78c,
-0xe5f9e691,0xe4b1e551,0xe34be3fd,0xe1dce28b,0xe08de134,0xdf90e009,0xdf04df45,0xdeeedee4,
-0xdf6fdf24,0xe076dfe4,0xe1e2e121,0xe39de2b9,0xe57de48b,0xe752e666,0xe90ae832,0xea98e9db,
-0xebf4eb4b,0xed1cec86,0xee44edab,0xef5ceecd,0xf0a1eff9,0xf217f159,0xf3bcf2e1,0xf57df49b,
-0xf74ef666,0xf904f831,0xfaa2f9dd,0xfc10fb5f,0xfd4bfcb3,0xfe49fdd3,0xff12feb2,0xff9fff5f,
-0x0002ffdc,0x003c0028,0x002e003d,0xfff3001a,0xff88ffcb,0xff06ff4b,0xfe6ffeb9,0xfddbfe26,
-0xfd63fd9d,0xfd25fd40,0xfd26fd20,0xfd5cfd38,0xfdc2fd89,0xfe29fdf4,0xfe9cfe66,0xfed4febd,
-0xfed7fedb,0xfea3fec1,0xfe42fe72,0xfdd4fe0b,0xfd6cfd99,0xfd3ffd4a,0xfd6ffd49,0xfe2dfdb9,
-0xff6cfeb4,0x01300039,0x03610235,0x05f7049b,0x08a6074a,0x0b5c0a05,0x0def0ca6,0x10330f1e,
-0x12171134,0x139912e2,0x14bd1436,0x159d152d,0x16651603,0x172516c2,0x17fa178f,0x18d41870,
-0x19b2194f,0x1a721a21,0x1ae01abc,0x1ae01af5,0x1a491aa9,0x192119c8,0x1776185c,0x15591674,
-0x130c1437,0x10d011e8,0x0ec40fc3,0x0d390df2,0x0c1d0c96,0x0b880bbf,0x0b740b6f,0x0bbf0b8c,
-0x0c580c01,0x0d1c0cb9,0x0dd90d78,0x0e670e28,0x0ec80ea0,0x0ef60ee9,0x0eda0ef3,0x0e8e0ec7,
-0x0e390e68,0x0de40e0e,0x0db90dc6,0x0de70dc8,0x0e500e17,0x0f200eb4,0x101b0f97,0x113a10a7,
-0x125711c8,0x136112db,0x143313d4,0x14c51488,0x150d14f6,0x1503151c,0x14b214e8,0x1431147b,
-0x138d13dd,0x12d4132a,0x121a1265,0x117e11c5,0x10e8112b,0x108810b8,0x10361060,0x1013102b,
-0x0ff81007,0x0ffc0ffd,0x100d1006,0x1018100d,0x1021101c,0x10211020,0x100a1019,0x0fe60ff9,
-0x0f9c0fc5,0x0f2e0f69,0x0e930ee2,0x0db40e29,0x0c8c0d28,0x0afe0bd5,0x091d0a15,0x06e1080d,
-0x048205ba,0x02030349,0xff9f00d2,0xfd62fe7f,0xfb68fc5d,0xf9ccfa91,0xf880f915,0xf788f7f1,
-0xf6dff72a,0xf66bf69b,0xf625f645,0xf60af616,0xf608f609,0xf621f614,0xf649f635,0xf686f667,
-0xf6c8f6ab,0xf72af6f9,0xf77ef751,0xf7d4f7a7,0xf819f7f5,0xf84ef832,0xf878f85e,0xf880f87e,
-0xf87ef887,0xf85bf872,0xf83cf855,0xf7fef820,0xf7bdf7dc,0xf763f793,0xf702f731,0xf693f6ca,
-0xf60af650,0xf586f5cc,0xf50af53e,0xf4aaf4d3,0xf477f485,0xf475f46f,0xf4c0f49a,0xf53cf4f3,
-0xf5f4f592,0xf6b0f654,0xf770f716,0xf7fff7bc,0xf85bf837,0xf85bf86c,0xf800f836,0xf73ff7ab,
-0xf627f6bc,0xf4e1f58e,0xf399f43d,0xf276f309,0xf1a5f205,0xf126f15a,0xf0fbf102,0xf122f109,
-0xf169f144,0xf1d9f1a0,0xf246f213,0xf2bbf284,0xf33af2f8,0xf3b7f374,0xf45bf403,0xf530f4bf,
-0xf63cf5aa,0xf784f6d7,0xf8fcf837,0xfa94f9cf,0xfc42fb68,0xfdeefd1a,0xff68feb3,0x008bfffc,
-0x012f00e9,0x013f013f,0x00b20109,0xff80002a,0xfdf2fec1,0xfc11fd02,0xfa46fb26,0xf8aaf96c,
-0xf773f803,0xf6c5f713,0xf6a5f6ae,0xf6f4f6c3,0xf792f73b,0xf860f7f5,0xf912f8bc,0xf988f952,
-0xf98ef99c,0xf920f95c,0xf84df8bf,0xf734f7c4,0xf609f69d,0xf4dcf568,0xf3fff460,0xf375f3ad,
-0xf354f359,0xf3a8f370,0xf443f3e9,0xf51bf4a7,0xf5ebf57c,0xf6abf64f,0xf73af6f5,0xf77af767,
-0xf773f77b,0xf738f760,0xf6e1f708,0xf6c4f6ca,0xf6e0f6ce,0xf772f71c,0xf859f7e2,0xf9b3f8fb,
-0xfb46fa7d,0xfcf6fc1d,0xfe97fdca,0x0007ff58,0x012200a5,0x01e00191,0x022d0209,0x02220233,
-0x01ce0200,0x0156019a,0x00d3011d,0x00540095,0xffd80010,0xff7dffab,0xff21ff4a,0xfedcfefd,
-0xfe93feb4,0xfe45fe70,0xfdfbfe1e,0xfd83fdbf,0xfd04fd42,0xfc7afcc7,0xfbe7fc33,0xfb62fb9f,
-0xfb12fb35,0xfb0afafd,0xfb5afb22,0xfc23fbac,0xfd34fc98,0xfea1fde2,0x001cff5d,0x019a00df,
-0x02ef024e,0x04010382,0x04b10466,0x04e904d8,0x04b404df,0x04160473,0x034503bd,0x025f02d6,
-0x019701ef,0x00e80137,0x008300a5,0x0065006a,0x008f006f,0x00fa00b8,0x019b013b,0x024401e8,
-0x030902a2,0x03d00370,0x04aa043f,0x05940526,0x06780609,0x076106ec,0x085807d5,0x094e08cf,
-0x0a3009bf,0x0af10a95,0x0b730b39,0x0bb30b9d,0x0ba30bb4,0x0b420b7b,0x0aa40afe,0x09bd0a38,
-0x08a2093e,0x07670809,0x061506c6,0x04c6056e,0x03aa043b,0x02c50334,0x021c026b,0x01ca01eb,
-0x01b401b5,0x01dd01c4,0x022a0206,0x0296025e,0x030302c7,0x03710338,0x03c80398,0x042003f4,
-0x046e0446,0x04b80498,0x04ff04dc,0x05470521,0x05ac0579,0x062c05e8,0x06ce067b,0x078e0729,
-0x086c07f5,0x095d08ea,0x0a4809d9,0x0b200abb,0x0bd10b7d,0x0c570c13,0x0c9d0c77,0x0cc10cb5,
-0x0cb50cb8,0x0c950ca4,0x0c680c7c,0x0c430c4f,0x0c230c28,0x0c1f0c1c,0x0c2f0c26,0x0c500c44,
-0x0c790c6b,0x0cb40c9b,0x0ceb0cd0,0x0d200d07,0x0d510d3d,0x0d610d63,0x0d620d65,0x0d470d51,
-0x0d1c0d2b,0x0cf80cff,0x0cfa0cf7,0x0d200cff,0x0d780d45,0x0df50da9,0x0e9f0e3e,0x0f6b0efe,
-0x104e0fe1,0x113a10ca,0x120811a7,0x12be1272,0x13591318,0x13d4139c,0x141d13f5,0x1438142a,
-0x14301432,0x13e0140b,0x136413ab,0x127d12fd,0x114511ee,0x0fb0108f,0x0dca0ec7,0x0b920cb3,
-0x09360a69,0x06c007fa,0x046a0597,0x02550356,0x007e015e,0xff2affc4,0xfe32fea2,0xfd9afdd9,
-0xfd5efd74,0xfd6bfd5a,0xfdb5fd85,0xfe22fddf,0xfebcfe68,0xff7cff1b,0x005effec,0x015e00e3,
-0x026101e3,0x035702de,0x042503c8,0x04a60474,0x04e404d5,0x04c604de,0x0460049e,0x039d0406,
-0x0295031d,0x014b01f6,0xffe10094,0xfe4dff12,0xfc91fd6c,0xfab9fba5,0xf8b6f9c3,0xf6a1f7b5,
-0xf466f593,0xf21ff348,0xefd0f0f9,0xed94eeaf,0xeb7dec7b,0xe99fea85,0xe808e8c2,0xe6c6e75e,
-0xe5d0e63a,0xe52ee56f,0xe4d2e4f2,0xe4a6e4b5,0xe48ee495,0xe497e497,0xe4b9e4a4,0xe4e8e4cf,
-0xe526e4ff,0xe56fe54c,0xe5d5e5a2,0xe65fe616,0xe6f1e699,0xe7a8e743,0xe85ee803,0xe926e8c8,
-0xe9e8e98a,0xeaa2ea49,0xeb4eeb02,0xebe0eb9b,0xec55ec1b,0xecb0ec87,0xecf9ecd5,0xed39ed15,
-0xed71ed56,0xed99ed88,0xedaaeda3,0xedb1edb3,0xed9fedb1,0xed93ed95,0xed77ed84,0xed6ded6c,
-0xed8aed7f,0xedcceda4,0xee29edfc,0xee92ee5b,0xeee4eebf,0xef10eeff,0xeefeef0b,0xeea8eee1,
-0xee16ee62,0xed58edbd,0xec87ecec,0xebc9ec22,0xeb3eeb79,0xeaeceb0c,0xeae8eae5,0xeb2eeb08,
-0xebadeb6c,0xec46ebf4,0xece8ec97,0xed8eed37,0xee38ede5,0xeefcee95,0xefd9ef5e,0xf105f06d,
-0xf275f1b1,0xf42cf34c,0xf628f521,0xf855f732,0xfa9ef97b,0xfce9fbc4,0xff11fdfe,0x00f80003,
-0x02af01e6,0x041e0379,0x053804c3,0x060b05af,0x0699065a,0x06ee06c9,0x071c0707,0x073f0730,
-0x07670752,0x079e077d,0x07f307c0,0x08650822,0x08f408ac,0x099c094b,0x0a3b09f1,0x0ac90a82,
-0x0b280b06,0x0b4c0b3d,0x0b2a0b40,0x0ad20b03,0x0a470a90,0x09b10a01,0x0927096e,0x08c208f0,
-0x088e08a3,0x08bb0893,0x093008e1,0x0a050984,0x0b080a7c,0x0c420b9b,0x0d860ce8,0x0eb80e24,
-0x0fd50f4f,0x10c71056,0x11931130,0x125b11f4,0x132512be,0x14101392,0x15211490,0x166a15bc,
-0x17e11721,0x198118b0,0x1b291a58,0x1cbf1bfa,0x1e1a1d76,0x1f391eb7,0x200e1fae,0x209b205f,
-0x20dc20cb,0x20ca20de,0x208420ac,0x20012049,0x1f531fb0,0x1e661ee7,0x1d5e1ded,0x1c211cca,
-0x1ab01b6f,0x191219e9,0x1738182c,0x15291639,0x12e8140b,0x109511c0,0x0e360f62,0x0bf30d0f,
-0x09c50ad2,0x07dd08ca,0x06440700,0x04ee058c,0x03f00461,0x03510397,0x03060320,0x02f902f9,
-0x031b0306,0x03380325,0x033d0339,0x03060330,0x02a002d9,0x02030254,0x01250195,0x003200a7,
-0xff46ffbc,0xfe78fedb,0xfdf1fe35,0xfdb8fdcf,0xfdcefdb9,0xfe2afdf3,0xfec9fe6f,0xff9fff2c,
-0x009a0019,0x01a90121,0x02b80231,0x03aa032b,0x04770411,0x052404cc,0x05880558,0x05cd05ae,
-0x05ee05e3,0x060a0601,0x06140616,0x06100614,0x060b0611,0x05db05f8,0x059205c0,0x05240560,
-0x04b704e9,0x044a047d,0x03f60419,0x03de03e0,0x03ef03dd,0x042b0405,0x04a10465,0x051604da,
-0x058e0556,0x05d105b6,0x05ca05d2,0x053a0586,0x043704ca,0x02bb038a,0x00d801d3,0xfeacffca,
-0xfc63fd8e,0xfa27fb42,0xf81af912,0xf660f729,0xf4fff5a4,0xf41bf47e,0xf3a4f3d3,0xf39df397,
-0xf3edf3be,0xf467f425,0xf4e8f4a5,0xf560f52e,0xf5a6f58c,0xf5b4f5b5,0xf589f5ab,0xf53af56a,
-0xf4baf4f8,0xf430f479,0xf3a4f3ed,0xf334f36e,0xf2e7f30a,0xf2d0f2d4,0xf2f9f2e0,0xf367f32b,
-0xf40cf3b8,0xf4cef46c,0xf5a8f53c,0xf66df60d,0xf6f9f6b5,0xf743f727,0xf72af73a,0xf6b0f6f5,
-0xf5d4f651,0xf4d1f556,0xf3b7f441,0xf2acf32c,0xf1e7f246,0xf172f1ad,0xf15df15a,0xf1a1f182,
-0xf21ff1da,0xf2bdf269,0xf348f303,0xf3b0f381,0xf3e1f3d1,0xf3cdf3e4,0xf376f3ad,0xf2f1f33a,
-0xf252f2a1,0xf1b0f203,0xf116f161,0xf0aff0e0,0xf077f08f,0xf087f074,0xf0e3f0a5,0xf18cf12b,
-0xf25df1e5,0xf359f2d0,0xf469f3d6,0xf576f4e8,0xf664f5ef,0xf71df6c6,0xf7a8f766,0xf80ff7de,
-0xf84df832,0xf87ef86b,0xf8b5f89c,0xf905f8dc,0xf974f936,0xfa10f9c1,0xfaeefa71,0xfc00fb71,
-0xfd45fc9d,0xfebbfdfd,0x003dff76,0x01b900f6,0x03240269,0x045803c7,0x053f04dc,0x05d2059c,
-0x06130605,0x060b0621,0x05da0601,0x057005ac,0x04f10535,0x045a04a7,0x03aa0402,0x02e30351,
-0x01ef0269,0x00e80171,0xffb50052,0xfe78ff16,0xfd3bfddb,0xfc20fca8,0xfb4cfbaa,0xfac1faf8,
-0xfa83fa99,0xfa83fa7c,0xfaa3fa93,0xfad7fabf,0xfb02faef,0xfb0ffb0c,0xfb0afb0d,0xfafbfb03,
-0xfae5faf0,0xfaf0fae5,0xfb1ffb05,0xfb89fb47,0xfc36fbdb,0xfd09fc9c,0xfe10fd85,0xff11fe8d,
-0x0005ff8a,0x00d50072,0x016d012a,0x01c701a5,0x01da01d9,0x01aa01cb,0x01560186,0x00e40120,
-0x004d009b,0xffc50008,0xff4aff89,0xfeeeff1a,0xfeb8fed4,0xfeb0feac,0xfed3feb7,0xff14feea,
-0xff72ff39,0xffdbff9d,0x003d0008,0x00a2007d,0x010600d8,0x0163013c,0x01bf0196,0x022101f4,
-0x02940258,0x031d02d2,0x03c0036c,0x04670413,0x051504ba,0x05b10560,0x063705f9,0x06970665,
-0x06cb06ae,0x06c306cd,0x067e06a8,0x0608064b,0x056105ba,0x049c0501,0x03cb042e,0x03090367,
-0x026d02b8,0x02200245,0x020f0214,0x02430223,0x02c6027e,0x03780319,0x045c03e9,0x055304d3,
-0x066b05dd,0x078c06ff,0x08a80816,0x09be092a,0x0acf0a42,0x0bd20b4d,0x0cb90c47,0x0d8e0d1f,
-0x0e520df0,0x0ee80ea0,0x0f590f23,0x0f9c0f81,0x0fc80fc3,0x0fc10fce,0x0f950fad,0x0f2e0f61,
-0x0e9c0ee7,0x0de40e44,0x0d120d78,0x0c210c99,0x0b2b0bac,0x0a3b0aae,0x096909ce,0x08b20909,
-0x083b0874,0x0805081c,0x08090802,0x08410824,0x087f085e,0x08c708a3,0x08f708e5,0x09130907,
-0x0912090e,0x08f90906,0x08e408ec,0x08e408e5,0x08f708f2,0x0943091e,0x09b9097d,0x0a5109ff,
-0x0ae50a9c,0x0b960b35,0x0c2e0be3,0x0cb80c76,0x0d120ce8,0x0d3c0d33,0x0d1c0d31,0x0cc60cf7,
-0x0c4c0c8e,0x0bb50c01,0x0b210b6a,0x0aac0ae8,0x0a620a89,0x0a550a56,0x0a900a67,0x0aff0ac1,
-0x0b880b3b,0x0c340be0,0x0ccb0c7b,0x0d4a0d12,0x0d870d75,0x0d8c0d93,0x0d320d6a,0x0ca50cf6,
-0x0bd20c43,0x0ad60b58,0x09d00a52,0x08e1095a,0x080c086b,0x076507aa,0x06f8071c,0x06c606de,
-0x06d706cc,0x06ee06e9,0x070406fe,0x06f60710,0x069806cd,0x05df0645,0x04cc0560,0x0361041f,
-0x01a0028e,0xffaa00ad,0xfd83fe9c,0xfb3ffc67,0xf90cfa24,0xf6f5f7fb,0xf50af5f5,0xf360f42c,
-0xf1e8f299,0xf0bef14c,0xefe4f044,0xef51ef91,0xef0eef24,0xef2bef14,0xef91ef55,0xf03aefe3,
-0xf123f0a8,0xf21ef1a3,0xf329f2aa,0xf42df3b2,0xf535f4b8,0xf625f5b1,0xf70ef69e,0xf7e2f777,
-0xf8a0f845,0xf931f8ec,0xf98cf964,0xf99df9a0,0xf939f97a,0xf87cf8e7,0xf74cf7f7,0xf5aff68e,
-0xf3b6f4be,0xf17df29d,0xef05f046,0xec6dedb1,0xe9d3eb1a,0xe747e88a,0xe4b8e5f8,0xe256e37e,
-0xe00ce127,0xde09defb,0xdc4add1f,0xdaeedb8a,0xda06da6d,0xd9add9c8,0xd9d2d9a9,0xda77da18,
-0xdba2db05,0xdd34dc63,0xdeffde13,0xe0ecdff8,0xe2e2e1ea,0xe4b6e3cb,0xe661e592,0xe7c9e715,
-0xe8fce861,0xe9fde988,0xeae8ea7f,0xebb9eb4e,0xec88ec23,0xed71ecfe,0xee57ede7,0xef72eee4,
-0xf08feff8,0xf1bdf125,0xf2f1f25a,0xf411f383,0xf536f4af,0xf656f5c7,0xf75ef6de,0xf85bf7de,
-0xf953f8d9,0xfa43f9ca,0xfb2ffab6,0xfc12fba2,0xfcc6fc71,0xfd6bfd19,0xfdf5fdaf,0xfe5cfe28,
-0xfeb1fe81,0xfef9fed0,0xff3dff1d,0xff73ff54,0xffb8ff98,0xfffcffdd,0x00660030,0x00cb0099,
-0x01440103,0x01d6018d,0x0271021d,0x032702c8,0x03fd038d,0x04f10470,0x05fe0575,0x07320698,
-0x086b07d0,0x098708f5,0x0a9a0a17,0x0b820b19,0x0c310bde,0x0cbd0c7f,0x0d190cf1,0x0d6b0d49,
-0x0dbb0d91,0x0e1d0de9,0x0e9c0e59,0x0f550eef,0x10170fb5,0x10cf1078,0x116e112a,0x11d311ad,
-0x11e611e7,0x119211c4,0x10d3113d,0x0fbf104b,0x0e6e0f1b,0x0d070dbd,0x0bbf0c5c,0x0ab00b30,
-0x09ed0a45,0x099509b5,0x0999098f,0x09f209c3,0x0a900a3f,0x0b4b0af0,0x0bfe0bae,0x0c930c52,
-0x0cec0ccc,0x0d030cfe,0x0cde0cf8,0x0c860cb2,0x0c020c43,0x0b750bba,0x0aec0b32,0x0a7f0ab5,
-0x0a3a0a58,0x0a210a23,0x0a440a2e,0x0a920a6a,0x0b020ac6,0x0b8b0b49,0x0c470be4,0x0d000ca0,
-0x0dd70d61,0x0ea10e35,0x0f7a0f07,0x10460fd9,0x110410a7,0x11a61156,0x122f11ea,0x12a01269,
-0x12fe12d5,0x13461326,0x1381136a,0x13ba13a9,0x13f313e0,0x1430140b,0x145d1441,0x149a147a,
-0x14c614b1,0x14e214d7,0x14ea14e8,0x14cd14df,0x148b14b4,0x1432145e,0x13b713ee,0x13101365,
-0x124412a9,0x115111cb,0x103a10c7,0x0efb0f95,0x0d9b0e51,0x0c300ce8,0x0ac50b78,0x09550a0a,
-0x07f108a0,0x0697073c,0x054505e8,0x0407049a,0x02c10367,0x018c0226,0x005d00f4,0xff41ffcf,
-0xfe33febc,0xfd43fdc1,0xfc78fcdb,0xfbdffc31,0xfb77fba3,0xfb39fb52,0xfb2cfb2a,0xfb33fb24,
-0xfb5bfb3c,0xfb8bfb6b,0xfbc0fba4,0xfbe6fbd2,0xfbe6fbeb,0xfbc1fbd6,0xfb83fbaa,0xfb12fb50,
-0xfa7ffacd,0xf9dffa33,0xf943f995,0xf8b1f8f9,0xf845f878,0xf804f81d,0xf7eff7ee,0xf802f7f2,
-0xf83cf81a,0xf873f857,0xf8a5f88c,0xf8a6f8ad,0xf871f88d,0xf803f844,0xf75cf7b6,0xf688f6f7,
-0xf594f611,0xf4aaf51d,0xf3e3f444,0xf33af388,0xf2c9f2f6,0xf278f29b,0xf24df260,0xf247f24d,
-0xf248f246,0xf232f23d,0xf20af21d,0xf1c7f1ea,0xf15ef198,0xf0edf12d,0xf072f0af,0xeff6f035,
-0xef91efc1,0xef53ef6a,0xef41ef3d,0xef72ef52,0xefe5efa2,0xf09af03b,0xf19ef114,0xf2e1f237,
-0xf468f3a0,0xf61ff541,0xf7e0f6fa,0xf99ff8bd,0xfb40fa70,0xfcadfc01,0xfdddfd58,0xfebdfe5b,
-0xff4dff10,0xff89ff74,0xff90ff94,0xff74ff7e,0xff33ff4e,0xfee7ff07,0xfeaffec8,0xfe7dfe94,
-0xfe4afe68,0xfe16fe37,0xfdc3fdf2,0xfd4bfd8c,0xfc90fcf8,0xfb9ffc18,0xfa6bfb0e,0xf90af9bf,
-0xf7a0f860,0xf64df6ef,0xf516f5b0,0xf419f490,0xf35bf3b9,0xf2f1f31b,0xf2bbf2ce,0xf2bff2b3,
-0xf2def2ca,0xf315f2f3,0xf35cf335,0xf3adf380,0xf403f3d3,0xf466f431,0xf4c1f491,0xf51ef4f5,
-0xf57ef54e,0xf5dbf5ad,0xf634f607,0xf681f65f,0xf6d3f6a8,0xf722f6f9,0xf784f751,0xf7f1f7b6,
-0xf88bf839,0xf92cf8db,0xf9f0f98e,0xfacffa60,0xfbc9fb51,0xfcb0fc3c,0xfd96fd22,0xfe63fdf8,
-0xff15feb9,0xffb5ff64,0x0041ffff,0x00bf0083,0x01440103,0x01d6018c,0x02790221,0x032d02d3,
-0x03e0038e,0x049f0443,0x053604f3,0x0592056b,0x05c005b0,0x05a405b7,0x053d0579,0x04ae0500,
-0x03f80451,0x03250390,0x025a02bc,0x01a501f9,0x010a0156,0x00a800d8,0x00710087,0x00680065,
-0x009c007b,0x00f100bf,0x016e0122,0x01fc01a9,0x02980247,0x031e02d7,0x03910357,0x03eb03c9,
-0x04200411,0x04270430,0x03fb0416,0x03b603d7,0x034c0384,0x02da0312,0x0260029d,0x02020229,
-0x019c01c5,0x0169017d,0x014f0159,0x01600158,0x0191017b,0x01d501b3,0x022501fe,0x025a024a,
-0x027e0275,0x026c0281,0x02380253,0x01cf0202,0x0151018e,0x00bb0107,0x003b0073,0xffcdfff8,
-0xff7aff9c,0xff56ff64,0xff57ff56,0xff8aff67,0xffdaffae,0x003c0009,0x00a30078,0x011500e1,
-0x01910157,0x01ff01c9,0x025d022c,0x02bc0289,0x031602e6,0x0374033d,0x03eb03b0,0x04690424,
-0x04f304ae,0x05930544,0x063905eb,0x06e5068b,0x078e073c,0x081b07e0,0x087c0852,0x08bf08a2,
-0x08ef08dd,0x090308f8,0x09100904,0x092b0919,0x095e0941,0x09b80988,0x0a3d09f8,0x0adf0a85,
-0x0bb30b4a,0x0c8d0c1d,0x0d560ced,0x0dff0da9,0x0e6e0e35,0x0eaf0e91,0x0ed00ec5,0x0eca0ed3,
-0x0ebe0ec1,0x0eb00eba,0x0eb20eb3,0x0ec80ebd,0x0eef0edb,0x0f270f0d,0x0f5d0f3e,0x0fa30f7b,
-0x0ff50fcb,0x1056101f,0x10bb1083,0x113510f6,0x11bd117a,0x12471206,0x12c7128c,0x132f1306,
-0x13701355,0x138a1382,0x1362137b,0x130b133a,0x127612bd,0x11b5121a,0x10d4114a,0x0fb4104b,
-0x0e740f20,0x0cfe0dc0,0x0b6b0c41,0x09b70a93,0x07f708d4,0x062d0716,0x0478054c,0x02de03a9,
-0x01820228,0x007a00f3,0xffbe000c,0xff58ff78,0xff4eff42,0xff82ff5d,0xfff5ffba,0x00950046,
-0x014800f4,0x01fd01a3,0x02af0256,0x03560302,0x03dd039f,0x0441040e,0x04790466,0x047d0483,
-0x044b046d,0x03be0412,0x02ed0363,0x01c00267,0x005e011a,0xfec1ff8c,0xfcf8fddf,0xfb11fbfa,
-0xf927fa15,0xf754f83c,0xf598f67b,0xf405f4cb,0xf293f34c,0xf148f1ec,0xf02ef0bb,0xef5fefbb,
-0xeeb9eefc,0xee6aee85,0xee69ee60,0xeeb5ee84,0xef3beeed,0xeff5ef89,0xf0d4f05f,0xf1bff145,
-0xf2bdf244,0xf3b4f33b,0xf4a0f42e,0xf575f50e,0xf63ff5d8,0xf705f6a0,0xf7c3f76d,0xf87bf827,
-0xf933f8e3,0xf9d1f980,0xfa2af9fe,0xfa56fa3e,0xfa3cfa4a,0xf9d0fa04,0xf927f97c,0xf844f8b0,
-0xf728f7b5,0xf5f7f68f,0xf4c6f55c,0xf398f42e,0xf286f30a,0xf1a9f212,0xf100f14e,0xf087f0b8,
-0xf03bf05e,0xf02df02b,0xf04ff03d,0xf091f073,0xf0e6f0c3,0xf12bf10b,0xf14df13f,0xf136f14c,
-0xf0c8f105,0xf01cf079,0xef1eefa4,0xede7ee86,0xec95ed3e,0xeb3debee,0xea00eaa1,0xe8dde970,
-0xe7e1e85a,0xe71be778,0xe67fe6ca,0xe5fae63e,0xe593e5bd,0xe531e562,0xe4e7e512,0xe4a1e4c5,
-0xe47fe48b,0xe485e471,0xe4dbe4a2,0xe576e51b,0xe67ce5f0,0xe7c8e715,0xe976e895,0xeb51ea58,
-0xed57ec49,0xef72ee60,0xf191f085,0xf3abf2a0,0xf5a2f4ac,0xf768f683,0xf91cf842,0xfaaaf9e6,
-0xfc1efb62,0xfd77fcce,0xfebbfe18,0xfff8ff65,0x0120008e,0x024201b8,0x034502c6,0x042b03b9,
-0x0505049e,0x05bb0567,0x064e060a,0x06bc0682,0x071106e8,0x074d0731,0x07580754,0x074a0754,
-0x071e073b,0x06e7070c,0x06b206d1,0x068b069d,0x06680679,0x066d0666,0x069f0682,0x06ff06c4,
-0x078e0743,0x084407e3,0x090c08a5,0x09cd096a,0x0a890a30,0x0b390ae5,0x0bd70b88,0x0c640c25,
-0x0cea0cad,0x0d730d28,0x0df90db2,0x0e800e33,0x0f0b0ec0,0x0f930f4b,0x102b0fdf,0x10af106b,
-0x112510f2,0x119a1163,0x120911d3,0x12711238,0x12d912a2,0x13421305,0x13b11376,0x142a13ec,
-0x14bc146e,0x1563150a,0x161215c3,0x16df167b,0x17a41744,0x18541807,0x18e118a6,0x192f190e,
-0x192d1936,0x18e1190c,0x1848189f,0x176e17e7,0x166216f1,0x153615d0,0x13f8149c,0x12b81352,
-0x118b1219,0x107d1100,0x0f9b1007,0x0ee80f39,0x0e680ea6,0x0e070e37,0x0dbf0de6,0x0d860da1,
-0x0d510d6d,0x0d190d36,0x0cbe0ce9,0x0c4c0c88,0x0bb80c04,0x0b010b56,0x0a290a98,0x093b09b0,
-0x083f08b7,0x073507b8,0x063506b5,0x052a05ae,0x041c04a4,0x03190395,0x0224029e,0x014401ad,
-0x009a00e9,0x00210052,0x00000008,0x002a0007,0x00b30060,0x018f0112,0x02c10227,0x04310377,
-0x05c10500,0x0745068a,0x08be0805,0x09f3095a,0x0ae80a75,0x0b930b43,0x0bf50bcc,0x0c0f0c07,
-0x0bdf0c02,0x0b740ba8,0x0aca0b23,0x09d70a51,0x0895093e,0x071507d9,0x05430633,0x0346044a,
-0x01130234,0xfed4fff8,0xfc9efdba,0xfa8afb91,0xf8bef99c,0xf741f7f7,0xf615f6a0,0xf541f59f,
-0xf4baf4f1,0xf470f491,0xf45ff45c,0xf47ff470,0xf4cbf49c,0xf532f4fb,0xf59af564,0xf609f5ce,
-0xf667f639,0xf6aff68e,0xf6d6f6ca,0xf6c5f6d9,0xf69ff6b5,0xf64ef67e,0xf5e1f616,0xf561f59f,
-0xf4dff521,0xf463f49d,0xf408f439,0xf3d5f3ea,0xf3c0f3c4,0xf3c3f3b9,0xf3d3f3cc,0xf3fcf3e6,
-0xf42df414,0xf45cf440,0xf497f476,0xf4e3f4be,0xf531f506,0xf592f561,0xf5f8f5c6,0xf65df628,
-0xf6b4f684,0xf6f4f6d9,0xf70bf706,0xf6e1f6fa,0xf666f6a9,0xf5a4f615,0xf4a3f52a,0xf37ff418,
-0xf265f2ef,0xf157f1d6,0xf0a6f0f8,0xf036f060,0xf035f030,0xf093f060,0xf14ff0e5,0xf24cf1cc,
-0xf37cf2e3,0xf4c5f426,0xf612f56e,0xf754f6b9,0xf86ff7e8,0xf96ef8f2,0xfa49f9df,0xfaf5fa9f,
-0xfb66fb38,0xfba9fb91,0xfbc6fbb9,0xfbb5fbc0,0xfb92fba3,0xfb5ffb78,0xfb36fb4a,0xfb2bfb2e,
-0xfb3afb33,0xfb7ffb57,0xfbf8fbb8,0xfc81fc31,0xfd1dfcc5,0xfda7fd5f,0xfe23fde7,0xfe6efe4a,
-0xfe73fe7e,0xfe4ffe65,0xfde8fe1b,0xfd62fda2,0xfcd4fd10,0xfc4ffc97,0xfbdefc14,0xfba4fbbf,
-0xfb9efb9e,0xfbc8fbb4,0xfc35fbfc,0xfcc0fc74,0xfd6afd0e,0xfe1ffdc3,0xfed7fe7a,0xff8fff29,
-0x0024ffdb,0x00930055,0x00f100c8,0x0125010d,0x01360139,0x01160132,0x00da0105,0x008400b8,
-0x00100048,0xff7dffc4,0xfee2ff2e,0xfe38fe8e,0xfd8ffde4,0xfcd6fd33,0xfc0dfc74,0xfb41fba6,
-0xfa5cface,0xf968f9e6,0xf868f8eb,0xf769f7ec,0xf678f6f1,0xf5b2f613,0xf52df564,0xf4dcf4f5,
-0xf4f5f4d7,0xf581f52d,0xf67cf5ef,0xf7d9f71a,0xf999f8b0,0xfb91fa8d,0xfdb0fc9d,0xffccfebf,
-0x01c000ce,0x037502a8,0x04ca0428,0x05c20550,0x06530612,0x0688067e,0x066a067a,0x060f0647,
-0x058e05d9,0x04ff054d,0x045e04ac,0x03c3040d,0x034b0386,0x02f20319,0x02b302cb,0x0292029e,
-0x0272027d,0x02560262,0x021f023b,0x01bd01f2,0x013f0181,0x00ac00f6,0x0017005e,0xff94ffd3,
-0xff3eff66,0xff34ff33,0xff8fff57,0x004cffe1,0x016300d1,0x02d1020f,0x04640391,0x06100534,
-0x07a506d9,0x09080860,0x0a2d09a1,0x0afb0aa2,0x0b760b43,0x0ba70b93,0x0ba60bad,0x0b850b9b,
-0x0b5b0b6f,0x0b3b0b46,0x0b3c0b35,0x0b610b47,0x0bcc0b97,0x0c630c1b,0x0d1b0cbc,0x0ddb0d75,
-0x0e720e28,0x0ed20ea7,0x0ed50ee2,0x0e660eb3,0x0d7d0e02,0x0c290ce3,0x0a720b51,0x08780977,
-0x06840777,0x04ce05a0,0x035f0407,0x027d02e0,0x02300248,0x02700238,0x032d02bb,0x043c03ac,
-0x056f04dc,0x06a7060c,0x079d072d,0x08460800,0x08890874,0x08680881,0x07e0082d,0x07160780,
-0x062106a0,0x05150593,0x0421049a,0x034c03b3,0x02ad02f8,0x02620283,0x026e0269,0x02d30298,
-0x038a032b,0x047d03f7,0x05a40510,0x06e90644,0x0820078c,0x094d08b1,0x0a5509d5,0x0b450ad1,
-0x0c0a0bac,0x0cb40c5d,0x0d490cff,0x0dd10d90,0x0e650e26,0x0ef10ea4,0x0f870f3a,0x10190fcc,
-0x10a11061,0x111210e1,0x115c113c,0x11831176,0x11711182,0x11291156,0x109f10f2,0x0fd4104c,
-0x0ed90f6a,0x0db20e57,0x0c5d0d17,0x0ae80ba3,0x096a0a2b,0x07f708b0,0x068d0739,0x053d05de,
-0x04080499,0x030b0383,0x02270290,0x017901d4,0x00f30132,0x009f00c6,0x0067007d,0x004e0051,
-0x003c0045,0x003d003b,0x00290037,0xfff90018,0xffa6ffd7,0xff1eff69,0xfe5efec9,0xfd6dfdf6,
-0xfc53fceb,0xfb12fbb8,0xf9dcfa7c,0xf89bf93b,0xf76ef80a,0xf668f6e3,0xf574f5e9,0xf498f4ff,
-0xf3d5f434,0xf322f379,0xf28ff2d5,0xf203f24a,0xf1a2f1cb,0xf156f173,0xf13af13f,0xf147f136,
-0xf177f15b,0xf1d9f1a5,0xf25cf212,0xf2f8f29f,0xf38df33b,0xf421f3d1,0xf499f460,0xf4ecf4c7,
-0xf508f504,0xf4eaf508,0xf482f4c2,0xf3d8f433,0xf2edf367,0xf1c1f25d,0xf071f120,0xef13efc1,
-0xedaeee5e,0xec74ed09,0xeb6aebe6,0xea94eaf3,0xea08ea53,0xe9cce9e1,0xe9e5e9cc,0xea2ce9fe,
-0xeab6ea72,0xeb78eb19,0xec5aebea,0xed5aecd8,0xee71ede9,0xefa5ef0b,0xf0eff049,0xf22cf18e,
-0xf35af2c3,0xf463f3e3,0xf54df4dd,0xf5f7f5ab,0xf65ff62f,0xf67cf679,0xf653f66c,0xf5e5f627,
-0xf537f592,0xf453f4d2,0xf367f3dc,0xf265f2ea,0xf17bf1eb,0xf09ef107,0xefeef03d,0xef6eef9f,
-0xef26ef3c,0xef13ef11,0xef35ef18,0xef7def4c,0xefe3efa2,0xf056f018,0xf0c0f088,0xf12af0fc,
-0xf179f153,0xf1b7f1a6,0xf1dbf1d3,0xf1f4f1f0,0xf200f1fc,0xf21bf20b,0xf242f227,0xf289f25e,
-0xf2faf2ba,0xf392f33e,0xf450f3ec,0xf52cf4ba,0xf612f5a1,0xf701f68c,0xf7daf773,0xf8b3f849,
-0xf97df919,0xfa40f9e1,0xfb15faad,0xfbf8fb84,0xfd08fc7e,0xfe39fd9c,0xff8bfeda,0x01090042,
-0x02a601ce,0x04430379,0x05fa0518,0x07bb06d7,0x096a0899,0x0b250a42,0x0cde0c06,0x0e850db4,
-0x10260f65,0x11b110fb,0x13201270,0x146613c8,0x158614fe,0x167315fa,0x173516dd,0x17cf1788,
-0x1852181b,0x18b11888,0x18e418d4,0x19121904,0x19231919,0x19321924,0x19291925,0x191b1921,
-0x18fd190c,0x18c318ec,0x1867189a,0x17f21834,0x175117a7,0x168e16f1,0x15aa161f,0x14aa1525,
-0x1396141f,0x12841309,0x117211f7,0x106210e3,0x0f490fcf,0x0e240eb1,0x0d070d8e,0x0bda0c72,
-0x0ab90b4c,0x09b40a39,0x08d2093c,0x0821086a,0x07ab07e1,0x077f0790,0x07a1078e,0x07f807ca,
-0x08740837,0x091f08c5,0x09d10970,0x0a8e0a2a,0x0b4b0ae8,0x0c090ba0,0x0cc20c67,0x0d850d25,
-0x0e460dee,0x0ef50e95,0x0f8c0f41,0x10090fd0,0x105c103a,0x106d1071,0x104e1068,0x0feb1021,
-0x0f350f93,0x0e490ec3,0x0d310dbf,0x0beb0c9c,0x0a870b3a,0x092309dc,0x07c80873,0x0672071e,
-0x053c05cc,0x042f04af,0x034a03b2,0x028c02e1,0x01ed023c,0x018101b1,0x01290151,0x00e70103,
-0x00c400d5,0x00bd00c1,0x00b700c2,0x00b000b3,0x00a100a8,0x007c008f,0x0041005d,0xfff50021,
-0xffacffcd,0xff59ff7f,0xff00ff27,0xfeabfed6,0xfe66fe8b,0xfe28fe49,0xfdedfe15,0xfdb5fdd7,
-0xfd71fd99,0xfd2bfd4a,0xfce0fd0b,0xfc8ffcb5,0xfc35fc61,0xfbdbfc0b,0xfb8dfbb1,0xfb49fb68,
-0xfb0efb26,0xfae4faf7,0xfac6fad3,0xfaabfab6,0xfa9bfaa2,0xfa8ffa95,0xfa89fa8c,0xfa84fa8e,
-0xfa83fa8e,0xfa6ffa7f,0xfa4afa5a,0xfa0cfa28,0xf9a5f9d0,0xf931f96a,0xf88bf8db,0xf7daf839,
-0xf721f784,0xf664f6c3,0xf5b6f60b,0xf529f570,0xf4b1f4e7,0xf476f48e,0xf45bf469,0xf461f45c,
-0xf486f472,0xf4bff49a,0xf517f4e4,0xf57bf547,0xf5e8f5b1,0xf656f61e,0xf6b0f685,0xf70cf6e2,
-0xf746f72f,0xf76ef75b,0xf779f773,0xf772f77c,0xf74af762,0xf72af73c,0xf703f71a,0xf6daf6ed,
-0xf6b7f6c7,0xf69cf6a7,0xf690f696,0xf687f681,0xf68bf68d,0xf690f686,0xf6a7f69e,0xf6d6f6b9,
-0xf713f6ed,0xf764f735,0xf7def79f,0xf875f82c,0xf913f8c3,0xf9b8f96b,0xfa56fa0f,0xfad2fa9a,
-0xfb2afb05,0xfb5ffb4b,0xfb5efb61,0xfb2efb49,0xfad5fb0b,0xfa53fa99,0xf9c5fa13,0xf91bf96e,
-0xf86bf8ca,0xf7cbf81b,0xf72af77a,0xf698f6e7,0xf62cf662,0xf5e9f608,0xf5b9f5cf,0xf5b7f5b3,
-0xf5ddf5c5,0xf620f5f6,0xf68cf651,0xf703f6bb,0xf7a5f745,0xf855f7f6,0xf906f8aa,0xf9c1f963,
-0xfa61fa18,0xfae5faac,0xfb5efb29,0xfbb0fb94,0xfc02fbd8,0xfc61fc32,0xfcd3fc97,0xfd64fd1a,
-0xfe1dfdb8,0xfefdfe88,0xfff8ff7c,0x00eb0077,0x01cf0160,0x0287022f,0x02f502c7,0x031f0313,
-0x02f80313,0x028902c9,0x01df0239,0x010f0178,0x002e009c,0xff4cffb9,0xfe9afeed,0xfe0efe4d,
-0xfda9fdd7,0xfd86fd90,0xfd7cfd75,0xfd98fd90,0xfdcafdaf,0xfe00fde9,0xfe21fe0d,0xfe38fe2a,
-0xfe27fe32,0xfe18fe23,0xfe01fe0a,0xfdeefdfb,0xfe01fdf8,0xfe34fe1a,0xfe97fe5f,0xff24fed3,
-0xffd0ff72,0x009e0035,0x016e0102,0x024001d6,0x02fb02a2,0x03900345,0x03fb03c4,0x043d041f,
-0x0456044f,0x045f0463,0x04640466,0x0471046e,0x0487047f,0x04a90495,0x04dd04b8,0x051504f4,
-0x054d0535,0x057e056b,0x0596058e,0x05940599,0x05770589,0x0548055c,0x05040528,0x04c804e3,
-0x048104a3,0x04430460,0x040f0429,0x03df03f3,0x03bd03d0,0x03ae03b6,0x03a003a0,0x03b203a7,
-0x03d003bf,0x040703eb,0x04650435,0x04d10496,0x054c050a,0x05ba057e,0x060d05e3,0x0648062a,
-0x064c0650,0x0617063f,0x059d05e9,0x04e10546,0x03f4047b,0x02e60378,0x01d10262,0x00e60161,
-0x00340085,0xffc3fff7,0xffbbffbe,0x0017ffdc,0x00cf0069,0x01e2015a,0x0339028d,0x04b203ef,
-0x0646057f,0x07ca070c,0x09600899,0x0ad90a19,0x0c5f0b9e,0x0dc70d0e,0x0f270e7a,0x10600fc5,
-0x118010ef,0x126611fb,0x130d12be,0x136e1347,0x1385137f,0x134e136e,0x12b21307,0x11be1241,
-0x107e1129,0x0ef30fbb,0x0d310e1b,0x0b550c49,0x09670a62,0x07870878,0x05c906ab,0x045004fe,
-0x032303ae,0x025602a4,0x01ed0210,0x01f601de,0x02650223,0x032202b9,0x042103a3,0x052004a6,
-0x061905ad,0x06e7068e,0x0775073a,0x078c0787,0x075c077f,0x06e30727,0x0640068c,0x058905da,
-0x04f00535,0x048804b7,0x045c046d,0x048c0476,0x04ff04be,0x05a1054b,0x066005f9,0x072e06ca,
-0x07f5079e,0x089f084f,0x091e08db,0x0960093a,0x09900976,0x09920999,0x09910991,0x09980995,
-0x09910994,0x09930995,0x0997099d,0x099a099b,0x0991098f,0x09770984,0x0940095c,0x08f90928,
-0x088a08c6,0x080f0852,0x077b07c8,0x06cc0724,0x0615066f,0x053e05ae,0x045004c9,0x034503d5,
-0x020d02ad,0x0098015d,0xfef7ffc7,0xfd19fe12,0xfb19fc18,0xf8f0fa05,0xf6a6f7d0,0xf464f58b,
-0xf219f340,0xefedf101,0xeddceee6,0xec19ecfd,0xea9eeb59,0xe976ea07,0xe8b6e90f,0xe852e87b,
-0xe859e848,0xe8aee879,0xe961e8fa,0xea3ae9c8,0xeb44eaba,0xec51ebc6,0xed68ece3,0xee6dede7,
-0xef5eeee4,0xf025efbf,0xf0d4f082,0xf157f11c,0xf1b4f18a,0xf1f6f1d8,0xf226f215,0xf235f229,
-0xf234f234,0xf211f21e,0xf1eef201,0xf1a6f1c9,0xf14bf17a,0xf0ddf114,0xf049f092,0xefa5eff7,
-0xef03ef56,0xee65eeb0,0xedc8ee1d,0xed5eed94,0xed03ed2b,0xeccfece7,0xeccfeccd,0xecdbecd5,
-0xecffece6,0xed35ed19,0xed82ed50,0xedc9eda0,0xee3cee00,0xeec7ee82,0xef7eef23,0xf058efe8,
-0xf151f0cc,0xf25ff1d0,0xf35ff2e5,0xf46cf3e7,0xf568f4f3,0xf646f5dd,0xf6f0f699,0xf776f733,
-0xf7c5f7a5,0xf7f3f7de,0xf7f9f7fa,0xf7def7f0,0xf7c8f7d2,0xf7a2f7b7,0xf792f79d,0xf7a5f79f,
-0xf7e3f7bd,0xf84ff816,0xf8f1f895,0xf9c2f95c,0xfad9fa4b,0xfc0dfb6f,0xfd43fca4,0xfe83fdda,
-0xffafff1d,0x00aa0032,0x0185011e,0x022801de,0x02940268,0x02c602b5,0x02cb02d2,0x02a002b9,
-0x02630287,0x02010234,0x019801c9,0x012c0160,0x00cf00f6,0x007f00a4,0x00420056,0x00140029,
-0x00050006,0x000e0000,0x003a001b,0x00860059,0x00e800b0,0x016f0128,0x020301bb,0x02b3025d,
-0x036f0317,0x043b03d4,0x05030499,0x05d10565,0x069c0635,0x077e070a,0x086a07f7,0x095c08e1,
-0x0a6009dc,0x0b630ae0,0x0c670bea,0x0d770cf5,0x0e6f0df7,0x0f570ee6,0x102a0fc0,0x10f31091,
-0x11a3114a,0x126011fe,0x132c12c6,0x14031395,0x1502147c,0x16121588,0x172816a3,0x185317c4,
-0x195d18e0,0x1a3419d5,0x1ab61a82,0x1ad61aca,0x1a7b1aae,0x19b71a21,0x18861922,0x170c17cf,
-0x155a1638,0x13a31488,0x11f712d4,0x107b1149,0x0f250fd5,0x0e140e99,0x0d3b0da3,0x0c880ce1,
-0x0bf50c3f,0x0b6d0bb4,0x0ae30b29,0x0a530a9e,0x09b30a00,0x090d095e,0x086108b4,0x07c5080e,
-0x072e0772,0x06b506ef,0x06550682,0x06080632,0x05de05f2,0x05ca05d5,0x05cc05c7,0x05db05d3,
-0x05f205e8,0x060705ff,0x06230613,0x062f062c,0x063d0635,0x063d063f,0x0637063a,0x06370641,
-0x063b0638,0x06380639,0x06400641,0x0657064f,0x06730667,0x069e068b,0x06be06ac,0x06eb06cc,
-0x071d0704,0x07380722,0x075c0748,0x0766075b,0x07650765,0x073d0757,0x06ef0719,0x066206ae,
-0x059405ff,0x0479050c,0x030e03c8,0x0163023e,0xff89007c,0xfd79fe88,0xfb62fc6c,0xf959fa5c,
-0xf772f865,0xf5d5f69a,0xf48ff528,0xf39df408,0xf310f347,0xf2d1f2df,0xf2f8f2d8,0xf375f32a,
-0xf43df3d5,0xf553f4c4,0xf69ef5f8,0xf824f75b,0xf9bbf8f3,0xfb64fa93,0xfd04fc39,0xfe7bfdc2,
-0xffcbff27,0x00c90050,0x0181012e,0x01d001b8,0x01d501e2,0x017201af,0x00cd011e,0xffe90060,
-0xfedcff6a,0xfdacfe45,0xfc74fd19,0xfb2efbd8,0xf9f2fa92,0xf8c1f958,0xf79bf827,0xf68af70c,
-0xf58bf600,0xf4bbf51a,0xf402f454,0xf377f3b5,0xf307f33c,0xf2b1f2d4,0xf281f299,0xf259f270,
-0xf24bf253,0xf237f243,0xf235f235,0xf238f235,0xf24cf23c,0xf275f25d,0xf297f288,0xf2b9f2a5,
-0xf2e0f2d1,0xf301f2f3,0xf311f30c,0xf31bf313,0xf2f8f30f,0xf2c6f2e5,0xf281f2a4,0xf22af24f,
-0xf1cbf1f7,0xf187f1a6,0xf15cf16d,0xf170f159,0xf1bff191,0xf25df205,0xf34af2c4,0xf483f3da,
-0xf5fdf533,0xf79ef6c4,0xf951f874,0xfb0dfa33,0xfca1fbe3,0xfe11fd64,0xff43feba,0x002bffc5,
-0x00ba0075,0x00fc00e0,0x010b010b,0x00da00fb,0x007400a8,0xffe80030,0xff5cffa0,0xfeb6ff06,
-0xfe23fe67,0xfda9fde4,0xfd50fd77,0xfd0afd28,0xfceffcf8,0xfcf3fced,0xfcfbfcf9,0xfd1cfd0e,
-0xfd26fd22,0xfd2efd29,0xfd2afd34,0xfd12fd23,0xfcedfd03,0xfcc1fcd8,0xfc92fca1,0xfc62fc75,
-0xfc42fc4c,0xfc25fc32,0xfc1afc22,0xfc24fc1f,0xfc49fc30,0xfc86fc64,0xfcebfcb2,0xfd5ffd22,
-0xfde8fd9a,0xfe70fe28,0xfee8feab,0xff41ff13,0xff74ff5f,0xff80ff83,0xff5cff7b,0xff3fff52,
-0xff07ff1e,0xfeeefef3,0xfef3feea,0xff23ff0a,0xff8fff51,0x003bffdd,0x010800a2,0x02010181,
-0x03030287,0x03fe0382,0x04dc0475,0x058a053a,0x060105d6,0x0644062f,0x06540654,0x06290644,
-0x05ea0615,0x058705b9,0x0510054c,0x048e04c7,0x0411044e,0x039303cd,0x0323035a,0x02c402f0,
-0x0278029d,0x023d025a,0x0216022e,0x01f70209,0x01cb01e6,0x019301b4,0x01320161,0x00b300f2,
-0x00060061,0xff31ffa5,0xfe5cfec8,0xfd8afdf2,0xfcbdfd18,0xfc19fc68,0xfbaefbd7,0xfb70fb89,
-0xfb6efb69,0xfbacfb8e,0xfc08fbd8,0xfc8cfc46,0xfd1efcd4,0xfdc0fd6e,0xfe65fe12,0xff13feba,
-0xffe2ff76,0x00cb004c,0x01cc0148,0x02e60251,0x042a0385,0x057404ce,0x06d3061d,0x081d0774,
-0x094d08b7,0x0a4e09d3,0x0b110ab4,0x0b900b59,0x0bd00bb4,0x0bce0bcf,0x0b8b0bb3,0x0b2a0b5b,
-0x0aaa0aee,0x0a2f0a6d,0x09b209ee,0x094d097d,0x09090926,0x08ee0900,0x08f508f1,0x092c090f,
-0x0990095a,0x0a2309d4,0x0ad20a76,0x0b890b24,0x0c4a0bdf,0x0cf30c9a,0x0d7a0d35,0x0db80da3,
-0x0db50dc2,0x0d550d88,0x0ca70d04,0x0ba50c2e,0x0a6d0b11,0x091f09cb,0x07ce0878,0x0699072c,
-0x05910607,0x04ca0520,0x04560489,0x0435043b,0x046d044c,0x04dc049c,0x0598053c,0x067a060d,
-0x077d06fd,0x088c080f,0x099d0919,0x0aa60a2e,0x0bb20b30,0x0cac0c31,0x0d810d1c,0x0e350de9,
-0x0ec70e8d,0x0f250f04,0x0f600f56,0x0f5d0f68,0x0f170f40,0x0e840ecd,0x0db00e1e,0x0c9a0d27,
-0x0b5f0bfa,0x0a020ab1,0x08b30958,0x076e080a,0x063d06cf,0x053a05b6,0x047204d0,0x03cc041e,
-0x03450380,0x02cb0300,0x024a028e,0x01cc0210,0x013d0182,0x009c00eb,0xffe60041,0xff2bff89,
-0xfe60fec9,0xfd9bfdfc,0xfcc5fd33,0xfc00fc64,0xfb43fb9e,0xfa9cfaee,0xfa08fa4e,0xf99bf9ca,
-0xf95af972,0xf943f94d,0xf968f94f,0xf9bbf98b,0xfa2df9f1,0xfacafa7e,0xfb6efb1a,0xfc1afbc4,
-0xfcc3fc78,0xfd69fd19,0xfde4fdad,0xfe4afe19,0xfe7dfe74,0xfe91fe91,0xfe73fe91,0xfe23fe59,
-0xfd97fde7,0xfce0fd3d,0xfbfdfc6c,0xfaf8fb79,0xf9f9fa76,0xf8f1f96f,0xf7fbf86a,0xf71af784,
-0xf64cf6af,0xf59ff5f6,0xf50df550,0xf48bf4c8,0xf41df456,0xf3ccf3f0,0xf383f3a7,0xf34ef369,
-0xf315f332,0xf2dcf2fa,0xf2a3f2c7,0xf252f27e,0xf1daf216,0xf146f18e,0xf09df0f4,0xefdbf041,
-0xef0eef76,0xee49eeaf,0xed93edeb,0xecf4ed3a,0xec7eecb6,0xec30ec4f,0xec04ec16,0xec05ebff,
-0xec13ec0a,0xec3dec27,0xec5fec54,0xec83ec7a,0xec9eec93,0xecaeecaa,0xecc1ecb6,0xecd2ecc5,
-0xecfbece4,0xed3fed18,0xedaded70,0xee47edf0,0xef0aee9f,0xeff3ef7e,0xf114f07c,0xf246f1af,
-0xf387f2ea,0xf4daf434,0xf61cf57c,0xf74cf6b6,0xf84af7d4,0xf919f8b2,0xf9aaf964,0xfa09f9d9,
-0xfa1ffa11,0xfa09fa1a,0xf9c8f9e8,0xf96cf99e,0xf90ff93c,0xf8bbf8e4,0xf878f894,0xf855f869,
-0xf850f84f,0xf860f859,0xf8a4f885,0xf8e2f8c1,0xf933f90a,0xf985f956,0xf9e0f9b4,0xfa3ffa0d,
-0xfabafa73,0xfb4cfafb,0xfbfbfb98,0xfcc3fc5c,0xfda3fd35,0xfe95fe1d,0xff98ff18,0x00920018,
-0x01880111,0x026601fa,0x032e02cc,0x03e20388,0x048a043a,0x052504dd,0x05be0573,0x0665060f,
-0x070106b0,0x07a80753,0x08590803,0x090008ac,0x09a50957,0x0a3d09f5,0x0ab60a7a,0x0b1e0aea,
-0x0b5c0b35,0x0b770b6b,0x0b7b0b7d,0x0b6a0b75,0x0b490b5f,0x0b1d0b3d,0x0aed0b0e,0x0acc0adf,
-0x0a9c0abe,0x0a790a89,0x0a660a74,0x0a4a0a5b,0x0a390a3f,0x0a250a31,0x0a130a1a,0x09fd0a0d,
-0x09e509f1,0x09c409d2,0x09b509b3,0x09a209a2,0x09980993,0x09a20997,0x09c209b2,0x09f109de,
-0x0a500a20,0x0acb0a92,0x0b5c0b10,0x0c020bb5,0x0cb10c60,0x0d640d0c,0x0e200dc2,0x0ee00e83,
-0x0f960f38,0x10510ff6,0x110010a8,0x11c3115f,0x1279121c,0x131f12d0,0x13be1377,0x144c140b,
-0x14b41485,0x14fc14d5,0x151e150d,0x1518151e,0x14ef1506,0x14a014c2,0x1437146d,0x13b013ed,
-0x130a1361,0x123d12a2,0x114c11cd,0x102f10c4,0x0ef10f95,0x0d980e4a,0x0c3c0cf1,0x0aee0b93,
-0x09b70a4d,0x08a10924,0x07b90828,0x06f40750,0x065a06a7,0x05e00617,0x058705b1,0x0531055e,
-0x04e50502,0x049404b8,0x04310466,0x03c903fe,0x034e038b,0x02d70313,0x02510294,0x01c40205,
-0x01330179,0x00a200ec,0x00020053,0xff64ffb8,0xfee3ff30,0xfe5afea5,0xfde9fe27,0xfd82fdae,
-0xfd28fd4f,0xfce0fd00,0xfc9bfcbf,0xfc5bfc79,0xfc23fc3b,0xfbe5fc00,0xfb9afbb8,0xfb53fb79,
-0xfaf4fb1d,0xfa8afabf,0xfa14fa45,0xf9a0f9de,0xf927f95e,0xf8b6f8ef,0xf84cf883,0xf7f7f819,
-0xf7adf7cd,0xf76ef789,0xf746f758,0xf730f73a,0xf722f726,0xf725f71e,0xf719f71e,0xf714f713,
-0xf706f70d,0xf6faf700,0xf6d4f6ed,0xf6a5f6ba,0xf675f694,0xf642f66a,0xf620f63d,0xf60ef61d,
-0xf603f607,0xf61cf612,0xf64bf631,0xf68ff670,0xf6e7f6be,0xf74df71e,0xf7adf784,0xf80af7e0,
-0xf851f836,0xf88ff878,0xf8abf89d,0xf8bff8b4,0xf8bcf8c1,0xf8c4f8bd,0xf8c8f8c0,0xf8e2f8cf,
-0xf90ff8ef,0xf949f92e,0xf993f96c,0xf9eaf9b7,0xfa3efa14,0xfaa4fa73,0xfb01face,0xfb58fb2e,
-0xfbbcfb87,0xfc0efbe6,0xfc60fc3a,0xfca5fc7a,0xfcc6fcb4,0xfcd1fcd0,0xfcadfcc5,0xfc5ffc88,
-0xfbcffc17,0xfb31fb86,0xfa5efaca,0xf97df9f3,0xf893f90b,0xf7adf828,0xf6cef740,0xf60df66b,
-0xf56df5b7,0xf4e5f524,0xf47ef4ad,0xf43ff455,0xf425f42f,0xf432f423,0xf464f448,0xf4d3f492,
-0xf568f511,0xf636f5c5,0xf723f6a8,0xf836f7a8,0xf955f8c1,0xfa66f9db,0xfb56fae4,0xfc16fbbe,
-0xfca5fc6a,0xfceefcd8,0xfd07fd01,0xfcebfd02,0xfca9fccc,0xfc5ffc81,0xfc25fc42,0xfc07fc0d,
-0xfc0efbff,0xfc47fc20,0xfcb2fc73,0xfd42fcf6,0xfdf8fd9a,0xfeb9fe59,0xff95ff33,0x005f0002,
-0x012400c4,0x01e10183,0x02820236,0x031802d1,0x03ac0366,0x042703e8,0x048e045a,0x04da04b3,
-0x051e04fa,0x052d0527,0x0522052a,0x04ec0510,0x049b04cc,0x04200462,0x038703dd,0x02c70329,
-0x01ef0262,0x00ea016c,0xffcb0064,0xfe84ff2d,0xfd2efddf,0xfbd0fc82,0xfa64fb15,0xf905f9a9,
-0xf7dbf868,0xf6e4f753,0xf638f68b,0xf5fbf610,0xf61cf600,0xf696f647,0xf778f6fc,0xf8acf80b,
-0xfa1df965,0xfbabfadf,0xfd37fc72,0xfeb0fdf3,0x0008ff62,0x013600a4,0x024901cd,0x032902c3,
-0x03ef0398,0x048a0441,0x051c04d9,0x0599055b,0x060905d4,0x06580636,0x068b066d,0x069c0693,
-0x0677068b,0x06260654,0x05a105eb,0x04fb0555,0x043804a3,0x036503d3,0x029202fd,0x01c8022c,
-0x012b0171,0x00b400e4,0x007a0090,0x00790075,0x00bf0096,0x013100ee,0x01e30187,0x02c0024f,
-0x03bd0339,0x04cf043e,0x05e7055b,0x07000676,0x08160791,0x090b0893,0x09da0972,0x0a750a30,
-0x0ac10aa6,0x0ade0adc,0x0aab0acc,0x0a350a74,0x098c09e6,0x08b30927,0x07c0083a,0x06e90754,
-0x061c067e,0x058605cd,0x05240549,0x050b0506,0x0520050b,0x05710547,0x05f105a7,0x06a70647,
-0x076e070c,0x085907e1,0x093208cc,0x0a1e09a5,0x0b0a0a91,0x0be70b79,0x0ca30c46,0x0d380cf0,
-0x0da30d77,0x0dd20dc8,0x0dc60dd0,0x0d730daa,0x0ce60d30,0x0c210c8b,0x0b440bba,0x0a540acf,
-0x095e09d6,0x087e08ec,0x07b40816,0x07010752,0x067206b7,0x06090637,0x05c005de,0x059705a5,
-0x058d0589,0x058e058b,0x05a30595,0x05c605b5,0x05f205da,0x0625060b,0x064e0640,0x066b0664,
-0x06780678,0x06610673,0x06280648,0x05d7060b,0x0565059f,0x04f3052e,0x047c04b5,0x0418044a,
-0x03df03f2,0x03c303d1,0x03d303c3,0x040e03ee,0x0468043b,0x04cb049c,0x053c0502,0x059a056c,
-0x05eb05c2,0x062a0612,0x06500640,0x06720662,0x06790673,0x067d0678,0x067c067b,0x067b0683,
-0x06760679,0x0655066e,0x06330643,0x05fd0617,0x05a305ce,0x0532056b,0x04af04ef,0x0415046a,
-0x037003c7,0x02b3031f,0x01e80252,0x010b017d,0x0010008b,0xfeeaff7c,0xfd9cfe45,0xfc28fcf0,
-0xfa8ffb68,0xf8f1f9c2,0xf741f815,0xf5a2f66c,0xf41ef4d3,0xf2c7f36c,0xf1a8f229,0xf0c6f134,
-0xf020f06b,0xefb5efe5,0xef84ef94,0xef77ef7c,0xef8eef7f,0xefc8efa5,0xf01befe8,0xf07df048,
-0xf0f5f0b6,0xf17df138,0xf20ef1c8,0xf2a3f251,0xf346f2ed,0xf3f0f39c,0xf4a8f44a,0xf565f50c,
-0xf622f5c6,0xf6c9f67d,0xf75ef719,0xf7c2f791,0xf7fcf7e7,0xf7f2f800,0xf7a4f7d3,0xf71bf761,
-0xf66af6c7,0xf5b0f607,0xf4f6f551,0xf456f4a3,0xf3e2f416,0xf392f3af,0xf35cf377,0xf341f349,
-0xf31af333,0xf2e3f301,0xf28cf2be,0xf210f258,0xf164f1c2,0xf0a3f103,0xefc6f035,0xeef6ef5d,
-0xee28ee87,0xed7cedcd,0xecf7ed33,0xeca8ecc4,0xec99ec9b,0xecc0eca6,0xed2becf1,0xedcced78,
-0xeea1ee34,0xef9def1e,0xf0b4f024,0xf1e4f14d,0xf312f27a,0xf438f3a3,0xf549f4c9,0xf644f5d0,
-0xf726f6ba,0xf7fef798,0xf8acf858,0xf94bf8fb,0xf9d9f98f,0xfa42fa0c,0xfab3fa7c,0xfb0dfade,
-0xfb72fb3a,0xfbd0fb9f,0xfc28fbf8,0xfc8afc4e,0xfcf5fcc0,0xfd68fd35,0xfde9fda8,0xfe67fe25,
-0xfedefe9e,0xff50ff11,0xffbeff84,0x0016ffeb,0x00730045,0x00b10097,0x00e800d1,0x01210109,
-0x0158013d,0x018e0171,0x01bb019c,0x01f601da,0x02290214,0x025f024a,0x0291027e,0x02c102ab,
-0x02d802cc,0x02dd02e2,0x02c702db,0x02a602bc,0x0285029a,0x026f0272,0x02750268,0x02ae0285,
-0x032802dc,0x03f70384,0x0521047e,0x06a005d7,0x0850076f,0x0a410947,0x0c490b46,0x0e600d5e,
-0x10550f63,0x12301146,0x13dc130c,0x15391491,0x166015d3,0x174316d9,0x17f0179d,0x184f1824,
-0x187c186c,0x186c187b,0x18211845,0x179d17e0,0x16eb1744,0x16111686,0x15121594,0x14071489,
-0x12ec1377,0x11db125d,0x10d91157,0x0ffe106d,0x0f430fa3,0x0e9f0eee,0x0e120e5c,0x0d8b0dce,
-0x0d050d4c,0x0c7f0cc2,0x0bf00c3f,0x0b530ba0,0x0a920af6,0x09c00a2b,0x08df0956,0x07e00863,
-0x06e20769,0x05e50666,0x04e2055c,0x03f00468,0x030e0379,0x026402b0,0x01d60215,0x016d019b,
-0x01390152,0x012f0134,0x01580140,0x01a7017c,0x020f01d4,0x02a90254,0x035302f9,0x042503b7,
-0x05110498,0x05fd0588,0x06f5067e,0x07e50776,0x08b70855,0x096f0916,0x09f709bc,0x0a5a0a32,
-0x0a970a89,0x0a9d0aa0,0x0a830a96,0x0a4d0a67,0x09df0a14,0x095d09a3,0x08be0913,0x0816086c,
-0x075507b7,0x069606f2,0x05dd063c,0x052a057e,0x048704d5,0x03ec0434,0x035a03a1,0x02c0030b,
-0x02280278,0x017401d1,0x00a2010d,0xffb0002c,0xfea2ff28,0xfd7afe10,0xfc41fcdc,0xfb04fba3,
-0xf9d1fa6e,0xf8b0f942,0xf7b0f832,0xf6d0f73e,0xf618f672,0xf580f5c3,0xf4fbf53b,0xf48ef4c4,
-0xf425f450,0xf3d5f3f8,0xf37ef3a7,0xf350f362,0xf344f33d,0xf356f342,0xf39bf36c,0xf419f3d2,
-0xf4ccf467,0xf5b0f537,0xf6bef62c,0xf7d9f741,0xf8f3f863,0xf9f7f975,0xfacafa5e,0xfb5efb1e,
-0xfbabfb95,0xfbc5fbc8,0xfb88fbb2,0xfb25fb65,0xfaa0fae8,0xfa12fa59,0xf989f9c7,0xf924f94a,
-0xf8dcf8f5,0xf8ccf8cc,0xf8ebf8d5,0xf933f90a,0xf98ff95b,0xf9f7f9c9,0xfa4bfa1f,0xfa91fa72,
-0xfaa5fa9b,0xfa9efaaa,0xfa74fa8a,0xfa38fa56,0xf9e2fa08,0xf98af9b8,0xf946f962,0xf90df920,
-0xf8fbf8fe,0xf8f5f8fa,0xf90cf8fd,0xf934f922,0xf96ff959,0xf9b9f994,0xfa04f9e4,0xfa62fa31,
-0xfaccfa93,0xfb38fb03,0xfbbcfb74,0xfc37fbf9,0xfcbcfc79,0xfd46fd01,0xfdd2fd88,0xfe5dfe14,
-0xfee0fe9a,0xff5aff17,0xffc6ff88,0x0017ffeb,0x00560035,0x007f0072,0x008d0091,0x007d008c,
-0x004a0062,0xfff80028,0xff7dffc5,0xfeecff43,0xfe1ffe91,0xfd34fdb8,0xfc29fcb7,0xfafbfb95,
-0xf9b9fa5e,0xf85af90e,0xf707f7b2,0xf5bbf65f,0xf481f514,0xf37cf3f0,0xf29cf303,0xf1f7f23b,
-0xf197f1b8,0xf17ef186,0xf19ff189,0xf20df1cd,0xf2acf256,0xf38cf317,0xf47cf405,0xf590f50b,
-0xf6adf621,0xf7cbf736,0xf8c7f84a,0xf9aaf93e,0xfa57fa08,0xfaeafaa6,0xfb35fb17,0xfb5afb55,
-0xfb62fb66,0xfb6bfb67,0xfb6efb67,0xfb89fb70,0xfbc7fba2,0xfc30fbf1,0xfcd6fc81,0xfdb8fd45,
-0xfec6fe3f,0xfffaff55,0x015300a1,0x02b60204,0x041e0369,0x056f04c6,0x06b8061b,0x07db0751,
-0x08d2085e,0x099e0942,0x0a3809e5,0x0a8f0a71,0x0ac10ab0,0x0acb0ad2,0x0aa30abd,0x0a5c0a86,
-0x09ed0a2b,0x096f09ad,0x08df0929,0x08440891,0x07a107ee,0x06ee0740,0x064e069c,0x05a805fc,
-0x0520055f,0x048c04d3,0x04110451,0x039603d9,0x032e0369,0x02bc02f7,0x02440287,0x01c50207,
-0x01390184,0x009800e9,0xffe90045,0xff38ff93,0xfe97fee9,0xfe09fe48,0xfd9afdcd,0xfd56fd73,
-0xfd4cfd46,0xfd6ffd51,0xfdc7fd92,0xfe44fdfe,0xfee8fe98,0xff8eff3b,0x0044ffef,0x00e90094,
-0x0186013b,0x021501d2,0x029b0259,0x031602d9,0x038d0354,0x040503c7,0x0489044a,0x050604cf,
-0x0582054d,0x060605ce,0x06820652,0x06e206ba,0x07370718,0x0783075f,0x07aa0791,0x07c207af,
-0x07bd07c2,0x07a807b9,0x079207a0,0x0777078a,0x074c0766,0x072b0731,0x070b0718,0x06f906fb,
-0x06e206ef,0x06e706e1,0x06ea06ed,0x06f506f1,0x07100701,0x0730071e,0x0759073d,0x0786076c,
-0x07b60796,0x07e107cd,0x080f07f6,0x08380822,0x08760855,0x08aa088c,0x08f108cd,0x094e0921,
-0x09b90984,0x0a3609f5,0x0ac40a7e,0x0b520b0c,0x0be90b9b,0x0c790c2f,0x0cfd0cb7,0x0d7d0d3d,
-0x0df00dbc,0x0e450e1d,0x0e960e71,0x0ebe0ea8,0x0eca0ecb,0x0ec20ecc,0x0e8a0ea9,0x0e2d0e62,
-0x0da80df0,0x0ce40d4c,0x0bf30c72,0x0acb0b6b,0x09810a2e,0x081108cb,0x069b075e,0x052305dd,
-0x03b40468,0x0270030c,0x014001d6,0x003900b5,0xff52ffbc,0xfea7fef2,0xfe11fe53,0xfda2fdc6,
-0xfd5ffd78,0xfd31fd46,0xfd30fd2e,0xfd35fd35,0xfd47fd46,0xfd4ffd54,0xfd6bfd5f,0xfd5cfd66,
-0xfd5afd59,0xfd3bfd4b,0xfd26fd30,0xfd0ffd12,0xfd03fd01,0xfcf4fcf8,0xfcfffcfc,0xfd11fd0c,
-0xfd2cfd23,0xfd55fd44,0xfd7dfd67,0xfd99fd8b,0xfdbefdaa,0xfdc8fdca,0xfddafdd3,0xfde5fde4,
-0xfdeffdeb,0xfdf4fdf0,0xfdebfde6,0xfdd2fddf,0xfdb3fdc2,0xfd70fd8d,0xfd19fd46,0xfca2fcdc,
-0xfc1bfc5b,0xfb86fbce,0xfaeafb39,0xfa56fa9d,0xf9d6fa16,0xf96cf99d,0xf900f93d,0xf8a4f8d4,
-0xf842f881,0xf7d8f81b,0xf753f79e,0xf6b0f708,0xf5f4f655,0xf515f584,0xf422f49a,0xf323f3a4,
-0xf22df2a6,0xf142f1b5,0xf06ff0d8,0xefb2f011,0xef18ef62,0xeea4eed7,0xee4eee75,0xee16ee29,
-0xee0bee0c,0xee11ee09,0xee30ee1e,0xee56ee46,0xee7dee67,0xee95ee8a,0xeea3eea6,0xee9aeea4,
-0xee8cee94,0xee6fee7e,0xee64ee68,0xee63ee5a,0xee7cee66,0xeec7eea1,0xef46ef03,0xf006efa1,
-0xf0f9f07e,0xf20cf183,0xf331f29e,0xf45df3d0,0xf571f4ea,0xf65cf5e8,0xf721f6c3,0xf7b8f778,
-0xf81af7ec,0xf856f83b,0xf86df865,0xf874f86c,0xf864f870,0xf845f852,0xf81ff82a,0xf7f4f807,
-0xf7cdf7dd,0xf791f7ac,0xf765f77d,0xf733f74b,0xf71df72d,0xf70bf717,0xf715f711,0xf73af729,
-0xf788f75d,0xf802f7c4,0xf8a5f849,0xf972f903,0xfa63f9e3,0xfb78faed,0xfc9afc09,0xfdd3fd31,
-0xff1efe73,0x0072ffc8,0x01bc0113,0x03050262,0x043c039f,0x056c04d2,0x067705fb,0x076c06f5,
-0x084507dd,0x08fc08a1,0x098d0946,0x0a0f09d4,0x0a7b0a46,0x0adb0aac,0x0b120b01,0x0b490b2e,
-0x0b590b52,0x0b460b50,0x0b150b2d,0x0ac00af1,0x0a4b0a8c,0x09ce0a14,0x0943098a,0x08b108f3,
-0x08200869,0x07a607dd,0x073c076e,0x06e80716,0x06b306cf,0x069706a4,0x06950694,0x06ab069e,
-0x06db06bc,0x073b0704,0x07b40775,0x085007f4,0x08fe08a1,0x09c0095e,0x0a830a21,0x0b380ae1,
-0x0bc80b86,0x0c3b0c08,0x0c670c56,0x0c690c70,0x0c460c63,0x0bfe0c2b,0x0ba00bd6,0x0b380b6c,
-0x0add0b05,0x0a890ab0,0x0a5f0a73,0x0a610a5d,0x0a980a7f,0x0afa0ac7,0x0b890b33,0x0c2f0bd7,
-0x0ce70c7d,0x0dab0d44,0x0e690e08,0x0f120ec3,0x0f950f57,0x0ff40fce,0x10231014,0x10251026,
-0x10021019,0x0fba0fe8,0x0f6b0f97,0x0f040f35,0x0e910eca,0x0e290e63,0x0db80df6,0x0d2d0d6f,
-0x0c870cdf,0x0bc70c31,0x0add0b5f,0x09c60a57,0x08960931,0x073f07f0,0x05cf0686,0x04570515,
-0x02f103a4,0x019e0246,0x006000fc,0xff47ffce,0xfe59fece,0xfd98fdf0,0xfd02fd47,0xfc8dfcc5,
-0xfc52fc6c,0xfc36fc3b,0xfc49fc3a,0xfc74fc55,0xfcbcfc8c,0xfd16fcde,0xfd85fd47,0xfdf6fdbc,
-0xfe76fe35,0xfee9feb0,0xff60ff22,0xffc1ff8f,0x0017ffea,0x00500033,0x00770066,0x008b008a,
-0x00890095,0x0073007e,0x004d0063,0x00200037,0xffe4ffff,0xffa0ffbf,0xff5aff7f,0xff1cff40,
-0xfefdff0c,0xfef0feed,0xfef5feee,0xff11feff,0xff30ff18,0xff55ff3c,0xff6fff65,0xff81ff7b,
-0xff75ff82,0xff5aff71,0xff25ff43,0xfecdfefe,0xfe5bfe96,0xfde6fe23,0xfd61fda1,0xfce1fd21,
-0xfc67fca7,0xfc0afc3b,0xfbbafbd8,0xfb7ffb8f,0xfb5efb69,0xfb4afb54,0xfb4bfb4d,0xfb3dfb43,
-0xfb21fb34,0xfafffb19,0xfac8fae1,0xfa72faa0,0xfa00fa3c,0xf977f9bf,0xf8caf925,0xf801f867,
-0xf730f795,0xf658f6c3,0xf593f5f5,0xf4f5f542,0xf482f4b8,0xf44cf45e,0xf458f44b,0xf4b8f481,
-0xf555f503,0xf630f5be,0xf72ef6a7,0xf832f7ac,0xf919f8a0,0xf9dcf981,0xfa52fa1e,0xfa7afa6a,
-0xfa53fa6e,0xf9e0fa24,0xf93af995,0xf876f8dc,0xf7a7f814,0xf6f3f749,0xf665f6ac,0xf610f633,
-0xf5f8f5f7,0xf614f5fd,0xf663f632,0xf6c3f68e,0xf744f704,0xf7cbf787,0xf83ef809,0xf8aef87a,
-0xf909f8e2,0xf953f931,0xf997f96f,0xf9d5f9b5,0xfa22f9f8,0xfa6bfa47,0xfadcfaa6,0xfb58fb1b,
-0xfbe8fb9f,0xfc79fc2f,0xfd18fcc5,0xfda6fd62,0xfe29fdeb,0xfe9cfe62,0xfeebfec4,0xff20ff03,
-0xff38ff31,0xff3eff39,0xff2bff39,0xff2aff28,0xff32ff2b,0xff56ff42,0xff95ff72,0xffeeffc6,
-0x00760036,0x010b00c8,0x019f014b,0x022c01ea,0x028d0253,0x02c502a8,0x02c702c7,0x028a02ae,
-0x021d025b,0x018901df,0x00d50138,0x0006006d,0xff40ffa5,0xfe74fed7,0xfdbafe11,0xfd08fd5d,
-0xfc79fcc2,0xfc00fc3a,0xfb9efbcc,0xfb49fb70,0xfb12fb29,0xfae1faf2,0xfab2fac8,0xfa8ffaa1,
-0xfa74fa86,0xfa6afa71,0xfa6dfa6c,0xfa7dfa73,0xfab3fa8d,0xfae9fac1,0xfb3bfb0b,0xfba8fb6d,
-0xfc28fbe5,0xfca9fc65,0xfd20fce6,0xfd97fd60,0xfe0bfdd7,0xfe6afe41,0xfebcfe9a,0xff05fee1,
-0xff44ff1f,0xff81ff61,0xffc9ffa3,0x001bffe7,0x006e0045,0x00c7009c,0x012200fa,0x016c0148,
-0x01be019d,0x021301eb,0x02620239,0x02a50286,0x02ef02cc,0x03370310,0x039a0365,0x03ea03c4,
-0x0453041b,0x04ce048f,0x053b0504,0x05b8057a,0x063005f7,0x06a9066e,0x071106db,0x075f0738,
-0x0797077d,0x07b207a9,0x07ba07c1,0x07a907b2,0x0789079b,0x0748076e,0x0709072d,0x06af06e7,
-0x065c068a,0x06000632,0x05b905db,0x05710592,0x05460558,0x052e0532,0x05390533,0x054c053d,
-0x05770560,0x059c0585,0x05c105ab,0x05dd05d2,0x05ef05e5,0x060205fd,0x060b060a,0x061b0619,
-0x0638062f,0x064f0645,0x06800667,0x06a30696,0x06c906bb,0x06df06d1,0x06dd06e3,0x06bc06c7,
-0x06720695,0x061d0646,0x05a505dd,0x051f0560,0x049204d9,0x04150456,0x03b903e3,0x0370038c,
-0x03540359,0x035c0350,0x03960377,0x041103d7,0x04bc046b,0x05880524,0x066c05fe,0x077006ee,
-0x086f07ed,0x096f08ed,0x0a5409e4,0x0b150ab8,0x0ba40b66,0x0bfe0bdc,0x0c1e0c21,0x0c010c1b,
-0x0bad0be1,0x0b340b77,0x0a910ae4,0x09ea0a43,0x094b0999,0x08a808f4,0x082b0862,0x07c407ed,
-0x078607a0,0x075a076d,0x0746074a,0x0732073d,0x0721072d,0x07020711,0x06cc06eb,0x067a06a6,
-0x0616064b,0x058605cc,0x04fa0543,0x046004a8,0x03c80410,0x03480385,0x02fa031d,0x02d402de,
-0x02dd02cd,0x031e02f7,0x0391034e,0x042403d8,0x04cf047a,0x057e0525,0x061a05cf,0x068c065d,
-0x06df06c3,0x06df06ef,0x06a506d1,0x061e066c,0x055405bd,0x044c04d2,0x030803af,0x0192024a,
-0x000600cc,0xfe54ff2a,0xfca2fd76,0xfaf0fbcc,0xf94ffa22,0xf7cef888,0xf675f721,0xf54af5dc,
-0xf44bf4c3,0xf38df3e2,0xf2e6f32c,0xf283f2b5,0xf22af24f,0xf1fcf20f,0xf1edf1f5,0xf1fef1f6,
-0xf214f20b,0xf251f230,0xf2a2f279,0xf2fff2d0,0xf35bf32e,0xf3c6f38e,0xf41df3f5,0xf465f43e,
-0xf492f47b,0xf499f49b,0xf486f48f,0xf452f471,0xf411f434,0xf3d9f3f5,0xf39ff3b5,0xf379f389,
-0xf371f374,0xf391f37d,0xf3baf3a3,0xf401f3e3,0xf447f429,0xf488f467,0xf4b8f4a0,0xf4d7f4cc,
-0xf4d9f4da,0xf4baf4c7,0xf4a1f4b3,0xf482f48f,0xf473f47e,0xf45df465,0xf45ef45c,0xf470f467,
-0xf48af477,0xf4acf496,0xf4c1f4b0,0xf4cbf4c4,0xf4caf4cf,0xf4bbf4c5,0xf49ef4af,0xf47cf498,
-0xf450f46f,0xf41ff434,0xf3e8f407,0xf3b8f3cd,0xf390f3a8,0xf380f386,0xf373f376,0xf386f378,
-0xf3bef3a0,0xf410f3e8,0xf47bf440,0xf510f4c5,0xf5baf563,0xf679f614,0xf73af6d8,0xf7fbf799,
-0xf8c5f860,0xf96ef918,0xfa16f9c6,0xfab6fa67,0xfb58fb0a,0xfc05fbaf,0xfcaefc57,0xfd6afd0b,
-0xfe29fdc5,0xfefdfe90,0xffc7ff67,0x00990035,0x016f0108,0x023701d3,0x02eb0295,0x038c033f,
-0x040503d0,0x045b043c,0x04a00489,0x04bf04b5,0x04c004c6,0x04a804bb,0x04710490,0x04350453,
-0x03e30404,0x038d03b6,0x03450363,0x030a0326,0x02e502f5,0x02db02dd,0x02e102db,0x030602f2,
-0x03390321,0x0388035d,0x03d103ad,0x044003ff,0x04b80479,0x053504f5,0x05d50584,0x0688062d,
-0x075406ea,0x083407bd,0x092608b4,0x0a1f09a0,0x0b090a99,0x0bf60b84,0x0ccb0c67,0x0d7a0d26,
-0x0dfe0db9,0x0e520e2b,0x0e830e73,0x0e7e0e89,0x0e4c0e6d,0x0df50e1e,0x0d7f0db8,0x0ce70d39,
-0x0c480c9e,0x0b9a0bf3,0x0ae90b40,0x0a410a92,0x09a709ea,0x091b095b,0x089c08d3,0x08370860,
-0x07e1080e,0x079f07c1,0x076b078a,0x073f075b,0x071d0733,0x06f2070b,0x06dc06e1,0x06d106d3,
-0x06d906ce,0x06fa06e6,0x0737070b,0x0790075d,0x07f607c2,0x08860836,0x091b08c7,0x09b60961,
-0x0a3c09fb,0x0ab20a76,0x0afd0adf,0x0b0b0b05,0x0afc0b06,0x0abc0add,0x0a5b0a92,0x09eb0a2a,
-0x096b09ae,0x08fe0936,0x08a208cf,0x08740883,0x085c0867,0x08760868,0x08ae088f,0x08eb08c4,
-0x0936090a,0x09600944,0x09750968,0x096e0976,0x09370956,0x08ec0913,0x088e08bd,0x0826085a,
-0x07ba07ef,0x07560787,0x0701072e,0x06b106d6,0x065b0681,0x05fa062e,0x057105c1,0x04d30529,
-0x03f8046e,0x02f1037f,0x01ab0252,0x003d00f3,0xfeb2ff7b,0xfd10fddd,0xfb77fc47,0xf9eefaaa,
-0xf897f93a,0xf770f7fa,0xf68af6f3,0xf5eaf636,0xf59df5c4,0xf58df591,0xf5a4f593,0xf5daf5b5,
-0xf632f606,0xf691f661,0xf6edf6c0,0xf737f714,0xf77ff763,0xf7c5f7a3,0xf80bf7e5,0xf855f824,
-0xf8aaf87c,0xf903f8d5,0xf974f937,0xf9edf9b4,0xfa67fa2d,0xfae4faad,0xfb57fb28,0xfbbcfb8f,
-0xfbfffbe5,0xfc33fc1a,0xfc3cfc3c,0xfc24fc38,0xfbe9fc0c,0xfb9cfbca,0xfb3afb74,0xfac0fb03,
-0xfa40fa81,0xf9c4fa05,0xf94af988,0xf8ddf914,0xf884f8ac,0xf82ef84c,0xf7f8f80d,0xf7cff7e0,
-0xf7c3f7c4,0xf7ddf7ce,0xf805f7f0,0xf859f82d,0xf8c5f887,0xf954f907,0xf9eef997,0xfaa4fa41,
-0xfb5afafb,0xfc16fbb9,0xfccdfc74,0xfd75fd23,0xfe07fdc2,0xfe90fe4a,0xff06fece,0xff61ff3c,
-0xffb1ff86,0xfff3ffd8,0x00120008,0x00250028,0x001f0027,0x00010010,0xffc5ffdf,0xff77ff9b,
-0xff09ff38,0xfe90fec9,0xfe14fe53,0xfda7fddb,0xfd4cfd74,0xfd04fd1f,0xfcdffce6,0xfcd2fcd3,
-0xfcedfcdd,0xfd24fcff,0xfd78fd48,0xfddffdaa,0xfe48fe0e,0xfeb5fe7e,0xff0bfee2,0xff50ff31,
-0xff6bff69,0xff61ff71,0xff22ff44,0xfeb7fef2,0xfe0cfe67,0xfd40fdad,0xfc55fcd2,0xfb5afbe0,
-0xfa56fad9,0xf953f9d7,0xf85ef8d1,0xf771f7e8,0xf6a5f707,0xf5f8f64f,0xf56bf5b3,0xf50cf53a,
-0xf4dff4f6,0xf4cdf4d0,0xf4ebf4d7,0xf53bf50c,0xf5adf56e,0xf651f5f8,0xf713f6a6,0xf7f9f784,
-0xf8f4f874,0xf9fcf975,0xfafdfa7d,0xfc0bfb88,0xfd09fc89,0xfe04fd8c,0xfeedfe7a,0xffd0ff5f,
-0x00a80042,0x016f010d,0x023301cf,0x02d00283,0x03530313,0x03b10385,0x03e703d4,0x03f503ef,
-0x03cc03ea,0x037903ad,0x03050347,0x028202c4,0x01f4023b,0x016601a7,0x00e00120,0x007500b2,
-0x00210048,0xffe1fff9,0xffb2ffc3,0xff86ff96,0xff56ff69,0xff15ff36,0xfec2feeb,0xfe57fe8d,
-0xfde4fe1e,0xfd6efda8,0xfcedfd2a,0xfc81fcb1,0xfc36fc54,0xfc12fc1c,0xfc2bfc14,0xfc76fc4d,
-0xfd06fcb4,0xfdb3fd5c,0xfe8efe20,0xff7cff09,0x0067fff3,0x014200d0,0x020901aa,0x02980255,
-0x031402e0,0x036a0346,0x03a50388,0x03d003bc,0x03f003e4,0x040d0403,0x04300423,0x04530445,
-0x047b046a,0x04a30495,0x04be04b4,0x04c904c1,0x04c604c7,0x04b004b7,0x0493049f,0x04650477,
-0x04440459,0x04270433,0x0419041f,0x0428041b,0x04550441,0x049f0477,0x04f604c6,0x056d0539,
-0x05e605ad,0x066c0624,0x06dc06a2,0x0743070f,0x079f0775,0x07e807c2,0x082b080b,0x08590845,
-0x08800869,0x0893088a,0x08a50899,0x089c08a4,0x08950896,0x08710887,0x0849085f,0x07ff0822,
-0x07b207da,0x075c078f,0x06fc0735,0x06b006d9,0x06660689,0x063f0654,0x063d063d,0x066c064f,
-0x06ba068d,0x073f06f7,0x07d00784,0x0886082a,0x094c08ec,0x0a1009af,0x0ad00a73,0x0b620b1c,
-0x0be50baa,0x0c4f0c1b,0x0c970c75,0x0ccf0cb1,0x0ceb0ce5,0x0cef0cec,0x0ce70cef,0x0cca0cda,
-0x0ca30cba,0x0c540c7e,0x0bec0c24,0x0b680bb1,0x0ac70b1c,0x0a090a70,0x093409a2,0x084908c3,
-0x074d07d7,0x064f06d5,0x055a05d3,0x046d04e8,0x038d03fb,0x02c70328,0x021d026a,0x019601d6,
-0x0124015a,0x00d200fa,0x009400b5,0x00630073,0x002f004a,0xffff0015,0xffc7ffdd,0xff83ff9f,
-0xff36ff5a,0xfee9ff14,0xfea0fec6,0xfe5afe7b,0xfe21fe37,0xfdf0fe06,0xfdcafdd7,0xfda7fdb6,
-0xfd88fd94,0xfd56fd6f,0xfd21fd3f,0xfcdbfd07,0xfc8dfcba,0xfc33fc63,0xfbdefc08,0xfb86fbaf,
-0xfb33fb5a,0xfaebfb07,0xfabffacf,0xfaa1faa9,0xfa9dfa9c,0xfabffaae,0xfaf1fadc,0xfb36fb17,
-0xfb98fb69,0xfbf3fbc6,0xfc47fc23,0xfc92fc6d,0xfcaafca5,0xfcabfcb2,0xfc86fca4,0xfc1efc5d,
-0xfb91fbde,0xfadbfb43,0xf9f7fa70,0xf903f983,0xf7f8f881,0xf6e7f774,0xf5cef650,0xf4cef545,
-0xf3dbf450,0xf306f365,0xf254f2a2,0xf1cbf20a,0xf173f197,0xf144f154,0xf13cf134,0xf14ff13b,
-0xf180f166,0xf1b8f197,0xf1fbf1db,0xf24cf222,0xf2a9f27c,0xf305f2d5,0xf371f33a,0xf3ddf3a7,
-0xf46af424,0xf50df4b6,0xf5c0f563,0xf68df624,0xf75bf6f0,0xf831f7ca,0xf8f7f897,0xf9a9f952,
-0xfa33f9ef,0xfa8efa65,0xfabdfaad,0xfab5fac5,0xfa8bfaa6,0xfa29fa5f,0xf9b8f9f6,0xf939f97d,
-0xf8adf8f2,0xf823f865,0xf79ef7e4,0xf723f75c,0xf6b9f6ea,0xf644f67b,0xf5e1f612,0xf57ff5ae,
-0xf519f54b,0xf4a9f4e8,0xf43bf471,0xf3d3f408,0xf369f39e,0xf313f33e,0xf2d7f2f1,0xf2bff2c6,
-0xf2d9f2c2,0xf32df300,0xf3bff373,0xf473f412,0xf549f4dd,0xf633f5b7,0xf71ef6a8,0xf802f78d,
-0xf8d7f86d,0xf9acf947,0xfa77fa1b,0xfb38fada,0xfbfefb9b,0xfccbfc63,0xfdacfd3f,0xfe96fe20,
-0xff8eff0e,0x00860008,0x01860105,0x028d0205,0x03840307,0x046803ee,0x054104d6,0x061305a6,
-0x06c2066f,0x07680715,0x07ff07bb,0x088e084d,0x091608d0,0x09930957,0x0a0609ca,0x0a6e0a3f,
-0x0ad30aa7,0x0b220b03,0x0b6a0b4a,0x0b980b85,0x0bc00bac,0x0bd00bc8,0x0bdc0bd2,0x0bd80bdc,
-0x0bcc0bd0,0x0bba0bc4,0x0ba10ba5,0x0b810b8d,0x0b6b0b71,0x0b4f0b5c,0x0b340b3e,0x0b180b28,
-0x0b010b12,0x0af10af4,0x0ad30ae0,0x0aa30aba,0x0a880a99,0x0a500a71,0x0a270a40,0x09f80a0d,
-0x09ca09e0,0x099509b4,0x09760980,0x0967096d,0x0967095f,0x098b0978,0x09c109a2,0x0a0d09e4,
-0x0a840a45,0x0af90ab6,0x0b820b39,0x0c060bc0,0x0c770c3b,0x0cd00c9e,0x0d110cf2,0x0d350d2f,
-0x0d310d3d,0x0d110d2c,0x0cd60cfc,0x0c730caf,0x0bf20c38,0x0b590ba7,0x0aa90afb,0x09d40a3b,
-0x08fa095f,0x08100883,0x072507a0,0x064306bd,0x056e05d6,0x049d0506,0x03d10436,0x030d036e,
-0x024702ac,0x018101ea,0x00b30121,0xffe70052,0xff17ff83,0xfe54feaf,0xfdb1fdfa,0xfd2bfd6a,
-0xfcdcfcf7,0xfccffcc7,0xfcf9fcdf,0xfd6cfd2f,0xfe11fdb9,0xfee0fe75,0xffcbff59,0x00b80046,
-0x01890122,0x024601e7,0x02cf0295,0x032202fb,0x033b0332,0x032c0338,0x02f20312,0x02a102ce,
-0x02410272,0x01e10214,0x017e01b6,0x0134015d,0x00f10115,0x00bf00dd,0x009a00ae,0x00740089,
-0x004b005e,0x001c0033,0xffd9fffb,0xffa1ffc4,0xff55ff7e,0xff02ff29,0xfeb1fed7,0xfe7bfe90,
-0xfe40fe57,0xfe1bfe27,0xfe10fe12,0xfe05fe0a,0xfe16fe09,0xfe23fe1d,0xfe29fe2b,0xfe23fe2f,
-0xfe0efe1a,0xfdd2fdef,0xfd75fda9,0xfd03fd41,0xfc74fcc3,0xfbc2fc22,0xfb00fb68,0xfa2efa97,
-0xf95cf9c9,0xf877f8ea,0xf7a2f807,0xf6d3f740,0xf605f666,0xf54af5aa,0xf4a7f4ec,0xf423f456,
-0xf3d6f3f2,0xf3aef3b2,0xf3bff3b1,0xf414f3e0,0xf4a4f458,0xf564f500,0xf65ff5dd,0xf77ef6eb,
-0xf8aff817,0xf9f4f94d,0xfb3afa96,0xfc7afbda,0xfdb8fd20,0xfecdfe40,0xffcbff52,0x00a20036,
-0x015200fa,0x01c10190,0x020901ee,0x02130219,0x01eb0209,0x017f01be,0x00ed0141,0x00340099,
-0xff65ffcd,0xfe8cfef8,0xfdbdfe2a,0xfcfcfd5c,0xfc67fcad,0xfbdefc1f,0xfb83fbb0,0xfb48fb61,
-0xfb25fb34,0xfb22fb23,0xfb2cfb25,0xfb34fb31,0xfb4afb3e,0xfb6bfb56,0xfb82fb74,0xfbaafb95,
-0xfbd7fbc3,0xfc1afbf7,0xfc6ffc3f,0xfcdcfc9d,0xfd69fd1f,0xfe05fdb6,0xfebcfe66,0xff7cff1e,
-0x004cffe7,0x010d00b1,0x01c00164,0x02600213,0x02df029e,0x03240307,0x0342033f,0x0324033d,
-0x02cb0305,0x02480291,0x019401f7,0x00bc012d,0xffda004b,0xfeecff5f,0xfe0cfe77,0xfd47fd9b,
-0xfca5fcf0,0xfc20fc5d,0xfbd2fbf4,0xfb9afbb5,0xfb7afb8c,0xfb69fb6f,0xfb4ffb5d,0xfb17fb2d,
-0xfacdfaf5,0xfa69faa3,0xf9f0fa33,0xf968f9b1,0xf8dff928,0xf868f8a0,0xf80cf834,0xf7def7e9,
-0xf7d8f7d2,0xf7fdf7e2,0xf84bf823,0xf8a4f877,0xf916f8e0,0xf971f945,0xf9b3f997,0xf9d7f9ce,
-0xf9d6f9dd,0xf9bef9cd,0xf98df9a6,0xf95ef973,0xf92ff945,0xf90af919,0xf916f916,0xf94df92d,
-0xf9a9f978,0xfa2ef9ea,0xfae4fa8a,0xfbadfb4c,0xfc91fc1d,0xfd92fd14,0xfe90fe0e,0xff9aff11,
-0x00960016,0x018a010a,0x025c01f4,0x031502bc,0x03b00368,0x042303ef,0x04640446,0x048b047f,
-0x048b048a,0x045f0479,0x04290444,0x03e60402,0x03a203bc,0x03640383,0x03370352,0x03170322,
-0x02ef02fb,0x02ca02d9,0x029e02b3,0x026a0283,0x0236024f,0x01f70218,0x01bf01dc,0x019601b0,
-0x018e0194,0x01b3019a,0x022101df,0x02cb026b,0x03b2033e,0x04c8043b,0x06110572,0x075b06c0,
-0x088e0801,0x0997091d,0x0a550a02,0x0abe0a9a,0x0ad10ad5,0x0a890aba,0x09ff0a55,0x094409a9,
-0x087708d8,0x07ad0809,0x07090753,0x069a06c6,0x06690670,0x06780665,0x06bd0699,0x072906f0,
-0x07ad0773,0x083007f4,0x0898086d,0x08dd08c7,0x08f508ed,0x08da08f0,0x089408be,0x0838086e,
-0x07cc0801,0x07660795,0x07160738,0x06d606eb,0x06bf06c0,0x06c806c1,0x06e206d2,0x070206f0,
-0x071d0710,0x07240729,0x07140725,0x06e20704,0x069f06c3,0x06400671,0x05d10607,0x056f05a5,
-0x05190541,0x04e004fa,0x04c104cb,0x04ce04bf,0x04f104db,0x05300515,0x0584055d,0x05d505b0,
-0x0632060b,0x06720657,0x06b5069d,0x06e406d4,0x070d06f8,0x07180717,0x07220714,0x070e0714,
-0x06f80704,0x06cf06e3,0x069f06b9,0x0659067b,0x06120637,0x05be05e6,0x055a0593,0x04fb052f,
-0x04a904d0,0x0452047c,0x0407042d,0x03db03f3,0x03bb03d0,0x03a103ab,0x0397039b,0x038e038f,
-0x0389038c,0x03820387,0x036f0379,0x03630369,0x0336034d,0x0304031e,0x02bb02df,0x025f0293,
-0x01f4022d,0x018701c0,0x01090146,0x008400c8,0xffec0037,0xff63ffac,0xfec6ff17,0xfe20fe79,
-0xfd6bfdc0,0xfca6fd0f,0xfbd8fc3c,0xfb02fb67,0xfa2efa93,0xf96cf9ca,0xf8bdf915,0xf824f86e,
-0xf7b5f7e8,0xf773f792,0xf74df75a,0xf74df74d,0xf74ef751,0xf75ff755,0xf76ef766,0xf76af76c,
-0xf751f75f,0xf726f742,0xf6fbf70d,0xf6bbf6d8,0xf685f692,0xf65ef66d,0xf642f643,0xf63cf633,
-0xf643f634,0xf63bf63e,0xf63ff637,0xf62df637,0xf609f620,0xf5d0f5f0,0xf57ef5aa,0xf516f54b,
-0xf49bf4df,0xf433f467,0xf3bff3fb,0xf367f394,0xf322f345,0xf2edf305,0xf2cbf2d7,0xf2b8f2ba,
-0xf2a6f2af,0xf299f2a0,0xf281f28b,0xf25ff26c,0xf231f24d,0xf1faf21d,0xf1c0f1e2,0xf18cf1ac,
-0xf15df179,0xf13df146,0xf131f134,0xf144f12e,0xf178f157,0xf1d4f1a3,0xf25bf213,0xf303f2a6,
-0xf3d4f36a,0xf4bef444,0xf5c9f547,0xf6cdf64a,0xf7dcf757,0xf8d7f85b,0xf9bbf94a,0xfa8dfa29,
-0xfb41fae7,0xfbe9fb9f,0xfc74fc30,0xfcf4fcb9,0xfd6efd36,0xfde3fdb3,0xfe53fe1f,0xfecbfe97,
-0xff3dff0a,0xffbeff7f,0x002dfff0,0x00a00064,0x00f700c8,0x01380118,0x0163014f,0x0171016c,
-0x015a0165,0x011e013d,0x00b400ec,0x00230074,0xff7dffe0,0xfec4ff2f,0xfdfdfe66,0xfd4bfda1,
-0xfcb4fcf7,0xfc48fc6e,0xfc0afc19,0xfc06fbf7,0xfc52fc25,0xfcdafc8e,0xfd99fd31,0xfe82fe0b,
-0xff91ff0c,0x00b0001c,0x01da0147,0x02f50267,0x04150388,0x052d04a4,0x063505ae,0x072906b7,
-0x081f07ac,0x090a0898,0x09e60973,0x0ab30a50,0x0b6b0b0d,0x0c0d0bba,0x0c990c56,0x0cfa0cc3,
-0x0d3c0d20,0x0d500d45,0x0d390d49,0x0cfe0d16,0x0ca30cd0,0x0c390c75,0x0bbf0bfa,0x0b540b8a,
-0x0af60b27,0x0abf0ad6,0x0aa90aaf,0x0ab30aaf,0x0ae50aca,0x0b270b0b,0x0b7f0b50,0x0bd10ba5,
-0x0c270bf8,0x0c590c41,0x0c710c67,0x0c6e0c77,0x0c500c63,0x0c0f0c2f,0x0bc20bdf,0x0b5e0b8c,
-0x0b000b2c,0x0a9e0aca,0x0a390a69,0x09d80a0a,0x096f09a0,0x0901093f,0x088808cb,0x08000849,
-0x076407b2,0x06b9070d,0x060b0667,0x055705b5,0x04a90504,0x040a0458,0x038f03cc,0x03280357,
-0x02fe030b,0x02eb02ea,0x030e02f8,0x035b032e,0x03c20393,0x043503f8,0x04a50473,0x051604dc,
-0x05670545,0x05950585,0x05a605a5,0x059405a4,0x0562057f,0x050b0539,0x04a204d5,0x04200461,
-0x03a003db,0x0313035b,0x029402ce,0x021a0255,0x01a101db,0x012b0162,0x00b800f2,0x005c007e,
-0xfff0001b,0xff8cffb6,0xff26ff55,0xfebefef0,0xfe61fe8b,0xfdf5fe2d,0xfd88fdbc,0xfd14fd4f,
-0xfca1fcdc,0xfc27fc65,0xfbaafbeb,0xfb2dfb70,0xfabdfaf7,0xfa53fa87,0xf9f5fa1f,0xf9b5f9d3,
-0xf998f9a2,0xf998f995,0xf9c9f9a8,0xfa18f9f3,0xfa8bfa50,0xfb19fada,0xfbadfb66,0xfc51fbf9,
-0xfceafc92,0xfd67fd27,0xfdd9fd9e,0xfe2cfe08,0xfe6ffe4d,0xfe95fe8a,0xfeb8fea9,0xfec9fec6,
-0xfed6fec9,0xfed7fede,0xfed3fed4,0xfed3fed4,0xfecefed0,0xfec3fecc,0xfecafeca,0xfecdfecf,
-0xfecdfec9,0xfedafed6,0xfee5fee7,0xfef0fee2,0xfef1feee,0xfef4fef1,0xfeeafef0,0xfed9fee0,
-0xfec4fed3,0xfe9ffeb2,0xfe81fe91,0xfe5dfe70,0xfe21fe39,0xfdecfe04,0xfda0fdc7,0xfd53fd78,
-0xfcf5fd2c,0xfc8bfcc6,0xfc22fc56,0xfbb4fbf4,0xfb3cfb7b,0xfac0fb03,0xfa5efa8f,0xf9fdfa2c,
-0xf9aff9cf,0xf96af987,0xf92ff952,0xf908f922,0xf8eaf8f7,0xf8d2f8e1,0xf8cef8d4,0xf8cdf8cd,
-0xf8dcf8d5,0xf8f3f8e2,0xf921f90a,0xf96bf942,0xf9d1f99b,0xfa5afa16,0xfb04faa7,0xfbc5fb62,
-0xfc9efc2a,0xfd95fd0d,0xfe80fdfc,0xff6dfef9,0x005dffe3,0x013100c6,0x01e90194,0x027f023a,
-0x02f302be,0x03430322,0x035b0356,0x0351035a,0x031c0337,0x02c002ef,0x02450283,0x01aa01f5,
-0x00f70152,0x00330098,0xff6bffd7,0xfe9fff09,0xfdd5fe3b,0xfd18fd73,0xfc5dfcbd,0xfbbffc0e,
-0xfb27fb70,0xfaaefae4,0xfa38fa72,0xf9e6fa07,0xf9a1f9bc,0xf972f983,0xf963f95c,0xf96df95a,
-0xf99ff978,0xf9e4f9b0,0xfa4efa10,0xfad8fa8b,0xfb89fb27,0xfc4afbe7,0xfd27fcba,0xfe02fd9c,
-0xfee1fe77,0xffbcff5a,0x00830027,0x012e00df,0x01bb0179,0x021701ee,0x02440235,0x02440247,
-0x02170237,0x01b101ea,0x01360173,0x009600e8,0xffdd0040,0xff20ff87,0xfe75fecb,0xfdd9fe2b,
-0xfd54fd92,0xfcebfd1c,0xfca5fcbe,0xfc76fc90,0xfc45fc5b,0xfc15fc31,0xfbcffbf3,0xfb7efbad,
-0xfb05fb42,0xfa94fac8,0xfa00fa48,0xf973f9b5,0xf900f936,0xf8a5f8cb,0xf871f887,0xf864f868,
-0xf888f86f,0xf8d2f8ab,0xf949f907,0xf9d6f98d,0xfa6cfa20,0xfb0afabc,0xfbabfb5e,0xfc37fbf2,
-0xfcccfc82,0xfd55fd0d,0xfde6fd9d,0xfe7cfe33,0xff13fec8,0xffb6ff63,0x006c000f,0x011c00bf,
-0x01c70172,0x0273021d,0x031902cb,0x03b00366,0x043103f4,0x04a80465,0x050404d4,0x054d0524,
-0x057c0566,0x05a0058f,0x05b905b0,0x05b305b5,0x05b305b2,0x05a605af,0x05a405a2,0x057f0595,
-0x056d0571,0x05580566,0x054e0556,0x0544054a,0x05320537,0x0526052d,0x051f0525,0x0514051e,
-0x0501050b,0x04f304fc,0x04de04e6,0x04d304d3,0x04c504c9,0x04be04be,0x04c404be,0x04cb04c2,
-0x04ed04d2,0x051b04fe,0x0562053b,0x05bb058f,0x062605ec,0x0697065d,0x070b06d1,0x077f0746,
-0x07f907bb,0x086e0834,0x08e408af,0x095c0928,0x09d7099c,0x0a610a1d,0x0ae40a9f,0x0b770b2f,
-0x0c080bba,0x0c9b0c59,0x0d1d0ce0,0x0d980d61,0x0ddc0dc0,0x0dff0dfc,0x0e000e0e,0x0dc30de9,
-0x0d5b0d90,0x0cc40d0f,0x0c100c67,0x0b480ba9,0x0a6d0adc,0x09a40a08,0x08e10941,0x0840088d,
-0x07c40800,0x076b0792,0x072c0743,0x0704071a,0x06f006fe,0x06f506fd,0x06ee06f1,0x06e106e9,
-0x06c006d2,0x068606a1,0x06320660,0x05ae05ea,0x0511055e,0x044c04ae,0x037a03e6,0x02950306,
-0x01ab021b,0x00db013e,0x000d0072,0xff53ffb4,0xfec2ff0b,0xfe59fe8f,0xfe04fe2a,0xfdd6fde7,
-0xfdc7fdce,0xfdd4fdce,0xfdf9fde6,0xfe33fe19,0xfe80fe56,0xfed5fea3,0xff38ff02,0xffa8ff72,
-0x0017ffe0,0x0087004c,0x00f400c3,0x014a0121,0x01940178,0x01b901a9,0x01c701c9,0x01a301b3,
-0x015d0182,0x00e30120,0x00480099,0xff7dffe6,0xfea1ff15,0xfda2fe2a,0xfc97fd22,0xfb7dfc12,
-0xfa6ffaf6,0xf95cf9e8,0xf84bf8d0,0xf74af7cc,0xf65ef6d0,0xf58af5f8,0xf4b8f525,0xf407f463,
-0xf365f3b8,0xf2d3f31b,0xf265f29b,0xf206f22e,0xf1cdf1de,0xf19af1aa,0xf192f195,0xf19cf18d,
-0xf1c7f1b1,0xf20af1e7,0xf263f23d,0xf2ccf298,0xf34cf309,0xf3cff38d,0xf44ff40c,0xf4cbf48c,
-0xf53df506,0xf59af571,0xf5d7f5b5,0xf5f0f5ea,0xf5f7f5f6,0xf5d7f5e7,0xf59ff5c0,0xf55ff57c,
-0xf514f536,0xf4cdf4e7,0xf490f4aa,0xf44ef46c,0xf432f441,0xf433f433,0xf448f43c,0xf476f460,
-0xf4caf4a3,0xf533f503,0xf5a8f568,0xf630f5ec,0xf6baf672,0xf73ff6fe,0xf7c3f780,0xf846f80a,
-0xf8b2f881,0xf912f8e1,0xf95ef936,0xf992f980,0xf9b9f9a6,0xf9caf9cc,0xf9d8f9db,0xf9cef9d6,
-0xf9d6f9d1,0xf9caf9cd,0xf9c5f9c4,0xf9b8f9c0,0xf9b2f9b6,0xf9aff9b2,0xf9aef9ad,0xf9bef9b1,
-0xf9daf9c3,0xf9f1f9d9,0xfa1df9fd,0xfa5afa31,0xfaaffa81,0xfb1bfada,0xfbb8fb6c,0xfc64fc11,
-0xfd3bfcd7,0xfe32fdb2,0xff3afeb1,0x004cffbe,0x017600e4,0x02aa0212,0x03db0344,0x04f8046c,
-0x06100584,0x06fe0688,0x07df0771,0x089b083c,0x093c08ea,0x09b50980,0x0a1609f0,0x0a700a46,
-0x0aab0a8f,0x0adb0ac8,0x0aef0ae1,0x0af30af2,0x0ad80ae6,0x0aab0ac5,0x0a5d0a83,0x09ff0a32,
-0x098209c1,0x08ee0938,0x084b089f,0x079b07f0,0x06ec073f,0x0638068e,0x059605e4,0x04f6054a,
-0x046604b3,0x03e60428,0x038203b4,0x032c035b,0x02e20300,0x02c002cd,0x02b502b8,0x02c202b4,
-0x02f002d7,0x0339030a,0x03970366,0x040f03c7,0x0499044c,0x052a04dc,0x05c40575,0x065b060e,
-0x06ee06a9,0x0789073b,0x082307da,0x08bb0877,0x094f0906,0x09e0099a,0x0a6b0a22,0x0ae90aaa,
-0x0b560b1d,0x0ba90b84,0x0be40bcd,0x0c030bf7,0x0c070c04,0x0bf90bfc,0x0bd90be8,0x0bae0bcb,
-0x0b850b8e,0x0b520b65,0x0b170b2c,0x0af50b03,0x0ab80ad9,0x0a770a9c,0x0a270a4d,0x09c609f6,
-0x09370982,0x089908f1,0x07de0845,0x07180781,0x064a06b0,0x057f05e3,0x04ba051b,0x040d0462,
-0x037103bc,0x02ee032d,0x028402b4,0x022a0250,0x01cc01fe,0x017001a0,0x01140143,0x009b00d8,
-0x000b0058,0xff74ffc1,0xfecdff1f,0xfe17fe6b,0xfd6bfdbe,0xfccffd18,0xfc4ffc8a,0xfbf6fc1f,
-0xfbd9fbe2,0xfbe0fbd8,0xfc1afbf6,0xfc7ffc4a,0xfd16fcca,0xfdbcfd69,0xfe79fe1f,0xff24fece,
-0xffc7ff73,0x0052000d,0x00b30090,0x00fa00d6,0x01150106,0x0108010c,0x00da00f4,0x009c00c3,
-0x003e0071,0xffc90003,0xff40ff8b,0xfeabfefb,0xfdfafe55,0xfd39fda0,0xfc5cfcc5,0xfb67fbe6,
-0xfa7cfaf0,0xf978f9f9,0xf88ff903,0xf7b1f821,0xf6f5f74d,0xf671f6a9,0xf615f637,0xf5e2f5ec,
-0xf5def5d8,0xf60ff5ef,0xf667f638,0xf6c5f694,0xf750f70b,0xf7d3f78c,0xf869f816,0xf907f8b7,
-0xf9abf950,0xfa4df9f9,0xfafffa9f,0xfbabfb4c,0xfc6ffc12,0xfd3afcd6,0xfe01fda9,0xfec5fe70,
-0xff83ff2b,0x002dffdb,0x00cc0081,0x0140010c,0x01a30178,0x01e001c7,0x01fb01f6,0x02020205,
-0x01e301fd,0x01b301d1,0x016c0193,0x012d0149,0x00f2010e,0x00be00d2,0x00ac00b3,0x00a300a1,
-0x00b900a8,0x00df00cd,0x010400f0,0x0136011b,0x01570146,0x015a0161,0x013e0159,0x010d012e,
-0x00a500e2,0x00210069,0xff79ffcb,0xfeb4ff18,0xfddefe45,0xfceffd62,0xfc0cfc77,0xfb39fba3,
-0xfa7ffada,0xf9e1fa33,0xf970f9a2,0xf92df949,0xf91ef91b,0xf93cf929,0xf995f95f,0xfa0af9cd,
-0xfa9dfa53,0xfb61fafa,0xfc24fbbf,0xfceffc88,0xfdaffd50,0xfe5efe0d,0xfeebfeab,0xff61ff2a,
-0xffadff8e,0xffe2ffca,0xfffeffee,0x000c0003,0x00100009,0x00270015,0x004f0036,0x008d006a,
-0x00ec00b4,0x016a0128,0x01fa01b3,0x0294024c,0x032902e1,0x03ae0371,0x041403e8,0x043b0430,
-0x042e043c,0x03e1040b,0x0357039f,0x028802f4,0x018b0210,0x00740105,0xff3cffd4,0xfe01fe9d,
-0xfccdfd6c,0xfbb4fc43,0xfac1fb3a,0xf9f3fa55,0xf95bf9a0,0xf8e5f914,0xf898f8ad,0xf87af879,
-0xf878f874,0xf897f883,0xf8cdf8b2,0xf921f8fc,0xf97ef952,0xf9e6f9b0,0xfa49fa1a,0xfaaefa83,
-0xfaf9fad6,0xfb36fb1a,0xfb57fb4b,0xfb5ffb62,0xfb55fb63,0xfb39fb4c,0xfb0efb20,0xfaf3fafd,
-0xfaddfae5,0xfaedfad9,0xfb11faf6,0xfb4bfb27,0xfbacfb72,0xfc19fbe1,0xfc9bfc59,0xfd11fcdc,
-0xfd89fd51,0xfdf8fdc3,0xfe60fe2f,0xfebcfe8e,0xff16fef1,0xff66ff3e,0xffb0ff8e,0x0000ffd8,
-0x00470023,0x008d0061,0x00c100a7,0x00e100d1,0x00e800ec,0x00dd00e3,0x00a400c2,0x00450077,
-0xffd1000c,0xff3dff87,0xfe9dfef4,0xfe01fe54,0xfd75fdb8,0xfcfefd36,0xfca8fccd,0xfc6ffc85,
-0xfc63fc61,0xfc75fc66,0xfca3fc81,0xfceafcc6,0xfd3bfd17,0xfd92fd70,0xfdf5fdc8,0xfe58fe2b,
-0xfec1fe88,0xff2bfeee,0xffa5ff64,0x002fffe5,0x00d10079,0x01930128,0x026601f3,0x036302d9,
-0x046a03e4,0x058504f5,0x069e0613,0x07ca0738,0x08da0852,0x09e40962,0x0ad80a5d,0x0b980b3b,
-0x0c400bf5,0x0cb50c86,0x0d0b0cec,0x0d3d0d36,0x0d590d4e,0x0d610d5f,0x0d540d58,0x0d4a0d4d,
-0x0d3e0d4c,0x0d240d34,0x0d1d0d23,0x0d0e0d18,0x0cfd0cff,0x0cdd0cef,0x0cba0ccd,0x0c860ca3,
-0x0c360c5d,0x0bd80c0b,0x0b6f0ba9,0x0aef0b30,0x0a710aae,0x09ef0a2c,0x097209b0,0x0906093d,
-0x08af08de,0x0875088f,0x08540857,0x0855084d,0x086c0858,0x089f0881,0x08e408c0,0x093d0910,
-0x099d096f,0x09f209c8,0x0a460a1e,0x0a780a5e,0x0a8f0a8b,0x0a7d0a8f,0x0a4a0a67,0x09ec0a22,
-0x097109b1,0x08cb0922,0x0813086c,0x075007ae,0x068206e8,0x05b5061e,0x0505055d,0x046c04bc,
-0x03e90423,0x038203b9,0x03300353,0x02e20308,0x029502b9,0x02410269,0x01d30209,0x01600198,
-0x00d50114,0x003e008a,0xffacfff8,0xff21ff66,0xfea9fee2,0xfe39fe70,0xfde0fe0e,0xfd90fdb8,
-0xfd54fd72,0xfd0ffd35,0xfcb6fce1,0xfc4dfc88,0xfbbefc0b,0xfb03fb61,0xfa1dfa95,0xf91af99e,
-0xf7fff88e,0xf6dbf76a,0xf5a8f646,0xf49af512,0xf3aff418,0xf2edf33a,0xf261f296,0xf217f232,
-0xf207f207,0xf234f21d,0xf289f25c,0xf2fef2c6,0xf37af33c,0xf409f3c2,0xf493f44d,0xf50bf4d0,
-0xf581f54e,0xf5eaf5ba,0xf65df629,0xf6ccf698,0xf743f6fd,0xf7c3f77a,0xf84ef802,0xf8dcf891,
-0xf97df929,0xfa16f9ca,0xfa9dfa5f,0xfb24faee,0xfb91fb60,0xfbddfbbf,0xfc0cfbf7,0xfc0dfc0e,
-0xfbf9fc07,0xfbb4fbd7,0xfb58fb88,0xfae5fb26,0xfa4ffaa1,0xf9b1fa04,0xf906f961,0xf853f8aa,
-0xf7a0f7ea,0xf6f1f744,0xf64df691,0xf5c7f601,0xf547f57a,0xf4e1f50a,0xf49ef4b8,0xf461f47a,
-0xf43ff44f,0xf435f43b,0xf43ff436,0xf45df448,0xf483f46c,0xf4cbf4a5,0xf519f4ea,0xf57ef547,
-0xf5f2f5b8,0xf66ff62c,0xf6fef6bb,0xf77ff744,0xf805f7cc,0xf881f848,0xf8f8f8ba,0xf95ff92e,
-0xf997f979,0xf9c4f9ac,0xf9dcf9cb,0xf9e3f9de,0xf9e6f9e0,0xf9e0f9dc,0xf9e5f9dd,0xfa04f9ee,
-0xfa39fa1d,0xfa7ffa5c,0xfae6fab1,0xfb66fb21,0xfc08fbb6,0xfca9fc58,0xfd57fd02,0xfdfefdad,
-0xfe9ffe51,0xff36feec,0xffbaff72,0x0031fff6,0x00a6006b,0x011100de,0x0188014d,0x01f601c1,
-0x0268022c,0x02ec02a9,0x036b032f,0x03ee03b0,0x04730434,0x04e504a5,0x054b0517,0x059a0570,
-0x05df05b9,0x061a05fa,0x064e0634,0x06870666,0x06cb06aa,0x071e06f5,0x078c0752,0x080407c9,
-0x08900851,0x092808e0,0x09c60976,0x0a670a1c,0x0b040abc,0x0b930b53,0x0c220be3,0x0ca10c68,
-0x0d170cdd,0x0d880d51,0x0dfa0dc7,0x0e640e38,0x0ecf0e9b,0x0f200efa,0x0f550f3b,0x0f690f67,
-0x0f560f65,0x0f210f44,0x0eb00ee9,0x0e120e63,0x0d4f0db5,0x0c680cdd,0x0b5f0be4,0x0a480ad7,
-0x092209b7,0x07f00886,0x06ad0752,0x0577061a,0x044404ed,0x031703bb,0x01fb0293,0x00f3017b,
-0xfffd007c,0xff2eff90,0xfe77fecb,0xfdf1fe27,0xfdacfdc6,0xfd9efda3,0xfdc8fdad,0xfe2dfdf4,
-0xfec6fe6e,0xff88ff25,0x006afff8,0x016100e9,0x025201d4,0x033d02cf,0x040e03a2,0x04c50465,
-0x05510505,0x05b8057b,0x060105da,0x06350619,0x0653064a,0x066c0661,0x0682067a,0x06950694,
-0x06920698,0x06940697,0x06790687,0x0657066d,0x060a0632,0x05a605d6,0x05140567,0x046b04c0,
-0x039e040a,0x02ca0335,0x01f8025d,0x01350192,0x009200d5,0x00050047,0xffb7ffde,0xff8effa3,
-0xff93ff91,0xffb2ffac,0xffddffc8,0x001bffff,0x0061003d,0x00830071,0x0091008b,0x00930093,
-0x00820091,0x005c0072,0x002a0045,0xffeb000e,0xff9dffc9,0xff50ff72,0xfee6ff1f,0xfe76feb2,
-0xfdf6fe34,0xfd5efdab,0xfcb3fd09,0xfbf0fc53,0xfb1afb81,0xfa36faa9,0xf947f9c6,0xf869f8e0,
-0xf79af808,0xf6e7f73d,0xf65ff69f,0xf610f62f,0xf5f4f5f7,0xf607f5f5,0xf65ef634,0xf6d6f69a,
-0xf774f727,0xf829f7ce,0xf8ebf888,0xf99af93d,0xfa4cf9ee,0xfaecfa98,0xfb70fb2c,0xfbd9fba5,
-0xfc42fc14,0xfc8dfc6d,0xfcc0fcb1,0xfce6fcd9,0xfcfafcef,0xfd01fd00,0xfcf6fcf9,0xfcdbfcef,
-0xfcb3fcd7,0xfc82fc9d,0xfc55fc6d,0xfc1efc3c,0xfbf3fc0b,0xfbcffbde,0xfbb6fbc1,0xfbb6fbaf,
-0xfbc0fbb1,0xfbeafbcf,0xfc20fbff,0xfc71fc46,0xfce1fca6,0xfd67fd22,0xfe04fdb5,0xfec3fe65,
-0xff95ff2b,0x00810001,0x016a00ee,0x026101df,0x034c02d7,0x042603ba,0x04dd0483,0x0579052e,
-0x05f005ba,0x0639061c,0x065a0654,0x065e065f,0x063b064a,0x05e80615,0x058805b7,0x05110552,
-0x049a04db,0x040c0456,0x038b03d2,0x02fe0344,0x027802b7,0x01f90238,0x018601be,0x01260155,
-0x00cb00f7,0x008400a9,0x004d0067,0x00190030,0xffeb0002,0xffb9ffd4,0xff87ffa6,0xff4fff6f,
-0xff10ff30,0xfec7fee8,0xfe82fea6,0xfe2efe57,0xfde4fe0c,0xfd8efdb4,0xfd48fd68,0xfd04fd27,
-0xfccafce6,0xfc9efcb2,0xfc85fc94,0xfc71fc6f,0xfc80fc6f,0xfc93fc8b,0xfcbcfca3,0xfcfdfcda,
-0xfd48fd22,0xfd96fd73,0xfde0fdbd,0xfe2afe0b,0xfe5ffe4c,0xfe70fe71,0xfe69fe71,0xfe3bfe56,
-0xfde1fe15,0xfd67fda9,0xfcd9fd1f,0xfc44fc89,0xfbaefbf3,0xfb19fb5d,0xfaacfadc,0xfa6ffa8a,
-0xfa5dfa5e,0xfa7bfa66,0xfab4fa8a,0xfb13fadd,0xfb7bfb47,0xfbf1fbb6,0xfc57fc27,0xfca3fc84,
-0xfccbfcba,0xfcc1fcc3,0xfc96fcae,0xfc51fc73,0xfbebfc20,0xfb76fbb0,0xfaecfb32,0xfa67faac,
-0xf9f4fa2b,0xf992f9c0,0xf943f96d,0xf911f92c,0xf8fcf907,0xf900f8ff,0xf916f907,0xf941f92a,
-0xf97ef958,0xf9caf9a2,0xfa1bf9ee,0xfa78fa47,0xfad9faa2,0xfb31fb06,0xfb9afb60,0xfc03fbcc,
-0xfc67fc34,0xfcc7fc96,0xfd2afd00,0xfd89fd5c,0xfdf0fdbb,0xfe58fe20,0xfeb7fe8c,0xff1ffee7,
-0xff94ff5d,0x0000ffc9,0x007b0040,0x00f400b4,0x01590127,0x01bb0193,0x021001ee,0x0256023a,
-0x02930276,0x02b802a5,0x02cd02bb,0x02d402cd,0x02d802d2,0x02d502d3,0x02ec02e4,0x02fb02f8,
-0x03290315,0x035f033e,0x03a90383,0x03f903d0,0x045a0429,0x04b90487,0x051c04ea,0x057b0551,
-0x05d305a6,0x062a05fc,0x06640647,0x06980680,0x06b006a8,0x06b706b3,0x06b306b4,0x069d06a4,
-0x06900698,0x06840692,0x06750677,0x067d067b,0x068b0680,0x06a50693,0x06ca06b6,0x06f406e4,
-0x072b0713,0x075d0742,0x07800773,0x07af079a,0x07da07c6,0x080807ec,0x08350817,0x0881084e,
-0x08d5089f,0x093e0902,0x09a60970,0x0a2509f0,0x0a9b0a62,0x0b050ad2,0x0b570b30,0x0b910b78,
-0x0bb20ba1,0x0bbc0bba,0x0bad0bb6,0x0b7f0b98,0x0b3b0b60,0x0adf0b0a,0x0a8d0ab7,0x0a200a52,
-0x09b409ec,0x0943097a,0x08cc0910,0x08520896,0x07e30822,0x076807a9,0x06fa072c,0x068206be,
-0x0613064e,0x05ad05e4,0x0549057c,0x04e20512,0x048b04b9,0x04460464,0x0405042c,0x03e903f5,
-0x03e303e2,0x03ff03f1,0x0442041e,0x04a2046c,0x051704d2,0x059f055b,0x062a05e9,0x06ac066a,
-0x071706e8,0x07550738,0x07690763,0x073e0756,0x06db0710,0x06420692,0x058305e4,0x049c0515,
-0x03ad041e,0x02a9032e,0x01a20226,0x00a60127,0xffb5002f,0xfec6ff38,0xfde9fe58,0xfd09fd7b,
-0xfc2cfc99,0xfb45fbb3,0xfa4cfacb,0xf94cf9d3,0xf83cf8ca,0xf725f7b1,0xf60bf693,0xf4f6f57a,
-0xf3f1f46b,0xf302f378,0xf23ef29f,0xf1a9f1f1,0xf14af176,0xf11af132,0xf115f116,0xf136f11c,
-0xf16ef14e,0xf1b8f18c,0xf202f1dd,0xf23bf220,0xf271f25c,0xf289f284,0xf292f292,0xf284f28c,
-0xf27af27e,0xf26af273,0xf262f25c,0xf264f261,0xf283f27b,0xf2baf29b,0xf30af2d7,0xf369f331,
-0xf3c8f39a,0xf428f3f0,0xf482f454,0xf4d1f4ad,0xf516f4f8,0xf545f536,0xf578f563,0xf595f582,
-0xf5c6f5ad,0xf5fcf5de,0xf642f620,0xf69ff66b,0xf71bf6de,0xf7a3f758,0xf837f7ed,0xf8d7f880,
-0xf977f926,0xfa06f9be,0xfa88fa53,0xfaf2fac4,0xfb4bfb23,0xfb83fb68,0xfba2fb95,0xfbaafba6,
-0xfba7fbac,0xfba3fba9,0xfb8cfb93,0xfb7efb85,0xfb69fb79,0xfb54fb5f,0xfb47fb4d,0xfb3dfb43,
-0xfb3bfb35,0xfb3bfb2f,0xfb41fb35,0xfb49fb43,0xfb5bfb56,0xfb74fb6a,0xfb8cfb81,0xfbb4fba4,
-0xfbd6fbca,0xfc0efbf4,0xfc4afc33,0xfc94fc71,0xfcf2fcc1,0xfd58fd21,0xfdd3fd91,0xfe66fe14,
-0xff0dfebb,0xffb6ff63,0x0078001b,0x013300d7,0x01e1018f,0x027c0231,0x030002c1,0x03640338,
-0x03b10392,0x03e303cd,0x03f703f5,0x040803ff,0x041d0410,0x04440426,0x046e0453,0x04b70487,
-0x051c04e1,0x05a0055c,0x063105eb,0x06ce0681,0x074d0713,0x07c0078c,0x081207f0,0x08370824,
-0x082d0832,0x07f40813,0x07a507d3,0x07440777,0x06d80709,0x067d06a9,0x06350654,0x0610061d,
-0x0614060d,0x064b062d,0x06ad0671,0x073706eb,0x07dd078a,0x088d0839,0x094108ef,0x09fc09a9,
-0x0a9d0a4e,0x0b380ae9,0x0ba90b71,0x0c0d0bd8,0x0c480c29,0x0c750c64,0x0c940c85,0x0c960c93,
-0x0c9f0ca3,0x0c920c9b,0x0c840c8c,0x0c6f0c76,0x0c5f0c67,0x0c450c57,0x0c390c3a,0x0c200c29,
-0x0c030c0e,0x0be10bf7,0x0bbc0bd2,0x0b890ba5,0x0b3e0b6c,0x0adb0b16,0x0a5c0aa0,0x09c30a16,
-0x0908096d,0x083008a1,0x072607ad,0x05ff0697,0x04c8056c,0x0382042b,0x023502dc,0x00e90196,
-0xffb0004c,0xfe8fff1f,0xfd7afdfc,0xfc99fd01,0xfbbefc22,0xfb0dfb5e,0xfa6ffab7,0xf9e7fa27,
-0xf976f9b2,0xf91cf94e,0xf8d5f8f7,0xf8a1f8b7,0xf876f884,0xf865f86a,0xf867f866,0xf875f86c,
-0xf8a1f888,0xf8d8f8b2,0xf928f8ff,0xf98bf95b,0xf9fcf9be,0xfa7cfa39,0xfb0afac1,0xfba3fb59,
-0xfc44fbf0,0xfcf0fc98,0xfdb0fd50,0xfe70fe17,0xff47fedc,0x0018ffb4,0x00f2007c,0x01be0152,
-0x02770217,0x031402c8,0x03960360,0x03ef03d0,0x0415040f,0x0419041a,0x03f20408,0x03a203cd,
-0x033b036e,0x02b802fb,0x0231027b,0x019e01e8,0x010e015b,0x007200c0,0xffe2002f,0xff54ff9c,
-0xfec4ff0a,0xfe35fe78,0xfda6fde8,0xfd1cfd5a,0xfc9efcdd,0xfc1dfc60,0xfbb8fbea,0xfb61fb85,
-0xfb1efb3a,0xfaf5fb08,0xfae4fae0,0xfaecfadf,0xfb0cfaf3,0xfb38fb20,0xfb64fb50,0xfba1fb87,
-0xfbd4fbb9,0xfbfafbe5,0xfbfefbff,0xfbe9fbfa,0xfbc6fbde,0xfb87fbae,0xfb40fb68,0xfadcfb08,
-0xfa81faaf,0xfa2efa57,0xf9f2fa0d,0xf9ccf9d9,0xf9c8f9c2,0xf9e4f9cb,0xfa2bfa04,0xfa8cfa51,
-0xfb17fad3,0xfbabfb56,0xfc53fc00,0xfd06fcac,0xfdbefd60,0xfe6efe18,0xff29feca,0xffd2ff7f,
-0x00820027,0x011f00d2,0x01aa0167,0x023501f2,0x02ae0273,0x030c02e2,0x035a0337,0x03880374,
-0x03a00397,0x038c039b,0x03620380,0x03210342,0x02c002f0,0x02500288,0x01dc0216,0x0165019e,
-0x01040132,0x00ad00d4,0x00600085,0x00320046,0x0020002a,0x00320023,0x00540042,0x0088006a,
-0x00cd00aa,0x012900fb,0x0173014e,0x01c9019a,0x021b01f1,0x02640241,0x029a0283,0x02c602b6,
-0x02ec02da,0x030702fd,0x0313030d,0x03170311,0x030e030d,0x02f802fe,0x02d902eb,0x02ba02c6,
-0x028402a1,0x0246025c,0x01fd0224,0x01ac01d6,0x01530188,0x00f10126,0x008400c4,0x00060047,
-0xff83ffc3,0xfef9ff3d,0xfe63feae,0xfdbafe0e,0xfd17fd65,0xfc69fcbf,0xfbb5fc0d,0xfb04fb5b,
-0xfa68fab6,0xf9d1fa18,0xf956f994,0xf8fff924,0xf8c6f8e1,0xf8aef8b9,0xf8bef8b1,0xf8f0f8ce,
-0xf93df911,0xf99ff96d,0xfa1df9d7,0xfaa9fa61,0xfb34faef,0xfbbefb7a,0xfc37fbf3,0xfc99fc6d,
-0xfce8fcca,0xfd15fd04,0xfd1ffd26,0xfd05fd1b,0xfcc9fcf4,0xfc6cfc9c,0xfbf7fc35,0xfb76fbc1,
-0xfafbfb3f,0xfa84fab8,0xfa17fa46,0xf9c5f9e8,0xf998f9a6,0xf998f992,0xf9c6f9a6,0xfa15f9e9,
-0xfa91fa4f,0xfb1dfad2,0xfbb8fb69,0xfc5dfc11,0xfcfcfcb3,0xfd8afd46,0xfdf1fdc5,0xfe4cfe22,
-0xfe89fe70,0xfeadfe90,0xfeb0feb2,0xfea0feae,0xfe9bfea1,0xfe8afe92,0xfe75fe81,0xfe6dfe68,
-0xfe66fe65,0xfe6bfe6e,0xfe6dfe71,0xfe7bfe79,0xfe88fe8d,0xfe97fe90,0xfe9efe9e,0xfe93fe98,
-0xfe8dfe8a,0xfe71fe7b,0xfe54fe5d,0xfe37fe44,0xfe27fe2e,0xfe22fe29,0xfe2bfe22,0xfe3dfe32,
-0xfe64fe4c,0xfea6fe8a,0xff0cfed2,0xff90ff4b,0x0029ffd4,0x00e30085,0x01af0145,0x02910216,
-0x037d0305,0x045903eb,0x053704c5,0x05ef0596,0x06960647,0x070d06d8,0x07540733,0x07800769,
-0x077e078b,0x075a0775,0x0729074a,0x06ef0716,0x06b606d3,0x06760691,0x06570662,0x063d0645,
-0x063e063b,0x06510645,0x06840666,0x06bc069a,0x070c06d8,0x0767072d,0x07c00790,0x082c07f6,
-0x08900861,0x08f308bd,0x09520928,0x09aa097d,0x09ef09ce,0x0a370a1e,0x0a6d0a5a,0x0aa40a8c,
-0x0ade0abb,0x0b0c0af7,0x0b3c0b20,0x0b7f0b5e,0x0bc10b99,0x0bf20bdc,0x0c3b0c1d,0x0c760c5a,
-0x0ca90c90,0x0cd10cc0,0x0ced0ce1,0x0cf60cf8,0x0cf30cf9,0x0cda0ce9,0x0cba0cce,0x0c8e0ca1,
-0x0c5a0c77,0x0c190c3d,0x0bd30bf4,0x0b7d0bab,0x0b140b4b,0x0a9a0ada,0x0a0e0a52,0x096609bd,
-0x08aa0907,0x07d8083f,0x06ef0761,0x05fd0676,0x04fb057a,0x04030476,0x0315038e,0x0229029d,
-0x015d01c0,0x00b30106,0x00240062,0xffafffe1,0xff4fff7a,0xff10ff29,0xfeddfef9,0xfea2fec3,
-0xfe69fe87,0xfe36fe50,0xfde8fe10,0xfd89fdba,0xfd19fd5d,0xfca2fce0,0xfc26fc63,0xfb9efbe1,
-0xfb1bfb59,0xfaa9fae3,0xfa48fa77,0xf9fafa1e,0xf9d0f9e0,0xf9aff9b3,0xf99cf9a3,0xf99cf99b,
-0xf9a4f9a6,0xf9a0f9a9,0xf997f9a2,0xf97ff985,0xf94cf963,0xf903f924,0xf8a2f8d7,0xf827f868,
-0xf793f7e0,0xf6f3f748,0xf647f6a2,0xf591f5f1,0xf4dff538,0xf433f48e,0xf392f3e1,0xf304f34a,
-0xf27ef2c0,0xf215f24e,0xf1c4f1e4,0xf17ef196,0xf152f162,0xf134f144,0xf12af12f,0xf11df122,
-0xf11cf120,0xf121f121,0xf12df128,0xf136f131,0xf143f13b,0xf15cf148,0xf17af168,0xf1a4f18f,
-0xf1e7f1bd,0xf233f20a,0xf28bf25e,0xf2f3f2c6,0xf364f332,0xf3d3f3a6,0xf43ff412,0xf4aaf480,
-0xf50cf4e8,0xf55af532,0xf5b2f584,0xf5edf5cd,0xf627f603,0xf666f642,0xf6a7f685,0xf6e2f6c4,
-0xf726f706,0xf785f758,0xf7f0f7be,0xf86df82e,0xf8fcf8b2,0xf9a4f94a,0xfa5ef9f4,0xfb2afac3,
-0xfc0afb96,0xfcf2fc7f,0xfdd7fd68,0xfec7fe53,0xff9fff38,0x00720005,0x012800cb,0x01c3017a,
-0x024c0208,0x02b7028c,0x032602eb,0x0373034f,0x03ba039b,0x040303e2,0x043b041e,0x0479045c,
-0x04a30489,0x04bd04b3,0x04c204c4,0x04b104b8,0x04750497,0x04310458,0x03cc0403,0x035b0396,
-0x02e70321,0x028502b5,0x02450265,0x021f0230,0x02240221,0x0268024f,0x02d00292,0x03630316,
-0x041803b5,0x04f00480,0x05cf0561,0x06c40648,0x07af0738,0x0894081a,0x09640900,0x0a2409c9,
-0x0ac70a76,0x0b4b0b14,0x0baf0b7d,0x0bf50bd9,0x0c130c14,0x0c160c1c,0x0bf40c06,0x0bab0bcf,
-0x0b480b7a,0x0ace0b0c,0x0a3f0a8d,0x09a209f2,0x09070952,0x086108bc,0x07d90819,0x07590794,
-0x06ea0718,0x069906be,0x0664067d,0x06460654,0x062f063b,0x062c0633,0x06340631,0x0630062b,
-0x063d062e,0x06440641,0x0639063c,0x0635063b,0x06290631,0x0634062d,0x06380635,0x06460641,
-0x066c0652,0x068f0679,0x06b90699,0x06e106ca,0x070106ee,0x070c0706,0x070d070e,0x06f00709,
-0x06c106e1,0x0671069e,0x060f0643,0x059905da,0x0524055a,0x04ac04e8,0x04370473,0x03d70407,
-0x037c03a9,0x0341035a,0x030b0321,0x02e202ef,0x02be02ce,0x029502af,0x02670285,0x022c024f,
-0x01d80206,0x017301aa,0x00f20138,0x005c00ae,0xffaa0005,0xfee8ff4b,0xfe19fe82,0xfd3efda7,
-0xfc66fccd,0xfb93fbf6,0xfad6fb3a,0xfa18fa77,0xf97cf9c5,0xf8f5f92e,0xf889f8c2,0xf840f85f,
-0xf811f827,0xf7f8f803,0xf806f7fe,0xf827f817,0xf85ff840,0xf8aff887,0xf90cf8de,0xf97af93f,
-0xf9ecf9b3,0xfa58fa25,0xfac7fa8e,0xfb21faf0,0xfb74fb54,0xfbbdfb9c,0xfbf7fbdd,0xfc22fc10,
-0xfc4cfc34,0xfc63fc53,0xfc7dfc6b,0xfc95fc89,0xfcbafca7,0xfce1fcd4,0xfd1cfd01,0xfd61fd3c,
-0xfdb9fd91,0xfe1cfded,0xfe8ffe56,0xff06fece,0xff89ff4f,0x0009ffca,0x00850049,0x010000c1,
-0x015b0136,0x01a60189,0x01db01c3,0x020001f5,0x02000201,0x01ec01f2,0x01bc01d3,0x018801a4,
-0x014d016a,0x0103011f,0x00bf00dc,0x007b008f,0x0033004d,0xffeb0004,0xffacffc7,0xff5dff85,
-0xff13ff35,0xfeccfeeb,0xfe7bfe9f,0xfe2dfe58,0xfdd9fe00,0xfd9bfdbb,0xfd62fd7b,0xfd33fd4d,
-0xfd13fd22,0xfd11fd14,0xfd16fd0c,0xfd34fd23,0xfd68fd4d,0xfdb2fd8b,0xfe01fdd5,0xfe5ffe2f,
-0xfeb5fe88,0xff17fee7,0xff65ff40,0xff98ff82,0xffc4ffad,0xffc9ffc9,0xffbdffc8,0xff90ffab,
-0xff58ff71,0xff17ff38,0xfed2fef2,0xfe93fead,0xfe5afe78,0xfe30fe45,0xfe20fe27,0xfe13fe19,
-0xfe19fe18,0xfe34fe27,0xfe5efe47,0xfe88fe6f,0xfeb1fe95,0xfedafec6,0xff04feef,0xff2cff19,
-0xff53ff3c,0xff7bff68,0xffa0ff8c,0xffc5ffb5,0xffe3ffd7,0x0001fff4,0x001a000b,0x0043002e,
-0x0057004e,0x00870074,0x00c300a6,0x011100e8,0x0182013e,0x01fc01b5,0x0286023d,0x032402d8,
-0x03ce0375,0x04760427,0x051204c7,0x058a055b,0x05f105c6,0x062f0610,0x06510644,0x063d064c,
-0x0612062b,0x05cc05fe,0x056d059f,0x050d0540,0x04aa04db,0x0446047b,0x03f0041a,0x03a903cb,
-0x03660387,0x0335034e,0x0304031c,0x02da02ec,0x029202b3,0x023d026d,0x01c20204,0x01250176,
-0x005300c3,0xff62ffdc,0xfe4dfedb,0xfd10fdb5,0xfbccfc70,0xfa88fb27,0xf94ff9e9,0xf822f8aa,
-0xf715f797,0xf631f6a4,0xf571f5d2,0xf4dff524,0xf47bf4ab,0xf441f459,0xf433f435,0xf444f438,
-0xf476f45a,0xf4b2f490,0xf509f4d6,0xf55df52f,0xf5b7f58a,0xf609f5ea,0xf657f631,0xf69ff67e,
-0xf6ddf6bf,0xf711f6f3,0xf742f727,0xf764f751,0xf78ff77c,0xf7bcf7a3,0xf7e0f7d3,0xf817f7fd,
-0xf850f839,0xf89cf875,0xf8ebf8c4,0xf951f91e,0xf9c4f985,0xfa57fa08,0xfafefa9e,0xfbc0fb5c,
-0xfc9efc28,0xfd8dfd17,0xfe8cfe0e,0xff8eff12,0x009d0019,0x018e011a,0x02660202,0x031402bf,
-0x03950361,0x03e703c0,0x040803fd,0x04000409,0x03d203f6,0x038303b2,0x031f0353,0x02bb02ea,
-0x024c0283,0x01e70218,0x018b01b6,0x01410166,0x01060124,0x00e800f3,0x00d500d6,0x00d800d5,
-0x00f000e4,0x011b0105,0x015b013d,0x01ab017d,0x021f01e1,0x02a00257,0x033002e4,0x03da0385,
-0x049f043d,0x05690504,0x063b05cf,0x071406a6,0x07db0779,0x08a10842,0x094b08f7,0x09dd0996,
-0x0a410a12,0x0a810a67,0x0a9f0a95,0x0a8e0a96,0x0a780a86,0x0a4c0a68,0x0a170a39,0x09d609fd,
-0x09a509b9,0x096b0988,0x0937094b,0x090f091b,0x08e808f1,0x08cf08da,0x08bb08be,0x08a908b3,
-0x089e08a9,0x089c089d,0x08930894,0x089b0893,0x08a508a1,0x08c108c0,0x08db08ce,0x08fa08f1,
-0x0918090d,0x0943092b,0x09580947,0x096a0961,0x096d0962,0x09610960,0x093f0950,0x09110926,
-0x08d108ed,0x089708b4,0x084e0876,0x08080827,0x07c307df,0x0780079b,0x07540761,0x07240733,
-0x070b0710,0x06fc0702,0x070a06ff,0x07120714,0x07320723,0x0750073e,0x07740761,0x07860786,
-0x0788078b,0x07730781,0x0746075d,0x06f70721,0x068806c0,0x0608064e,0x057105c5,0x04cd0526,
-0x041f0476,0x036d03c8,0x02b9031b,0x020c0261,0x015401b4,0x009900fa,0xffd5003b,0xff0aff73,
-0xfe3afea3,0xfd63fdcd,0xfc8dfcfc,0xfbb0fc21,0xfacefb3f,0xf9fbfa62,0xf91ff98d,0xf847f8ae,
-0xf775f7db,0xf6aef70d,0xf5e5f644,0xf51df57f,0xf464f4be,0xf3acf400,0xf305f34e,0xf259f2aa,
-0xf1d9f221,0xf16ef1a4,0xf12ff14f,0xf10bf11f,0xf102f105,0xf118f10d,0xf149f129,0xf18cf16c,
-0xf1e1f1b0,0xf246f219,0xf2a7f273,0xf310f2da,0xf373f342,0xf3c7f39d,0xf424f3f2,0xf460f439,
-0xf4a8f484,0xf4e3f4c4,0xf51af4fb,0xf53cf52b,0xf558f54f,0xf567f566,0xf578f56e,0xf577f576,
-0xf55ef569,0xf53ff54d,0xf517f528,0xf4e7f4fd,0xf4baf4d2,0xf491f4ad,0xf479f483,0xf470f477,
-0xf474f46f,0xf496f485,0xf4c1f4a8,0xf508f4e1,0xf554f52c,0xf5acf57e,0xf5fff5cc,0xf659f628,
-0xf6aff67d,0xf708f6db,0xf75ef737,0xf7c0f792,0xf81ff7ef,0xf886f84d,0xf8f1f8b6,0xf96cf92b,
-0xf9f1f9af,0xfa84fa35,0xfb1bfacb,0xfbc3fb68,0xfc70fc19,0xfd2afcd1,0xfde8fd90,0xfea2fe48,
-0xff60ff03,0x0017ffbd,0x00b30062,0x01480103,0x01c6018c,0x023a0201,0x02900266,0x02db02b2,
-0x032102fe,0x03610340,0x03a40380,0x03f103c6,0x0441041a,0x04a40471,0x050f04d8,0x057e0547,
-0x05f105b5,0x06610625,0x06cf0698,0x072f0702,0x079d076e,0x07f407c5,0x0841081d,0x08870861,
-0x08d208ae,0x091108f4,0x09470931,0x09750964,0x09a50994,0x09c109b2,0x09d109c8,0x09cf09cd,
-0x09b909c7,0x099f09ac,0x096b0983,0x0932094a,0x08f00910,0x089d08c5,0x08500878,0x080b0832,
-0x07d307f5,0x07ae07c3,0x079307a2,0x07850787,0x0779077c,0x07830776,0x078b0780,0x07930790,
-0x079c0796,0x07a107a1,0x07a3079d,0x079b079f,0x078f0799,0x0790078e,0x078d078a,0x0794078d,
-0x07a1079a,0x07cb07bb,0x07f607e7,0x08270811,0x086d084e,0x08a00884,0x08d208b9,0x08e408db,
-0x08d508e1,0x08a708bd,0x08530885,0x07d60816,0x073f078e,0x068806e3,0x05c10627,0x04f9055b,
-0x04360496,0x037703cd,0x02c70317,0x022d0276,0x01a101e6,0x01310167,0x00d000ff,0x006d009d,
-0x001d0040,0xffd5fff6,0xff79ffaa,0xff37ff5d,0xfef1ff19,0xfebffedb,0xfe9bfeaa,0xfe8bfe8d,
-0xfe93fe85,0xfeb0fe96,0xfeeefecd,0xff3dff14,0xffafff74,0x0018ffe0,0x00810048,0x00d700aa,
-0x010f00f9,0x01290120,0x011c0129,0x00e300ff,0x007900b4,0xffef0039,0xff49ffa3,0xfe99fef7,
-0xfde2fe39,0xfd2bfd83,0xfc95fcdd,0xfc0cfc4d,0xfba4fbd7,0xfb4afb76,0xfb16fb2b,0xfaf6fb05,
-0xfad8fae2,0xfabdfaca,0xfaa6fab2,0xfa7afa8e,0xfa48fa66,0xfa07fa25,0xf9bef9df,0xf95ff98f,
-0xf8f9f92b,0xf897f8c8,0xf83af868,0xf7e7f80d,0xf79bf7c1,0xf75ff77d,0xf734f746,0xf719f723,
-0xf70ff70d,0xf713f70c,0xf71ef719,0xf748f732,0xf772f75e,0xf7baf795,0xf801f7e0,0xf868f834,
-0xf8c8f8a3,0xf93af903,0xf9c0f984,0xfa3ef9fc,0xfac0fa82,0xfb54fb0d,0xfbeffba2,0xfc95fc40,
-0xfd48fceb,0xfdfffda1,0xfec1fe63,0xff91ff2d,0x006bfffb,0x014000d6,0x021301aa,0x02d60277,
-0x03990339,0x043c03ea,0x04d00485,0x0538050a,0x05960567,0x05bd05b0,0x05d805ce,0x05d405d7,
-0x05bf05c7,0x0580059b,0x053c055a,0x04ea0517,0x048d04bb,0x0425045d,0x03c403ef,0x035f0390,
-0x030c0338,0x02b802e3,0x027d0292,0x02430266,0x021b022e,0x01ff020a,0x01f201fc,0x01fc01fc,
-0x02130203,0x022f021e,0x02530237,0x02830266,0x02b50297,0x02ea02c6,0x030f02fa,0x032a0318,
-0x034a0340,0x03560351,0x034e0357,0x03460350,0x032f0343,0x03110328,0x02eb0307,0x02c802d8,
-0x028c02ab,0x024c026b,0x02010227,0x01b301d9,0x01410179,0x00c90105,0x00400084,0xffb8fff7,
-0xff1aff6d,0xfe87fecf,0xfe03fe3f,0xfd81fdb6,0xfd20fd4b,0xfcc8fcef,0xfc8cfcaa,0xfc6afc76,
-0xfc4ffc53,0xfc3ffc41,0xfc35fc33,0xfc36fc30,0xfc33fc2a,0xfc21fc27,0xfc0efc1a,0xfc02fc0d,
-0xfbe5fbf6,0xfbc9fbd2,0xfba7fbb4,0xfb91fba2,0xfb76fb89,0xfb7bfb82,0xfb8bfb8a,0xfbaffba6,
-0xfbeefbd3,0xfc43fc22,0xfcb5fc7b,0xfd30fcf3,0xfdbdfd72,0xfe4ffe06,0xfef0fe99,0xff7fff37,
-0x0005ffc2,0x007d0044,0x00e500bc,0x01410115,0x01810167,0x01ac0197,0x01d501c2,0x01ec01de,
-0x020401f6,0x02250211,0x023e0233,0x0261024e,0x02880273,0x02b2029f,0x02d802c7,0x02e302e3,
-0x02ea02e7,0x02d002dc,0x029302b8,0x023f0272,0x01c1020b,0x0123017c,0x006900c6,0xff960002,
-0xfea2ff17,0xfd98fe20,0xfc87fd0b,0xfb75fbfd,0xfa58faea,0xf945f9da,0xf83af8bd,0xf735f7b5,
-0xf649f6b8,0xf560f5d2,0xf49af4f8,0xf3f3f443,0xf36df3a4,0xf303f32b,0xf2c2f2e3,0xf29ef2ab,
-0xf2a7f29f,0xf2cef2b9,0xf31af2ee,0xf37ff346,0xf402f3bc,0xf4a0f44c,0xf550f4e9,0xf60cf5ab,
-0xf6daf674,0xf7baf746,0xf8a3f82a,0xf98ef91b,0xfa7efa08,0xfb72fafb,0xfc6dfbf2,0xfd60fcf2,
-0xfe4dfdde,0xff38fecb,0x0017ffa5,0x00e70081,0x01b8014d,0x026f020e,0x032302ca,0x03d20381,
-0x04870436,0x053604e4,0x05dd0592,0x06990641,0x075c06fa,0x081307bc,0x08cd0871,0x09810925,
-0x0a2c09cf,0x0ab30a6b,0x0b280aef,0x0b7b0b51,0x0bb00b9a,0x0bc60bbf,0x0bb70bc5,0x0b930bab,
-0x0b510b7b,0x0af60b26,0x0a860ac2,0x0a0a0a4c,0x098509cd,0x0904094b,0x087c08c3,0x0800083d,
-0x078507bd,0x071b0748,0x06c306e7,0x068806a0,0x066b0679,0x067d0670,0x06ad0697,0x070406d6,
-0x077b0739,0x081b07c7,0x08c20867,0x097b091e,0x0a2c09d2,0x0ad90a87,0x0b730b2f,0x0bf90bc0,
-0x0c4e0c2d,0x0c8e0c77,0x0ca20ca2,0x0c8f0ca0,0x0c500c79,0x0bef0c20,0x0b710bb4,0x0ac80b1f,
-0x0a0e0a6d,0x094009a9,0x086808d2,0x078607f7,0x06a30714,0x05c8063b,0x04f7055f,0x04320496,
-0x037d03d2,0x02de032a,0x02560293,0x01f0021e,0x019b01bc,0x0173017d,0x01600163,0x01710166,
-0x018e017f,0x01c901ac,0x021201ed,0x02520232,0x02900270,0x02ca02af,0x02ef02e0,0x02ec02f4,
-0x02e602ef,0x02af02cb,0x025e028d,0x01ec0225,0x015b01a8,0x00bb010a,0x00060064,0xff4affa5,
-0xfe92fef3,0xfddcfe30,0xfd3ffd8f,0xfca9fcf5,0xfc3ffc75,0xfbf3fc13,0xfbaffbd2,0xfb9bfb9d,
-0xfb9bfb95,0xfbabfba3,0xfbcbfbb5,0xfbf6fbdb,0xfc21fc0a,0xfc4dfc3d,0xfc74fc65,0xfc83fc7f,
-0xfc91fc92,0xfc80fc8a,0xfc49fc68,0xfbfffc24,0xfb8ffbc7,0xfafcfb44,0xfa3bfaa7,0xf961f9d6,
-0xf869f8e2,0xf75cf7e1,0xf649f6d0,0xf536f5bb,0xf429f4a5,0xf32ff3a7,0xf253f2bb,0xf194f1f2,
-0xf0faf140,0xf08df0c0,0xf03af060,0xf001f020,0xeff4eff5,0xeffbeff8,0xf01ff009,0xf04df035,
-0xf08df069,0xf0e4f0b5,0xf13ff10d,0xf19ef173,0xf206f1d2,0xf26ff236,0xf2cff297,0xf32ef2fa,
-0xf381f35a,0xf3d4f3aa,0xf416f3f9,0xf45bf438,0xf491f47c,0xf4d5f4b2,0xf515f4ef,0xf55ef532,
-0xf5bcf58a,0xf61bf5da,0xf683f649,0xf6f8f6bb,0xf777f73e,0xf801f7c3,0xf898f856,0xf93bf8f0,
-0xf9e1f98e,0xfa82fa33,0xfb21fad6,0xfbc5fb79,0xfc5dfc0b,0xfce5fc9a,0xfd58fd1c,0xfdb7fd85,
-0xfdfefdd5,0xfe20fe0c,0xfe24fe2a,0xfe17fe27,0xfe00fe18,0xfdd6fdf1,0xfdaffdbf,0xfd85fd98,
-0xfd6bfd6e,0xfd69fd65,0xfd91fd7a,0xfde5fdb4,0xfe5ffe20,0xff08fea8,0xffceff6c,0x00bc0041,
-0x01ca013f,0x02e60256,0x04140376,0x054b04b0,0x068905ec,0x07af0720,0x08dd0846,0x09f7096b,
-0x0afd0a82,0x0bed0b77,0x0cba0c59,0x0d7f0d1e,0x0e0b0dcb,0x0e7c0e41,0x0ecd0ead,0x0efc0ee8,
-0x0f080f0f,0x0efe0f04,0x0eec0ef7,0x0ec20eda,0x0e940ea1,0x0e590e72,0x0e220e3b,0x0dee0e09,
-0x0dc50dde,0x0da50db9,0x0d860d90,0x0d510d6e,0x0d280d3f,0x0ce80d08,0x0c9f0cc5,0x0c370c73,
-0x0bd10c03,0x0b4f0b88,0x0ab50afc,0x0a140a60,0x096609c2,0x08ba090f,0x0811086a,0x077b07cc,
-0x06ea0733,0x067306a9,0x060c063e,0x05b705e0,0x057b059d,0x054f0568,0x0525053c,0x05010512,
-0x04e504ef,0x04b804cb,0x0483049d,0x04460462,0x03f2041e,0x03a003c7,0x033e036d,0x02df030f,
-0x027b02b0,0x0223024a,0x01cd01f2,0x018a01ab,0x015b017a,0x013f014e,0x012c0133,0x01260128,
-0x012c0124,0x0128012d,0x012f012e,0x0126012a,0x011a011e,0x00fc0111,0x00dd00ee,0x00a300c3,
-0x00600086,0x000f003d,0xffa8ffdf,0xff31ff75,0xfea7feea,0xfe07fe55,0xfd51fda7,0xfc89fce9,
-0xfbb3fc1f,0xfacefb44,0xf9dffa57,0xf8fef971,0xf81af892,0xf748f7ad,0xf680f6e2,0xf5d8f631,
-0xf551f597,0xf4f4f518,0xf4b7f4d1,0xf4aaf4ac,0xf4d7f4c0,0xf524f4f8,0xf5adf565,0xf660f60b,
-0xf735f6c4,0xf82af7ab,0xf935f8ac,0xfa38f9b2,0xfb45fabf,0xfc42fbc7,0xfd33fcbf,0xfe08fda2,
-0xfec7fe6f,0xff66ff1c,0xffe5ffa6,0x004b0018,0x00900072,0x00c300a9,0x00e500d1,0x00eb00de,
-0x00da00db,0x00c600ce,0x009400ae,0x00590079,0x00190037,0xffc0ffec,0xff58ff87,0xfee0ff18,
-0xfe59fea1,0xfdc5fe0e,0xfd31fd7f,0xfc99fce2,0xfc0efc53,0xfb81fbc5,0xfb0bfb45,0xfaabfadb,
-0xfa6efa8f,0xfa45fa52,0xfa30fa3d,0xfa37fa33,0xfa52fa46,0xfa75fa5f,0xfab3fa92,0xfae7facd,
-0xfb32fb0b,0xfb82fb52,0xfbdcfbad,0xfc3ffc15,0xfcb0fc7e,0xfd3afcfa,0xfdccfd81,0xfe65fe16,
-0xff04feb7,0xff98ff49,0x0027ffe6,0x00b9006f,0x012f00f2,0x01a20164,0x01f901d1,0x0246021e,
-0x028f026c,0x02d002b1,0x031002f3,0x035c0335,0x03ac0380,0x040d03da,0x04700440,0x04d904a8,
-0x0554051d,0x05cb0591,0x064a0609,0x06c00682,0x072c06f9,0x078c0761,0x07ed07c1,0x083d081b,
-0x087a085a,0x089e088a,0x08b908aa,0x08b708b9,0x089408ab,0x08520875,0x07f6082a,0x077507b3,
-0x06e0072d,0x063a0694,0x058205e6,0x04cd052d,0x041b047a,0x037f03cb,0x02f4033c,0x027f02b4,
-0x0220024b,0x01c901f0,0x0186019f,0x014f0168,0x0110012e,0x00d300ed,0x008900af,0x00350060,
-0xffdb000e,0xff81ffb3,0xff21ff56,0xfec8fef9,0xfe80fea3,0xfe45fe67,0xfe17fe28,0xfdf5fe07,
-0xfddefdeb,0xfdcefdda,0xfdbcfdc2,0xfd9efdac,0xfd6afd81,0xfd1dfd48,0xfcb4fcf2,0xfc37fc78,
-0xfb97fbef,0xfaeafb43,0xfa37fa93,0xf978f9d1,0xf8caf91e,0xf838f87d,0xf7cbf7ff,0xf786f7a1,
-0xf75ef764,0xf752f754,0xf771f765,0xf7aef78d,0xf7fcf7d4,0xf858f827,0xf8b4f884,0xf908f8d4,
-0xf94ef928,0xf987f968,0xf9bcf9a1,0xf9ddf9cf,0xfa09f9f3,0xfa26fa1a,0xfa4ffa3c,0xfa76fa64,
-0xfab4fa97,0xfafcfad4,0xfb50fb1b,0xfbb3fb81,0xfc26fbe7,0xfca4fc67,0xfd36fcf2,0xfdc9fd7f,
-0xfe63fe12,0xfefffeb5,0xff98ff4d,0x002affe0,0x00a6006f,0x011f00df,0x01810152,0x01c601a5,
-0x020301ea,0x02270215,0x023c023a,0x02480244,0x02510250,0x02400243,0x022f0232,0x02220222,
-0x020c0216,0x01ea01fc,0x01c701df,0x019c01b7,0x0171018c,0x01340157,0x00de010d,0x008a00b8,
-0x0027005e,0xffb2ffe9,0xff35ff6d,0xfeabfeee,0xfe1dfe61,0xfd7dfdc9,0xfcddfd27,0xfc46fc93,
-0xfbabfbf8,0xfb1afb65,0xfa96fad7,0xfa1ffa5c,0xf9d1f9fd,0xf993f9b2,0xf96af97b,0xf96df966,
-0xf987f977,0xf9c6f99f,0xfa1bf9e7,0xfa8dfa4c,0xfb09fac2,0xfb9bfb4b,0xfc35fbe7,0xfcd5fc82,
-0xfd73fd25,0xfe17fdc1,0xfea5fe5a,0xff45fef4,0xffe0ff92,0x0084002f,0x012b00d5,0x01e00181,
-0x02a10244,0x0373030c,0x044c03e3,0x052c04b6,0x0603059b,0x06da0673,0x0798073c,0x084907f3,
-0x08df0894,0x095a091c,0x09bb098d,0x0a1309e6,0x0a570a34,0x0a9b0a78,0x0ad00ab7,0x0b040aec,
-0x0b3e0b22,0x0b750b59,0x0ba90b95,0x0bdd0bc6,0x0bfb0bec,0x0c210c0a,0x0c440c38,0x0c5b0c54,
-0x0c640c5f,0x0c660c69,0x0c700c6b,0x0c640c6f,0x0c5a0c60,0x0c3f0c46,0x0c220c29,0x0bf80c05,
-0x0bc80be0,0x0b9d0bb4,0x0b740b8f,0x0b460b60,0x0b090b2c,0x0ace0af3,0x0a970abd,0x0a5c0a85,
-0x0a180a4a,0x09d709ff,0x098709af,0x09320957,0x08cb08fd,0x085b0891,0x07ec0824,0x077507b2,
-0x06fb0736,0x068606c4,0x06140650,0x05b105de,0x05450575,0x04d6050a,0x04690499,0x03f1042a,
-0x038003b5,0x02fc0338,0x026102ae,0x01ba020e,0x00fc0161,0x004000a0,0xff67ffdc,0xfe8efeff,
-0xfdbffe22,0xfcdafd4d,0xfc03fc71,0xfb36fba1,0xfa78fadc,0xf9bdfa15,0xf917f968,0xf872f8c1,
-0xf7e1f827,0xf74ff791,0xf6c2f6fe,0xf640f67c,0xf5c7f601,0xf55ef590,0xf4fef529,0xf4b3f4d8,
-0xf471f494,0xf456f46a,0xf448f456,0xf452f44f,0xf466f45d,0xf48bf478,0xf4b9f4a8,0xf4fff4dc,
-0xf547f523,0xf589f561,0xf5d4f5aa,0xf61df5f1,0xf668f640,0xf6adf68a,0xf6eef6ce,0xf730f716,
-0xf76ff749,0xf79bf78e,0xf7d6f7bb,0xf806f7f4,0xf837f822,0xf863f84d,0xf88af878,0xf8a8f89e,
-0xf8c4f8c2,0xf8d1f8cc,0xf8c7f8d2,0xf89ef8b7,0xf865f88a,0xf806f83d,0xf799f7d5,0xf717f75d,
-0xf686f6cb,0xf5e7f631,0xf54ef59a,0xf4b8f500,0xf43af477,0xf3c9f3fc,0xf37af39a,0xf33af355,
-0xf31bf326,0xf319f31c,0xf333f31e,0xf369f34b,0xf3b5f38f,0xf420f3e4,0xf49df45e,0xf52ef4e3,
-0xf5dff581,0xf69bf63b,0xf76df70c,0xf847f7df,0xf925f8b5,0xfa17f9a5,0xfb02fa8b,0xfbe4fb73,
-0xfcc7fc55,0xfd9cfd2f,0xfe64fdfa,0xff17feb8,0xffb9ff60,0x00450003,0x00b70083,0x011b00f4,
-0x0173014f,0x01b4019a,0x01f001db,0x02290210,0x02540240,0x0287026e,0x02d202aa,0x032102f4,
-0x038c034e,0x03ff03c3,0x0481043d,0x050e04cb,0x05a7055e,0x063905f5,0x06c1067d,0x07410703,
-0x07a4076f,0x07fb07d6,0x083b081e,0x0861084f,0x08810871,0x08950887,0x08a20890,0x08a9089f,
-0x08ba08aa,0x08ca08b9,0x08f108d2,0x091508ff,0x09480929,0x09870968,0x09ce09a9,0x0a0f09ec,
-0x0a5a0a31,0x0a9d0a7d,0x0ae00ac2,0x0b240b04,0x0b680b47,0x0bab0b8a,0x0bf20bd1,0x0c360c13,
-0x0c870c65,0x0cd00cb0,0x0d190cf7,0x0d5b0d3a,0x0d8b0d71,0x0da80d99,0x0dbf0db7,0x0db70dbd,
-0x0d920d9f,0x0d570d76,0x0cf80d21,0x0c830cc4,0x0bf80c3f,0x0b5d0bb1,0x0ab10b0c,0x09f70a51,
-0x09390999,0x087508d6,0x07ad0815,0x06e9074c,0x0620067f,0x055c05bc,0x049004f8,0x03ce0437,
-0x030f0376,0x024802b1,0x018c01f1,0x00d10131,0x001d007c,0xff72ffc8,0xfedaff23,0xfe52fe98,
-0xfdddfe1a,0xfd80fdad,0xfd36fd5c,0xfcfafd1c,0xfcd2fce6,0xfcc3fcc3,0xfcb6fcb8,0xfcb2fcae,
-0xfcb5fcae,0xfcbbfcb7,0xfcc6fcbe,0xfcc9fcc9,0xfccdfccf,0xfcd2fcd2,0xfcd2fcd3,0xfcccfcd0,
-0xfcc5fcc8,0xfcbefcc1,0xfca1fcae,0xfc87fc96,0xfc53fc68,0xfc19fc34,0xfbc9fbf1,0xfb7dfba9,
-0xfb23fb51,0xfacafafb,0xfa6ffa9a,0xfa17fa3f,0xf9c9f9ee,0xf987f9ac,0xf955f96c,0xf936f947,
-0xf914f921,0xf8fbf907,0xf8ebf8f0,0xf8d9f8de,0xf8c9f8cf,0xf8b0f8bc,0xf891f8a4,0xf870f87e,
-0xf83af851,0xf816f829,0xf7edf7fc,0xf7caf7da,0xf7b0f7b8,0xf78df79f,0xf77bf781,0xf777f77b,
-0xf779f77c,0xf78df782,0xf7b3f79e,0xf7d8f7c3,0xf80ef7f3,0xf855f82f,0xf8aaf87e,0xf904f8d8,
-0xf980f93a,0xfa01f9b9,0xfa91fa3f,0xfb38fadd,0xfbeefb8e,0xfcc5fc5c,0xfdadfd36,0xfe9bfe1b,
-0xff90ff10,0x008c0003,0x01840105,0x027b01fa,0x035702ec,0x042a03c4,0x04d10484,0x0557051d,
-0x05be0592,0x05fc05e8,0x061a0615,0x06100618,0x05de05fb,0x05a205c4,0x05430574,0x04e20512,
-0x047504a8,0x03fe042e,0x038703bb,0x030d0347,0x02a302d4,0x023f0271,0x01d8020c,0x017b01a3,
-0x011e0148,0x00c500ea,0x006e009a,0x0028004b,0xffe70008,0xffb3ffc7,0xff8bffa4,0xff8cff8b,
-0xffa4ff98,0xffd2ffb8,0x001ffff2,0x008a004e,0x010700c5,0x018e0148,0x022401df,0x02bb0270,
-0x033f0304,0x03b50385,0x042003f4,0x045f0445,0x048e047c,0x049a0492,0x049b049f,0x0487048d,
-0x0476047e,0x045e046c,0x04550458,0x04530452,0x045b0457,0x04630462,0x0470046d,0x0487047a,
-0x0492048b,0x04850489,0x0475047d,0x04570465,0x042b0443,0x03f90415,0x03ca03e8,0x039503b2,
-0x036b0385,0x034b0356,0x032f0336,0x030e0318,0x02f802fb,0x02cf02e1,0x029902b4,0x025c0279,
-0x0210023e,0x01bb01e8,0x0143017d,0x00c90108,0x003f0082,0xffaffff8,0xff1bff6d,0xfe90fede,
-0xfe00fe52,0xfd81fdce,0xfd00fd40,0xfc7afcbb,0xfbf5fc34,0xfb7bfbb9,0xfb0afb42,0xfa97facb,
-0xfa41fa6c,0xfa02fa19,0xf9d4f9ea,0xf9c1f9c2,0xf9d3f9c5,0xf9f6f9e1,0xfa33fa14,0xfa7dfa52,
-0xfadafab0,0xfb35fb0e,0xfb85fb64,0xfbd7fbb1,0xfc05fbec,0xfc29fc15,0xfc30fc2e,0xfc22fc28,
-0xfc02fc0b,0xfbd4fbf0,0xfb9bfbad,0xfb58fb76,0xfb00fb28,0xfaaffad6,0xfa5bfa82,0xfa07fa31,
-0xf9b5f9dc,0xf96cf991,0xf92af94a,0xf8eaf902,0xf8b3f8c9,0xf88df8a1,0xf878f884,0xf872f872,
-0xf884f87b,0xf8adf897,0xf8e4f8cd,0xf923f90c,0xf97cf951,0xf9dcf9aa,0xfa3bfa01,0xfa98fa64,
-0xfb00faca,0xfb61fb31,0xfbcefb94,0xfc3afc00,0xfca9fc73,0xfd23fce8,0xfd9dfd64,0xfe1efddf,
-0xfe90fe53,0xff19fed4,0xff91ff58,0x0006ffcc,0x006f0034,0x00c10095,0x010500e3,0x013c0126,
-0x016b015a,0x0186017c,0x019c0198,0x01ad01b1,0x01cf01c7,0x01f601e3,0x021f020d,0x02520242,
-0x02800268,0x02cb02ac,0x030d02ed,0x034f0330,0x038d036e,0x03ba03a0,0x03d703ca,0x03e703e6,
-0x03e603ec,0x03da03e4,0x03ca03d5,0x03af03bb,0x039b03a0,0x0383038b,0x0380037e,0x03890380,
-0x039a038f,0x03bb03a5,0x03ec03d0,0x042f040d,0x0476044c,0x04c30495,0x051404e9,0x05660539,
-0x05b80590,0x060f05e2,0x0656063a,0x06890672,0x06b506a4,0x06d006c6,0x06cc06ce,0x06b806bd,
-0x0682069f,0x063b0663,0x05e80613,0x058d05c0,0x05270558,0x04d20501,0x049804ae,0x04740484,
-0x046f046a,0x0490047c,0x04d404a9,0x05360509,0x05b40570,0x064105f8,0x06d90690,0x07770724,
-0x080e07c6,0x089e0856,0x092108e2,0x09850955,0x09d309ad,0x0a0e09f4,0x0a300a22,0x0a3b0a36,
-0x0a2b0a31,0x0a060a1c,0x09d209ee,0x098409ae,0x09330968,0x08d0090c,0x086e08a5,0x0806083c,
-0x07a007da,0x073d0771,0x06e70719,0x068806be,0x063a065e,0x05ea0614,0x059d05c2,0x05490572,
-0x04ea0519,0x048804bd,0x0421045a,0x03a603e5,0x031a0361,0x028702cb,0x01e1022e,0x01450193,
-0x00b200f9,0x001c006a,0xff8affcf,0xff0bff50,0xfe90fece,0xfe28fe5e,0xfdc2fdf3,0xfd67fd92,
-0xfd03fd34,0xfcb1fcd7,0xfc4afc76,0xfbe3fc11,0xfb79fbb2,0xfb05fb4a,0xfa86fac5,0xfa04fa4d,
-0xf97ef9be,0xf8fbf93a,0xf872f8b3,0xf7e5f827,0xf75df7a7,0xf6d7f71c,0xf64ef697,0xf5c9f608,
-0xf550f58b,0xf4cdf50c,0xf455f494,0xf3e6f422,0xf375f3b1,0xf318f34c,0xf2ccf2fa,0xf28bf2ad,
-0xf265f275,0xf252f254,0xf24bf24a,0xf25ff247,0xf283f26a,0xf2c2f29d,0xf30df2e6,0xf366f33b,
-0xf3daf3a1,0xf44cf413,0xf4c9f491,0xf53bf505,0xf5b4f576,0xf61ef5eb,0xf67bf652,0xf6d4f6ab,
-0xf72bf704,0xf770f74c,0xf7b5f78d,0xf7eaf7c6,0xf811f7ff,0xf834f825,0xf868f848,0xf88ef87e,
-0xf8bef8a4,0xf8f3f8d4,0xf930f915,0xf97df953,0xf9dff9ae,0xfa43fa0f,0xfab7fa77,0xfb39faf9,
-0xfbb0fb7b,0xfc2ffbf6,0xfca7fc6e,0xfd0cfcd8,0xfd62fd35,0xfda4fd83,0xfdc1fdac,0xfdd0fdcf,
-0xfdcbfdcb,0xfdaafdbe,0xfd84fd95,0xfd44fd6b,0xfd00fd23,0xfcc7fce9,0xfc91fcb2,0xfc72fc85,
-0xfc50fc5f,0xfc4afc48,0xfc59fc4b,0xfc83fc71,0xfcd1fca6,0xfd3bfcfe,0xfdc8fd78,0xfe6bfe12,
-0xff25feba,0xfff2ff85,0x00dc0063,0x01bd0142,0x02ab0232,0x03920327,0x046a0406,0x054304d7,
-0x060b05a6,0x06b8065a,0x075c0710,0x07e007a4,0x085d082b,0x08c60899,0x092b0901,0x09780953,
-0x09bd099a,0x09fe09de,0x0a360a17,0x0a5d0a43,0x0a8a0a74,0x0aad0a9d,0x0adc0ac3,0x0af90ae3,
-0x0b100af8,0x0b2e0b17,0x0b440b2e,0x0b530b46,0x0b610b54,0x0b700b66,0x0b720b70,0x0b6e0b6f,
-0x0b720b77,0x0b630b71,0x0b590b63,0x0b450b4b,0x0b2b0b30,0x0af60b0f,0x0ac10ada,0x0a6e0a9e,
-0x0a1d0a4f,0x09ba09eb,0x094b0987,0x08cf090a,0x08520893,0x07d70812,0x076c07a8,0x07160744,
-0x06cf06ef,0x069d06b5,0x068a0693,0x0685067c,0x069e068d,0x06b806a7,0x06e306cf,0x070306f6,
-0x0724071c,0x0733072e,0x0725072d,0x06fe0711,0x06bb06e4,0x0653068c,0x05d30615,0x05380585,
-0x049504ea,0x03e0043d,0x03340387,0x027e02dc,0x01d40229,0x0136017f,0x009b00ea,0x00080050,
-0xff7dffc6,0xfef6ff3e,0xfe6cfeb8,0xfde1fe23,0xfd45fd96,0xfcb1fcff,0xfc0afc68,0xfb68fbba,
-0xfab9fb0f,0xfa0cfa5f,0xf960f9b0,0xf8bef90d,0xf822f86f,0xf797f7d8,0xf722f75c,0xf6b7f6e7,
-0xf66ef692,0xf634f649,0xf619f624,0xf612f611,0xf620f610,0xf63ff62c,0xf676f658,0xf6b7f697,
-0xf6fff6da,0xf75af730,0xf7b5f787,0xf820f7ef,0xf88af856,0xf8f3f8c2,0xf959f92a,0xf9c8f991,
-0xfa2bf9fa,0xfa90fa5b,0xfae4fab3,0xfb2cfb04,0xfb61fb45,0xfb91fb7b,0xfbacfba3,0xfbcafbc3,
-0xfbd5fbd1,0xfbe2fbe2,0xfbe4fbe5,0xfbebfbe9,0xfbf1fbe9,0xfbf4fbf3,0xfbe7fbf5,0xfbdffbe0,
-0xfbc3fbd2,0xfb9ffbb5,0xfb6cfb8b,0xfb2afb4e,0xfadbfb08,0xfa87fab2,0xfa30fa57,0xf9dffa07,
-0xf99df9b8,0xf966f980,0xf953f958,0xf962f951,0xf993f974,0xf9dcf9b3,0xfa4ffa11,0xfae3fa8e,
-0xfb85fb2c,0xfc2ffbd8,0xfcf0fc8b,0xfdadfd43,0xfe67fe06,0xff15febe,0xffc0ff6f,0x0060000a,
-0x00fa00ab,0x01880144,0x021901d4,0x02aa0264,0x033502f2,0x03c6037b,0x0452040c,0x04e30498,
-0x056b052a,0x05ee05ab,0x06730633,0x06e006b2,0x0752071f,0x07a70788,0x07e707d3,0x0816080c,
-0x0831082c,0x083e0842,0x0832083c,0x08140828,0x07e307fa,0x079a07c1,0x07520775,0x06f7072a,
-0x069606c8,0x062f065f,0x05c505ff,0x0556058a,0x04ee051f,0x049a04c1,0x044b0470,0x03fc0420,
-0x03c903e1,0x039b03b1,0x0382038c,0x036a037a,0x03600368,0x035c035c,0x035d035f,0x035d0358,
-0x03610366,0x03560359,0x035b0357,0x03530356,0x034f034f,0x03540353,0x03590351,0x03570357,
-0x03630365,0x03800378,0x03a1038f,0x03d203b9,0x03fb03e2,0x04340412,0x046d044c,0x049e0482,
-0x04c004ad,0x04c204bf,0x04b904c1,0x049104ad,0x044c047c,0x03dd0419,0x03420399,0x028602ef,
-0x01ab021f,0x00bb0135,0xffa80034,0xfe92ff1d,0xfd7afe01,0xfc59fce6,0xfb56fbd2,0xfa5bfad0,
-0xf97cf9e3,0xf8adf914,0xf806f85b,0xf77bf7c7,0xf70af745,0xf6b5f6e0,0xf675f68d,0xf652f65d,
-0xf643f64a,0xf646f63e,0xf657f64d,0xf685f66d,0xf6c3f6a9,0xf703f6df,0xf758f727,0xf7a7f785,
-0xf7fff7d4,0xf85cf830,0xf8a9f884,0xf8f8f8d1,0xf92df90c,0xf960f945,0xf97bf96d,0xf98cf988,
-0xf99bf999,0xf99df9a0,0xf9a5f9a8,0xf9b4f9af,0xf9bff9b9,0xf9d9f9ce,0xfa14f9ff,0xfa58fa39,
-0xfab0fa83,0xfb21fae7,0xfb97fb5d,0xfc16fbdc,0xfc9cfc5c,0xfd22fcde,0xfda3fd5f,0xfe1dfddb,
-0xfe8afe4e,0xfee6feb9,0xff3dff19,0xff75ff58,0xffa1ff90,0xffb4ffb0,0xffbfffbe,0xffb3ffc1,
-0xffa1ffac,0xff7dff91,0xff4fff6a,0xff1cff36,0xfee3ff03,0xfeb2fec9,0xfe7ffe97,0xfe4afe65,
-0xfe21fe37,0xfe04fe12,0xfde3fdf4,0xfde2fde2,0xfdeafde7,0xfe05fdf6,0xfe38fe14,0xfe69fe4b,
-0xfeb7fe8a,0xff19fee3,0xff89ff54,0x001bffd2,0x00b7006b,0x015f0109,0x021b01c0,0x02ce0275,
-0x0388032c,0x043903dc,0x04db0490,0x0556051d,0x05d30594,0x061805f2,0x06530635,0x06700664,
-0x067f067d,0x0687068b,0x068a0689,0x069c0690,0x06a8069e,0x06c806bc,0x06ee06da,0x072c070c,
-0x07610749,0x079e077b,0x07cd07b1,0x07ee07e1,0x080407fb,0x07ef07fd,0x07d607df,0x079807bb,
-0x07460778,0x06e60718,0x068506b8,0x06210652,0x05cd05f1,0x058b05a8,0x05550569,0x053d054c,
-0x053a053e,0x054c0543,0x05600556,0x05800570,0x05a50594,0x05b905ae,0x05cc05c4,0x05dd05d4,
-0x05e505dd,0x05e705e0,0x05e305da,0x05e405e5,0x05d505db,0x05d305db,0x05d005d9,0x05bf05cf,
-0x05b405c6,0x05a305af,0x058b059f,0x05690576,0x054a0552,0x05220534,0x04e60500,0x04bb04ce,
-0x0487049f,0x0453046f,0x04230441,0x04030412,0x03d603ef,0x03a603bc,0x0378038e,0x0346035d,
-0x0307032e,0x02c602ec,0x027b02a2,0x0223024b,0x01c901f1,0x01690196,0x010e013c,0x00bd00e0,
-0x00740096,0x003e0059,0x000c0025,0xffebfffd,0xffdaffe3,0xffcdffd1,0xffbfffc3,0xffaeffb3,
-0xff97ffa5,0xff76ff84,0xff42ff62,0xff03ff28,0xfec0fee3,0xfe61fe95,0xfe02fe39,0xfd9bfdd0,
-0xfd30fd66,0xfcc1fcf7,0xfc4cfc89,0xfbe1fc19,0xfb7dfbb2,0xfb20fb4e,0xfac1faed,0xfa66fa93,
-0xfa11fa34,0xf9b1f9de,0xf951f980,0xf8edf920,0xf88ef8bf,0xf81cf852,0xf7aef7e1,0xf738f779,
-0xf6cef704,0xf64ff694,0xf5f4f629,0xf59cf5d1,0xf55bf57a,0xf525f53a,0xf504f50f,0xf4f8f4f6,
-0xf503f4f8,0xf516f506,0xf53ef521,0xf577f54f,0xf5a4f589,0xf5c7f5b3,0xf5f3f5dc,0xf60cf5fc,
-0xf619f61d,0xf618f617,0xf5fbf610,0xf5ddf5f0,0xf5baf5d2,0xf589f5a1,0xf55ff572,0xf53ff550,
-0xf527f533,0xf521f524,0xf52af52a,0xf547f535,0xf57df564,0xf5c8f5a0,0xf621f5ee,0xf68cf64e,
-0xf709f6c3,0xf792f74c,0xf82ff7dc,0xf8d6f885,0xf983f92e,0xfa3df9e0,0xfafdfa99,0xfbbefb59,
-0xfc7cfc18,0xfd2bfcda,0xfdd4fd88,0xfe71fe29,0xff0bfec2,0xff80ff46,0xffedffb7,0x003f0015,
-0x008d0064,0x00cb00a4,0x00f800e2,0x0129010e,0x015c0146,0x01a10177,0x01e501c5,0x022c0205,
-0x0285025a,0x02f402bd,0x0359031f,0x03c1038d,0x042c03f7,0x048a045a,0x04e504b7,0x05340510,
-0x057b055a,0x05ab0598,0x05e905c8,0x060c05fb,0x06390623,0x0662064f,0x0695067b,0x06c806b9,
-0x070806f0,0x074f0732,0x07a20782,0x07eb07c6,0x08370817,0x08890864,0x08c908ad,0x090208e1,
-0x0930091c,0x09530947,0x0967095e,0x09740970,0x096e0971,0x095c0966,0x0949094d,0x0930093e,
-0x0913091e,0x090b090e,0x08f708fd,0x08f208f4,0x090808fb,0x092b0914,0x0951093e,0x09820969,
-0x09bf09a7,0x0a0109de,0x0a3d0a23,0x0a770a5f,0x0aab0a97,0x0abe0ab5,0x0acd0aca,0x0ac20ace,
-0x0a9c0aab,0x0a5c0a7f,0x0a0a0a34,0x099909d7,0x09150953,0x088708cf,0x07d60830,0x071b077a,
-0x065406c0,0x058005ef,0x04b10519,0x03d60449,0x03110378,0x024d02ac,0x018d01f0,0x00e60136,
-0x00470098,0xffbeffff,0xff50ff86,0xfeeeff15,0xfea2fec7,0xfe6efe86,0xfe49fe5b,0xfe3dfe43,
-0xfe3bfe3b,0xfe4ffe43,0xfe69fe5c,0xfe91fe7a,0xfebbfea4,0xfee4fed5,0xff06feee,0xff21ff12,
-0xff34ff27,0xff39ff38,0xff31ff3a,0xff26ff35,0xff03ff1f,0xfee1fef9,0xfea8febf,0xfe5afe81,
-0xfe15fe3a,0xfdc7fdf2,0xfd6efd9c,0xfd08fd3c,0xfc97fcc8,0xfc18fc55,0xfb91fbd8,0xfaf9fb47,
-0xfa5efaad,0xf9b6fa08,0xf904f960,0xf84cf8af,0xf79af7f7,0xf6ebf746,0xf639f694,0xf586f5e3,
-0xf4f1f53a,0xf459f49d,0xf3e4f416,0xf382f3ab,0xf335f351,0xf30bf314,0xf2fef2ff,0xf312f302,
-0xf349f326,0xf398f370,0xf405f3d1,0xf483f443,0xf504f4c2,0xf597f550,0xf633f5ea,0xf6d1f680,
-0xf776f721,0xf81ff7cb,0xf8caf870,0xf975f91c,0xfa1ef9cd,0xfad3fa79,0xfb75fb23,0xfc1dfbcd,
-0xfcb9fc6c,0xfd55fd06,0xfde1fd9d,0xfe6bfe28,0xfeeafea4,0xff61ff25,0xffceff94,0x00370004,
-0x00960069,0x010000d3,0x01730138,0x01dc01a7,0x02470212,0x02b1027d,0x031502e8,0x03710345,
-0x03be0393,0x03fc03d8,0x04180407,0x0421041a,0x04160422,0x03f70409,0x03c403dd,0x038f03aa,
-0x034d036a,0x03180339,0x02ea02fb,0x02c702d6,0x02b502bc,0x02b802bb,0x02d002bb,0x02ee02e1,
-0x031002fd,0x03490333,0x03800362,0x03c403a4,0x041003e0,0x045a0432,0x049c0478,0x04f304c4,
-0x0548051d,0x05ad0576,0x061205db,0x06780642,0x06e006af,0x073f0712,0x07960768,0x07e307bb,
-0x081e0805,0x0852083a,0x08790866,0x08870881,0x08880889,0x087e0881,0x08520866,0x08260844,
-0x07d107fc,0x077e07aa,0x07050742,0x067906c5,0x05d30630,0x052c058d,0x046e04e2,0x0396040e,
-0x02d20339,0x02090269,0x014c01a5,0x009f00f2,0x000f0058,0xffa0ffd2,0xff51ff77,0xff12ff2d,
-0xfeedfefc,0xfee8feea,0xfee1fedb,0xfeebfedc,0xfef3fef2,0xfef9fef6,0xfefeff01,0xfeffff05,
-0xfeffff07,0xfef5fefd,0xfef2fef3,0xfef1fef3,0xfee4fee7,0xfee6fee1,0xfeddfede,0xfedefed8,
-0xfee4fed7,0xfedbfedc,0xfecefed0,0xfeb4fec3,0xfe91feac,0xfe5dfe78,0xfe25fe46,0xfdd6fdf8,
-0xfd76fda6,0xfd14fd49,0xfca8fce1,0xfc36fc6f,0xfbc0fbfe,0xfb4afb84,0xfadbfb13,0xfa6efaa5,
-0xfa0bfa42,0xf9a4f9d6,0xf949f973,0xf8fbf923,0xf8b1f8d2,0xf870f896,0xf835f857,0xf805f826,
-0xf7eef7fa,0xf7e5f7eb,0xf7def7dc,0xf7ecf7e8,0xf807f7f7,0xf82ef813,0xf85cf843,0xf899f880,
-0xf8d6f8b8,0xf926f8fb,0xf971f943,0xf9c3f997,0xfa10f9e7,0xfa5dfa34,0xfaacfa88,0xfaf7fadc,
-0xfb48fb23,0xfb95fb77,0xfbe6fbbb,0xfc2efc10,0xfc74fc57,0xfcc1fc9f,0xfcf9fcdd,0xfd2dfd17,
-0xfd59fd3e,0xfd7afd6d,0xfd8dfd80,0xfda5fd98,0xfda3fda3,0xfda0fda0,0xfda5fda2,0xfd9cfd9d,
-0xfda6fda4,0xfdaffdaa,0xfdcbfdbf,0xfdfffdec,0xfe3ffe1f,0xfe8ffe6c,0xfef1fec6,0xff64ff30,
-0xffe5ffa7,0x00630022,0x00e400a7,0x015c0123,0x01ce019d,0x022f0201,0x027f0258,0x02b2029d,
-0x02d702cb,0x02f102e7,0x02f702f7,0x02f902fd,0x030102fe,0x02fe02f5,0x030d0300,0x032e0317,
-0x03600339,0x039d0380,0x03ff03c9,0x046e0437,0x04e804af,0x056d0528,0x05f705b5,0x066e0635,
-0x06ed06b3,0x075b072a,0x07b3078b,0x07fe07da,0x08370820,0x08610856,0x087a0873,0x088a0887,
-0x088e088a,0x0891088d,0x08870889,0x0875087d,0x08650866,0x08490851,0x08270837,0x07ff0813,
-0x07d507ec,0x079f07c2,0x076e0786,0x07390750,0x06fd071e,0x06cc06ea,0x069506b2,0x06670681,
-0x063a064f,0x06130627,0x05ea05fa,0x05c505d5,0x059205a9,0x055b0578,0x0534054a,0x04fe0518,
-0x04c004d9,0x0486049f,0x044f046c,0x0420043a,0x03f80416,0x03d503e8,0x03c703d0,0x03bb03c6,
-0x03bc03c6,0x03b703c7,0x03b603c5,0x03b403c8,0x03a903b6,0x039303a0,0x03780388,0x0347035f,
-0x03070327,0x02cf02ec,0x028202ab,0x02400264,0x01f80220,0x01bc01d3,0x017c019d,0x0145015a,
-0x01050124,0x00dc00f1,0x00ac00bf,0x00750089,0x003b0052,0xfffb001b,0xffadffd1,0xff5cff86,
-0xff07ff35,0xfe9ffedd,0xfe34fe70,0xfdc1fdfa,0xfd42fd89,0xfcc0fcfe,0xfc3cfc7f,0xfbacfbef,
-0xfb21fb65,0xfa97fad3,0xfa08fa4c,0xf98cf9c9,0xf912f954,0xf8a7f8da,0xf845f878,0xf7f0f815,
-0xf7a3f7cc,0xf761f786,0xf72ef74e,0xf701f71f,0xf6dff6f3,0xf6c0f6d8,0xf6a4f6ae,0xf695f6a0,
-0xf68bf68d,0xf683f68c,0xf694f68d,0xf6b0f6a4,0xf6def6c4,0xf717f6f6,0xf769f73b,0xf7c5f792,
-0xf833f804,0xf8b0f875,0xf932f8ec,0xf9b0f96f,0xfa30f9ef,0xfa99fa5d,0xfafbfaca,0xfb43fb22,
-0xfb72fb5d,0xfb8dfb85,0xfb8bfb8f,0xfb6bfb81,0xfb41fb5d,0xfb07fb28,0xfabbfae6,0xfa76fa9c,
-0xfa1ffa44,0xf9cff9f1,0xf97af9a0,0xf92df951,0xf8ebf90a,0xf8abf8ca,0xf87af88b,0xf860f875,
-0xf854f85d,0xf859f857,0xf878f868,0xf8acf892,0xf8fef8cd,0xf956f922,0xf9c1f985,0xfa28f9ee,
-0xfaa0fa65,0xfb13fadf,0xfb7afb4b,0xfbe7fbb7,0xfc4bfc24,0xfcaafc7c,0xfd02fcd5,0xfd42fd28,
-0xfd7dfd5e,0xfdb7fda4,0xfdebfdd6,0xfe20fe09,0xfe4dfe37,0xfe7dfe62,0xfea7fe8e,0xfee1feb8,
-0xff20fefe,0xff66ff36,0xffbfff8d,0x002ffff0,0x00ad006a,0x014500fc,0x01f801a3,0x02ba025c,
-0x038a031f,0x045d03f5,0x053904ca,0x060e05a7,0x06dc0676,0x0799073a,0x084507f5,0x08e10896,
-0x096b0926,0x09d509a4,0x0a3d0a0d,0x0a870a64,0x0ab70aa6,0x0adf0ad1,0x0af40ae6,0x0aef0af3,
-0x0ae00ae1,0x0ab60aca,0x0a7e0a92,0x0a2f0a54,0x09d909fe,0x097009a0,0x08ff0935,0x088508c5,
-0x0818084d,0x07af07dc,0x07560784,0x07050728,0x06d306ed,0x06b406c9,0x06a506a8,0x06ab06a4,
-0x06ca06b5,0x06ec06d7,0x07120702,0x0742072a,0x0770075a,0x079a0787,0x07c707ae,0x07ec07d6,
-0x07fb07f7,0x0812080d,0x08210819,0x0820081e,0x081c081f,0x080b0810,0x07e707f7,0x07b907d1,
-0x0784079e,0x07460767,0x06f80723,0x069606c3,0x0635066b,0x05d40605,0x056905a2,0x04f80535,
-0x048104bb,0x03ff0445,0x038003bc,0x02e40332,0x02500298,0x01ab01fe,0x010a015e,0x005800b2,
-0xff9ffffa,0xfee9ff44,0xfe2efe8e,0xfd7ffdd5,0xfcd1fd25,0xfc2efc78,0xfba4fbdb,0xfb31fb5f,
-0xfaccfaf7,0xfa7dfa9d,0xfa41fa5d,0xfa1afa2d,0xf9f8fa0a,0xf9e7f9f9,0xf9dbf9e7,0xf9d2f9de,
-0xf9c0f9cf,0xf9aff9be,0xf994f9a1,0xf974f97b,0xf94cf95b,0xf91cf930,0xf8f0f901,0xf8b9f8d7,
-0xf897f8a9,0xf874f882,0xf868f867,0xf871f862,0xf88af872,0xf8b5f897,0xf8fcf8d6,0xf95ef92d,
-0xf9daf9a1,0xfa69fa1f,0xfafefab1,0xfb91fb43,0xfc18fbdb,0xfc9efc63,0xfd0ffcdd,0xfd6afd40,
-0xfdabfd8d,0xfdcbfdbb,0xfdc8fdd1,0xfdb2fdca,0xfd75fda2,0xfd37fd62,0xfce6fd15,0xfc87fcb4,
-0xfc18fc49,0xfb9ffbd8,0xfb29fb60,0xfaabfae9,0xfa31fa71,0xf9c5f9ff,0xf954f986,0xf8e8f91f,
-0xf87af8b2,0xf824f84f,0xf7dff802,0xf7a7f7c1,0xf789f794,0xf786f787,0xf7a7f790,0xf7edf7bf,
-0xf84af819,0xf8c5f884,0xf95cf90f,0xfa0df9b4,0xfaccfa6d,0xfb95fb35,0xfc6afbfc,0xfd42fcd9,
-0xfe18fdae,0xfee6fe84,0xffb9ff52,0x0082001c,0x013d00d8,0x01eb0194,0x029b0249,0x034302ec,
-0x03d6038f,0x04670422,0x04e104ab,0x05450514,0x059a056e,0x05dc05ba,0x060505f0,0x06280615,
-0x06430631,0x064d0647,0x0651064e,0x065a0655,0x06610658,0x0665065e,0x066a0660,0x066b066b,
-0x06760670,0x0680067a,0x06830680,0x068a068a,0x0686068c,0x06800686,0x0676067e,0x0665066d,
-0x064a065b,0x06370647,0x06210627,0x05ff0613,0x05e005f0,0x05b105cb,0x059005a2,0x0559056c,
-0x051f053c,0x04dd04f7,0x04a504c5,0x0457047c,0x041a043a,0x03d703fb,0x039703bf,0x0362037c,
-0x032e0345,0x02fc0316,0x02e502ed,0x02d502db,0x02d802d1,0x02e002d9,0x02fc02eb,0x032e0316,
-0x03640341,0x03b20385,0x040103db,0x04510428,0x04a3047f,0x04ee04cd,0x0521050d,0x053f0532,
-0x053a0546,0x05080524,0x04b404e2,0x04360475,0x039903f1,0x02d00340,0x01f20265,0x0101017a,
-0x00050082,0xff06ff84,0xfe04fe82,0xfd14fd89,0xfc39fca0,0xfb6efbd1,0xfabcfb0e,0xfa28fa6c,
-0xf9b1f9e2,0xf95cf97f,0xf91df936,0xf8edf907,0xf8e0f8e7,0xf8ebf8e2,0xf90af8f6,0xf937f91d,
-0xf969f94c,0xf9b5f994,0xf9fbf9da,0xfa41fa2a,0xfa81fa61,0xfac0faa5,0xfae9fad7,0xfb06faf3,
-0xfb18fb09,0xfb0efb13,0xfafbfb04,0xfad8fae6,0xfab5fac8,0xfa84fa99,0xfa59fa6a,0xfa2ffa42,
-0xfa09fa18,0xf9eff9f7,0xf9d6f9dd,0xf9c5f9ce,0xf9c4f9c2,0xf9bff9c4,0xf9bff9c7,0xf9c6f9c5,
-0xf9cbf9c9,0xf9cbf9c6,0xf9bdf9c6,0xf9c1f9bb,0xf9c1f9c4,0xf9cef9cb,0xf9d8f9d3,0xf9eef9e3,
-0xfa0df9f7,0xfa33fa19,0xfa62fa42,0xfa9bfa77,0xfadffab2,0xfb21fafa,0xfb78fb51,0xfbc9fba2,
-0xfc1bfbf4,0xfc76fc48,0xfccbfc9c,0xfd25fcf7,0xfd86fd56,0xfdeefdba,0xfe56fe21,0xfecafe8c,
-0xff45ff07,0xffb3ff7d,0x002dfff2,0x00a8006b,0x011800e0,0x01830150,0x01e701ba,0x023e020e,
-0x028a0266,0x02c802a8,0x02ed02e4,0x031202fe,0x0320031b,0x032b0325,0x033a0335,0x033e033a,
-0x034e0344,0x0367035b,0x039c0381,0x03e703c1,0x043c040c,0x04a1046b,0x051604da,0x05940553,
-0x060705ce,0x06750641,0x06d506a5,0x071706f5,0x07460737,0x075f0757,0x0761076b,0x07450753,
-0x0730073e,0x06fb0713,0x06d606e6,0x06b006c3,0x069906a2,0x06920697,0x06a00691,0x06c006ac,
-0x06e706d0,0x072706fb,0x076e0742,0x07bf0789,0x081007e5,0x085e083b,0x08a9088a,0x08ea08d7,
-0x091f090f,0x094d0942,0x096a0964,0x09760976,0x097b097e,0x09780978,0x0966096e,0x0952095e,
-0x0939093f,0x090d0925,0x08dd08f4,0x089e08c0,0x0856087c,0x07f8082f,0x077907bb,0x06ea0738,
-0x06470698,0x059005ea,0x04b50520,0x03c6043b,0x02d2034e,0x01d50257,0x00d30156,0xffd50056,
-0xfedfff65,0xfdfafe6d,0xfd2afd92,0xfc57fcbd,0xfbabfbff,0xfb10fb5c,0xfa93facf,0xfa2bfa5b,
-0xf9dff9ff,0xf9a6f9c1,0xf984f999,0xf981f982,0xf98ef986,0xf9b4f99c,0xf9e3f9c8,0xfa2ffa0a,
-0xfa86fa5b,0xfaebfabb,0xfb58fb21,0xfbc9fb91,0xfc40fc01,0xfca7fc6d,0xfd0bfcd9,0xfd5ffd30,
-0xfda2fd7d,0xfdd1fdb8,0xfdf6fde5,0xfe0afdfb,0xfe0bfe06,0xfe02fe00,0xfde5fdf5,0xfdc4fdd3,
-0xfd9efdae,0xfd74fd8e,0xfd4cfd64,0xfd23fd45,0xfd05fd1b,0xfce0fcf1,0xfcc1fcd3,0xfc9ffcb0,
-0xfc83fc8c,0xfc4dfc62,0xfc1ffc30,0xfbe0fbf9,0xfb8dfbb7,0xfb36fb65,0xfacdfaff,0xfa5cfa98,
-0xf9e2fa20,0xf967f9a6,0xf8e6f91c,0xf871f8a6,0xf7fef833,0xf794f7ca,0xf72ff764,0xf6dcf706,
-0xf698f6c0,0xf660f67b,0xf631f644,0xf60ff621,0xf5fff604,0xf5fbf5fa,0xf603f5f7,0xf621f613,
-0xf658f637,0xf6a1f677,0xf6fbf6c8,0xf76cf735,0xf7edf7a8,0xf878f831,0xf911f8c9,0xf9b0f963,
-0xfa51fa01,0xfae5fa99,0xfb6ffb2d,0xfbf7fbb8,0xfc6bfc33,0xfcd5fca6,0xfd2ffd04,0xfd7afd5f,
-0xfdbffda3,0xfe04fddd,0xfe45fe23,0xfe83fe65,0xfec8fea4,0xff0afee6,0xff60ff32,0xffc1ff87,
-0x0021ffec,0x008b0052,0x00fa00bc,0x0167012c,0x01be0190,0x021d01ed,0x026b024a,0x02a5028b,
-0x02d102b7,0x02ed02dd,0x02f902f1,0x02ec02ef,0x02d702dc,0x02bd02cb,0x02a602b2,0x028a0292,
-0x027a0287,0x027a027f,0x0287027f,0x02a00290,0x02cc02ba,0x030b02ed,0x03530333,0x03ad0380,
-0x040b03e0,0x047d0442,0x04e204b1,0x054f051e,0x05bc0585,0x062605ef,0x06970662,0x06ee06c1,
-0x0749071c,0x079a0777,0x07de07c4,0x081d0800,0x0848082e,0x08680856,0x087b0874,0x0885087f,
-0x08890889,0x088b0887,0x087e0885,0x087e0884,0x08850885,0x08840887,0x0891088a,0x089a0898,
-0x08a508a4,0x08b208b4,0x08bf08bc,0x08c308c1,0x08ba08bf,0x08a708b0,0x08810896,0x08470865,
-0x07ed081e,0x078107b8,0x06ff074a,0x067006b8,0x05cd0622,0x05170573,0x046004ba,0x03a203fd,
-0x02dc0340,0x022c0285,0x017701cd,0x00cd0121,0x0043008a,0xffc50003,0xff62ff8d,0xff19ff3b,
-0xfeecfefd,0xfedbfee8,0xfee9fee5,0xff13feff,0xff45ff2c,0xff90ff68,0xffe8ffb4,0x00420012,
-0x009b006f,0x00f800c6,0x01360114,0x016c0158,0x019c018a,0x01af01ad,0x01b201b3,0x01a801af,
-0x0182019b,0x0154016e,0x011a012e,0x00d400f2,0x008b00ad,0x00340061,0xffe30008,0xff81ffb7,
-0xff14ff4f,0xfe9efed9,0xfe28fe67,0xfd96fde2,0xfd18fd5c,0xfc8bfcd2,0xfbf7fc46,0xfb69fbad,
-0xfad8fb1d,0xfa59fa94,0xf9d9fa14,0xf967f99b,0xf8fef933,0xf8aaf8d3,0xf86af887,0xf835f84d,
-0xf819f821,0xf807f80c,0xf800f7fc,0xf810f805,0xf820f81c,0xf83df831,0xf865f855,0xf890f883,
-0xf8b9f8a7,0xf8e2f8cf,0xf905f8f3,0xf91df910,0xf92bf923,0xf941f933,0xf944f945,0xf949f948,
-0xf94df94a,0xf951f94d,0xf95af94f,0xf967f957,0xf97ff975,0xf9acf998,0xf9e1f9c6,0xfa20fa03,
-0xfa6bfa45,0xfabcfa93,0xfb1afae9,0xfb7bfb49,0xfbe2fbaf,0xfc46fc0e,0xfca9fc78,0xfd09fcd6,
-0xfd68fd37,0xfdc0fd91,0xfe0bfde2,0xfe5afe35,0xfe98fe7d,0xfed7febe,0xff10fef8,0xff3eff2a,
-0xff69ff57,0xff8bff7a,0xffa3ff9b,0xffb1ffb6,0xffabffac,0xffa2ffab,0xff95ff9d,0xff79ff87,
-0xff5aff62,0xff3aff46,0xff1aff28,0xff03ff09,0xfef5fef6,0xff01fef4,0xff21ff0e,0xff58ff3a,
-0xffa9ff82,0x001affe3,0x00a0005a,0x013700e6,0x01e9018d,0x02a10240,0x036a030e,0x043b03d1,
-0x051004a3,0x05e10580,0x06af064c,0x077f071d,0x084b07e4,0x090308ac,0x09a00952,0x0a2909ea,
-0x0a960a63,0x0ae30ac8,0x0b060af7,0x0b110b0d,0x0af70b05,0x0abb0ada,0x0a6e0a95,0x0a000a3d,
-0x098809c7,0x0904094e,0x087b08c0,0x07e8082f,0x076307a4,0x06ca0714,0x063c067e,0x05aa05f3,
-0x05120559,0x047604c9,0x03de042f,0x03480397,0x02af02fc,0x0220026b,0x01a101e3,0x01300161,
-0x00ce00f9,0x008100a1,0x00550068,0x00430046,0x00480045,0x00620055,0x0091007a,0x00cf00b0,
-0x010b00ef,0x0155012d,0x018b0172,0x01c401a4,0x01dc01ce,0x01e001df,0x01d001d9,0x01a301b8,
-0x015a0181,0x0108012f,0x009b00d2,0x0019005a,0xff9bffe0,0xff11ff56,0xfe87fecc,0xfe11fe4e,
-0xfd9ffddc,0xfd3cfd6b,0xfce7fd0e,0xfc99fcbf,0xfc52fc76,0xfc14fc34,0xfbd9fbf9,0xfb99fbb3,
-0xfb5cfb75,0xfb16fb2f,0xfac8faee,0xfa83faa3,0xfa36fa5b,0xf9f6fa16,0xf9b2f9cf,0xf979f994,
-0xf93af957,0xf90ef922,0xf8eaf8fb,0xf8c7f8d3,0xf89ff8b4,0xf88cf894,0xf87bf887,0xf86cf872,
-0xf866f866,0xf872f86e,0xf87df871,0xf89bf88c,0xf8c8f8aa,0xf905f8e9,0xf952f926,0xf9b5f985,
-0xfa21f9f0,0xfaa6fa6a,0xfb2bfade,0xfbb6fb73,0xfc3cfbf9,0xfcc1fc7c,0xfd3efcf9,0xfda7fd77,
-0xfe12fde1,0xfe5efe3f,0xfea8fe88,0xfee0fece,0xff1bff03,0xff50ff38,0xff78ff65,0xff96ff89,
-0xffb3ff9f,0xffc3ffb2,0xffc8ffc6,0xffc4ffc2,0xffaeffb7,0xff9affa3,0xff6fff83,0xff3fff53,
-0xff11ff2e,0xfedbfefb,0xfeb9fed0,0xfea1feae,0xfe8cfe9b,0xfe93fe8e,0xfeabfe9e,0xfecffeba,
-0xff00feea,0xff42ff1f,0xff8aff67,0xffd3ffad,0x0016fff5,0x005a0039,0x009f0084,0x00dc00bd,
-0x011a00fb,0x01590137,0x019e0174,0x01e801b8,0x022f01fd,0x027b0249,0x02d402a2,0x033c0304,
-0x03a20371,0x040d03d9,0x047b0443,0x04eb04af,0x05530518,0x05ad0580,0x060d05d9,0x064b0636,
-0x067d0666,0x06ae0699,0x06cb06bb,0x06d706d6,0x06de06dc,0x06d406d8,0x06c306cd,0x06b706bf,
-0x06a406af,0x06980698,0x06880694,0x0672067f,0x06660671,0x0654065d,0x0643064a,0x0632063c,
-0x06270627,0x0610061a,0x05fa0602,0x05f305fc,0x05e905f5,0x05e505ea,0x05ee05ea,0x05f005e5,
-0x05f505f5,0x06050602,0x06040608,0x06050607,0x06020601,0x05ef05f3,0x05d605dc,0x05af05bc,
-0x05830597,0x05560568,0x0513052f,0x04de04fa,0x049e04b8,0x045c0479,0x041e043a,0x03e603fe,
-0x03aa03ca,0x036f038d,0x033b0353,0x02fb0315,0x02a302cf,0x0255027b,0x01fa0228,0x019401cb,
-0x013d0174,0x00d80113,0x0066009d,0x00000031,0xff86ffc6,0xff20ff54,0xfeb7fee5,0xfe47fe76,
-0xfddbfe11,0xfd77fda8,0xfd01fd3a,0xfc8afcca,0xfc11fc50,0xfb94fbda,0xfb1efb5a,0xfa9cfae1,
-0xfa15fa5b,0xf990f9dc,0xf91bf957,0xf8a8f8e0,0xf843f874,0xf7e7f816,0xf797f7ba,0xf753f770,
-0xf714f72d,0xf6dff6ef,0xf6bcf6c1,0xf69af6a2,0xf675f682,0xf660f666,0xf649f64d,0xf643f644,
-0xf642f63e,0xf643f641,0xf652f645,0xf66bf65c,0xf69df680,0xf6daf6b7,0xf72bf701,0xf78af75e,
-0xf7fef7c3,0xf877f832,0xf90df8b8,0xf996f952,0xfa34f9e9,0xfad6fa89,0xfb75fb2d,0xfc11fbbf,
-0xfca4fc5c,0xfd29fcea,0xfda1fd67,0xfe08fdd9,0xfe5afe37,0xfe9ffe7e,0xfecdfebc,0xfee1fede,
-0xfeedfee6,0xfee1fee6,0xfecffedb,0xfeb5fec5,0xfe8ffe9f,0xfe66fe7f,0xfe41fe55,0xfe1cfe30,
-0xfdf7fe06,0xfdd9fde6,0xfdc5fdcc,0xfdb4fdb9,0xfd9afda7,0xfd8efd95,0xfd80fd88,0xfd80fd82,
-0xfd7cfd7c,0xfd79fd7a,0xfd83fd7e,0xfd8efd81,0xfda5fd96,0xfdbffdb1,0xfdeafdd0,0xfe1cfe01,
-0xfe56fe3d,0xfe9cfe7a,0xfeddfebb,0xff28feff,0xff6fff48,0xffbaff8f,0x0002ffe6,0x004e002a,
-0x008d006b,0x00cc00b0,0x010c00f3,0x013f0125,0x016f0156,0x01910182,0x01b701a7,0x01d901c7,
-0x020301f2,0x022d0215,0x02480236,0x0278025d,0x029e0289,0x02db02b9,0x031a02f3,0x0369033b,
-0x03bc0392,0x042703f4,0x048a045e,0x050504c5,0x05750539,0x05e305ad,0x0654061b,0x06b70687,
-0x071506e9,0x075f0740,0x0797077b,0x07c807b6,0x07ea07dd,0x080607fc,0x0819080f,0x08150816,
-0x080a0814,0x0805080c,0x07f20801,0x07d807ec,0x07b707c8,0x079007a6,0x075a0776,0x07240737,
-0x06dd06f7,0x069906b8,0x064e0677,0x060a0629,0x05c405eb,0x059105ae,0x0563057d,0x053f0552,
-0x0527053a,0x0517051d,0x0515051a,0x050b0510,0x05020506,0x04fb04fe,0x04f104f5,0x04e004eb,
-0x04c904d9,0x04ae04bb,0x049304a3,0x046b0482,0x0449045c,0x0410042c,0x03db03fe,0x03a203c3,
-0x035d0380,0x03100335,0x02be02e2,0x0266028d,0x02080235,0x01a501d5,0x0138016d,0x00cf0105,
-0x0061009c,0xfff00027,0xff85ffbb,0xff19ff4d,0xfeaafee7,0xfe4cfe7b,0xfde2fe16,0xfd88fdb8,
-0xfd31fd5e,0xfcd7fd06,0xfc86fcac,0xfc3cfc5b,0xfbfefc18,0xfbbafbda,0xfb84fba4,0xfb53fb70,
-0xfb2cfb3c,0xfb0afb16,0xfaf5fafc,0xfad7fae5,0xfac4fac6,0xfaa9fab5,0xfa96faa1,0xfa7efa8d,
-0xfa66fa72,0xfa54fa5a,0xfa44fa4b,0xfa2cfa30,0xfa1efa27,0xfa23fa29,0xfa2dfa28,0xfa3afa30,
-0xfa5afa49,0xfa85fa6f,0xfaadfa8e,0xfadbfac0,0xfb0cfaf3,0xfb3cfb25,0xfb60fb53,0xfb88fb74,
-0xfba4fb9b,0xfbb8fbb4,0xfbcffbca,0xfbdcfbdd,0xfbd6fbda,0xfbd9fbdd,0xfbd6fbd9,0xfbc9fbcf,
-0xfbc0fbc1,0xfbbefbc9,0xfbb8fbb8,0xfbbdfbba,0xfbbafbb8,0xfbcafbc2,0xfbdafbcf,0xfbf0fbe0,
-0xfc0bfbfe,0xfc2ffc20,0xfc56fc43,0xfc88fc72,0xfcb7fc9a,0xfce9fcce,0xfd1cfd02,0xfd54fd3c,
-0xfd8afd72,0xfdc8fda5,0xfdedfddc,0xfe1bfe09,0xfe3dfe31,0xfe5ffe4b,0xfe6dfe66,0xfe7dfe7a,
-0xfe84fe80,0xfe91fe90,0xfe9dfe9d,0xfeb7feae,0xfeddfec5,0xff11fef2,0xff49ff29,0xff93ff6a,
-0xfff3ffbc,0x00530021,0x00cc008e,0x014d0109,0x01c20184,0x02420207,0x02bc028a,0x03300302,
-0x039e036b,0x03f603c6,0x043f0416,0x04700459,0x04960488,0x04a904a4,0x04a704a7,0x049804a0,
-0x047b048e,0x04520466,0x0426043c,0x03e7040c,0x03b203d2,0x037e0397,0x034a0363,0x031e0333,
-0x03050310,0x02f402f5,0x02ee02ec,0x02ee02e5,0x030202fa,0x03180309,0x03370325,0x03590348,
-0x0377036d,0x03990383,0x03a903a3,0x03bd03b0,0x03c603c5,0x03ca03cb,0x03ca03ca,0x03c903ca,
-0x03c803c3,0x03c403be,0x03c403c2,0x03c103bf,0x03c003c6,0x03ca03d0,0x03ce03cf,0x03c903cd,
-0x03be03c1,0x03b103b9,0x039603a3,0x036e037d,0x0335034f,0x02fe031b,0x02b002d4,0x02610281,
-0x020c0232,0x01b601e2,0x01620189,0x01070138,0x00b800de,0x0060008c,0x0005002f,0xffb6ffdb,
-0xff64ff8c,0xff11ff3c,0xfec9feef,0xfe85fea5,0xfe45fe62,0xfe15fe33,0xfdf0fe05,0xfdd9fde4,
-0xfdd2fdd3,0xfdd0fdd0,0xfde9fdd8,0xfdfffdf3,0xfe29fe19,0xfe4afe3e,0xfe71fe64,0xfe8dfe7f,
-0xfeadfe9c,0xfeb6feb9,0xfeb0feb7,0xfe9afea1,0xfe7efe8f,0xfe59fe6a,0xfe2dfe42,0xfdfffe14,
-0xfdc6fde1,0xfd98fdac,0xfd66fd7e,0xfd3afd51,0xfd10fd27,0xfcdcfcf6,0xfcb5fccf,0xfc86fca4,
-0xfc5bfc77,0xfc2bfc48,0xfbf0fc0b,0xfbb9fbd7,0xfb7afb9a,0xfb43fb63,0xfb0dfb22,0xfad3faef,
-0xfaa3faba,0xfa77fa8e,0xfa53fa67,0xfa40fa42,0xfa35fa39,0xfa33fa35,0xfa33fa2e,0xfa42fa3a,
-0xfa50fa4d,0xfa74fa61,0xfa98fa88,0xfac0faab,0xfaf8fad9,0xfb37fb10,0xfb7dfb50,0xfbc8fb9b,
-0xfc25fbf7,0xfc7cfc4c,0xfcebfcb0,0xfd60fd27,0xfdddfda7,0xfe5ffe1f,0xfedefe97,0xff5eff19,
-0xffe4ffa5,0x005c0020,0x00d50098,0x013f010d,0x01a20170,0x01fb01cc,0x024a0226,0x0294026e,
-0x02cd02b6,0x030c02f4,0x03440330,0x03810364,0x03b10397,0x03d903c6,0x03fc03f1,0x0419040a,
-0x0428041f,0x0434042e,0x043c043a,0x04320437,0x04360434,0x0429042c,0x041e041e,0x040b0413,
-0x03f00402,0x03ed03f4,0x03db03eb,0x03d503dd,0x03d803d3,0x03cd03cc,0x03ce03c7,0x03cd03d0,
-0x03dd03d5,0x03e003dd,0x03f803f2,0x03f303fc,0x04050406,0x04100415,0x0419041b,0x04270429,
-0x0426042a,0x042b042f,0x042b042a,0x0432042e,0x043a042f,0x043e0438,0x0442043d,0x043f043f,
-0x0451044c,0x04560453,0x0463045d,0x0466045f,0x046e0467,0x0472046b,0x046e046e,0x046e046f,
-0x046a046d,0x045e046c,0x044d0459,0x043d0447,0x04250433,0x040e0419,0x03f40402,0x03d703ed,
-0x03bb03cd,0x039d03ad,0x037b038b,0x034b0362,0x0313032e,0x02d402f5,0x029502b4,0x02470272,
-0x01ec0217,0x018e01b8,0x012a0154,0x00c400f8,0x00640099,0xffff0034,0xffacffd4,0xff4eff7d,
-0xfefcff28,0xfeb6fed5,0xfe71fe93,0xfe3afe53,0xfe08fe21,0xfdddfdf2,0xfdb3fdcb,0xfd90fda0,
-0xfd6cfd7f,0xfd55fd5b,0xfd42fd45,0xfd2afd33,0xfd15fd1f,0xfd05fd11,0xfcf8fd00,0xfcebfcf4,
-0xfce2fcee,0xfccdfcd8,0xfcb9fcca,0xfcacfcb9,0xfc9bfca5,0xfc77fc88,0xfc5cfc66,0xfc3afc4d,
-0xfc05fc23,0xfbe1fbf7,0xfbabfbc6,0xfb75fb92,0xfb40fb59,0xfb00fb1a,0xfac6fae6,0xfa81faa7,
-0xfa3ffa62,0xfa06fa26,0xf9d7f9f2,0xf9a1f9ba,0xf97df987,0xf95af968,0xf94df94e,0xf940f944,
-0xf940f93c,0xf946f938,0xf955f949,0xf95ff956,0xf96ef968,0xf97ff972,0xf98ef984,0xf992f98b,
-0xf99af999,0xf99df99c,0xf9a0f99f,0xf9a8f9a5,0xf9a9f9a5,0xf9bbf9ae,0xf9c2f9be,0xf9ddf9d2,
-0xf9fff9f0,0xfa2bfa1a,0xfa59fa3f,0xfa8cfa6f,0xfac5faad,0xfafdfadf,0xfb31fb10,0xfb64fb4e,
-0xfb9bfb7e,0xfbcbfbb5,0xfbfdfbde,0xfc39fc1b,0xfc6ffc48,0xfcb5fc8f,0xfcfafcd5,0xfd4ffd21,
-0xfdb2fd80,0xfe18fddc,0xfe8cfe4b,0xfefffec2,0xff76ff3a,0xffefffbc,0x006c0035,0x00e500ae,
-0x01570124,0x01b8018a,0x021f01ef,0x0277024b,0x02d202a3,0x031b0302,0x036a034c,0x03b10394,
-0x03f303d6,0x04340419,0x046f044e,0x04a8048b,0x04df04c0,0x04fd04e8,0x051e050a,0x053b052d,
-0x0557054d,0x05630562,0x05750572,0x05810580,0x0584057f,0x05920587,0x059b0592,0x05a0059f,
-0x05b305a7,0x05c705c1,0x05d205c4,0x05e005d7,0x05fa05ea,0x06100606,0x0630061e,0x06520638,
-0x06780661,0x06910687,0x06ac069c,0x06c206bb,0x06d306ce,0x06d206d4,0x06c406d0,0x06ab06b7,
-0x067b0692,0x063f0659,0x05f3061d,0x059a05c5,0x053d0572,0x04ef051d,0x04a504cc,0x046b048f,
-0x04410454,0x04300436,0x04280426,0x04270429,0x043b0434,0x044d043f,0x04590454,0x04660461,
-0x04600463,0x044d0457,0x042b0444,0x03f50414,0x03b003d1,0x035a0387,0x03090336,0x02b702e2,
-0x02640288,0x0215023e,0x01d001ec,0x019101b2,0x015e0173,0x012c0142,0x00fb0112,0x00ce00e2,
-0x009600ab,0x005a0078,0x001b0038,0xffcbfff1,0xff72ff9e,0xff0bff3e,0xfeacfee0,0xfe4cfe85,
-0xfdeefe22,0xfda0fdc2,0xfd65fd7c,0xfd29fd40,0xfd08fd14,0xfd02fd02,0xfd17fd0c,0xfd40fd2f,
-0xfd82fd5e,0xfdc7fda0,0xfe16fdec,0xfe63fe3f,0xfea1fe83,0xfed8fec2,0xfefffef6,0xff0aff0d,
-0xff03ff07,0xfedffef2,0xfe9dfeb9,0xfe4dfe77,0xfde9fe16,0xfd81fdb3,0xfd0efd44,0xfc8efcce,
-0xfc12fc4f,0xfba0fbd4,0xfb39fb6d,0xfaddfb0c,0xfa93fabb,0xfa56fa7b,0xfa37fa49,0xfa22fa2d,
-0xfa24fa25,0xfa30fa2a,0xfa49fa3f,0xfa78fa5c,0xfaa7fa91,0xfad7fab9,0xfb11faf4,0xfb4ffb2e,
-0xfb81fb6b,0xfbb4fb96,0xfbe0fbc6,0xfc0afbf6,0xfc38fc1b,0xfc63fc4c,0xfc89fc75,0xfcbbfc9f,
-0xfcf0fcd6,0xfd2afd15,0xfd6ffd50,0xfdb2fd94,0xfe01fdda,0xfe48fe22,0xfe8afe6e,0xfecafeb2,
-0xfefcfee8,0xff2bff17,0xff3eff38,0xff56ff4b,0xff4fff51,0xff46ff46,0xff2dff33,0xff13ff16,
-0xfeeeff00,0xfec0fecf,0xfe9afea8,0xfe6cfe86,0xfe43fe57,0xfe21fe33,0xfdfcfe0f,0xfdddfdf3,
-0xfdd2fddf,0xfdc7fdd1,0xfdc4fdc9,0xfdccfdc9,0xfde1fddb,0xfdfffdf5,0xfe26fe1a,0xfe58fe48,
-0xfe9bfe7e,0xfed8febc,0xff2bff02,0xff82ff5a,0xffd7ffad,0x003e000e,0x0096006d,0x00fc00ce,
-0x0162012e,0x01c80197,0x022001f1,0x02710249,0x02be0293,0x02f802da,0x032a0311,0x0350033c,
-0x03660360,0x03730370,0x037c037a,0x037e037c,0x03780378,0x0377036f,0x03830375,0x03870379,
-0x03940384,0x03aa0396,0x03ce03be,0x03ea03da,0x04120404,0x043a042c,0x04640450,0x04820474,
-0x049e0492,0x04b204a6,0x04bf04b8,0x04bb04bd,0x04b204b7,0x049d04aa,0x047d0491,0x04520468,
-0x041c043b,0x03d30402,0x037703b0,0x03170349,0x02ad02e8,0x0237026f,0x01bf01fa,0x0142017a,
-0x00ca0100,0x0061008d,0x0000002f,0xffadffd4,0xff7bff92,0xff51ff64,0xff4aff46,0xff51ff4a,
-0xff5cff55,0xff86ff71,0xffa3ff97,0xffc4ffb9,0xffebffdd,0xfffefffc,0x0009000e,0x000b0018,
-0xfffc000f,0xffeafff8,0xffcdffdc,0xffabffbc,0xff8dff9e,0xff5aff70,0xff3dff50,0xff1bff2b,
-0xfef7ff09,0xfed1fee4,0xfea1feb6,0xfe6dfe89,0xfe41fe59,0xfdfefe24,0xfdc2fde6,0xfd82fda5,
-0xfd48fd62,0xfd13fd29,0xfcdefcf6,0xfcb8fcc0,0xfc98fc9d,0xfc83fc85,0xfc70fc71,0xfc62fc61,
-0xfc5ffc5e,0xfc66fc5f,0xfc66fc67,0xfc73fc6d,0xfc80fc7b,0xfc8ffc84,0xfcaafc9f,0xfcc1fcb3,
-0xfceefcd8,0xfd21fd05,0xfd64fd3f,0xfda4fd85,0xfdecfdc9,0xfe35fe15,0xfe7cfe56,0xfec5fea2,
-0xfefefedf,0xff2dff11,0xff4dff37,0xff65ff60,0xff79ff76,0xff85ff87,0xff95ff91,0xff9cff99,
-0xffa6ffa1,0xffb8ffaa,0xffcdffbe,0xffd5ffd0,0xffe0ffd7,0xffeaffea,0xffe6ffe8,0xffdeffe3,
-0xffcbffda,0xffaaffbc,0xff82ff99,0xff54ff6b,0xff23ff3c,0xfef1ff08,0xfec3feda,0xfe9cfeaf,
-0xfe8afe93,0xfe7efe81,0xfe81fe76,0xfe8ffe7f,0xfea1fe90,0xfebbfeaa,0xfedcfec8,0xfef6fee3,
-0xff10ff00,0xff2fff21,0xff52ff3f,0xff78ff67,0xffa0ff8d,0xffd0ffb7,0x000effec,0x00510030,
-0x009c0078,0x00f000c6,0x01510120,0x01b40183,0x021901e5,0x0280024a,0x02ee02b7,0x0345031c,
-0x03a00370,0x03eb03c0,0x042d0409,0x046b044d,0x04970489,0x04c504b5,0x04ee04dd,0x051204fd,
-0x052c051e,0x05380534,0x0546053c,0x054a0547,0x0552054d,0x054c054b,0x05470547,0x052b053c,
-0x051a0528,0x050c0518,0x04ff050b,0x04f004fd,0x04e304e6,0x04dc04e1,0x04d504d4,0x04d204d2,
-0x04d004d3,0x04ca04cc,0x04cc04c9,0x04b904c1,0x04a304af,0x04860495,0x04640476,0x0438044c,
-0x04050420,0x03d803f0,0x03a603bc,0x0379038d,0x0347035e,0x03180336,0x02e30305,0x02b602cf,
-0x028902a2,0x02480266,0x02040220,0x01ba01dc,0x0173018e,0x01200147,0x00c800f0,0x006c0099,
-0x0019003f,0xffc6fff0,0xff79ffa1,0xff35ff5e,0xfefeff1a,0xfec0fedc,0xfe95fead,0xfe5efe7a,
-0xfe2dfe45,0xfe08fe1a,0xfdd8fdf0,0xfda5fdb6,0xfd76fd8d,0xfd36fd53,0xfd06fd26,0xfcd2fce7,
-0xfc99fcb4,0xfc6dfc82,0xfc3afc50,0xfc0bfc2a,0xfbe4fbfb,0xfbbffbd0,0xfb96fba7,0xfb70fb87,
-0xfb3ffb5b,0xfb11fb2c,0xfae4fafe,0xfaaefacb,0xfa85fa9e,0xfa5dfa71,0xfa35fa46,0xfa1afa22,
-0xfa02fa0c,0xf9f7f9fc,0xf9f8f9f2,0xf9fef9f1,0xfa10fa04,0xfa1ffa0f,0xfa34fa2a,0xfa4efa42,
-0xfa71fa61,0xfa88fa79,0xfaaafaa0,0xfabbfab2,0xfad6facc,0xfaf6fae4,0xfb16fb04,0xfb34fb25,
-0xfb5afb43,0xfb81fb6b,0xfba8fb95,0xfbe3fbc9,0xfc25fc06,0xfc62fc46,0xfca3fc83,0xfce4fcc6,
-0xfd1dfd00,0xfd50fd34,0xfd71fd5a,0xfd79fd76,0xfd81fd77,0xfd70fd76,0xfd56fd60,0xfd33fd42,
-0xfd09fd20,0xfce0fcf7,0xfcbffccc,0xfc9bfcaa,0xfc8ffc8e,0xfc91fc8f,0xfc94fc8c,0xfca7fc9e,
-0xfccbfcbf,0xfceefce1,0xfd1efd05,0xfd44fd32,0xfd6efd52,0xfd96fd82,0xfdbbfda4,0xfddefdcd,
-0xfe08fdf4,0xfe3bfe25,0xfe7bfe5f,0xfec3fea2,0xff20fef2,0xff88ff57,0xfff8ffc1,0x007b0043,
-0x00fe00c2,0x01860146,0x020001ca,0x02730241,0x02d602a3,0x031802f8,0x034b032d,0x035d0358,
-0x0365035c,0x03600361,0x03470354,0x032e033b,0x031a031e,0x030e0316,0x03120314,0x0322031e,
-0x03440336,0x037e0363,0x03bd039c,0x041103e0,0x045a0432,0x04ac0481,0x04fa04d2,0x053c051d,
-0x057f0565,0x05ac059b,0x05e005c9,0x05fb05eb,0x06160607,0x06310624,0x063f0639,0x0661064c,
-0x06720668,0x068c0680,0x0698068f,0x069c069b,0x0698069c,0x0698069f,0x0691069d,0x067e068b,
-0x06590670,0x063b064d,0x0607061e,0x05d605ed,0x059b05b8,0x0564057c,0x052b0547,0x05020516,
-0x04d204ec,0x04a904c3,0x048a04a5,0x04660477,0x044e045a,0x04280437,0x04020411,0x03d603ea,
-0x03a603b8,0x03700385,0x032a0348,0x02df0300,0x029002b4,0x02480271,0x01fb0225,0x01af01db,
-0x017a019b,0x01410166,0x010e0130,0x00e70100,0x00ca00d7,0x00a300b6,0x008b0091,0x006c0077,
-0x004d005c,0x00260034,0x0002001a,0xffc9ffe4,0xff91ffab,0xff4dff6e,0xff08ff23,0xfec0feef,
-0xfe6bfe9a,0xfe1afe48,0xfdd3fdf6,0xfd98fdbd,0xfd56fd7b,0xfd29fd45,0xfd09fd1d,0xfcfcfd02,
-0xfcebfced,0xfcecfced,0xfceefcee,0xfcf6fcf4,0xfd0afcff,0xfd0ffd09,0xfd15fd0c,0xfd12fd11,
-0xfd03fd0c,0xfd00fd08,0xfce6fcf4,0xfccbfcd7,0xfcaafcbe,0xfc84fc99,0xfc54fc74,0xfc2bfc46,
-0xfbfdfc1b,0xfbcefbe8,0xfba7fbbc,0xfb89fb99,0xfb6ffb7c,0xfb60fb63,0xfb5dfb5e,0xfb6afb61,
-0xfb78fb6d,0xfb92fb81,0xfbbcfba9,0xfbe3fbd0,0xfc18fc04,0xfc55fc33,0xfc87fc6c,0xfcbcfca1,
-0xfcf2fcd8,0xfd20fd0b,0xfd3ffd31,0xfd51fd48,0xfd5efd59,0xfd61fd5c,0xfd52fd55,0xfd37fd3e,
-0xfd11fd29,0xfceafcfc,0xfccdfce0,0xfcacfcbe,0xfc94fc9b,0xfc7cfc85,0xfc7efc79,0xfc8afc7b,
-0xfca5fc97,0xfcc2fcb5,0xfd09fce5,0xfd48fd1e,0xfd8afd6b,0xfdd6fdb0,0xfe30fe06,0xfe7ffe55,
-0xfecdfeaf,0xff22fefc,0xff6fff4f,0xffc8ff9f,0x000effee,0x00660039,0x00af008b,0x010600d8,
-0x01560132,0x0199017a,0x01e701bd,0x02210207,0x025a0240,0x02840270,0x029d0290,0x02a602a7,
-0x02a302aa,0x0293029c,0x027f0288,0x025d026c,0x022e0242,0x0207021a,0x01e201f9,0x01c701d2,
-0x01ae01b6,0x019b01a3,0x01920193,0x01920189,0x0197018b,0x019c018f,0x019c0194,0x01a7019d,
-0x01ad01a5,0x01ac01a7,0x01a401ad,0x019a01a1,0x01850198,0x0170017f,0x015f016f,0x01450153,
-0x012d013c,0x011b0121,0x01090115,0x010500ff,0x010f00ff,0x0111010a,0x0131011c,0x0153013d,
-0x0181016b,0x01ac0196,0x01da01c3,0x01fe01f3,0x02270217,0x02410230,0x0250024d,0x02480251,
-0x02350241,0x02280232,0x02050215,0x01e201ed,0x01ba01d3,0x019d01a9,0x01870194,0x01770179,
-0x01700174,0x01740170,0x018f0181,0x01a70198,0x01c801b6,0x01e901d6,0x020201f3,0x0215020a,
-0x021a0211,0x020d020d,0x01f801fd,0x01cc01e0,0x019901b2,0x01500174,0x0105012b,0x00ad00da,
-0x0048007c,0xffe2001b,0xff80ffb8,0xff1eff4f,0xfebdfeed,0xfe55fe89,0xfdfffe2a,0xfdacfdd2,
-0xfd5ffd86,0xfd2afd41,0xfcf6fd0a,0xfcd5fce4,0xfcb3fcc8,0xfcadfcb3,0xfca5fcae,0xfca4fcad,
-0xfcb9fcb3,0xfccbfcca,0xfce2fcde,0xfcfafcf6,0xfd1ffd10,0xfd39fd30,0xfd47fd3e,0xfd67fd54,
-0xfd83fd72,0xfd9afd88,0xfdb5fd9e,0xfdcbfdb9,0xfdf6fde2,0xfe0cfdfd,0xfe2afe1a,0xfe40fe32,
-0xfe4cfe4c,0xfe53fe5a,0xfe5cfe60,0xfe4cfe5c,0xfe30fe44,0xfe0bfe29,0xfde6fdfc,0xfdb8fdd0,
-0xfd84fd9e,0xfd56fd68,0xfd35fd44,0xfd0dfd24,0xfcfafcfd,0xfcf2fcf4,0xfcf5fceb,0xfcfdfcfc,
-0xfd14fd05,0xfd32fd26,0xfd56fd41,0xfd7efd6f,0xfdb7fd9e,0xfdecfdd3,0xfe29fe08,0xfe6dfe47,
-0xfebdfe93,0xff08fedc,0xff67ff33,0xffb8ff92,0x001bffe9,0x0079004b,0x00e200ae,0x013c0109,
-0x01a10169,0x01ee01c9,0x023e0218,0x02860266,0x02c502a3,0x030902e6,0x0334031f,0x036d035d,
-0x03a9038f,0x03d903bd,0x040503ea,0x042a0419,0x044b0443,0x0468045f,0x047a0472,0x048a0485,
-0x047f0484,0x046d047a,0x04570462,0x04360443,0x0415042c,0x03f00403,0x03d303e0,0x03bc03c9,
-0x03a603b1,0x03a003a1,0x03a20398,0x03a903a9,0x03b803b1,0x03d203c4,0x03eb03df,0x040503fa,
-0x041f0413,0x04350424,0x04410439,0x04410440,0x04360438,0x041c0428,0x03fa040e,0x03c603e2,
-0x038803a8,0x034d036a,0x02fa0326,0x02b602d9,0x026b0297,0x022c0245,0x01f2020d,0x01c601d6,
-0x01a101b0,0x018b0197,0x017a0181,0x017d017f,0x0181017b,0x018e018b,0x01970193,0x01a6019d,
-0x01ae01a8,0x01aa01a9,0x019a01a4,0x01840195,0x0167017a,0x013c0156,0x01180130,0x00dc0102,
-0x00af00cb,0x008600a4,0x00620076,0x003d004a,0x0025002d,0x0008000f,0xffedfff4,0xffd5ffde,
-0xffb9ffc7,0xffabffb5,0xff88ff9b,0xff74ff80,0xff5aff66,0xff3dff45,0xff27ff33,0xff18ff21,
-0xff04ff12,0xfefbff00,0xfeecfef5,0xfeddfee7,0xfec0fed3,0xfea4feb5,0xfe7cfe94,0xfe42fe60,
-0xfe03fe21,0xfda6fdd7,0xfd49fd7b,0xfce0fd14,0xfc6ffca6,0xfbfffc36,0xfb97fbc6,0xfb36fb66,
-0xfae5fb0c,0xfaa5fac6,0xfa79fa8b,0xfa53fa62,0xfa37fa3b,0xfa27fa2d,0xfa15fa21,0xfa11fa0f,
-0xfa09fa0c,0xf9f5f9f4,0xf9e6f9e6,0xf9d5f9dd,0xf9c6f9cc,0xf9b6f9c5,0xf9a8f9b2,0xf9a8f9ad,
-0xf9aef9aa,0xf9b9f9b7,0xf9cbf9c2,0xf9e9f9d9,0xfa04f9f5,0xfa1dfa0f,0xfa45fa2a,0xfa5efa55,
-0xfa7bfa62,0xfa9dfa88,0xfab9faa1,0xfae0fac1,0xfb04faeb,0xfb27fb10,0xfb5bfb40,0xfb9afb75,
-0xfbe5fbc6,0xfc31fc02,0xfc92fc61,0xfcf3fcc4,0xfd5efd25,0xfdc7fd95,0xfe38fe04,0xfea4fe6d,
-0xfefffed2,0xff5dff32,0xffa9ff83,0xffe6ffc8,0x001e0006,0x00460032,0x006b0059,0x007d0070,
-0x008d0080,0x0091008d,0x009a0092,0x00950095,0x009f0093,0x00a4009b,0x009f009a,0x009c00a1,
-0x00a800a0,0x00a200a5,0x009d009f,0x0096009a,0x008a0092,0x00840084,0x00870083,0x008b0081,
-0x00950096,0x00a2009e,0x00c400b8,0x00f000de,0x0128010f,0x016c014c,0x01b30195,0x021101e7,
-0x026e0241,0x02cf029f,0x032c02fa,0x03770351,0x03c503a3,0x03ff03e2,0x0439041d,0x04650449,
-0x04860472,0x04a00491,0x04b004ac,0x04c104ba,0x04cf04c8,0x04dc04da,0x04e004e4,0x04eb04e7,
-0x04f904f3,0x04ff04f8,0x05010502,0x05030508,0x05030502,0x050004f9,0x04ea04f2,0x04ed04e5,
-0x04d704e0,0x04c104c9,0x04b404bd,0x04a404ab,0x048c0496,0x04830489,0x047b0480,0x0481047d,
-0x04840480,0x0490048c,0x049a0495,0x04a804a1,0x04b704b0,0x04be04bc,0x04bd04bf,0x04b004ba,
-0x049e04a8,0x047e048f,0x04570466,0x0420043e,0x03e40401,0x03ab03ca,0x03740391,0x033d035a,
-0x0307031b,0x02dc02f1,0x02bc02d3,0x02a902b4,0x029802a6,0x0286028c,0x027c0284,0x026b0271,
-0x0258025f,0x0238024b,0x021d0228,0x01ee0202,0x01be01d2,0x01740195,0x012a014a,0x00d30104,
-0x007f00aa,0x00280052,0xffc7fff1,0xff71ff96,0xff1cff3a,0xfebcfee3,0xfe6bfe8d,0xfe26fe3d,
-0xfdd5fdf9,0xfd90fdb2,0xfd4efd6d,0xfd13fd31,0xfce6fcfd,0xfcb1fcd5,0xfc9afcaf,0xfc7ffc8f,
-0xfc6dfc75,0xfc64fc67,0xfc62fc62,0xfc62fc5e,0xfc66fc62,0xfc70fc6d,0xfc6dfc6f,0xfc6afc6d,
-0xfc5dfc60,0xfc4efc50,0xfc3efc43,0xfc22fc2d,0xfbfdfc0e,0xfbdefbea,0xfbc0fbd3,0xfbb6fbbd,
-0xfba9fbac,0xfbacfb9f,0xfbabfbac,0xfbbafbbc,0xfbd7fbce,0xfbfdfbe8,0xfc26fc0d,0xfc54fc3c,
-0xfc82fc6c,0xfca9fc95,0xfcdffcc2,0xfd10fcf6,0xfd3efd23,0xfd5ffd4b,0xfd84fd6c,0xfda4fd98,
-0xfdc4fdb6,0xfddffdd0,0xfdf1fde4,0xfe00fdf9,0xfe05fe02,0xfdfefe07,0xfdf3fdff,0xfde2fdf1,
-0xfdc9fdd6,0xfda3fdb4,0xfd81fd93,0xfd57fd6c,0xfd3afd45,0xfd1bfd25,0xfd09fd0e,0xfcf6fcf9,
-0xfcf4fcf7,0xfd0efcff,0xfd2cfd1a,0xfd5cfd47,0xfd9dfd7c,0xfde2fdc0,0xfe2cfe05,0xfe84fe5b,
-0xfed4feae,0xff2dfeff,0xff79ff51,0xffb3ff8e,0xffe9ffd4,0x0015fffe,0x002e0021,0x003f0038,
-0x004d004c,0x00550056,0x005a0058,0x00640063,0x006f0069,0x00860074,0x009b008d,0x00b200a5,
-0x00da00c9,0x010100f0,0x012e011a,0x016d014d,0x019e0186,0x01c801b2,0x01f701e5,0x022b0212,
-0x02520242,0x026f0260,0x0292027f,0x02b702a4,0x02d302c2,0x02e702da,0x030402f2,0x03220318,
-0x033b032f,0x0357034a,0x0378036a,0x03920387,0x03b103a6,0x03d403c3,0x03f503e1,0x04190403,
-0x042f041b,0x044b0436,0x0457044e,0x0467045c,0x0468046b,0x0453045e,0x043c044f,0x04140431,
-0x03ec0400,0x03a803c8,0x03660389,0x0318033c,0x02c902ee,0x026d029b,0x021d0248,0x01ce01f3,
-0x018001aa,0x01390161,0x01000120,0x00c600de,0x008c00a4,0x005c0071,0x0027003d,0xffeb0000,
-0xffadffc6,0xff6aff8b,0xff28ff42,0xfee5ff03,0xfe96febd,0xfe51fe73,0xfe08fe29,0xfdc9fde5,
-0xfd84fdaa,0xfd4efd6c,0xfd2bfd3f,0xfd10fd1d,0xfcfdfd09,0xfcebfcf8,0xfcf6fcf0,0xfcfefcfa,
-0xfd17fd0f,0xfd39fd29,0xfd56fd42,0xfd73fd64,0xfd9afd8b,0xfdb6fda8,0xfdcefdc4,0xfdddfdda,
-0xfdecfdec,0xfde9fdf1,0xfde5fdec,0xfdd2fde1,0xfdc8fdcf,0xfda6fdb7,0xfd81fd8c,0xfd5ffd6f,
-0xfd3efd4f,0xfd1bfd21,0xfcfdfd0b,0xfcecfcf0,0xfce3fce5,0xfcdefce3,0xfcebfce1,0xfd02fcf3,
-0xfd28fd0d,0xfd54fd31,0xfd8cfd6a,0xfdcdfda2,0xfe10fde8,0xfe59fe32,0xfeacfe80,0xfef4fed6,
-0xff40ff1f,0xff87ff66,0xffb9ffa4,0xffe5ffcc,0x0009fff6,0x0018000f,0x001a001e,0x0012001e,
-0x00120017,0xfff90000,0xffd9ffe5,0xffc1ffc9,0xff9dffb6,0xff8bff96,0xff6fff81,0xff61ff67,
-0xff53ff5b,0xff54ff4f,0xff50ff51,0xff5dff52,0xff78ff63,0xff94ff82,0xffb9ff9e,0xffe2ffca,
-0x00190008,0x004d003a,0x0095007e,0x00d200b6,0x010b00eb,0x013e0122,0x0161014e,0x01860172,
-0x018f0181,0x019d0193,0x01920192,0x018e018e,0x0175017a,0x0168016b,0x015a015d,0x014e0153,
-0x01550150,0x0157014f,0x0166015d,0x0177016b,0x019b0187,0x01bf01aa,0x01e501cc,0x021401f8,
-0x02490230,0x0274025e,0x02a70292,0x02de02cc,0x031202fc,0x034a0332,0x03780365,0x03ba03a0,
-0x03f103d9,0x04310414,0x04620448,0x04a20487,0x04da04c2,0x050c04f0,0x053a0523,0x054f0544,
-0x0568055e,0x05740570,0x057a057a,0x05760577,0x0568056e,0x054f055c,0x053f0545,0x0522052e,
-0x05040516,0x04e504f5,0x04c204d6,0x049804ad,0x04660489,0x04400454,0x040e0428,0x03de03f4,
-0x03b003cd,0x0381039c,0x03500365,0x0322033e,0x02ec0309,0x02b902d5,0x028702a5,0x02500264,
-0x02040224,0x01c001e1,0x017d01a2,0x01410162,0x00ef0113,0x00a600cd,0x00630087,0x001d0040,
-0xffdbffff,0xff95ffba,0xff5aff78,0xff1cff3d,0xfee1fef9,0xfea8fec7,0xfe65fe88,0xfe28fe4d,
-0xfdeffe0e,0xfdacfdd0,0xfd63fd8b,0xfd20fd49,0xfcd5fcf9,0xfc89fcb4,0xfc43fc6c,0xfc05fc1f,
-0xfbd0fbe7,0xfb8dfba6,0xfb5dfb71,0xfb3ffb4a,0xfb12fb29,0xfaf3fb03,0xfae2faea,0xfadefade,
-0xfad7fadd,0xfad4fad5,0xfaddfadc,0xfaedfaeb,0xfafafafd,0xfb05fb05,0xfb18fb12,0xfb27fb1d,
-0xfb31fb2d,0xfb37fb2f,0xfb3efb38,0xfb4afb47,0xfb4afb4c,0xfb59fb4e,0xfb69fb5f,0xfb70fb68,
-0xfb7cfb7a,0xfb8dfb8a,0xfba7fb9c,0xfbbafbaf,0xfbcffbc4,0xfbd1fbcf,0xfbddfbd8,0xfbd5fbd9,
-0xfbc9fbcf,0xfbc2fbc6,0xfbacfbb5,0xfb9bfba4,0xfb93fb9b,0xfb8afb8f,0xfb8bfb8e,0xfb9afb8f,
-0xfba2fba1,0xfbcbfbba,0xfbf3fbdb,0xfc1dfc08,0xfc45fc30,0xfc75fc5d,0xfc9bfc87,0xfcc2fcac,
-0xfcdffccc,0xfcfdfced,0xfd21fd12,0xfd3ffd31,0xfd69fd54,0xfd8bfd78,0xfdc3fda8,0xfdfafddd,
-0xfe34fe1a,0xfe6efe59,0xfe9dfe8c,0xfed5fec3,0xff01feef,0xff26ff12,0xff43ff35,0xff53ff46,
-0xff55ff4f,0xff4fff53,0xff4fff50,0xff4bff46,0xff44ff43,0xff45ff41,0xff51ff4b,0xff6cff63,
-0xff8dff7e,0xffbbffac,0x0004ffe7,0x004d0031,0x00a1007c,0x010300d4,0x01650134,0x01d8019b,
-0x02380206,0x029f0266,0x02fc02cb,0x03520322,0x03a1037a,0x03e403bf,0x04260407,0x04620443,
-0x048b0478,0x04b904a2,0x04e304d5,0x050904fc,0x052e051e,0x054a053b,0x0562055b,0x05800570,
-0x058c0588,0x05960592,0x058e0596,0x05810584,0x056a057a,0x054e055a,0x052d0544,0x04ff051a,
-0x04e404f6,0x04c304d6,0x04aa04b7,0x0492049c,0x04930491,0x04900491,0x049d0490,0x04a5049c,
-0x04ae04a6,0x04bf04b7,0x04ca04c3,0x04cf04ce,0x04c504cf,0x04bc04c6,0x04b004bd,0x049e04a8,
-0x04810492,0x04620476,0x044b045b,0x042e043f,0x041a0422,0x04080414,0x03ef03fd,0x03df03e8,
-0x03ce03d8,0x03ad03bf,0x039303a2,0x036a037d,0x03320351,0x02ff0317,0x02b402dd,0x0264028f,
-0x020c0237,0x01be01e6,0x015e018b,0x01090129,0x00b600de,0x0075008b,0x003c0051,0x0016001e,
-0x00000005,0xfff7fff8,0xfff8fffa,0x0001fffc,0x0016000e,0x00360027,0x004d0041,0x005a0059,
-0x00600061,0x0054005a,0x003e0048,0x001a002c,0xffe6fffe,0xffa5ffc5,0xff61ff88,0xff10ff3e,
-0xfebefee4,0xfe6ffe97,0xfe17fe44,0xfdc7fdf2,0xfd78fd9c,0xfd31fd4b,0xfcf1fd11,0xfcb7fcd4,
-0xfc8bfca2,0xfc61fc73,0xfc3ffc52,0xfc22fc2c,0xfc0afc13,0xfbfffc0a,0xfbebfbf7,0xfbe4fbe7,
-0xfbdbfbe0,0xfbdafbda,0xfbcffbd3,0xfbcefbd2,0xfbc6fbd3,0xfbc9fbc0,0xfbc2fbbc,0xfbb3fbb0,
-0xfba9fbaa,0xfb9cfb9f,0xfb8ffb8f,0xfb84fb83,0xfb76fb77,0xfb67fb67,0xfb61fb64,0xfb5ffb62,
-0xfb60fb62,0xfb76fb72,0xfb84fb7b,0xfba2fb91,0xfbbefba9,0xfbedfbd5,0xfc15fbfe,0xfc4ffc2e,
-0xfc81fc67,0xfcbefca2,0xfcf8fcdd,0xfd34fd1c,0xfd76fd59,0xfdb5fd93,0xfdfafdd6,0xfe30fe12,
-0xfe70fe4c,0xfeabfe8b,0xfedffec6,0xff17fef5,0xff3fff28,0xff6aff58,0xff8aff7a,0xffa9ff9a,
-0xffbcffb4,0xffd2ffcb,0xffe3ffd6,0xfff7ffe8,0x0003ffff,0x0010000b,0x001f001e,0x003e0033,
-0x005a004b,0x006e005e,0x008d0079,0x00aa009e,0x00d500c0,0x010100e4,0x012c0111,0x01510143,
-0x0182016f,0x01a50197,0x01cf01bb,0x01f501e3,0x0215020b,0x02380228,0x025a024b,0x027e0266,
-0x028c0280,0x029f0292,0x02b002a9,0x02c302c0,0x02cf02c7,0x02d402d4,0x02d502d6,0x02de02db,
-0x02d202da,0x02c202cf,0x02ab02b9,0x029802a7,0x0271028a,0x024c025f,0x021f0232,0x01f7020a,
-0x01c901da,0x01a401b0,0x016f017f,0x014c015c,0x01290138,0x01050118,0x00eb00f7,0x00c900db,
-0x00b600c2,0x009f00ae,0x008c009a,0x007c0084,0x006c0079,0x0060006a,0x0059005b,0x004b0052,
-0x0044003e,0x0039003a,0x00390034,0x003f003b,0x004f0045,0x005d0055,0x006f005c,0x008b0078,
-0x00a40095,0x00c900b2,0x00e900d9,0x01130102,0x013e012b,0x016f015e,0x019b0186,0x01bd01aa,
-0x01d901cd,0x01ec01e6,0x01f501f6,0x01f001ee,0x01df01e8,0x01c501d1,0x019b01b0,0x0168017c,
-0x012a0148,0x00e40108,0x00b300ce,0x00770095,0x0047005e,0x0021002c,0xfff9fffd,0xffd6ffe3,
-0xffc0ffca,0xffa2ffad,0xff83ff93,0xff61ff6e,0xff30ff51,0xfefaff1e,0xfebcfee2,0xfe6efe9a,
-0xfe1efe4a,0xfdcafdf6,0xfd6bfd9a,0xfd0dfd3e,0xfcb1fce2,0xfc52fc85,0xfc09fc37,0xfbc1fbe9,
-0xfb7efba7,0xfb4afb6a,0xfb1cfb31,0xfaf7fb0d,0xfad3fae4,0xfabcfac3,0xfaaefab6,0xfaa3faa5,
-0xfaa8faa3,0xfab2faa9,0xfac2fab5,0xfae6fad4,0xfb0efafc,0xfb43fb29,0xfb90fb6c,0xfbd9fbb2,
-0xfc27fbfd,0xfc86fc54,0xfce3fcaf,0xfd36fd0f,0xfd99fd69,0xfdf2fdc5,0xfe4afe1a,0xfea0fe70,
-0xfeebfec0,0xff31ff0d,0xff70ff4c,0xffa8ff88,0xffe3ffc9,0x000dfffb,0x003f0026,0x006d005a,
-0x0092007f,0x00c000a4,0x00e600d6,0x010800fa,0x01350122,0x015d0152,0x018f0176,0x01c401aa,
-0x01f901dc,0x0231020f,0x026a0248,0x029e027f,0x02cf02b2,0x030702e6,0x03280313,0x03440335,
-0x03610354,0x036b036a,0x036a036c,0x035a036c,0x03460356,0x032d0342,0x030e031b,0x02e702f9,
-0x02bb02cb,0x029502a9,0x026c027d,0x0255025c,0x02450246,0x023d0241,0x0243023d,0x0257024a,
-0x027b0267,0x02a5028f,0x02df02c0,0x03200300,0x036a0345,0x03b70395,0x03fb03d9,0x04410419,
-0x04770460,0x04aa0494,0x04d204c4,0x04ee04e3,0x04fb04f4,0x04fd04fd,0x04f604f2,0x04dc04eb,
-0x04be04d1,0x049704a6,0x04680481,0x04320450,0x03fd0418,0x03c503e6,0x037f03a6,0x03410368,
-0x03080329,0x02cb02ed,0x029f02b5,0x026e0283,0x02470255,0x0227022d,0x021a0213,0x01fe01ff,
-0x01fa01f4,0x01eb01f7,0x01f301f6,0x02020202,0x02090212,0x0219021b,0x02280227,0x02300233,
-0x0239023a,0x0232022c,0x02210226,0x0208020c,0x01e501ed,0x01b201cc,0x017a0196,0x01320155,
-0x00ec010b,0x009b00c1,0x00410068,0xfff00016,0xff9dffbf,0xff4eff73,0xff0bff30,0xfed1fef2,
-0xfea2fec3,0xfe85fe9a,0xfe6bfe74,0xfe57fe61,0xfe54fe53,0xfe50fe4d,0xfe4cfe4c,0xfe44fe46,
-0xfe3ffe3b,0xfe27fe32,0xfe0ffe1b,0xfdeffe03,0xfdbefdda,0xfd83fda6,0xfd44fd65,0xfcf5fd1c,
-0xfc9dfcca,0xfc3cfc69,0xfbdefc0c,0xfb72fba8,0xfb0afb3a,0xfa99facb,0xfa2efa62,0xf9ccf9fe,
-0xf96cf9a2,0xf922f94a,0xf8def902,0xf8adf8c5,0xf88cf89a,0xf87ef88c,0xf879f87e,0xf88cf886,
-0xf89ff890,0xf8caf8b7,0xf8f2f8dc,0xf920f909,0xf954f938,0xf975f963,0xf999f98a,0xf9baf9ab,
-0xf9dcf9d3,0xf9f4f9eb,0xfa04fa02,0xfa1cfa12,0xfa36fa26,0xfa48fa3b,0xfa61fa50,0xfa86fa6d,
-0xfaaefa8c,0xfad8fac0,0xfb0ffaf4,0xfb4dfb2c,0xfb99fb73,0xfbe3fbbc,0xfc32fc03,0xfc81fc54,
-0xfcd4fca7,0xfd2cfd06,0xfd82fd5a,0xfdddfdb3,0xfe29fe00,0xfe7efe53,0xfec1fe9d,0xff02fee5,
-0xff30ff1c,0xff5dff45,0xff78ff6b,0xff94ff86,0xff96ff97,0xff98ff97,0xff92ff9d,0xff95ff96,
-0xff87ff8a,0xff75ff82,0xff83ff7b,0xff85ff82,0xff94ff8c,0xffb9ffa5,0xffdeffc9,0x0019fff4,
-0x00620036,0x00b7008a,0x011d00ea,0x018c0151,0x020401c7,0x027d0241,0x030002bf,0x0378033d,
-0x03ed03b6,0x04590429,0x04bb048c,0x051304e5,0x0562053a,0x058f0580,0x05b905a4,0x05dc05cd,
-0x05e605df,0x05ef05e1,0x05eb05e8,0x05da05df,0x05c705cb,0x05b805bc,0x05a405af,0x059205a5,
-0x058b059b,0x05870591,0x058f058c,0x0595058e,0x059a0594,0x05a70599,0x05b205a7,0x05b905ba,
-0x05c005bd,0x05bf05ba,0x05b005b5,0x05a505ae,0x05880596,0x05680575,0x053d054f,0x05180527,
-0x04e504fb,0x04b904ca,0x049b04a8,0x047a048e,0x046b046e,0x045f0467,0x045b0461,0x045e0457,
-0x045c0459,0x0462045e,0x045e045d,0x0452045c,0x043d044f,0x04160429,0x03e60402,0x03a703c5,
-0x03590385,0x030b032e,0x02b002e4,0x02580285,0x01ff022c,0x01ae01da,0x0168018e,0x0133014d,
-0x0102011c,0x00de00ed,0x00c100ca,0x00af00b8,0x009b00a3,0x007b008c,0x005e0075,0x003e004f,
-0x001c0036,0xfff1000a,0xffb9ffcf,0xff7aff9c,0xff3bff57,0xfefaff12,0xfeb5fed3,0xfe67fe89,
-0xfe2afe47,0xfdeafe07,0xfdaafdc6,0xfd5efd7c,0xfd11fd31,0xfcb9fce6,0xfc6afc94,0xfc19fc41,
-0xfbc5fbef,0xfb76fb9e,0xfb37fb53,0xfafffb1b,0xfad2faea,0xfac5fac9,0xfac5fabf,0xfae4fad7,
-0xfb02faf0,0xfb44fb25,0xfb89fb5f,0xfbdcfbb1,0xfc37fc09,0xfc8bfc57,0xfcd3fcb0,0xfd1afcf7,
-0xfd5dfd3f,0xfd95fd82,0xfdc1fda7,0xfdf4fddd,0xfe08fdfb,0xfe22fe16,0xfe41fe2f,0xfe54fe4a,
-0xfe66fe59,0xfe77fe6e,0xfe85fe81,0xfe8efe8d,0xfe8efe94,0xfe81fe86,0xfe70fe77,0xfe51fe62,
-0xfe24fe3e,0xfe00fe16,0xfddcfdeb,0xfda7fdc0,0xfd80fd8f,0xfd56fd6b,0xfd29fd3e,0xfd09fd1a,
-0xfceefd03,0xfcd5fce2,0xfcc8fcd6,0xfcc0fcc5,0xfcbefcc2,0xfcbefcc1,0xfcc0fcc5,0xfccffcca,
-0xfce9fcdb,0xfd08fcf3,0xfd30fd19,0xfd5cfd3e,0xfd91fd72,0xfdd1fdaa,0xfe1bfdef,0xfe61fe3d,
-0xfea7fe8a,0xfef2fed7,0xff37ff1d,0xff7bff5d,0xffb5ff9f,0xffe0ffc7,0x0000fff4,0x0011000b,
-0x001a001b,0x001d0028,0x001e0026,0x002c0028,0x00360034,0x004a003f,0x00680058,0x0091007c,
-0x00c200a0,0x00fa00d7,0x01390117,0x017c015c,0x01cc01a2,0x021501ec,0x024f022e,0x028f026e,
-0x02cb02a9,0x02f902dc,0x032b030c,0x0349033a,0x0372035b,0x038d037a,0x03a40393,0x03b603aa,
-0x03cd03c7,0x03d603d3,0x03ed03e4,0x03f603f1,0x03fb03fe,0x03fa03f9,0x03f403f5,0x03de03e8,
-0x03b603cb,0x039803aa,0x03680380,0x03370355,0x03040324,0x02d202e6,0x029d02b9,0x02760288,
-0x024e0260,0x0230023e,0x02180224,0x02060211,0x01f90200,0x01f001ee,0x01db01e9,0x01d201da,
-0x01c301d1,0x01a401b4,0x017d0196,0x01510168,0x0112012a,0x00cb00ed,0x007900a8,0x002a005a,
-0xffd8fff8,0xff82ffab,0xff30ff50,0xfeeeff08,0xfeaefec7,0xfe78fe96,0xfe4cfe5c,0xfe26fe36,
-0xfe05fe16,0xfde7fdec,0xfdcffddb,0xfdb7fdc1,0xfda3fdb1,0xfd89fda0,0xfd7ffd8c,0xfd70fd7c,
-0xfd70fd6e,0xfd66fd67,0xfd6ffd63,0xfd72fd6b,0xfd7efd72,0xfd8afd81,0xfda0fd9b,0xfdbdfdad,
-0xfddcfdcc,0xfdf7fde9,0xfe14fe07,0xfe32fe23,0xfe4cfe3e,0xfe66fe4c,0xfe7cfe67,0xfe99fe86,
-0xfeadfea6,0xfebefeb7,0xfed7fec8,0xfee4fede,0xfefafeeb,0xff0bfefc,0xff17ff0f,0xff1fff1c,
-0xff22ff28,0xff2dff2c,0xff33ff32,0xff38ff37,0xff38ff3b,0xff3bff3f,0xff38ff39,0xff2dff34,
-0xff2dff32,0xff1cff26,0xff14ff19,0xff03ff0f,0xfef0ff02,0xfed4fee8,0xfec7fed6,0xfeaffec2,
-0xfe93feab,0xfe77fe8d,0xfe64fe6e,0xfe4dfe59,0xfe37fe3c,0xfe1bfe22,0xfe01fe09,0xfde9fdf1,
-0xfdc7fdd2,0xfdabfdb7,0xfd88fd97,0xfd61fd7a,0xfd41fd4e,0xfd27fd3b,0xfd10fd24,0xfd07fd07,
-0xfd0bfd00,0xfd0bfd03,0xfd1afd0f,0xfd3ffd2e,0xfd6dfd50,0xfdacfd83,0xfdebfdc2,0xfe39fe0e,
-0xfe8bfe63,0xfeddfeb8,0xff2dff05,0xff83ff57,0xffd0ffaa,0x0016fff1,0x00640041,0x00b20093,
-0x00fc00d7,0x01460127,0x019c0176,0x01e701c6,0x023c021a,0x02950269,0x02e402bc,0x032a0307,
-0x036c034d,0x03b50398,0x03e603d4,0x04110404,0x04320422,0x045f044d,0x0478046e,0x04860484,
-0x04a10493,0x04ba04ad,0x04ca04c2,0x04d904cf,0x04f304e8,0x051204fe,0x0534051d,0x054b0538,
-0x05600550,0x057c0563,0x05880576,0x05990587,0x05970595,0x059b0595,0x058f0597,0x0587058b,
-0x0574057e,0x056a0575,0x0558055f,0x053c0548,0x0520052b,0x050d0519,0x04f40505,0x04d304e8,
-0x04b504c9,0x049504a2,0x04730483,0x044c0459,0x041c042f,0x03f50406,0x03c703dc,0x039e03b4,
-0x0371038f,0x0345035e,0x0323033c,0x02fd0314,0x02e602ef,0x02bf02d5,0x02a802b5,0x02860299,
-0x025c0271,0x02330242,0x0204021c,0x01cc01ec,0x019301b2,0x01520174,0x01130135,0x00c700ec,
-0x0076009c,0x0026004a,0xffc9fff8,0xff6dff9e,0xff15ff45,0xfeb8feeb,0xfe57fe83,0xfdfffe2a,
-0xfd9dfdce,0xfd3afd68,0xfce1fd11,0xfc87fcb8,0xfc37fc5b,0xfbf2fc10,0xfbb0fbcf,0xfb70fb8f,
-0xfb3ffb5f,0xfb11fb27,0xfaf9fb02,0xfadbfae8,0xfac1fac8,0xfab0fab7,0xfaa1faac,0xfaa0faa7,
-0xfa92fa95,0xfa86fa8a,0xfa88fa86,0xfa82fa83,0xfa7ffa7d,0xfa82fa87,0xfa95fa87,0xfaa2fa93,
-0xfac1faae,0xfaddfac9,0xfafefae6,0xfb21fb0b,0xfb3efb2d,0xfb63fb4e,0xfb7ffb72,0xfb8dfb88,
-0xfba2fb9b,0xfbb1fbaf,0xfbaffbb0,0xfbabfbab,0xfba3fbab,0xfb8efb9c,0xfb73fb80,0xfb52fb6a,
-0xfb39fb51,0xfb18fb30,0xfaebfb08,0xfacdfae8,0xfaa9fac0,0xfa85fa9b,0xfa5efa6d,0xfa38fa4e,
-0xfa14fa26,0xf9fafa0e,0xf9e7f9f3,0xf9e1f9e1,0xf9dff9e0,0xf9f7f9e9,0xfa22fa0e,0xfa53fa3c,
-0xfaa4fa79,0xfafafacb,0xfb57fb1e,0xfbbefb83,0xfc39fbf5,0xfca8fc6b,0xfd14fcde,0xfd83fd49,
-0xfdf1fdb7,0xfe4bfe19,0xfea3fe75,0xfef4fecf,0xff36ff1a,0xff76ff5b,0xffb9ffa0,0xfff7ffe1,
-0x00360017,0x0074005e,0x00ba0092,0x00fd00d6,0x01430118,0x01880165,0x01d201aa,0x020f01ef,
-0x024f0231,0x02900276,0x02d802b1,0x030e02ed,0x03470324,0x03790364,0x03a4038e,0x03d303c2,
-0x03fb03e4,0x04270415,0x04480435,0x046c0460,0x04950480,0x04b304a8,0x04cf04be,0x04ee04dd,
-0x050604fa,0x0518050c,0x052b0524,0x05340534,0x053d053d,0x05440541,0x0541053e,0x053b0543,
-0x05390536,0x05370533,0x05310533,0x052f052a,0x05310532,0x05400535,0x054a0543,0x05670554,
-0x05860579,0x05ae0590,0x05cc05bc,0x05f505e1,0x0618060b,0x063a062c,0x064a0642,0x06510650,
-0x06440652,0x0630063f,0x06150626,0x05e205fb,0x05b405c4,0x0575058f,0x05380555,0x04f9051a,
-0x04b704d8,0x0482049f,0x044a0467,0x04200430,0x03ef0401,0x03b303cd,0x037a0396,0x033c035b,
-0x02f0031b,0x029c02c6,0x02480276,0x01f30222,0x019b01cb,0x0141016c,0x00e90112,0x00a600c8,
-0x006c0088,0x00310044,0x000d001e,0xffed0001,0xffdfffdf,0xffd2ffd3,0xffc7ffc8,0xffbeffc6,
-0xffc1ffc2,0xffbeffc2,0xffbbffc0,0xffb2ffb8,0xff99ff9f,0xff7eff86,0xff66ff6f,0xff35ff4d,
-0xff05ff17,0xfed8fef0,0xfea4fec4,0xfe71fe8c,0xfe35fe54,0xfe07fe1c,0xfdc8fde0,0xfd8ffdac,
-0xfd54fd77,0xfd1bfd3c,0xfcdefcff,0xfca9fcca,0xfc68fc8c,0xfc30fc53,0xfbf0fc0f,0xfbb5fbd4,
-0xfb7cfb9d,0xfb51fb72,0xfb22fb3f,0xfafcfb0f,0xfadcfaea,0xfac9fad2,0xfac0fac4,0xfabcfabc,
-0xfabcfabf,0xfad0fac6,0xfae1fad5,0xfaeffadf,0xfafefaf7,0xfb08fafd,0xfb0ffb0e,0xfb18fb15,
-0xfb14fb1d,0xfb10fb15,0xfb0afb11,0xfb0bfb09,0xfb0dfb09,0xfb21fb14,0xfb37fb2b,0xfb60fb46,
-0xfb93fb72,0xfbc7fba9,0xfc15fbe8,0xfc61fc37,0xfcbafc8e,0xfd13fcea,0xfd79fd52,0xfdd8fdac,
-0xfe35fe08,0xfe91fe5d,0xfeecfebe,0xff42ff14,0xff94ff6f,0xffe6ffbb,0x00300009,0x007c0050,
-0x00bd0097,0x010400df,0x013c0117,0x01730150,0x0190017c,0x01b101a2,0x01c001ba,0x01cb01cc,
-0x01c201c7,0x01b401c2,0x019301a4,0x01730185,0x01460160,0x011e0130,0x00f20104,0x00c800dd,
-0x009700b0,0x007a0089,0x005f006b,0x00400049,0x002b0030,0x001e0025,0x001b0018,0x00110013,
-0x001c001f,0x002f002a,0x004d0040,0x006f005b,0x009a0080,0x00ce00af,0x010f00e8,0x0151012c,
-0x01900172,0x01ce01b6,0x021401f5,0x024d0233,0x027f0263,0x02a50293,0x02c402b9,0x02d302cd,
-0x02df02e2,0x02e202df,0x02db02da,0x02d202cf,0x02c902bd,0x02c402b8,0x02b502ad,0x02b002aa,
-0x02a702ae,0x02b002a9,0x02be02b3,0x02bf02bb,0x02bd02c0,0x02c002c2,0x02ba02ba,0x02af02b8,
-0x02a202a8,0x028a0294,0x026a0281,0x02520263,0x02340246,0x021a0228,0x01fc0208,0x01e301ea,
-0x01d401d3,0x01c301c1,0x01b601be,0x01b401b9,0x01b001b4,0x01a801b1,0x01a401aa,0x0191019c,
-0x0170017f,0x014d0160,0x0121013c,0x00e30101,0x009f00bd,0x00570073,0x00020022,0xffb6ffdb,
-0xff6aff90,0xff22ff4d,0xfee6ff08,0xfeb5fed4,0xfe9dfeb1,0xfe8afe94,0xfe7afe7c,0xfe75fe74,
-0xfe79fe78,0xfe7cfe77,0xfe79fe79,0xfe73fe71,0xfe63fe72,0xfe4ffe5c,0xfe29fe3d,0xfe08fe17,
-0xfdd8fdf5,0xfdaefdc5,0xfd7afd93,0xfd4ffd63,0xfd26fd3d,0xfcfbfd12,0xfcdbfcea,0xfcc0fccd,
-0xfca8fcad,0xfc90fc96,0xfc78fc86,0xfc5cfc68,0xfc42fc4c,0xfc27fc37,0xfc09fc18,0xfbf0fc06,
-0xfbe0fbec,0xfbcefbd7,0xfbcefbd1,0xfbd4fbcc,0xfbdafbd6,0xfbf7fbeb,0xfc20fc0a,0xfc52fc30,
-0xfc79fc64,0xfcbcfc97,0xfceefcd0,0xfd2dfd0a,0xfd67fd4d,0xfd99fd86,0xfdd6fdba,0xfe0ffdf3,
-0xfe42fe30,0xfe79fe5f,0xfea9fe95,0xfedffec6,0xff11fef9,0xff3cff2a,0xff71ff54,0xff9cff85,
-0xffc7ffb1,0xffe2ffd4,0xfffbffea,0x000c0003,0x00160011,0x001b001b,0x00270024,0x002c002b,
-0x0034002d,0x0041003b,0x00500049,0x006a0060,0x00840078,0x00a5008f,0x00ca00b3,0x00ee00d9,
-0x01130100,0x01330125,0x01590144,0x01730165,0x01800180,0x01930188,0x01a0019a,0x01af01a1,
-0x01b501ad,0x01bd01b1,0x01ca01c1,0x01e201de,0x01f801f0,0x021d020f,0x02490235,0x02830263,
-0x02b9029f,0x02ee02d6,0x032e030f,0x035e0344,0x03830372,0x039e038b,0x03ae03a7,0x03af03a6,
-0x03a6039e,0x038d0393,0x03660378,0x03430354,0x03130327,0x02ec02ff,0x02b402d3,0x028f02a3,
-0x0272027f,0x025c0268,0x025a025c,0x026c0262,0x0287027a,0x02b50299,0x02ef02cd,0x0331030b,
-0x03830357,0x03ce03a6,0x042303fb,0x045f0444,0x04a70484,0x04d804c8,0x050a04f0,0x051e0514,
-0x05250527,0x0526052b,0x05160520,0x04fc050c,0x04d704e4,0x04b004c5,0x04760490,0x04510464,
-0x0425043d,0x04020411,0x03d603e8,0x03ad03bf,0x0388039c,0x035f0377,0x033d0351,0x0311032a,
-0x02e802fc,0x02b402d0,0x027c029b,0x02480261,0x02060229,0x01be01df,0x0175019c,0x01280155,
-0x00da0108,0x008400ae,0x0037005d,0xffdf000a,0xff8dffb9,0xff4aff68,0xfeffff26,0xfebafeda,
-0xfe7cfe9c,0xfe42fe63,0xfe0ffe26,0xfddffdf5,0xfdbdfdc8,0xfd8ffda4,0xfd6afd7e,0xfd42fd58,
-0xfd18fd2c,0xfceefd04,0xfcbffcd3,0xfc90fc9c,0xfc52fc6e,0xfc1afc34,0xfbd5fbf3,0xfb98fbb3,
-0xfb57fb73,0xfb19fb36,0xfadbfaf3,0xfa97fab6,0xfa58fa7b,0xfa22fa3e,0xf9f3fa0d,0xf9c2f9df,
-0xf998f9b1,0xf967f983,0xf94df95c,0xf937f941,0xf929f92c,0xf924f921,0xf925f91b,0xf937f929,
-0xf94ff945,0xf976f962,0xf99ff98e,0xf9d1f9b4,0xfa11f9f3,0xfa4ffa2e,0xfa85fa6b,0xfac2faa4,
-0xfaf0fad3,0xfb1bfb04,0xfb44fb2e,0xfb5bfb49,0xfb73fb69,0xfb8afb7c,0xfb94fb91,0xfbabfba4,
-0xfbbcfbb7,0xfbd4fbcb,0xfbf5fbea,0xfc1afc0b,0xfc4dfc3a,0xfc7cfc65,0xfcaafc95,0xfce2fccb,
-0xfd1efd03,0xfd5cfd3a,0xfd96fd7a,0xfdcefdb8,0xfe01fdeb,0xfe2cfe1c,0xfe53fe44,0xfe78fe66,
-0xfe9afe8a,0xfea8fe9e,0xfeb5feae,0xfeb7feb9,0xfebcfebc,0xfeb4feb3,0xfea4feae,0xfe9efea2,
-0xfe96fe91,0xfe92fe90,0xfe96fe8b,0xfea1fe94,0xfeb5fea4,0xfed3febf,0xfef8fedf,0xff30ff0e,
-0xff6eff51,0xffc2ff97,0x001cffec,0x007e004a,0x00e300a9,0x01400110,0x01ab0174,0x021501dc,
-0x0278024a,0x02dc02b0,0x033a030d,0x039c036f,0x03ef03c7,0x043f0414,0x047f0468,0x04cf04ac,
-0x050e04f1,0x0548052a,0x057b0560,0x05a60593,0x05cd05c0,0x05f305d9,0x06130600,0x0629061a,
-0x06440638,0x065a064d,0x0678066d,0x06860680,0x06a10689,0x06af06ad,0x06bf06b8,0x06cb06c2,
-0x06d806d6,0x06de06df,0x06d806db,0x06cf06dc,0x06bf06cd,0x06a006b1,0x06820695,0x0656066c,
-0x06200638,0x05e005fa,0x059f05bd,0x05540575,0x05120533,0x04c904f1,0x048b04a5,0x044f046c,
-0x04160435,0x03f00408,0x03c603db,0x03a903b0,0x0391039b,0x03810385,0x03700376,0x03720374,
-0x03740379,0x03740373,0x0373036c,0x035f036d,0x034a0358,0x032c0341,0x0307031d,0x02cb02f2,
-0x028702b1,0x02440263,0x01f50214,0x019201ba,0x013a0163,0x00d60106,0x008200a8,0x00300055,
-0xffea0009,0xffa1ffc7,0xff66ff82,0xff28ff4b,0xfef6ff14,0xfebcfed9,0xfe7dfea3,0xfe3afe62,
-0xfdf1fe1e,0xfda7fdcf,0xfd4afd77,0xfcfcfd2a,0xfc9ffcc9,0xfc48fc75,0xfbf5fc1f,0xfba9fbc9,
-0xfb68fb83,0xfb31fb4f,0xfb10fb19,0xfaf7faf8,0xfaeafae8,0xfae6fae8,0xfaf8faed,0xfb0dfb00,
-0xfb2cfb1f,0xfb53fb44,0xfb6dfb5f,0xfb94fb8a,0xfbbbfbaf,0xfbdffbd2,0xfbfffbf0,0xfc22fc07,
-0xfc35fc2a,0xfc4bfc41,0xfc63fc58,0xfc78fc75,0xfc89fc85,0xfca3fc99,0xfcacfca7,0xfcbafcb5,
-0xfccefcc1,0xfcd8fcd6,0xfce3fce0,0xfcebfce6,0xfcf5fcf2,0xfceffced,0xfce9fcef,0xfce0fce4,
-0xfccefcd9,0xfcb3fcc6,0xfc92fca4,0xfc75fc7d,0xfc45fc59,0xfc1efc30,0xfbfafc0d,0xfbddfbee,
-0xfbc4fbcc,0xfbb6fbb8,0xfbb0fbb0,0xfbbafba9,0xfbd1fbc3,0xfbfbfbe5,0xfc37fc17,0xfc79fc56,
-0xfcbffc9f,0xfd13fcec,0xfd72fd42,0xfdc9fd9c,0xfe28fdf9,0xfe82fe58,0xfee2feac,0xff36ff0a,
-0xff8eff5e,0xffe3ffbb,0x003e0013,0x0093006b,0x00e600bd,0x01390117,0x018c0166,0x01e601b9,
-0x0236020c,0x02810259,0x02dc02a9,0x031802f5,0x0354032f,0x038d036d,0x03b803a6,0x03d703cc,
-0x03fd03e6,0x040e0408,0x04200414,0x041e041e,0x041a0421,0x040e041a,0x03fe0408,0x03e403fd,
-0x03ce03e3,0x03b603ce,0x039a03ac,0x03820394,0x03630379,0x03470357,0x03310340,0x030f0320,
-0x02fb030d,0x02e702fb,0x02d002e4,0x02c702cd,0x02bf02c3,0x02b402b5,0x02b202af,0x02a202ac,
-0x02a502a7,0x029f029b,0x029e0299,0x02930290,0x0285028a,0x027a0284,0x02700273,0x02610268,
-0x025d025f,0x0255025d,0x02530257,0x0257025e,0x02620261,0x02750266,0x02840272,0x028f0289,
-0x02950291,0x029b029b,0x029d02a0,0x02950296,0x02790285,0x02520263,0x0221023d,0x01de0201,
-0x018d01b9,0x013a016b,0x00dd010f,0x007600ad,0x000e0047,0xffaeffe7,0xff34ff70,0xfec9fefb,
-0xfe54fe85,0xfddffe19,0xfd71fda6,0xfd05fd3a,0xfc9bfccd,0xfc47fc6f,0xfbfbfc20,0xfbc2fbde,
-0xfb92fba8,0xfb84fb8f,0xfb8dfb86,0xfb99fb91,0xfbbefba9,0xfbeefbd0,0xfc24fc03,0xfc5ffc41,
-0xfc93fc77,0xfcc4fcb0,0xfce8fcdc,0xfd04fcff,0xfd13fd0d,0xfd18fd18,0xfd14fd16,0xfd0dfd0f,
-0xfcf5fd02,0xfce5fce9,0xfcd7fcdb,0xfcd8fcd6,0xfcddfcd6,0xfcecfce8,0xfd09fcf4,0xfd22fd11,
-0xfd4dfd3e,0xfd6efd62,0xfd94fd82,0xfdc3fdb0,0xfde5fdd0,0xfe00fdef,0xfe1cfe0a,0xfe39fe2b,
-0xfe4ffe41,0xfe61fe57,0xfe75fe6f,0xfe8efe84,0xfeacfea1,0xfed1febe,0xfee7fedd,0xff0dfefc,
-0xff25ff1a,0xff3cff33,0xff41ff41,0xff38ff3e,0xff29ff32,0xff11ff1d,0xfee7ff00,0xfebbfed5,
-0xfe95fea9,0xfe68fe7f,0xfe49fe4e,0xfe2bfe3a,0xfe1bfe1d,0xfe21fe18,0xfe36fe23,0xfe52fe3e,
-0xfe7ffe63,0xfebcfe96,0xfefafed7,0xff3eff15,0xff83ff64,0xffcbffa6,0x0015fff0,0x004d0032,
-0x0092006f,0x00cd00ac,0x010a00f3,0x0149012c,0x01840167,0x01c601a8,0x01fb01e0,0x02390216,
-0x02710250,0x02a30288,0x02d802be,0x030702ef,0x03350321,0x03600349,0x038a0373,0x03b003a1,
-0x03cd03c0,0x03e303d4,0x03f003e4,0x040203f8,0x04080405,0x0414040e,0x04170414,0x041c0416,
-0x040f0412,0x03fd0405,0x03f503f8,0x03d803e6,0x03bd03ca,0x03a503b7,0x0381039a,0x0369037c,
-0x034c035d,0x03330340,0x031d032a,0x030a031b,0x0301030d,0x03010308,0x03090309,0x03150312,
-0x032f0322,0x033e0330,0x03540348,0x0361035b,0x03760372,0x0380037f,0x0382037d,0x03800380,
-0x03750378,0x03650370,0x034a0354,0x0331033d,0x030a0326,0x02e702f7,0x02c502d4,0x029902ad,
-0x02750289,0x02530269,0x023e024a,0x021c022e,0x02080212,0x01eb01fb,0x01dc01db,0x01be01c3,
-0x01a901ac,0x017f018f,0x01640171,0x01440157,0x01220139,0x00fa010c,0x00ca00e6,0x009f00b8,
-0x0079008f,0x00530067,0x00320044,0x00180026,0xfffe0006,0xffeeffee,0xffddffe6,0xffd2ffda,
-0xffccffc7,0xffc0ffc7,0xffb1ffb7,0xff98ffa4,0xff84ff8f,0xff65ff74,0xff3dff50,0xff10ff2d,
-0xfee3fef8,0xfea4fec0,0xfe67fe86,0xfe2afe49,0xfdecfe0d,0xfdaffdd0,0xfd74fd91,0xfd3efd5b,
-0xfd05fd23,0xfcd5fced,0xfca4fcba,0xfc78fc88,0xfc3ffc5c,0xfc0efc24,0xfbddfbee,0xfba2fbbf,
-0xfb6efb87,0xfb29fb4a,0xfaf1fb0b,0xfab7fad3,0xfa8cfa9a,0xfa59fa72,0xfa37fa46,0xfa21fa2e,
-0xfa0cfa17,0xfa06fa0c,0xfa11fa0e,0xfa23fa17,0xfa38fa2d,0xfa5bfa46,0xfa6dfa5f,0xfa8bfa7a,
-0xfaa0fa9a,0xfabbfaae,0xfacefac7,0xfad5fad0,0xfad3fad3,0xfac1facc,0xfab6fac0,0xfaa1faad,
-0xfa89fa98,0xfa72fa78,0xfa61fa65,0xfa5afa51,0xfa56fa4f,0xfa60fa5a,0xfa72fa71,0xfa9cfa89,
-0xfac8fab2,0xfb07fae7,0xfb53fb2b,0xfba6fb7a,0xfc05fbd7,0xfc5cfc2c,0xfcb9fc90,0xfd1afcec,
-0xfd72fd47,0xfdc1fd95,0xfe0efdea,0xfe5cfe33,0xfe9efe7b,0xfedafebb,0xff13fefa,0xff54ff2c,
-0xff83ff64,0xffc3ff9f,0xffedffd9,0x00290011,0x005c0044,0x009e007f,0x00cf00b4,0x010c00ee,
-0x01470130,0x01800162,0x01b10199,0x01f001d2,0x021b0205,0x02530232,0x027b0267,0x02a70290,
-0x02d702bd,0x02ff02e7,0x0325030d,0x034d0337,0x0376035e,0x03aa038c,0x03cf03b6,0x03f603df,
-0x04250414,0x044e0442,0x04810468,0x04a00496,0x04d004be,0x04f704e3,0x05150504,0x0531051f,
-0x05450537,0x0553054a,0x0565055c,0x056b0561,0x05710567,0x05760573,0x0572057a,0x056e0576,
-0x05640570,0x05580561,0x05510554,0x054a054b,0x053f053e,0x053c053e,0x05440543,0x0553054e,
-0x055a0555,0x056b0565,0x058c0581,0x05a7059a,0x05c405af,0x05d605c7,0x05eb05dc,0x05f305ec,
-0x05f005f0,0x05e105f0,0x05ce05dd,0x059f05bb,0x056d0587,0x05270545,0x04d50502,0x047f04b1,
-0x042a0457,0x03be03f2,0x0357038f,0x02e80323,0x028002b4,0x021a024a,0x01b701e3,0x01520182,
-0x00f90128,0x00a000cb,0x0056007f,0x00180037,0xffe0fffa,0xffadffc4,0xff7bff8f,0xff56ff6a,
-0xff36ff44,0xff1eff28,0xff06ff16,0xfef4ff04,0xfeedfef6,0xfeedfef2,0xfee7feef,0xfeeafee7,
-0xfeedfef3,0xfef5feef,0xfefefef6,0xfefdfef9,0xfefafefb,0xfef9fef8,0xfeeafef1,0xfed2fedd,
-0xfeb6fec5,0xfe92fea6,0xfe61fe7a,0xfe27fe46,0xfdebfe0a,0xfda5fdcc,0xfd5cfd83,0xfd10fd38,
-0xfcc4fcf0,0xfc72fca3,0xfc2afc50,0xfbddfc02,0xfb8dfbaa,0xfb3dfb62,0xfafafb1b,0xfab4fad5,
-0xfa71fa8e,0xfa21fa4c,0xf9e2fa09,0xf9a9f9c8,0xf976f98f,0xf94df95c,0xf924f933,0xf912f918,
-0xf900f906,0xf903f90a,0xf91df909,0xf941f930,0xf97af95c,0xf9c2f99f,0xfa1ff9f5,0xfa75fa4d,
-0xfadafaa9,0xfb45fb18,0xfbb4fb85,0xfc1cfbee,0xfc7efc53,0xfcd5fca7,0xfd31fd03,0xfd79fd50,
-0xfdb8fd9b,0xfdecfdd1,0xfe23fe07,0xfe52fe38,0xfe7efe63,0xfea8fe90,0xfed0febf,0xff02feeb,
-0xff35ff21,0xff75ff5b,0xffacff90,0xfff2ffc9,0x002b0009,0x00700051,0x00b3008f,0x00f100cc,
-0x01240108,0x01520136,0x01700161,0x018e0186,0x01a10199,0x01a801af,0x01a301a9,0x019901a0,
-0x0192019a,0x017e018a,0x01720171,0x015f0164,0x01530150,0x01490148,0x01460144,0x014a014d,
-0x015b0156,0x01730165,0x018b017f,0x01ab019b,0x01d501c3,0x020601f0,0x023c021f,0x026b025d,
-0x02a10289,0x02cc02bb,0x02ff02ec,0x032e0318,0x0362034c,0x038a0378,0x03bd03a1,0x03eb03cf,
-0x041503f8,0x043f0423,0x046b044d,0x048c0472,0x04a50499,0x04c004ba,0x04cf04c7,0x04cf04d2,
-0x04c704c9,0x04ab04bb,0x048b0499,0x04560473,0x04180432,0x03ce03ec,0x037a03a0,0x03200351,
-0x02c602ee,0x026d029a,0x020a0239,0x01b601e2,0x0168018e,0x011e014a,0x00e8010a,0x00bd00d3,
-0x009400a5,0x00710081,0x005b0067,0x00510054,0x004c0048,0x00460047,0x00410045,0x00410044,
-0x0049004b,0x00460044,0x004c0048,0x0040003f,0x0039003b,0x002e0039,0x001d0024,0x00110015,
-0xfff90002,0xffd9ffed,0xffc3ffd2,0xffacffbb,0xff87ff9f,0xff6bff7e,0xff4aff56,0xff23ff34,
-0xfef2ff06,0xfeb8fed6,0xfe85fea0,0xfe45fe62,0xfdf8fe1e,0xfdbefddb,0xfd76fd98,0xfd33fd50,
-0xfcf5fd0f,0xfcb5fcd5,0xfc82fc9a,0xfc58fc6c,0xfc33fc48,0xfc17fc1f,0xfbfcfc0c,0xfbedfbf9,
-0xfbdefbe5,0xfbd0fbda,0xfbc6fbcc,0xfbbcfbbd,0xfbb8fbb5,0xfbb9fbb8,0xfbb4fbb4,0xfbc4fbbe,
-0xfbd0fbc9,0xfbeafbdb,0xfc09fbf6,0xfc27fc13,0xfc53fc37,0xfc84fc6b,0xfcc5fc9c,0xfcfdfcda,
-0xfd37fd14,0xfd6efd54,0xfda2fd85,0xfdd6fdbd,0xfdfafde8,0xfe19fe14,0xfe36fe33,0xfe56fe48,
-0xfe64fe5d,0xfe6bfe67,0xfe72fe70,0xfe7dfe77,0xfe79fe7b,0xfe80fe7d,0xfe83fe82,0xfe8cfe87,
-0xfe8bfe8b,0xfe9efe95,0xfeaefea8,0xfec7feb8,0xfee0fed2,0xfefefeeb,0xff22ff0d,0xff47ff33,
-0xff73ff5f,0xffa8ff8d,0xffdcffc0,0x0012fff5,0x00440027,0x0077005d,0x00ad0097,0x00d400c9,
-0x00fc00ea,0x01200113,0x013a012d,0x014d0147,0x01600160,0x016f0168,0x017f0172,0x01850183,
-0x01910189,0x01a10197,0x01b001a9,0x01db01c1,0x01f301e8,0x02240208,0x0256023e,0x028f027c,
-0x02ce02b3,0x030e02e9,0x034f032d,0x03860364,0x03bb039c,0x03e503d1,0x04110400,0x042e0422,
-0x043a0434,0x0441043f,0x0440043f,0x0438043d,0x04230430,0x04180425,0x04080411,0x03fd0401,
-0x03f603f6,0x03e703e7,0x03de03e3,0x03d603d9,0x03d803d8,0x03cc03cc,0x03cb03cc,0x03bd03c7,
-0x03b403b9,0x03a203ac,0x038e03a0,0x037c0389,0x03600373,0x0345034f,0x0334033b,0x031c0324,
-0x03060314,0x02f60300,0x02ee02f9,0x02e402ec,0x02df02e3,0x02d602de,0x02cd02d4,0x02c002c9,
-0x02b502bc,0x02a002a9,0x028d0299,0x026f0282,0x02590263,0x02310246,0x02140224,0x01f101fd,
-0x01d301e1,0x01b501c0,0x019f01a5,0x017a0183,0x01600168,0x01450152,0x0122013a,0x010a011a,
-0x00ea00fd,0x00ca00e5,0x00a800bd,0x0086009e,0x005e0073,0x00330046,0x00070021,0xffd1ffe9,
-0xff9affb7,0xff61ff7c,0xff2dff44,0xfef6ff14,0xfebefed7,0xfe82fea4,0xfe3efe61,0xfe05fe1e,
-0xfdc0fddf,0xfd79fd9d,0xfd34fd54,0xfce8fd07,0xfc9cfcc1,0xfc4dfc76,0xfc06fc2d,0xfbc3fbe5,
-0xfb8afbaf,0xfb58fb74,0xfb29fb44,0xfb0dfb17,0xfaebfafb,0xfaddfae3,0xfacdfad5,0xfacafad1,
-0xfac9fad2,0xfac8fac9,0xfac9fac8,0xfad3facb,0xfae9fad2,0xfafafae3,0xfb0cfaf7,0xfb2dfb17,
-0xfb4ffb39,0xfb80fb65,0xfbadfb8c,0xfbe9fbc7,0xfc24fc03,0xfc6cfc3e,0xfca5fc7d,0xfce4fcc2,
-0xfd13fcf6,0xfd43fd24,0xfd65fd53,0xfd77fd6b,0xfd79fd7c,0xfd73fd7a,0xfd5dfd6a,0xfd3bfd52,
-0xfd0afd2d,0xfcdffcfd,0xfcb1fcc8,0xfc87fc9e,0xfc5bfc71,0xfc40fc4f,0xfc1efc2c,0xfc0cfc0e,
-0xfc0afc04,0xfc0afc01,0xfc14fc09,0xfc26fc19,0xfc40fc38,0xfc60fc55,0xfc89fc76,0xfcbffca4,
-0xfceefcd9,0xfd2bfd09,0xfd63fd43,0xfdacfd84,0xfddefdc5,0xfe19fdfc,0xfe4cfe34,0xfe7dfe68,
-0xfeaefe97,0xfedafec4,0xfeedfee5,0xff0dff00,0xff27ff15,0xff33ff2d,0xff44ff3a,0xff50ff4a,
-0xff5cff53,0xff79ff6c,0xff9eff8c,0xffcfffb6,0x0006ffe9,0x004a0025,0x0091006b,0x00e400b6,
-0x01400111,0x01ab0175,0x021201dc,0x027c0249,0x02e502b5,0x0350031d,0x03b00381,0x041003dd,
-0x0468043a,0x04b50491,0x04f504d2,0x052e0517,0x0563054d,0x0591057a,0x05b205a1,0x05cf05be,
-0x05de05dd,0x05e205e1,0x05dc05dd,0x05d205dc,0x05b505c6,0x059305a8,0x056a0585,0x053d0556,
-0x04fe051d,0x04d104e1,0x049604b3,0x0467047c,0x043f044c,0x04170426,0x03fa0407,0x03ef03f3,
-0x03e803ed,0x03e803eb,0x03f903f4,0x040d0403,0x04290418,0x04460438,0x0464045a,0x04820474,
-0x0495048e,0x04a804a2,0x04ae04b4,0x04b504ae,0x04a804ae,0x049d049d,0x048b0492,0x046c0479,
-0x044e045f,0x0428043c,0x03fe040d,0x03d203ea,0x03a403c3,0x037b0398,0x03520370,0x0324033b,
-0x02f00312,0x02c202e4,0x028202a9,0x023a0266,0x01f3021c,0x019601c9,0x013c0169,0x00d40108,
-0x00640097,0xfff7002d,0xff87ffbe,0xff1dff50,0xfeb2fee0,0xfe57fe7c,0xfdf8fe25,0xfdb2fdd8,
-0xfd75fd9a,0xfd46fd60,0xfd21fd34,0xfcfefd14,0xfcf0fcfc,0xfcd8fcec,0xfccdfcd7,0xfcbbfcc2,
-0xfcaffcb0,0xfc9dfca2,0xfc84fc91,0xfc6dfc79,0xfc56fc5d,0xfc3dfc48,0xfc25fc34,0xfc0dfc17,
-0xfbfefc04,0xfbe6fbef,0xfbd7fbde,0xfbd1fbd7,0xfbd5fbd2,0xfbe2fbde,0xfbf2fbe9,0xfc0ffc03,
-0xfc31fc22,0xfc5cfc49,0xfc8dfc76,0xfccafcab,0xfd02fce5,0xfd49fd2a,0xfd80fd64,0xfdbdfda3,
-0xfdeefdd9,0xfe1dfe04,0xfe3bfe2d,0xfe52fe4a,0xfe55fe50,0xfe51fe57,0xfe37fe4a,0xfe1afe28,
-0xfdf1fe0a,0xfdc3fdd9,0xfd86fda3,0xfd4bfd63,0xfd04fd27,0xfcbffcdd,0xfc7bfc9e,0xfc42fc61,
-0xfc12fc30,0xfbe3fbf9,0xfbbefbd4,0xfbaafbb2,0xfb99fb9f,0xfb90fb94,0xfb98fb97,0xfba8fba2,
-0xfbc3fbb3,0xfbe7fbd3,0xfc19fbfa,0xfc56fc36,0xfc98fc74,0xfcecfcc2,0xfd51fd1d,0xfdaffd80,
-0xfe21fde7,0xfe90fe56,0xff04feca,0xff75ff3d,0xffe9ffb3,0x005c0027,0x00bf008f,0x012600f1,
-0x017d0155,0x01c8019f,0x020d01f2,0x024f0231,0x027c0269,0x02a40295,0x02ca02b9,0x02e502d8,
-0x030302f3,0x03140305,0x0328031d,0x03330331,0x033f033c,0x034f0347,0x035a034f,0x03600360,
-0x03600360,0x03680367,0x0370036d,0x03790376,0x03770378,0x03790380,0x037b0380,0x037d037d,
-0x037a037a,0x03800379,0x0377037d,0x03710378,0x036d0372,0x035e0365,0x034f035a,0x033d034c,
-0x03280338,0x03070319,0x02f202fd,0x02ce02e0,0x02ad02bb,0x028b0296,0x0267026b,0x0241024e,
-0x021f022c,0x01ff0208,0x01dc01ed,0x01c901d2,0x01bf01c7,0x01b201b1,0x01b201af,0x01b901b4,
-0x01c901bf,0x01e301d7,0x020701f7,0x02250216,0x024e023a,0x027c0265,0x02a2028f,0x02c302b4,
-0x02df02d0,0x02e302e3,0x02e002e2,0x02c302d3,0x029402ae,0x02480271,0x01ef0223,0x018501bb,
-0x0111014d,0x009000d1,0x000b0048,0xff88ffc7,0xff0bff48,0xfe8efeca,0xfe27fe59,0xfdbffdf3,
-0xfd72fd9c,0xfd26fd4a,0xfcf4fd08,0xfcc6fcda,0xfca0fcb1,0xfc8dfc9a,0xfc84fc8e,0xfc8afc8a,
-0xfc99fc8d,0xfcacfc9c,0xfcc4fcaf,0xfcdefcc8,0xfcfafce6,0xfd13fd04,0xfd29fd1e,0xfd41fd2e,
-0xfd55fd4b,0xfd5cfd59,0xfd5dfd66,0xfd5dfd60,0xfd54fd56,0xfd3dfd47,0xfd20fd34,0xfd09fd1c,
-0xfce9fcfa,0xfcc9fcd8,0xfcb6fcbd,0xfc97fca4,0xfc7bfc84,0xfc73fc77,0xfc6dfc69,0xfc69fc6e,
-0xfc63fc67,0xfc72fc6d,0xfc78fc6f,0xfc7dfc75,0xfc86fc7f,0xfc93fc8c,0xfca4fc99,0xfcb0fca9,
-0xfcc7fcb8,0xfcd6fcd1,0xfce7fcde,0xfcf5fce8,0xfd0dfcfb,0xfd19fd13,0xfd23fd24,0xfd45fd34,
-0xfd61fd52,0xfd87fd75,0xfdb8fda0,0xfde4fdc9,0xfe1cfe04,0xfe60fe40,0xfea3fe80,0xfef3feca,
-0xff3fff18,0xff86ff5d,0xffd1ffa8,0x0021fff6,0x00580032,0x00960072,0x00bf00a5,0x00ea00d4,
-0x010400f6,0x01210112,0x0132012b,0x013c013c,0x01500149,0x0161015d,0x016f0166,0x01800176,
-0x0194018e,0x01a901a1,0x01d201bb,0x01f201df,0x021d0203,0x0248022b,0x026d0257,0x029d0282,
-0x02d102b6,0x02f702e3,0x03220305,0x0348032b,0x0364034f,0x0375036a,0x038b037e,0x03990394,
-0x039d0390,0x03a2039e,0x039d03a1,0x0398039c,0x03960396,0x038b0392,0x0389038d,0x0387038f,
-0x038b038d,0x03940391,0x039d039f,0x03b303a8,0x03c403b7,0x03d603cc,0x03f403e6,0x04150404,
-0x04300420,0x04500441,0x04710460,0x048d047f,0x04a00498,0x04ab04a2,0x04b404ae,0x04af04b5,
-0x04a504af,0x049904a2,0x047a048d,0x0453046d,0x04320447,0x04040418,0x03cb03e1,0x039103a9,
-0x0350036e,0x03060327,0x02bb02dd,0x02660290,0x02110242,0x01af01e1,0x01530188,0x00e7011e,
-0x007e00b2,0x000b0049,0xff9fffd4,0xff34ff6e,0xfed1ff03,0xfe6cfe9a,0xfe19fe41,0xfdd2fdf4,
-0xfda1fdb9,0xfd77fd86,0xfd62fd68,0xfd52fd59,0xfd58fd53,0xfd69fd5d,0xfd87fd79,0xfdadfd99,
-0xfdd4fdc1,0xfdfdfde8,0xfe29fe0f,0xfe4afe36,0xfe6efe58,0xfe8bfe7e,0xfea1fe9a,0xfeb9feb2,
-0xfed2fec5,0xfee2feda,0xfef6feea,0xfefffefc,0xff0bff07,0xff14ff12,0xff17ff1c,0xff1dff1b,
-0xff1cff1a,0xff13ff12,0xff09ff0e,0xfef3fefd,0xfedefee5,0xfecefed4,0xfeaffebc,0xfe91fe9c,
-0xfe6efe7d,0xfe47fe5b,0xfe25fe37,0xfe05fe0e,0xfde7fdfb,0xfdcdfddc,0xfdb1fdbb,0xfd93fda9,
-0xfd74fd89,0xfd5dfd71,0xfd47fd58,0xfd33fd3c,0xfd19fd21,0xfcf6fd03,0xfcd7fce5,0xfcb8fcbc,
-0xfc98fca5,0xfc75fc83,0xfc6afc6c,0xfc5bfc62,0xfc47fc56,0xfc4efc4e,0xfc59fc55,0xfc68fc5a,
-0xfc7efc70,0xfc99fc8a,0xfcb1fc9f,0xfcd0fcbf,0xfcf1fce5,0xfd16fd07,0xfd3dfd2b,0xfd63fd4c,
-0xfd8afd74,0xfdadfd9a,0xfdcffdbb,0xfdf6fde6,0xfe16fe09,0xfe3dfe30,0xfe65fe50,0xfe8cfe72,
-0xfeb1fe9d,0xfed3fec2,0xfef4fee7,0xff11ff06,0xff32ff27,0xff51ff47,0xff69ff6e,0xff8eff84,
-0xffabffa8,0xffd6ffc7,0xfffcffeb,0x0025000b,0x00510036,0x007d005d,0x00a40089,0x00c900b2,
-0x00e300d8,0x010500f9,0x01190113,0x011f011d,0x012b0123,0x01260133,0x0120012a,0x011e011f,
-0x0119011d,0x010f0114,0x010e0109,0x010f0109,0x01150113,0x01200119,0x012e0128,0x013e0137,
-0x0151014d,0x01750168,0x0185017d,0x01a6019a,0x01ba01ae,0x01d301c4,0x01e601d6,0x01f801ef,
-0x02070200,0x020c0208,0x0212020e,0x020e0214,0x020b020f,0x01fe0204,0x01f501f8,0x01e801f0,
-0x01da01e1,0x01c101ca,0x01b001b9,0x019a019f,0x0186018b,0x0173017d,0x01690171,0x0152015e,
-0x014b0154,0x014a014d,0x01430143,0x013e013f,0x013f0144,0x0144013e,0x014a0144,0x01510151,
-0x01630156,0x016b0163,0x0171016b,0x01810174,0x018a018a,0x018c0188,0x0190018f,0x01920194,
-0x01940195,0x0190018c,0x017f0185,0x01790179,0x016d016d,0x01560159,0x013c014d,0x0119012c,
-0x00fe010d,0x00df00f0,0x00bb00d0,0x009500ab,0x006f0080,0x0045005f,0x00180030,0xfff00007,
-0xffbfffdb,0xff8cffab,0xff6aff7f,0xff39ff52,0xff0fff24,0xfee4fefa,0xfebafecd,0xfe95feaa,
-0xfe75fe85,0xfe54fe69,0xfe3dfe47,0xfe2efe36,0xfe17fe1e,0xfe04fe11,0xfdf8fdff,0xfdeefdf1,
-0xfde2fde7,0xfddcfddf,0xfdd9fddb,0xfdd4fdd8,0xfdccfdcc,0xfdcdfdc9,0xfdcafdc6,0xfdcafdcc,
-0xfdcafdca,0xfdc7fdc4,0xfdc3fdc6,0xfdc1fdc6,0xfdbdfdc8,0xfdb7fdc0,0xfdbefdc4,0xfdc3fdc1,
-0xfdc5fdc1,0xfdc9fdc7,0xfdd4fdcb,0xfddffdda,0xfdf4fdec,0xfe0efdff,0xfe27fe13,0xfe3cfe2d,
-0xfe5dfe4a,0xfe7cfe70,0xfe90fe87,0xfeadfe9e,0xfec5feba,0xfedbfecf,0xfedffee0,0xfee3fee5,
-0xfee9feea,0xfee4fee9,0xfedafee1,0xfecffed9,0xfec1fec9,0xfeb8febe,0xfeaffeb6,0xfeaefeb1,
-0xfeb6feb1,0xfebcfeb6,0xfec9febf,0xfeddfed4,0xfefcfeed,0xff1eff09,0xff3eff2b,0xff68ff4f,
-0xff8eff7b,0xffafffa3,0xffdfffcb,0x000efff6,0x00390020,0x0069004b,0x0095007d,0x00d300b4,
-0x011100f5,0x014f0134,0x01960174,0x01d801bc,0x02230200,0x0271024a,0x02c402a1,0x030f02e9,
-0x035c0335,0x03970379,0x03d703b5,0x040b03ef,0x0434041d,0x04570446,0x046f0465,0x04830476,
-0x048a0487,0x0493048a,0x0487048a,0x047b0485,0x04720476,0x04610465,0x0458045b,0x0449044f,
-0x0436043d,0x0421042d,0x040d0416,0x03f303fb,0x03da03eb,0x03c303d0,0x03b403bc,0x039c03a8,
-0x03880392,0x0371037e,0x035e0367,0x034f0356,0x0343034c,0x033c033d,0x032f0333,0x031f032b,
-0x0316031a,0x03120315,0x0306030c,0x02fb0303,0x02ef02f1,0x02df02e2,0x02c902cb,0x02ae02b5,
-0x028d0294,0x0270027d,0x024c025c,0x0228023f,0x01fc021d,0x01d301ed,0x01a401b8,0x01750190,
-0x0145015f,0x011c0130,0x00f40108,0x00cb00e5,0x00ac00c1,0x0091009d,0x00770085,0x005a0069,
-0x0045004f,0x00250036,0x0004001f,0xffe2fff2,0xffbbffcc,0xff7affa2,0xff3cff5e,0xfef2ff1d,
-0xfe9efec9,0xfe44fe73,0xfde7fe14,0xfd77fdac,0xfd13fd46,0xfcabfce0,0xfc54fc79,0xfc05fc22,
-0xfbb5fbd5,0xfb6efb92,0xfb3efb58,0xfb1afb2e,0xfb08fb19,0xfaf9fafe,0xfb03fb01,0xfb12fb04,
-0xfb29fb19,0xfb4bfb38,0xfb6ffb63,0xfb9afb85,0xfbc7fbb1,0xfbf6fbdb,0xfc1cfc02,0xfc47fc32,
-0xfc6dfc5c,0xfc91fc82,0xfcb7fca7,0xfcd4fcc5,0xfceafcde,0xfcfffcf5,0xfd11fd06,0xfd1efd1c,
-0xfd25fd27,0xfd23fd28,0xfd20fd24,0xfd17fd21,0xfd00fd12,0xfceefcf8,0xfcd0fce1,0xfca5fcb8,
-0xfc84fc92,0xfc63fc74,0xfc3bfc4f,0xfc18fc28,0xfbf8fc0a,0xfbdafbed,0xfbbbfbcc,0xfba8fbb0,
-0xfb92fb9f,0xfb81fb8a,0xfb74fb75,0xfb6dfb6c,0xfb70fb6f,0xfb76fb6f,0xfb72fb72,0xfb82fb7a,
-0xfb90fb87,0xfbaffb9d,0xfbc8fbb7,0xfbebfbd5,0xfc16fbfb,0xfc43fc26,0xfc75fc5d,0xfcabfc92,
-0xfcf1fccf,0xfd32fd12,0xfd7afd55,0xfdcbfda9,0xfe1ffdf2,0xfe6ffe43,0xfeccfea2,0xff1ffef9,
-0xff72ff47,0xffc9ff9b,0x001bffeb,0x00610040,0x00ae0088,0x00f000ce,0x01300108,0x0169014d,
-0x0195017f,0x01c301ad,0x01ef01de,0x021801fd,0x023c0227,0x02680251,0x0294027b,0x02bf02a7,
-0x02eb02d5,0x03170300,0x034b032e,0x036e035a,0x03960389,0x03b903ad,0x03eb03d7,0x040903fe,
-0x04280419,0x04400438,0x04580451,0x04640462,0x04840473,0x048f0488,0x049c0496,0x04ab04a9,
-0x04b404af,0x04bd04bb,0x04c204c3,0x04cd04ce,0x04d004d3,0x04d304d5,0x04d704d5,0x04d704d9,
-0x04d904d5,0x04d304ce,0x04ce04cc,0x04c404c7,0x04be04bf,0x04ae04b4,0x04a304aa,0x048d0499,
-0x047a0486,0x045b046d,0x043e044c,0x041c0425,0x03ee0400,0x03be03d4,0x0382039b,0x0351036c,
-0x03100330,0x02cc02f2,0x028a02ad,0x02470268,0x02070225,0x01c601e9,0x018101a2,0x013d0158,
-0x00f5011c,0x00b200d2,0x0063008b,0x0012003e,0xffbffff1,0xff7affa6,0xff32ff56,0xfee4ff06,
-0xfe94fec1,0xfe50fe6f,0xfe13fe35,0xfddffdf5,0xfdb6fdc9,0xfd94fd9f,0xfd84fd8c,0xfd78fd7e,
-0xfd7cfd7d,0xfd8cfd86,0xfda3fd96,0xfdc5fdac,0xfde9fdcd,0xfe0dfdfb,0xfe3cfe22,0xfe6afe57,
-0xfe9afe82,0xfec4feb4,0xfef7fee1,0xff1dff13,0xff51ff39,0xff7cff6d,0xffadff93,0xffd6ffbf,
-0x000bffec,0x00380022,0x0067004f,0x008f0075,0x00b50097,0x00d600c4,0x00f100e7,0x010000fd,
-0x010e0109,0x01140117,0x010f0115,0x01070108,0x00f600fc,0x00e000eb,0x00ba00d1,0x009800b1,
-0x0078008d,0x00530066,0x00350042,0x000f001b,0xffe7fff8,0xffc0ffcb,0xff93ffa5,0xff66ff79,
-0xff45ff53,0xff18ff24,0xfeedfefd,0xfebbfed2,0xfe9afea6,0xfe64fe7c,0xfe3cfe4e,0xfe0cfe2b,
-0xfde5fdff,0xfdc2fddb,0xfda1fdb3,0xfd84fd98,0xfd69fd7d,0xfd4bfd55,0xfd3afd42,0xfd2cfd2f,
-0xfd16fd17,0xfd0efd0f,0xfd03fd05,0xfcf5fcfa,0xfcecfcf0,0xfce5fce9,0xfcebfce6,0xfcf3fcec,
-0xfcfefcf6,0xfd14fd0a,0xfd30fd21,0xfd4cfd43,0xfd72fd62,0xfda4fd90,0xfddefdc0,0xfe09fdee,
-0xfe3ffe20,0xfe77fe59,0xfea0fe8e,0xfecdfeb6,0xfef9fedf,0xff1cff06,0xff3bff28,0xff51ff40,
-0xff71ff62,0xff7dff72,0xff90ff8d,0xffa7ffa0,0xffbdffb5,0xffd6ffcb,0xffdfffd2,0xfff0ffdf,
-0xfffcfff0,0x00090002,0x00240012,0x0034002c,0x004d0044,0x0069005f,0x00900080,0x00bb00a8,
-0x00f200da,0x012a010f,0x01650148,0x01ae0189,0x01f301ce,0x02390214,0x027d025d,0x02bd02a6,
-0x02f602d9,0x031d030a,0x033a032f,0x03500344,0x035a0354,0x03550353,0x03480349,0x032b033a,
-0x030a0322,0x02e402f9,0x02bd02d3,0x029b02b2,0x02710289,0x0252025d,0x02340241,0x020f0223,
-0x01f701fe,0x01d601e5,0x01b701ca,0x019901a9,0x0173018a,0x014f0166,0x012e013d,0x01040117,
-0x00d000e8,0x00a800be,0x0076008e,0x0044005d,0x001b0034,0xffeafffc,0xffb9ffcf,0xff8fffa3,
-0xff61ff76,0xff35ff4e,0xff0bff20,0xfee3fefc,0xfeb1feca,0xfe8bfea1,0xfe66fe77,0xfe3ffe54,
-0xfe14fe29,0xfdf6fe06,0xfdddfde5,0xfdc6fdcf,0xfdbdfdc5,0xfdbdfdbf,0xfdc3fdc0,0xfdd7fdcb,
-0xfdf8fde6,0xfe1ffe07,0xfe47fe31,0xfe7dfe61,0xfeb5fe96,0xfeeafece,0xff29ff0a,0xff61ff44,
-0xff8eff7c,0xffc6ffaf,0xffe8ffd8,0x000dfffc,0x002a001d,0x00410039,0x004f004a,0x005b005e,
-0x005f005c,0x0056005c,0x00500053,0x00310043,0x00110024,0xffed0005,0xffb7ffcd,0xff7cff9a,
-0xff32ff56,0xfee8ff06,0xfe8bfeb5,0xfe2bfe5f,0xfdcbfe02,0xfd74fda4,0xfd14fd3f,0xfcc5fcf0,
-0xfc7bfca3,0xfc38fc58,0xfc03fc19,0xfbdafbee,0xfbc4fbd1,0xfbbbfbc4,0xfbcbfbc8,0xfbe5fbdb,
-0xfc12fbf8,0xfc52fc32,0xfc99fc6f,0xfce8fcc5,0xfd40fd19,0xfda2fd73,0xfe06fdd1,0xfe64fe32,
-0xfec4fe91,0xff12feee,0xff5bff35,0xff9fff7d,0xffd4ffbc,0x0002ffee,0x001c000f,0x0030002a,
-0x00400037,0x00470046,0x00470047,0x00420046,0x003f0048,0x003e004c,0x004b004c,0x004c004d,
-0x005d0053,0x006d0067,0x00810077,0x009d008e,0x00bd00ad,0x00e200cd,0x00f800f1,0x011b010a,
-0x01330123,0x0148013e,0x015d0151,0x016e0165,0x017a0171,0x018b0184,0x0195018b,0x01a5019c,
-0x01b801ac,0x01c801c0,0x01e301d8,0x020501f8,0x0233021b,0x025c0246,0x028e0271,0x02b902a4,
-0x02f102db,0x03260310,0x035e0343,0x039b037f,0x03ca03ad,0x03f203de,0x041d0408,0x044e0438,
-0x04700460,0x0498047f,0x04b504a1,0x04cc04bd,0x04e804da,0x04fb04ed,0x05170505,0x052b051d,
-0x05440531,0x05540548,0x056a0560,0x05790575,0x05860582,0x05900595,0x059e059a,0x059f05a1,
-0x05970596,0x057d058a,0x0566056e,0x05350550,0x0500051a,0x04b904e1,0x046d0496,0x040c043b,
-0x03a403d5,0x03350374,0x02c50300,0x0251028b,0x01de0219,0x017601aa,0x01060141,0x00a400d5,
-0x00510075,0x000d002a,0xffccffea,0xff96ffa9,0xff6eff81,0xff4bff5b,0xff2eff3c,0xff19ff24,
-0xff11ff10,0xff06ff10,0xff05ff05,0xff08ff0d,0xff11ff0a,0xff16ff17,0xff1cff19,0xff1bff21,
-0xff1dff1e,0xff0fff0e,0xfef8fef9,0xfed9fee1,0xfeb0fec0,0xfe75fe94,0xfe38fe57,0xfdebfe12,
-0xfd9dfdc9,0xfd57fd76,0xfd0ffd2f,0xfcc2fce7,0xfc85fca4,0xfc52fc6b,0xfc22fc3b,0xfc05fc13,
-0xfbeefbf9,0xfbddfbe6,0xfbd6fbd8,0xfbcdfbca,0xfbc0fbcb,0xfbb4fbbe,0xfba3fbad,0xfb87fb99,
-0xfb6dfb7f,0xfb4bfb62,0xfb1ffb39,0xfaf5fb0b,0xfaccfae2,0xfa9ffab9,0xfa71fa89,0xfa46fa60,
-0xfa24fa32,0xfa11fa11,0xf9fdfa04,0xf9f7f9fc,0xfa01fa02,0xfa19fa10,0xfa45fa2b,0xfa77fa59,
-0xfabffa94,0xfb0cfae4,0xfb62fb30,0xfbc9fb8f,0xfc2dfbf7,0xfc93fc5e,0xfcf8fcc3,0xfd4efd27,
-0xfd9bfd83,0xfde5fdc8,0xfe27fe11,0xfe58fe3b,0xfe77fe65,0xfe90fe83,0xfe9bfe9a,0xfe9efe9c,
-0xfea1fea2,0xfe9afe9d,0xfe8ffe9a,0xfe8afe93,0xfe7efe80,0xfe7dfe78,0xfe7dfe79,0xfe7efe75,
-0xfe89fe7b,0xfe8cfe85,0xfea3fe9c,0xfebbfeb2,0xfee9fed4,0xff10fefc,0xff3eff28,0xff79ff5e,
-0xffadff97,0xffe9ffc9,0x001e0005,0x00530035,0x0087006e,0x00ba00a4,0x00e200c9,0x00f600ef,
-0x010a00ff,0x01180115,0x0119011d,0x010e0117,0x01030108,0x00ed00f9,0x00d800e0,0x00ba00c8,
-0x009d00a6,0x00880095,0x00800084,0x007b0083,0x00910087,0x00af00a6,0x00d500c4,0x011200f6,
-0x015a0133,0x01ac0185,0x020401d5,0x026b0233,0x02c60293,0x032a02fe,0x037f0358,0x03cd03ac,
-0x041503f3,0x04460432,0x0474045f,0x048b0476,0x048e0487,0x048c0485,0x04700474,0x044f045a,
-0x042b043a,0x03fd0410,0x03c603e2,0x039003a6,0x035f037a,0x032d034b,0x03000311,0x02d002e4,
-0x02a202ac,0x02840298,0x026d027a,0x0266026d,0x026c026a,0x0275026e,0x028c027e,0x02a70299,
-0x02d002bb,0x030002e8,0x032d0317,0x0365034b,0x039f0384,0x03c603b1,0x03f303d8,0x040f03fe,
-0x0421041d,0x0436042d,0x04290436,0x0425042e,0x041b0422,0x03fc040a,0x03d803ed,0x03ac03c2,
-0x0375038e,0x033b0352,0x02fd031a,0x02b902db,0x02750298,0x022d0251,0x01e6020e,0x019e01c8,
-0x01560182,0x010a012f,0x00c400e7,0x0085009c,0x00350058,0xfff1000d,0xffa7ffc8,0xff61ff80,
-0xff12ff36,0xfec9feea,0xfe77fe9d,0xfe22fe4a,0xfdd1fdfa,0xfd76fda4,0xfd25fd54,0xfcd4fcfd,
-0xfc81fcb0,0xfc32fc5b,0xfbeffc12,0xfbabfbcb,0xfb77fb8c,0xfb4afb5d,0xfb31fb35,0xfb21fb24,
-0xfb20fb1f,0xfb2ffb2e,0xfb4cfb41,0xfb71fb64,0xfbb0fb91,0xfbfdfbd6,0xfc4bfc22,0xfca2fc76,
-0xfd00fcd1,0xfd5dfd2e,0xfdb8fd8c,0xfe20fdee,0xfe77fe4f,0xfed1fea2,0xff23fefb,0xff73ff4a,
-0xffbeff99,0xfffdffdc,0x00390017,0x00770054,0x009e0085,0x00c800b6,0x00e300dc,0x00fe00f5,
-0x0114010d,0x0119011b,0x0122011f,0x011b0122,0x01120117,0x0102010a,0x00f200f5,0x00d300e5,
-0x00b700c7,0x00a000ab,0x007d008d,0x00580067,0x00370049,0x0014002c,0xfff20004,0xffd2ffe7,
-0xffafffc0,0xff8dff98,0xff70ff78,0xff4bff59,0xff2bff37,0xff0cff19,0xfef3ff00,0xfed5fedb,
-0xfeb7fec1,0xfe99fe9f,0xfe7cfe8b,0xfe6afe73,0xfe57fe61,0xfe53fe56,0xfe50fe51,0xfe55fe53,
-0xfe5cfe56,0xfe6bfe64,0xfe7cfe71,0xfe89fe7d,0xfea2fe97,0xfeb1feac,0xfec5febf,0xfed6fecb,
-0xfee9fee2,0xfef9fef6,0xff12ff08,0xff28ff1c,0xff41ff30,0xff5dff4f,0xff7fff71,0xffa3ff90,
-0xffc6ffb1,0xffe8ffd9,0x0012fffd,0x00390029,0x006c0056,0x00920084,0x00bc00aa,0x00dd00d1,
-0x010200e9,0x011e010d,0x01330120,0x013b0138,0x01470143,0x014c0149,0x01480148,0x01400141,
-0x012e0135,0x0119012a,0x01070114,0x00e700fb,0x00d200e3,0x00bb00cb,0x00ac00b5,0x009a00a1,
-0x008d0094,0x008e008a,0x009a0091,0x00aa0099,0x00b700af,0x00d600c8,0x00fc00e8,0x012d0114,
-0x014f0143,0x01780168,0x019d0189,0x01be01ab,0x01d801cb,0x01f301e8,0x01f801f5,0x020001f9,
-0x01f901f8,0x01ec01f7,0x01d601e4,0x01b501ce,0x019d01ae,0x0179018d,0x01550166,0x0124013f,
-0x00f7010f,0x00c600e0,0x008d00a4,0x00530067,0x00140036,0xffcdffec,0xff86ffa9,0xff37ff60,
-0xfee9ff13,0xfe9dfec8,0xfe59fe84,0xfe10fe45,0xfddafdfb,0xfda5fdc1,0xfd74fd8f,0xfd4afd61,
-0xfd31fd3e,0xfd20fd29,0xfd06fd16,0xfd04fd09,0xfcfefd04,0xfd00fcfc,0xfd07fd07,0xfd0afd02,
-0xfd21fd0b,0xfd1ffd1a,0xfd25fd22,0xfd3afd36,0xfd49fd43,0xfd5dfd57,0xfd6ffd64,0xfd7ffd76,
-0xfd94fd95,0xfda1fd99,0xfdbafdb1,0xfdccfdce,0xfde2fddf,0xfdfafdf4,0xfe0efe08,0xfe2afe25,
-0xfe46fe3a,0xfe65fe58,0xfe8ffe79,0xfebefea0,0xfeeafecc,0xff0ffef9,0xff38ff29,0xff68ff53,
-0xff8eff7e,0xffb1ffa3,0xffdcffcc,0xfffaffe7,0x00130002,0x00230018,0x002b001d,0x002e0029,
-0x00280025,0x00220021,0x00110016,0x00040009,0xffeefffa,0xffdaffe9,0xffc2ffd9,0xffbaffc1,
-0xffa9ffb6,0xffa1ffa4,0xff98ff96,0xff99ff90,0xff9fff96,0xffa6ffa2,0xffb9ffb0,0xffdbffcc,
-0x0002fff0,0x00270017,0x0057003e,0x00940072,0x00c900a6,0x010a00e9,0x014f0131,0x018b016f,
-0x01d301b1,0x021401f4,0x02480230,0x02780264,0x02a50298,0x02c802b8,0x02e902d2,0x02fb02ee,
-0x030102fd,0x030002fa,0x02f602f6,0x02e502f2,0x02d202df,0x02be02cf,0x02aa02bc,0x029602a1,
-0x028c0291,0x0283028c,0x02830284,0x02820282,0x028d0287,0x0292028e,0x029c0295,0x02a902a5,
-0x02aa02aa,0x02ab02a7,0x02ae02b1,0x02ac02aa,0x02a702a6,0x02a002a7,0x02a302a3,0x02ab02a4,
-0x02ac02a5,0x02b202ac,0x02c502bf,0x02da02d1,0x02f502e9,0x0316030c,0x032d0323,0x0346033c,
-0x035f0354,0x03700362,0x037a0377,0x037f037e,0x0371037b,0x035a0366,0x03390352,0x0314032a,
-0x02e402fa,0x02b402d8,0x028a02a0,0x02600274,0x023a024a,0x02110222,0x01f80205,0x01e601ec,
-0x01cc01d0,0x01bb01c0,0x01ac01b6,0x019b01a7,0x018a0190,0x01780184,0x015b016f,0x0138014c,
-0x01100126,0x00e800f7,0x00bd00ca,0x0086009d,0x004d0061,0x00120028,0xffd7fff6,0xffa0ffbc,
-0xff6fff88,0xff36ff54,0xff03ff1d,0xfed0feec,0xfe9ffeb1,0xfe69fe85,0xfe3efe54,0xfe12fe2c,
-0xfdebfe05,0xfdc0fddd,0xfd9cfdae,0xfd68fd81,0xfd43fd53,0xfd13fd27,0xfcedfd03,0xfcc1fcd0,
-0xfca1fca9,0xfc77fc8c,0xfc60fc69,0xfc4afc50,0xfc3efc49,0xfc30fc39,0xfc32fc33,0xfc39fc3b,
-0xfc36fc35,0xfc41fc3c,0xfc49fc47,0xfc4cfc4b,0xfc52fc52,0xfc5afc55,0xfc5cfc59,0xfc61fc59,
-0xfc62fc5b,0xfc66fc5b,0xfc5efc5e,0xfc60fc59,0xfc5bfc5d,0xfc53fc59,0xfc4efc52,0xfc37fc41,
-0xfc2bfc38,0xfc16fc1e,0xfbfcfc04,0xfbccfbe6,0xfbaafbc2,0xfb87fb97,0xfb5dfb76,0xfb43fb53,
-0xfb1bfb2c,0xfb09fb14,0xfafbfafd,0xfaeffaf3,0xfaf5faf0,0xfb12fafd,0xfb2efb1c,0xfb4ffb3c,
-0xfb83fb63,0xfbb6fb96,0xfbecfbcf,0xfc27fc0b,0xfc61fc42,0xfca1fc7e,0xfce3fcc0,0xfd27fcfc,
-0xfd6bfd44,0xfdb0fd83,0xfdecfdd0,0xfe35fe13,0xfe82fe62,0xfec6fe9c,0xff0cfef1,0xff5bff39,
-0xffa9ff82,0xfff7ffd1,0x0042001c,0x00840060,0x00c400a1,0x010400e9,0x013f0125,0x017b015b,
-0x01a2018d,0x01d301bb,0x01f601e3,0x02160209,0x022f0226,0x024e0241,0x025d0252,0x0263025c,
-0x02650268,0x026d026b,0x02710279,0x026f0272,0x02740270,0x0272026c,0x026c026b,0x026d026a,
-0x02770273,0x027e0274,0x0280027f,0x0290028e,0x029d0299,0x02b502aa,0x02be02bf,0x02d602cd,
-0x02eb02e0,0x02f802f6,0x030402ff,0x03140310,0x03170312,0x031d031a,0x031e031d,0x03130316,
-0x030f0311,0x02fd0305,0x02ef02f4,0x02e902ea,0x02dc02e3,0x02d602d9,0x02ca02d2,0x02ca02cc,
-0x02cc02ce,0x02cc02d2,0x02d502d8,0x02ea02e3,0x030302f5,0x03170307,0x03280320,0x033c032f,
-0x03510346,0x035a035a,0x0366035b,0x03710368,0x0373036f,0x036a036f,0x035a0368,0x03440353,
-0x03230335,0x03040317,0x02d402ea,0x02a202be,0x02660282,0x022b0249,0x01e6020b,0x01a001c5,
-0x01600181,0x01200142,0x00e700ff,0x00b500c8,0x00830098,0x0059006e,0x003a0043,0x002d002c,
-0x00250022,0x00220027,0x00330029,0x004f0043,0x006c005d,0x0091007b,0x00b500a4,0x00e300cd,
-0x010800f5,0x012b011f,0x01410139,0x0151014e,0x01500155,0x014f0152,0x01360142,0x0119012c,
-0x00ea0100,0x00b300cc,0x006f0091,0x001e0046,0xffcafff5,0xff7dffae,0xff39ff5c,0xfeebff14,
-0xfea7fec6,0xfe6bfe87,0xfe32fe4a,0xfdfcfe11,0xfdd5fde8,0xfdb6fdc6,0xfd98fda6,0xfd7ffd92,
-0xfd72fd78,0xfd67fd6b,0xfd5bfd5c,0xfd4bfd54,0xfd3efd43,0xfd33fd36,0xfd1bfd2c,0xfd03fd10,
-0xfceafcfa,0xfccefcdc,0xfcaffcb8,0xfc8cfc9d,0xfc6dfc7e,0xfc58fc63,0xfc3efc4c,0xfc2cfc31,
-0xfc25fc27,0xfc2ffc2d,0xfc44fc37,0xfc5cfc48,0xfc84fc6d,0xfcb7fc9b,0xfcfafcda,0xfd45fd26,
-0xfd9afd70,0xfdf1fdc6,0xfe44fe1a,0xfe9afe72,0xfeeffec9,0xff3eff1a,0xff90ff6a,0xffdaffb4,
-0x0018fff5,0x00570032,0x00890073,0x00be00a8,0x00ed00d7,0x01180107,0x0144012e,0x0163014f,
-0x017d0171,0x01900186,0x01aa019f,0x01bd01b4,0x01c101c1,0x01ca01c3,0x01c201c8,0x01bc01be,
-0x01bb01c4,0x01b301bb,0x01ad01b1,0x01a101a6,0x01880190,0x01780181,0x0163016e,0x01480158,
-0x0130013a,0x010e011d,0x00ee00fc,0x00ca00e0,0x00a900bb,0x00810094,0x005d006e,0x00320042,
-0x00110020,0xfff10005,0xffd3ffe7,0xffbcffca,0xffa5ffbb,0xffa3ffac,0xff96ffa3,0xff90ff93,
-0xff93ff98,0xff91ff9c,0xff99ff99,0xff9cffa0,0xffa9ffa6,0xff9fffa6,0xffa8ffa6,0xffa4ffa9,
-0xff9dffa1,0xff9aff9a,0xff95ff99,0xff90ff95,0xff96ff94,0xff94ff90,0xff9eff92,0xffa0ff99,
-0xffa6ff9e,0xffadffa5,0xffb5ffac,0xffb7ffb4,0xffb5ffb8,0xffb2ffb9,0xffafffba,0xff9fffad,
-0xff95ff9e,0xff89ff89,0xff7aff7a,0xff63ff72,0xff4fff59,0xff39ff4a,0xff30ff3b,0xff26ff32,
-0xff21ff1f,0xff1dff20,0xff27ff1d,0xff35ff27,0xff43ff37,0xff58ff4b,0xff74ff60,0xff8aff7e,
-0xffa9ff93,0xffcfffbb,0xffeaffdd,0x0016fffe,0x002f0022,0x004e0044,0x006f0064,0x00910080,
-0x00a50099,0x00b800b2,0x00c100be,0x00bc00c0,0x00b600b5,0x009d00a7,0x00800095,0x00600070,
-0x0033004c,0x0007001d,0xffdaffef,0xffb4ffc7,0xff8cffa1,0xff6bff74,0xff4fff59,0xff3aff45,
-0xff29ff31,0xff1eff23,0xff1dff1c,0xff19ff1c,0xff12ff16,0xff14ff16,0xff08ff0c,0xfefdff04,
-0xfee2feef,0xfecbfed7,0xfeaafeba,0xfe86fe9c,0xfe5ffe74,0xfe33fe49,0xfe0cfe1c,0xfde0fdf8,
-0xfdc4fdcd,0xfda3fdb5,0xfd8ffd9c,0xfd87fd8b,0xfd80fd7b,0xfd81fd81,0xfd84fd87,0xfd9bfd9d,
-0xfdb4fdaa,0xfdcefdc2,0xfdf1fde6,0xfe1afe0c,0xfe4dfe35,0xfe78fe62,0xfeaafe94,0xfee1fec6,
-0xff0efef8,0xff43ff2b,0xff7bff5b,0xffacff8f,0xffe2ffc3,0x0014ffff,0x0043002a,0x0078005b,
-0x00a20086,0x00c500b5,0x00e400d6,0x010d00f8,0x01250113,0x01370126,0x0145013d,0x0152014a,
-0x015f015d,0x0172016d,0x017d0176,0x018f0183,0x019e0195,0x01b301a7,0x01c601ba,0x01d401cb,
-0x01e901df,0x020401f9,0x0218020b,0x022a021d,0x022f022f,0x02340234,0x0234023f,0x0236023b,
-0x0231023b,0x02260230,0x02160227,0x020c021f,0x01ff020a,0x01f801fd,0x01e401ea,0x01d701da,
-0x01c901cd,0x01c501c8,0x01c501c0,0x01c701c5,0x01d701d6,0x01e901e3,0x020301f9,0x02290214,
-0x02520236,0x0287026c,0x02b6029f,0x02e802cd,0x03180300,0x034a032f,0x0373035a,0x039c0386,
-0x03b503ad,0x03c303c1,0x03ce03c8,0x03ce03ce,0x03b403bb,0x039503a7,0x036c0384,0x033d0351,
-0x0301031e,0x02c502e4,0x028502ad,0x0247026b,0x02040229,0x01cc01e4,0x019101a9,0x0161017b,
-0x013a014b,0x01180123,0x00f70104,0x00e500ea,0x00d300db,0x00cb00cd,0x00d300c8,0x00cc00ce,
-0x00e500db,0x00f600ef,0x01100102,0x011e011f,0x013a0130,0x014e014e,0x0165015e,0x0176016f,
-0x0186017f,0x017c017e,0x01760179,0x01640169,0x014b0154,0x01200137,0x00f20105,0x00bc00d3,
-0x007e009f,0x003f005d,0xfff9001a,0xffb0ffd8,0xff6eff91,0xff2bff53,0xfeedff13,0xfeb7fed2,
-0xfe85fe9d,0xfe58fe68,0xfe26fe3d,0xfdf8fe07,0xfdc9fdde,0xfda5fdb5,0xfd8afd90,0xfd63fd74,
-0xfd3cfd5a,0xfd21fd30,0xfcfcfd0f,0xfce7fcf5,0xfcc9fcda,0xfcaffcb9,0xfc91fca8,0xfc7cfc90,
-0xfc63fc74,0xfc4efc5a,0xfc3dfc46,0xfc20fc30,0xfc12fc1e,0xfbfbfc05,0xfbebfbf0,0xfbd1fbda,
-0xfbbafbc7,0xfba8fbaf,0xfb92fb9b,0xfb82fb8f,0xfb6ffb7d,0xfb5bfb64,0xfb4efb56,0xfb4cfb4d,
-0xfb46fb42,0xfb50fb4d,0xfb5cfb56,0xfb6ffb5e,0xfb80fb78,0xfba3fb93,0xfbc7fbb4,0xfbeffbdb,
-0xfc28fc0c,0xfc5bfc3d,0xfc87fc6a,0xfcb8fc9e,0xfcf1fcd3,0xfd18fd03,0xfd42fd30,0xfd65fd53,
-0xfd7ffd74,0xfd9cfd96,0xfdb4fdab,0xfdc9fdbe,0xfdd5fdd4,0xfdeafdde,0xfdf7fdec,0xfe08fdfb,
-0xfe16fe0b,0xfe23fe1a,0xfe34fe2a,0xfe43fe3b,0xfe58fe4b,0xfe69fe62,0xfe7cfe70,0xfe98fe8b,
-0xfeadfea6,0xfecbfebf,0xfee9fed5,0xfefdfeed,0xff1cff0d,0xff36ff26,0xff52ff45,0xff6dff5d,
-0xff86ff78,0xffa4ff9a,0xffc4ffb1,0xffe1ffcf,0x0000fff0,0x00250015,0x00480038,0x007c0068,
-0x00b3009d,0x00f500d3,0x01350116,0x017a0158,0x01bb019c,0x020701e3,0x02470229,0x02910269,
-0x02cd02ad,0x030c02ed,0x033d0320,0x036f0352,0x038d037c,0x03a7039d,0x03b603b2,0x03c803c3,
-0x03cb03ce,0x03d403d2,0x03d103d2,0x03d603d6,0x03d203d1,0x03d203d1,0x03cd03ca,0x03c303c9,
-0x03bd03c7,0x03b703bb,0x03b003b4,0x03a003a7,0x039703a3,0x038a0397,0x037b0383,0x0363036a,
-0x03480352,0x032e0337,0x030b0323,0x02eb0300,0x02d402e6,0x02b202c2,0x029302a4,0x02730280,
-0x025c0261,0x0242024c,0x022c0234,0x0218021e,0x02100217,0x02050205,0x02070204,0x02070202,
-0x02090202,0x02030206,0x020e020f,0x020f0213,0x02120217,0x021a0219,0x02170216,0x020f0210,
-0x01fc0209,0x01e301ef,0x01d501dc,0x01ad01c4,0x018f019c,0x015f017b,0x0138014f,0x0107011d,
-0x00cf00ea,0x009b00b2,0x00650079,0x00360043,0x00030016,0xffd7ffec,0xffafffbd,0xff8eff9e,
-0xff77ff7b,0xff60ff5f,0xff4aff4a,0xff41ff42,0xff3cff3e,0xff37ff42,0xff48ff46,0xff51ff4f,
-0xff60ff59,0xff72ff67,0xff7fff75,0xff89ff84,0xff9cff92,0xff9fff9e,0xffacffa3,0xffb0ffad,
-0xffb7ffb7,0xffb5ffba,0xffaeffb9,0xffa5ffaa,0xff9effa6,0xff92ff97,0xff79ff84,0xff5dff6e,
-0xff3fff4c,0xff1eff33,0xfefcff0f,0xfee2feee,0xfeb9fecd,0xfe94fea8,0xfe71fe80,0xfe50fe5c,
-0xfe35fe41,0xfe18fe24,0xfe0dfe18,0xfdfdfdfd,0xfe05fe03,0xfdfafe00,0xfe13fe0d,0xfe16fe11,
-0xfe29fe1e,0xfe34fe2f,0xfe43fe3e,0xfe4ffe4d,0xfe54fe52,0xfe59fe4f,0xfe50fe4d,0xfe49fe48,
-0xfe3cfe40,0xfe2ffe31,0xfe15fe20,0xfe07fe11,0xfdfafe02,0xfde7fdf1,0xfdd4fde1,0xfdcffdd3,
-0xfdc7fdc7,0xfdc0fdc5,0xfdbefdc0,0xfdcafdce,0xfdd6fdd1,0xfde0fde1,0xfdfffdfb,0xfe29fe21,
-0xfe58fe44,0xfe81fe6e,0xfeb9fe9e,0xfeebfed4,0xff27ff0f,0xff5fff4b,0xff9dff86,0xffdbffb7,
-0x000effed,0x00390022,0x006d0050,0x0087007a,0x00ab0095,0x00be00b7,0x00d600d1,0x00e300db,
-0x00f000ec,0x00f400f1,0x00fe00f7,0x01010101,0x010c0107,0x011a0111,0x011e011c,0x01250124,
-0x012c012b,0x0133012b,0x01370131,0x01390138,0x01350137,0x01320136,0x012e0132,0x012b0129,
-0x01200124,0x0114011a,0x01060113,0x01070107,0x00ff0103,0x010b0106,0x010b0106,0x011a0110,
-0x012a0124,0x01430135,0x0160014e,0x017d016e,0x018e0185,0x01ac019a,0x01b801af,0x01c501be,
-0x01cd01d0,0x01cc01d6,0x01ca01d1,0x01bf01cc,0x01b001b7,0x019c01a6,0x0185018d,0x01620171,
-0x01450156,0x01220133,0x00fe0109,0x00d600e4,0x00b300c1,0x008b00a4,0x006c0075,0x00450055,
-0x00250033,0x00120020,0xfff3000d,0xffe1fff6,0xffd5ffda,0xffc9ffcc,0xffc4ffc5,0xffbaffbc,
-0xffb0ffb5,0xffa7ffae,0xffa0ffa1,0xff97ff9b,0xff84ff91,0xff7bff87,0xff72ff73,0xff68ff6a,
-0xff50ff58,0xff41ff46,0xff37ff3d,0xff2bff31,0xff1eff23,0xff1aff16,0xff11ff11,0xff0eff0a,
-0xff18ff13,0xff1fff20,0xff2cff2c,0xff4aff3c,0xff64ff5b,0xff74ff6c,0xff96ff84,0xffadff9c,
-0xffc6ffb7,0xffdcffd1,0xfff3ffe5,0x000c0003,0x00180016,0x00290027,0x003c0034,0x003e0039,
-0x003d0037,0x00350035,0x0025002b,0x000e001c,0xffea0001,0xffb9ffd6,0xff8cffaa,0xff53ff75,
-0xff1bff37,0xfedefefe,0xfe9efebc,0xfe5afe7b,0xfe1efe3d,0xfde7fe01,0xfdb7fdc6,0xfd86fd9e,
-0xfd64fd79,0xfd4dfd56,0xfd36fd42,0xfd33fd36,0xfd2bfd2e,0xfd28fd2a,0xfd2dfd27,0xfd2ffd30,
-0xfd37fd34,0xfd41fd3f,0xfd46fd43,0xfd52fd4a,0xfd5bfd57,0xfd62fd5e,0xfd72fd6c,0xfd86fd7c,
-0xfda1fd8f,0xfdb6fda6,0xfdd9fdc4,0xfdfdfded,0xfe29fe0f,0xfe57fe3a,0xfe8ffe77,0xfec1feb0,
-0xff00fee6,0xff3bff1f,0xff7aff57,0xffb0ff91,0xffe9ffc9,0x00200009,0x00540036,0x00860069,
-0x00aa0092,0x00d400b7,0x00f000db,0x010a00fc,0x011d0117,0x01350129,0x01370137,0x01480144,
-0x0149014a,0x014c014c,0x014a014c,0x01410149,0x013d013d,0x012a0130,0x011e0128,0x010d0116,
-0x01050107,0x00fe0101,0x00fe00fc,0x00f300f0,0x010000f7,0x010b0106,0x011e0115,0x013d0133,
-0x01600153,0x018a017d,0x01bc01ac,0x01f401dd,0x0228020d,0x026d0247,0x02a60283,0x02ea02ca,
-0x032b030a,0x036d0350,0x03a7038c,0x03e703c4,0x041403fe,0x043b0427,0x04550446,0x046c045d,
-0x0472046e,0x0463046a,0x04510460,0x0434044a,0x0412042a,0x03e303f9,0x03a503c6,0x0366038a,
-0x0328034e,0x02df030d,0x029b02bc,0x024d0272,0x020a0225,0x01bb01df,0x016c0192,0x011f0142,
-0x00db00ff,0x009900bb,0x005b0077,0x001e0039,0xffec0004,0xffbeffd4,0xff94ffb1,0xff7aff8c,
-0xff74ff7c,0xff6cff74,0xff6dff70,0xff74ff73,0xff88ff7e,0xff96ff8d,0xffa8ffa5,0xffbdffb5,
-0xffcfffcc,0xffd8ffd9,0xffe1ffe2,0xffdfffe2,0xffd9ffdb,0xffc7ffcb,0xffacffb8,0xff88ff95,
-0xff61ff72,0xff33ff4e,0xff09ff1c,0xfedcfeed,0xfea6fec1,0xfe7cfe96,0xfe56fe69,0xfe2cfe41,
-0xfe09fe17,0xfdeafdf8,0xfdd3fdda,0xfdc1fdc2,0xfda9fda9,0xfd96fd97,0xfd84fd88,0xfd6ffd76,
-0xfd5ffd6f,0xfd51fd59,0xfd43fd4e,0xfd30fd3a,0xfd26fd31,0xfd11fd1b,0xfd07fd0f,0xfcfbfd01,
-0xfcecfcee,0xfcd9fce3,0xfcd2fcd9,0xfccdfccd,0xfcc1fcc8,0xfcb9fcba,0xfcb1fcb7,0xfcaffcad,
-0xfcabfcab,0xfcaafca9,0xfca7fca4,0xfcaafcae,0xfcb5fcad,0xfcc5fcba,0xfcddfccc,0xfceffce6,
-0xfd0dfcfc,0xfd30fd24,0xfd5efd50,0xfd93fd79,0xfdd0fdaa,0xfe02fde5,0xfe45fe1f,0xfe86fe64,
-0xfec1fea4,0xff00fee4,0xff3bff22,0xff72ff5d,0xffa9ff93,0xffd6ffc7,0x000bffec,0x00350017,
-0x00590048,0x00770068,0x0091007d,0x009d009e,0x00ac00a2,0x00b700b6,0x00b900bc,0x00b000b6,
-0x009f00a9,0x008d0095,0x006e0085,0x004d005c,0x0027003c,0x00060012,0xffe3ffee,0xffc5ffd1,
-0xffa7ffb5,0xff93ff9c,0xff87ff8a,0xff8cff7d,0xff91ff85,0xffb0ff9e,0xffd5ffc5,0xfffaffea,
-0x00380020,0x007d005f,0x00c700a3,0x011300ea,0x0164013a,0x01ab0182,0x01f301cc,0x0241021f,
-0x02850263,0x02c302a2,0x02fb02db,0x032b0311,0x03580347,0x03790366,0x03930391,0x03ad03a8,
-0x03b703b9,0x03bd03c0,0x03c803c7,0x03c703c7,0x03c203c7,0x03b803bf,0x03aa03b5,0x03a803a7,
-0x039c03a3,0x03900391,0x038e038f,0x037f0383,0x037d037a,0x037c037b,0x03760378,0x03710376,
-0x036f0374,0x0367036c,0x0354035e,0x0339034c,0x031c032c,0x02f30314,0x02cd02e7,0x029a02bb,
-0x02650285,0x022a0248,0x01ec0212,0x01bd01d8,0x019301a7,0x01680179,0x01470159,0x01270134,
-0x011c0121,0x01110118,0x0114010c,0x01180110,0x011e0117,0x012a0123,0x01340131,0x013c013b,
-0x013d013f,0x013b013f,0x013c013d,0x01330135,0x011d0120,0x01060106,0x00e500ef,0x00bc00ce,
-0x009f00ac,0x0083008c,0x00530069,0x00330045,0x000d001b,0xffe5fff7,0xffc3ffd8,0xffa4ffb5,
-0xff7dff96,0xff5dff70,0xff40ff53,0xff1dff30,0xff01ff0f,0xfedffef1,0xfeb1fec2,0xfe8dfea0,
-0xfe5efe76,0xfe2cfe3f,0xfdf9fe12,0xfdc5fdde,0xfd85fda4,0xfd4ffd69,0xfd16fd32,0xfcdbfcf9,
-0xfca4fcba,0xfc74fc8a,0xfc44fc5c,0xfc1cfc2d,0xfbfafc06,0xfbe2fbec,0xfbd0fbd8,0xfbc8fbcc,
-0xfbc7fbc6,0xfbd0fbd2,0xfbddfbda,0xfbf8fbf1,0xfc13fc06,0xfc3dfc2d,0xfc60fc54,0xfc93fc7d,
-0xfcc6fcb0,0xfcfefce4,0xfd34fd1c,0xfd66fd51,0xfd95fd81,0xfdc2fda6,0xfdebfdda,0xfe11fe00,
-0xfe30fe26,0xfe4efe44,0xfe69fe5a,0xfe7afe71,0xfe92fe82,0xfe9efe95,0xfeaefea5,0xfec1feb2,
-0xfec7febe,0xfed4fecc,0xfee3fedf,0xfef2feed,0xff03ff01,0xff13ff10,0xff25ff18,0xff2aff2a,
-0xff2bff2e,0xff31ff2f,0xff27ff2c,0xff1dff28,0xff07ff12,0xfeecfefc,0xfecafedd,0xfea0feb3,
-0xfe6afe84,0xfe3dfe52,0xfe07fe21,0xfdd6fded,0xfda4fdb9,0xfd83fd93,0xfd61fd74,0xfd4bfd56,
-0xfd3afd3e,0xfd41fd3f,0xfd4bfd48,0xfd60fd5a,0xfd8dfd75,0xfdb8fda8,0xfdecfdd4,0xfe2ffe0d,
-0xfe7afe52,0xfecbfe9d,0xff1dfef0,0xff6bff40,0xffc1ff93,0x0026fff2,0x007e004b,0x00d500a9,
-0x012b0101,0x01870160,0x01d801b2,0x022c020b,0x0280025d,0x02ca02ac,0x030f02f2,0x034d0333,
-0x0382036d,0x03aa0399,0x03d303be,0x03e903db,0x03f403f3,0x03fe03fa,0x03f603fd,0x03ee03f2,
-0x03dc03eb,0x03c703d1,0x03ac03b9,0x0390039c,0x0371037c,0x03530360,0x03390348,0x0323032f,
-0x0314031d,0x0302030a,0x02f90302,0x02f402fc,0x02f602ef,0x02f402f1,0x02f202ea,0x02ee02ef,
-0x02ea02eb,0x02ed02e8,0x02e702e5,0x02df02e3,0x02d102d9,0x02ce02d0,0x02bf02ca,0x02b402bb,
-0x02a802b5,0x028d029d,0x02810287,0x026a0273,0x0256025c,0x02370244,0x020f0223,0x01f50201,
-0x01d901e3,0x01b001cb,0x019501a2,0x017a0189,0x0157016a,0x013a014a,0x01240132,0x0110011b,
-0x01050111,0x00f700fa,0x00eb00ef,0x00de00e3,0x00ce00d3,0x00bf00c4,0x00af00b9,0x0098009f,
-0x0081008e,0x00630078,0x0042004e,0x001c0031,0xffe90007,0xffb6ffd2,0xff88ffa6,0xff54ff6a,
-0xff20ff39,0xfee8ff05,0xfeb5fecf,0xfe87fea2,0xfe5afe71,0xfe3dfe4c,0xfe1afe28,0xfdfdfe07,
-0xfdebfdf3,0xfdddfde3,0xfdcafdd5,0xfdbbfdbc,0xfdaefdb5,0xfda4fdac,0xfd9efd9f,0xfd96fd9b,
-0xfd90fd97,0xfd8cfd8c,0xfd88fd88,0xfd80fd82,0xfd7bfd7f,0xfd75fd80,0xfd76fd77,0xfd74fd74,
-0xfd71fd6f,0xfd6dfd6a,0xfd6afd6e,0xfd6efd6b,0xfd72fd6f,0xfd7efd75,0xfd85fd7c,0xfd93fd8b,
-0xfda3fd97,0xfdb1fdab,0xfdc5fdbe,0xfdd6fdce,0xfde7fde1,0xfdf4fdec,0xfe03fdfb,0xfe08fe04,
-0xfe02fe09,0xfdfffe05,0xfdf8fdfe,0xfdeafdf2,0xfde6fdec,0xfddbfde7,0xfdccfdd2,0xfdcffdcc,
-0xfddcfdcf,0xfdeefddd,0xfe01fdef,0xfe26fe0f,0xfe58fe3d,0xfe92fe74,0xfedbfeb9,0xff25feff,
-0xff78ff4d,0xffbfff98,0x0011ffea,0x0060003b,0x00a10082,0x00e500c5,0x01210106,0x0152013c,
-0x01740167,0x018e0185,0x019f019f,0x01ad01a5,0x01b101ae,0x01a801aa,0x019e019d,0x018e0199,
-0x017e018b,0x0163016c,0x01540153,0x01350140,0x011e012d,0x01070111,0x00ed00fc,0x00d200df,
-0x00be00d0,0x00b100b3,0x00a000af,0x009b009d,0x009f009d,0x00a900a0,0x00b400a7,0x00c900b8,
-0x00de00d3,0x00eb00e1,0x010200fb,0x011b010a,0x01310124,0x0143013e,0x0153014e,0x015f0161,
-0x01660168,0x016b0168,0x0165016d,0x01610162,0x015c0161,0x015b0160,0x01530159,0x014f0152,
-0x014b014c,0x014e0149,0x01510145,0x014f0144,0x01510149,0x01480141,0x01470143,0x01430139,
-0x0136013f,0x01300132,0x012b012f,0x01190126,0x0110011e,0x0104010a,0x00ef00f4,0x00dc00e6,
-0x00c800d3,0x00b500b6,0x009d009c,0x0081008c,0x0073007b,0x00600070,0x004a0055,0x0036004a,
-0x00240035,0x00130022,0x0004000f,0xffe7fff5,0xffceffd5,0xffadffc1,0xff95ffa8,0xff74ff89,
-0xff53ff6b,0xff34ff48,0xff15ff22,0xfeefff02,0xfed2fedc,0xfeb1fec1,0xfe9afea3,0xfe81fe8e,
-0xfe7afe7b,0xfe6bfe74,0xfe67fe67,0xfe61fe60,0xfe63fe60,0xfe6ffe6b,0xfe7cfe76,0xfe87fe84,
-0xfe99fe92,0xfeadfeac,0xfebefeba,0xfed0fecc,0xfedcfedc,0xfef3fee7,0xfeeffeee,0xfef2fef3,
-0xfeeffef2,0xfee1fef2,0xfed2fede,0xfebbfec6,0xfe9bfead,0xfe7ffe8e,0xfe53fe69,0xfe2dfe3f,
-0xfe08fe1c,0xfde7fdf3,0xfdc8fdd2,0xfdb4fdbf,0xfdaefdaf,0xfdb2fda7,0xfdaffda8,0xfdc1fdb7,
-0xfdd4fdc7,0xfdeefde1,0xfe13fe00,0xfe37fe24,0xfe61fe4a,0xfe87fe75,0xfea8fe97,0xfecffebb,
-0xfef4fedd,0xff08fefb,0xff28ff1b,0xff4dff3e,0xff5fff55,0xff7fff71,0xff9fff8d,0xffb8ffab,
-0xffdeffcf,0xfff7ffeb,0x00170007,0x00330027,0x0050003d,0x006d005d,0x008e0077,0x00aa009d,
-0x00bf00b5,0x00d500cd,0x00ef00ea,0x010e0101,0x012a011c,0x01440136,0x015e0149,0x01770168,
-0x0198018c,0x01aa01a3,0x01c201b6,0x01d601cc,0x01ea01e0,0x01f401ef,0x01fb01f8,0x020601ff,
-0x02010202,0x02000204,0x01fb0204,0x01f501f8,0x01f301f7,0x01eb01ee,0x01e301e6,0x01d801df,
-0x01de01db,0x01de01de,0x01e501e3,0x01ef01e8,0x020601f8,0x02180210,0x02350224,0x02560244,
-0x02750266,0x02940282,0x02b702a4,0x02d702c8,0x02f702e7,0x030e0304,0x031f031a,0x033a032e,
-0x03420342,0x03440348,0x033d0344,0x032d0333,0x0316031f,0x02ed02ff,0x02c902d9,0x029802b3,
-0x02670280,0x02380246,0x0205021e,0x01d401ee,0x01a501bc,0x0181018e,0x01570168,0x0140014c,
-0x012c0137,0x0119012b,0x0117011a,0x01110117,0x01110110,0x01140112,0x011a0117,0x011b0114,
-0x011d011b,0x01240123,0x0128012b,0x01300130,0x0130012c,0x01360131,0x01300136,0x01320130,
-0x011e0123,0x0116011d,0x00f8010b,0x00e000f5,0x00bd00d1,0x009400ab,0x00650081,0x003a004e,
-0xfff90013,0xffbbffd3,0xff82ff9a,0xff41ff5c,0xff09ff20,0xfed1fee7,0xfea2feb7,0xfe76fe8a,
-0xfe4ffe5f,0xfe33fe3d,0xfe10fe15,0xfdf1fdff,0xfddafde2,0xfdb7fdc8,0xfd9ffdab,0xfd7cfd8a,
-0xfd62fd6e,0xfd46fd51,0xfd2cfd35,0xfd0efd1b,0xfcf3fd05,0xfcdcfcea,0xfcccfcdc,0xfcbafccd,
-0xfcaffcb5,0xfca4fcac,0xfc93fca1,0xfc86fc94,0xfc76fc7e,0xfc6afc6b,0xfc55fc5a,0xfc42fc42,
-0xfc2dfc30,0xfc12fc1d,0xfc01fc0a,0xfbebfbfd,0xfbe0fbe7,0xfbdafbdf,0xfbd6fbd8,0xfbe3fbe1,
-0xfbebfbec,0xfc0bfbf9,0xfc1dfc12,0xfc40fc27,0xfc61fc4a,0xfc85fc6f,0xfcabfc95,0xfcd6fcc0,
-0xfcf6fce6,0xfd22fd0e,0xfd48fd37,0xfd6dfd5a,0xfd94fd7d,0xfda9fd9c,0xfdc8fdbb,0xfde3fdd9,
-0xfdfbfdea,0xfe14fe04,0xfe24fe17,0xfe37fe2f,0xfe3efe3d,0xfe4cfe4c,0xfe4efe55,0xfe5dfe5e,
-0xfe6ffe64,0xfe7bfe6e,0xfe89fe80,0xfe94fe8a,0xfeabfe9b,0xfec4feb7,0xfedffec2,0xfef2fee0,
-0xff07fefe,0xff1dff16,0xff3fff33,0xff55ff4b,0xff6cff62,0xff8cff7d,0xff9cff94,0xffbaffaa,
-0xffd3ffc1,0xffeeffd8,0xfffffff3,0x001d000b,0x003a0029,0x006a0056,0x009e0089,0x00d200bb,
-0x010f00f1,0x014d012f,0x018f0174,0x01cc01b4,0x021001f2,0x024d0230,0x0282026c,0x02bb02a0,
-0x02df02d8,0x030102f9,0x031a0316,0x03320324,0x033d0336,0x034a0344,0x0351034e,0x03570352,
-0x03510357,0x03580355,0x03570352,0x03600359,0x034b0353,0x03520352,0x034d0352,0x034b034c,
-0x03390340,0x0336033a,0x032c0332,0x031f0328,0x03050313,0x02f202fe,0x02d702e7,0x02bf02cd,
-0x02a102ad,0x02800291,0x02690279,0x024d0259,0x0231023f,0x021e022a,0x0205020f,0x01f201fc,
-0x01e601ef,0x01dc01e5,0x01d601d7,0x01d901d2,0x01d501d3,0x01d301d3,0x01d901d0,0x01d601d5,
-0x01d801d8,0x01d901d5,0x01d701d9,0x01d401d8,0x01d301d7,0x01cf01d6,0x01c201cf,0x01b201bb,
-0x019f01ab,0x01840192,0x016e017b,0x014e0161,0x01220139,0x00fc0113,0x00c800de,0x009700ae,
-0x006b0080,0x00380051,0x000b0022,0xffe0fff3,0xffc0ffd1,0xff9fffa9,0xff87ff8c,0xff72ff7a,
-0xff61ff67,0xff5dff62,0xff59ff5a,0xff5dff62,0xff6eff6d,0xff79ff76,0xff81ff84,0xff8dff8c,
-0xff9fff93,0xffa9ffa3,0xffb6ffa8,0xffbbffb7,0xffc3ffbb,0xffc8ffcb,0xffcdffc6,0xffcaffca,
-0xffbfffc2,0xffbcffbe,0xffb0ffbb,0xff9bffa9,0xff86ff98,0xff72ff7c,0xff56ff68,0xff3bff4c,
-0xff23ff2f,0xff00ff12,0xfee6fef6,0xfec9feda,0xfeaffec1,0xfea4feab,0xfe91fe9c,0xfe8bfe88,
-0xfe8bfe88,0xfe90fe8c,0xfe92fe90,0xfea1fe96,0xfeb2feac,0xfec7febb,0xfed9fed2,0xfef2fee8,
-0xfefcfefa,0xff08feff,0xff10ff0e,0xff11ff11,0xff14ff13,0xff07ff11,0xfeffff08,0xfee8fefa,
-0xfed9fee1,0xfec0fece,0xfea9feb7,0xfe93fe9f,0xfe7ffe8a,0xfe69fe70,0xfe5bfe63,0xfe4efe52,
-0xfe42fe45,0xfe3efe3e,0xfe47fe40,0xfe47fe46,0xfe61fe52,0xfe6ffe68,0xfe97fe82,0xfeb5fea6,
-0xfee4fecc,0xff17fefd,0xff4dff34,0xff81ff6a,0xffb6ff9c,0xffebffce,0x00180000,0x0041002b,
-0x00620053,0x00800075,0x00a1008c,0x00ab00a6,0x00b800b9,0x00b800bb,0x00bb00b9,0x00b900b6,
-0x00b300b7,0x00ad00b1,0x00ab00ab,0x00a600a5,0x009c00a4,0x009c00a0,0x009a009d,0x009a009a,
-0x00920095,0x00860089,0x007f0083,0x00710077,0x00600069,0x004d005a,0x003f004a,0x0036003f,
-0x00260032,0x0019001e,0x00170016,0x001a0015,0x0023001d,0x0034002b,0x00460038,0x00670056,
-0x00810071,0x009e0089,0x00b300ad,0x00cc00bf,0x00e100d7,0x00e500e0,0x00ee00ee,0x00e900ea,
-0x00d900e1,0x00c400ce,0x00a600ba,0x007d009c,0x00580072,0x00280040,0xfff40011,0xffbaffd9,
-0xff86ffa3,0xff54ff6f,0xff27ff37,0xfef6ff0d,0xfecffede,0xfeb1febb,0xfe99fe9f,0xfe88fe89,
-0xfe7ffe81,0xfe7afe77,0xfe83fe76,0xfe88fe7e,0xfe93fe8a,0xfea8fe9f,0xfeb5feaf,0xfec7fec1,
-0xfee0fed1,0xfee5fedd,0xfeedfee7,0xfef1feee,0xfeeefef3,0xfef1fef1,0xfee4fee7,0xfeddfee1,
-0xfed5fedd,0xfed4fed4,0xfec6fecb,0xfec5feca,0xfebefec1,0xfec7fec4,0xfed4fecc,0xfee3fedb,
-0xfef4fee9,0xff10ff06,0xff2eff27,0xff52ff4b,0xff7fff6e,0xffadff9b,0xffddffc7,0x0007ffec,
-0x0031000f,0x005f0046,0x0081006f,0x00a60095,0x00ca00b9,0x00e000d4,0x00f300ea,0x00fc00f7,
-0x00fa0103,0x00f40103,0x00ea00f2,0x00d000d7,0x00b100c3,0x0088009f,0x005d0076,0x00340049,
-0x0003001d,0xffceffe3,0xff95ffb4,0xff63ff7e,0xff3cff57,0xff0fff25,0xfeedfeff,0xfec5fedb,
-0xfea8febb,0xfe8efe9e,0xfe75fe7a,0xfe59fe60,0xfe42fe45,0xfe2ffe3a,0xfe23fe27,0xfe12fe16,
-0xfe0dfe16,0xfe08fe0f,0xfe0afe0d,0xfe15fe12,0xfe31fe20,0xfe4afe39,0xfe73fe5c,0xfe99fe83,
-0xfecbfeae,0xff08fee9,0xff41ff26,0xff82ff66,0xffceffa7,0x001bfff0,0x0068003c,0x00ad0083,
-0x00f400d0,0x01390117,0x0176015b,0x01bb019a,0x01ec01da,0x02200208,0x024f0238,0x0274026b,
-0x0295028a,0x02b702a5,0x02d002c8,0x02e602d6,0x02f802eb,0x03040304,0x031a0313,0x0324031e,
-0x032c0328,0x032d0331,0x03340331,0x0338033a,0x03320332,0x032f0333,0x031e0326,0x03090317,
-0x02f80302,0x02e202f0,0x02c802d5,0x02ae02b4,0x02910298,0x0271027e,0x0251025c,0x02350245,
-0x021e0228,0x0203020f,0x01ec01f6,0x01df01e4,0x01cf01d8,0x01c201c6,0x01b801bc,0x01af01b5,
-0x01a801ae,0x01ad01af,0x01b201ae,0x01b001b2,0x01b301b6,0x01b901b4,0x01bd01b4,0x01bb01bb,
-0x01bd01ba,0x01b201b8,0x01ad01ad,0x019f01ad,0x0196019c,0x01810189,0x016e0178,0x01560162,
-0x01400145,0x0124012c,0x01050114,0x00ed00fb,0x00cb00de,0x00b400be,0x009600a8,0x0083008d,
-0x00680072,0x004e0057,0x00330041,0x0018001e,0xfffa000a,0xffdaffeb,0xffc0ffd0,0xff98ffaf,
-0xff78ff8f,0xff56ff6f,0xff38ff4a,0xff19ff2c,0xff03ff16,0xfef7fef6,0xfee5fee6,0xfedafed9,
-0xfed4fed2,0xfecbfed2,0xfecafecb,0xfeccfecc,0xfed3fecc,0xfedafed0,0xfedefeda,0xfee8fee4,
-0xfeeafee8,0xfeedfeec,0xfeeefef0,0xfef2fef9,0xfeeffef2,0xfeeefef1,0xfeebfeec,0xfee3fee9,
-0xfedafee6,0xfecffec9,0xfeb7fec4,0xfe9ffeb3,0xfe88fe9a,0xfe6ffe82,0xfe4ffe65,0xfe2efe43,
-0xfe0cfe21,0xfdeffe00,0xfdc8fde3,0xfda7fdb7,0xfd91fda1,0xfd75fd7b,0xfd61fd64,0xfd50fd53,
-0xfd3dfd47,0xfd33fd3a,0xfd29fd2e,0xfd2cfd29,0xfd27fd24,0xfd1dfd1d,0xfd19fd16,0xfd0efd14,
-0xfd05fd04,0xfcf3fcf7,0xfce6fcec,0xfcd5fcde,0xfcc3fcc7,0xfcb0fcb5,0xfca3fcaa,0xfc90fc97,
-0xfc86fc8f,0xfc7bfc83,0xfc75fc7b,0xfc73fc77,0xfc7bfc7a,0xfc84fc81,0xfc8bfc83,0xfc95fc8a,
-0xfca6fc98,0xfcb7fcad,0xfcccfcc3,0xfcedfcd8,0xfd0cfd02,0xfd31fd22,0xfd5afd43,0xfd85fd6c,
-0xfdbdfda0,0xfdeefdd5,0xfe2efe0f,0xfe6afe4f,0xfeaefe90,0xfefdfedc,0xff49ff27,0xff8eff70,
-0xffdbffb1,0x001dfffc,0x0066003c,0x00a30083,0x00e000bf,0x010f00f2,0x01360128,0x015a014a,
-0x01740169,0x01870183,0x018f018e,0x01900195,0x018b0194,0x01820188,0x01780183,0x01640170,
-0x0152015a,0x013e014a,0x01300138,0x011f0123,0x01180116,0x010c0115,0x010c010f,0x0112010c,
-0x0111010e,0x01180113,0x0121011f,0x0134012d,0x01490141,0x015e0157,0x017f016b,0x01970185,
-0x01b2019d,0x01d001c3,0x01f101e2,0x021c0202,0x02390228,0x02550249,0x02730269,0x02910284,
-0x02a0029b,0x02b802b5,0x02c302c0,0x02c902cb,0x02cc02cd,0x02c702ce,0x02c002c1,0x02aa02b0,
-0x02950298,0x027b0283,0x0260026b,0x0241024d,0x02270230,0x0210021f,0x01f3020a,0x01dd01f0,
-0x01cb01d9,0x01c701cc,0x01bd01c0,0x01b801b9,0x01b501ba,0x01b901b9,0x01b701b6,0x01ad01b1,
-0x01ac01ae,0x01ad01b1,0x01a701ae,0x019d01a2,0x0199019a,0x0193018c,0x01820187,0x017b0181,
-0x01710178,0x0168016f,0x015d015f,0x015b015b,0x01500154,0x014a014f,0x013a0146,0x013b013c,
-0x012c012f,0x01200129,0x011b011f,0x01080110,0x00f800fd,0x00e900ec,0x00d400da,0x00c200c7,
-0x00a900b4,0x009200a1,0x0089008f,0x00790086,0x006c0072,0x0063006f,0x005d0061,0x00540058,
-0x00540053,0x004c004d,0x00420047,0x002f0037,0x00230026,0x000c0017,0xfff80004,0xffdcffec,
-0xffbeffd1,0xffa0ffb1,0xff75ff85,0xff5dff69,0xff37ff49,0xff15ff21,0xfef4ff03,0xfed5fee8,
-0xfeb6fec9,0xfe9cfeaa,0xfe8cfe95,0xfe83fe86,0xfe74fe7b,0xfe70fe6e,0xfe6dfe71,0xfe71fe6d,
-0xfe76fe71,0xfe83fe79,0xfe8ffe82,0xfea8fe94,0xfebbfeac,0xfecbfebd,0xfed9fed5,0xfee6fee0,
-0xfef3feee,0xff01feff,0xff03ff08,0xff06ff05,0xff09ff0b,0xff06ff08,0xfefafefc,0xfef2fef6,
-0xfeecfef0,0xfeeffeec,0xfee7fee4,0xfee6fee4,0xfee6fee5,0xfeedfeea,0xfef8fef2,0xff04fefb,
-0xff11ff06,0xff23ff17,0xff31ff24,0xff3fff36,0xff51ff4a,0xff5fff5a,0xff67ff67,0xff70ff70,
-0xff80ff77,0xff7bff7c,0xff75ff74,0xff71ff75,0xff6fff6f,0xff62ff69,0xff5eff60,0xff58ff58,
-0xff4dff53,0xff4dff52,0xff4cff4e,0xff4eff4e,0xff4eff4d,0xff58ff50,0xff62ff5b,0xff63ff5c,
-0xff71ff66,0xff7bff78,0xff88ff85,0xff92ff8e,0xffa2ff99,0xffb2ffab,0xffbbffb8,0xffd0ffc9,
-0xffddffd8,0xfff3ffe6,0x0003fffa,0x00120006,0x00240019,0x00420037,0x00580048,0x007d006a,
-0x008d0085,0x00a900a1,0x00c600be,0x00e700db,0x00fa00f6,0x0113010b,0x012b012d,0x013c013d,
-0x013f0145,0x014d014a,0x0150014d,0x014d0151,0x0142014c,0x01380141,0x0123012a,0x01080115,
-0x00f100f9,0x00cf00dc,0x009f00b8,0x0074008a,0x00450057,0x00110028,0xffe1fff8,0xffaeffbc,
-0xff7aff8c,0xff4aff5e,0xff23ff37,0xff01ff13,0xfef0ff01,0xfee1feec,0xfee0fede,0xfee0fedd,
-0xfeebfee1,0xfefdfeef,0xff0dfefe,0xff28ff1d,0xff3bff34,0xff53ff4c,0xff66ff5f,0xff78ff6d,
-0xff83ff7d,0xff7cff7f,0xff6eff7a,0xff5eff64,0xff45ff58,0xff29ff3b,0xfefcff12,0xfedefeed,
-0xfeb3fec2,0xfe85fe98,0xfe61fe71,0xfe3afe4a,0xfe16fe22,0xfe01fe11,0xfde4fdf3,0xfde4fde1,
-0xfddffde0,0xfddffddf,0xfde6fde5,0xfdf9fded,0xfe12fe07,0xfe30fe20,0xfe55fe3e,0xfe81fe68,
-0xfea8fe94,0xfed4fec2,0xff01feef,0xff31ff1f,0xff5dff4d,0xff87ff77,0xffa8ff9c,0xffcaffba,
-0xffe5ffd5,0xfff1ffee,0x0004fffe,0x000c000a,0x00130011,0x00110016,0x00110014,0x000d000f,
-0x000e000c,0x00020009,0x00000002,0x00030004,0x00050000,0x0006fffc,0x00080004,0x0019000d,
-0x0023001a,0x00360028,0x004e0041,0x006f005c,0x00850077,0x00aa0096,0x00cf00c0,0x00f100e5,
-0x011d010c,0x0140012f,0x01660151,0x017b0172,0x018c0186,0x01a00198,0x01a101a5,0x01a001a5,
-0x019d019b,0x018c0191,0x0171017d,0x0156015c,0x01300142,0x010d011e,0x00e000fb,0x00b800ca,
-0x008900a6,0x005c0076,0x00340050,0x00150023,0xffe90000,0xffc8ffdc,0xffb0ffbf,0xff99ffaa,
-0xff90ff91,0xff8fff8e,0xff9cff8e,0xffb4ffa3,0xffd0ffbd,0xfff5ffe0,0x00310016,0x006d004c,
-0x00aa008e,0x00ee00d2,0x013d0113,0x017e015c,0x01cc01a5,0x021001f1,0x02520234,0x0290026f,
-0x02c602a3,0x02f802d8,0x031b0308,0x033b0331,0x03510344,0x035e0358,0x03660362,0x03650365,
-0x035a0363,0x0347034e,0x0334033e,0x0319032a,0x02ff030d,0x02dd02ee,0x02be02ce,0x02a202b0,
-0x027e0292,0x02590270,0x023c0251,0x0222022e,0x02020211,0x01e401f8,0x01ca01dc,0x01b501c4,
-0x019e01a9,0x017e018c,0x016d0173,0x01560161,0x01470152,0x01390140,0x012c0130,0x0111011b,
-0x0104010f,0x00ec00fc,0x00dd00ea,0x00cd00d4,0x00bc00c1,0x00a000ac,0x0085008a,0x00660073,
-0x00470055,0x001f0038,0xfffa0012,0xffd5ffef,0xffb4ffcf,0xff90ffab,0xff72ff86,0xff54ff62,
-0xff37ff46,0xff1aff2b,0xff02ff12,0xfeecff00,0xfed8feea,0xfecffed9,0xfecafec6,0xfec1febc,
-0xfebafeb1,0xfeaffead,0xfeaafeaa,0xfe9efea5,0xfe97fe99,0xfe89fe8b,0xfe7dfe7d,0xfe70fe73,
-0xfe56fe64,0xfe41fe4b,0xfe2afe31,0xfe0efe1d,0xfdebfdf9,0xfddafde3,0xfdc2fdc9,0xfda5fdb1,
-0xfd92fda0,0xfd82fd89,0xfd73fd75,0xfd64fd6b,0xfd66fd6a,0xfd6afd6e,0xfd7cfd76,0xfd86fd7f,
-0xfd9afd90,0xfdb9fda3,0xfdd9fdbe,0xfdf5fde3,0xfe17fe01,0xfe41fe2a,0xfe5dfe4f,0xfe81fe6e,
-0xfea5fe95,0xfec4feb7,0xfee2fed2,0xfef6feeb,0xff08ff01,0xff12ff0a,0xff17ff19,0xff19ff17,
-0xff0fff17,0xff05ff0b,0xfef6fef9,0xfee0feec,0xfec6fecf,0xfea9febd,0xfe8ffe9f,0xfe6dfe7f,
-0xfe4efe60,0xfe2cfe3b,0xfe01fe15,0xfde4fdf5,0xfdc3fdd2,0xfd9cfdb2,0xfd7bfd8e,0xfd5ffd71,
-0xfd45fd57,0xfd31fd42,0xfd1efd2b,0xfd1cfd1b,0xfd19fd1a,0xfd1ffd18,0xfd2efd21,0xfd47fd36,
-0xfd61fd51,0xfd81fd6f,0xfdacfd99,0xfdd2fdbf,0xfe05fdec,0xfe32fe20,0xfe63fe47,0xfe95fe80,
-0xfec4feaf,0xfef2fed6,0xff19ff0a,0xff43ff2f,0xff62ff58,0xff7fff78,0xffa1ff98,0xffbaffb5,
-0xffd3ffc5,0xffdeffd4,0xffebffe4,0xfffefff6,0x000e0006,0x00140014,0x00290020,0x003e0037,
-0x00570046,0x0070005c,0x008d0079,0x00a50095,0x00c600b5,0x00ea00d6,0x010c00fe,0x01370121,
-0x015b014a,0x01850172,0x01a70192,0x01c501b9,0x01df01da,0x01fb01eb,0x020d0200,0x021a0210,
-0x021d021c,0x02200221,0x021b0221,0x0216021b,0x02130210,0x020c020c,0x02010209,0x01f401fc,
-0x01ea01ed,0x01e401eb,0x01de01e3,0x01de01dc,0x01db01dd,0x01dc01e0,0x01ed01e3,0x01f701f8,
-0x02070206,0x021a0211,0x02370227,0x024d0240,0x02640258,0x02830270,0x02970289,0x02ad02a3,
-0x02bd02b6,0x02d402c5,0x02d902db,0x02e102e3,0x02e802eb,0x02ee02e8,0x02e902ed,0x02e202e3,
-0x02dd02e0,0x02ca02d0,0x02b702b8,0x029d02a9,0x02840295,0x02680278,0x02450257,0x02250236,
-0x01ff0215,0x01d801e8,0x01aa01c4,0x0175018d,0x0140015c,0x010a0121,0x00d000eb,0x009c00b6,
-0x00650082,0x0037004c,0x0004001d,0xffdcfff3,0xffbbffca,0xff98ffad,0xff81ff90,0xff75ff7e,
-0xff62ff67,0xff5fff5f,0xff58ff56,0xff53ff51,0xff54ff52,0xff5bff55,0xff63ff5c,0xff67ff65,
-0xff76ff67,0xff87ff7d,0xff99ff90,0xffacffa8,0xffc3ffbb,0xffdbffd1,0xfff4ffe8,0x0007ffff,
-0x001d000e,0x00260024,0x0032002d,0x003b0030,0x003b003c,0x00300035,0x0025002b,0x000c0018,
-0xfff30000,0xffd2ffe3,0xffaeffc4,0xff94ffa0,0xff6bff81,0xff50ff5d,0xff36ff3f,0xff2aff28,
-0xff18ff1c,0xff0fff0e,0xff0dff0e,0xff0aff0d,0xff0eff0e,0xff0fff12,0xff17ff18,0xff18ff1a,
-0xff1eff20,0xff21ff20,0xff12ff1b,0xff09ff0f,0xfef9ff02,0xfee8fef4,0xfec9fed3,0xfeadfebb,
-0xfe97fea7,0xfe84fe90,0xfe6ffe77,0xfe6efe6d,0xfe65fe66,0xfe66fe66,0xfe74fe6d,0xfe82fe7c,
-0xfea3fe96,0xfec7feb2,0xfef1fede,0xff20ff07,0xff54ff36,0xff83ff67,0xffb6ff9b,0xffe5ffcd,
-0x00160002,0x003e0029,0x0063004f,0x0086006e,0x00940085,0x00a5009d,0x00a900a5,0x00ac00ad,
-0x00ab00b0,0x00a600ae,0x009800a3,0x00900099,0x007a0083,0x006c0077,0x0055005f,0x004a004e,
-0x0031003c,0x001b0025,0x0006000d,0xffedfff7,0xffdcffe3,0xffc1ffca,0xffadffb3,0xff8fff9c,
-0xff74ff8a,0xff54ff69,0xff3eff4f,0xff1bff2f,0xfeffff12,0xfef2fefb,0xfeddfee8,0xfed4fed4,
-0xfec3fecf,0xfec5fec4,0xfec8fec4,0xfecffec9,0xfee3fedc,0xfef8feee,0xff15ff07,0xff33ff22,
-0xff52ff3f,0xff7bff5e,0xff95ff83,0xffb8ffa6,0xffdaffd1,0xfffbfff1,0x00130007,0x002e001d,
-0x003e0035,0x0048003e,0x00500049,0x004f0052,0x0056005a,0x00530055,0x004d0054,0x004c0050,
-0x004e004b,0x00450050,0x0046004a,0x00420042,0x00470041,0x00400041,0x0041003b,0x0037003a,
-0x0036003a,0x0032002e,0x00250023,0x00180019,0x000a000b,0xfff7fffa,0xffd6ffdc,0xffb4ffc3,
-0xff8dffa1,0xff6bff7a,0xff41ff4e,0xff18ff2b,0xfeecff00,0xfebcfed8,0xfe8dfea9,0xfe67fe7e,
-0xfe43fe55,0xfe21fe2e,0xfe06fe0d,0xfdf1fdfb,0xfde3fdec,0xfde2fde6,0xfdeefdea,0xfdfafdf3,
-0xfe14fe06,0xfe37fe21,0xfe63fe46,0xfe96fe79,0xfec7fea6,0xfef9fed8,0xff23ff0d,0xff4dff37,
-0xff7aff65,0xffa2ff8f,0xffc7ffb8,0xffe5ffdd,0xfffffff8,0x00150009,0x001c001a,0x00270027,
-0x00290027,0x00230023,0x001c001f,0x000c0010,0xfff7ffff,0xffe1ffeb,0xffc9ffd1,0xffa9ffb2,
-0xff94ff9b,0xff75ff87,0xff5fff6d,0xff51ff57,0xff44ff51,0xff3cff46,0xff45ff45,0xff54ff51,
-0xff60ff59,0xff7cff70,0xff90ff80,0xffaeff9e,0xffd2ffba,0xffecffe3,0x0009fff9,0x00240016,
-0x00440036,0x0062004c,0x007a006b,0x008c0080,0x00ac009f,0x00c400b7,0x00e700d2,0x010000f5,
-0x011e0111,0x01480135,0x0169015c,0x018d017f,0x01af019d,0x01ca01bd,0x01e901d7,0x020401f8,
-0x0217020c,0x022a0222,0x02370233,0x023e0237,0x02490245,0x024d0249,0x024c024f,0x024f0250,
-0x02530250,0x0254024f,0x02560258,0x02520258,0x0244024a,0x02410242,0x02330234,0x021e0229,
-0x02020213,0x01e901f5,0x01cb01da,0x01a301b5,0x0183018e,0x0159016e,0x01350143,0x01100120,
-0x00ea00ff,0x00d700e2,0x00bd00c7,0x00ab00b6,0x009e00ab,0x008f009c,0x008e0094,0x008c0089,
-0x008d008d,0x009a0092,0x00ad009c,0x00c100ab,0x00d600c4,0x00ec00db,0x010400f3,0x011e010c,
-0x013c012e,0x01550149,0x01780174,0x019c0194,0x01bb01ae,0x01da01c9,0x01f301df,0x020b01fc,
-0x0214020f,0x02270218,0x022a0228,0x022b022a,0x022b022f,0x021e022a,0x0210021c,0x01ff020f,
-0x01e101f5,0x01c601d7,0x01a101af,0x017f018a,0x01570165,0x01200137,0x00ee010c,0x00b100cc,
-0x0084009f,0x004c0067,0x001a0031,0xffdefffe,0xffabffc4,0xff7dff9a,0xff55ff6a,0xff28ff3f,
-0xff04ff18,0xfeeafef5,0xfed2fedb,0xfec8fecb,0xfebdfeba,0xfebefeb6,0xfeb9feb6,0xfebffeb9,
-0xfec4fec0,0xfecbfec9,0xfed4fed3,0xfedbfedd,0xfedffedb,0xfee2fee3,0xfee2fedf,0xfedcfedf,
-0xfed2fed6,0xfec5fecb,0xfebefebe,0xfea3feb5,0xfe8bfe98,0xfe7cfe88,0xfe67fe71,0xfe51fe59,
-0xfe3cfe49,0xfe28fe2f,0xfe12fe1c,0xfe02fe04,0xfdf4fdfe,0xfde5fde8,0xfdd8fde3,0xfdcbfdd3,
-0xfdc8fdcd,0xfdc5fdc6,0xfdc4fdc4,0xfdcbfdc1,0xfdd4fdcb,0xfde0fdd9,0xfde4fde2,0xfdecfded,
-0xfdf5fdf5,0xfe01fdf7,0xfe06fe01,0xfdfdfe06,0xfdf4fdf6,0xfde8fdf0,0xfddbfde1,0xfdc7fdd8,
-0xfdaefdbd,0xfd93fda3,0xfd7bfd8a,0xfd69fd6e,0xfd51fd5c,0xfd42fd47,0xfd32fd3b,0xfd2dfd35,
-0xfd34fd33,0xfd39fd38,0xfd4ffd48,0xfd5efd56,0xfd7ffd6c,0xfd91fd86,0xfdb9fda5,0xfdddfdc9,
-0xfe08fdf3,0xfe32fe19,0xfe5dfe47,0xfe88fe6f,0xfebbfe9f,0xfef2fed1,0xff24ff02,0xff55ff37,
-0xff86ff6c,0xffbaff9c,0xffecffc9,0x0011fffa,0x0033001d,0x004e0042,0x00580057,0x00600065,
-0x0065006c,0x005d0066,0x00530058,0x003a0046,0x001b002c,0x0001000e,0xffe3ffec,0xffc3ffd4,
-0xffacffb2,0xff97ff9c,0xff86ff8c,0xff7fff7a,0xff7fff7e,0xff8bff7d,0xff99ff90,0xffadffa5,
-0xffccffc2,0xffefffe0,0x0016ffff,0x00340022,0x00540044,0x006e0066,0x008b007e,0x00a4009c,
-0x00c300b8,0x00d900cc,0x00f000e1,0x010500f6,0x010b0108,0x011c0117,0x01310124,0x013b0132,
-0x014b0144,0x015e014f,0x01730168,0x0185017b,0x01a0018f,0x01b701a9,0x01c801bc,0x01dd01d3,
-0x01f601e8,0x020d0202,0x02210217,0x0232022c,0x02430239,0x0253024f,0x02640257,0x0270026d,
-0x02760270,0x0280027e,0x027b0280,0x027c0279,0x0276027e,0x026a026f,0x0255025b,0x023f024c,
-0x02210235,0x01ff0213,0x01da01f0,0x01bb01cf,0x019401b3,0x01700184,0x014d0161,0x01330141,
-0x0119012c,0x01050108,0x00f400fc,0x00e700f1,0x00e200e4,0x00e100df,0x00e200df,0x00eb00e6,
-0x00ee00ea,0x00fa00ee,0x010100fd,0x00fd00fe,0x01040101,0x01090108,0x0108010f,0x01040108,
-0x00f90104,0x00fc00fe,0x00fa00fb,0x00f400f8,0x00f600f6,0x00f900ef,0x00f800f1,0x00f700f1,
-0x010100f9,0x00fb00fc,0x01020100,0x00fb0106,0x01050107,0x0105010b,0x01010109,0x00fc00ff,
-0x00f000f7,0x00e100e3,0x00cd00cf,0x00a800b9,0x00880093,0x006a0079,0x00430054,0x00170030,
-0xffef0005,0xffc2ffe0,0xff9bffb4,0xff7aff89,0xff53ff66,0xff37ff41,0xff1aff2c,0xff0bff10,
-0xfefaff02,0xfeebfeef,0xfee5feea,0xfedcfedf,0xfedffed7,0xfed7fed9,0xfecffed4,0xfecbfed4,
-0xfecbfecb,0xfecefece,0xfed0fec7,0xfed0fecd,0xfed2fed3,0xfee0feda,0xfeedfee5,0xff00fef1,
-0xff14ff09,0xff2eff1b,0xff4cff38,0xff67ff59,0xff90ff7a,0xffa8ff9e,0xffcdffc2,0xffeeffdc,
-0x0005fffe,0x00220018,0x0035002b,0x003f003b,0x00510045,0x0050004c,0x00520051,0x0049004c,
-0x003f0044,0x0030003b,0x00210026,0x00040008,0xffe6fff2,0xffc1ffcf,0xffa6ffb1,0xff81ff92,
-0xff60ff74,0xff47ff4f,0xff26ff34,0xff0cff1f,0xfeeefefc,0xfeddfeeb,0xfecffed8,0xfec2fec8,
-0xfec2fec2,0xfec2febd,0xfecffec6,0xfee2fed4,0xfef2fee6,0xff10feff,0xff2cff1f,0xff53ff42,
-0xff7dff63,0xffa4ff8f,0xffd0ffb5,0xfff3ffe1,0x001b0003,0x00400029,0x005c0051,0x0075006a,
-0x008d007b,0x00920096,0x0097009b,0x009a0098,0x00930097,0x007e008e,0x00680072,0x004e005d,
-0x0029003b,0x0008001b,0xffddfff1,0xffb9ffc8,0xff8cff9a,0xff65ff71,0xff3dff48,0xff1aff28,
-0xfef3ff09,0xfee1feec,0xfecafed4,0xfec4fec7,0xfeb7fec2,0xfeb1feb5,0xfeaffeb2,0xfeb2feab,
-0xfeb1feaf,0xfeb8feb7,0xfebafeb7,0xfec2fec3,0xfecbfec4,0xfed9fecf,0xfeeafedc,0xfef0feed,
-0xff0cff00,0xff1cff15,0xff38ff29,0xff48ff40,0xff62ff50,0xff79ff6a,0xff8fff7f,0xffa2ff91,
-0xffaeffa6,0xffb3ffac,0xffbfffb5,0xffc3ffc5,0xffc1ffc6,0xffc6ffc6,0xffc4ffca,0xffc7ffc5,
-0xffbeffc5,0xffbaffc1,0xffc0ffc2,0xffc1ffbe,0xffc3ffc0,0xffcaffba,0xffcfffc4,0xffd0ffcc,
-0xffd4ffd2,0xffdbffd9,0xffdbffdd,0xffddffd9,0xffe1ffde,0xffdcffdb,0xffd8ffd9,0xffcaffcf,
-0xffbcffc4,0xffabffb8,0xff9bffa7,0xff81ff8d,0xff6fff7a,0xff5eff64,0xff4bff56,0xff3cff42,
-0xff2fff34,0xff1cff23,0xff0fff17,0xff04ff04,0xff01ff00,0xff00fefa,0xfeffff00,0xff06ff03,
-0xff0fff08,0xff1eff16,0xff2eff27,0xff3eff32,0xff56ff48,0xff70ff60,0xff80ff79,0xff9fff8e,
-0xffb5ffaa,0xffcdffc1,0xffe1ffd6,0xfffafff2,0x000b0008,0x00280015,0x003d0030,0x00510043,
-0x005f0057,0x006e006a,0x0084007e,0x0091008e,0x00ac00a5,0x00bc00b1,0x00ca00c6,0x00db00dc,
-0x00ee00e4,0x00f100ef,0x00f500f9,0x00f800fc,0x00f500fb,0x00ee00f1,0x00e600e8,0x00d800db,
-0x00c800ce,0x00b200b8,0x00a200a7,0x008e0097,0x0080008a,0x007d0081,0x007b0079,0x007c007d,
-0x0088008f,0x0093009b,0x00a700a7,0x00bf00b5,0x00da00d4,0x00f200e9,0x01160105,0x012e0122,
-0x014b013d,0x01600157,0x0176016a,0x01860180,0x01a10196,0x01ae01a8,0x01b701b4,0x01be01bd,
-0x01c801c2,0x01ca01c7,0x01cc01c7,0x01cc01c5,0x01cd01ca,0x01c501c9,0x01be01c3,0x01bd01c0,
-0x01b801bf,0x01bb01bf,0x01c101c0,0x01c801be,0x01c801c0,0x01d101cb,0x01d801d2,0x01e501de,
-0x01e701e1,0x01f101ef,0x01f901f5,0x01fe01fc,0x01fd0201,0x01f801fb,0x01ee01f5,0x01de01e9,
-0x01c901d7,0x01ac01b8,0x0188019a,0x01600176,0x0135014c,0x0105011e,0x00d900f0,0x00aa00c7,
-0x0072008f,0x00450063,0x00190025,0xfff20004,0xffccffd8,0xffa9ffb7,0xff8bff9a,0xff76ff82,
-0xff64ff71,0xff5fff65,0xff5aff60,0xff5eff5f,0xff67ff62,0xff6dff64,0xff7fff71,0xff87ff81,
-0xff92ff87,0xff9fff94,0xffa7ff9f,0xffaeffae,0xffb7ffb3,0xffbfffbd,0xffc9ffc4,0xffd0ffcc,
-0xffcdffd2,0xffd6ffd5,0xffd3ffd1,0xffd8ffc7,0xffd4ffd0,0xffcdffcf,0xffcaffd1,0xffcaffca,
-0xffc7ffc7,0xffbdffc4,0xffb4ffbc,0xffa5ffb0,0xff98ff9f,0xff84ff95,0xff6dff80,0xff5aff6d,
-0xff49ff56,0xff2fff3b,0xff1eff20,0xff02ff05,0xfee6feed,0xfed1fed6,0xfebbfec5,0xfea5feaf,
-0xfe95fea2,0xfe8afe90,0xfe7ffe86,0xfe72fe73,0xfe70fe70,0xfe6efe6f,0xfe70fe6d,0xfe74fe71,
-0xfe76fe76,0xfe81fe82,0xfe89fe84,0xfe95fe90,0xfea3fe9f,0xfeb1feab,0xfec1feb5,0xfed3feca,
-0xfee0fedc,0xfeeefeeb,0xff00fef8,0xff12ff0b,0xff20ff1c,0xff29ff20,0xff36ff31,0xff40ff38,
-0xff3eff3f,0xff42ff42,0xff40ff44,0xff46ff48,0xff3fff46,0xff33ff39,0xff2fff31,0xff23ff22,
-0xff20ff1d,0xff19ff17,0xff11ff13,0xff02ff07,0xfef4fefb,0xfee6fef2,0xfed7fee2,0xfed1fed6,
-0xfec2fece,0xfebcfec2,0xfeb7feb9,0xfea9feb2,0xfea5fea5,0xfea7fe9e,0xfea4fe9e,0xfea6fea7,
-0xfeb1feac,0xfebefeb9,0xfed2fecc,0xfee4fed7,0xff05fef6,0xff25ff13,0xff45ff39,0xff6cff56,
-0xff88ff7d,0xffacff96,0xffc1ffb0,0xffceffc9,0xffd5ffd7,0xffdaffdf,0xffd1ffd9,0xffc8ffd1,
-0xffb9ffc4,0xffa8ffba,0xff99ffa1,0xff8bff8e,0xff76ff84,0xff74ff75,0xff73ff74,0xff72ff6e,
-0xff82ff75,0xff87ff84,0xff9eff91,0xffb4ffa6,0xffccffbd,0xffe4ffd9,0xfffbffee,0x00110004,
-0x00210016,0x002a002c,0x00350030,0x003b0039,0x003f003d,0x003d003b,0x0038003b,0x003a003b,
-0x002f0035,0x002d0031,0x002d0032,0x002b0027,0x002d002c,0x002d0027,0x002a002a,0x00220025,
-0x001f001d,0x0019001c,0x000c0012,0x0006000e,0xfffc000a,0xfff80002,0xfff5fffd,0xfff4fff8,
-0xfffbfffc,0x00050004,0x0012000f,0x0020001c,0x0037002f,0x00560045,0x00750066,0x0092007d,
-0x00b200a6,0x00da00c5,0x00f300e7,0x010f0104,0x01300123,0x0149013e,0x015c014d,0x016c0162,
-0x0173016c,0x01740172,0x017d0175,0x01710177,0x016a016e,0x0166016f,0x015e0163,0x015c015d,
-0x014f0159,0x01520150,0x014c0153,0x015a0156,0x0163015f,0x01700166,0x017d0178,0x018f0189,
-0x01a30198,0x01b201ab,0x01c501b6,0x01d201c7,0x01df01d2,0x01e501e2,0x01ea01ee,0x01f101f3,
-0x01f901f9,0x01fb01f8,0x020401fe,0x02080208,0x020b020b,0x02150212,0x02160217,0x0221021b,
-0x02280221,0x0232022c,0x02410237,0x024d0246,0x0253024b,0x025c0256,0x025d025d,0x02620266,
-0x0267026d,0x02650266,0x02610263,0x02560259,0x0249024f,0x0232023b,0x02150222,0x01f70208,
-0x01d101e5,0x01aa01be,0x017a0197,0x014f016a,0x0121013b,0x00f6010f,0x00d000e7,0x00a700bc,
-0x007a0093,0x0057006b,0x0038004a,0x001f002a,0x0008000f,0xfff7fffd,0xffddffe4,0xffc5ffc9,
-0xffaeffb4,0xff96ffa6,0xff82ff8f,0xff68ff7d,0xff53ff62,0xff3eff4f,0xff2cff38,0xff1eff2a,
-0xff0eff1b,0xff06ff0b,0xfef7ff03,0xfeecfef3,0xfee6feec,0xfee1fee5,0xfedefedd,0xfed1fed5,
-0xfecafecb,0xfec0feca,0xfeb6feba,0xfeacfeb0,0xfe99fea2,0xfe87fe90,0xfe79fe80,0xfe68fe6f,
-0xfe52fe5c,0xfe3bfe4c,0xfe26fe2e,0xfe12fe21,0xfdfcfe06,0xfde5fdec,0xfdc7fdd3,0xfdadfdb6,
-0xfd95fda0,0xfd7dfd86,0xfd61fd70,0xfd47fd54,0xfd2ffd39,0xfd22fd2a,0xfd05fd13,0xfcf9fcfe,
-0xfcedfcf3,0xfce6fce8,0xfce0fce0,0xfce9fce7,0xfce8fce7,0xfcf0fcef,0xfd02fcfe,0xfd0cfd05,
-0xfd1ffd14,0xfd32fd27,0xfd45fd3b,0xfd53fd4b,0xfd69fd58,0xfd73fd6e,0xfd85fd7d,0xfd94fd8c,
-0xfda2fd96,0xfdacfda3,0xfdb1fda9,0xfdbdfdb6,0xfdcefdc5,0xfdd9fdd4,0xfde6fde0,0xfdf5fdee,
-0xfe0efe00,0xfe24fe1b,0xfe3bfe31,0xfe52fe49,0xfe6cfe65,0xfe8bfe80,0xfeb1fea2,0xfecdfebf,
-0xfef3fee5,0xff15ff0b,0xff3cff2f,0xff63ff56,0xff8fff7b,0xffadffa1,0xffdeffc8,0x0004fff8,
-0x0030001e,0x0050003c,0x00720063,0x008f0080,0x00ae009d,0x00c600b2,0x00d900cc,0x00e600db,
-0x00ee00ef,0x00f800f5,0x00f800f7,0x00f800fa,0x00ed00f9,0x00ea00ee,0x00df00ea,0x00d600df,
-0x00d100d2,0x00c500cc,0x00c200c4,0x00bf00c1,0x00bf00c3,0x00cc00c5,0x00da00cf,0x00ee00e1,
-0x010500f6,0x011a010e,0x0139012e,0x01590147,0x0181016f,0x01a50192,0x01cb01b7,0x01e501d6,
-0x020801fd,0x02220218,0x02410235,0x0255024a,0x02620258,0x026c0268,0x02710270,0x02630270,
-0x025f026b,0x02530261,0x0245025b,0x023c0247,0x02250230,0x020b0216,0x01f001ff,0x01d601e1,
-0x01be01c5,0x01a001a8,0x018b0192,0x017a017e,0x016d016f,0x016b016a,0x01650168,0x01610162,
-0x01640168,0x0166016a,0x016c016e,0x01760173,0x01780177,0x0182017e,0x017c0182,0x01850182,
-0x01810186,0x017f0186,0x01750179,0x016d016f,0x01640169,0x014e0156,0x013c0145,0x01280131,
-0x0113011e,0x01010106,0x00ed00f5,0x00d100e2,0x00bd00cb,0x00a700b0,0x0093009f,0x00780084,
-0x00610071,0x004e0059,0x00390048,0x002d003c,0x001e0029,0x000e0012,0xfffd0009,0xffe2fff1,
-0xffd2ffda,0xffbdffc3,0xffa5ffac,0xff8dff97,0xff71ff7e,0xff5bff63,0xff33ff49,0xff18ff2b,
-0xff00ff0e,0xfee3fef3,0xfec4fed4,0xfeaafeb6,0xfe91fea0,0xfe7ffe84,0xfe6ffe79,0xfe60fe66,
-0xfe53fe5c,0xfe56fe56,0xfe53fe4f,0xfe5bfe52,0xfe65fe5e,0xfe70fe6c,0xfe82fe7c,0xfe97fe90,
-0xfeb0fea4,0xfec6feba,0xfee0fed0,0xfef9feec,0xff08ff00,0xff1cff14,0xff26ff1f,0xff31ff30,
-0xff35ff31,0xff39ff38,0xff31ff31,0xff30ff30,0xff2aff2a,0xff1dff1d,0xff0bff0b,0xfefaff03,
-0xfeeefef3,0xfee3fee8,0xfed8fede,0xfecefed9,0xfecafece,0xfecefec8,0xfecdfed1,0xfed7fed5,
-0xfee7fee1,0xfef8fef1,0xff11feff,0xff28ff1b,0xff42ff2f,0xff60ff4d,0xff76ff69,0xff94ff84,
-0xffa9ff9d,0xffc3ffb5,0xffd4ffca,0xffefffe1,0xfffffff6,0x000b0004,0x00190013,0x0027001c,
-0x0038002b,0x0040003e,0x00490045,0x0058004d,0x00660060,0x00760070,0x0086007d,0x0093008b,
-0x00a5009a,0x00af00a8,0x00be00ba,0x00c300c9,0x00ce00d1,0x00dd00df,0x00e300e1,0x00e300e3,
-0x00e700ec,0x00ee00f0,0x00f500f4,0x00ed00f9,0x00f600f8,0x00fc0100,0x00fc0100,0x00ff00ff,
-0x010100fa,0x00fb0101,0x00fe00fb,0x00f800f6,0x00f800f8,0x00f500f5,0x00f800f8,0x00f400f4,
-0x00f100f0,0x00e700e9,0x00e500e7,0x00d700df,0x00cb00d3,0x00c300ca,0x00b500be,0x00a800ad,
-0x009e00a5,0x008f0094,0x00870083,0x007c0080,0x0079007b,0x00760075,0x007d007a,0x00850079,
-0x008e008b,0x009a0096,0x00ae00a3,0x00c200ba,0x00db00cf,0x00f000e5,0x010700fd,0x01220116,
-0x012d012b,0x013f013e,0x014c014d,0x01510151,0x0149014e,0x013d0146,0x01230137,0x0107011b,
-0x00e300f8,0x00b900ca,0x0086009e,0x004f0061,0x0011002f,0xffd6fff4,0xff9bffbb,0xff67ff7c,
-0xff32ff50,0xff07ff1e,0xfee1fef4,0xfec4fed8,0xfeaefeb8,0xfe9dfea4,0xfe94fe97,0xfe8efe8a,
-0xfe8efe8b,0xfe84fe8a,0xfe8dfe8c,0xfe86fe88,0xfe86fe86,0xfe83fe85,0xfe81fe7d,0xfe79fe78,
-0xfe74fe73,0xfe69fe6f,0xfe6cfe6b,0xfe6afe68,0xfe63fe64,0xfe5cfe5d,0xfe59fe5b,0xfe51fe57,
-0xfe4cfe53,0xfe4efe4f,0xfe49fe4a,0xfe43fe4d,0xfe3cfe4d,0xfe38fe3f,0xfe34fe39,0xfe33fe31,
-0xfe2efe2f,0xfe24fe24,0xfe21fe25,0xfe1efe1d,0xfe21fe24,0xfe22fe1d,0xfe27fe24,0xfe2dfe2f,
-0xfe3dfe35,0xfe4afe3e,0xfe55fe4b,0xfe60fe55,0xfe78fe6b,0xfe87fe81,0xfe95fe8f,0xfea9fea0,
-0xfebefeb8,0xfec9fec8,0xfedcfeda,0xfeeafeed,0xff02ff00,0xff1fff17,0xff36ff2e,0xff53ff44,
-0xff73ff64,0xff9aff84,0xffbdffa9,0xffe2ffce,0x0007fff3,0x00300022,0x00540044,0x00750062,
-0x0094007f,0x00a2009c,0x00b500ac,0x00c000ba,0x00c800c4,0x00c500c8,0x00c100c9,0x00ba00bf,
-0x00bd00c2,0x00bc00bf,0x00ca00c4,0x00da00ce,0x00f300df,0x010800fb,0x01200110,0x0142012c,
-0x01620153,0x01830170,0x01a80196,0x01be01b1,0x01dc01d0,0x01ec01e6,0x01fe01f3,0x02050203,
-0x020e020c,0x0209020b,0x02020202,0x01f701fe,0x01f501fd,0x01e901f5,0x01e501ed,0x01ec01e8,
-0x01f201eb,0x01f301ee,0x01fb01fa,0x020a01fd,0x0217020c,0x022a0223,0x02330230,0x02460242,
-0x02590251,0x026b0260,0x027d0274,0x028c0280,0x02930290,0x029f0299,0x02a602a9,0x02aa02a9,
-0x02ae02ae,0x02b902b3,0x02b202af,0x02af02ae,0x029d02ac,0x0291029a,0x027b0284,0x0261026d,
-0x023d024f,0x02180229,0x01ec0202,0x01b701ce,0x01810198,0x013f015c,0x00fd0120,0x00c200e0,
-0x007e009d,0x003b005a,0xfff50015,0xffb6ffd9,0xff74ff94,0xff3cff57,0xfefdff1e,0xfec4fee7,
-0xfe97feb1,0xfe6efe85,0xfe4efe5e,0xfe2cfe41,0xfe20fe2b,0xfe16fe21,0xfe19fe18,0xfe23fe21,
-0xfe38fe2a,0xfe48fe41,0xfe5efe51,0xfe79fe6f,0xfe9cfe8c,0xfeb9feaf,0xfed9fece,0xfefbfeed,
-0xff0fff08,0xff2bff1a,0xff43ff36,0xff52ff43,0xff5cff50,0xff60ff5a,0xff62ff5f,0xff61ff60,
-0xff5fff64,0xff63ff5d,0xff5eff5d,0xff5dff5e,0xff59ff57,0xff50ff4b,0xff41ff43,0xff36ff38,
-0xff29ff2a,0xff18ff21,0xff09ff11,0xfef8feff,0xfee5feee,0xfed2fed6,0xfebcfec6,0xfea1feb3,
-0xfe88fe9a,0xfe6ffe83,0xfe5cfe69,0xfe40fe53,0xfe24fe32,0xfe09fe15,0xfdebfdf8,0xfdccfddc,
-0xfda9fdbb,0xfd88fd9b,0xfd6afd7c,0xfd50fd60,0xfd3bfd4a,0xfd21fd32,0xfd15fd19,0xfd13fd11,
-0xfd0dfd10,0xfd12fd0d,0xfd2afd1a,0xfd3dfd2d,0xfd5bfd4c,0xfd78fd69,0xfd9ffd88,0xfdc8fdb3,
-0xfdf2fddf,0xfe1ffe0e,0xfe47fe30,0xfe6efe5e,0xfe8efe83,0xfeb4feaa,0xfed2fecf,0xfef0fef0,
-0xff08ff08,0xff21ff1d,0xff39ff34,0xff52ff49,0xff6eff5f,0xff7cff74,0xff96ff8c,0xffadffa3,
-0xffc7ffbb,0xffdfffce,0xfffaffea,0x00190006,0x00330023,0x004d0040,0x00660056,0x00840077,
-0x009b008f,0x00ad00aa,0x00bb00b6,0x00ca00c2,0x00d000d3,0x00d200d2,0x00d300ce,0x00d100ce,
-0x00cb00c7,0x00c400c5,0x00bc00bc,0x00b300ba,0x00b300b8,0x00b600b8,0x00be00bb,0x00ca00ca,
-0x00dc00d6,0x00ef00df,0x010e00fc,0x012e011c,0x014c0137,0x016c0156,0x018e017a,0x01ae01a2,
-0x01cb01bf,0x01e901d8,0x020101f6,0x0215020e,0x02270223,0x02370236,0x02430244,0x02560252,
-0x025c0257,0x02610260,0x026b0265,0x02670269,0x026a0268,0x026e0269,0x026c026b,0x02770271,
-0x02780275,0x02760274,0x027d0279,0x027d0284,0x027d0281,0x0280027e,0x027b0282,0x027b0279,
-0x026f0273,0x02600267,0x024e0257,0x02410245,0x021c022b,0x01f6020a,0x01cb01de,0x01a101b7,
-0x0167018d,0x01370155,0x0100011b,0x00c800e4,0x009900ac,0x006b0080,0x003d004f,0x00120020,
-0xffec0000,0xffd4ffe6,0xffc1ffcc,0xffb6ffbd,0xffaeffb4,0xffb2ffb4,0xffbdffb9,0xffceffc6,
-0xffdcffda,0xfff1ffe9,0x00060005,0x001f001a,0x003a002f,0x004f0049,0x0064005d,0x0073006e,
-0x007c0077,0x0082007c,0x007f007d,0x0079007d,0x00680071,0x005d0062,0x00470051,0x002c0032,
-0x00100017,0xfff0fff9,0xffd6ffe0,0xffafffbd,0xff8dff9c,0xff63ff79,0xff43ff55,0xff1fff34,
-0xfef2ff05,0xfecafee0,0xfea5feb8,0xfe79fe92,0xfe57fe69,0xfe38fe49,0xfe21fe2f,0xfe0afe13,
-0xfdeefdf8,0xfddefde0,0xfdd2fdd1,0xfdc9fdcf,0xfdc4fdc8,0xfdc5fdc5,0xfdbefdc6,0xfdc5fdc4,
-0xfdcafdc8,0xfdcffdcf,0xfdddfdd2,0xfddefdde,0xfdeefde5,0xfdf5fdf1,0xfdfefdfa,0xfe02fdff,
-0xfe0afe02,0xfe12fe0c,0xfe1cfe19,0xfe26fe1d,0xfe2cfe26,0xfe37fe31,0xfe42fe38,0xfe46fe45,
-0xfe50fe4d,0xfe55fe58,0xfe62fe62,0xfe70fe6a,0xfe7bfe7b,0xfe92fe8b,0xfea5fe9d,0xfebdfeb4,
-0xfeddfed1,0xfefefeee,0xff1eff0d,0xff3eff30,0xff5cff51,0xff76ff6c,0xff92ff8b,0xffa8ffa3,
-0xffb8ffb1,0xffc9ffc0,0xffceffc9,0xffdaffd3,0xffd8ffd7,0xffddffd6,0xffd7ffdb,0xffd8ffcf,
-0xffceffd3,0xffc3ffc9,0xffbcffc5,0xffb3ffbb,0xffb3ffb3,0xffb2ffb3,0xffb4ffb6,0xffb5ffb2,
-0xffc2ffb9,0xffd0ffca,0xffddffd9,0xfff8ffed,0x00140008,0x003a002a,0x006a0057,0x00970080,
-0x00c700a8,0x00fe00dd,0x01350118,0x0160014a,0x019c0186,0x01d601b4,0x020601eb,0x0230021c,
-0x025d0246,0x027e026c,0x029d0293,0x02b302ad,0x02c902bd,0x02d302cd,0x02d702d9,0x02d602d2,
-0x02ce02d1,0x02b902c7,0x02a602b3,0x02870299,0x026f027e,0x024d025d,0x0227023e,0x02010215,
-0x01d001e6,0x01a901b9,0x01810192,0x0157016d,0x01380145,0x01110120,0x00f50105,0x00d800e2,
-0x00c500d0,0x00b800c4,0x00a700b6,0x00a100a4,0x009f00a0,0x00a2009e,0x00a500a6,0x00a800a2,
-0x00ad00a8,0x00b200b5,0x00ba00bc,0x00c100c0,0x00ce00c8,0x00cf00cb,0x00d900d3,0x00d500d3,
-0x00d400d3,0x00d000cf,0x00c800ca,0x00bd00c5,0x00ae00bc,0x009c00a9,0x00840090,0x006a0072,
-0x00490055,0x00230033,0xfffa000e,0xffd3ffe4,0xffabffc1,0xff83ff99,0xff5dff70,0xff3dff49,
-0xff1cff21,0xfefaff0d,0xfee2fef0,0xfec6fed7,0xfeb7fec5,0xfeaafeb0,0xfe97fea1,0xfe88fe90,
-0xfe76fe79,0xfe71fe75,0xfe5cfe68,0xfe4cfe56,0xfe3cfe4b,0xfe31fe37,0xfe25fe2a,0xfe21fe1f,
-0xfe1bfe1c,0xfe13fe15,0xfe18fe16,0xfe24fe1d,0xfe38fe2e,0xfe45fe3d,0xfe5cfe4f,0xfe79fe6c,
-0xfe94fe8b,0xfebdfea4,0xfed7fec7,0xfefbfee7,0xff17ff11,0xff38ff29,0xff5bff4a,0xff72ff63,
-0xff8fff81,0xffa7ff9a,0xffc8ffb8,0xffdeffd3,0xfff6ffea,0x00080000,0x00170011,0x00250020,
-0x002d0029,0x00310036,0x002f0038,0x00300034,0x00200029,0x000d0019,0xfffa0006,0xffdfffe9,
-0xffc6ffce,0xffa6ffb3,0xff91ff9a,0xff7eff84,0xff69ff72,0xff60ff5f,0xff5aff5a,0xff59ff52,
-0xff5fff59,0xff63ff61,0xff6eff69,0xff7eff7a,0xff8cff83,0xff9aff91,0xffa5ff9e,0xffadff9f,
-0xffbaffaf,0xffb8ffba,0xffbaffc2,0xffc3ffbd,0xffc0ffc4,0xffb9ffbd,0xffbaffbd,0xffbdffbe,
-0xffbcffbf,0xffc6ffc1,0xffceffc6,0xffd9ffd0,0xffeeffde,0x0002fff6,0x0018000b,0x002f001c,
-0x00440037,0x005d004b,0x0078006f,0x008e0083,0x00a50096,0x00b300a7,0x00c800be,0x00d700d4,
-0x00e900e0,0x00f500f0,0x00f900f5,0x01050102,0x0108010b,0x010e010b,0x01150111,0x010d010d,
-0x010e010f,0x0109010b,0x00fc0104,0x00fd00fb,0x00ef00f2,0x00e600e6,0x00d500dc,0x00ce00ce,
-0x00bc00c6,0x00b700b7,0x00a800b2,0x00a800ad,0x00a300a8,0x009b00a1,0x009e00a1,0x00a5009e,
-0x00a700a1,0x00af00a6,0x00b300b1,0x00b300b1,0x00b600b5,0x00ba00bd,0x00bd00bd,0x00bd00b8,
-0x00c000c0,0x00bd00c1,0x00b900bd,0x00bb00c0,0x00b200b4,0x00a900ab,0x00a600a5,0x0092009b,
-0x0084008e,0x0076007c,0x0065006f,0x004e0058,0x00380043,0x001f002e,0x00050015,0xffe9fffb,
-0xffd2ffe0,0xffaaffbf,0xff94ff9c,0xff72ff80,0xff55ff5c,0xff36ff41,0xff11ff1e,0xfef6ff09,
-0xfedcfeef,0xfec8feda,0xfebbfecd,0xfeacfeba,0xfea2fea8,0xfe9dfe9c,0xfe98fe96,0xfe94fe92,
-0xfe95fe96,0xfe9ffe9d,0xfeabfea9,0xfeb5feb3,0xfec4febc,0xfecffecb,0xfee1fed8,0xfef0fee9,
-0xfefefef5,0xff06fefc,0xff0eff04,0xff09ff05,0xff07feff,0xff00ff00,0xfeeffef7,0xfee1fee6,
-0xfee0fee2,0xfecdfed1,0xfec4fec3,0xfec2febc,0xfeb9feb8,0xfeb6feb7,0xfec5fec0,0xfed5fecf,
-0xfeeafee0,0xff0afef7,0xff28ff14,0xff41ff36,0xff63ff55,0xff81ff74,0xff98ff91,0xffaeffa7,
-0xffc2ffb8,0xffcaffc7,0xffcfffcc,0xffd0ffd0,0xffccffcb,0xffc8ffcc,0xffc5ffc8,0xffbdffbe,
-0xffb8ffba,0xffb1ffb1,0xffb2ffad,0xffafffab,0xffa7ffa6,0xffa2ffa5,0xffa6ffa4,0xffa4ffa2,
-0xffa0ffa3,0xffa1ffa9,0xff9fffa6,0xffa3ffa8,0xffa3ffa2,0xffa7ffa8,0xffaaffa4,0xffb4ffa9,
-0xffc0ffae,0xffceffc6,0xffe1ffd4,0xfffdffef,0x000f000d,0x00330028,0x005c004f,0x007f0076,
-0x00a20092,0x00cb00b1,0x00ec00da,0x010600f8,0x01220114,0x0135012c,0x0141013b,0x01470141,
-0x01500149,0x014f014f,0x0148014c,0x013b0145,0x01350140,0x01310135,0x0129012e,0x0128012a,
-0x012a012a,0x0129012c,0x012c012f,0x01360134,0x01480142,0x0153014a,0x0168015a,0x01780175,
-0x018b0180,0x01a00197,0x01b701ad,0x01ce01c0,0x01da01ce,0x01e501e0,0x01f701ef,0x02010200,
-0x020d0204,0x02120213,0x021b0217,0x02240220,0x02240224,0x022e022c,0x0232022f,0x023f0237,
-0x0241023f,0x02450247,0x024b024b,0x02560251,0x025d0252,0x025a0255,0x02580257,0x02570258,
-0x0244024c,0x023b0244,0x02240231,0x0210021d,0x01f50208,0x01dc01ea,0x01b601c9,0x019301a3,
-0x016f0181,0x0145015b,0x01200132,0x00f30109,0x00cd00e0,0x00a900be,0x00810098,0x00600075,
-0x00440054,0x0022003b,0x0011001d,0xfff60004,0xffe4ffe9,0xffd1ffd8,0xffbbffc1,0xffaeffb3,
-0xff9affa7,0xff91ff94,0xff84ff86,0xff71ff76,0xff5dff65,0xff50ff5c,0xff39ff4d,0xff31ff39,
-0xff23ff2c,0xff16ff1b,0xff0cff0d,0xfef7fefc,0xfef0fef1,0xfee7fee8,0xfedafede,0xfed3fed8,
-0xfed3fed2,0xfecbfec8,0xfebffec6,0xfebafec1,0xfeb0feb5,0xfe9cfea5,0xfe8cfe9b,0xfe7afe89,
-0xfe68fe71,0xfe57fe5a,0xfe39fe44,0xfe17fe26,0xfdfafe0b,0xfde0fdf3,0xfdc5fdd1,0xfda7fdb7,
-0xfd8ffd99,0xfd77fd7e,0xfd66fd67,0xfd53fd50,0xfd44fd45,0xfd3dfd3f,0xfd36fd37,0xfd35fd37,
-0xfd3bfd39,0xfd44fd40,0xfd47fd42,0xfd52fd4d,0xfd5dfd58,0xfd68fd65,0xfd73fd71,0xfd7ffd7c,
-0xfd8cfd84,0xfd9afd90,0xfda5fda2,0xfda9fdaa,0xfdb9fdb6,0xfdcafdc2,0xfdd6fdd1,0xfde8fdda,
-0xfdfbfdec,0xfe08fdfe,0xfe19fe0f,0xfe27fe22,0xfe32fe33,0xfe45fe3a,0xfe57fe50,0xfe6cfe62,
-0xfe7dfe74,0xfe93fe8a,0xfea8fe9f,0xfebffeb1,0xfed9feca,0xfef4fee2,0xff16ff03,0xff2bff22,
-0xff4bff39,0xff72ff5d,0xff97ff85,0xffbeffab,0xffecffcc,0x0011fffc,0x0037002d,0x0059004d,
-0x00770072,0x00990090,0x00b400aa,0x00c800bf,0x00d000cb,0x00da00d9,0x00e100db,0x00dd00dd,
-0x00da00d8,0x00d300d7,0x00c700c6,0x00b800c2,0x00ae00b1,0x009a00a1,0x00900091,0x00810086,
-0x00760077,0x00720073,0x00700074,0x00740071,0x007f007d,0x00900086,0x00a8009c,0x00c300b2,
-0x00e200cb,0x010200f0,0x01210110,0x01490136,0x016e015c,0x0195018a,0x01b401a8,0x01d401c9,
-0x01f201e4,0x020c01fa,0x02180210,0x02280220,0x022b0227,0x022f0227,0x02260225,0x021a0221,
-0x020d0217,0x01fa0203,0x01dd01e6,0x01c501ce,0x01ad01b7,0x018b0199,0x0173017a,0x01540165,
-0x013e014e,0x01280134,0x01120122,0x01080112,0x01000105,0x00ff0101,0x010200fc,0x010900fd,
-0x01100107,0x011a0112,0x01250117,0x01330125,0x013e0137,0x01430141,0x014a0144,0x014f014a,
-0x01540149,0x01490148,0x01420149,0x013e0140,0x01320139,0x0128012f,0x011b0129,0x01150120,
-0x01100114,0x0108010a,0x00fd00f9,0x00f600f4,0x00e700e7,0x00db00e3,0x00d100dc,0x00c400d1,
-0x00bc00c7,0x00b100b4,0x00a100ab,0x0095009a,0x00810089,0x0072007e,0x005e0065,0x004a0050,
-0x00380042,0x00260030,0x0005001a,0xffeffffa,0xffd0ffe1,0xffb5ffc2,0xff93ffa6,0xff71ff7f,
-0xff4eff63,0xff2aff39,0xff0dff1b,0xfee7fefa,0xfecffedc,0xfeb5fec0,0xfeaafead,0xfe95fe9b,
-0xfe8efe8f,0xfe87fe8a,0xfe8efe8d,0xfe94fe88,0xfea5fe9f,0xfeb4feab,0xfec5febd,0xfed5fecc,
-0xfeecfede,0xff03fef6,0xff15ff08,0xff24ff1f,0xff2fff2d,0xff3bff34,0xff45ff3e,0xff50ff4e,
-0xff4cff51,0xff57ff53,0xff5dff59,0xff65ff5f,0xff6aff6a,0xff7eff70,0xff8eff88,0xff96ff99,
-0xffaaffa8,0xffbeffb9,0xffccffc7,0xffe8ffdd,0xfff7ffed,0x000b0000,0x001a0012,0x00250021,
-0x00300029,0x003a0037,0x0045003a,0x0049004b,0x004c004c,0x004f0052,0x004a004c,0x0050004a,
-0x0049004d,0x00460044,0x003c003f,0x00360037,0x001b0024,0x00060012,0xfff2fffa,0xffdaffee,
-0xffbfffcd,0xffabffb9,0xff96ff9f,0xff86ff8f,0xff74ff75,0xff6cff6a,0xff6aff65,0xff6aff66,
-0xff70ff6d,0xff7cff76,0xff8bff89,0xff9cff98,0xffadffaa,0xffbeffb7,0xffd1ffcb,0xffd9ffd6,
-0xffe4ffdd,0xffeeffe7,0xffe6ffe6,0xffe8ffeb,0xffddffe5,0xffd6ffdc,0xffcdffd0,0xffc0ffca,
-0xffb5ffc2,0xffb3ffb6,0xffaeffb0,0xffabffac,0xffb8ffb1,0xffb9ffb8,0xffbbffbb,0xffc4ffc5,
-0xffcbffc7,0xffd2ffcc,0xffd6ffcd,0xffd8ffd4,0xffd9ffd2,0xffd8ffd3,0xffdbffe0,0xffd2ffd8,
-0xffd7ffcf,0xffd8ffd1,0xffd5ffd6,0xffd1ffd2,0xffd7ffd5,0xffdfffdd,0xffefffe7,0xfffefff5,
-0x00100007,0x0028001c,0x00420032,0x00600050,0x0079006e,0x0090008a,0x00a9009e,0x00c000b2,
-0x00d400cb,0x00e400dd,0x00f200e6,0x00fb00f5,0x00fc00f9,0x00f800fc,0x00f700fd,0x00f300fc,
-0x00f300f6,0x00eb00f3,0x00e900ed,0x00dc00e5,0x00db00df,0x00d100db,0x00cd00cf,0x00c500c7,
-0x00bc00cb,0x00b000b9,0x00a300aa,0x008e0096,0x00730081,0x005c0061,0x0035003e,0x000d001b,
-0xffddfff1,0xffb1ffc4,0xff7bff96,0xff4bff5c,0xff12ff2e,0xfee1fefd,0xfeb1fec8,0xfe83fe97,
-0xfe5bfe6b,0xfe38fe40,0xfe1bfe26,0xfdfcfe09,0xfdeffdfa,0xfde8fdf0,0xfde4fde7,0xfde8fde3,
-0xfdf3fde9,0xfdf9fdf8,0xfe05fe01,0xfe14fe0f,0xfe26fe1c,0xfe33fe2a,0xfe3bfe38,0xfe4cfe42,
-0xfe59fe50,0xfe5efe63,0xfe69fe67,0xfe6efe74,0xfe78fe7e,0xfe81fe80,0xfe89fe86,0xfe94fe87,
-0xfea9fe9a,0xfeb4fea9,0xfec7febd,0xfed6fed1,0xfef5fee6,0xff11ff02,0xff38ff24,0xff5fff46,
-0xff83ff71,0xffacff9c,0xffd9ffc7,0xfffeffe8,0x00250013,0x0049003b,0x00670057,0x00870073,
-0x009c008c,0x00aa009f,0x00b100ad,0x00b400b4,0x00b000b3,0x00aa00b1,0x009b00a4,0x008d008e,
-0x007e008a,0x00670070,0x00520059,0x00400042,0x002f0033,0x00200025,0x0015001c,0x000e0018,
-0x00140018,0x00210024,0x00330030,0x004a0043,0x00690059,0x00840075,0x00a90090,0x00c600b6,
-0x00f300d9,0x011d0106,0x01440132,0x016c0151,0x018e0177,0x01a30196,0x01bb01b0,0x01cc01c3,
-0x01d901d4,0x01e401e0,0x01eb01e7,0x01e901eb,0x01dd01e8,0x01d601df,0x01ca01d2,0x01c101cc,
-0x01af01bb,0x01ae01b4,0x01a201a5,0x019e019c,0x01970195,0x018f018f,0x01880189,0x018a0189,
-0x018b0187,0x0190018f,0x01940194,0x019b0194,0x01a501a0,0x01aa01a7,0x01ab01ad,0x01ac01ad,
-0x01b001b3,0x01ac01b2,0x01ae01ae,0x01ab01aa,0x01a401a5,0x01a0019e,0x0195019a,0x018e018f,
-0x01860186,0x017e017e,0x01750177,0x01700171,0x016a0167,0x015e0165,0x0157015e,0x01550158,
-0x0150015a,0x015a0155,0x01570159,0x015b0159,0x015a015c,0x01570155,0x01570155,0x014c014a,
-0x01420147,0x013d0140,0x01310137,0x0124012b,0x01150123,0x00fe0111,0x00f000fa,0x00d700e5,
-0x00bd00ca,0x009c00b2,0x007e0092,0x005f0071,0x003c004f,0x00160024,0xffebffff,0xffc2ffd8,
-0xff96ffa4,0xff71ff81,0xff48ff5c,0xff1bff2f,0xfef0ff07,0xfec9fede,0xfe9ffeb6,0xfe7efe95,
-0xfe56fe71,0xfe3afe47,0xfe18fe28,0xfdf8fe06,0xfdd8fdeb,0xfdb9fdc8,0xfda0fdaa,0xfd86fd92,
-0xfd72fd80,0xfd67fd6a,0xfd5afd60,0xfd53fd53,0xfd4bfd4d,0xfd4dfd4c,0xfd56fd51,0xfd62fd5c,
-0xfd6efd69,0xfd83fd7c,0xfd98fd8c,0xfda4fda0,0xfdbdfdb3,0xfdcffdc5,0xfde6fdd6,0xfdf8fdeb,
-0xfe01fdf5,0xfe0ffe08,0xfe14fe12,0xfe17fe15,0xfe1bfe18,0xfe19fe14,0xfe11fe17,0xfe0dfe10,
-0xfe11fe0c,0xfe07fe0a,0xfdfdfe01,0xfdfafdfe,0xfdf2fdf2,0xfdebfdf2,0xfdf0fded,0xfdf2fdee,
-0xfdf3fdf0,0xfdf9fdf6,0xfe05fe00,0xfe07fe07,0xfe13fe0d,0xfe21fe1c,0xfe2dfe2b,0xfe38fe3d,
-0xfe4cfe4a,0xfe63fe58,0xfe74fe6f,0xfe8efe7c,0xfea2fe95,0xfeb5fead,0xfeccfebc,0xfeebfed5,
-0xff06fef0,0xff23ff0e,0xff39ff25,0xff53ff46,0xff6bff64,0xff84ff7d,0xffa5ff9b,0xffc4ffb6,
-0xffe1ffd7,0xfffffff1,0x001b0010,0x0034002b,0x00530049,0x00680061,0x00830077,0x0099008f,
-0x00a6009f,0x00b500aa,0x00cc00be,0x00cf00cd,0x00de00d6,0x00e700e2,0x00f400ec,0x00fc00f7,
-0x01100105,0x011c0117,0x012b0124,0x01410137,0x0152014e,0x0169015f,0x01850176,0x0196018e,
-0x01a8019d,0x01b601ad,0x01c301bc,0x01cd01c5,0x01d601cb,0x01d201cc,0x01c601cc,0x01bc01ca,
-0x01bb01c3,0x01ab01be,0x019f01ab,0x019701a0,0x018e018b,0x017f0187,0x01710175,0x016a0171,
-0x01640167,0x01660164,0x01690165,0x01650161,0x01640160,0x01590163,0x01610160,0x015e015c,
-0x015e0159,0x015c0157,0x01590159,0x015a0156,0x015d0156,0x015d015a,0x0162015c,0x01650165,
-0x016e016c,0x01780173,0x0181017f,0x01820182,0x01900186,0x018a018a,0x018f018d,0x0189018d,
-0x01820184,0x0176017c,0x016b0171,0x01520160,0x013c014a,0x01200134,0x0105011b,0x00e300fd,
-0x00c300d7,0x00a100b5,0x00850096,0x00650073,0x0044004e,0x002c0033,0x00100017,0xfff80000,
-0xffe6fff0,0xffd7ffda,0xffd3ffd7,0xffc7ffcf,0xffbdffc5,0xffbeffc2,0xffc5ffc5,0xffceffc1,
-0xffd6ffd1,0xffe3ffd8,0xffecffe9,0xfff7fff0,0x00070002,0x000e000d,0x00150019,0x00210020,
-0x00230027,0x001f0026,0x00160020,0x000b0014,0xfff90005,0xffe4ffef,0xffd0ffda,0xffb6ffc0,
-0xff9cffa6,0xff81ff8d,0xff68ff71,0xff52ff59,0xff3bff45,0xff27ff31,0xff1aff23,0xff11ff1b,
-0xff04ff11,0xff03ff09,0xfefefefe,0xfeeffef7,0xfee2feeb,0xfedafedb,0xfecdfed1,0xfec7fec3,
-0xfebafebe,0xfea5feb2,0xfe98fea1,0xfe87fe98,0xfe7ffe88,0xfe75fe78,0xfe6afe6f,0xfe63fe67,
-0xfe65fe60,0xfe60fe62,0xfe67fe64,0xfe6dfe65,0xfe78fe72,0xfe86fe7d,0xfe94fe8c,0xfeacfe9f,
-0xfeb5fead,0xfecdfec5,0xfee5fee3,0xff01fefb,0xff1dff15,0xff36ff2f,0xff59ff51,0xff71ff66,
-0xff90ff87,0xffb4ffa4,0xffdeffc7,0x0003ffeb,0x0021000e,0x004a0037,0x006a0054,0x0095007f,
-0x00b000a1,0x00cd00be,0x00e200d8,0x00fa00f1,0x01080107,0x01110111,0x01150115,0x01120118,
-0x010c0113,0x00fa0106,0x00ea00f1,0x00d700df,0x00ba00cc,0x00ac00b7,0x009800a1,0x008f0094,
-0x007f0084,0x00700079,0x006a0071,0x00660067,0x00650064,0x00620066,0x00650068,0x006b0064,
-0x006b0067,0x006f006c,0x0077006f,0x00790076,0x007d007a,0x0081007b,0x0084007f,0x0083007b,
-0x008e0089,0x00910091,0x00960094,0x00970098,0x0096009b,0x00930095,0x008f0092,0x0088008e,
-0x0077007f,0x006b0072,0x005b0064,0x0044004f,0x002a0036,0x0010001b,0xffed0000,0xffd5ffdf,
-0xffbfffca,0xffb0ffb5,0xff9affa1,0xff8dff8a,0xff7cff82,0xff70ff74,0xff6aff67,0xff5eff5c,
-0xff59ff52,0xff55ff52,0xff53ff4f,0xff53ff4c,0xff51ff4c,0xff4aff4a,0xff3dff48,0xff3aff41,
-0xff31ff3b,0xff35ff33,0xff2fff32,0xff31ff32,0xff31ff35,0xff39ff39,0xff3bff3e,0xff48ff48,
-0xff54ff55,0xff69ff5c,0xff76ff68,0xff8dff83,0xffa1ff96,0xffb8ffb0,0xffd2ffc7,0xffe9ffde,
-0xfff9fff5,0x0016000c,0x00290021,0x0038002f,0x00460041,0x0053004d,0x005e0056,0x006b0065,
-0x006c006a,0x0076006f,0x007b0076,0x007f007c,0x0082007a,0x00810083,0x0082007f,0x007b007d,
-0x00750074,0x0072006f,0x0062006c,0x004a0052,0x00360042,0x001a0029,0x0000000b,0xffe1ffe9,
-0xffb2ffca,0xff87ff9d,0xff55ff6d,0xff27ff3f,0xfef3ff0d,0xfebefeda,0xfe8bfea6,0xfe55fe72,
-0xfe27fe3d,0xfdf8fe13,0xfdd3fdeb,0xfdb8fdcc,0xfda1fdac,0xfd94fd98,0xfd8dfd8f,0xfd89fd8c,
-0xfd90fd95,0xfda8fd9d,0xfdb2fdad,0xfdcffdc4,0xfdeefde2,0xfe11fe00,0xfe35fe24,0xfe54fe45,
-0xfe7afe69,0xfea1fe88,0xfecafeb3,0xfef0fedb,0xff14ff02,0xff3eff27,0xff67ff50,0xff91ff7d,
-0xffb4ff9e,0xffddffce,0x0009fff1,0x00350020,0x00590047,0x007b006b,0x00a90097,0x00c600ba,
-0x00eb00e4,0x01110105,0x01350120,0x014f0141,0x016e015e,0x018b017b,0x01a80199,0x01ba01b2,
-0x01d701ca,0x01e401de,0x01fb01ee,0x02090203,0x0215020e,0x02180211,0x021a0217,0x02160214,
-0x020e020d,0x01f601fd,0x01e101ec,0x01ca01d5,0x01af01b7,0x019501a9,0x01810186,0x01630171,
-0x01500156,0x01410149,0x012e0134,0x012b012d,0x012b012b,0x0133012d,0x01380133,0x014d0146,
-0x0166015c,0x01830177,0x01a0018b,0x01bd01af,0x01dc01cd,0x01f301e9,0x020e0206,0x02260221,
-0x023e0235,0x02420244,0x0245024a,0x0243024d,0x02370248,0x02230236,0x02100220,0x01ed0200,
-0x01c601d9,0x019f01b0,0x016e0186,0x01440154,0x01170127,0x00e400fb,0x00c200d2,0x009e00ad,
-0x007e008b,0x006c0076,0x005b0064,0x004b0058,0x0046004a,0x004c0049,0x004b004f,0x00560052,
-0x005d005b,0x006a0065,0x00720071,0x007d007a,0x00820081,0x0081007d,0x00820080,0x007c007f,
-0x006a0078,0x0064006b,0x004f005a,0x00370040,0x0025002c,0x00040015,0xffeffffc,0xffd4ffe0,
-0xffbaffc3,0xff9effaa,0xff8aff90,0xff72ff78,0xff5dff66,0xff51ff56,0xff40ff47,0xff3cff41,
-0xff32ff35,0xff30ff32,0xff33ff31,0xff38ff34,0xff43ff3d,0xff4aff46,0xff52ff4e,0xff57ff56,
-0xff5bff56,0xff59ff5c,0xff50ff54,0xff45ff4d,0xff31ff3b,0xff12ff29,0xfeedfeff,0xfec6feda,
-0xfe96feb0,0xfe65fe78,0xfe2efe42,0xfdf9fe13,0xfdc8fde4,0xfd98fdb0,0xfd6dfd88,0xfd4dfd5f,
-0xfd31fd43,0xfd23fd2d,0xfd19fd21,0xfd19fd1a,0xfd17fd18,0xfd21fd19,0xfd29fd24,0xfd39fd2c,
-0xfd4bfd3c,0xfd5afd4f,0xfd6efd62,0xfd7bfd71,0xfd92fd83,0xfd9dfd92,0xfdacfd9f,0xfdbbfdb2,
-0xfdcafdc1,0xfdd1fdcc,0xfddafdd6,0xfde7fde2,0xfdf2fdef,0xfdfffdf8,0xfe11fe0c,0xfe20fe17,
-0xfe2cfe20,0xfe3efe35,0xfe50fe45,0xfe6cfe5f,0xfe7efe79,0xfe9efe92,0xfebafeaf,0xfedafec4,
-0xfef7fee4,0xff18ff0d,0xff37ff25,0xff55ff41,0xff6dff59,0xff82ff77,0xff90ff88,0xff9bff94,
-0xffa6ffa0,0xffa3ffa5,0xffaaffa7,0xff9cffa4,0xff9aff9c,0xff96ff97,0xff8fff8e,0xff8cff8e,
-0xff87ff86,0xff8aff89,0xff96ff90,0xffacffa2,0xffc2ffba,0xffe4ffd5,0x000cfffd,0x003e0024,
-0x006e0050,0x00a10087,0x00d900b6,0x011200f4,0x014a012c,0x0184016a,0x01b3019b,0x01e701c8,
-0x021201fa,0x0237022a,0x0258024d,0x02730267,0x0283027e,0x0293028e,0x02a2029f,0x02a802a6,
-0x02ad02a8,0x02aa02a7,0x02b302af,0x02ad02aa,0x02a402a5,0x02a102a3,0x02950295,0x028c028d,
-0x02800283,0x0276027b,0x0269026f,0x025d0260,0x024f0253,0x02420244,0x022f0237,0x021b0226,
-0x020b0212,0x01ee01fc,0x01d601e0,0x01b901c5,0x01a201b2,0x01850198,0x016a0179,0x01540161,
-0x01420149,0x012b0138,0x011c0124,0x010b010f,0x00ff0105,0x00ef00f5,0x00df00ea,0x00d800dd,
-0x00d500d9,0x00cb00ca,0x00bc00c3,0x00b500b8,0x00a900b0,0x0098009e,0x008a0093,0x00840087,
-0x006f0076,0x00660067,0x0052005f,0x004a004e,0x003d0044,0x003c003c,0x00340036,0x002f0031,
-0x00330031,0x002f0035,0x00330030,0x00300033,0x00280030,0x002b0031,0x0023002c,0x001a0022,
-0x000a0018,0xfffc0009,0xffe7fff3,0xffceffdd,0xffb3ffbd,0xff93ffa0,0xff70ff7b,0xff46ff59,
-0xff1cff33,0xfef4ff0c,0xfed3fee4,0xfea9fec1,0xfe84fe96,0xfe60fe70,0xfe43fe4f,0xfe29fe35,
-0xfe13fe1b,0xfe05fe06,0xfe01fdfe,0xfe02fdfc,0xfe09fe07,0xfe1afe11,0xfe36fe28,0xfe52fe42,
-0xfe73fe65,0xfea0fe8d,0xfed2feba,0xff01fee7,0xff38ff1c,0xff61ff47,0xff8dff75,0xffb6ffa7,
-0xffdeffcc,0xfffbffec,0x00120008,0x0027001d,0x002f002b,0x00390037,0x00360032,0x00330031,
-0x002a0029,0x00190022,0x000c000c,0xfffdffff,0xffe7ffeb,0xffd6ffdf,0xffbeffcb,0xffb2ffb9,
-0xff9bffa6,0xff8cff94,0xff73ff7f,0xff64ff6c,0xff4dff5f,0xff3eff45,0xff2aff36,0xff1eff22,
-0xff0eff16,0xff02ff09,0xfef9fef3,0xfeeffef4,0xfef2fef4,0xfef4feee,0xfefafef8,0xff0cff01,
-0xff15ff0a,0xff2eff19,0xff46ff34,0xff63ff4e,0xff7bff66,0xff94ff84,0xffb5ffa8,0xffd3ffc7,
-0xfff0ffdf,0x000afffd,0x001c0017,0x0030002f,0x0043003e,0x00530050,0x005e0057,0x006c005e,
-0x0076006c,0x007a0079,0x00830082,0x00930098,0x00a2009f,0x00b700b0,0x00ce00c5,0x00e500d4,
-0x00ff00f3,0x011a010d,0x01300127,0x014e013d,0x01620156,0x0175016b,0x0183017c,0x018b0188,
-0x0192018a,0x01910193,0x018b0190,0x01800186,0x016c0179,0x0161016b,0x0150015b,0x01360144,
-0x011c012c,0x01080114,0x00f100fb,0x00d500ea,0x00be00cf,0x00a700b3,0x0090009f,0x007f008d,
-0x00640074,0x00540060,0x00410043,0x002b0031,0x00180022,0x000b000a,0xfff60003,0xffedfff4,
-0xffdfffea,0xffd6ffdf,0xffd2ffd2,0xffccffce,0xffc5ffcb,0xffc4ffbe,0xffc1ffbc,0xffbaffb6,
-0xffb4ffb3,0xffa4ffaa,0xff99ff9b,0xff7eff8d,0xff74ff7b,0xff5eff6c,0xff4cff4e,0xff31ff39,
-0xff11ff22,0xfef7ff0a,0xfee0fef0,0xfec6fed2,0xfeb1febb,0xfea1feaa,0xfe97fe9b,0xfe89fe8d,
-0xfe85fe83,0xfe83fe85,0xfe88fe81,0xfe8afe84,0xfe93fe95,0xfe9dfe98,0xfea7fea4,0xfeb9feab,
-0xfec3fec1,0xfecafecb,0xfed7fed4,0xfee0fedd,0xfeeefee9,0xfef8fef0,0xff05fefe,0xff0dff0c,
-0xff1fff17,0xff2cff29,0xff41ff37,0xff51ff46,0xff67ff5d,0xff72ff6c,0xff8dff7c,0xffa8ff94,
-0xffbeffae,0xffd9ffc8,0xfff1ffe4,0x000cfffc,0x00260015,0x003a0028,0x00460038,0x0056004e,
-0x005c0058,0x00670061,0x00690066,0x006f006e,0x00710071,0x006f0071,0x006f006e,0x00660067,
-0x005e0064,0x00540059,0x00490054,0x0044004b,0x003b003e,0x00290031,0x001d0026,0x000b0012,
-0xfff90006,0xffdefff3,0xffcaffd8,0xffb5ffbe,0xff99ffa4,0xff7bff86,0xff5fff6c,0xff43ff50,
-0xff2cff38,0xff1bff25,0xff02ff0c,0xfef1fef7,0xfee7fee6,0xfeddfee3,0xfed4fee0,0xfedffed8,
-0xfee2fedf,0xfee4fee8,0xfef8feee,0xff0aff04,0xff23ff13,0xff40ff2b,0xff55ff45,0xff70ff5d,
-0xff90ff78,0xffacff9b,0xffd2ffb4,0xfff0ffd8,0x0012fffe,0x00350018,0x00590049,0x007a0068,
-0x009e008c,0x00bb00b1,0x00db00ce,0x010100f2,0x01200112,0x01440133,0x015a0151,0x0177016b,
-0x018f0182,0x01a40198,0x01bc01b0,0x01ca01c6,0x01df01d2,0x01f401ee,0x020601f6,0x020f0204,
-0x021b020d,0x021d021e,0x0224021f,0x02260229,0x022e022c,0x0234022e,0x02310233,0x022b022f,
-0x022e022c,0x022c022b,0x0230022d,0x0228022e,0x022a022c,0x02220224,0x02290225,0x02200227,
-0x021f0221,0x021a021d,0x0216021e,0x020a0210,0x02010207,0x01f301f7,0x01e201f3,0x01d901dd,
-0x01c901ce,0x01ad01b5,0x01a301a7,0x01870195,0x01780185,0x016e017a,0x015d0163,0x014c0156,
-0x013a0140,0x012a0132,0x01170120,0x0109010c,0x00ef00fa,0x00db00e1,0x00c500d1,0x00a900b7,
-0x008f009e,0x00730086,0x00510061,0x00350049,0x000f0029,0xffee0000,0xffcdffe1,0xffa3ffba,
-0xff87ff98,0xff63ff77,0xff40ff51,0xff23ff2f,0xfefeff11,0xfed8feea,0xfeb6fecf,0xfe92fea8,
-0xfe7afe7d,0xfe5ffe6c,0xfe45fe49,0xfe33fe36,0xfe1ffe1f,0xfe0ffe10,0xfe03fe01,0xfdfafdf5,
-0xfdf1fdec,0xfdf1fdea,0xfdf1fde6,0xfdf1fde9,0xfdf6fdf2,0xfdfffdfc,0xfe08fe05,0xfe14fe10,
-0xfe1cfe13,0xfe22fe21,0xfe2ffe28,0xfe3dfe34,0xfe44fe3e,0xfe4efe4e,0xfe5ffe5a,0xfe6cfe68,
-0xfe76fe72,0xfe86fe83,0xfe95fe8f,0xfea3fe95,0xfea8fea2,0xfeaefeab,0xfebcfeb3,0xfeb6feb9,
-0xfebafeb7,0xfeb9feb5,0xfeacfeaf,0xfea7fea7,0xfe95fea0,0xfe7ffe89,0xfe6bfe76,0xfe54fe62,
-0xfe3bfe49,0xfe22fe2e,0xfe0cfe18,0xfdf6fe00,0xfde1fdf0,0xfdcffdd9,0xfdc3fdcb,0xfdbefdba,
-0xfdb4fdb7,0xfdb2fdab,0xfdbafdaf,0xfdc0fdb7,0xfdcdfdc8,0xfdddfdde,0xfdfcfdf3,0xfe1dfe13,
-0xfe3efe31,0xfe68fe59,0xfe8cfe7d,0xfeb4fea4,0xfedefecd,0xff09fef2,0xff34ff18,0xff58ff43,
-0xff82ff69,0xffa7ff8e,0xffc5ffb6,0xffe4ffd8,0x0003fff0,0x00150008,0x0026001c,0x003a002f,
-0x0048003a,0x00520046,0x00630054,0x00690061,0x00780068,0x00830078,0x008b0089,0x009f0093,
-0x00b400a3,0x00c400b7,0x00da00ca,0x00ef00e8,0x010600ff,0x01210119,0x0139012d,0x014a0149,
-0x0160015a,0x01740169,0x017b0177,0x01840183,0x01860188,0x018e018e,0x01960194,0x018e0194,
-0x01950195,0x01960196,0x01a1019f,0x01a3019f,0x01a701a5,0x01b101ad,0x01be01b5,0x01c501c1,
-0x01da01d4,0x01e601d9,0x01f501e7,0x020101f9,0x02140212,0x02230220,0x0232022e,0x023d0239,
-0x024c0246,0x0259024f,0x025e025b,0x02650263,0x026c026b,0x026a026f,0x026c0270,0x02660265,
-0x025f0262,0x02550255,0x0245024b,0x022c0237,0x021d0226,0x01f9020b,0x01de01ea,0x01bb01cf,
-0x019d01af,0x01760189,0x014b0164,0x01280141,0x01050119,0x00df00ee,0x00bf00ca,0x00a000a8,
-0x00720087,0x00570061,0x00340043,0x00140027,0xffee0008,0xffdcffea,0xffc0ffd0,0xffacffb8,
-0xff96ffa5,0xff89ff91,0xff80ff85,0xff72ff71,0xff6aff6e,0xff64ff67,0xff63ff60,0xff60ff5d,
-0xff67ff69,0xff6dff68,0xff6dff6d,0xff6eff71,0xff75ff72,0xff79ff78,0xff71ff73,0xff79ff72,
-0xff72ff72,0xff6aff6c,0xff62ff64,0xff56ff5c,0xff4bff4d,0xff3eff43,0xff32ff37,0xff23ff24,
-0xff0eff18,0xff07ff10,0xfef8fefb,0xfef1fef8,0xfee2feee,0xfee0fee3,0xfed4fee0,0xfed6fed3,
-0xfeccfecb,0xfebdfec6,0xfebdfeb8,0xfeb2feb9,0xfeadfead,0xfea7feaa,0xfe9efea3,0xfe94fe9c,
-0xfe8dfe9a,0xfe8bfe8d,0xfe8bfe88,0xfe87fe88,0xfe82fe81,0xfe82fe83,0xfe82fe7d,0xfe87fe81,
-0xfe85fe81,0xfe85fe85,0xfe8dfe8c,0xfe92fe92,0xfe9ffe93,0xfea7fea9,0xfeb3feb1,0xfec4fec2,
-0xfed8fece,0xfef0fee4,0xff0efefa,0xff31ff1e,0xff56ff3f,0xff7dff6a,0xffaeff8e,0xffd8ffbb,
-0x000cffee,0x00370020,0x0069004e,0x008a007b,0x00b0009b,0x00cd00c2,0x00ea00dd,0x00f300f2,
-0x01060103,0x01110113,0x01130111,0x010f010f,0x01060107,0x00f70102,0x00ea00ee,0x00d500d9,
-0x00c100d0,0x00af00b5,0x009a00a1,0x0084008f,0x006e007a,0x005b0065,0x00490051,0x0038003d,
-0x00280032,0x001a001c,0x00070011,0xfffd0004,0xfff5fff9,0xfff1ffec,0xfff5fff2,0xfff6fff5,
-0xfffefff9,0x00060002,0x0012000f,0x0020001e,0x003b0032,0x00510045,0x0068005a,0x007b0074,
-0x00900089,0x00a4009a,0x00b100ac,0x00c200bd,0x00d100c9,0x00d100d0,0x00d900d5,0x00de00dd,
-0x00de00e0,0x00dc00df,0x00d800db,0x00d600d5,0x00cb00d6,0x00c400c8,0x00c400c5,0x00bf00be,
-0x00b900b9,0x00b900b7,0x00ba00b2,0x00b700b6,0x00b300b7,0x00ae00ad,0x00ad00b3,0x00b100a9,
-0x00a500a9,0x00a000a5,0x009c00a0,0x009a009a,0x008a008c,0x007f0084,0x006e0079,0x005b0069,
-0x00500053,0x003e0045,0x00290036,0x0015001f,0xfffb0008,0xffe4fff3,0xffcbffd6,0xffb0ffbc,
-0xff95ffa2,0xff7aff8e,0xff63ff79,0xff4fff58,0xff35ff42,0xff23ff2a,0xff18ff1c,0xff08ff11,
-0xfefaff04,0xfef4fefa,0xfeecfef4,0xfeeffeee,0xfef1fef3,0xfefafef3,0xfefefef9,0xff0aff04,
-0xff12ff10,0xff20ff19,0xff28ff25,0xff38ff32,0xff47ff38,0xff49ff44,0xff4dff46,0xff4eff4a,
-0xff49ff4c,0xff45ff46,0xff39ff42,0xff2fff37,0xff22ff2c,0xff11ff1c,0xfefcff07,0xfef1fef1,
-0xfedafee3,0xfec6fed1,0xfebffec4,0xfeb4feb6,0xfea4feac,0xfea0fea5,0xfea2fea8,0xfea7fea2,
-0xfea5fea8,0xfeb3feab,0xfebffeb5,0xfecefec3,0xfeddfecf,0xfef1fedf,0xff04fef2,0xff16ff08,
-0xff2dff1f,0xff41ff36,0xff57ff4a,0xff65ff5c,0xff7bff73,0xff8fff87,0xffa4ff98,0xffbbffad,
-0xffc9ffbf,0xffdcffd3,0xffefffe3,0xfffefff7,0x000a0002,0x001b0018,0x00250024,0x0031002d,
-0x0040003b,0x00440042,0x004f0049,0x00590051,0x00660059,0x006e0065,0x0076006f,0x007d0074,
-0x0086007f,0x00900085,0x00950090,0x00980098,0x009f00a2,0x00a100a3,0x00a100a8,0x00a100a6,
-0x00a600a1,0x00a6009d,0x00a200a5,0x00a100a3,0x00a3009a,0x00a400a3,0x00a200a3,0x00a400a8,
-0x00a800aa,0x00b600b2,0x00c200b5,0x00ce00c4,0x00d900cf,0x00e700df,0x00fa00ef,0x010300ff,
-0x010e010f,0x011a0118,0x0120011d,0x01260124,0x01290127,0x0126012c,0x01220123,0x01220123,
-0x0115011a,0x0110010f,0x01000104,0x00f600f9,0x00ef00f2,0x00e400ec,0x00e100de,0x00d800d8,
-0x00dd00dd,0x00e100e0,0x00eb00e8,0x00f900f9,0x010b0106,0x01250119,0x013a012b,0x01520144,
-0x016a015a,0x018a017a,0x019d0194,0x01b001a6,0x01bf01b9,0x01ce01c7,0x01d801d1,0x01d901d7,
-0x01d501db,0x01cc01d0,0x01bd01c7,0x01b101bb,0x01a001ad,0x0192019c,0x01800188,0x016a0174,
-0x0155015d,0x013e0147,0x012a013a,0x011c0121,0x01090119,0x00fc010b,0x00e800fa,0x00e000e5,
-0x00cb00d5,0x00c200c6,0x00a900b4,0x009a009f,0x0084008e,0x006f0076,0x0052005e,0x003b0042,
-0x0022002b,0x00050014,0xffeafffe,0xffd2ffda,0xffbbffc4,0xff9bffa9,0xff8cff94,0xff77ff81,
-0xff61ff6b,0xff55ff58,0xff3eff48,0xff2dff39,0xff22ff27,0xff0aff12,0xfefdff04,0xfee8fef1,
-0xfed4fede,0xfebffec9,0xfea7feb7,0xfe8ffe9e,0xfe72fe80,0xfe5dfe68,0xfe3ffe50,0xfe25fe37,
-0xfe0bfe17,0xfdf0fe00,0xfddefde1,0xfdc5fdce,0xfdaffdbc,0xfda3fdac,0xfd99fd9b,0xfd94fd99,
-0xfd8ffd89,0xfd8ffd87,0xfd95fd8e,0xfd9afd95,0xfda6fd9c,0xfdb4fdac,0xfdc2fdbc,0xfdd4fdcd,
-0xfde5fde2,0xfdf8fdf5,0xfe0efe04,0xfe23fe1c,0xfe30fe2a,0xfe40fe36,0xfe4ffe4a,0xfe61fe57,
-0xfe6cfe67,0xfe77fe76,0xfe86fe81,0xfe92fe89,0xfe98fe8f,0xfea0fe9a,0xfea8fe9f,0xfeb0feaa,
-0xfebffeba,0xfecffec7,0xfed8fed2,0xfeecfee0,0xfef4fef4,0xff09ff03,0xff1fff13,0xff30ff26,
-0xff45ff3a,0xff55ff52,0xff6cff5f,0xff73ff6f,0xff84ff80,0xff8eff8d,0xff95ff93,0xff9dff99,
-0xff98ff9d,0xff99ff95,0xff8eff94,0xff89ff87,0xff77ff7e,0xff6eff71,0xff64ff6c,0xff5bff60,
-0xff58ff57,0xff55ff51,0xff5cff59,0xff60ff5f,0xff7aff6d,0xff8dff83,0xffa5ffa0,0xffc5ffb9,
-0xffe9ffd4,0x0011fffb,0x0037001e,0x0065004c,0x00850078,0x00b5009e,0x00d700c5,0x00fd00ec,
-0x0121010f,0x01450133,0x015f014f,0x017b016d,0x01930185,0x01a10198,0x01b001a7,0x01b901b6,
-0x01c401be,0x01ce01c9,0x01d101cf,0x01d201d4,0x01d501d7,0x01e001db,0x01e201e8,0x01eb01e9,
-0x01f001f2,0x01f301ef,0x01f901fa,0x020501fe,0x020e0207,0x020c020e,0x02130219,0x02140217,
-0x021b021a,0x02160215,0x02100214,0x02070207,0x01f601ff,0x01ea01f1,0x01d501e2,0x01c501c7,
-0x01aa01b8,0x01a001a9,0x018c0196,0x0176017f,0x0162016d,0x01540159,0x01480150,0x01480151,
-0x01410146,0x01420145,0x01420144,0x01410140,0x013d0143,0x013d013d,0x0142013e,0x01430141,
-0x01360138,0x01330135,0x012c0130,0x0121012b,0x01120115,0x01000106,0x00ed00f8,0x00d600e9,
-0x00c200cd,0x00ad00bd,0x0092009e,0x007d008a,0x005a0069,0x0038004f,0x001e0031,0x00020010,
-0xffe1ffef,0xffc3ffd3,0xff9fffb4,0xff80ff92,0xff64ff71,0xff42ff56,0xff2dff3d,0xff13ff20,
-0xfef8ff06,0xfedffee6,0xfec8fece,0xfea9febc,0xfe96fea1,0xfe80fe8f,0xfe74fe75,0xfe61fe65,
-0xfe53fe59,0xfe47fe4a,0xfe43fe41,0xfe3efe3d,0xfe3dfe3f,0xfe44fe40,0xfe4dfe43,0xfe5efe51,
-0xfe66fe60,0xfe78fe6b,0xfe8efe83,0xfea0fe95,0xfeb1feac,0xfecafebf,0xfee3fedb,0xfef0feea,
-0xff01fefe,0xff0fff08,0xff1dff15,0xff29ff20,0xff2eff29,0xff3aff2f,0xff38ff38,0xff44ff3a,
-0xff46ff47,0xff4dff45,0xff50ff4c,0xff51ff51,0xff56ff4f,0xff4dff54,0xff47ff4d,0xff3fff43,
-0xff33ff39,0xff26ff30,0xff20ff26,0xff11ff1b,0xff03ff07,0xfef8ff01,0xfee4fef2,0xfee1fee4,
-0xfedafedd,0xfedcfed7,0xfedffed8,0xfee5fedb,0xfef1fee1,0xfefffef4,0xff11ff06,0xff2bff20,
-0xff43ff3a,0xff5eff51,0xff7fff6e,0xffa5ff92,0xffbeffad,0xffd8ffcd,0xffffffe7,0x00110006,
-0x00330028,0x00500042,0x006c005e,0x00870073,0x00a5009a,0x00b900ae,0x00d500cd,0x00ec00e4,
-0x010900f6,0x011c0114,0x01330128,0x0148013d,0x0158014e,0x01670159,0x01700166,0x0175016d,
-0x01740173,0x01750175,0x01710173,0x01660169,0x015a0165,0x01520156,0x013c0146,0x0132013b,
-0x011a0126,0x01080111,0x00f60101,0x00e500ea,0x00de00e1,0x00ce00d1,0x00cb00c7,0x00b600c1,
-0x00ad00b7,0x00ab00b2,0x00a300a6,0x00a300a5,0x009c009f,0x009a0098,0x00940093,0x00900093,
-0x0091008d,0x008c0092,0x008d008d,0x0088008b,0x008a008a,0x008d0090,0x00910090,0x009a0097,
-0x00a5009c,0x00ac00a5,0x00b100af,0x00bd00b7,0x00ce00c3,0x00d100cc,0x00d600d4,0x00db00da,
-0x00de00d5,0x00d700da,0x00d200d1,0x00c000c6,0x00ac00b7,0x0092009e,0x00760082,0x00500064,
-0x002d003b,0x00040019,0xffd7ffee,0xffacffc8,0xff79ff96,0xff51ff67,0xff24ff3b,0xfefbff0e,
-0xfecefee6,0xfeadfebd,0xfe8ffe96,0xfe73fe7c,0xfe5ffe64,0xfe52fe53,0xfe44fe47,0xfe3ffe3b,
-0xfe3ffe3d,0xfe3dfe40,0xfe47fe42,0xfe56fe4c,0xfe60fe59,0xfe72fe62,0xfe7cfe6e,0xfe92fe88,
-0xfea2fe9b,0xfeaffeab,0xfeb8feb7,0xfecafec6,0xfed3fecf,0xfed8fed6,0xfedefed9,0xfedefedc,
-0xfedcfee0,0xfeddfee1,0xfee6fedf,0xfee4fee9,0xfeeafee2,0xfeecfee4,0xfef7feef,0xff06ff03,
-0xff12ff0e,0xff22ff1b,0xff42ff35,0xff51ff4d,0xff68ff5c,0xff84ff79,0xff9dff91,0xffb1ffa7,
-0xffcdffbc,0xffdbffd5,0xffeaffde,0xfff0ffeb,0xfffdfffa,0xfffcfffc,0xfffefffd,0xfff8fffb,
-0xfff6fff6,0xffe6ffe6,0xffd8ffdf,0xffcaffd2,0xffc1ffcc,0xffb4ffbf,0xffa6ffad,0xffa4ffa6,
-0xff9eff9d,0xff96ff9c,0xff99ff9a,0xff9fffa5,0xffa3ffa0,0xffa9ffa8,0xffbbffb3,0xffd0ffbf,
-0xffdcffd2,0xfff2ffe7,0x0005fffb,0x00260014,0x003c002f,0x00560047,0x0073005c,0x008d0078,
-0x00a00091,0x00b700aa,0x00d100c4,0x00e500da,0x00f800ed,0x01080101,0x0114010b,0x0126011e,
-0x0133012a,0x01410136,0x01430140,0x01490144,0x014e014e,0x014e014e,0x01500150,0x01520156,
-0x01510156,0x01530157,0x01560154,0x0150014f,0x014f014f,0x0147014c,0x01420149,0x013f0142,
-0x0136013d,0x01290133,0x0129012b,0x0120011e,0x01160118,0x010e010e,0x01070109,0x00ff0108,
-0x00fe00fe,0x00fa00fe,0x00fd00f8,0x00fa00f9,0x00f700f7,0x00f300f9,0x00f800f9,0x00f800fb,
-0x00fc00fd,0x010400fe,0x01060100,0x01070101,0x01080105,0x01030104,0x01080107,0x0108010c,
-0x01020109,0x01050100,0x00fe00fc,0x00fd00fb,0x00f600f7,0x00ed00ef,0x00e800e6,0x00dd00e1,
-0x00ce00d8,0x00c700cf,0x00bc00c3,0x00ab00b5,0x009c00a7,0x008d009b,0x0085008b,0x007b0081,
-0x00740073,0x0066006b,0x005f005b,0x00550058,0x0049004b,0x0043004a,0x0039003e,0x00330032,
-0x0027002a,0x00260022,0x00170018,0x0009000f,0x00010004,0xfff3fffb,0xffe4fff0,0xffdeffe4,
-0xffd2ffdb,0xffc9ffcf,0xffbfffc3,0xffb7ffc0,0xffaeffb5,0xffa4ffa6,0xff9bff9e,0xff8aff92,
-0xff86ff88,0xff74ff7e,0xff6bff6b,0xff52ff60,0xff42ff4c,0xff2eff34,0xff17ff21,0xff02ff0f,
-0xfee9fef1,0xfed2fedd,0xfebcfec8,0xfea0feae,0xfe90fe9a,0xfe7bfe83,0xfe6cfe75,0xfe56fe66,
-0xfe4bfe52,0xfe3bfe48,0xfe2ffe33,0xfe2afe2a,0xfe28fe25,0xfe24fe22,0xfe1ffe1f,0xfe22fe1f,
-0xfe21fe20,0xfe22fe1c,0xfe24fe22,0xfe28fe26,0xfe2cfe2a,0xfe2efe2a,0xfe2dfe2d,0xfe2bfe2c,
-0xfe2efe33,0xfe2cfe2c,0xfe2afe2c,0xfe28fe28,0xfe26fe2b,0xfe23fe25,0xfe23fe20,0xfe20fe21,
-0xfe24fe1e,0xfe20fe21,0xfe22fe20,0xfe2dfe28,0xfe2efe2d,0xfe39fe31,0xfe46fe41,0xfe5bfe4d,
-0xfe6ffe67,0xfe91fe7c,0xfea5fe98,0xfec3feb1,0xfee9fed3,0xff08fefa,0xff31ff18,0xff4fff3f,
-0xff73ff5f,0xff8cff7f,0xffabff9e,0xffc3ffb9,0xffdfffd5,0xfff0ffee,0x0005fffb,0x000b000d,
-0x001d001f,0x00260025,0x00310033,0x003c0036,0x00450045,0x0055004e,0x005f005a,0x00720064,
-0x007e007a,0x008b0083,0x009e0090,0x00b200a6,0x00bd00b3,0x00d100c6,0x00d700d4,0x00ea00e2,
-0x00f700f4,0x00fc00f9,0x010f010e,0x01180118,0x01260121,0x012e012c,0x01340132,0x013e013c,
-0x014a014a,0x01540152,0x0162015d,0x016f0167,0x017b0176,0x0182017e,0x01900189,0x019b018c,
-0x01a1019a,0x01a3019b,0x01a001a1,0x01a301a1,0x01a101a6,0x01a601a3,0x01a101aa,0x019d01a7,
-0x019e01a2,0x019a019b,0x019a019d,0x019e019e,0x01a3019f,0x01a201a2,0x01b201aa,0x01b901b3,
-0x01c101b9,0x01c801c4,0x01cc01c6,0x01d701cc,0x01df01df,0x01e001dd,0x01e401e2,0x01dc01de,
-0x01db01dd,0x01cc01d2,0x01ba01cb,0x01a801b6,0x0190019e,0x01770184,0x015b0167,0x01360149,
-0x01110126,0x00e600fb,0x00c700d5,0x00a200ae,0x007f008b,0x00510068,0x00310044,0x00150025,
-0xfff60006,0xffe3ffec,0xffd0ffd6,0xffc2ffc5,0xffbcffc0,0xffb6ffb8,0xffb7ffb4,0xffb3ffb0,
-0xffb5ffb3,0xffbcffbc,0xffbfffc4,0xffc7ffc5,0xffccffca,0xffd5ffd1,0xffd5ffd3,0xffd9ffd4,
-0xffdaffdb,0xffdaffd6,0xffd8ffd2,0xffd6ffd0,0xffcdffcf,0xffcbffcc,0xffb8ffbd,0xffacffb1,
-0xffa3ffa7,0xff97ff9e,0xff88ff8f,0xff75ff83,0xff5cff6d,0xff42ff56,0xff2dff39,0xff0dff1f,
-0xfef1fefc,0xfed4fede,0xfeb5fec1,0xfe91fe9e,0xfe71fe7c,0xfe54fe63,0xfe34fe42,0xfe15fe28,
-0xfdf9fe08,0xfde7fdf5,0xfdd9fddf,0xfdc9fdd6,0xfdbefdc1,0xfdb8fdbb,0xfdb6fdbb,0xfdb6fdb7,
-0xfdc7fdc5,0xfdd2fdcb,0xfde7fdda,0xfdfbfdee,0xfe16fe06,0xfe30fe23,0xfe4ffe3f,0xfe6ffe5d,
-0xfe93fe82,0xfeb2fe9e,0xfed4febc,0xfef5fee4,0xff14ff03,0xff2eff1d,0xff48ff36,0xff5aff4e,
-0xff79ff69,0xff8aff81,0xffa0ff99,0xffb6ffad,0xffceffc6,0xffdeffd5,0xfff9ffec,0x00100000,
-0x002b001d,0x00400033,0x0057004b,0x006c0064,0x007e0074,0x008c0087,0x00990096,0x00a300a1,
-0x00b000aa,0x00b200a7,0x00af00ae,0x00b100b0,0x00aa00aa,0x00a400a7,0x00a0009e,0x00940098,
-0x00930097,0x00890094,0x0086008a,0x00840081,0x00830082,0x00860082,0x0082007e,0x008b0086,
-0x008e0091,0x00990096,0x00a3009d,0x00b200ac,0x00ba00b6,0x00ca00c3,0x00d600d5,0x00e600e0,
-0x00f400f3,0x010700fd,0x01140112,0x0127011e,0x01340132,0x0146013e,0x01530152,0x016b0161,
-0x017a016f,0x01830178,0x01880184,0x018d0188,0x01880187,0x01870184,0x017a0183,0x016a0174,
-0x015c0167,0x013e014e,0x01270139,0x010c011f,0x00ea0104,0x00c900e0,0x00aa00bf,0x008b00a0,
-0x006c0081,0x00500060,0x00350044,0x001d002e,0x00070014,0x0003000b,0xfff3fff7,0xffe4ffea,
-0xffe3ffe3,0xffdbffdd,0xffd8ffd8,0xffd4ffd5,0xffd2ffd2,0xffd2ffd3,0xffd0ffcc,0xffd5ffce,
-0xffccffd5,0xffd1ffd5,0xffcfffd4,0xffd0ffd0,0xffd8ffd1,0xffd5ffd2,0xffdbffcd,0xffd7ffd0,
-0xffd5ffcc,0xffd1ffcb,0xffc7ffca,0xffbeffc8,0xffb6ffbc,0xffacffb4,0xff9effa5,0xff8bff93,
-0xff76ff81,0xff64ff70,0xff4eff56,0xff3cff3f,0xff21ff32,0xff0cff14,0xfef9ff05,0xfee5fefb,
-0xfed0fee4,0xfec4fecf,0xfebbfec8,0xfea5feb6,0xfea6feac,0xfe99fea5,0xfe94fe9b,0xfe8dfe90,
-0xfe8afe87,0xfe8afe8a,0xfe86fe8b,0xfe86fe8a,0xfe90fe8b,0xfe95fe93,0xfe96fe8e,0xfea1fe99,
-0xfea8fea3,0xfeb7feab,0xfec5febe,0xfed3fecf,0xfee6fedf,0xfef7fef4,0xff11ff04,0xff28ff1b,
-0xff38ff26,0xff4fff3d,0xff60ff52,0xff6dff63,0xff79ff6e,0xff82ff7e,0xff8aff87,0xff8dff8d,
-0xff90ff94,0xff92ff94,0xff93ff94,0xff90ff95,0xff90ff8f,0xff95ff8c,0xff93ff91,0xff90ff91,
-0xff97ff94,0xff94ff95,0xffa6ff9e,0xffafffab,0xffb8ffb0,0xffc9ffbe,0xffd4ffc8,0xffe5ffdf,
-0xffedffeb,0x0000fff1,0x000f0009,0x00160012,0x00230023,0x002c002a,0x0036002e,0x003e0039,
-0x00460040,0x004e0043,0x004d004a,0x004e004f,0x00560057,0x005a005f,0x00660064,0x0074006e,
-0x00810078,0x008b007d,0x00990099,0x00aa009b,0x00bb00b2,0x00cb00c0,0x00dd00d5,0x00ef00e2,
-0x00fe00f3,0x010b0104,0x01160114,0x011d011b,0x01280127,0x012c012d,0x01380132,0x013a013b,
-0x013a013e,0x01440140,0x01480145,0x01480148,0x014d0145,0x01500149,0x0150014c,0x0152014a,
-0x01590154,0x01580157,0x01590154,0x015f0156,0x015c0157,0x01570159,0x01500158,0x014d0153,
-0x0149014d,0x01420145,0x0138013c,0x01350132,0x012b012b,0x011f011f,0x0119011e,0x01150118,
-0x010e010f,0x0104010b,0x00fc0104,0x00ef00fc,0x00ed00f0,0x00e700f1,0x00e200ee,0x00da00e1,
-0x00d600df,0x00d400d9,0x00d000d7,0x00cc00ce,0x00c800c9,0x00c400c6,0x00bf00c1,0x00b400ba,
-0x00b200b2,0x00a900af,0x00a700a9,0x00a000a2,0x0099009e,0x00910094,0x0087008a,0x007b007e,
-0x0075007b,0x0067006e,0x005b0066,0x00540055,0x004c0051,0x0036003e,0x00280035,0x0018001e,
-0x0002000d,0xffecfff1,0xffd4ffde,0xffbfffc7,0xffa7ffb6,0xff8dff9a,0xff7aff86,0xff65ff70,
-0xff52ff62,0xff3dff4a,0xff2eff35,0xff22ff24,0xff12ff13,0xfefdff06,0xfef0fef8,0xfee6feeb,
-0xfed7fede,0xfed3fed7,0xfec6fecc,0xfebdfec4,0xfeb7fec0,0xfeb1feb6,0xfeacfeaf,0xfeabfeac,
-0xfea5feaa,0xfea5fe9f,0xfea5fea0,0xfea9fea4,0xfea9fea7,0xfeabfea9,0xfeb8feb5,0xfebffebe,
-0xfeccfec8,0xfed9fed8,0xfee3fedf,0xfef0fee7,0xfefbfef7,0xff08fefc,0xff13ff08,0xff1dff14,
-0xff22ff1c,0xff23ff24,0xff28ff28,0xff24ff28,0xff25ff22,0xff26ff2a,0xff1fff1e,0xff1fff1e,
-0xff19ff17,0xff11ff15,0xff0dff11,0xff07ff08,0xff07ff09,0xfefdff06,0xff01feff,0xff04ff02,
-0xff04fefe,0xff08ff08,0xff11ff0f,0xff1bff1a,0xff25ff1c,0xff2fff24,0xff39ff33,0xff46ff41,
-0xff53ff51,0xff63ff5b,0xff74ff6a,0xff84ff7d,0xff90ff87,0xff96ff8e,0xff9eff9b,0xffa3ffa4,
-0xffa4ffa9,0xffabffac,0xffb2ffae,0xffbbffb2,0xffb9ffb3,0xffbfffc1,0xffc9ffc4,0xffd5ffd1,
-0xffdfffda,0xffefffe7,0x0004fff6,0x00170010,0x0033001f,0x004a003d,0x00680052,0x00820070,
-0x009f008c,0x00b900a4,0x00cd00bc,0x00e500d7,0x00f100e7,0x00fd00fb,0x01040102,0x0113010a,
-0x010b010f,0x010c0109,0x0106010d,0x01020105,0x00fe0101,0x00ec00f8,0x00e200ed,0x00e000e5,
-0x00d500e0,0x00d000d3,0x00cb00ca,0x00c500c2,0x00b900c0,0x00b500bc,0x00b900b5,0x00bc00ba,
-0x00be00b9,0x00be00be,0x00c100c2,0x00c400c1,0x00c500c2,0x00c600c7,0x00c700c6,0x00c500cd,
-0x00c900c7,0x00cb00cb,0x00cb00c8,0x00d100cc,0x00cd00ca,0x00cd00cb,0x00cd00d2,0x00cc00ce,
-0x00cb00c9,0x00c800ce,0x00c100ca,0x00bf00c8,0x00b800c3,0x00b000b9,0x00ab00ac,0x009c00a6,
-0x008a0092,0x007c0083,0x006a0076,0x00580063,0x004b0052,0x003c0041,0x0024002e,0x0012001a,
-0x00010007,0xfff2fffa,0xffe2ffe8,0xffd8ffde,0xffd2ffd5,0xffc4ffc5,0xffbbffbd,0xffb6ffb7,
-0xffafffb2,0xffaeffac,0xffb4ffae,0xffb4ffaa,0xffb3ffa6,0xffb6ffb1,0xffb2ffb4,0xffb6ffb2,
-0xffb8ffb9,0xffbbffbd,0xffc2ffc3,0xffc5ffc3,0xffcdffc9,0xffccffcc,0xffd2ffce,0xffcdffd2,
-0xffccffcf,0xffc7ffcb,0xffbeffc8,0xffb8ffc0,0xffb3ffb7,0xffafffad,0xffa1ffa6,0xff91ff9c,
-0xff84ff90,0xff77ff7e,0xff6fff71,0xff62ff67,0xff5cff5a,0xff50ff54,0xff45ff4d,0xff41ff47,
-0xff38ff3c,0xff39ff36,0xff33ff35,0xff2bff2d,0xff2bff2e,0xff26ff2b,0xff22ff25,0xff1eff1d,
-0xff1eff20,0xff1eff1c,0xff19ff1d,0xff1dff20,0xff21ff24,0xff2cff29,0xff39ff35,0xff45ff3f,
-0xff53ff4d,0xff64ff56,0xff79ff74,0xff8cff88,0xffacff9d,0xffc3ffb5,0xffd9ffcc,0xfff9ffed,
-0x00120006,0x00300021,0x00430037,0x00580048,0x006e005c,0x007b006f,0x00850081,0x00940091,
-0x009a009b,0x00a300a8,0x00af00ac,0x00b800b5,0x00b900b6,0x00be00bc,0x00bf00bd,0x00c300c0,
-0x00c400bf,0x00c100bf,0x00be00bb,0x00b800bb,0x00af00b6,0x00a800b2,0x009f00a1,0x009a009f,
-0x00890096,0x00870089,0x007a0081,0x00700074,0x00630068,0x005d0064,0x00550058,0x004f0056,
-0x00520051,0x00480052,0x0048004c,0x0047004e,0x004b004d,0x00550050,0x005c0057,0x005b005a,
-0x005c005f,0x0061005a,0x00600061,0x00630063,0x0063005e,0x005f0060,0x00570059,0x00500058,
-0x004b004d,0x00420047,0x003a003a,0x00340033,0x00280029,0x00230021,0x001b001e,0x00170019,
-0x00160019,0x00150019,0x0017001b,0x0016001c,0x00130014,0x00110013,0x00110012,0x000a000b,
-0x0009000e,0x00030006,0xfffe0000,0xfff9fff7,0xfff3ffef,0xffe6ffea,0xffd9ffdd,0xffc9ffd4,
-0xffbeffc8,0xffaeffb4,0xffa6ffa9,0xff9bff9f,0xff8aff8e,0xff7dff81,0xff6dff73,0xff5dff63,
-0xff50ff54,0xff40ff46,0xff30ff39,0xff29ff30,0xff20ff28,0xff18ff1d,0xff14ff17,0xff14ff1a,
-0xff17ff13,0xff1cff16,0xff1fff16,0xff26ff1a,0xff2eff2f,0xff34ff34,0xff43ff3e,0xff52ff49,
-0xff64ff56,0xff72ff6b,0xff7eff74,0xff8cff84,0xff9bff90,0xffa3ff9d,0xffaeffa8,0xffbfffb4,
-0xffbbffb7,0xffbeffbf,0xffbdffbf,0xffbeffc5,0xffbbffbf,0xffb1ffb8,0xffa5ffa9,0xff97ff9c,
-0xff8aff91,0xff81ff8b,0xff6fff73,0xff66ff65,0xff5dff62,0xff55ff55,0xff54ff53,0xff4fff51,
-0xff51ff54,0xff53ff55,0xff5bff56,0xff63ff5d,0xff6bff65,0xff82ff74,0xff85ff83,0xff96ff8d,
-0xffa1ff9b,0xffb1ffab,0xffbeffb2,0xffc8ffc2,0xffcfffd0,0xffd8ffd8,0xffe1ffdc,0xffe8ffe8,
-0xfff4ffed,0xfffefff4,0x00030006,0x0012000d,0x001d001f,0x00250026,0x0036002e,0x0043003b,
-0x00470049,0x005b0053,0x00640061,0x006f006d,0x0080007d,0x00890087,0x0099008f,0x00ac00a1,
-0x00ba00ac,0x00c600ba,0x00cf00c7,0x00dd00d8,0x00e300e0,0x00f000ef,0x00f700f5,0x00fe00fd,
-0x00fe00ff,0x01020100,0x01030102,0x00fc00fe,0x00f900f7,0x00ed00f0,0x00df00e2,0x00d500d8,
-0x00c700cd,0x00bc00c8,0x00b500b7,0x00aa00b4,0x00a400ac,0x00a800a7,0x00a300a4,0x00a300a2,
-0x00a100a1,0x009d009b,0x00a2009a,0x00a000a3,0x00a600a3,0x00a400a6,0x00a700a2,0x00ab00a5,
-0x00a800a7,0x00a700a5,0x00aa00a8,0x00a600a8,0x00a900a5,0x00a300a5,0x00ad00ab,0x00ae00ab,
-0x00a500a8,0x00aa00a8,0x00ad00ab,0x00ae00ae,0x00ac00af,0x00ad00b2,0x00b200b2,0x00b600b3,
-0x00af00b1,0x00ac00a7,0x00a300a4,0x009c00a4,0x0092009a,0x0088008d,0x007a0083,0x006c0073,
-0x005b0067,0x00430053,0x002f003f,0x001b002d,0x000a0015,0xfffa0003,0xffe8ffec,0xffd6ffd6,
-0xffc9ffce,0xffb8ffc3,0xffa9ffb1,0xff9fffa5,0xff95ff99,0xff8cff90,0xff83ff86,0xff7eff7f,
-0xff75ff7a,0xff77ff79,0xff6dff77,0xff72ff74,0xff6cff6d,0xff6fff6d,0xff6eff6e,0xff6eff6c,
-0xff75ff6f,0xff7cff74,0xff7dff7a,0xff7eff80,0xff91ff8d,0xff99ff96,0xffabffa6,0xffb4ffb1,
-0xffc7ffbe,0xffd6ffce,0xffe0ffdc,0xfff4ffed,0x0001fff5,0x00120000,0x00190010,0x001c0018,
-0x001f001f,0x00210020,0x001d0023,0x001b0021,0x00160015,0x0012000e,0x0005000a,0xfff2fff9,
-0xffebffed,0xffd7ffde,0xffcbffd1,0xffb9ffc0,0xffa6ffb6,0xff95ffa0,0xff86ff8f,0xff79ff7f,
-0xff69ff6c,0xff5dff62,0xff53ff58,0xff4cff52,0xff48ff4a,0xff4bff49,0xff51ff4b,0xff5dff58,
-0xff66ff65,0xff77ff70,0xff8aff85,0xffa4ff9b,0xffbeffb4,0xffd7ffcc,0xfff1ffea,0x0006ffff,
-0x001c0014,0x00290024,0x00400031,0x00490043,0x004e0049,0x004d004f,0x0047004e,0x00470043,
-0x0040003f,0x00360038,0x0027002e,0x0015001e,0x0008000e,0xfff4fffe,0xffe9ffee,0xffd1ffdb,
-0xffbbffc4,0xffa5ffb1,0xff95ffa4,0xff85ff93,0xff77ff7d,0xff6bff71,0xff58ff5f,0xff54ff52,
-0xff48ff49,0xff40ff45,0xff3aff44,0xff3bff3b,0xff3bff36,0xff42ff3d,0xff4aff45,0xff51ff4a,
-0xff58ff54,0xff5fff5d,0xff69ff6b,0xff7cff75,0xff87ff80,0xff94ff8a,0xffa3ff98,0xffadffaa,
-0xffb9ffb4,0xffbcffc1,0xffbfffc5,0xffccffcc,0xffceffc9,0xffd0ffcc,0xffd2ffce,0xffd2ffd4,
-0xffd6ffd2,0xffd9ffd7,0xffddffd5,0xffddffde,0xffdfffe1,0xffe0ffe1,0xffe4ffe0,0xffe2ffe1,
-0xffe1ffe7,0xffe4ffe4,0xffebffe8,0xffefffe8,0xffefffe9,0xffeefff1,0xffebffee,0xffeeffe8,
-0xffe9ffec,0xffe1ffe5,0xffdbffdb,0xffd4ffda,0xffceffd1,0xffc0ffc9,0xffbcffbf,0xffb2ffb9,
-0xffa5ffad,0xffa3ffa5,0xff99ffa0,0xff93ff93,0xff86ff8b,0xff82ff84,0xff7bff7a,0xff74ff72,
-0xff70ff74,0xff6fff6a,0xff6fff69,0xff6eff6f,0xff72ff70,0xff77ff73,0xff7dff7e,0xff8aff84,
-0xff95ff93,0xffa1ff99,0xffaeffac,0xffc1ffb4,0xffc9ffc9,0xffdbffcd,0xffebffe0,0xfff7ffef,
-0x0003fffb,0x0010000d,0x001b0017,0x0026001e,0x0035002f,0x00350039,0x00430040,0x00480049,
-0x0052004d,0x005a0056,0x0066005d,0x00680066,0x006d006d,0x00770072,0x007b007d,0x007d007d,
-0x00800084,0x00840087,0x007c007c,0x00790078,0x00740073,0x006d0070,0x00650066,0x005f005e,
-0x005a005b,0x005a0056,0x00580054,0x005e0056,0x00660060,0x006b0065,0x007c0075,0x008c0080,
-0x009a008e,0x00ac00a7,0x00bf00ba,0x00d500ce,0x00e900e0,0x00f600f3,0x010a0100,0x0116010e,
-0x0127011e,0x012a0125,0x012f012e,0x0131012e,0x01300133,0x0130012b,0x012b0128,0x01220127,
-0x011b011e,0x01190118,0x01170116,0x01120115,0x0115010a,0x0112010c,0x0110010e,0x01170110,
-0x01130119,0x011b0119,0x0123011d,0x01260128,0x012e012d,0x01350132,0x013e013d,0x0141013e,
-0x01400140,0x01430141,0x0141013f,0x0139013b,0x012a0130,0x01190123,0x010a0113,0x00f100fd,
-0x00d700de,0x00bc00cc,0x009d00a9,0x0082008d,0x0063006f,0x0040004f,0x00290036,0x000d0020,
-0xfff60002,0xffe7ffed,0xffd8ffdd,0xffc8ffcc,0xffbfffc6,0xffb3ffbc,0xffb2ffaf,0xffb6ffb7,
-0xffb6ffb2,0xffc1ffbd,0xffcaffc6,0xffceffcb,0xffd9ffd4,0xffe4ffde,0xfff3ffeb,0xfff9fff7,
-0x0005fffe,0x00120012,0x001b001a,0x0022001f,0x00210021,0x00210021,0x00200023,0x001a001b,
-0x000b0010,0x00040005,0xfff4fff6,0xffd9ffe7,0xffc8ffd4,0xffb0ffc1,0xff9fffa8,0xff8cff9b,
-0xff7aff86,0xff63ff70,0xff57ff60,0xff43ff4f,0xff34ff3b,0xff23ff2e,0xff14ff21,0xff04ff0e,
-0xfef2ff02,0xfee3feec,0xfed4fee5,0xfec1fed4,0xfeb6fec1,0xfeabfeae,0xfea7fea3,0xfe9cfe9a,
-0xfe94fe92,0xfe8cfe8e,0xfe8cfe87,0xfe8efe85,0xfe93fe8b,0xfe9afe99,0xfea7fea2,0xfeaffeaf,
-0xfebafeb3,0xfec2febb,0xfed1fec9,0xfed8fed8,0xfee3feda,0xfee7fee0,0xfee9fee8,0xfeeffee9,
-0xfef0feef,0xfeeefef2,0xfeeffef2,0xfef4fef6,0xfef5fef5,0xfef8fef6,0xfeffff01,0xff04ff01,
-0xff0dff05,0xff14ff0c,0xff1aff14,0xff24ff1a,0xff28ff21,0xff2aff26,0xff32ff28,0xff32ff2e,
-0xff30ff31,0xff33ff33,0xff2fff30,0xff2dff31,0xff2bff29,0xff2fff2e,0xff2aff2c,0xff2dff2c,
-0xff3aff33,0xff39ff38,0xff46ff43,0xff5aff4c,0xff66ff5d,0xff77ff6e,0xff88ff81,0xffa0ff97,
-0xffb4ffa9,0xffcbffbf,0xffddffd8,0xffefffe9,0x0004ffff,0x000d0006,0x00170019,0x00260024,
-0x002c002e,0x00390037,0x003f003a,0x0040003f,0x00430044,0x00400042,0x00490049,0x004d0047,
-0x00490049,0x004d0051,0x0050004e,0x005a0054,0x005e0053,0x00610056,0x00680068,0x006f006b,
-0x0074006d,0x007b0078,0x0081007a,0x00880085,0x008c008a,0x00920093,0x00980097,0x009e009b,
-0x009f009d,0x009c009f,0x009f009f,0x00a2009c,0x00a500a0,0x009f009d,0x00a0009e,0x009d009e,
-0x009b009e,0x00930099,0x008c0094,0x0089008b,0x007e008c,0x007d0080,0x007a007f,0x0077007b,
-0x007a007c,0x007a007c,0x007c007e,0x0084007f,0x008a0084,0x008a0083,0x00920085,0x00910091,
-0x00a2009d,0x00a800a3,0x00ac00ab,0x00b700b7,0x00bc00bd,0x00bf00bc,0x00ba00bd,0x00c500c5,
-0x00bd00c1,0x00be00c1,0x00c000be,0x00bc00b5,0x00b400af,0x00af00b0,0x00ab00a9,0x00ab00a9,
-0x00ae00a8,0x00ae00a8,0x00ad00ae,0x00aa00b5,0x00b500b1,0x00bd00b9,0x00c500c3,0x00d400c8,
-0x00d400d1,0x00dc00d1,0x00dc00db,0x00dc00df,0x00da00dc,0x00d200d9,0x00cf00d5,0x00cb00d1,
-0x00bb00c5,0x00af00b8,0x00a700ab,0x0090009b,0x00820086,0x00720073,0x005b0064,0x0048004e,
-0x00380044,0x00280034,0x00260028,0x001f0023,0x0015001c,0x0018001c,0x001e001d,0x0027001f,
-0x0034002d,0x003c003a,0x00480041,0x005c004c,0x00610059,0x006a0062,0x0073006d,0x007a0075,
-0x0076007a,0x00740072,0x006d006f,0x00670067,0x0055005c,0x0044004c,0x002f003b,0x00190026,
-0x000d0011,0xfffbfffe,0xffdfffe9,0xffcdffd3,0xffbaffc0,0xffa9ffb3,0xff99ffa5,0xff8bff90,
-0xff81ff86,0xff79ff7e,0xff6fff77,0xff69ff70,0xff62ff6d,0xff5dff65,0xff5cff60,0xff59ff5c,
-0xff5bff61,0xff5aff5e,0xff56ff58,0xff57ff5d,0xff59ff5a,0xff5aff59,0xff5dff5c,0xff5cff5f,
-0xff60ff5e,0xff5fff5d,0xff60ff59,0xff62ff59,0xff5dff5e,0xff5eff5f,0xff5dff63,0xff62ff61,
-0xff67ff6a,0xff73ff6f,0xff75ff76,0xff80ff7d,0xff8aff89,0xff96ff92,0xffa5ffa0,0xffb1ffaf,
-0xffc0ffbb,0xffd2ffcd,0xffdeffda,0xffefffeb,0x0000fff7,0x0012000a,0x00190015,0x0022001e,
-0x002e0027,0x0030002b,0x00320031,0x00360032,0x00320033,0x002f0032,0x0029002d,0x001f0028,
-0x00170022,0x000a0012,0xffff0004,0xffeefff2,0xffe0ffe4,0xffceffd7,0xffc3ffc4,0xffadffb6,
-0xffa4ffab,0xff97ff9e,0xff8bff8d,0xff86ff89,0xff7cff83,0xff7eff7f,0xff7eff7e,0xff88ff86,
-0xff89ff85,0xff91ff8c,0xff9fff96,0xffadffa4,0xffbcffaf,0xffc6ffc2,0xffd6ffd3,0xffe4ffde,
-0xffeefff0,0x0002fff9,0x000a0003,0x000f0009,0x001f0017,0x00230022,0x001f0020,0x001f001e,
-0x001c0020,0x00100017,0x0002000c,0xfff1fffa,0xffd8ffe3,0xffc3ffcb,0xffa8ffb6,0xff8aff98,
-0xff6cff7d,0xff4fff5f,0xff34ff43,0xff1dff2a,0xff08ff11,0xfef9feff,0xfeedfeee,0xfee7feeb,
-0xfee0fee3,0xfee7fee4,0xfef0feea,0xfefcfef4,0xff0fff02,0xff24ff18,0xff3cff2d,0xff4eff41,
-0xff67ff5c,0xff76ff73,0xff89ff82,0xff99ff94,0xffaaff9e,0xffb9ffb5,0xffc0ffc3,0xffcaffc7,
-0xffd2ffc9,0xffdbffcd,0xffd3ffd1,0xffd3ffd8,0xffd3ffd7,0xffd5ffd6,0xffd5ffda,0xffd8ffda,
-0xffdbffdd,0xffdbffdb,0xffdcffdc,0xffdfffdc,0xffe8ffdf,0xffe2ffe7,0xffefffef,0xfff4fff3,
-0x0001fff8,0x000a0004,0x0010000e,0x00180014,0x0025001f,0x00290022,0x0033002a,0x00350031,
-0x00390037,0x003f003e,0x00380040,0x00370040,0x0038003d,0x00330036,0x002b002f,0x00220026,
-0x001a0018,0x000a000f,0x00030003,0xfff6fffa,0xffebfff0,0xffe5ffe9,0xffd7ffe2,0xffcfffd8,
-0xffceffd4,0xffcdffce,0xffceffcc,0xffd6ffd2,0xffd9ffd6,0xffebffdc,0xfff3ffe8,0xfffffff7,
-0x001a0007,0x002a001a,0x003d0034,0x00590049,0x00720060,0x008d007d,0x00a30096,0x00bb00b2,
-0x00cf00cb,0x00e300da,0x00f300ee,0x010300fe,0x010a010c,0x0114010f,0x011c0116,0x011e0119,
-0x011d0119,0x01190119,0x01120114,0x010d0113,0x010b010c,0x01040106,0x01010100,0x00fa00f8,
-0x00f200f0,0x00ec00ee,0x00e300e7,0x00e400e3,0x00e400df,0x00df00dd,0x00df00d8,0x00db00df,
-0x00db00d7,0x00da00db,0x00dd00db,0x00dc00e0,0x00dc00de,0x00dd00e1,0x00e600e4,0x00e500ec,
-0x00ec00e4,0x00ee00ea,0x00f100f0,0x00f600f4,0x00f800fb,0x01010100,0x01020104,0x01080105,
-0x010d0107,0x010f010d,0x010e010e,0x010b010a,0x01040109,0x01080106,0x00fd0103,0x00fb00fc,
-0x00f200fb,0x00e500ed,0x00d900e3,0x00d300d8,0x00c600cd,0x00b900b9,0x00b100b1,0x00a000a3,
-0x00960096,0x00880093,0x00760080,0x006e006e,0x005f0064,0x004c0053,0x0039003c,0x0024002c,
-0x000b0018,0xfff50005,0xffdcffeb,0xffc5ffd8,0xffaeffbf,0xff98ffa6,0xff85ff91,0xff71ff78,
-0xff5bff5e,0xff46ff4b,0xff36ff3f,0xff24ff27,0xff1bff1b,0xff0bff13,0xff03ff02,0xff01ff01,
-0xfef5fef9,0xfef9feef,0xfef0feef,0xfef0feeb,0xfeeffef0,0xfeeefef0,0xfef0fef3,0xfef8fef7,
-0xff01ff00,0xff0aff04,0xff19ff0c,0xff21ff1c,0xff28ff24,0xff37ff2f,0xff46ff3e,0xff54ff4c,
-0xff61ff56,0xff6cff6a,0xff75ff71,0xff80ff7d,0xff88ff87,0xff86ff8a,0xff89ff8b,0xff86ff8c,
-0xff7fff83,0xff78ff7e,0xff6bff72,0xff65ff6a,0xff4eff5f,0xff41ff4b,0xff2fff37,0xff21ff28,
-0xff10ff17,0xfefdff04,0xfef1fef7,0xfee1feeb,0xfedbfedb,0xfed1fecd,0xfec6fecd,0xfec2fec9,
-0xfebafec1,0xfebefebe,0xfec0febf,0xfec4fec1,0xfecdfec5,0xfed6fecd,0xfedffedd,0xfef1fee6,
-0xfefefef6,0xff0cff0b,0xff22ff14,0xff31ff26,0xff44ff39,0xff5aff49,0xff64ff5d,0xff76ff6e,
-0xff89ff84,0xff97ff92,0xffa5ff9b,0xffafffaf,0xffb3ffb7,0xffb6ffb7,0xffb6ffb6,0xffb9ffb4,
-0xffb4ffb7,0xffafffaf,0xffa2ffa8,0xffa2ffa3,0xff9eff9b,0xff9aff91,0xff96ff92,0xff8eff92,
-0xff88ff8d,0xff8dff8a,0xff8eff8f,0xff97ff95,0xffa5ff9f,0xffabffa1,0xffb2ffac,0xffb9ffb5,
-0xffc8ffc9,0xffd6ffd0,0xffdfffdc,0xffe4ffe2,0xffedffe5,0xffe9ffea,0xfff3ffee,0xfff2ffec,
-0xfff0fff0,0xfff2fff5,0xffeefff0,0xffeffff2,0xfff1ffef,0xfff3ffef,0xfffffff6,0x0002fffc,
-0x00100009,0x00190015,0x00280025,0x003c0030,0x004a0043,0x00600055,0x0074006b,0x0081007d,
-0x009b0090,0x00aa009d,0x00bc00b2,0x00ce00c6,0x00d800d8,0x00eb00e4,0x00f600ee,0x010300f8,
-0x01070102,0x010f010a,0x01110111,0x0116010f,0x01150113,0x010c0113,0x010d010d,0x0101010e,
-0x00f80105,0x00f100f5,0x00e200ea,0x00dd00da,0x00cd00d3,0x00c100c2,0x00b300b7,0x00a900af,
-0x009c00a3,0x00930097,0x00910093,0x008a008e,0x008c008b,0x008c0088,0x00890087,0x008c0087,
-0x0094008f,0x009d0093,0x00a1009e,0x00a800a6,0x00ab00ad,0x00b200b4,0x00b600b7,0x00be00ba,
-0x00b900c2,0x00bc00bb,0x00b700b6,0x00b100b3,0x00ab00a8,0x00a200a5,0x009b009a,0x0090008e,
-0x007c0081,0x00740078,0x006a006a,0x00600066,0x005c005f,0x00580059,0x004f0057,0x00520052,
-0x00530055,0x00520053,0x00580058,0x005b005a,0x0060005f,0x00620060,0x00670067,0x0068006a,
-0x006e0066,0x006b006c,0x00670064,0x00660063,0x005f0060,0x00560059,0x004e0053,0x0046004c,
-0x002f0038,0x002b002f,0x001c0021,0x00100012,0x00030009,0xfff6fffe,0xffe4fff2,0xffdaffe1,
-0xffd4ffd8,0xffcfffcd,0xffc4ffca,0xffbeffc7,0xffc1ffc2,0xffc1ffc2,0xffc3ffc4,0xffc1ffbf,
-0xffc6ffbd,0xffc8ffc2,0xffd0ffc8,0xffddffd4,0xffe5ffdb,0xffebffe1,0xfff2ffea,0xfffffff9,
-0x00070003,0x000f000e,0x00170016,0x001f0020,0x002b002a,0x0036002f,0x003e0036,0x00450041,
-0x004a0045,0x004a004f,0x004b0049,0x004b004b,0x00430047,0x003c003f,0x00300039,0x0025002a,
-0x0018001b,0x0009000c,0xfff80001,0xffe4ffef,0xffc8ffd7,0xffb0ffc1,0xff9effab,0xff87ff97,
-0xff74ff7e,0xff5cff6e,0xff52ff5a,0xff41ff4a,0xff30ff3b,0xff2aff2e,0xff1fff1b,0xff1dff18,
-0xff1cff17,0xff1cff1b,0xff23ff1d,0xff26ff25,0xff34ff30,0xff47ff43,0xff54ff51,0xff6dff62,
-0xff82ff75,0xff9dff8e,0xffb0ffa1,0xffbdffb4,0xffd3ffc5,0xffdeffd2,0xffe4ffde,0xffedffec,
-0xffeffff1,0xfff3fff2,0xffedffef,0xffe8ffef,0xffe6ffea,0xffd9ffe0,0xffd9ffd5,0xffcaffd0,
-0xffcdffc5,0xffbfffc8,0xffc1ffc3,0xffc4ffc6,0xffbeffc3,0xffc4ffc5,0xffceffc9,0xffd7ffce,
-0xffdfffd9,0xffe3ffe4,0xfff0ffed,0xfffcfff5,0x0002fffe,0x0007000b,0x00050008,0x0006000b,
-0x00080008,0x00050003,0xfff9fff9,0xffebffed,0xffdfffe3,0xffd1ffd7,0xffc0ffcb,0xffafffc1,
-0xff9dffa8,0xff91ff97,0xff83ff8b,0xff78ff7c,0xff6cff6d,0xff60ff65,0xff61ff5f,0xff60ff60,
-0xff57ff56,0xff5dff5b,0xff5fff5e,0xff67ff5e,0xff6bff63,0xff71ff6f,0xff77ff78,0xff7fff84,
-0xff89ff87,0xff91ff90,0xff9fff9b,0xffa3ff9c,0xffa3ffa0,0xffa6ffa4,0xffa7ffa3,0xffa8ffa4,
-0xffacffa5,0xffa8ffa0,0xffa4ffa0,0xffa0ff9c,0xff9bff96,0xff97ff90,0xff8aff90,0xff85ff87,
-0xff80ff7f,0xff75ff74,0xff69ff71,0xff5fff65,0xff54ff5a,0xff45ff4d,0xff3cff43,0xff34ff39,
-0xff2cff33,0xff27ff2b,0xff27ff28,0xff2dff29,0xff31ff2c,0xff3dff33,0xff45ff40,0xff57ff4d,
-0xff6bff60,0xff7eff75,0xff9aff90,0xffb7ffa5,0xffd4ffc3,0xffefffdf,0x000cfffe,0x0024001b,
-0x003b0034,0x00550049,0x0064005b,0x00750068,0x0089007b,0x008f0089,0x00900093,0x00940099,
-0x009f009e,0x00a400a2,0x00a900a5,0x00ab00a5,0x00aa00ac,0x00af00ac,0x00ac00b1,0x00ad00b3,
-0x00ae00af,0x00b300b4,0x00ae00ae,0x00b300b5,0x00b800bb,0x00b900b8,0x00ba00b6,0x00be00bd,
-0x00c900c3,0x00c500ca,0x00c700c3,0x00c800c9,0x00d000ca,0x00ca00cb,0x00c800ca,0x00c400c4,
-0x00c100c4,0x00bb00be,0x00bf00bd,0x00b500b5,0x00b300b7,0x00ac00ae,0x00a300a9,0x009e00a1,
-0x00960099,0x008b008c,0x008b008e,0x008a0089,0x00880084,0x00880085,0x00850088,0x008a0088,
-0x0089008d,0x00980090,0x00a000a0,0x00ad00a2,0x00bc00b0,0x00c600bf,0x00d400d0,0x00e200e0,
-0x00f400f1,0x010300fe,0x0113010c,0x011a010e,0x011c011e,0x011f011f,0x011e0120,0x011c011a,
-0x011a011c,0x010e0112,0x01010106,0x00ee00f9,0x00d500e6,0x00c900d3,0x00b300c2,0x00a800af,
-0x009d009e,0x008b008d,0x007a007f,0x006e0073,0x00610067,0x005a0062,0x004f0055,0x004b0051,
-0x0047004d,0x00400040,0x0040003d,0x003e003e,0x003a003d,0x003d003c,0x003e0042,0x00440047,
-0x00430043,0x004c0049,0x00490046,0x0056004a,0x00500051,0x00570055,0x00510055,0x00530053,
-0x0050004f,0x004e0054,0x00410044,0x003a003e,0x002f0036,0x001c002d,0x0014001f,0x0002000d,
-0xffeafff2,0xffdaffe3,0xffc7ffd0,0xffb3ffbe,0xffa3ffa5,0xff95ff98,0xff7eff83,0xff6eff76,
-0xff64ff69,0xff5dff63,0xff50ff57,0xff46ff51,0xff3eff41,0xff3aff3f,0xff30ff37,0xff30ff32,
-0xff2cff29,0xff24ff25,0xff20ff20,0xff1cff18,0xff0dff16,0xff0cff0d,0xff05ff09,0xff04ff07,
-0xff05ff0c,0xff07ff08,0xff0cff0b,0xff10ff0d,0xff1aff13,0xff1fff1a,0xff22ff21,0xff28ff21,
-0xff2bff29,0xff2fff2a,0xff32ff30,0xff35ff38,0xff33ff37,0xff2eff32,0xff2dff2f,0xff2aff2e,
-0xff1fff24,0xff1aff1f,0xff17ff1b,0xff12ff14,0xff0fff0f,0xff07ff0d,0xff05ff08,0xff04ff0a,
-0xff06ff0d,0xff0aff09,0xff13ff12,0xff16ff18,0xff20ff1a,0xff22ff21,0xff28ff21,0xff2aff29,
-0xff2dff2a,0xff29ff28,0xff25ff26,0xff22ff20,0xff17ff1a,0xff0eff0e,0xff03ff06,0xfefcfefa,
-0xfeeffef7,0xfee2feeb,0xfedefee2,0xfedbfee5,0xfee1fee2,0xfee7fede,0xfeeffeed,0xff04fefa,
-0xff1aff0e,0xff2cff22,0xff4fff3e,0xff68ff55,0xff86ff79,0xffa5ff94,0xffc5ffb9,0xffe2ffd3,
-0xfffcffed,0x0015000b,0x0027001d,0x003d0031,0x004f0046,0x005a0054,0x00640061,0x006c0066,
-0x006d006a,0x0070006f,0x006f006e,0x006b006d,0x00690066,0x00650064,0x005c0060,0x0059005e,
-0x00530058,0x00520056,0x004d0050,0x00490047,0x004e0048,0x004b004b,0x004a004d,0x004f004e,
-0x00560053,0x0058005b,0x0065005e,0x006b0068,0x00730070,0x0082007a,0x008e0086,0x0098008f,
-0x00a20098,0x00a6009d,0x00ae00ab,0x00b800b6,0x00c000c3,0x00c800cc,0x00d200ca,0x00d200cc,
-0x00d600cf,0x00d900d5,0x00d100d0,0x00d000d2,0x00cc00d0,0x00bf00ce,0x00b900c5,0x00b100b7,
-0x00a500ad,0x009600a2,0x0086008f,0x0078007f,0x0070006f,0x00610067,0x0058005f,0x00500053,
-0x004f004e,0x004a004b,0x004a004a,0x00410049,0x00470046,0x004d004c,0x00570054,0x0061005d,
-0x006f0067,0x0070006a,0x00790074,0x007d007b,0x0087007f,0x00880080,0x008c0080,0x0087007f,
-0x00860082,0x007b0083,0x0079007f,0x00740075,0x006e0070,0x006d006b,0x00680067,0x00620065,
-0x00640062,0x005f0063,0x005e005c,0x005e0062,0x00620066,0x006b006b,0x006a0069,0x006f006a,
-0x007a0070,0x0080007a,0x00820081,0x0085007d,0x00880082,0x008d0089,0x008e008d,0x008e0090,
-0x008f008e,0x008c008e,0x00860091,0x00800086,0x007a007e,0x0076007a,0x0066006e,0x005e0066,
-0x0058005b,0x004e004f,0x00430048,0x003e003e,0x0035003b,0x00300033,0x002f0028,0x00260021,
-0x00230026,0x001b001e,0x0012001d,0x000c0013,0x000d0012,0x0005000e,0x00050008,0xfffaffff,
-0xfffbfffa,0xfff4fff8,0xffedffed,0xffe6ffe8,0xffd9ffdf,0xffd3ffd4,0xffc9ffce,0xffbfffc2,
-0xffbaffbf,0xffb4ffb7,0xffaaffad,0xff9fffaa,0xff9effa4,0xff9fffa1,0xff9cff9c,0xff99ff9a,
-0xff9eff9b,0xff9aff99,0xff9cff98,0xff9fff9b,0xff99ff94,0xffa8ffa1,0xffa9ffa9,0xffaeffac,
-0xffbdffb6,0xffc6ffc1,0xffd2ffcf,0xffe1ffde,0xfff0ffe1,0xfffdfff5,0x00050002,0x0014000e,
-0x0020001b,0x00250021,0x002c0028,0x002d002d,0x002e002f,0x00290032,0x00210027,0x001a0021,
-0x0013001f,0x000e0015,0x0002000a,0xfffcfffc,0xfff2fff9,0xffeffff2,0xffeaffea,0xffe6ffea,
-0xffdfffe6,0xffe2ffe4,0xffdfffe5,0xffe4ffde,0xffddffdf,0xffdbffd5,0xffdaffda,0xffd5ffd5,
-0xffccffcd,0xffc5ffc9,0xffb7ffc0,0xffaaffb6,0xff9bffa7,0xff94ff9c,0xff7dff8a,0xff77ff7d,
-0xff67ff70,0xff5dff68,0xff58ff58,0xff53ff58,0xff54ff51,0xff57ff50,0xff57ff58,0xff5bff59,
-0xff63ff5f,0xff65ff68,0xff70ff6d,0xff79ff72,0xff7cff7a,0xff80ff7c,0xff85ff81,0xff82ff7d,
-0xff7cff7b,0xff77ff7a,0xff75ff79,0xff6cff6d,0xff65ff6a,0xff5eff60,0xff5aff5a,0xff5bff5b,
-0xff54ff55,0xff53ff4f,0xff4fff4d,0xff4eff50,0xff44ff4b,0xff4eff4c,0xff52ff50,0xff54ff53,
-0xff5bff57,0xff64ff5e,0xff60ff5f,0xff6eff67,0xff71ff71,0xff76ff73,0xff82ff83,0xff88ff89,
-0xff91ff8f,0xffa1ff9c,0xffa7ffa5,0xffb1ffaf,0xffbdffb8,0xffbfffc2,0xffcaffc5,0xffd1ffd1,
-0xffd8ffda,0xffdaffd9,0xffdbffda,0xffd7ffda,0xffd9ffdc,0xffd5ffdb,0xffd8ffd8,0xffdeffd8,
-0xffe4ffdc,0xffe1ffda,0xffe3ffd9,0xffe4ffdb,0xffe7ffdf,0xffefffe7,0xfff0fff3,0xfff9fff8,
-0xfffbfffc,0x00070000,0x00080008,0x000b0008,0x000e0009,0x0011000f,0x000c000e,0x000b000c,
-0x0001000b,0xfffe0004,0xfffcffff,0xfffcfff9,0xffeeffee,0xffedffed,0xffe3ffe8,0xffdfffe4,
-0xffdfffdf,0xffd8ffd8,0xffd5ffd5,0xffd5ffd3,0xffd5ffd8,0xffd4ffd7,0xffd3ffd0,0xffd3ffd0,
-0xffd1ffd1,0xffcfffd4,0xffceffc9,0xffd1ffcc,0xffd9ffd3,0xffe6ffde,0xfff1ffed,0x00050004,
-0x00150010,0x00340022,0x004d003f,0x00650057,0x007d0074,0x009c008c,0x00b200a5,0x00d200c1,
-0x00e800d4,0x00f500ea,0x010800fd,0x0113010c,0x01170114,0x011c011d,0x0121011f,0x011e0122,
-0x0121011e,0x011c011d,0x01140113,0x010a010c,0x01010102,0x00f500fe,0x00ee00f3,0x00e100ee,
-0x00dd00e2,0x00dd00e0,0x00d700d3,0x00d000d0,0x00d500cf,0x00d200d5,0x00ce00d4,0x00d000d0,
-0x00d400d2,0x00d900d3,0x00d800d2,0x00d300d0,0x00d400cc,0x00ce00c9,0x00ca00c7,0x00c300c4,
-0x00c400c5,0x00be00bc,0x00b100b6,0x00a700b0,0x00a200a7,0x009900a1,0x0095009e,0x008e0090,
-0x008f008e,0x0086008b,0x00810083,0x007b007f,0x00790080,0x007e0081,0x00810080,0x00850082,
-0x00890088,0x008f0088,0x009c008f,0x009d0096,0x00ab00a0,0x00b000a5,0x00b600ad,0x00bc00b8,
-0x00c200c1,0x00c300c4,0x00c600c7,0x00c900c9,0x00c300c9,0x00bc00c3,0x00b700c4,0x00b000b4,
-0x00a100ac,0x0091009a,0x007f0088,0x006a0075,0x0050005e,0x00350042,0x001e002f,0x000e0015,
-0xffeffffd,0xffd8ffe4,0xffc1ffcf,0xffb1ffba,0xffa2ffa6,0xff91ff97,0xff85ff8e,0xff7aff80,
-0xff74ff79,0xff70ff74,0xff6eff68,0xff6cff6e,0xff70ff6e,0xff6eff6b,0xff6aff68,0xff6eff6b,
-0xff6cff6d,0xff73ff73,0xff6eff74,0xff74ff74,0xff71ff76,0xff75ff7a,0xff75ff75,0xff71ff74,
-0xff6dff70,0xff65ff6b,0xff5cff5d,0xff52ff58,0xff4eff4e,0xff3fff45,0xff32ff39,0xff27ff2e,
-0xff17ff1d,0xff07ff0b,0xfefbff01,0xfee9fef2,0xfedcfee4,0xfecffed8,0xfebffec9,0xfebdfec1,
-0xfeb7febd,0xfeb8feba,0xfeb7feba,0xfeb7feb6,0xfebcfebd,0xfec5fec2,0xfec7fec8,0xfeccfec9,
-0xfed6fecf,0xfedcfed9,0xfee4fee3,0xfee4fee7,0xfeeefee7,0xfef3feef,0xfef8fef4,0xfefffefa,
-0xff08ff01,0xff0eff05,0xff1aff12,0xff26ff1e,0xff33ff30,0xff42ff3a,0xff51ff47,0xff61ff59,
-0xff71ff66,0xff80ff74,0xff8fff81,0xff9aff92,0xffa7ff9d,0xffafffaa,0xffb9ffb5,0xffc2ffbc,
-0xffc6ffc1,0xffc7ffc8,0xffc6ffc8,0xffc9ffca,0xffc9ffcc,0xffccffcc,0xffccffcf,0xffceffd2,
-0xffceffce,0xffd1ffce,0xffd2ffd0,0xffd3ffd7,0xffd5ffd6,0xffdbffe0,0xffd8ffdb,0xffd9ffd8,
-0xffd6ffdd,0xffd7ffdd,0xffd6ffdc,0xffdcffd6,0xffd5ffd6,0xffd4ffd3,0xffd5ffd5,0xffceffd0,
-0xffcaffca,0xffceffc9,0xffccffc8,0xffc7ffc7,0xffc3ffc6,0xffc3ffc3,0xffc2ffc8,0xffc7ffca,
-0xffd1ffce,0xffd4ffd6,0xffd6ffdb,0xffe8ffe6,0xfffafff4,0x0007fffd,0x00150013,0x00270020,
-0x003d0035,0x00570048,0x0067005e,0x007b0076,0x00910086,0x00a7009b,0x00bb00ad,0x00ca00c4,
-0x00d700cd,0x00e300dd,0x00f200ed,0x00fa00f4,0x00f700f7,0x00fe00f9,0x010200fd,0x00fb00fe,
-0x00f600fb,0x00f000f8,0x00ea00f0,0x00e700e2,0x00da00db,0x00c700cb,0x00ba00be,0x00ae00b8,
-0x00a800a9,0x009e00a3,0x00960098,0x008f008f,0x0084008d,0x00840086,0x007d0088,0x007b007f,
-0x007f0083,0x00830080,0x0085007f,0x0084007e,0x007f0080,0x0082007b,0x007d007e,0x007b0080,
-0x007a0080,0x0080007d,0x0079007f,0x0075007c,0x0078007b,0x00760076,0x00740075,0x00750072,
-0x00750073,0x00710074,0x00770074,0x00770072,0x007e007c,0x0076007a,0x007a0075,0x00770075,
-0x00700074,0x00670071,0x005b0067,0x0053005e,0x004c004c,0x00380043,0x002b0036,0x001d0025,
-0x00100017,0x00080008,0xfff60000,0xffedffee,0xffe7ffea,0xffdcffe2,0xffd3ffe0,0xffd7ffda,
-0xffdfffdb,0xffdfffd9,0xffe4ffdf,0xffebffe6,0xfff7fff2,0xfffffff5,0x0002fff9,0x00090002,
-0x000b0008,0x0016000f,0x001b0017,0x001e0015,0x00230021,0x00300028,0x00350038,0x0041003e,
-0x004f0048,0x00580054,0x0062005d,0x006f006a,0x007f0075,0x00900083,0x0097008f,0x00a3009c,
-0x00a900ab,0x00b000b1,0x00b800b7,0x00b600bc,0x00b900b9,0x00b500b0,0x00aa00a9,0x00a100a1,
-0x008f0097,0x007d0082,0x006d007a,0x00580066,0x0043004e,0x002d0037,0x001e0025,0x000c0013,
-0xfff80001,0xffecfff1,0xffe1ffe8,0xffd6ffdb,0xffcdffd5,0xffc1ffc5,0xffbeffc3,0xffbaffb9,
-0xffb0ffb2,0xffadffac,0xffa5ffa9,0xffa2ffa7,0xff9bff9c,0xff91ff95,0xff82ff87,0xff72ff7d,
-0xff64ff71,0xff5aff61,0xff45ff52,0xff3dff44,0xff33ff39,0xff2dff2c,0xff1fff24,0xff1aff22,
-0xff1cff1b,0xff21ff1e,0xff26ff21,0xff2eff26,0xff35ff33,0xff45ff3d,0xff5bff4d,0xff6cff61,
-0xff84ff75,0xff97ff87,0xffaaff9f,0xffbeffb7,0xffd4ffca,0xffebffdf,0xfff8ffee,0x0007fffb,
-0x000c0006,0x0014000f,0x0017000f,0x00150016,0x0013000f,0x000b000e,0x0000000a,0xfff6ffff,
-0xffe9fff8,0xffe3ffe9,0xffd9ffe0,0xffccffd2,0xffc6ffc7,0xffbcffc0,0xffb2ffb5,0xffa8ffae,
-0xffa4ffa5,0xffa1ffa5,0xff9dffa1,0xff9cffa0,0xff9affa0,0xff9dffa4,0xffa2ff9d,0xff9cff9f,
-0xff9bff9c,0xff9bff9c,0xff97ff99,0xff9aff9b,0xff97ff96,0xff94ff98,0xff96ff96,0xff97ff93,
-0xff95ff90,0xff8eff91,0xff92ff94,0xff95ff92,0xff94ff94,0xff9aff94,0xffa2ff99,0xff9dff9a,
-0xff9fff9d,0xffa3ffa4,0xffa7ffa7,0xffa7ffaa,0xffa9ffae,0xffacffae,0xffacffaf,0xffacffb2,
-0xffa5ffa7,0xff9effa2,0xff98ff9f,0xff98ff95,0xff8aff8d,0xff88ff82,0xff79ff78,0xff6cff6e,
-0xff5cff67,0xff53ff5b,0xff48ff50,0xff40ff45,0xff3bff3d,0xff3aff34,0xff35ff2f,0xff30ff2b,
-0xff35ff31,0xff36ff35,0xff41ff39,0xff46ff44,0xff56ff4e,0xff63ff5e,0xff77ff6e,0xff8aff7c,
-0xff96ff8e,0xffadffa4,0xffbfffb5,0xffcaffc5,0xffdcffda,0xfff0ffe7,0x0003fffa,0x000d000a,
-0x00190017,0x002a0021,0x0036002a,0x003f0036,0x004c0041,0x004f004c,0x005f0059,0x0067005f,
-0x0072006c,0x007d0074,0x00850082,0x008b0088,0x0098008f,0x009d009a,0x009e009e,0x00a700a6,
-0x00a700a7,0x00a700a6,0x00a800aa,0x00a000a5,0x0095009d,0x008d0094,0x007c0086,0x00690079,
-0x005c0067,0x00500053,0x003c0043,0x00320032,0x00210020,0x0011001a,0x000a000f,0x000a0008,
-0x000e0006,0x000d000e,0x0019000d,0x0021001f,0x0032002c,0x0040003b,0x0050004d,0x00610059,
-0x006e006b,0x007e0073,0x008c0083,0x00950090,0x00a0009d,0x00ae00a5,0x00b000ae,0x00b700b6,
-0x00bd00ba,0x00ce00c7,0x00d800d4,0x00df00da,0x00ed00e5,0x00fb00f5,0x010b0101,0x011d0119,
-0x012f0126,0x013b0137,0x014a0144,0x015d0156,0x01680161,0x0170016b,0x017f0178,0x0188017b,
-0x01870184,0x01840182,0x017e017c,0x01700176,0x01640169,0x01540156,0x01410145,0x01250130,
-0x010d0119,0x00f000ff,0x00d200e0,0x00b600c6,0x009c00a7,0x0083008d,0x006a0075,0x00590060,
-0x0043004c,0x00330038,0x00260029,0x001d0025,0x0014001d,0x0016001f,0x0017001b,0x001a0017,
-0x00200020,0x00200021,0x00290026,0x002c002a,0x00300030,0x002c002f,0x00270030,0x002a002d,
-0x00230028,0x0019001d,0x00160019,0x000e0010,0x00050005,0xffff0000,0xfff5fffa,0xffeaffed,
-0xffdfffe6,0xffe0ffe2,0xffd5ffda,0xffd4ffd6,0xffd0ffd5,0xffcdffcf,0xffcaffd0,0xffc6ffce,
-0xffc3ffc9,0xffbfffc5,0xffbaffbe,0xffb1ffb9,0xffaaffac,0xff9dffa4,0xff94ff98,0xff81ff8a,
-0xff74ff7a,0xff66ff6a,0xff55ff5b,0xff45ff4d,0xff33ff39,0xff22ff2c,0xff11ff1b,0xff06ff09,
-0xfef6ff02,0xfeeefef6,0xfee7feed,0xfedcfee4,0xfedcfede,0xfeddfee1,0xfedffedc,0xfedffee1,
-0xfee2fee2,0xfeedfee8,0xfef8feee,0xfefbfef8,0xff09ff02,0xff11ff0b,0xff23ff1a,0xff2fff27,
-0xff33ff2d,0xff39ff38,0xff40ff3f,0xff49ff45,0xff4fff4e,0xff51ff55,0xff5aff57,0xff5eff5d,
-0xff63ff60,0xff69ff65,0xff6eff69,0xff72ff6b,0xff76ff72,0xff7aff75,0xff7bff75,0xff7cff78,
-0xff73ff74,0xff6aff6d,0xff61ff64,0xff58ff5d,0xff49ff50,0xff3aff41,0xff2bff38,0xff21ff28,
-0xff16ff1b,0xff0dff0e,0xfefdff07,0xfef8fefc,0xfef4fef7,0xfef5fef3,0xfefcfef4,0xff01fefb,
-0xff0aff07,0xff19ff15,0xff2bff22,0xff3aff33,0xff4eff48,0xff61ff57,0xff76ff6b,0xff87ff7d,
-0xff9aff8f,0xffb2ffa3,0xffc4ffbe,0xffdaffd0,0xffeaffe2,0xfffdfff2,0x000f0004,0x001d0016,
-0x002e0025,0x003d003d,0x00440044,0x00550051,0x005b0058,0x006a0059,0x006b0062,0x006b0065,
-0x00650069,0x006b0068,0x0064006d,0x00640065,0x0061006a,0x00590060,0x0052005c,0x00550058,
-0x004f0054,0x004a004b,0x004a0046,0x00480043,0x00420042,0x00430040,0x00410046,0x00430044,
-0x00490046,0x004d004c,0x0054004a,0x0055004f,0x00540050,0x0054004f,0x005b0055,0x00570058,
-0x005f005c,0x005b005b,0x005b0059,0x00540053,0x00550058,0x00540058,0x00540054,0x0051004e,
-0x00550053,0x00560054,0x00560059,0x005d005d,0x00660061,0x006d006c,0x00770070,0x0084007d,
-0x008e0084,0x009e0095,0x00a6009c,0x00b200af,0x00bc00b9,0x00c200bd,0x00c500c4,0x00c900cc,
-0x00c800cc,0x00c200c9,0x00be00c5,0x00bb00b6,0x00b200b2,0x00a300ac,0x0090009d,0x0081008b,
-0x0077007c,0x006f006c,0x00640069,0x005e005e,0x00540059,0x004e0052,0x00540050,0x00570057,
-0x005f0056,0x00630062,0x006a006a,0x00770070,0x007d007e,0x008b008a,0x00910094,0x00950095,
-0x00970098,0x009f009f,0x00980096,0x00930092,0x0086008f,0x0079007d,0x006b0071,0x005b0063,
-0x004a0055,0x00380041,0x0029002b,0x0016001c,0x000e0012,0x0005000b,0x00020005,0x00070005,
-0x00080005,0x000f0004,0x00150013,0x0026001d,0x002c0028,0x003f0035,0x004d0046,0x0054004f,
-0x005e0059,0x006d0066,0x006d006f,0x006d006d,0x006d006d,0x00670068,0x00630063,0x0052005d,
-0x003e004d,0x002d003f,0x001c0029,0x00040016,0xfff60000,0xffdfffec,0xffcdffd6,0xffbaffc0,
-0xffacffb3,0xff96ff9e,0xff8cff92,0xff89ff8c,0xff81ff86,0xff7fff7f,0xff7eff80,0xff85ff83,
-0xff89ff88,0xff94ff91,0xffa1ff98,0xffb2ffa7,0xffbfffb2,0xffceffc7,0xffe3ffdb,0xfff6ffee,
-0x0008fffe,0x001b0010,0x002f0023,0x003a0035,0x00450045,0x00510048,0x00560051,0x00590055,
-0x00580051,0x00540057,0x004d0055,0x0049004b,0x003c0041,0x00320038,0x0023002d,0x0017001c,
-0x00090012,0xfffe0003,0xfff0fff9,0xffe7ffed,0xffe1ffe4,0xffd9ffdc,0xffd6ffd6,0xffceffd2,
-0xffceffcf,0xffcfffd0,0xffd4ffd2,0xffd1ffd5,0xffd6ffd5,0xffd0ffd6,0xffcdffd9,0xffc9ffd3,
-0xffc8ffcc,0xffbfffc0,0xffb9ffb7,0xffafffb0,0xffa4ffa8,0xff9bff9b,0xff8bff8d,0xff7cff82,
-0xff6cff77,0xff5cff6a,0xff53ff5c,0xff4eff52,0xff4bff52,0xff4cff4d,0xff54ff52,0xff5aff55,
-0xff63ff5c,0xff6dff65,0xff7aff73,0xff84ff7c,0xff91ff90,0xff9dff98,0xffa8ffa4,0xffb2ffad,
-0xffbaffb7,0xffc0ffb7,0xffc7ffc1,0xffcbffc9,0xffcdffd0,0xffc9ffd0,0xffccffce,0xffcaffc7,
-0xffc4ffc8,0xffc1ffc0,0xffbdffc0,0xffb2ffb8,0xffafffb3,0xffaaffaf,0xffa9ffac,0xffa5ffaa,
-0xff9effa1,0xff9dff9e,0xff97ff97,0xff92ff95,0xff91ff95,0xff8eff8e,0xff90ff8e,0xff8cff90,
-0xff8aff88,0xff8dff89,0xff84ff85,0xff83ff82,0xff7cff80,0xff80ff81,0xff76ff7d,0xff75ff7c,
-0xff7cff7e,0xff78ff7f,0xff6fff7c,0xff74ff76,0xff71ff73,0xff77ff74,0xff70ff72,0xff73ff6f,
-0xff71ff73,0xff75ff72,0xff76ff74,0xff7bff77,0xff7cff79,0xff7eff7d,0xff84ff7e,0xff8aff86,
-0xff88ff8d,0xff91ff92,0xff98ff98,0xff96ff9a,0xffa0ff9c,0xffa2ffa0,0xffaaffa0,0xffaeffa7,
-0xffb5ffac,0xffb6ffb3,0xffb8ffb3,0xffc1ffbb,0xffbfffc0,0xffbfffc1,0xffc1ffc2,0xffc9ffcd,
-0xffd4ffd1,0xffd9ffd7,0xffdfffdd,0xffeaffe0,0xfff3fff0,0xfffcfff9,0x0005ffff,0x000f000a,
-0x0017000f,0x00190012,0x0021001b,0x00230022,0x002a0027,0x002c002d,0x002e0031,0x00350036,
-0x00360037,0x003e0041,0x00450043,0x004c004d,0x00550051,0x0063005e,0x00730068,0x007e0077,
-0x00910089,0x009f0095,0x00b100a6,0x00be00b2,0x00ce00c4,0x00de00d8,0x00ea00e6,0x00fd00f7,
-0x01050103,0x01140110,0x01160114,0x01210119,0x01250121,0x01240128,0x0126012b,0x012a012b,
-0x012b012d,0x0125012c,0x011f0127,0x01140123,0x0117011a,0x0104010e,0x01000104,0x00f100fa,
-0x00e500ec,0x00dc00dd,0x00ca00d0,0x00c600c4,0x00b900ba,0x00ac00a8,0x00a0009f,0x009a0097,
-0x00950090,0x00910091,0x008f0090,0x008c008e,0x0084008a,0x008a0087,0x0089008b,0x008b008f,
-0x008a008d,0x008e008d,0x0090008f,0x008e0090,0x00950092,0x00940094,0x00950095,0x00970095,
-0x00970094,0x00980097,0x009b0097,0x00970098,0x0096009a,0x00a4009c,0x009f009f,0x00a0009c,
-0x009b009b,0x009b009d,0x009a009d,0x0090009b,0x00880093,0x00840088,0x007f0084,0x0074007a,
-0x006f006e,0x0066006b,0x0058005e,0x00530053,0x0044004b,0x0036003e,0x002d0031,0x00210025,
-0x0016001e,0x0009000e,0xffff0005,0xfff2fff3,0xffe6ffeb,0xffdaffda,0xffcaffd3,0xffc3ffc7,
-0xffbdffc0,0xffb4ffb3,0xffadffab,0xffa5ffa6,0xff9cff9c,0xff9dff9e,0xff9bff9f,0xff9bff9d,
-0xff9cff99,0xff9eff9c,0xff9cff9c,0xffa1ff9e,0xff9cff9a,0xff9fffa1,0xffa1ffa5,0xffa2ffa9,
-0xffa2ffa4,0xffa0ffa0,0xff9effa1,0xff97ff9d,0xff92ff95,0xff86ff89,0xff7bff86,0xff77ff72,
-0xff63ff69,0xff54ff58,0xff41ff4a,0xff33ff3b,0xff27ff2f,0xff18ff22,0xff09ff10,0xfeffff00,
-0xfef5fefa,0xfeeafef2,0xfee5fee8,0xfee0fee3,0xfee2fee4,0xfedcfee1,0xfee1fee1,0xfee5fede,
-0xfee9fee4,0xfef0feec,0xfef4fef0,0xfef9fef5,0xfefffefb,0xff04feff,0xff0cff08,0xff13ff0e,
-0xff15ff13,0xff1bff1c,0xff20ff21,0xff26ff29,0xff2dff27,0xff32ff2c,0xff34ff2f,0xff3bff39,
-0xff40ff3d,0xff46ff42,0xff4eff4d,0xff54ff4e,0xff5dff56,0xff64ff66,0xff69ff6b,0xff73ff72,
-0xff7dff7b,0xff90ff81,0xff9cff90,0xffa5ff9a,0xffa9ffa1,0xffb4ffab,0xffbbffb8,0xffc5ffbf,
-0xffd2ffc7,0xffd7ffcf,0xffdeffdb,0xffe4ffe4,0xffe5ffe9,0xffe4ffec,0xffe3ffe6,0xffe3ffe6,
-0xffdbffe0,0xffd4ffd8,0xffcbffd0,0xffc2ffc7,0xffbdffba,0xffafffb6,0xffabffae,0xffa6ffa9,
-0xffa4ffa8,0xffa3ffa1,0xffa4ffa3,0xffa9ffa4,0xffb2ffb0,0xffbeffb7,0xffcdffc6,0xffd7ffd7,
-0xffe4ffe2,0xffedffea,0xfffcfff4,0x00020001,0x000f0008,0x001b0015,0x00240015,0x0027001b,
-0x002b0023,0x00330030,0x003a0038,0x00450044,0x0050004d,0x005d0057,0x006e0060,0x007f0074,
-0x008e0086,0x00a2009b,0x00ad00a3,0x00bf00b3,0x00c700c1,0x00cd00ca,0x00d600d1,0x00d600d8,
-0x00d200d6,0x00d100d5,0x00c500d0,0x00b600c2,0x00a700af,0x0094009e,0x0086008c,0x00740079,
-0x00630068,0x004e005b,0x00460050,0x00430042,0x003e0041,0x003d003e,0x0043003e,0x00470042,
-0x0054004b,0x005b0056,0x006c0062,0x007b0076,0x0085007f,0x0093008f,0x009e009a,0x00a700a2,
-0x00b000ae,0x00b100ad,0x00ad00b1,0x00aa00af,0x00a700a9,0x009e00a3,0x009c009d,0x00910096,
-0x0089008f,0x0089008b,0x00820081,0x00820083,0x007b0083,0x00810081,0x00800084,0x00870085,
-0x00880086,0x008e008e,0x00900090,0x00940095,0x00980098,0x00920096,0x0093008e,0x008c008a,
-0x008a0087,0x0079007e,0x006f006d,0x00600065,0x004d0053,0x003c0043,0x0028002d,0x0010001d,
-0x00060009,0xfff2ffff,0xffe5ffec,0xffdcffdc,0xffd3ffd3,0xffcdffce,0xffc5ffc9,0xffc7ffc3,
-0xffc7ffc7,0xffcdffc5,0xffd1ffcd,0xffceffd2,0xffd7ffd8,0xffdaffdd,0xffe3ffe3,0xffedffed,
-0xfff5fff1,0xfff9fff7,0x0003ffff,0x00070007,0x000a000f,0x00140015,0x001c001a,0x0021001d,
-0x00270023,0x0031002a,0x00360030,0x00370034,0x00390037,0x0040003b,0x0041003e,0x00440048,
-0x00470049,0x0046004b,0x00420043,0x00460047,0x00440041,0x00420040,0x0040003f,0x00370036,
-0x00320035,0x002a002f,0x0027002c,0x001c0020,0x00130013,0x0008000c,0xfffeffff,0xfff9fffa,
-0xfff3fff5,0xffebfff1,0xffe9ffe6,0xffe5ffe5,0xffe3ffe5,0xffdeffe4,0xffe1ffe9,0xffdfffe0,
-0xffe6ffe5,0xffe7ffe6,0xffe3ffe0,0xffe2ffdb,0xffe0ffde,0xffe2ffdf,0xffe2ffdc,0xffddffdb,
-0xffd9ffdb,0xffd2ffda,0xffd5ffd3,0xffcdffcf,0xffc8ffcd,0xffc7ffcb,0xffc4ffca,0xffc6ffc8,
-0xffccffc8,0xffc8ffca,0xffceffcf,0xffd9ffd1,0xffdfffd7,0xffe5ffde,0xffe9ffe5,0xfff1ffee,
-0xfff6fff3,0xfff9fff4,0x0001fffc,0x00040001,0x000a0003,0x00060006,0x00050003,0x00010000,
-0xfffd0005,0xfffafff7,0xffebffee,0xffdeffe3,0xffd4ffda,0xffc3ffc9,0xffb1ffb4,0xffa0ffa4,
-0xff93ff9a,0xff7cff89,0xff6fff7c,0xff62ff6f,0xff5aff61,0xff47ff55,0xff42ff4a,0xff43ff3f,
-0xff3eff3e,0xff39ff3e,0xff3cff3d,0xff46ff3d,0xff44ff3d,0xff49ff43,0xff4bff47,0xff53ff4c,
-0xff56ff54,0xff5aff58,0xff56ff5e,0xff5dff59,0xff5bff5f,0xff57ff56,0xff58ff58,0xff57ff54,
-0xff4cff54,0xff49ff4f,0xff4aff4c,0xff4cff48,0xff4bff4a,0xff50ff50,0xff56ff53,0xff5fff57,
-0xff6bff64,0xff78ff70,0xff87ff80,0xff95ff97,0xffa6ffa2,0xffbeffb2,0xffd1ffc7,0xffe6ffdb,
-0xfff3ffe9,0x0004fff7,0x000c000d,0x00160012,0x001a001d,0x00170016,0x00150016,0x0006000e,
-0xfffb0003,0xffecfff5,0xffdaffe2,0xffc2ffce,0xffb3ffb8,0xff9effa4,0xff8fff93,0xff7dff82,
-0xff6fff72,0xff66ff68,0xff5cff66,0xff5bff5a,0xff60ff5e,0xff63ff61,0xff6fff66,0xff7cff75,
-0xff8fff87,0xffa0ff9b,0xffb8ffab,0xffd1ffc3,0xffe5ffdb,0xfffbffee,0x00120003,0x0021001a,
-0x0033002b,0x0044003d,0x0055004a,0x005c0055,0x0066005f,0x006b0066,0x006e0067,0x006b006b,
-0x006a006d,0x00680066,0x00600060,0x0057005e,0x0051005b,0x00520053,0x004f004d,0x004b0047,
-0x0046004a,0x00440047,0x00450044,0x00430043,0x00410044,0x00470044,0x004a004b,0x004d004c,
-0x00510054,0x00540056,0x00550058,0x00560059,0x0053005c,0x0056005b,0x0055005c,0x0059005c,
-0x005d005c,0x005d005e,0x005d0061,0x00680062,0x006b0064,0x0074006c,0x0078006f,0x0083007b,
-0x008a0084,0x0091008c,0x00a4009f,0x00b500ab,0x00c900c3,0x00dc00d7,0x00f200ea,0x010400fe,
-0x0112010c,0x01260117,0x012f0125,0x013f0132,0x0142013f,0x01440142,0x01450146,0x01460144,
-0x01410144,0x0139013d,0x012f0139,0x0122012d,0x011c011a,0x01070113,0x00fd0107,0x00f300fa,
-0x00e400e9,0x00de00de,0x00d000d5,0x00c100c7,0x00ba00bd,0x00ad00b3,0x00a000a5,0x009900a0,
-0x008d0097,0x00820087,0x0078007c,0x00670070,0x005a0065,0x00500056,0x0046004c,0x0036003a,
-0x00280036,0x001e0023,0x0014001a,0x000d000f,0x000b0009,0x00020002,0x0003ffff,0x00010000,
-0x0000fffc,0x00040001,0x000a0005,0x000d000b,0x0015000c,0x001a0014,0x001d001a,0x001d001d,
-0x001f0021,0x0021001e,0x00240022,0x00210022,0x00150016,0x00120014,0x0006000e,0xfff80004,
-0xfff6fff8,0xffeaffef,0xffdcffe0,0xffd7ffda,0xffccffd3,0xffc2ffc8,0xffbcffbe,0xffb0ffb9,
-0xffa9ffaf,0xffa9ffaa,0xffa7ffa3,0xff9cffa2,0xff96ff9a,0xff93ff9c,0xff94ff91,0xff92ff91,
-0xff8bff8e,0xff84ff88,0xff82ff80,0xff7cff7d,0xff75ff74,0xff6fff73,0xff65ff6b,0xff5eff62,
-0xff54ff5c,0xff4fff56,0xff43ff4a,0xff3bff42,0xff31ff36,0xff27ff2c,0xff25ff28,0xff19ff20,
-0xff17ff19,0xff11ff0f,0xff07ff08,0xff07ff0a,0xff04ff07,0xff09ff09,0xff10ff10,0xff15ff0d,
-0xff20ff17,0xff25ff20,0xff33ff2c,0xff3bff38,0xff43ff3e,0xff50ff4a,0xff5aff56,0xff60ff5e,
-0xff61ff63,0xff6aff68,0xff62ff68,0xff5cff5f,0xff5bff5b,0xff4eff56,0xff46ff4d,0xff33ff3e,
-0xff26ff29,0xff1bff21,0xff0eff12,0xfefcff04,0xfef1fef7,0xfee8feeb,0xfee8feec,0xfee2fee5,
-0xfee0fede,0xfee1fedc,0xfeeffee6,0xfef9fef2,0xff02ff00,0xff0eff0c,0xff22ff1b,0xff33ff2d,
-0xff4cff44,0xff61ff55,0xff7eff6d,0xff92ff89,0xffa6ff9d,0xffc3ffb3,0xffdaffce,0xfff4ffe2,
-0x0005fffb,0x00180009,0x002b001c,0x003e002e,0x0047003e,0x00580052,0x0061005e,0x006a006e,
-0x00720075,0x00730076,0x007b007a,0x007e0079,0x007c007c,0x007e007a,0x007a007c,0x00790076,
-0x00730074,0x006c006e,0x00660064,0x00630069,0x005f006a,0x00610067,0x005e0069,0x005e005f,
-0x0059005f,0x005d005b,0x005c005d,0x00560059,0x00550057,0x00530050,0x00560050,0x0050004f,
-0x004d004c,0x004d0049,0x0048004b,0x00430049,0x00470047,0x0040003e,0x003e003c,0x003b003e,
-0x00330037,0x00320037,0x00300032,0x00300033,0x00320030,0x002d002e,0x002e002e,0x00320031,
-0x00360036,0x0040003b,0x004a0041,0x0054004d,0x0064005b,0x0078006e,0x0085007e,0x009d0091,
-0x00b000a6,0x00bd00b8,0x00d000c8,0x00de00d5,0x00e400df,0x00f000ee,0x00f000ed,0x00f000f4,
-0x00ee00eb,0x00dc00e1,0x00cb00d9,0x00b500c7,0x00a400af,0x008d0098,0x00780086,0x005e0069,
-0x00440057,0x0033003f,0x00200027,0x00170017,0x0010000b,0x00080001,0x00020006,0x000a0002,
-0x0009000c,0x0011000a,0x00150012,0x0023001c,0x00280022,0x002f002e,0x00380039,0x003f003d,
-0x00460040,0x00480045,0x00470046,0x00480047,0x00430043,0x00420045,0x003f003c,0x00360039,
-0x002f0036,0x002c0033,0x002a0030,0x002f002f,0x002d002b,0x002e0029,0x0030002b,0x0031002b,
-0x002d0030,0x00350031,0x003a0032,0x003e0034,0x0041003e,0x003f003f,0x00400041,0x00440040,
-0x00440047,0x00440041,0x003f0043,0x003f0041,0x003c003f,0x0038003b,0x003a0036,0x003a0037,
-0x002e0034,0x002b002d,0x00240027,0x001f0027,0x001b001e,0x0013001a,0x00140016,0x00110013,
-0x0008000a,0x00080007,0x00010000,0xfffbfff9,0xfff7fff4,0xffeeffea,0xffe8ffe6,0xffe5ffe4,
-0xffdcffdf,0xffdbffe3,0xffd9ffde,0xffd9ffdd,0xffdcffde,0xffe1ffdf,0xffe3ffe3,0xffe7ffe4,
-0xffefffed,0xfff2fff3,0xfff9fff6,0x00000000,0x00040003,0x000c0008,0x00110010,0x00120015,
-0x00100016,0x00130018,0x00160015,0x00120013,0x0010000f,0x000d000b,0x0004000b,0xfffe0004,
-0xfffefffd,0xfff3fff7,0xffe9ffee,0xffe4ffe5,0xffdaffe1,0xffd1ffd4,0xffc9ffc9,0xffc1ffc4,
-0xffbaffc1,0xffb2ffb6,0xffabffae,0xffa0ffa5,0xff9cff9e,0xff93ff98,0xff8fff8e,0xff8bff88,
-0xff8bff87,0xff8aff89,0xff8fff88,0xff8aff8b,0xff8eff88,0xff90ff8e,0xff95ff96,0xffa1ffa3,
-0xffa4ffa4,0xffadffab,0xffb6ffb4,0xffb8ffb6,0xffbfffb8,0xffc1ffc0,0xffc6ffc3,0xffc2ffca,
-0xffc0ffc5,0xffc0ffc1,0xffb6ffc2,0xffb5ffbc,0xffb0ffb5,0xffabffb1,0xffa7ffa5,0xffa2ffa0,
-0xff9dff9d,0xff99ff98,0xff96ff96,0xff92ff95,0xff90ff93,0xff91ff95,0xff92ff93,0xff8fff8d,
-0xff93ff8d,0xff94ff96,0xff97ff97,0xff9bff9b,0xff95ff99,0xff97ff9a,0xff99ff9a,0xff98ff9a,
-0xff93ff93,0xff92ff93,0xff91ff91,0xff8eff8f,0xff88ff8a,0xff86ff88,0xff87ff86,0xff7dff86,
-0xff82ff81,0xff7dff7d,0xff80ff7b,0xff80ff7e,0xff80ff83,0xff82ff80,0xff8dff8b,0xff8bff8d,
-0xff8fff8c,0xff97ff92,0xff9aff98,0xffa2ff9e,0xffa8ffa9,0xffadffab,0xffb1ffb0,0xffbbffb6,
-0xffbcffbb,0xffc2ffc1,0xffc8ffc9,0xffcbffc9,0xffcdffcc,0xffd0ffcc,0xffd0ffcc,0xffceffcd,
-0xffc9ffcb,0xffc8ffce,0xffc9ffc9,0xffc6ffc7,0xffc8ffc8,0xffcbffc6,0xffcdffcd,0xffceffd0,
-0xffd1ffd7,0xffd8ffdd,0xffe2ffdc,0xffe8ffe8,0xfff2fff0,0xfff8fff6,0xfffffff9,0x000a0005,
-0x00050003,0x00070004,0x00090007,0x00060006,0x00040006,0x00020007,0x00030005,0x00010003,
-0xfffffffd,0xfffffffe,0x0000ffff,0x00070007,0x000b0009,0x00150011,0x0024001c,0x00320027,
-0x00410033,0x004c0043,0x005c0052,0x00680065,0x00760073,0x00830080,0x00920090,0x009c009c,
-0x00a800a7,0x00ae00ad,0x00b700b0,0x00b500b5,0x00b700b4,0x00b600b2,0x00ae00b1,0x00ad00ae,
-0x00a800a9,0x00a000a3,0x00990097,0x008f008e,0x0087008b,0x00800085,0x0076007b,0x006d0075,
-0x0062006e,0x005f0066,0x005d0060,0x0059005d,0x00570058,0x00590059,0x0061005a,0x006b0063,
-0x0070006a,0x007e0076,0x00880081,0x0090008b,0x00a4009a,0x00b100a9,0x00c600bc,0x00d200cd,
-0x00dd00d7,0x00e700e5,0x00f400f5,0x00fe00fd,0x01050108,0x0110010d,0x01110110,0x01130114,
-0x01190119,0x011c011b,0x011d011d,0x011f011e,0x011e011d,0x011b0120,0x011e011d,0x01190119,
-0x01130115,0x010f010f,0x0107010e,0x01000104,0x00f900fe,0x00ed00f1,0x00e300e4,0x00cf00d9,
-0x00c100c8,0x00b200b9,0x009c00a6,0x00870094,0x00740080,0x0064006a,0x004a0056,0x00370043,
-0x0026002e,0x0012001c,0x0001000f,0xfff2fffd,0xffe7ffe9,0xffd9ffdd,0xffceffd1,0xffb9ffc5,
-0xffb9ffb9,0xffa9ffb0,0xffa7ffa6,0xff9bff9e,0xff92ff93,0xff86ff8d,0xff87ff8a,0xff7fff87,
-0xff79ff7d,0xff71ff72,0xff6cff71,0xff65ff6b,0xff64ff68,0xff64ff65,0xff5dff65,0xff5fff5f,
-0xff57ff58,0xff4eff52,0xff4bff4c,0xff49ff48,0xff42ff43,0xff46ff44,0xff43ff44,0xff48ff47,
-0xff4aff4a,0xff4eff49,0xff53ff4e,0xff5eff54,0xff60ff5c,0xff69ff63,0xff71ff6b,0xff77ff70,
-0xff81ff77,0xff84ff80,0xff8fff89,0xff88ff8d,0xff88ff8d,0xff84ff8b,0xff85ff89,0xff84ff86,
-0xff79ff7f,0xff6eff77,0xff63ff69,0xff57ff5a,0xff46ff4e,0xff3dff3e,0xff2fff32,0xff26ff24,
-0xff1bff21,0xff10ff13,0xff08ff05,0xff05ff03,0xff05ff02,0xff0aff05,0xff16ff13,0xff1eff1b,
-0xff28ff27,0xff38ff36,0xff45ff45,0xff59ff4f,0xff66ff5b,0xff71ff6c,0xff7cff74,0xff85ff7a,
-0xff89ff85,0xff8bff8a,0xff88ff8b,0xff83ff8b,0xff81ff80,0xff78ff7f,0xff71ff74,0xff63ff6b,
-0xff5cff61,0xff59ff5c,0xff51ff5a,0xff58ff56,0xff54ff56,0xff57ff54,0xff5fff5c,0xff62ff62,
-0xff76ff6b,0xff80ff79,0xff8aff86,0xff9dff95,0xffa7ffa1,0xffb7ffad,0xffc2ffbc,0xffcbffc7,
-0xffd5ffd3,0xffdcffda,0xffe7ffe2,0xffebffe8,0xffeeffe6,0xfff0ffed,0xfff8fff3,0xfff8fff8,
-0xfff9fffb,0xfffbffff,0x00010001,0x00080009,0x000d000e,0x00120011,0x0022001b,0x002a0026,
-0x00330029,0x003a0039,0x0044003d,0x0052004e,0x00610059,0x006c0065,0x007c0070,0x0083007a,
-0x0093008b,0x009d0096,0x00a7009e,0x00af00af,0x00b900b6,0x00be00bd,0x00c300bf,0x00c400c6,
-0x00c400c4,0x00bf00c4,0x00bd00c1,0x00b600be,0x00a900b0,0x00a600a8,0x009600a0,0x0086008c,
-0x007d0080,0x006e0071,0x00670068,0x0057005c,0x004e0053,0x00410047,0x00390040,0x0032003a,
-0x002d0037,0x002f002f,0x00320033,0x002f002e,0x0032002c,0x00340031,0x00350034,0x00390039,
-0x003c0041,0x00410042,0x003f0043,0x003f0044,0x003e0042,0x003d0041,0x0040003f,0x003d003e,
-0x00420038,0x003f0038,0x00360036,0x003a0034,0x00360037,0x00360038,0x00350035,0x003e003b,
-0x00440043,0x004e004d,0x005d005a,0x00640060,0x00730069,0x00790077,0x007e0078,0x00880085,
-0x008e0092,0x00980092,0x00a10096,0x00a3009e,0x009d009b,0x009a0098,0x00960096,0x008d0097,
-0x0087008d,0x007d0086,0x00750082,0x0068007b,0x0060006e,0x00600067,0x0057005b,0x004e0050,
-0x0047004b,0x003f0041,0x003b003c,0x002c0034,0x0027002a,0x00210021,0x0018001c,0x00130016,
-0x00090009,0x00040004,0x00010001,0xfffd0000,0xfffdfffc,0xfffb0000,0xfffbfffe,0x00010000,
-0x00080005,0x00120012,0x00180018,0x00210021,0x00250025,0x002f002c,0x003a003b,0x003e0041,
-0x00420044,0x00450049,0x0049004e,0x0044004c,0x003d0049,0x0039003d,0x00290033,0x001e0023,
-0x000b0011,0xfffd0003,0xffeefff6,0xffddffe0,0xffcbffd1,0xffbeffbc,0xffb2ffaf,0xffa5ffa2,
-0xff99ff99,0xff93ff92,0xff8bff8d,0xff8dff8d,0xff8eff8f,0xff93ff92,0xff9eff9f,0xffa4ffa4,
-0xffb2ffae,0xffc0ffbc,0xffd1ffc9,0xffd9ffd6,0xffecffe6,0xfff6ffed,0xfffdfff5,0x0004fffe,
-0x000a0008,0x000c0009,0x000a0009,0x000b000a,0x00050009,0x00010005,0xffff0002,0xfffa0001,
-0xfff6fffb,0xfff0fff4,0xffeefff2,0xffebffeb,0xffe7ffea,0xffe9ffe7,0xffe6ffe3,0xffe6ffe0,
-0xffe2ffe3,0xffdfffe2,0xffe0ffde,0xffe2ffdd,0xffddffdf,0xffe1ffe3,0xffddffdc,0xffddffe4,
-0xffdbffe0,0xffdcffdd,0xffdbffde,0xffdbffdd,0xffdbffd9,0xffddffdd,0xffdbffdc,0xffddffdc,
-0xffdbffd8,0xffdbffd8,0xffe0ffde,0xffdeffdc,0xffdfffdb,0xffd9ffd8,0xffd4ffd8,0xffd1ffd0,
-0xffceffcd,0xffc8ffc7,0xffbcffc4,0xffabffb4,0xffa4ffb1,0xff99ffa3,0xff91ff9a,0xff88ff8e,
-0xff80ff84,0xff74ff78,0xff76ff75,0xff72ff71,0xff6cff69,0xff69ff69,0xff6aff6b,0xff6cff6c,
-0xff72ff6c,0xff79ff74,0xff7aff79,0xff86ff7f,0xff8bff88,0xff8eff8f,0xff94ff95,0xff9bff98,
-0xff9cff9b,0xff99ff9b,0xff9dff9a,0xff9bff99,0xff98ff94,0xff93ff99,0xff8fff8f,0xff88ff8f,
-0xff87ff88,0xff83ff87,0xff84ff82,0xff7fff7f,0xff7eff7a,0xff83ff7e,0xff82ff81,0xff85ff89,
-0xff87ff89,0xff8cff8c,0xff95ff92,0xff9aff95,0xff9cff94,0xff99ff9f,0xff9cff99,0xffa0ff9d,
-0xff9aff9c,0xff96ff99,0xff8fff92,0xff93ff91,0xff90ff91,0xff8dff8c,0xff8aff8d,0xff85ff86,
-0xff91ff8a,0xff93ff8c,0xff9eff95,0xffa6ff9c,0xffb1ffa8,0xffc0ffb9,0xffd4ffc7,0xffe5ffdb,
-0xfffbffef,0x000f0008,0x00220019,0x00390030,0x004c0040,0x005e0052,0x006a0062,0x00720073,
-0x007a0081,0x00800080,0x00840082,0x007e0080,0x0079007b,0x006f0075,0x0063006a,0x0051005c,
-0x0042004b,0x0032003a,0x0023002a,0x0017001a,0x000a0010,0xfffefffe,0xfffcfffa,0xfffbfffb,
-0xfffdfffa,0x00050002,0x000d0006,0x00140014,0x00260022,0x002e002d,0x0041003a,0x004d0048,
-0x00570052,0x0063005e,0x006a0066,0x00710071,0x00780074,0x00770077,0x007c0079,0x0080007f,
-0x0083007d,0x0084007e,0x00840081,0x00890085,0x0090008d,0x0092008e,0x009f0098,0x00a600a1,
-0x00b500ad,0x00be00bd,0x00cb00c6,0x00d500d5,0x00e100e1,0x00ea00e9,0x00f300f1,0x00fc00f8,
-0x00ff00fd,0x00fd0100,0x00fb0100,0x00f900fb,0x00f400f2,0x00eb00ef,0x00e500e5,0x00df00de,
-0x00da00da,0x00d200d5,0x00cd00cb,0x00c300c6,0x00bd00be,0x00b900bc,0x00b900b9,0x00b500ba,
-0x00af00b8,0x00b100b3,0x00a700ac,0x00a400a9,0x00a000a6,0x009700a0,0x008e009b,0x00890090,
-0x0085008a,0x007a0082,0x00750075,0x00700073,0x0067006a,0x00610064,0x00560059,0x00500054,
-0x004b0053,0x0049004f,0x0049004d,0x004d004a,0x004d0048,0x004e004c,0x004a0048,0x00490048,
-0x004a0049,0x00460047,0x00460045,0x00430041,0x00420045,0x003b003e,0x0040003b,0x003d003a,
-0x00310035,0x002b0030,0x00220027,0x001e0020,0x00130019,0x000b000e,0xfffd0006,0xfff4fff9,
-0xffe5ffed,0xffd5ffd9,0xffc2ffcc,0xffaaffb7,0xff9fffa9,0xff88ff92,0xff73ff7f,0xff5fff69,
-0xff4dff58,0xff3aff40,0xff23ff2c,0xff18ff1b,0xff09ff0b,0xfefdfeff,0xfef7fef8,0xfeedfef0,
-0xfee9feeb,0xfeeafeea,0xfee6fee8,0xfeeafee6,0xfeedfeeb,0xfef2fef0,0xfefefefd,0xff0bff03,
-0xff16ff0f,0xff20ff1a,0xff28ff24,0xff33ff2f,0xff3dff39,0xff44ff42,0xff4bff46,0xff55ff53,
-0xff55ff5a,0xff58ff5b,0xff5cff5c,0xff65ff5f,0xff67ff5f,0xff66ff61,0xff67ff65,0xff69ff65,
-0xff6fff6d,0xff6cff72,0xff72ff73,0xff79ff7a,0xff7dff7b,0xff88ff80,0xff8dff89,0xff93ff90,
-0xff9bff93,0xffa3ffa0,0xffacffa8,0xffb4ffb0,0xffb9ffb5,0xffbeffb6,0xffc4ffbc,0xffc6ffc1,
-0xffc6ffc3,0xffc0ffc1,0xffc2ffbc,0xffb2ffb4,0xffa6ffac,0xffa1ffa4,0xff96ffa0,0xff8cff94,
-0xff81ff89,0xff75ff7e,0xff66ff72,0xff61ff64,0xff5aff5d,0xff52ff52,0xff51ff4d,0xff4eff4d,
-0xff50ff4b,0xff56ff4f,0xff5cff57,0xff66ff5c,0xff76ff6b,0xff85ff7d,0xff95ff8b,0xffa5ff9f,
-0xffb8ffb1,0xffcfffc3,0xffe0ffd4,0xffedffe7,0xfffefff8,0x000a0005,0x0016000f,0x001e0018,
-0x00280021,0x00240026,0x002a002a,0x0029002b,0x00250025,0x00230023,0x001b0021,0x0013001c,
-0x000c0011,0x0006000c,0x00040001,0x0001ffff,0xfffcfffd,0xfffbfffe,0xfffeffff,0x00060004,
-0x000a0006,0x0017000c,0x0022001d,0x0031002c,0x0043003d,0x0050004c,0x0063005d,0x00750070,
-0x0088007d,0x0099008d,0x00a3009b,0x00aa00a3,0x00b500ae,0x00bd00b8,0x00bd00b9,0x00c000bc,
-0x00be00b7,0x00be00b8,0x00b600bb,0x00b300b4,0x00b100b4,0x00a700ac,0x00a300aa,0x00a300aa,
-0x00a000a1,0x009f0099,0x00990095,0x00920093,0x00940094,0x00910095,0x008e0095,0x00910093,
-0x0093008f,0x008e0093,0x0090008c,0x008c008b,0x00890087,0x00800080,0x007e007f,0x007b0080,
-0x00760077,0x00710074,0x006d006e,0x00680070,0x00650069,0x00610065,0x00590061,0x00550057,
-0x00500053,0x004f004f,0x004f004d,0x00490047,0x0047004c,0x00420046,0x00420042,0x003a0039,
-0x00370038,0x00350033,0x0031002f,0x00290026,0x00210022,0x001a001c,0x00140017,0x00100010,
-0x000d000e,0x000a0007,0x00050005,0x00010002,0x00000001,0x00040002,0x0002fffe,0x0003fffc,
-0x00040002,0x00000003,0x00000001,0x00040009,0x00060009,0x0006000f,0x0008000b,0x000b0009,
-0x000f000b,0x000c0010,0x000f0011,0x000e0010,0x00110011,0x00160015,0x00120014,0x00150012,
-0x001e0015,0x001c0015,0x0021001a,0x0020001c,0x001f0020,0x001e0021,0x001d0023,0x001f0021,
-0x0022001e,0x0018001f,0x00140018,0x0015001c,0x00120016,0x00140016,0x00110013,0x00090011,
-0x000c000f,0x000e0011,0x0010000a,0x0011000f,0x000d0011,0x00120014,0x00160017,0x0017001c,
-0x001b001d,0x0021001c,0x00270023,0x00280027,0x002f002b,0x0030002b,0x002e002b,0x002e002d,
-0x0028002d,0x00280029,0x00220026,0x001c0021,0x0017001b,0x00110013,0x0009000e,0xfffc0003,
-0xfff6fffb,0xffebfff1,0xffe6ffeb,0xffe0ffe6,0xffdaffda,0xffd4ffd2,0xffc9ffcb,0xffc1ffc6,
-0xffbcffbf,0xffb6ffba,0xffadffb2,0xffb2ffb3,0xffa9ffb1,0xffabffaa,0xffa5ffa7,0xffa4ff9e,
-0xff9effa0,0xff94ff9a,0xff92ff96,0xff91ff92,0xff8fff8f,0xff88ff8d,0xff88ff8b,0xff83ff89,
-0xff81ff86,0xff83ff86,0xff8aff86,0xff88ff88,0xff8eff8a,0xff94ff91,0xff93ff97,0xffa0ff9d,
-0xffa8ffa4,0xffb0ffa9,0xffbcffb3,0xffc6ffbe,0xffd1ffc8,0xffdcffd4,0xffe4ffe1,0xffeeffe7,
-0xfff4fff0,0xfffefff7,0x0001ffff,0x0002ffff,0x00050003,0x00040005,0xffff0002,0xfffbfffc,
-0xfff5fff9,0xffebfff2,0xffe1ffe7,0xffd5ffde,0xffc8ffd5,0xffbeffc5,0xffb9ffba,0xffacffad,
-0xff9fffa1,0xff94ff96,0xff8aff8d,0xff81ff82,0xff76ff7d,0xff6fff72,0xff6cff70,0xff66ff6c,
-0xff66ff66,0xff61ff69,0xff63ff68,0xff66ff67,0xff67ff66,0xff6eff67,0xff71ff6a,0xff78ff75,
-0xff79ff71,0xff83ff7d,0xff86ff84,0xff8bff87,0xff8cff8f,0xff93ff92,0xff97ff96,0xff9bff9a,
-0xffa0ffa0,0xffa1ffa4,0xffa5ffaa,0xffa8ffa8,0xffa9ffaa,0xffb0ffac,0xffb3ffae,0xffb1ffad,
-0xffb4ffb3,0xffb2ffb8,0xffb6ffb9,0xffbbffb9,0xffc0ffc2,0xffc1ffc2,0xffc8ffc3,0xffccffc9,
-0xffcfffc9,0xffcfffcd,0xffcdffd1,0xffd0ffd1,0xffd5ffd2,0xffd3ffd0,0xffd5ffd2,0xffd2ffd3,
-0xffd3ffd6,0xffd7ffd8,0xffd5ffd5,0xffd9ffdb,0xffd7ffdc,0xffdcffda,0xffdeffdb,0xffe4ffe0,
-0xffe9ffe5,0xffeeffea,0xfff6fff0,0x00090000,0x0010000c,0x001c0015,0x002e0024,0x00380033,
-0x0045003d,0x0051004f,0x0061005e,0x0072006c,0x007e0076,0x0087007e,0x0090008a,0x009a0094,
-0x00a1009b,0x00a800a3,0x00b100ac,0x00b400af,0x00b300b2,0x00b900b5,0x00bb00b9,0x00bf00c0,
-0x00bf00be,0x00bd00bd,0x00c200c1,0x00c500c7,0x00c100be,0x00c200bf,0x00bc00bd,0x00b800ba,
-0x00b100ba,0x00a800ac,0x00a600aa,0x009c00a2,0x0095009a,0x008e008f,0x00870087,0x007d0080,
-0x007c007f,0x00790075,0x00790073,0x006f006f,0x006c006a,0x006a006a,0x006d0069,0x006b0069,
-0x006c006e,0x0069006c,0x006b006b,0x00680069,0x006a006b,0x00680067,0x00650069,0x005f0062,
-0x00610063,0x00620060,0x00610063,0x00610064,0x00610062,0x00620064,0x0068006a,0x0070006a,
-0x006e006d,0x0074006f,0x00740072,0x00780077,0x007b0079,0x00830081,0x00870085,0x0090008e,
-0x008e008f,0x0090008c,0x00950096,0x00950091,0x00920094,0x008e008f,0x008c0094,0x008d008e,
-0x008b0088,0x00850084,0x00800086,0x007b0079,0x00770077,0x006d006e,0x00660068,0x005c005a,
-0x004c0052,0x00420044,0x003a003f,0x002d0033,0x00210026,0x001a0023,0x00120018,0x000e0012,
-0x000d000e,0x00060007,0x00090007,0x00040004,0x00010003,0xfffd0004,0xfffefffe,0xfff9fffb,
-0xfff8fffb,0xfff6fff5,0xfff2fff1,0xffedfff1,0xffe6ffe6,0xffe2ffdd,0xffdaffd9,0xffccffd2,
-0xffc3ffc7,0xffbcffbf,0xffafffb4,0xffa8ffaf,0xffa0ffa6,0xff94ff98,0xff8bff91,0xff84ff89,
-0xff7fff85,0xff75ff7a,0xff6aff70,0xff67ff6b,0xff5dff62,0xff55ff5b,0xff45ff4f,0xff3dff42,
-0xff2dff37,0xff23ff29,0xff17ff1d,0xff05ff0e,0xfefbff01,0xfeebfef3,0xfee2fee6,0xfed0fed8,
-0xfec7fec8,0xfebdfebc,0xfeb4feb8,0xfeaffeb1,0xfeb1feb1,0xfeb5feb3,0xfebbfeb8,0xfec8fec4,
-0xfed6fed0,0xfee3fee4,0xfefdfef2,0xff11ff08,0xff27ff1e,0xff43ff3a,0xff5fff4f,0xff74ff65,
-0xff89ff77,0xff98ff8f,0xffadffa2,0xffbdffb7,0xffc6ffc3,0xffc7ffc6,0xffcfffcc,0xffccffcd,
-0xffc8ffcc,0xffbdffc5,0xffb1ffba,0xffaaffb0,0xffa2ffa5,0xff91ff99,0xff8aff8f,0xff81ff80,
-0xff79ff7b,0xff74ff76,0xff6cff6d,0xff6cff6a,0xff70ff6a,0xff71ff68,0xff76ff70,0xff79ff74,
-0xff83ff82,0xff8fff8f,0xff9fff9c,0xffacffa5,0xffc2ffb5,0xffd2ffc7,0xffdfffd9,0xffe9ffe6,
-0xfffcfff4,0x000a0004,0x001c0014,0x0025001a,0x002a0025,0x0033002b,0x00370036,0x003f0040,
-0x00440046,0x004e004b,0x0053004f,0x00500050,0x00530057,0x0057005a,0x00570058,0x00580055,
-0x00580058,0x0059005a,0x005b0062,0x00620060,0x00630060,0x006a0068,0x00690066,0x006e006b,
-0x0071006c,0x0073006a,0x006f006b,0x0070006c,0x006a006d,0x006d006e,0x006c006c,0x006a0068,
-0x00690069,0x00680066,0x00660067,0x005e0063,0x00650064,0x0060005c,0x00600066,0x005e005f,
-0x005e005f,0x0062005e,0x005f0060,0x005f005c,0x0060005c,0x0058005e,0x00560059,0x00560056,
-0x00520053,0x004f004f,0x0047004b,0x00480048,0x00460042,0x00420041,0x00410043,0x00420046,
-0x00430047,0x00430045,0x004b0049,0x00540050,0x0062005a,0x00670063,0x006f006b,0x00750072,
-0x0080007d,0x00850082,0x00860085,0x00880088,0x008b008a,0x008e0088,0x00880088,0x00840085,
-0x00810081,0x007b007c,0x00720075,0x006d006d,0x005e0066,0x00540059,0x0048004d,0x003e0047,
-0x00350039,0x002f0032,0x0024002c,0x001e0026,0x001d001b,0x001c001d,0x0017001c,0x001c0017,
-0x001e001c,0x001f0017,0x0022001e,0x00250021,0x00280026,0x002b002d,0x002b002e,0x002d0031,
-0x00310036,0x00320038,0x00340032,0x00310033,0x00320036,0x002c0032,0x0027002d,0x0021002a,
-0x00210020,0x0017001b,0x000d0010,0x000a000a,0x00030008,0x00010002,0xfffffffd,0xfffefffc,
-0xfffafffa,0xfffcfff9,0xfffcfffb,0xfffcfff5,0xfffdfff9,0xfffcfffd,0xfffcfffb,0xfffefffc,
-0x00040001,0x00050004,0x00060001,0x00060008,0x00030005,0x00020003,0x00030002,0x00030005,
-0x00020006,0xfffc0000,0xfff7fffc,0xfff8fff6,0xfff6fff3,0xffeaffed,0xffe4ffe4,0xffd9ffdf,
-0xffd6ffda,0xffd1ffd2,0xffccffd0,0xffcbffc8,0xffc7ffc7,0xffcbffc5,0xffccffcb,0xffcdffc8,
-0xffd1ffca,0xffd6ffca,0xffd8ffd6,0xffe1ffde,0xffebffe6,0xfff0fff4,0xfffefff9,0x00070006,
-0x0013000a,0x001a0012,0x001d001b,0x0023001f,0x00250025,0x002c002b,0x002a0030,0x002c0032,
-0x002d0030,0x002b002b,0x0024002a,0x00180022,0x001b001e,0x00100016,0x0008000c,0x00020003,
-0xfff6fffa,0xffecfff1,0xffe3ffe7,0xffd9ffdf,0xffd5ffd8,0xffd0ffd3,0xffc9ffca,0xffbeffc4,
-0xffbaffbe,0xffb1ffb5,0xffabffac,0xffa7ffa9,0xffa6ffa8,0xffa1ffa3,0xff9dff9e,0xff99ff9c,
-0xff97ff94,0xff98ff97,0xff8bff8d,0xff8bff8e,0xff89ff8d,0xff84ff87,0xff85ff83,0xff89ff88,
-0xff86ff83,0xff87ff82,0xff8cff8b,0xff8aff8b,0xff8aff8b,0xff8cff8c,0xff8dff91,0xff8eff8e,
-0xff8fff8d,0xff94ff8e,0xff94ff94,0xff98ff97,0xff9bff97,0xff9cff9e,0xff9eff9a,0xff9fff9b,
-0xff9eff9e,0xff9cff9d,0xff9bffa0,0xffa1ffa2,0xffa2ffa6,0xffa6ffa7,0xffa4ffa8,0xffaaffa7,
-0xffa4ffa7,0xffa9ffa2,0xffa9ffa4,0xffa2ffa5,0xffa3ffa3,0xffa3ffa1,0xffa3ffa2,0xff9fffa3,
-0xff9bff9e,0xff95ff9a,0xff96ff96,0xff94ff93,0xff9aff95,0xff95ff92,0xff95ff95,0xff9aff92,
-0xff9eff98,0xff9eff9b,0xffa8ffa3,0xffadffa8,0xffb2ffb0,0xffbfffbc,0xffceffc5,0xffd6ffd2,
-0xffe1ffdc,0xffecffe9,0xfff8fff4,0xfffefff9,0x00060005,0x0011000f,0x00180014,0x001b001c,
-0x0024001f,0x0027002a,0x002c002e,0x002d002a,0x0030002e,0x002e002d,0x0030002f,0x002c002e,
-0x002e0030,0x0031002e,0x0032002e,0x002c0030,0x0031002f,0x0030002d,0x002d0031,0x002c002d,
-0x0029002d,0x0026002b,0x00250027,0x0021001f,0x001e001f,0x00190018,0x00130017,0x00130012,
-0x000e000f,0x000e0006,0x00070004,0x0000ffff,0xfffffffb,0xfffefffa,0xfff8fffd,0xfff8fff9,
-0xfff9fff9,0xfff5fffc,0xfffbfffc,0x0000fffb,0x00050003,0x00070003,0x00070008,0x0011000d,
-0x00160011,0x00190017,0x001c001a,0x00230023,0x00260029,0x002e0029,0x00370037,0x0041003f,
-0x00520049,0x005e0059,0x006a0065,0x007d0071,0x00930085,0x009e0097,0x00b000a5,0x00bb00b8,
-0x00cd00c5,0x00e000d4,0x00ec00e2,0x00f500f2,0x00fb00fe,0x01040105,0x010a0106,0x010c010a,
-0x010e010b,0x0107010a,0x0108010a,0x01020104,0x00fd0103,0x00f400f6,0x00e900f0,0x00db00e1,
-0x00cf00d6,0x00c300ca,0x00b600be,0x00aa00b0,0x009f00a1,0x00950099,0x00870092,0x007d0083,
-0x0076007b,0x006c0071,0x00690069,0x00600064,0x005d005f,0x005f005d,0x005d005b,0x00580056,
-0x0057004f,0x00560051,0x00580051,0x00550054,0x00500056,0x004f0055,0x004e0050,0x004f0051,
-0x004c004f,0x0049004c,0x004c004a,0x00480048,0x00490048,0x004a0047,0x0048004a,0x00460049,
-0x00460046,0x00440041,0x00420040,0x003b0040,0x00340039,0x00300037,0x0029002d,0x00240025,
-0x0019001a,0x000e0010,0xffff0005,0xfff1fff7,0xffdcffe5,0xffcaffd5,0xffbbffc1,0xffabffb1,
-0xff9affa1,0xff8aff96,0xff7eff87,0xff72ff7d,0xff6dff6e,0xff6bff67,0xff62ff62,0xff5dff60,
-0xff59ff5d,0xff60ff5f,0xff5fff60,0xff60ff5d,0xff66ff60,0xff62ff65,0xff67ff64,0xff66ff65,
-0xff6aff6a,0xff6eff68,0xff6fff6d,0xff6eff6d,0xff6dff71,0xff6eff71,0xff6eff70,0xff6cff6b,
-0xff6bff6b,0xff6eff6b,0xff6eff6f,0xff71ff6d,0xff71ff6f,0xff6fff6f,0xff6fff6f,0xff73ff72,
-0xff6dff71,0xff6dff6c,0xff6bff6d,0xff65ff69,0xff64ff69,0xff5bff64,0xff58ff5b,0xff56ff56,
-0xff4aff51,0xff43ff48,0xff41ff44,0xff3eff40,0xff39ff3b,0xff33ff34,0xff36ff31,0xff2cff2e,
-0xff2cff2f,0xff2aff2e,0xff29ff27,0xff2eff2a,0xff25ff2a,0xff28ff23,0xff29ff2a,0xff2dff29,
-0xff30ff2d,0xff37ff32,0xff3fff3b,0xff46ff40,0xff4fff4b,0xff62ff57,0xff6dff68,0xff80ff78,
-0xff90ff8c,0xffa5ff9d,0xffbdffaf,0xffcfffc4,0xffe0ffd6,0xfff1ffe9,0x0006fffb,0x000e000b,
-0x00160011,0x0020001f,0x00250021,0x00290029,0x00220028,0x00210023,0x001d001e,0x0015001b,
-0x00120019,0x0008000d,0xfffe0007,0xfffafffc,0xfff1fff6,0xffebffef,0xffecffec,0xffeeffec,
-0xffedffea,0xffedfff0,0xfff7fff5,0x0000fffa,0x000a0003,0x0018000a,0x0023001b,0x0033002a,
-0x003c0036,0x004c004a,0x005c0058,0x00650067,0x00780072,0x007f0083,0x008c008c,0x00930094,
-0x0097009a,0x009e009e,0x00a0009d,0x00a200a1,0x00a300a0,0x009d009c,0x009c009a,0x008b0091,
-0x008a008f,0x007f0082,0x0076007a,0x00710076,0x006d0070,0x00670069,0x00620065,0x005d0062,
-0x005f005e,0x005d005c,0x005f0061,0x005f005f,0x00630060,0x00640061,0x00660066,0x00660069,
-0x006a006c,0x0069006b,0x00670069,0x006c006b,0x0067006b,0x00650065,0x00630065,0x00610063,
-0x005b005f,0x005a0059,0x00590059,0x00570054,0x00550050,0x0053004d,0x004f004d,0x0046004a,
-0x0047004a,0x00460045,0x00460044,0x003c0041,0x0038003c,0x00310036,0x002d0031,0x0026002c,
-0x00240022,0x001c001f,0x00180017,0x00160015,0x00120011,0x00090010,0x000c000c,0x000b000c,
-0x000b000a,0x000f000f,0x00140014,0x00190016,0x001e0018,0x00270021,0x0032002d,0x00360033,
-0x003f003a,0x00440043,0x00480047,0x004d004e,0x00540052,0x00580056,0x00560059,0x005a005c,
-0x0052005b,0x004d0055,0x00470045,0x003d0040,0x00360037,0x002f002f,0x0026002a,0x001c001c,
-0x00170015,0x00150010,0x000f000b,0x000c0006,0x00080006,0x000a0006,0x000a0009,0x000c000b,
-0x0014000c,0x00170011,0x001b0017,0x0019001b,0x00160019,0x0017001b,0x0019001b,0x00190017,
-0x00120017,0x0011000e,0x0006000f,0x00010003,0xfff6fffe,0xfff1fff1,0xffecffed,0xffe4ffe5,
-0xffdfffdf,0xffdcffdd,0xffd8ffd6,0xffdeffd7,0xffdeffdc,0xffdfffdf,0xffe9ffe3,0xfff0ffe8,
-0xfff1fff2,0xfffafff5,0xfffefffa,0xfffdffff,0x00000002,0x00090007,0x000d0004,0x0010000e,
-0x000c000b,0x000a000c,0x00070011,0x0005000d,0x00000001,0xfffffffe,0xfff5fff9,0xffefffed,
-0xffe5ffea,0xffdbffe3,0xffd6ffdb,0xffceffd0,0xffc5ffc9,0xffbfffc6,0xffbdffbd,0xffb9ffba,
-0xffaeffb5,0xffafffae,0xffb0ffb1,0xffacffaf,0xffafffab,0xffaeffb2,0xffacffa9,0xffb1ffab,
-0xffacffab,0xffb2ffaf,0xffb5ffb6,0xffb5ffb6,0xffb1ffb7,0xffb4ffb6,0xffbbffbb,0xffbdffbb,
-0xffbdffb8,0xffbaffb9,0xffbeffb9,0xffbfffbd,0xffbeffbd,0xffc4ffc2,0xffc7ffc3,0xffccffca,
-0xffcbffcc,0xffd6ffd0,0xffdbffd8,0xffe1ffde,0xffe8ffe7,0xffeffff1,0xfff5fff2,0xfff9fff6,
-0xfff9fffa,0xfff5fff9,0xfff2fff6,0xfff1fff9,0xffe7fff1,0xffe4ffec,0xffdcffe4,0xffcfffd7,
-0xffc4ffcd,0xffbbffc0,0xffb1ffb5,0xffa2ffab,0xff9bff9f,0xff93ff9b,0xff8dff8f,0xff8dff8f,
-0xff8fff8e,0xff90ff8c,0xff90ff90,0xff96ff8e,0xff9bff92,0xff9fff9d,0xffa9ffa0,0xffacffa7,
-0xffb2ffac,0xffb9ffb2,0xffc0ffb9,0xffbeffba,0xffc2ffc0,0xffc0ffbe,0xffc2ffc1,0xffc1ffbb,
-0xffbbffbe,0xffb8ffba,0xffb2ffb3,0xffaeffb3,0xffaeffaf,0xffadffad,0xffa9ffaf,0xffaeffae,
-0xffadffad,0xffb1ffae,0xffb1ffae,0xffbbffb7,0xffbeffc0,0xffbfffc1,0xffc4ffc3,0xffc8ffc5,
-0xffcaffca,0xffc8ffcd,0xffc9ffc9,0xffcaffcc,0xffcfffcc,0xffc9ffcd,0xffc6ffc9,0xffbfffc3,
-0xffbbffbe,0xffb9ffb9,0xffb7ffb9,0xffb3ffb6,0xffabffad,0xffacffaa,0xffafffb0,0xffb1ffaf,
-0xffb8ffb3,0xffbbffb8,0xffcaffc4,0xffd5ffd0,0xffdeffd7,0xfff1ffe2,0x0000fff4,0x000f0001,
-0x001c0016,0x002b0025,0x003b0032,0x00480040,0x00500049,0x005d0057,0x0064005e,0x006a0065,
-0x0071006c,0x00750071,0x00710075,0x00720074,0x0073007a,0x00760079,0x00760079,0x00770075,
-0x007a0078,0x007a007b,0x007b007d,0x007e007e,0x00800081,0x00820085,0x00840088,0x00890088,
-0x00870088,0x008f008b,0x008d008e,0x008e008f,0x00900091,0x00900090,0x0090008e,0x0090008b,
-0x0088008c,0x00890088,0x00820089,0x007c007f,0x0079007c,0x00740073,0x00750073,0x00680071,
-0x006b006a,0x00650067,0x00630063,0x0060005f,0x005d0060,0x0059005c,0x005b005b,0x005d0056,
-0x005e0059,0x005c0057,0x005c005b,0x00610062,0x00650064,0x006a0067,0x0070006f,0x007b0075,
-0x00820081,0x008f008c,0x00980094,0x00a300a0,0x00ad00ab,0x00b700b3,0x00b800b5,0x00c100bc,
-0x00c300c4,0x00c300c2,0x00be00bf,0x00b600c0,0x00b000b5,0x00a600ab,0x009b00a3,0x00900092,
-0x00830088,0x006f0076,0x005e0066,0x00500055,0x003e004a,0x00300039,0x00230029,0x001b0023,
-0x000d0014,0x00070009,0xfffe0000,0xfff4fffa,0xffedfff1,0xffecffec,0xffeaffe7,0xffe8ffe7,
-0xffedffe4,0xffecffe8,0xffedffea,0xffedffee,0xffedfff3,0xffeffff5,0xfff1ffee,0xfff4fff6,
-0xfff7fff2,0xfffdfff9,0xfffafff7,0xfffefffb,0xfffdfffd,0xfffefffb,0xfffb0000,0xfff7fffc,
-0xfff8fffe,0xfff6fffb,0xfff5fff7,0xffe8fff3,0xffeaffea,0xffe6ffe8,0xffd9ffe1,0xffd2ffd6,
-0xffcdffcc,0xffc1ffc5,0xffbcffbc,0xffb0ffb4,0xffa1ffa4,0xff91ff9a,0xff85ff90,0xff79ff85,
-0xff6fff72,0xff5eff64,0xff54ff59,0xff49ff50,0xff3bff44,0xff30ff39,0xff27ff2c,0xff24ff27,
-0xff1eff1f,0xff1dff1f,0xff1dff19,0xff23ff1d,0xff20ff21,0xff2aff29,0xff2dff2d,0xff35ff34,
-0xff3aff39,0xff44ff3e,0xff47ff42,0xff51ff49,0xff54ff53,0xff5bff58,0xff5cff5b,0xff60ff63,
-0xff63ff63,0xff69ff65,0xff68ff64,0xff68ff65,0xff6cff69,0xff68ff6a,0xff6aff6b,0xff6aff6e,
-0xff6fff6a,0xff71ff6d,0xff73ff6d,0xff73ff74,0xff7aff76,0xff80ff7c,0xff85ff83,0xff8dff89,
-0xff96ff90,0xff9eff98,0xffa4ffa1,0xffa6ffa9,0xffabffa9,0xffadffaf,0xffb1ffb3,0xffb7ffb0,
-0xffb6ffb7,0xffbbffb6,0xffbaffbb,0xffbaffbc,0xffbaffba,0xffbbffb8,0xffbcffbe,0xffbfffb8,
-0xffbdffbf,0xffbcffbe,0xffc5ffc3,0xffc5ffc5,0xffc9ffca,0xffd3ffd1,0xffdeffd6,0xffe1ffe3,
-0xffebffe5,0xfff5ffec,0xfffcfff9,0xfffffffd,0x000d0009,0x001a0010,0x00170013,0x0023001b,
-0x002c0027,0x00320030,0x003b0036,0x0042003f,0x00470046,0x0050004c,0x00560053,0x005a0054,
-0x005f0059,0x00630062,0x00640061,0x00660062,0x00600061,0x005d005d,0x0059005d,0x0056005b,
-0x00500056,0x004c004d,0x0046004a,0x00460048,0x003b0042,0x0036003e,0x00340038,0x00340035,
-0x00310037,0x003a0039,0x003f003a,0x00410040,0x004b0047,0x00530051,0x005f0059,0x00680064,
-0x0072006e,0x007b0077,0x0083007e,0x008d0089,0x008f008a,0x00990093,0x009a0095,0x009a009d,
-0x009a009b,0x009c009e,0x0098009c,0x00960098,0x00940097,0x00900091,0x008c0090,0x0089008b,
-0x0084008b,0x007f0088,0x00790080,0x0075007a,0x006e0074,0x006c0072,0x0066006a,0x00620063,
-0x005d005d,0x0059005c,0x00500053,0x004c004e,0x00470044,0x00420043,0x0039003e,0x003b0036,
-0x0031002f,0x002a002e,0x00280027,0x001f0021,0x0018001a,0x001b001a,0x00110018,0x0011000f,
-0x00090011,0x00070009,0x000a0006,0x00030006,0x00000004,0xfffc0003,0xfffefffb,0xfffffffd,
-0x0000fffe,0xffff0001,0x00040000,0x000b0006,0x000c0009,0x0014000f,0x001a0014,0x001a0017,
-0x0022001a,0x0025001f,0x00270024,0x00270023,0x00280027,0x00270029,0x002c002a,0x002c002b,
-0x002b0027,0x00280026,0x00280029,0x00250027,0x00210026,0x001e0022,0x001d001b,0x001d001d,
-0x001a0019,0x00190019,0x00160018,0x00150017,0x00160017,0x000f0015,0x000b000f,0x0005000c,
-0x00000007,0xfffe0002,0xfff5fffc,0xfff0fff6,0xffe6ffe9,0xffdeffde,0xffd7ffd3,0xffcaffcc,
-0xffc7ffc9,0xffbdffc4,0xffbbffbc,0xffb5ffb5,0xffadffb4,0xffacffb0,0xffafffae,0xffb3ffb0,
-0xffb2ffb4,0xffbcffb9,0xffc2ffbc,0xffcbffc7,0xffd8ffce,0xffe3ffd9,0xffeaffe3,0xfff9ffee,
-0x0002fffc,0x00080008,0x000e000f,0x00170016,0x001a0017,0x001d0018,0x001b001b,0x001a001e,
-0x0016001d,0x00130017,0x000e000e,0x00040006,0x00010001,0xfff90000,0xfff4fff4,0xffe9ffeb,
-0xffe9ffe6,0xffe0ffe6,0xffe2ffe4,0xffe2ffe0,0xffe4ffe0,0xffe3ffe1,0xffe2ffde,0xffe2ffe1,
-0xffe3ffe7,0xffe6ffe7,0xffe6ffe9,0xffe8ffe8,0xffe7ffe8,0xffe9ffea,0xffe6ffe7,0xffe6ffe6,
-0xffe2ffe2,0xffd8ffdb,0xffd4ffd8,0xffcfffd2,0xffc7ffc9,0xffc0ffbf,0xffb5ffb9,0xffb0ffb5,
-0xffaaffac,0xffa3ffa9,0xff9fffa5,0xff9cffa3,0xff9dffa4,0xff9dffa3,0xff9cff9d,0xffa8ffa2,
-0xffaaffa8,0xffabffaa,0xffb5ffb0,0xffbaffb4,0xffc1ffbe,0xffc3ffc3,0xffcaffc7,0xffcaffc8,
-0xffccffce,0xffd4ffcc,0xffd1ffd1,0xffd4ffd2,0xffceffd0,0xffc8ffcc,0xffc6ffcb,0xffbfffc2,
-0xffbbffc1,0xffb7ffb8,0xffb1ffb1,0xffabffb2,0xffa6ffaa,0xffa3ffa0,0xff9aff9c,0xff93ff94,
-0xff92ff8e,0xff8eff8d,0xff8cff8f,0xff88ff91,0xff8cff8a,0xff8cff8a,0xff8eff8f,0xff8dff90,
-0xff91ff91,0xff8fff92,0xff93ff91,0xff97ff94,0xff9bff99,0xff9dff9d,0xffa2ff9f,0xffa4ffa5,
-0xffa7ffab,0xffacffad,0xffadffae,0xffb1ffaf,0xffb5ffb0,0xffbaffb8,0xffc1ffbb,0xffc9ffc5,
-0xffcdffcc,0xffd6ffd3,0xffddffda,0xffe6ffe5,0xfff6ffeb,0xfffbfff7,0x0005fffd,0x000d000a,
-0x0014000e,0x001d0019,0x0022001b,0x00300028,0x00320031,0x003b0037,0x0041003f,0x00450042,
-0x004c0047,0x004f004a,0x0053004e,0x004f0052,0x004e0053,0x00500052,0x00530050,0x00530052,
-0x004d0050,0x0047004c,0x00430046,0x003b0040,0x003a0038,0x00310031,0x002d0031,0x0029002c,
-0x00240027,0x001b0022,0x000e0018,0x000c0012,0x000b000f,0x00030006,0x00050005,0x00050007,
-0x00070003,0x000b000b,0x0013000d,0x00190013,0x0021001b,0x00270024,0x002e002a,0x003b0036,
-0x004a0046,0x0052004d,0x0064005b,0x006c0067,0x0076006e,0x0082007c,0x008d0082,0x008f0085,
-0x00980090,0x009b0099,0x009c0098,0x00a300a2,0x00a600a3,0x00a800a1,0x00a900a6,0x00a500a8,
-0x00a200a5,0x00a300a2,0x00a500a5,0x00a200a4,0x009d009e,0x0098009b,0x00960099,0x00910096,
-0x008a008f,0x00800089,0x007b0082,0x00760078,0x00710073,0x00690069,0x00620066,0x005d005d,
-0x0057005e,0x00520057,0x004e0051,0x004a0051,0x00430044,0x00460045,0x004a004c,0x004a004b,
-0x004f004f,0x00520050,0x00530050,0x005a0057,0x005e0057,0x005c005c,0x0061005d,0x005f0059,
-0x0060005e,0x0060005d,0x005a0061,0x005b005a,0x005a005c,0x0059005f,0x00570059,0x00510058,
-0x00500053,0x00500054,0x0047004c,0x00490045,0x003f0042,0x003e0040,0x00350039,0x00310031,
-0x002a002a,0x00200023,0x00140018,0x000a0013,0x0004000b,0xfff6fffe,0xffeaffee,0xffdeffe5,
-0xffd5ffd8,0xffceffd1,0xffc0ffc3,0xffb7ffb6,0xffadffad,0xffa5ffa4,0xff9cff9f,0xff95ff9b,
-0xff8cff92,0xff88ff8a,0xff87ff89,0xff84ff84,0xff81ff82,0xff80ff7f,0xff80ff7e,0xff7dff81,
-0xff81ff7e,0xff83ff85,0xff86ff87,0xff8bff8d,0xff8cff96,0xff95ff94,0xff98ff95,0xff9dff9c,
-0xffa1ffa2,0xffabffa4,0xffb1ffac,0xffb4ffb3,0xffbcffb8,0xffc1ffbd,0xffc5ffc2,0xffc8ffc4,
-0xffc4ffc8,0xffc9ffc7,0xffc7ffc8,0xffc7ffc7,0xffc2ffc1,0xffbeffbd,0xffb1ffbb,0xffafffb9,
-0xffa9ffac,0xff9cffa7,0xff8dff9a,0xff86ff92,0xff7eff88,0xff6cff78,0xff64ff6a,0xff59ff5c,
-0xff4fff54,0xff45ff4b,0xff3cff3d,0xff35ff39,0xff2dff30,0xff29ff29,0xff21ff24,0xff22ff23,
-0xff21ff1f,0xff20ff1e,0xff25ff21,0xff24ff26,0xff2bff2c,0xff33ff30,0xff3aff37,0xff49ff41,
-0xff4fff4d,0xff5cff5a,0xff6bff6a,0xff7dff7a,0xff8dff81,0xff9cff91,0xffa6ff9f,0xffb0ffa7,
-0xffbaffb5,0xffbfffbb,0xffc2ffc2,0xffccffc6,0xffcdffcc,0xffccffcb,0xffcaffcb,0xffc8ffce,
-0xffc8ffcb,0xffc6ffc5,0xffbcffc4,0xffb8ffbc,0xffbcffbd,0xffbeffb9,0xffc4ffbe,0xffcbffc4,
-0xffd0ffc9,0xffddffd4,0xffe7ffdf,0xfff4ffef,0x0003fff6,0x00130008,0x001e0016,0x002f0024,
-0x003b0033,0x00470042,0x0055004e,0x005f0059,0x00630061,0x0065006b,0x0069006f,0x006a006e,
-0x0070006f,0x0070006b,0x0070006b,0x006e006a,0x0068006d,0x0069006c,0x006c006a,0x006d006c,
-0x0073006f,0x006e006c,0x0074006d,0x00780072,0x007b0079,0x00810081,0x00840085,0x008d0086,
-0x00900092,0x00960096,0x00a500a2,0x00a500a4,0x00ad00aa,0x00b500af,0x00b400ad,0x00b400ae,
-0x00af00b1,0x00b000ad,0x00a900b2,0x00a100aa,0x0094009a,0x008b0093,0x007f0087,0x00760076,
-0x006a006e,0x005d0062,0x004e0053,0x00450048,0x0038003e,0x00300038,0x00250030,0x0026002b,
-0x00250026,0x00240020,0x0024001f,0x00260023,0x00280029,0x002f002c,0x00350030,0x003e0033,
-0x0041003b,0x00400040,0x00410040,0x00410040,0x003e0046,0x003c0040,0x0039003d,0x00340037,
-0x002f0031,0x002b002e,0x00280028,0x001f0020,0x0018001d,0x00130018,0x00120016,0x0012000f,
-0x00110010,0x000f000e,0x000e000f,0x0014000f,0x00120013,0x00170017,0x00100016,0x00120014,
-0x00140018,0x00150014,0x00130010,0x0010000e,0x000b0008,0x0007000a,0x00050003,0xfffeffff,
-0xfff7fffa,0xfff6fff5,0xfff2fff5,0xfff2fff1,0xfff3fff2,0xffefffef,0xfff1fff1,0xfff3fff3,
-0xfff6fffa,0xfff90001,0xfffa0000,0x00070002,0x000c000a,0x00100010,0x00150015,0x00160018,
-0x001f0019,0x00200021,0x00250025,0x00280028,0x00200021,0x00260029,0x00230025,0x001f0024,
-0x0020001b,0x00140019,0x000e0011,0x00030006,0xfffdfffe,0xfff4fff9,0xfff0fff6,0xffe9ffeb,
-0xffe6ffe5,0xffe1ffe2,0xffdaffe3,0xffdaffd9,0xffd8ffd7,0xffddffd9,0xffdbffdb,0xffdaffdc,
-0xffdcffdf,0xffe4ffe4,0xffe5ffe3,0xffebffe8,0xfff0ffef,0xfff6fff3,0xfff8fff8,0xfffbfff7,
-0xfff9fff5,0xfff6fff9,0xfffbfffc,0x0000fffe,0xfffafffa,0xfffbfffb,0xfff8fff8,0xfff9fff7,
-0xfff2fff4,0xffedfff0,0xffe8ffe6,0xffe2ffe5,0xffdeffe0,0xffd5ffd9,0xffd2ffd6,0xffcaffce,
-0xffc8ffca,0xffbdffc7,0xffbbffbe,0xffbeffc0,0xffbbffbc,0xffb9ffba,0xffc2ffbc,0xffc5ffc0,
-0xffcbffc2,0xffceffc9,0xffd1ffd0,0xffd6ffd6,0xffdeffd8,0xffe3ffde,0xffe8ffe1,0xffefffe5,
-0xfff0ffec,0xfff3ffef,0xfff5fff4,0xfff7fff7,0xfff1fff2,0xffeffff4,0xffeffff3,0xffeaffed,
-0xffe9ffec,0xffe4ffe8,0xffe2ffe4,0xffdbffda,0xffd6ffd7,0xffd2ffd2,0xffc9ffca,0xffc1ffc5,
-0xffb8ffbd,0xffabffb6,0xffa9ffae,0xffa2ffa7,0xffa0ffa0,0xff9aff9b,0xff90ff94,0xff90ff92,
-0xff8fff8c,0xff87ff89,0xff84ff88,0xff85ff85,0xff89ff89,0xff89ff8b,0xff8bff89,0xff91ff8d,
-0xff9bff90,0xff9fff9d,0xffa6ffa8,0xffadffad,0xffb7ffb3,0xffc2ffbe,0xffc6ffbf,0xffcdffca,
-0xffd2ffcd,0xffdaffd5,0xffd5ffd4,0xffd4ffd5,0xffd2ffce,0xffcfffcd,0xffccffce,0xffc9ffca,
-0xffc5ffc4,0xffc3ffc3,0xffc0ffbf,0xffbaffbc,0xffbeffbc,0xffb8ffbb,0xffbfffbf,0xffc2ffc4,
-0xffc9ffc4,0xffcfffcb,0xffdaffd5,0xffe0ffde,0xffeeffe7,0xfff5fff0,0xfffdfff9,0x00040000,
-0x000c000b,0x0013000c,0x00150016,0x00170018,0x00180018,0x00140016,0x00110014,0x000c000e,
-0x0007000e,0xfffc0005,0xfff6fffe,0xfff1fff4,0xffeefff0,0xffe7ffe8,0xffe1ffe4,0xffdeffdf,
-0xffe3ffde,0xffdfffda,0xffe7ffdd,0xffebffe2,0xffedffec,0xfff7fff5,0x0001fffb,0x000c0007,
-0x00160011,0x0022001e,0x00310028,0x00400038,0x00480045,0x0053004d,0x005d0057,0x006a0060,
-0x006c006a,0x00750070,0x00750074,0x0079007c,0x00740075,0x00790079,0x00750079,0x00720076,
-0x006f0072,0x006a006c,0x00650068,0x00600063,0x005b005f,0x00580059,0x00550054,0x00530052,
-0x00500055,0x004e004f,0x004e0050,0x004d004b,0x004b004b,0x0048004a,0x0049004d,0x004d004f,
-0x004c004e,0x004f004d,0x004e004b,0x004c0049,0x004d004c,0x00480044,0x00450046,0x003f0042,
-0x003f0040,0x003b0042,0x0039003f,0x00380039,0x00340038,0x00370038,0x00370039,0x00370039,
-0x0043003e,0x004d0046,0x00540049,0x005a0057,0x00650060,0x006e0068,0x007a0075,0x0080007e,
-0x008e0087,0x0094008f,0x00980096,0x009b009a,0x009d009d,0x009a009f,0x009b00a0,0x009500a0,
-0x00910098,0x008f0097,0x0087008e,0x007c0085,0x007a007d,0x00730072,0x0069006d,0x00610064,
-0x005a005e,0x00510055,0x0049004e,0x00440047,0x003d0042,0x0031003a,0x00300032,0x0028002b,
-0x00260027,0x00200021,0x001b001b,0x00190012,0x000d000e,0x00080005,0x00040003,0xfffe0002,
-0xfffdffff,0xfff5fffa,0xfff3fff7,0xfff4fff4,0xfff5fff3,0xffecfff3,0xffeefff3,0xffeffff0,
-0xffedffec,0xffedffe9,0xffedffee,0xffeaffea,0xffedffe7,0xffeaffec,0xffebffeb,0xffecffeb,
-0xffe3ffe8,0xffe5ffe4,0xffe1ffe2,0xffdcffe1,0xffd9ffdc,0xffd0ffd0,0xffcaffcc,0xffc2ffc5,
-0xffb5ffb7,0xffaaffae,0xff9cffa1,0xff8fff92,0xff80ff85,0xff72ff7b,0xff67ff73,0xff5dff66,
-0xff53ff5c,0xff4cff52,0xff4cff4e,0xff44ff45,0xff42ff40,0xff41ff3a,0xff45ff40,0xff45ff41,
-0xff4eff43,0xff54ff47,0xff5aff53,0xff60ff5c,0xff68ff62,0xff6dff67,0xff75ff71,0xff7bff78,
-0xff85ff80,0xff84ff87,0xff88ff89,0xff8bff8a,0xff8bff8b,0xff89ff89,0xff8aff8a,0xff84ff89,
-0xff7fff81,0xff7eff7c,0xff7bff7e,0xff79ff78,0xff77ff76,0xff75ff75,0xff71ff74,0xff76ff79,
-0xff78ff7f,0xff7cff7e,0xff84ff7d,0xff86ff80,0xff86ff86,0xff8cff88,0xff91ff8f,0xff91ff93,
-0xff97ff96,0xff97ff98,0xff9dff9b,0xff9eff9a,0xff9eff9b,0xff9cff9e,0xffa0ffa2,0xffa4ffa3,
-0xffa7ffa3,0xffabffa6,0xffafffac,0xffb5ffb2,0xffbaffb7,0xffc2ffc0,0xffcbffc8,0xffd9ffd1,
-0xffe3ffdb,0xffedffe4,0xfffafff2,0x0009fffe,0x0018000c,0x00210018,0x002c0025,0x00360031,
-0x003d003a,0x00450045,0x004c004a,0x004f004d,0x00520054,0x00540056,0x00530054,0x004f0055,
-0x0048004d,0x00430047,0x003e0043,0x003a003c,0x002d0036,0x0028002e,0x0023002a,0x00200021,
-0x001b0021,0x0017001c,0x00170018,0x00190016,0x001a0016,0x00170013,0x001a0016,0x001e0018,
-0x0021001c,0x00220021,0x0023002a,0x002c002d,0x00350035,0x003c003a,0x00420043,0x004b0047,
-0x00560056,0x005d005d,0x00660062,0x006e006d,0x00760077,0x00810081,0x008e008a,0x00970097,
-0x009e009f,0x00ab00a2,0x00b200ae,0x00b800b4,0x00bb00b7,0x00ba00c1,0x00bc00bb,0x00bb00b9,
-0x00ba00b8,0x00b300b6,0x00a800b0,0x00a300a4,0x0098009d,0x00900093,0x00890087,0x007d007b,
-0x00730071,0x00670069,0x005d005c,0x00550056,0x004c0050,0x00470049,0x003d0043,0x0035003f,
-0x00310036,0x00300035,0x002b002e,0x00270029,0x0022001f,0x001d001e,0x00190018,0x00120012,
-0x000c000f,0x0006000a,0x00010007,0xfffcffff,0xfff6fff6,0xffefffed,0xffe7ffe9,0xffe2ffe5,
-0xffe0ffe1,0xffe1ffdc,0xffdbffd9,0xffdbffd9,0xffdeffda,0xffe0ffde,0xffe1ffde,0xffe1ffe7,
-0xffe7ffe8,0xffebffe9,0xfff0fff1,0xfff6fff4,0xfffdfff8,0xfffffffc,0xfffbfffc,0x0000fffd,
-0xfffffffd,0xfffdffff,0xfffffffd,0xfff9ffff,0xfff8fffe,0xfffbfffa,0xfffcfffc,0xfffafffc,
-0xfffafffc,0xfffafffb,0xfffafffc,0xfffbfffb,0xfff9fffd,0xfffafffe,0xfff9fff9,0xfff9fff9,
-0xfffafffc,0xfffafff3,0xfff6fff4,0xfff5fff1,0xfff4fff1,0xffefffed,0xffe8ffeb,0xffeaffe8,
-0xffe4ffea,0xffdfffe1,0xffdfffe4,0xffdeffde,0xffe1ffdf,0xffddffdd,0xffdeffdc,0xffd9ffd8,
-0xffd8ffd8,0xffddffd9,0xffddffd9,0xffd9ffd9,0xffd8ffda,0xffd6ffd5,0xffdaffda,0xffd9ffd8,
-0xffd6ffda,0xffd8ffda,0xffd6ffda,0xffd6ffdb,0xffd9ffdf,0xffd7ffdd,0xffdbffdc,0xffd9ffde,
-0xffd7ffd8,0xffd2ffd4,0xffd2ffd1,0xffccffcd,0xffcbffcd,0xffcbffc9,0xffc5ffc2,0xffc4ffc3,
-0xffc2ffc1,0xffc0ffc3,0xffbeffc2,0xffc1ffbf,0xffbfffc1,0xffc3ffc3,0xffc8ffc5,0xffc8ffcd,
-0xffcfffd1,0xffd6ffd3,0xffdaffd3,0xffdcffd3,0xffdcffd9,0xffdeffdf,0xffe2ffdf,0xffe5ffe0,
-0xffe4ffe5,0xffe1ffe1,0xffdfffe2,0xffe3ffe2,0xffe2ffe3,0xffe1ffe2,0xffe4ffe5,0xffeaffe6,
-0xffe6ffe5,0xffeaffe6,0xffe6ffe7,0xffecffeb,0xffeffff1,0xfff3fff2,0xfff3fff3,0xfff7fff6,
-0xfffafff4,0xfffbfff4,0xfff8fff3,0xfff7fff6,0xfff7fff0,0xfff2fff2,0xffedfff1,0xffeaffec,
-0xffe7ffe4,0xffe6ffe3,0xffe0ffe0,0xffd9ffdc,0xffd4ffd7,0xffd1ffd5,0xffceffd0,0xffc9ffcd,
-0xffcbffcb,0xffcfffcf,0xffceffce,0xffcdffcb,0xffceffd0,0xffd2ffd2,0xffd5ffd4,0xffd7ffd7,
-0xffdaffdb,0xffdcffdd,0xffdeffe3,0xffe1ffe5,0xffe4ffe4,0xffe7ffe6,0xffe8ffe8,0xfff1ffeb,
-0xffedffec,0xfff2ffeb,0xffeffff2,0xfff0fff4,0xffeffff3,0xfff8fff2,0xfff7fff9,0xfff5fff3,
-0xfff9fff7,0xfff5fff5,0xfffafffa,0xfffafffa,0x0001fff8,0x0000fffb,0x0003ffff,0x000c0002,
-0x000f000b,0x00150010,0x00140016,0x001c0019,0x001e001b,0x0025001f,0x00290028,0x002b0026,
-0x00320031,0x00350033,0x0034003a,0x00330035,0x00340039,0x00370035,0x00380035,0x00370035,
-0x00360037,0x00350032,0x0034002f,0x0031002c,0x002a0029,0x00290028,0x00240026,0x00240027,
-0x00230025,0x00230026,0x00290027,0x002a0028,0x002d0029,0x0031002d,0x00340033,0x00380036,
-0x003b0038,0x003c0040,0x0043003f,0x00400041,0x00410042,0x0040003e,0x003f003d,0x003f0043,
-0x003b003f,0x00370038,0x00360033,0x00300032,0x002e0030,0x002c002d,0x002a002c,0x00270028,
-0x002a002b,0x002a0027,0x002f002c,0x00340032,0x00360036,0x003e003b,0x004a0048,0x004f004b,
-0x0050004c,0x005b0054,0x0062005f,0x006a0064,0x0069006a,0x0069006d,0x006c006f,0x006c0072,
-0x006e0074,0x00700074,0x006a0072,0x006a006f,0x006d006b,0x00660068,0x005d005e,0x0057005b,
-0x004f0054,0x00510052,0x004b004b,0x00460047,0x003e0041,0x003d0042,0x0039003b,0x0037003a,
-0x00320032,0x002c002b,0x002a0028,0x00240028,0x00200021,0x0021001e,0x00240022,0x00210022,
-0x00240023,0x00240024,0x002a0029,0x002f002d,0x00380030,0x00330034,0x0034003a,0x003a0038,
-0x003d003e,0x00370037,0x003b003a,0x00360035,0x00320032,0x0028002d,0x001c0020,0x000e0015,
-0x0002000b,0xfff4fffe,0xffe5ffee,0xffd5ffde,0xffc6ffd1,0xffb9ffbf,0xffabffb3,0xff9fffaa,
-0xff92ff98,0xff8cff8f,0xff7fff86,0xff7bff7d,0xff79ff75,0xff73ff74,0xff74ff75,0xff76ff74,
-0xff76ff76,0xff7cff79,0xff7bff7e,0xff80ff81,0xff88ff87,0xff8dff88,0xff8fff89,0xff92ff8f,
-0xff92ff93,0xff91ff93,0xff90ff93,0xff93ff93,0xff90ff8f,0xff8bff8d,0xff8aff8d,0xff8aff8a,
-0xff89ff87,0xff8bff88,0xff86ff84,0xff88ff86,0xff87ff8a,0xff86ff87,0xff8cff89,0xff8bff8d,
-0xff8cff8d,0xff8dff8e,0xff92ff90,0xff93ff95,0xff9aff96,0xff98ff96,0xff9aff96,0xff9bff96,
-0xff94ff95,0xff95ff95,0xff98ff95,0xff92ff94,0xff8fff8d,0xff8cff8c,0xff8cff8b,0xff8bff8c,
-0xff86ff89,0xff85ff84,0xff83ff84,0xff85ff84,0xff84ff86,0xff8cff88,0xff8aff88,0xff8aff89,
-0xff8dff8f,0xff93ff92,0xff97ff99,0xff9cff9e,0xff9eff9f,0xffa3ffa3,0xffa5ffa7,0xffacffad,
-0xffb4ffb4,0xffbbffbb,0xffc1ffbd,0xffcdffc3,0xffd4ffcc,0xffd8ffd1,0xffdeffdb,0xffe9ffe2,
-0xfff3ffeb,0xfffbfff6,0x00030001,0x00070006,0x00110011,0x00150016,0x001c001c,0x00220023,
-0x00240026,0x00280027,0x002d0029,0x002f002a,0x0030002c,0x002d002a,0x002b0026,0x002a0028,
-0x00240027,0x00240024,0x001f001d,0x001e001c,0x001b001d,0x001a001f,0x001b001e,0x001b001b,
-0x001d001c,0x001c001c,0x00270024,0x002c0027,0x002d002d,0x00360034,0x003c0035,0x0043003c,
-0x004b0045,0x0052004c,0x005a0055,0x00630064,0x0070006c,0x00740075,0x007b0079,0x0083007e,
-0x00800085,0x00870083,0x00860085,0x00880086,0x00860089,0x00830088,0x00800083,0x007f0085,
-0x007f007b,0x00790077,0x0070006d,0x006b006a,0x00600063,0x0059005c,0x00530055,0x004c0051,
-0x004a004d,0x003f0048,0x00400042,0x0041003d,0x003f003e,0x003d003e,0x003d003f,0x0045003f,
-0x00450042,0x00470047,0x004f004b,0x0050004f,0x00580052,0x0058005a,0x005c005b,0x005c0060,
-0x005e005a,0x0063005d,0x00650065,0x00690065,0x00600066,0x005f005f,0x00620062,0x005f0060,
-0x005e005e,0x0059005f,0x005b0059,0x00590059,0x005b005a,0x0057005b,0x00530052,0x00520055,
-0x00520051,0x00500053,0x00520053,0x00570053,0x00540057,0x00560052,0x00560056,0x00550053,
-0x00500051,0x004d004e,0x0049004a,0x00490047,0x00410042,0x003c003e,0x00320035,0x0027002d,
-0x001d0023,0x00110019,0x0001000e,0xfff70000,0xffebfff3,0xffddffe5,0xffd3ffd8,0xffcbffce,
-0xffc3ffc3,0xffb9ffbb,0xffacffad,0xffa6ffa8,0xff9fffa3,0xff9dff9b,0xff9bff97,0xff9aff98,
-0xff96ff9a,0xff9aff9d,0xff9effa0,0xffa3ff9f,0xffa5ffa6,0xffacffaa,0xffb3ffb1,0xffb9ffb4,
-0xffbeffbf,0xffc0ffc0,0xffc7ffc8,0xffd1ffcd,0xffd1ffcf,0xffd4ffd2,0xffd2ffd1,0xffd8ffd5,
-0xffd7ffd5,0xffd9ffd4,0xffd7ffd6,0xffd5ffd4,0xffd3ffd3,0xffd0ffd0,0xffccffcd,0xffccffcc,
-0xffc9ffc6,0xffc3ffc7,0xffc0ffc3,0xffbdffbf,0xffb8ffbb,0xffb6ffb6,0xffb7ffb7,0xffb6ffb7,
-0xffb4ffb3,0xffb2ffb5,0xffb0ffaf,0xffb3ffb5,0xffbbffb9,0xffbdffbc,0xffc5ffbe,0xffc6ffc4,
-0xffcdffca,0xffd9ffd2,0xffe3ffd9,0xffe9ffe2,0xffefffe9,0xfff3fff2,0xfff9fff4,0xfffcfffa,
-0x0001fffe,0x00040003,0x00060000,0x00070004,0x00060005,0x00010003,0xfffefffc,0xfff8fffa,
-0xffeffff2,0xffedffed,0xffe4ffe9,0xffe2ffe9,0xffe1ffe3,0xffdfffe3,0xffe2ffe4,0xffdeffe5,
-0xffe3ffe8,0xffe7ffe8,0xffebffe5,0xfff0ffed,0xfff0fff2,0xfff4fff7,0xfff7fff4,0xfffafff7,
-0xfff8fffb,0xfff5fff8,0xfff6fff5,0xfff2fff3,0xffebffec,0xffe3ffe8,0xffd6ffde,0xffcdffd5,
-0xffc5ffca,0xffc0ffc1,0xffbaffba,0xffadffb4,0xffa6ffa9,0xffa2ffa0,0xff98ff9a,0xff95ff9a,
-0xff95ff94,0xff92ff94,0xff95ff95,0xff97ff92,0xff99ff97,0xffa0ffa0,0xffacffa8,0xffb2ffb1,
-0xffbbffb8,0xffc4ffc0,0xffceffca,0xffdbffd4,0xffe8ffe1,0xfff1ffe9,0xfffbfff3,0xfffffffe,
-0x000b0006,0x0011000d,0x00170012,0x001c0019,0x001f001d,0x001f001f,0x00230020,0x0022001d,
-0x0022001d,0x0021001c,0x0020001d,0x001b001b,0x00130017,0x00110016,0x000f0010,0x0008000c,
-0x00050006,0xffff0002,0xfff80001,0xfff5fffb,0xfff4fff4,0xfff1ffef,0xffedffee,0xffeaffe9,
-0xffe8ffe4,0xffe8ffe2,0xffe3ffdc,0xffddffe0,0xffdfffe2,0xffe3ffe1,0xffe6ffe3,0xffe5ffe6,
-0xffe7ffe9,0xffeffff0,0xfff2fff0,0xfff8fff6,0x0001fff9,0x00040003,0x000a0007,0x000e000d,
-0x001a0012,0x001f0015,0x00260022,0x00240025,0x002e002b,0x002e002d,0x002f0033,0x002d0032,
-0x002d0032,0x002d0032,0x002e0035,0x002a002f,0x002b002a,0x002a0028,0x00290022,0x00280025,
-0x00280023,0x00220023,0x00280021,0x0028002b,0x0029002c,0x0032002b,0x002f002e,0x00370034,
-0x0038003e,0x00400040,0x00400041,0x00480042,0x00490049,0x0050004d,0x00500053,0x00540051,
-0x00520054,0x00540052,0x00530050,0x00520052,0x004c0050,0x004d004e,0x004b004b,0x00490050,
-0x00460045,0x00460045,0x00450045,0x00430044,0x003f003f,0x0042003f,0x003e003e,0x003f0043,
-0x00440043,0x0049004a,0x00500048,0x00540052,0x005b0055,0x005f0056,0x0067005e,0x006a0064,
-0x0070006b,0x00750072,0x00790078,0x007b007d,0x0081007d,0x00800080,0x007f007f,0x007f0081,
-0x007b007a,0x00780077,0x00710077,0x0069006f,0x00620068,0x005d0060,0x0057005a,0x004f0053,
-0x00450049,0x00410041,0x00300037,0x0027002b,0x00200028,0x00180024,0x00120019,0x00100016,
-0x00070010,0x00040005,0x00030007,0x00000001,0xfffdfffc,0xfffdffff,0xfffffffb,0xfffafffb,
-0xfff6fff7,0xfff5fff7,0xfff6fff5,0xfff2fff4,0xfff1fff1,0xffefffef,0xfff0ffeb,0xffebffea,
-0xffedffea,0xffe3ffe4,0xffdfffe2,0xffddffe2,0xffd8ffdd,0xffd3ffd9,0xffd4ffd7,0xffcfffd1,
-0xffceffce,0xffceffcd,0xffceffcf,0xffd0ffd0,0xffcfffd0,0xffcfffd1,0xffd2ffce,0xffdaffd5,
-0xffddffda,0xffdaffd8,0xffddffdc,0xffddffdb,0xffe0ffdc,0xffdcffe0,0xffd4ffd9,0xffd2ffd5,
-0xffcdffd6,0xffccffcc,0xffc4ffc5,0xffbeffbe,0xffafffb5,0xffa9ffaa,0xffa3ffa3,0xff9bff9b,
-0xff90ff8f,0xff86ff85,0xff7eff81,0xff7aff7b,0xff70ff77,0xff6aff72,0xff6eff70,0xff69ff72,
-0xff6bff70,0xff6fff6e,0xff75ff74,0xff79ff78,0xff7fff80,0xff83ff84,0xff8aff88,0xff8eff8d,
-0xff98ff94,0xff95ff98,0xffa0ff9a,0xffabffa3,0xffafffab,0xffb6ffb0,0xffbaffba,0xffbeffbd,
-0xffc5ffc1,0xffc7ffc5,0xffc9ffc4,0xffc8ffcc,0xffc7ffcb,0xffc4ffc8,0xffc7ffc7,0xffc4ffc3,
-0xffbeffbf,0xffb9ffbe,0xffb3ffb3,0xffafffb1,0xffa7ffab,0xff9affa8,0xff98ff9f,0xff91ff97,
-0xff8bff93,0xff8cff8e,0xff87ff89,0xff87ff85,0xff83ff82,0xff82ff82,0xff82ff84,0xff8bff86,
-0xff89ff88,0xff8bff85,0xff92ff91,0xff96ff98,0xff9aff98,0xffa5ff9c,0xffa9ffa2,0xffacffad,
-0xffb2ffad,0xffbbffb9,0xffc7ffc2,0xffcfffca,0xffd6ffd7,0xffe1ffe0,0xffeeffea,0xfff4fff0,
-0x0002fffb,0x000d0003,0x0010000e,0x001e0015,0x00260020,0x00290026,0x00360033,0x003c003d,
-0x0040003f,0x004a0045,0x004d004a,0x0050004f,0x00530053,0x005a0058,0x005d005c,0x00650060,
-0x00670065,0x006b006a,0x006e006a,0x006d006d,0x0071006f,0x00700074,0x00730075,0x00770074,
-0x00730077,0x00720071,0x00720072,0x00710071,0x00710075,0x006c006f,0x006d006e,0x006d006c,
-0x006a0066,0x00650065,0x00670062,0x00630063,0x005e005e,0x0060005d,0x005d005a,0x005e005a,
-0x00610059,0x005f005c,0x00600060,0x0065005e,0x00620064,0x00620061,0x005f0061,0x00640065,
-0x006a0069,0x006a0068,0x006c0072,0x00710070,0x00740071,0x00760071,0x00750073,0x007a0077,
-0x007b007b,0x00790079,0x007a0079,0x0075007a,0x00760072,0x00700070,0x006b006a,0x00630066,
-0x005c005d,0x00590058,0x00490051,0x003f0044,0x0036003b,0x002f0034,0x00200028,0x0014001b,
-0x000a000e,0x00030006,0xfff8ffff,0xfff1fff7,0xffeffff0,0xffecffee,0xffeaffec,0xffebffe8,
-0xffeaffe7,0xffedffed,0xffedffea,0xfff3ffee,0xfff6fff3,0xfffffff6,0x00010001,0x0005000a,
-0x00080009,0x000a0009,0x00100011,0x00130011,0x00130014,0x00160013,0x001a0016,0x001c0018,
-0x001b0019,0x00180017,0x00170016,0x00110016,0x000f0012,0x000e000f,0x000b000c,0x00050008,
-0xfffc0004,0xfffcfffd,0xfffbfff6,0xfff7fffa,0xfff4fff6,0xfff0fff5,0xfff1fff1,0xffeefff2,
-0xffefffef,0xffeeffec,0xffeeffeb,0xffefffeb,0xffeeffed,0xfff0fff1,0xffeffff0,0xffebfff0,
-0xffedfff0,0xffebffed,0xffe6ffea,0xffe2ffe5,0xffddffe2,0xffd4ffda,0xffcdffd6,0xffc6ffcb,
-0xffbcffc6,0xffb3ffbc,0xffa9ffb2,0xffa3ffa9,0xff9effa3,0xff95ff9a,0xff8fff91,0xff8cff8d,
-0xff87ff8b,0xff88ff88,0xff8aff82,0xff8eff8c,0xff93ff8f,0xffa1ff93,0xffa8ffa0,0xffb5ffad,
-0xffbeffb5,0xffcbffc4,0xffd5ffd0,0xffdfffdb,0xffeeffe9,0xfff7fff0,0xfffffff9,0x00040002,
-0x0009000c,0x000a000c,0x000f000e,0x00100010,0x000d000b,0x0009000a,0x00020008,0x00000000,
-0xfffa0001,0xfff6fff8,0xfff2fff1,0xffecffed,0xffe5ffe8,0xffe4ffe2,0xffd8ffdc,0xffd5ffd4,
-0xffcfffcb,0xffd0ffc9,0xffcdffca,0xffcbffc8,0xffcdffc6,0xffcdffc9,0xffd0ffce,0xffd0ffd0,
-0xffd5ffd2,0xffd9ffd7,0xffe3ffdf,0xffe8ffe6,0xffebffed,0xfff6fff3,0xfffffffd,0x00030003,
-0x000a0005,0x000f0009,0x0015000e,0x00130011,0x00140012,0x00170015,0x00190018,0x00130015,
-0x00110014,0x000d0010,0x000a000c,0x00040007,0x00050000,0xfffefffc,0xfff1fff6,0xffeefff2,
-0xffeaffee,0xffe0ffe6,0xffddffe0,0xffd7ffde,0xffd3ffd5,0xffccffce,0xffcaffcb,0xffcaffc8,
-0xffc4ffc5,0xffc0ffc2,0xffbaffbf,0xffb9ffbb,0xffbbffbb,0xffb9ffbd,0xffb9ffb7,0xffbbffba,
-0xffbbffb9,0xffbaffbb,0xffbcffb7,0xffbeffbc,0xffbdffbb,0xffc2ffbf,0xffbfffc0,0xffbbffbe,
-0xffbdffbe,0xffbfffbe,0xffbdffbe,0xffbcffbd,0xffbbffbb,0xffbfffbf,0xffbfffc1,0xffc5ffc4,
-0xffc8ffc6,0xffd0ffca,0xffd6ffd1,0xffd5ffd2,0xffe2ffd8,0xffecffe3,0xfff3ffe7,0xfffafff4,
-0x0001ffff,0x000a0008,0x00120011,0x001b0019,0x0023001e,0x00280027,0x0030002d,0x002e002c,
-0x00310032,0x002f002e,0x002a002c,0x0029002a,0x00260028,0x00210024,0x001e0021,0x001b001b,
-0x00170014,0x00120013,0x000d0013,0x000b000e,0x000d000c,0x000c000c,0x0012000d,0x00170017,
-0x00180014,0x001d0017,0x0021001e,0x00290024,0x0031002b,0x00370035,0x003d003b,0x00410044,
-0x00490048,0x0051004f,0x00550050,0x00580055,0x0058005c,0x0057005b,0x005a005b,0x0057005b,
-0x0057005a,0x00560056,0x00560053,0x0050004f,0x004b004f,0x004b004a,0x00480046,0x00440049,
-0x0048004a,0x00460047,0x00460043,0x00430042,0x00480044,0x00470048,0x004a004d,0x0046004e,
-0x004b0049,0x004a004d,0x004c004b,0x004f004f,0x004b004f,0x0050004a,0x004b004d,0x00490046,
-0x00450045,0x003f003f,0x003c003d,0x003c003a,0x003a003d,0x0037003a,0x002f0034,0x002f0031,
-0x002d002f,0x002b002d,0x002d002f,0x0032002f,0x0035002f,0x0034002e,0x00330035,0x00390038,
-0x003f003c,0x0043003d,0x00430044,0x00450046,0x004b0047,0x00460047,0x00430047,0x00430042,
-0x0040003f,0x003e003c,0x00390039,0x00340039,0x00370036,0x00320035,0x00310034,0x002f0032,
-0x002e002e,0x0029002c,0x0029002a,0x0029002a,0x00270023,0x00270026,0x00230023,0x00260024,
-0x00230024,0x0022001f,0x0023001e,0x0022001f,0x001e001f,0x0019001c,0x00140016,0x00110012,
-0x000d0012,0x000e000b,0x0008000d,0x00030005,0xffff0002,0xffff0000,0xfff3fff6,0xffeefff0,
-0xffe7ffec,0xffdbffe4,0xffd9ffdd,0xffd0ffd8,0xffc3ffca,0xffc1ffc2,0xffbcffbc,0xffb3ffb4,
-0xffb1ffb5,0xffacffad,0xffabffaa,0xffa4ffaa,0xffaaffaf,0xffa8ffa9,0xffa8ffa9,0xffa6ffab,
-0xffabffa9,0xffacffaa,0xffacffa7,0xffafffa7,0xffabffa9,0xffaaffab,0xffa5ffae,0xffa6ffa7,
-0xffa5ffa9,0xffa4ffa0,0xff9fff9c,0xff9aff99,0xff97ff97,0xff97ff96,0xff90ff97,0xff90ff92,
-0xff8fff93,0xff8cff8f,0xff90ff91,0xff8eff8f,0xff8aff8b,0xff89ff88,0xff87ff8b,0xff84ff81,
-0xff7fff7d,0xff7fff7c,0xff7dff7c,0xff78ff7c,0xff76ff7c,0xff70ff76,0xff71ff75,0xff70ff6f,
-0xff6eff71,0xff6fff6d,0xff72ff6f,0xff78ff72,0xff76ff75,0xff7fff79,0xff85ff7f,0xff87ff85,
-0xff90ff8d,0xff99ff96,0xffa2ff9e,0xffa8ffa4,0xffb3ffae,0xffb9ffb5,0xffbbffbc,0xffc6ffc5,
-0xffceffc8,0xffd5ffcf,0xffdbffd7,0xffe3ffdf,0xffe8ffe4,0xfff0ffec,0xfff4fff2,0xfff9fff8,
-0xfffffffa,0x00040003,0x00040003,0x00050006,0x000c0009,0x0009000c,0x000c000a,0x000a000e,
-0x000a0009,0x00040007,0xffff0004,0xfffefffc,0xfff8fff5,0xfff0fff7,0xffebffed,0xffe8ffeb,
-0xffe3ffe3,0xffe0ffe3,0xffdcffe0,0xffdbffde,0xffdfffe0,0xffe7ffe2,0xffebffe8,0xfff4ffee,
-0xfffbfff7,0x00020000,0x00110006,0x001a0010,0x0025001c,0x002f0028,0x003e0036,0x00470043,
-0x00500050,0x005c0057,0x00610062,0x006a0069,0x00710070,0x00760073,0x00790077,0x007a0079,
-0x007d007a,0x0079007a,0x007e0079,0x007b0076,0x007e0079,0x00760077,0x00730073,0x006c0071,
-0x0069006b,0x0068006a,0x00630068,0x00680069,0x006b006b,0x006b006a,0x006c006b,0x006c006d,
-0x00700071,0x0075006e,0x00780074,0x00760071,0x00730074,0x00710075,0x00750072,0x00710071,
-0x006a0073,0x0066006e,0x00620069,0x00620065,0x0058005e,0x00530058,0x004f0050,0x0046004a,
-0x003f0044,0x003b003a,0x00370037,0x002d0032,0x0027002b,0x0024002a,0x00240025,0x00230024,
-0x00210021,0x00220021,0x0026001f,0x00280020,0x00270023,0x00250028,0x002c0026,0x002f002c,
-0x002f0030,0x00330033,0x00300036,0x002f0034,0x002d0036,0x002a0031,0x0029002b,0x002a0028,
-0x00240025,0x001d0021,0x001b001e,0x00160015,0x000c0013,0x000f000d,0x000b0007,0x00040003,
-0x00000000,0xfffffffd,0xfff7fff9,0xfff3fff5,0xffedfff0,0xffebffe8,0xffe4ffe6,0xffe1ffe1,
-0xffdbffe1,0xffd8ffde,0xffd3ffd8,0xffd2ffd2,0xffcaffcf,0xffcbffca,0xffc9ffc8,0xffc3ffc4,
-0xffc2ffc3,0xffc4ffc4,0xffc5ffc6,0xffccffc6,0xffceffcb,0xffd1ffd1,0xffd7ffd5,0xffdfffda,
-0xffe1ffdf,0xffe7ffe2,0xffebffe7,0xffedffeb,0xffefffee,0xffedffee,0xfff1fff0,0xfff2fff7,
-0xfff2fff6,0xfff5fff3,0xfff8fff7,0xfff7fff3,0xfff3fff5,0xfff6fff5,0xfff6fff3,0xfff3fff9,
-0xfff5fff3,0xfff8fff4,0xfff7fff4,0xfff7fff8,0xfff3fff5,0xfff3fff5,0xfff4fff7,0xfff3fff5,
-0xfff5fff4,0xffeefff4,0xfff1ffef,0xffedfff0,0xffefffeb,0xffebffe8,0xffeaffe7,0xffe5ffe3,
-0xffe4ffe2,0xffddffe1,0xffd9ffdd,0xffd8ffda,0xffd6ffd6,0xffcfffd4,0xffc8ffd1,0xffc8ffcd,
-0xffc3ffc6,0xffc1ffc1,0xffbdffbe,0xffbdffbb,0xffb8ffba,0xffb3ffb5,0xffb4ffb7,0xffb6ffba,
-0xffb7ffb9,0xffb9ffbd,0xffc2ffba,0xffc6ffc2,0xffc6ffc5,0xffd0ffc7,0xffd5ffcf,0xffdaffd3,
-0xffe6ffde,0xffeaffe8,0xfff4fff3,0xfffafffb,0x0003ffff,0x000b0004,0x0012000e,0x00130015,
-0x0018001c,0x001b001d,0x001e001e,0x001e001e,0x001e001d,0x001a0019,0x00140015,0x000e0012,
-0x0008000b,0x00010005,0xfffe0000,0xfff4fff5,0xffedfff0,0xffe4ffe8,0xffe1ffe2,0xffd8ffda,
-0xffd6ffd2,0xffc8ffcf,0xffc5ffc6,0xffbfffc7,0xffbdffc4,0xffb6ffbf,0xffb8ffbc,0xffbfffbd,
-0xffbdffc2,0xffc5ffc4,0xffcbffca,0xffd3ffcf,0xffdbffd6,0xffe3ffd9,0xffe9ffe5,0xffefffee,
-0xfff8fff8,0x0000fffe,0x00050004,0x0009000a,0x000e000b,0x0010000e,0x00110012,0x0011000f,
-0x0010000f,0x0009000e,0x0009000c,0x00070007,0x00020000,0xfff6fff8,0xfff7fff5,0xfff3fff0,
-0xffefffed,0xffe9ffe8,0xffe1ffe2,0xffdeffdd,0xffd9ffdd,0xffd8ffd7,0xffd5ffd2,0xffccffce,
-0xffcaffc9,0xffc5ffc7,0xffc8ffc5,0xffc1ffc4,0xffbeffbc,0xffbbffbe,0xffbcffbd,0xffb9ffbe,
-0xffb9ffc0,0xffbeffbe,0xffbdffc1,0xffc1ffc5,0xffc7ffc9,0xffccffce,0xffd1ffd2,0xffd7ffd9,
-0xffdfffe0,0xffe6ffe4,0xffe9ffec,0xfff3fff2,0xfff8fff6,0x0000fffb,0x00050001,0x000c000b,
-0x0011000e,0x00180011,0x001e001a,0x00210023,0x00270021,0x0032002a,0x00300031,0x00330030,
-0x00350032,0x00350036,0x00350035,0x00360037,0x00380038,0x00390036,0x00390036,0x00350036,
-0x002f0035,0x00300033,0x002f0033,0x002f0032,0x002d0032,0x002e0032,0x002e002c,0x002e002d,
-0x0032002e,0x002e002e,0x0031002f,0x0032002e,0x0030002e,0x0034002e,0x0034002f,0x00300030,
-0x00340032,0x00300032,0x0035002e,0x00380032,0x00390032,0x00380036,0x00400040,0x003f0046,
-0x00470046,0x004e004d,0x00510050,0x00580059,0x0061005d,0x00690062,0x006f006e,0x00750073,
-0x007c0076,0x0083007b,0x00820080,0x00830080,0x0085007e,0x00840081,0x0081007e,0x00810080,
-0x00790078,0x00770074,0x006c0071,0x00650068,0x00600061,0x0058005b,0x00580059,0x00540057,
-0x00500052,0x004b0051,0x0048004b,0x00470048,0x00460044,0x00420043,0x00430044,0x00410041,
-0x003e0039,0x003c003b,0x00350037,0x002f0031,0x0028002c,0x0022002a,0x001c0025,0x0019001e,
-0x00100013,0x000a000c,0x00030003,0xfffffffb,0xfff7fff6,0xfff1fff2,0xfff3ffef,0xffecffef,
-0xffe8ffea,0xffe6ffed,0xffe7ffeb,0xffeeffee,0xfff1fff2,0xfff4fff4,0xfffbfff7,0x0000fffb,
-0xfffffffb,0x0004fffe,0x00090006,0x000b000b,0x000d000a,0x000c000e,0x00110012,0x00120010,
-0x000b0011,0x00050007,0x00000003,0xfffbffff,0xfff4fffb,0xffe8ffee,0xffe0ffe3,0xffd6ffd9,
-0xffcdffd1,0xffc0ffc6,0xffb8ffb8,0xffacffb0,0xffa4ffa5,0xff96ff9e,0xff8eff95,0xff85ff8c,
-0xff7eff86,0xff78ff7f,0xff79ff7c,0xff78ff7a,0xff78ff7b,0xff77ff76,0xff79ff7a,0xff7fff78,
-0xff7dff79,0xff7eff7c,0xff80ff7f,0xff84ff86,0xff8aff89,0xff8fff8d,0xff91ff8d,0xff95ff93,
-0xff96ff94,0xff99ff99,0xff96ff98,0xff98ff99,0xff9cff9a,0xff9dff9a,0xff9aff99,0xff97ff9a,
-0xff99ff98,0xff9dff99,0xff96ff9a,0xff92ff94,0xff92ff94,0xff95ff93,0xff92ff91,0xff92ff94,
-0xff98ff96,0xff99ff97,0xff9eff9c,0xffa0ff9a,0xffa6ff9f,0xffabffab,0xffaeffac,0xffb0ffb2,
-0xffb5ffb4,0xffbaffb8,0xffbeffbc,0xffc5ffc5,0xffc4ffc7,0xffc7ffc8,0xffc3ffc8,0xffc6ffc6,
-0xffc7ffc9,0xffc7ffc9,0xffc6ffc8,0xffc5ffc7,0xffc5ffc4,0xffc3ffc2,0xffcbffc3,0xffc3ffc0,
-0xffc1ffc0,0xffc1ffc5,0xffc2ffc4,0xffc5ffc5,0xffcbffc6,0xffd2ffcf,0xffd3ffd7,0xffdfffdc,
-0xffebffe6,0xfff1ffeb,0xfff9fff7,0x00070002,0x0010000e,0x001b0018,0x00280021,0x002d002a,
-0x003b0037,0x0045003b,0x00490048,0x00530050,0x00580052,0x005f005d,0x0061005f,0x00650061,
-0x00650065,0x00650065,0x00670066,0x00690069,0x00630067,0x00640067,0x005c0063,0x005b0061,
-0x0054005e,0x0057005b,0x004e0057,0x0049004d,0x00420044,0x0039003f,0x00370038,0x002c0035,
-0x0029002d,0x00230028,0x001d001e,0x0022001a,0x001a001c,0x00170019,0x00160017,0x0016001a,
-0x001c001c,0x0021001b,0x0024001d,0x00290022,0x0030002e,0x0032002f,0x00380031,0x003f0037,
-0x00460042,0x004b0047,0x0053004d,0x00540051,0x00580053,0x005f005b,0x00630060,0x00680065,
-0x0069006a,0x006e0068,0x006d0070,0x006e0070,0x00730071,0x00710075,0x00700072,0x00740072,
-0x00730074,0x006f006e,0x006b006f,0x0064006a,0x00640069,0x005f0065,0x005c005e,0x0057005a,
-0x00550055,0x004c0050,0x00470048,0x003e0043,0x00390040,0x003a0037,0x002f0034,0x002e002d,
-0x00280026,0x00230025,0x001a001d,0x00160016,0x000c0017,0x0005000d,0x00040009,0xfffe0003,
-0xfff6fff7,0xfff2fff5,0xffebfff2,0xffe8fff0,0xffe8ffeb,0xffe5ffe5,0xffe1ffe1,0xffdcffe1,
-0xffdfffdd,0xffdeffe0,0xffddffe0,0xffe3ffe2,0xffe6ffe5,0xffe9ffe8,0xfff1ffec,0xfff3fff1,
-0xfff9fff3,0xfffffffc,0x00030000,0x00050002,0x00090007,0x000b000c,0x000a000d,0x0006000a,
-0x00050004,0xffff0000,0xfff8fffc,0xfff2fff8,0xffeafff1,0xffe1ffe8,0xffd9ffe3,0xffd2ffd9,
-0xffc7ffca,0xffbfffc4,0xffb8ffbb,0xffafffb6,0xffabffab,0xffacffab,0xffa2ffa4,0xffa1ff9d,
-0xffa2ff9d,0xff9fffa1,0xffa1ffa1,0xffa5ffa2,0xffa5ffa4,0xffafffac,0xffb5ffb1,0xffb9ffb5,
-0xffc3ffc0,0xffcaffc5,0xffd2ffd0,0xffe1ffd9,0xffe8ffe6,0xffebffec,0xfff5fff2,0xfffbfff9,
-0xfffbfffd,0x0003fffe,0x00060000,0x00080008,0x000d0009,0x000b000b,0x00090009,0x000c000a,
-0x000b000e,0x000a0009,0x000b000b,0x0008000d,0x0009000c,0x000a0010,0x000c0011,0x000f000e,
-0x0010000e,0x0011000e,0x0010000e,0x000e000c,0x000e000b,0x000b000b,0x00060009,0x00020008,
-0xfffb0002,0xfffafffd,0xfff3fff4,0xffecffed,0xffe6ffea,0xffdbffe2,0xffd6ffdb,0xffd4ffd6,
-0xffcaffd0,0xffcaffc9,0xffc9ffca,0xffc3ffc4,0xffc6ffc8,0xffc2ffc4,0xffcaffc9,0xffccffca,
-0xffcfffce,0xffd5ffd1,0xffdbffd3,0xffe0ffde,0xffe2ffe4,0xffe8ffe4,0xffedffee,0xfff5fff1,
-0xfff7fff1,0xfff8fff7,0xfffbfffb,0xfffefffc,0x00010003,0x000c0003,0x000b000c,0x000f000d,
-0x00140010,0x00190012,0x001e0019,0x001d001c,0x001d001d,0x0020001f,0x00200022,0x00230025,
-0x00200020,0x0018001a,0x00140019,0x000b0013,0x000a000e,0x00010005,0xfff6fffa,0xffeeffee,
-0xffe9ffea,0xffdfffe1,0xffd2ffd9,0xffcbffce,0xffc7ffc7,0xffc1ffc2,0xffbcffbc,0xffb8ffb9,
-0xffb8ffb8,0xffb6ffb6,0xffb9ffb7,0xffbdffbd,0xffbdffbb,0xffc3ffbd,0xffc7ffc4,0xffc6ffc8,
-0xffceffcb,0xffceffcf,0xffcfffd0,0xffd1ffd1,0xffd5ffd2,0xffd6ffd6,0xffd4ffd7,0xffd3ffd6,
-0xffd6ffd5,0xffd5ffd5,0xffd9ffd1,0xffd8ffd4,0xffd8ffd5,0xffd9ffda,0xffdfffd9,0xffe7ffe0,
-0xffe1ffe3,0xffe5ffe8,0xffe8ffeb,0xffebfff0,0xfff5fff1,0xfff9fff9,0xfffdfffa,0x0003fffb,
-0x00080003,0x00090005,0x000b0008,0x000d000d,0x0008000a,0x0009000a,0x00020005,0xfffd0002,
-0xfffb0002,0xfff7fffa,0xfff3fff4,0xffeffff4,0xffe7ffec,0xffe4ffe6,0xffdfffe4,0xffddffde,
-0xffdbffde,0xffdaffd9,0xffddffdb,0xffdfffdd,0xffe2ffdf,0xffe9ffe1,0xffe8ffe9,0xfff0ffec,
-0xfff4fff2,0xfff9fff4,0xfffefffc,0x00060005,0x000e000d,0x00140013,0x001b001c,0x00250029,
-0x002b002e,0x00350036,0x003f0039,0x00450041,0x0051004d,0x005b0052,0x0062005c,0x0066005f,
-0x006e006c,0x00710071,0x00760078,0x007d007d,0x0085007f,0x00830083,0x008b0086,0x008b0089,
-0x008a0087,0x00820086,0x00810083,0x007b0082,0x0079007f,0x0077007a,0x00710071,0x006d0070,
-0x006a006e,0x00650067,0x00640067,0x00610061,0x00610062,0x005c005d,0x005c005c,0x0058005a,
-0x00590059,0x005b0056,0x00570055,0x00580057,0x00540058,0x00550056,0x00560058,0x0058005b,
-0x00570056,0x0058005a,0x0059005a,0x005e005b,0x005a0061,0x005c005d,0x005c005d,0x0058005b,
-0x00560056,0x00520052,0x0052004f,0x0049004b,0x00440045,0x003f0041,0x003b003e,0x00300038,
-0x002b002f,0x00210026,0x00190021,0x00140015,0x00100011,0x000b000d,0x0009000b,0x00060008,
-0xfffe0001,0xfffbfffc,0xfff5fff9,0xfff9fff8,0xfff9fffb,0xfff8fff6,0xfff3fff5,0xfff1fff6,
-0xffedfff1,0xffe7ffed,0xffe3ffe4,0xffdaffdd,0xffd5ffd3,0xffcbffcf,0xffbfffc0,0xffb6ffbc,
-0xffabffb0,0xffa2ffa7,0xff96ff9d,0xff8dff95,0xff8fff90,0xff85ff8b,0xff7cff82,0xff80ff82,
-0xff80ff80,0xff82ff7f,0xff84ff82,0xff89ff84,0xff88ff88,0xff89ff87,0xff90ff8d,0xff97ff92,
-0xff98ff95,0xff9fff98,0xffa4ffa1,0xffaaffaa,0xffaeffab,0xffb2ffb3,0xffbdffb6,0xffbdffc0,
-0xffc3ffc4,0xffc7ffc7,0xffc8ffcb,0xffcdffd2,0xffd4ffd5,0xffd2ffd3,0xffd8ffd7,0xffdaffd6,
-0xffdbffd6,0xffd7ffd9,0xffd3ffd6,0xffceffd2,0xffcbffcd,0xffc4ffc9,0xffc0ffc7,0xffb8ffbc,
-0xffb1ffb7,0xffa6ffac,0xffa3ffa3,0xff9aff9f,0xff97ff97,0xff97ff96,0xff91ff8e,0xff8dff8c,
-0xff8cff8d,0xff8aff89,0xff92ff8a,0xff93ff8f,0xff91ff8f,0xff9aff97,0xff9fff99,0xffa2ffa0,
-0xffa7ffa9,0xffa7ffad,0xffacffae,0xffb1ffb1,0xffb5ffb2,0xffb9ffb7,0xffb6ffb7,0xffbdffb7,
-0xffbdffbc,0xffbfffbb,0xffc1ffbf,0xffc0ffbd,0xffc5ffc5,0xffc5ffc5,0xffc9ffc5,0xffc7ffc9,
-0xffd1ffcf,0xffd5ffd3,0xffd4ffd5,0xffd8ffda,0xffdeffdb,0xffe1ffdd,0xffe5ffe3,0xffeaffea,
-0xfff4ffee,0xfff7ffef,0xfffbfff6,0xfffbfffb,0x00040001,0x00080006,0x000c000a,0x00120011,
-0x00140016,0x001f001d,0x00230021,0x002c0028,0x0030002a,0x0031002e,0x00300032,0x00350034,
-0x00340036,0x00390038,0x003d003a,0x003f003f,0x00420040,0x00470046,0x004a0049,0x004a004b,
-0x004e004d,0x00530051,0x005a0057,0x0061005c,0x00660061,0x006b0066,0x0070006d,0x007b0074,
-0x0080007d,0x00830083,0x008d0088,0x0090008c,0x0091008e,0x00930092,0x00930092,0x00920092,
-0x0090008d,0x008e008d,0x00860089,0x007f0086,0x007e007e,0x00740074,0x0068006d,0x00600064,
-0x0057005d,0x004b0053,0x003c0043,0x002f0039,0x0023002b,0x0015001c,0x00100011,0x0003000a,
-0x00030000,0xfffaffff,0xfff7fff7,0xfff0fff3,0xffefffee,0xfff2ffee,0xfff3ffe7,0xfff7ffee,
-0xfff9fff2,0xfff9fff9,0xfffcfffc,0x00070004,0x000e000c,0x00160013,0x001b001d,0x002a0024,
-0x00300030,0x00320031,0x003d003a,0x00420040,0x00470040,0x00490045,0x00480044,0x00450046,
-0x00450044,0x003f0042,0x003c003e,0x0039003d,0x00330037,0x002a002d,0x00230027,0x001f0023,
-0x0017001a,0x00120016,0x00120012,0x000e000f,0x00070009,0x00090007,0x00060006,0x00030003,
-0xffff0002,0x00020003,0x00010000,0xfffe0000,0x0000ffff,0x0000fffe,0x00020004,0x00040001,
-0x00030002,0xfffe0003,0xffff0000,0xfffd0003,0xfffc0001,0xfff9fffb,0xfff2fff9,0xffeffff4,
-0xffeaffed,0xffe2ffe5,0xffdfffdf,0xffd7ffd6,0xffd1ffd1,0xffc9ffcb,0xffbfffc4,0xffbaffbf,
-0xffb4ffb4,0xffafffae,0xffaaffab,0xffa4ffa5,0xffa3ffa2,0xffa6ffa0,0xffa8ffa3,0xffa9ffa7,
-0xffaaffa8,0xffaeffaa,0xffb4ffb0,0xffbfffb8,0xffc6ffc5,0xffd1ffca,0xffd3ffce,0xffdaffd6,
-0xffdeffdd,0xffe4ffe6,0xffe5ffe6,0xffe8ffe6,0xffe8ffea,0xffe5ffeb,0xffe5ffe5,0xffe6ffe4,
-0xffe0ffe3,0xffdcffdd,0xffd9ffd9,0xffd5ffdc,0xffd6ffd3,0xffd5ffd0,0xffd6ffcf,0xffd7ffd2,
-0xffd6ffd5,0xffd7ffd6,0xffdbffd8,0xffe2ffe2,0xffdfffe2,0xffe6ffe3,0xffefffed,0xfff8fff4,
-0x0002fffd,0x00080004,0x0013000f,0x00180016,0x0026001d,0x002a0023,0x002f0029,0x0032002f,
-0x00370035,0x00370036,0x003a0035,0x003c0039,0x0037003b,0x00320037,0x002e0037,0x002e002f,
-0x0028002d,0x00210027,0x00200022,0x001b0021,0x001a001a,0x00140015,0x00150012,0x000f000b,
-0x0010000b,0x00080009,0x00080004,0x00050004,0xfffdffff,0xfffcfffa,0xfff7fff8,0xfff4fff6,
-0xfff6fff2,0xffeafff0,0xffecffec,0xffebffea,0xffe7ffe8,0xffe7ffe7,0xffe6ffe7,0xffe3ffe4,
-0xffe4ffe6,0xffe1ffe5,0xffe1ffe4,0xffe2ffe3,0xffe3ffe2,0xffe5ffe1,0xffeaffe5,0xffeaffe8,
-0xffeaffe7,0xffedffe5,0xffecffea,0xffe9ffe5,0xffebffea,0xffecffe6,0xffe8ffe5,0xffe5ffe8,
-0xffe1ffe5,0xffe3ffe3,0xffe2ffe1,0xffdeffdf,0xffd8ffda,0xffd9ffd9,0xffd7ffd4,0xffd6ffd4,
-0xffd5ffd4,0xffd4ffd8,0xffcfffd5,0xffd4ffd4,0xffd6ffd7,0xffd2ffd5,0xffd4ffd5,0xffd5ffd3,
-0xffd8ffd9,0xffd7ffd7,0xffd9ffd6,0xffdaffd4,0xffd5ffd3,0xffd5ffd3,0xffd2ffd3,0xffd1ffd2,
-0xffccffd0,0xffcbffcc,0xffc7ffcb,0xffc3ffc7,0xffc0ffc2,0xffc1ffc0,0xffc2ffc0,0xffc0ffc1,
-0xffc0ffbf,0xffbeffbf,0xffc3ffc3,0xffc7ffc4,0xffc9ffc6,0xffccffca,0xffd1ffcf,0xffd7ffd6,
-0xffddffdf,0xffe0ffe1,0xffe6ffe7,0xffe8ffea,0xffeffff1,0xffeffff4,0xfff6fff5,0xfffbfff8,
-0x0003ffff,0x00050001,0x000b0008,0x000c0009,0x000e000e,0x000e000a,0x0011000c,0x00110012,
-0x00130011,0x00160013,0x00160016,0x00170015,0x00160015,0x001a0018,0x001b001c,0x00200020,
-0x00230021,0x00210023,0x00250023,0x00290028,0x002d0028,0x0033002d,0x00320033,0x00320032,
-0x00350037,0x003c0039,0x003c003d,0x003c003a,0x0039003c,0x0040003d,0x003d003b,0x00380038,
-0x0039003c,0x00390040,0x003d003f,0x003a0041,0x003e0040,0x0040003e,0x0041003e,0x00470043,
-0x00490042,0x004a0044,0x004c0046,0x004a0047,0x00480048,0x004d004f,0x004c0052,0x0050004f,
-0x00540051,0x00590056,0x005a005c,0x005e005b,0x0061005e,0x00640063,0x00670065,0x0065006c,
-0x0067006d,0x0069006f,0x006b006f,0x006d0070,0x006c0073,0x006d006e,0x0069006c,0x00640065,
-0x0060005f,0x005a005c,0x00530054,0x004f0050,0x0047004a,0x003f0043,0x003f003e,0x003a003b,
-0x00350037,0x002e0034,0x002a0030,0x0029002b,0x00260026,0x00240028,0x0026002a,0x002b0027,
-0x002b0026,0x002e002b,0x0031002e,0x00370031,0x00390035,0x00380034,0x00380036,0x003a003b,
-0x0042003e,0x00430042,0x003b003d,0x003a003a,0x00380039,0x00330039,0x002e0033,0x0027002f,
-0x00220028,0x001d0023,0x00120018,0x00100012,0x00000009,0xfff8ffff,0xffeefff6,0xffe3ffec,
-0xffd9ffde,0xffd0ffd3,0xffc2ffc8,0xffbaffbe,0xffaeffb3,0xffa4ffa9,0xff99ff9b,0xff91ff97,
-0xff8aff8a,0xff84ff86,0xff82ff83,0xff7fff83,0xff7cff7e,0xff76ff7c,0xff77ff77,0xff76ff76,
-0xff77ff77,0xff75ff78,0xff79ff79,0xff7cff7c,0xff7bff7d,0xff7eff7c,0xff7cff7a,0xff7eff7c,
-0xff7cff7b,0xff82ff7f,0xff82ff7e,0xff81ff7f,0xff85ff83,0xff88ff86,0xff88ff85,0xff8cff8a,
-0xff8aff8a,0xff8aff8e,0xff8fff94,0xff8fff92,0xff95ff97,0xff99ff9a,0xff9dff9d,0xffa0ff9d,
-0xffa3ff9d,0xffa6ffa2,0xffa8ffa1,0xffa8ffa9,0xffacffab,0xffb5ffb0,0xffb7ffb5,0xffbbffb6,
-0xffbdffbe,0xffc3ffc4,0xffc7ffc7,0xffcfffcd,0xffceffd2,0xffd3ffd1,0xffd9ffd5,0xffd9ffd6,
-0xffddffd7,0xffdeffdb,0xffd9ffd9,0xffd9ffda,0xffd5ffd8,0xffd9ffd6,0xffd4ffd5,0xffd1ffd3,
-0xffd2ffd1,0xffcfffd1,0xffcdffcf,0xffceffcd,0xffccffcc,0xffd1ffd1,0xffd1ffce,0xffd3ffd3,
-0xffdbffd5,0xffdcffdc,0xffe2ffde,0xffe6ffe4,0xffeaffe7,0xffecffea,0xfff4fff1,0xfff7fff7,
-0xfffbfffa,0x0000fffd,0x00010004,0x00080009,0x000d0009,0x000c000b,0x00110015,0x00120015,
-0x00190018,0x0021001b,0x0024001f,0x00290026,0x002d0027,0x0033002e,0x00340034,0x0037003a,
-0x0039003b,0x003d0040,0x003e003f,0x00420041,0x00440044,0x0043003e,0x0047003f,0x00420041,
-0x0043003f,0x003e0041,0x0040003c,0x0043003d,0x00410043,0x003f0042,0x003e0041,0x00400040,
-0x00430040,0x00450042,0x004a0043,0x004c004a,0x004e004e,0x0054004d,0x00580056,0x00590059,
-0x005c005e,0x00640061,0x00660067,0x00670069,0x0071006d,0x006f0070,0x00730073,0x00730078,
-0x00770078,0x0079007a,0x0078007d,0x007a0079,0x007a0079,0x0074007b,0x00760079,0x00760079,
-0x00720074,0x00700071,0x0070006f,0x006c006c,0x00680067,0x00650061,0x005b005e,0x00540059,
-0x004e0055,0x0045004f,0x003a0045,0x00350039,0x0027002c,0x00200028,0x0014001c,0x000e0010,
-0x00040006,0xfffafff9,0xffeafff0,0xffe4ffe4,0xffd7ffdf,0xffceffd2,0xffcaffca,0xffc3ffc6,
-0xffbeffc4,0xffbbffbd,0xffb6ffbb,0xffb4ffb8,0xffb4ffb7,0xffb7ffb2,0xffb6ffb2,0xffb9ffb3,
-0xffb7ffb7,0xffc1ffc1,0xffbfffc4,0xffc5ffc4,0xffcbffc9,0xffd1ffc9,0xffd4ffce,0xffd7ffda,
-0xffdcffdd,0xffe6ffe3,0xffefffea,0xfff4ffef,0xfff9fff6,0x0000fffd,0x00070000,0x000d0009,
-0x0014000f,0x001a0017,0x001d0021,0x00240021,0x00260024,0x00230026,0x00230024,0x00230024,
-0x00200025,0x001c001f,0x001a0019,0x000f0014,0x000d0013,0x00080006,0x00010002,0xfff6fffa,
-0xfff2fff5,0xffecffef,0xffe3ffe4,0xffddffe1,0xffdaffdb,0xffd6ffda,0xffd4ffd4,0xffd2ffd4,
-0xffd2ffd2,0xffd3ffd4,0xffd7ffd6,0xffd5ffd7,0xffd3ffd5,0xffd1ffd5,0xffd8ffd3,0xffd7ffd7,
-0xffd4ffd8,0xffd8ffd7,0xffd7ffd7,0xffd7ffd6,0xffd5ffd7,0xffd3ffd3,0xffd4ffd2,0xffcfffce,
-0xffcdffcd,0xffc6ffca,0xffc9ffca,0xffc8ffc8,0xffc7ffc7,0xffc6ffcb,0xffcdffcb,0xffcdffca,
-0xffcfffcf,0xffd6ffd0,0xffdbffd7,0xffdeffdc,0xffeaffe3,0xffedffec,0xfff5fff3,0x00010001,
-0x00090009,0x000e0009,0x00160012,0x001b0016,0x001e0017,0x0022001c,0x0021001c,0x00220020,
-0x001c0021,0x001c001d,0x001b001f,0x001b001a,0x0012001a,0x00120015,0x000e0011,0x000d000d,
-0x0008000a,0x00050007,0x00020005,0x00050005,0x00010006,0x00020004,0x00080005,0x00070007,
-0x000c0008,0x000f000a,0x000d000b,0x0011000d,0x00110011,0x00150012,0x00170017,0x00190016,
-0x00190016,0x0017001a,0x00180018,0x001a001e,0x001a0023,0x001c001d,0x0019001e,0x001a001a,
-0x001a0019,0x00170014,0x00120016,0x00120013,0x000e0010,0x000a000f,0x00090006,0x00010003,
-0xfffefff9,0xfff3fff4,0xffeefff1,0xffeaffed,0xffdeffe5,0xffd4ffdd,0xffd0ffd6,0xffc9ffcd,
-0xffc8ffc8,0xffc1ffc7,0xffc5ffc2,0xffc1ffc2,0xffbfffc0,0xffbeffbe,0xffbdffbb,0xffc0ffbe,
-0xffc4ffc1,0xffcbffc9,0xffcbffc7,0xffd2ffcb,0xffd3ffcf,0xffd5ffd3,0xffdaffda,0xffddffdd,
-0xffe1ffe1,0xffdfffe2,0xffe1ffe1,0xffdfffdf,0xffdbffdf,0xffdcffde,0xffd8ffd7,0xffd3ffd2,
-0xffd1ffd3,0xffcdffcb,0xffd0ffce,0xffcaffc9,0xffceffcb,0xffc7ffcc,0xffcdffcb,0xffcbffcc,
-0xffccffcb,0xffd0ffcf,0xffd4ffd3,0xffd4ffd3,0xffe0ffd9,0xffe5ffdf,0xffeaffe3,0xffefffea,
-0xffefffec,0xfff1fff0,0xfff1fff2,0xfff4fff8,0xfff4fff9,0xfff7fffc,0xfff4fff7,0xfff7fff7,
-0xfff5fff4,0xfff5fff3,0xfff3fff0,0xfff6fff4,0xfff2fff1,0xfff3ffef,0xffefffee,0xffeeffeb,
-0xffecffec,0xffeeffed,0xffedffea,0xffeeffe8,0xffefffe8,0xffefffec,0xffeefff1,0xffeffff1,
-0xfff4fff5,0xfff6fffa,0xfff9fffb,0xfffdffff,0x00060004,0x000c0008,0x0011000e,0x001a0013,
-0x0021001b,0x00260025,0x002f002b,0x00320030,0x003c003a,0x003b003e,0x00410045,0x00430045,
-0x00480046,0x00460044,0x00470044,0x00470042,0x00410040,0x0040003e,0x003f003f,0x003d003c,
-0x0039003c,0x0038003d,0x0037003e,0x003c0042,0x003e0044,0x00440044,0x004a0045,0x004e0044,
-0x0051004b,0x0056004e,0x00580054,0x005a0058,0x0060005b,0x005f005e,0x00620064,0x00650064,
-0x00680069,0x006c006e,0x006c006c,0x006e006b,0x006c006b,0x0071006e,0x0073006e,0x00740074,
-0x00730075,0x00730074,0x00730074,0x0078007a,0x00790079,0x0079007c,0x00780079,0x007c0079,
-0x00740075,0x00760079,0x00710076,0x006d0071,0x0063006d,0x00600065,0x005a005b,0x00540054,
-0x004b0051,0x0046004a,0x003f0040,0x0035003a,0x002a002d,0x00220023,0x001d001d,0x00170017,
-0x000f0012,0x000c000f,0x0006000b,0xffff0005,0xfffcffff,0xfff5fff9,0xfff4fff5,0xfff1fff1,
-0xffefffef,0xffebffef,0xffe6ffe6,0xffe3ffe5,0xffdeffe2,0xffddffdd,0xffd9ffd9,0xffd2ffd5,
-0xffd2ffd3,0xffd1ffd1,0xffccffd1,0xffcdffcd,0xffcaffcc,0xffc7ffc8,0xffc7ffcb,0xffc6ffc8,
-0xffc4ffc5,0xffc0ffc6,0xffbeffc1,0xffbcffc2,0xffbbffc0,0xffb8ffbf,0xffb6ffb9,0xffb0ffb3,
-0xffaaffaf,0xffa5ffab,0xffa1ffa3,0xff9eff9e,0xff97ff98,0xff97ff98,0xff8cff94,0xff8bff8a,
-0xff84ff84,0xff83ff7e,0xff7eff7d,0xff7aff77,0xff77ff76,0xff77ff76,0xff72ff74,0xff6eff73,
-0xff6fff73,0xff6eff71,0xff73ff75,0xff78ff74,0xff76ff6f,0xff76ff77,0xff7aff77,0xff7aff7b,
-0xff7eff7d,0xff84ff80,0xff89ff83,0xff89ff89,0xff8dff8a,0xff91ff92,0xff92ff94,0xff97ff94,
-0xff95ff99,0xff9bff98,0xff9bff99,0xff9dff9d,0xff9fff9d,0xffa3ffa0,0xffa6ffa3,0xffacffab,
-0xffacffaf,0xffb3ffb3,0xffb5ffb5,0xffbdffb8,0xffc2ffbd,0xffc9ffc3,0xffcaffcf,0xffd4ffd4,
-0xffd7ffda,0xffe0ffdf,0xffebffe2,0xfff5ffef,0xfffdfff2,0x0000fffa,0x000c0002,0x00130009,
-0x00130010,0x00150017,0x001d001c,0x001d001d,0x0020001f,0x00290024,0x00280026,0x002c002c,
-0x002c002c,0x002b002b,0x0029002e,0x002b002b,0x00290027,0x00270024,0x00230026,0x00240023,
-0x00220027,0x00210021,0x0022001f,0x00240023,0x00280025,0x002a002a,0x0029002c,0x0030002e,
-0x00350034,0x003a0036,0x0041003e,0x00450044,0x004f0048,0x0054004e,0x00590059,0x005f0060,
-0x00610063,0x00670066,0x006a0069,0x006f006c,0x00720071,0x00710070,0x0070006f,0x006e006d,
-0x00670069,0x00630064,0x005f005e,0x0056005a,0x00550059,0x00530057,0x004f0051,0x0049004a,
-0x00450049,0x00450045,0x00450043,0x00410042,0x00420042,0x003e003c,0x003d003d,0x003e0040,
-0x00410044,0x00410043,0x00420042,0x0044003f,0x00430043,0x00440041,0x0041003f,0x00450044,
-0x00400045,0x0041003d,0x003c0040,0x003a0040,0x003a003b,0x00350036,0x0033002e,0x002e002e,
-0x002a002d,0x00230028,0x00240027,0x00200023,0x0018001e,0x00160018,0x00160015,0x00110012,
-0x000a000e,0x00090009,0x00040007,0x00020001,0xfffc0000,0xfffefffc,0xfffafff9,0xfff3fff2,
-0xffeffff0,0xffebffeb,0xffe8ffe9,0xffe4ffe6,0xffdcffe2,0xffdbffdf,0xffd8ffda,0xffcfffd0,
-0xffcbffcd,0xffc7ffc9,0xffbfffc3,0xffbdffc0,0xffb9ffbb,0xffb5ffb3,0xffb4ffb2,0xffb0ffb1,
-0xffb0ffb2,0xffb3ffb3,0xffb3ffb5,0xffb9ffb8,0xffbeffbb,0xffc1ffc1,0xffc5ffc3,0xffc9ffc6,
-0xffccffc8,0xffd0ffce,0xffd3ffd5,0xffd5ffd6,0xffd9ffd7,0xffd9ffdb,0xffdfffdb,0xffdbffde,
-0xffddffdb,0xffdbffdc,0xffd9ffd9,0xffd9ffd8,0xffd3ffd4,0xffd4ffd3,0xffccffd1,0xffcaffcd,
-0xffccffca,0xffc7ffcb,0xffc8ffca,0xffc8ffc7,0xffcaffcc,0xffc9ffcc,0xffcfffcd,0xffd4ffcf,
-0xffdbffd2,0xffddffd6,0xffe4ffdc,0xffe4ffdd,0xffe7ffe0,0xffe9ffe8,0xffebffec,0xfff2ffef,
-0xfff2fff5,0xfff7fff7,0xfffbfffe,0xffff0000,0x00040001,0x00080004,0x00090008,0x000d0008,
-0x000e0010,0x0012000e,0x00130012,0x0019000f,0x001a0015,0x00190015,0x001c0019,0x001f001b,
-0x001f001d,0x0021001e,0x00290020,0x00270023,0x00280028,0x00290029,0x0029002a,0x002a002a,
-0x00270029,0x0029002b,0x002a002e,0x002b002c,0x002d002d,0x0028002e,0x0029002a,0x002e0029,
-0x002d002d,0x002e002c,0x002f002c,0x002f002f,0x002d002b,0x002b002b,0x002b002e,0x002a002a,
-0x00260028,0x00230024,0x00210025,0x001f0020,0x001d0020,0x001f001c,0x001b001b,0x001a0019,
-0x0019001a,0x0017001a,0x0018001b,0x00140015,0x00150015,0x00190017,0x0018001a,0x001a0016,
-0x001c001d,0x0020001e,0x00250025,0x002a0025,0x002d002c,0x0032002f,0x00340034,0x00370039,
-0x003b0039,0x003a003b,0x003d0039,0x00380036,0x00340036,0x00300031,0x0029002b,0x00210029,
-0x0015001d,0x000f0014,0x0003000d,0xfff80003,0xffedfff5,0xffe9ffec,0xffe4ffe3,0xffdbffe0,
-0xffcfffd5,0xffcaffcd,0xffc2ffc7,0xffbfffc2,0xffbcffc0,0xffbeffbc,0xffbaffba,0xffbcffbd,
-0xffbbffbc,0xffbbffbc,0xffbbffbd,0xffbdffb9,0xffbbffba,0xffbdffbe,0xffbdffbb,0xffbbffb9,
-0xffbcffbc,0xffbdffbb,0xffb8ffbc,0xffb7ffb7,0xffb8ffb5,0xffb5ffb2,0xffb1ffb2,0xffb0ffb2,
-0xffaeffaf,0xffb2ffb1,0xffafffb0,0xffadffb1,0xffabffb1,0xffa9ffae,0xffadffab,0xffabffa9,
-0xffafffaa,0xffaeffa9,0xffacffaa,0xffb1ffb0,0xffb2ffb1,0xffb1ffad,0xffb1ffb3,0xffb0ffb3,
-0xffb0ffb4,0xffb8ffb4,0xffbbffb4,0xffbcffb6,0xffc1ffbc,0xffbfffbf,0xffc3ffbb,0xffc5ffc2,
-0xffc8ffc9,0xffceffcb,0xffd0ffd1,0xffd7ffd4,0xffdeffd9,0xffe5ffe1,0xffe7ffe7,0xfff1ffed,
-0xfff7fff6,0xfffcfffa,0xffffffff,0x00070007,0x000b0008,0x0010000b,0x00140013,0x001a0018,
-0x001c0017,0x001f001c,0x001f0021,0x0020001f,0x0023001f,0x00240020,0x00240022,0x00230027,
-0x00240023,0x002a0027,0x002c002b,0x002f002d,0x00340032,0x00380036,0x003a003a,0x0042003f,
-0x00470045,0x0048004a,0x0050004d,0x00550051,0x00560055,0x00590057,0x00590059,0x005e005b,
-0x005b005c,0x005c005a,0x005b005a,0x005b005a,0x0057005c,0x0056005a,0x00580059,0x0057005a,
-0x00580059,0x00580058,0x005a005a,0x005e005b,0x0061005d,0x00690062,0x006f0066,0x006f0068,
-0x0073006b,0x0073006f,0x00760072,0x00760075,0x00780076,0x007c0079,0x007a0078,0x0078007a,
-0x00780078,0x00790077,0x00770077,0x00760076,0x006f0075,0x006a006e,0x00650066,0x005e0063,
-0x0058005d,0x00520055,0x0046004f,0x003b0040,0x00310035,0x00260029,0x00170020,0x000c000f,
-0x00050006,0xfff3fffc,0xffe8ffee,0xffdcffe7,0xffd1ffda,0xffcbffcf,0xffc1ffc3,0xffb9ffbe,
-0xffb1ffb6,0xffafffb4,0xffacffae,0xffabffad,0xffadffae,0xffadffab,0xffafffab,0xffb3ffac,
-0xffb7ffb0,0xffbbffb8,0xffc1ffbd,0xffc3ffc4,0xffcbffc8,0xffd1ffce,0xffd3ffce,0xffd8ffd2,
-0xffdfffdb,0xffdfffdb,0xffdfffdf,0xffe3ffe0,0xffe3ffe5,0xffe6ffe9,0xffe8ffe4,0xffe4ffe3,
-0xffe6ffe4,0xffe4ffe4,0xffe0ffe1,0xffe0ffe2,0xffdeffdf,0xffdbffe0,0xffdaffdd,0xffd7ffdb,
-0xffd5ffd4,0xffd0ffce,0xffceffce,0xffc8ffc7,0xffc8ffc7,0xffc2ffc4,0xffc1ffc3,0xffbeffbe,
-0xffb7ffbb,0xffb1ffb5,0xffadffb2,0xffa6ffac,0xffa1ffa8,0xff9dff9f,0xff96ff9a,0xff95ff94,
-0xff90ff8d,0xff87ff87,0xff84ff84,0xff7fff7e,0xff7eff7e,0xff7cff82,0xff76ff7c,0xff78ff7c,
-0xff7cff7c,0xff81ff7d,0xff84ff85,0xff8dff8d,0xff92ff92,0xff95ff94,0xffa2ff9d,0xffa9ffa5,
-0xffb3ffab,0xffbaffb5,0xffbeffb8,0xffc6ffc6,0xffcbffc9,0xffceffcd,0xffd5ffd1,0xffd8ffd2,
-0xffddffda,0xffe0ffdf,0xffe3ffe5,0xffe4ffe7,0xffe7ffec,0xffeeffec,0xfff4fff1,0xfff7fff4,
-0x0001fffa,0x00040002,0x00050001,0x000c0008,0x00140011,0x00170013,0x001d001a,0x001d0023,
-0x001c0021,0x00210024,0x00240026,0x00250024,0x00260020,0x00250020,0x00210021,0x00210020,
-0x00220021,0x0020001d,0x001f001e,0x00210024,0x00200023,0x00250026,0x00260029,0x00270027,
-0x00300028,0x0033002c,0x00390034,0x003f003e,0x00430044,0x00490044,0x0050004e,0x00510054,
-0x00570056,0x005e005c,0x00640061,0x00650062,0x00680065,0x00690066,0x00670068,0x006d0067,
-0x006b006e,0x006e006a,0x006e0070,0x006d006e,0x006b006b,0x006d006f,0x0069006d,0x006c006c,
-0x0072006f,0x00710073,0x00720070,0x00750072,0x00710071,0x006f006f,0x006f0070,0x006f006f,
-0x0068006e,0x00640068,0x005e0061,0x005a005d,0x00500055,0x0047004b,0x00420045,0x003a003b,
-0x002d0032,0x0025002a,0x001f0023,0x0017001b,0x000b0011,0x00040009,0xffff0005,0xfff80001,
-0xfff5fff6,0xfff0fff5,0xfff5fff4,0xfff2fff5,0xffeffff2,0xfff5fff1,0xfff5fff5,0xfffefff7,
-0x0005fffc,0x00070000,0x00070008,0x000d000c,0x0012000e,0x00160011,0x00150015,0x00180013,
-0x00130017,0x00140016,0x00130017,0x00160013,0x00120012,0x00080009,0x00000006,0xffff0001,
-0xfff4fff9,0xfff3fff4,0xffe8fff0,0xffe5ffe8,0xffdfffe3,0xffd9ffdc,0xffd2ffd7,0xffc9ffcd,
-0xffc5ffc6,0xffbcffbd,0xffbcffb6,0xffb1ffb2,0xffadffb0,0xffa7ffad,0xffa5ffa8,0xffa1ffa6,
-0xff9cff9e,0xff9cff9d,0xff9aff9e,0xff9cff9d,0xff99ff9a,0xff99ff99,0xff97ff99,0xff9aff9a,
-0xff9cff9b,0xffa0ff9e,0xffa0ff9d,0xffa3ff9f,0xffa4ffa3,0xffa9ffa6,0xffabffa7,0xffa9ffac,
-0xffadffab,0xffafffab,0xffaeffac,0xffaeffad,0xffafffaf,0xffb0ffb0,0xffb1ffaf,0xffb4ffb4,
-0xffb5ffb5,0xffb7ffb5,0xffbcffb7,0xffbfffbb,0xffc1ffc0,0xffc7ffc5,0xffceffc9,0xffd3ffce,
-0xffd7ffd4,0xffdeffd6,0xffdfffe2,0xffe3ffe4,0xffe9ffe8,0xffeffff1,0xfff3fff7,0xfff3fff7,
-0xfff4fff7,0xfff5fffb,0xfff6fffc,0xfff7fffc,0xfffafff8,0xfff6fffb,0xfff6fff7,0xfff3fff1,
-0xfff1fff3,0xfff0fff4,0xfff1fff5,0xfff2fff3,0xfff2fff3,0xfff4fff4,0xfff7fff5,0xfff9fff4,
-0xfffafff8,0x0000fff9,0x0004fffe,0x000a0006,0x000f000c,0x001b0011,0x0020001a,0x00290021,
-0x0031002e,0x003e0038,0x00450043,0x0054004e,0x00590057,0x005e005a,0x00660064,0x006d006a,
-0x0076006f,0x00790076,0x007e0079,0x00820084,0x007f0083,0x0080007d,0x007f007d,0x007c007c,
-0x0077007c,0x00720079,0x00700074,0x0067006d,0x00630069,0x005a0060,0x0051005b,0x004b004f,
-0x00420047,0x003e003e,0x00370037,0x00310033,0x002c002a,0x0025002a,0x00220027,0x00240024,
-0x00230023,0x001e0022,0x001f001d,0x001a001d,0x001a001d,0x001e001a,0x001e001e,0x001e001b,
-0x001f0020,0x0020001f,0x00240024,0x00230024,0x00220020,0x00260022,0x00260025,0x00290029,
-0x00220024,0x00220022,0x00200021,0x001e0022,0x0018001a,0x00110016,0x000d000d,0x0007000a,
-0x00000005,0xfffafffa,0xffeefff5,0xffebfff0,0xffe6ffea,0xffe1ffdf,0xffdbffde,0xffd4ffd5,
-0xffceffd2,0xffcaffcd,0xffc6ffc8,0xffc0ffc3,0xffbfffc3,0xffbeffbe,0xffb9ffbc,0xffb6ffb9,
-0xffb5ffb7,0xffb4ffb6,0xffb2ffb2,0xffafffaf,0xffacffad,0xffabffab,0xffa9ffa9,0xffacffab,
-0xffadffa9,0xffaeffad,0xffb0ffb0,0xffb4ffb2,0xffb4ffb7,0xffb9ffb6,0xffbeffbb,0xffbfffbf,
-0xffc6ffc0,0xffceffca,0xffd1ffcf,0xffdaffd1,0xffdfffda,0xffe5ffe1,0xffebffea,0xfff4fff2,
-0xfff7fff7,0xfffcfff9,0x0002fffd,0x00050000,0x00070005,0x00060007,0x00070009,0x0004000a,
-0x0003000a,0x00080009,0x00030004,0x0003fffe,0xfff9fffa,0xfff5fff6,0xfff6fff2,0xffefffee,
-0xfff0fff0,0xffecffee,0xffebffec,0xffe7ffe9,0xffe7ffe9,0xffe7ffe5,0xffe7ffea,0xffe5ffe5,
-0xffe3ffe2,0xffe6ffe7,0xffeaffe8,0xffe9ffe8,0xffecffe9,0xffeeffec,0xffecffef,0xffeffff0,
-0xfff1fff3,0xfff1fff2,0xfff7fff5,0xfff9fff8,0xfff5fff4,0xfff0fff5,0xfff8fff6,0xfff8fff5,
-0xfff8fff9,0xfff9fff8,0xfffdfffc,0x00030003,0x00030000,0x00040007,0x000c000a,0x000d000b,
-0x0010000c,0x00150012,0x00180014,0x001d0019,0x001e001d,0x0025001f,0x002a0028,0x002c002b,
-0x002f0031,0x002d002e,0x00350031,0x0033002e,0x0032002e,0x00310030,0x00330033,0x002e002e,
-0x002e002e,0x0028002d,0x0027002b,0x00250028,0x00220023,0x00240022,0x001f0023,0x001f001e,
-0x00200022,0x001d001b,0x001d001c,0x001b001b,0x001f001b,0x001e001d,0x001f001a,0x001f0020,
-0x001d001f,0x001c0022,0x00210021,0x00240023,0x00220022,0x001f0022,0x00210022,0x00220022,
-0x001f0021,0x0021001f,0x0020001c,0x001c001e,0x001c001a,0x0019001a,0x00140016,0x00130017,
-0x000f0014,0x00110012,0x000c000e,0x000a000a,0x00050004,0xfffe0003,0xfff7fffd,0xfff2fff5,
-0xffefffef,0xffe8fff1,0xffe2ffe7,0xffdbffdf,0xffd6ffdb,0xffd2ffd5,0xffccffcf,0xffc6ffc9,
-0xffc6ffc3,0xffbfffc4,0xffbfffc0,0xffc1ffbf,0xffc2ffc0,0xffc4ffbf,0xffc3ffc0,0xffc5ffbe,
-0xffc5ffc3,0xffc7ffc5,0xffc6ffc6,0xffcdffcd,0xffcfffcf,0xffd0ffcf,0xffd4ffd4,0xffd1ffd1,
-0xffd1ffd1,0xffd1ffd1,0xffcfffd0,0xffd1ffcf,0xffcdffcf,0xffcaffce,0xffc7ffcc,0xffc7ffc8,
-0xffcbffc9,0xffc9ffc5,0xffc9ffc7,0xffcdffc9,0xffcdffc9,0xffcdffcc,0xffcfffd2,0xffd2ffd7,
-0xffd7ffd8,0xffdfffd9,0xffe3ffe0,0xffe4ffe0,0xffe9ffe6,0xffebffec,0xffecffef,0xfff3fff2,
-0xfff6fff5,0xfff9fff7,0xfffbfff8,0xfff7fff6,0xfff6fff7,0xfff8fff7,0xfff5fff7,0xfff4fff7,
-0xfff4fff2,0xfff1fff3,0xfff0ffee,0xffedfff1,0xfff0ffef,0xfff1fff0,0xffedffee,0xffedffed,
-0xffecffed,0xffeeffeb,0xffedffec,0xffeeffef,0xffeeffed,0xfff4fff0,0xfff8fff3,0xfffafff5,
-0xfffcfff9,0xffffffff,0x00020003,0x00090008,0x000e000d,0x00140011,0x00190015,0x001d001d,
-0x00230023,0x002b002b,0x0034002f,0x00370034,0x00380036,0x003c003a,0x0037003a,0x003b0039,
-0x003c003a,0x00390039,0x00370033,0x00380036,0x00360035,0x00310035,0x00320038,0x00340037,
-0x00350035,0x00380037,0x00390038,0x00390036,0x0040003c,0x003f003d,0x00470041,0x004c0046,
-0x004d0046,0x0050004d,0x00520051,0x00560055,0x005a0056,0x005d0059,0x00590059,0x005d0059,
-0x0060005f,0x00620061,0x005f005f,0x00610062,0x00650066,0x00640063,0x00630066,0x00650065,
-0x00680068,0x00660066,0x006a0068,0x006c0067,0x00690069,0x006a0066,0x00630067,0x00660067,
-0x00610066,0x005f0064,0x005a005c,0x0056005c,0x004e0056,0x004a004e,0x00400045,0x003a003d,
-0x00320036,0x0029002e,0x00270023,0x001f0023,0x001b0019,0x00100015,0x000d000f,0x000a000d,
-0x00000007,0xffffffff,0xfffcfffc,0xfff9fffb,0xfff6fff7,0xfff5fff3,0xfff2ffee,0xfff2fff0,
-0xffeaffed,0xffe8ffe7,0xffe3ffe2,0xffe0ffe1,0xffdcffde,0xffd9ffd8,0xffdaffd9,0xffd3ffd7,
-0xffd3ffd5,0xffd1ffd3,0xffd3ffce,0xffd2ffcd,0xffcbffcd,0xffcaffcd,0xffc9ffd2,0xffc8ffcf,
-0xffc8ffcf,0xffc4ffc9,0xffc4ffc4,0xffc2ffc4,0xffbcffc1,0xffbdffbe,0xffb6ffba,0xffb4ffb4,
-0xffb0ffaf,0xffa7ffad,0xffa8ffa6,0xff9effa4,0xff9aff9f,0xff94ff99,0xff92ff94,0xff8eff91,
-0xff8cff8f,0xff86ff8a,0xff88ff85,0xff87ff82,0xff87ff84,0xff80ff82,0xff88ff83,0xff84ff82,
-0xff84ff83,0xff87ff84,0xff83ff86,0xff85ff86,0xff85ff88,0xff89ff8d,0xff8dff8d,0xff90ff91,
-0xff95ff95,0xff9aff98,0xffa2ff99,0xffa3ff9c,0xffa1ff9f,0xffa2ffa0,0xffa0ffa4,0xffa3ffa6,
-0xffa9ffa6,0xffa7ffa8,0xffaaffac,0xffb1ffae,0xffb6ffb3,0xffb8ffb4,0xffbaffb7,0xffbfffbb,
-0xffc3ffbe,0xffc5ffc5,0xffccffc7,0xffd1ffcb,0xffd2ffcf,0xffdbffd6,0xffdfffdf,0xffe4ffe5,
-0xffecffeb,0xfff4fff4,0xfff7fff7,0xfffffffc,0x00090003,0x000f000b,0x00160011,0x001a0015,
-0x001b001a,0x0022001a,0x00250022,0x002b0027,0x00290025,0x00280027,0x00260028,0x00260023,
-0x001f0022,0x00240021,0x001e001e,0x001b0019,0x0018001c,0x00180015,0x00170017,0x00140013,
-0x00150018,0x00150016,0x00170016,0x00170019,0x001b001b,0x0021001e,0x00250022,0x00280025,
-0x0031002d,0x00350035,0x003c003b,0x00440041,0x00480046,0x00510051,0x00570056,0x005b005a,
-0x0061005d,0x00630062,0x00640062,0x00630061,0x00600063,0x00600063,0x005e005e,0x0057005e,
-0x00540057,0x0050004f,0x004c004e,0x00430045,0x00410041,0x003a003e,0x00370037,0x0037003a,
-0x00330031,0x00340034,0x002b002f,0x002d002d,0x0030002e,0x00300030,0x002f002f,0x0032002d,
-0x00340033,0x00360034,0x00350035,0x00360036,0x00370036,0x00350036,0x00380037,0x003c003c,
-0x003c003d,0x00360038,0x00390038,0x00370038,0x00300036,0x002f0031,0x002f0030,0x002f002d,
-0x002f002c,0x002d002a,0x002c002d,0x0026002a,0x00270026,0x00220025,0x001f001e,0x001f001c,
-0x001c001c,0x0019001b,0x001a001a,0x00110019,0x000f0012,0x000f0010,0x000c000d,0x000b000b,
-0x00030004,0xfffe0002,0xfff9ffff,0xfff4fff4,0xffefffee,0xffe7ffe6,0xffe0ffe2,0xffd7ffdb,
-0xffd4ffd7,0xffd5ffd4,0xffcaffcd,0xffcbffc9,0xffc3ffc4,0xffbfffc2,0xffbcffc2,0xffc2ffc1,
-0xffbcffc0,0xffc0ffc1,0xffc5ffbf,0xffc2ffc1,0xffc4ffc5,0xffc9ffc7,0xffcdffca,0xffd1ffca,
-0xffd7ffd2,0xffdbffd5,0xffddffdb,0xffdbffdd,0xffddffde,0xffddffe1,0xffdfffdf,0xffdfffe0,
-0xffe4ffe2,0xffe7ffe6,0xffeaffe6,0xffecffea,0xffe9ffec,0xffecffec,0xfff0ffed,0xfff6ffef,
-0xfff3fff4,0xfff7fff8,0xfffcfffb,0xfffdfffb,0x0001fffe,0x00060006,0x00050007,0x00060009,
-0x000b0009,0x000f000c,0x0012000d,0x0010000e,0x000f0011,0x00110011,0x000e0012,0x000f0010,
-0x000d000b,0x0006000b,0x00000005,0xfffdfffe,0xfff9fffc,0xfff7fff9,0xfff3fff5,0xfff0ffef,
-0xffeeffeb,0xffeaffed,0xffecffea,0xffe8ffea,0xffe6ffe8,0xffe9ffea,0xffe9ffe7,0xffe7ffeb,
-0xffefffec,0xffefffeb,0xfff2fff0,0xfff4fff1,0xfff5fff1,0xfff5fff4,0xfff7fff9,0xfffafff9,
-0xfffcfff8,0xfff7fffc,0xfff8fff9,0xfff5fff6,0xfff4fff8,0xfff7fff8,0xfff7fff5,0xfff7fff2,
-0xfff7fff3,0xfff4fff7,0xfff2fff3,0xfff3fff3,0xfff5fff8,0xfff8fff6,0xfff4fff5,0xfff6fff4,
-0xfff2fff8,0xfff3fff4,0xfff5fff4,0xfff9fff7,0xfff5fffa,0xfff7fff5,0xfff7fffb,0xfff7fff8,
-0xfffbfff9,0xfff7fff6,0xfffcfff8,0xfffafffa,0xfffdfffa,0x00010000,0x0006ffff,0x00070006,
-0x000d000a,0x000f000f,0x00100014,0x00180016,0x001b001b,0x0020001d,0x001d001c,0x00260022,
-0x00270027,0x002a002a,0x0029002d,0x002d002b,0x002d002d,0x0032002d,0x002e002f,0x002c002b,
-0x002b002a,0x00280028,0x0025002a,0x00230026,0x00250025,0x00210025,0x00220023,0x001f001e,
-0x001a001a,0x00180019,0x00130019,0x000d0014,0x0007000a,0x00030007,0xfffb0001,0xfff4fff9,
-0xffedffee,0xffe0ffe7,0xffdaffde,0xffd1ffd2,0xffc6ffcc,0xffbeffc4,0xffb9ffbb,0xffb1ffb3,
-0xffabffae,0xffa6ffa6,0xffa4ffa3,0xffa0ffa1,0xff9fffa2,0xff9dffa1,0xff9effa4,0xffa4ff9e,
-0xffa7ffa2,0xffaaffa3,0xffadffa8,0xffb0ffaf,0xffaeffb2,0xffb2ffb2,0xffb7ffb7,0xffb5ffb8,
-0xffb6ffb8,0xffb7ffba,0xffbbffb9,0xffbaffba,0xffc0ffb7,0xffc1ffbe,0xffc3ffc1,0xffc3ffc1,
-0xffc5ffc5,0xffc9ffc5,0xffd0ffcd,0xffd6ffcf,0xffdfffd7,0xffe7ffdd,0xffe9ffe4,0xffedffeb,
-0xfff8fff3,0xfffcfffd,0x00060002,0x000b000d,0x000e000e,0x00130011,0x00160019,0x001e001c,
-0x001e001c,0x0023001d,0x00200020,0x001d001c,0x001d001b,0x001c001e,0x00180017,0x00140012,
-0x000e000f,0x000e000d,0x000b0006,0x000a0007,0x00090003,0x00050000,0x00050001,0x00030003,
-0x00060006,0x0007000a,0x000e000b,0x00140011,0x001d001c,0x00250021,0x002c0024,0x0030002c,
-0x00360034,0x003e003a,0x00420044,0x00490045,0x004e004c,0x004e0051,0x0052004f,0x00540055,
-0x00550058,0x00570056,0x00520057,0x00530053,0x00520052,0x004e0050,0x004c004e,0x004a0049,
-0x004c004b,0x00480049,0x00460047,0x00440049,0x00470046,0x004a0047,0x00470047,0x00470047,
-0x004a0047,0x004a0048,0x00470048,0x00490046,0x004b0047,0x004b004a,0x004b0049,0x004b004c,
-0x0049004a,0x004b004f,0x00480047,0x00470049,0x00480047,0x004a004b,0x00460048,0x00450044,
-0x00430042,0x00400040,0x00420043,0x003e0040,0x003c003d,0x003a003f,0x003c003b,0x00390037,
-0x003b003b,0x003d0039,0x003e003d,0x003b003a,0x0038003a,0x003b003a,0x003e0039,0x003c0039,
-0x003a0036,0x00340036,0x00340032,0x002e0031,0x0029002c,0x00280029,0x00220025,0x001c001e,
-0x0015001b,0x000d0013,0x000c000f,0x00040008,0xfffb0003,0xfff4fff8,0xfff0fff2,0xffe9ffec,
-0xffe3ffe3,0xffd9ffde,0xffcfffd8,0xffccffd1,0xffc1ffc9,0xffbdffc1,0xffb6ffb7,0xffb1ffb4,
-0xffa9ffaf,0xffa5ffa7,0xffa0ffa1,0xff99ff9d,0xff95ff97,0xff91ff95,0xff8cff8d,0xff8aff8a,
-0xff8bff8a,0xff86ff86,0xff8aff88,0xff85ff88,0xff87ff86,0xff8bff89,0xff8bff89,0xff8eff8c,
-0xff8dff8d,0xff93ff91,0xff97ff98,0xff9bff9a,0xff9dff9f,0xffa2ffa4,0xffa6ffa4,0xffa6ffa8,
-0xffa6ffa8,0xffa9ffa8,0xffaaffac,0xffadffa9,0xffaeffaa,0xffadffab,0xffa9ffa8,0xffa7ffa6,
-0xffa4ffa5,0xffa3ffa4,0xff9fff9d,0xffa1ffa0,0xffa1ffa0,0xffa3ffa3,0xffa2ff9f,0xffa3ffa5,
-0xffa5ffa5,0xffa8ffa9,0xffa9ffa8,0xffaaffab,0xffaeffad,0xffb1ffb0,0xffb6ffb1,0xffb6ffb3,
-0xffbbffbb,0xffbbffbc,0xffc1ffbe,0xffc4ffc3,0xffcbffc4,0xffc9ffc8,0xffceffcf,0xffd2ffd2,
-0xffd9ffd5,0xffdeffd9,0xffe8ffe5,0xffe9ffe7,0xfff1ffed,0xfff7fff1,0xfffafff6,0x0000fffc,
-0x00070004,0x000a0008,0x000e000d,0x00100010,0x00150012,0x001a0017,0x001b001c,0x001c0017,
-0x0020001f,0x00210023,0x00230023,0x002b0029,0x002d002b,0x00290029,0x002e0031,0x00340032,
-0x00340030,0x00380032,0x003c0038,0x0043003f,0x00450043,0x00470045,0x004a0048,0x004c004b,
-0x004d004e,0x0053004c,0x0054004c,0x0050004f,0x004e0050,0x004c0050,0x004d0054,0x0049004f,
-0x0049004b,0x00480048,0x0047004a,0x00460045,0x00440044,0x00410043,0x003b0043,0x003b0041,
-0x003f0041,0x003e0041,0x003c003e,0x003c0038,0x003e003a,0x003c003c,0x003d003d,0x0039003e,
-0x003d003a,0x003c003c,0x003f003d,0x003e0041,0x003d003c,0x00400041,0x00420042,0x00450043,
-0x00420042,0x00440041,0x00440041,0x00430043,0x00440043,0x00450047,0x00440044,0x00410042,
-0x00400041,0x003d003f,0x003a0038,0x00370038,0x002e0034,0x002b002f,0x00280027,0x00210021,
-0x0017001c,0x00100015,0x000a0010,0x0005000a,0x00040005,0xfffc0001,0xfffdfffe,0xfff7fff8,
-0xfff7fff8,0xfff3fff5,0xfff4fff3,0xfff6fff1,0xfff8fff3,0xfff9fff4,0xfffbfff6,0x0000fff9,
-0x00000000,0x00000000,0xffffffff,0x00020000,0x00020003,0x00030005,0x00020008,0x00030003,
-0xffff0002,0x00020001,0x0001fffe,0xfffdfffc,0xfff6fffa,0xfff4fff4,0xfff0fff1,0xffeaffee,
-0xffe6ffe9,0xffe3ffe9,0xffe0ffe5,0xffdaffe1,0xffd7ffdf,0xffd5ffd9,0xffd5ffd4,0xffd1ffd4,
-0xffd0ffd1,0xffd3ffcb,0xffccffcd,0xffcbffc8,0xffc8ffc7,0xffc4ffc8,0xffc5ffc9,0xffc3ffc4,
-0xffc1ffc2,0xffbdffc2,0xffc1ffc2,0xffbdffbe,0xffbbffba,0xffb6ffb9,0xffb6ffb6,0xffb7ffb7,
-0xffb8ffb8,0xffbaffb8,0xffbbffb6,0xffbcffb9,0xffbfffbd,0xffc2ffbd,0xffc3ffc3,0xffc5ffc6,
-0xffcbffca,0xffcfffcf,0xffd6ffd4,0xffdbffd9,0xffe1ffde,0xffe6ffe6,0xffecffe8,0xfff1ffee,
-0xfffdfff3,0x0002fffd,0x00060003,0x000d000a,0x0016000f,0x00190015,0x001e0019,0x00200021,
-0x00220023,0x00280025,0x002d0029,0x002d002c,0x002f0031,0x002f0030,0x00300031,0x002c0030,
-0x002b0029,0x00280027,0x00240028,0x00230022,0x001f001f,0x0019001a,0x00190019,0x00130019,
-0x00100015,0x000f0015,0x000e0015,0x00110013,0x000f0011,0x0012000d,0x000d000f,0x0013000f,
-0x0014000f,0x00120011,0x00170016,0x00160017,0x00150019,0x00180016,0x00190017,0x001e0019,
-0x001c001b,0x00210020,0x001b0020,0x0019001d,0x00160018,0x00140017,0x00120016,0x00110011,
-0x000e000e,0x000e000c,0x00080008,0x00020001,0xffffffff,0xfffefffe,0xfff9fffa,0xfff0fff6,
-0xffedfff0,0xffecffee,0xffe8ffec,0xffe7ffe8,0xffe6ffe8,0xffe4ffe2,0xffe5ffe2,0xffe2ffdf,
-0xffe0ffdf,0xffe1ffe3,0xffddffdf,0xffdfffe1,0xffdaffe2,0xffdcffd9,0xffdaffda,0xffdbffda,
-0xffddffdb,0xffe0ffda,0xffdcffde,0xffddffdb,0xffe1ffdc,0xffe1ffde,0xffe1ffe3,0xffe5ffe3,
-0xffe5ffe6,0xffe8ffe9,0xffeeffeb,0xfff2fff0,0xfff3fff5,0xfffafff8,0x0000fffc,0x0005fffe,
-0x00050005,0x00060004,0x000c000c,0x000f000f,0x000e0011,0x00110011,0x00120013,0x00120015,
-0x00150015,0x00180014,0x00170013,0x00190016,0x00170018,0x00140015,0x00140013,0x00110012,
-0x00100014,0x000f0010,0x0009000d,0x0004000b,0x00030004,0xfffc0000,0xfff6fff6,0xffecffee,
-0xffe4ffe6,0xffdcffdf,0xffd1ffd9,0xffc6ffcc,0xffbeffc2,0xffb9ffb9,0xffb1ffb4,0xffa9ffa9,
-0xffa0ffa3,0xff99ff9e,0xff95ff96,0xff92ff95,0xff90ff91,0xff91ff8f,0xff94ff92,0xff95ff94,
-0xff98ff98,0xff9bff9c,0xff9eff9d,0xffa7ffa3,0xffadffa8,0xffb4ffb5,0xffb8ffb4,0xffbeffbb,
-0xffc9ffc0,0xffccffcc,0xffd2ffd2,0xffdaffd8,0xffe6ffdc,0xffecffe5,0xfff2ffec,0xfffdfff8,
-0xfffffffd,0x00050007,0x000d000b,0x00150011,0x001d001a,0x0023001d,0x002a0024,0x002c002b,
-0x0033002f,0x00340037,0x003c003a,0x00420041,0x004a0044,0x0052004c,0x00590052,0x00590055,
-0x005a0058,0x005a0059,0x005d005b,0x005e005b,0x005e005d,0x005f005b,0x005b005b,0x0057005b,
-0x00550058,0x00520052,0x004c004e,0x00470049,0x00410049,0x003f0041,0x003b003e,0x003a003e,
-0x00350038,0x00330038,0x00350037,0x00350038,0x00380035,0x00370037,0x003b003a,0x003f0040,
-0x00420044,0x004a004d,0x0052004e,0x005b0057,0x005f005b,0x00620060,0x00630063,0x00670062,
-0x00660069,0x00650064,0x00670066,0x00620062,0x005e0060,0x00590058,0x00530052,0x004b004c,
-0x00440047,0x003a003c,0x00330036,0x002b0030,0x00230025,0x001e0021,0x0015001a,0x00130016,
-0x000e0012,0x000e0010,0x000e0011,0x000a000e,0x000f000b,0x000e000e,0x0010000d,0x0014000f,
-0x00150012,0x00140012,0x00150012,0x00150016,0x00170018,0x00150017,0x00130016,0x00140015,
-0x00110010,0x000b000f,0x0007000b,0x00040004,0xfffffffe,0xfff9fffb,0xfff5fff2,0xfff0ffef,
-0xffebffe9,0xffe7ffe6,0xffe3ffe6,0xffdcffe3,0xffdcffdf,0xffdbffe0,0xffdbffdd,0xffdcffdf,
-0xffdfffde,0xffdcffde,0xffdfffdf,0xffe1ffe0,0xffe2ffe1,0xffe2ffdf,0xffe0ffe1,0xffe2ffdf,
-0xffe2ffe1,0xffddffe0,0xffd9ffda,0xffd4ffd6,0xffcdffd6,0xffcbffce,0xffc1ffc7,0xffbaffbd,
-0xffb0ffb5,0xffa8ffa8,0xffa0ffa5,0xff9aff9b,0xff8eff94,0xff87ff8b,0xff83ff87,0xff7eff7f,
-0xff7dff80,0xff7bff7d,0xff7bff7c,0xff7bff7c,0xff7fff7a,0xff7fff7e,0xff7eff7f,0xff85ff82,
-0xff8aff8b,0xff8fff8e,0xff90ff91,0xff93ff96,0xff98ff95,0xff9cff98,0xff9eff99,0xff9eff9b,
-0xffa1ff9e,0xffa2ffa2,0xffa4ffa4,0xffa2ffa3,0xffa7ffa6,0xffa7ffa8,0xffa9ffa9,0xffacffab,
-0xffafffac,0xffb6ffb2,0xffbcffb7,0xffc1ffbb,0xffc9ffbf,0xffcfffca,0xffd6ffd1,0xffdaffd8,
-0xffdeffd9,0xffe0ffe0,0xffe1ffe2,0xffe5ffe5,0xffe8ffe7,0xffeeffeb,0xffeeffed,0xfff1fff0,
-0xffeeffef,0xffefffef,0xffeafff0,0xffeaffec,0xffeaffee,0xffebffec,0xffe9ffec,0xffe8ffec,
-0xffedffee,0xffeffff1,0xfff6fff1,0xfffdfff8,0x0003fffb,0x000c0003,0x0013000b,0x001b0017,
-0x0023001d,0x002c0028,0x00350032,0x003d003d,0x00480047,0x0050004c,0x005a0056,0x0061005f,
-0x00690065,0x006d0069,0x0072006d,0x00770074,0x007a0078,0x00790079,0x007a0077,0x007a0079,
-0x00750077,0x00790078,0x00790076,0x00770078,0x00730075,0x00710074,0x006f0072,0x006f006f,
-0x006d006d,0x006b006a,0x0065006b,0x00650064,0x00650066,0x00610062,0x005e005f,0x00580058,
-0x00540055,0x004f004f,0x004b004d,0x0046004b,0x00440046,0x003f0040,0x0038003b,0x00340035,
-0x0030002f,0x002f0030,0x002f002e,0x002b002b,0x002b0029,0x00240027,0x00240025,0x00240025,
-0x001f0022,0x001f0022,0x001d001f,0x0018001c,0x0019001b,0x00160017,0x00120016,0x00110013,
-0x00110015,0x000f0014,0x000a000d,0x000a000c,0x0007000a,0x0008000a,0x0009000a,0x00060009,
-0x0007000b,0x00050008,0x00040002,0x00070006,0x00070006,0x00060003,0x00030001,0x00000002,
-0xfffeffff,0xfffcfffa,0xfff3fff5,0xfff0fff3,0xffebffeb,0xffe3ffe2,0xffdbffdf,0xffd6ffd6,
-0xffccffd2,0xffc4ffc5,0xffbdffc0,0xffb4ffba,0xffacffb3,0xffaeffab,0xffa7ffab,0xffa7ffa5,
-0xffa5ffa7,0xffa8ffa6,0xffa6ffa5,0xffa9ffa8,0xffaeffad,0xffb4ffb2,0xffbdffb6,0xffc3ffbd,
-0xffc8ffc2,0xffd1ffce,0xffd6ffd8,0xffe2ffdf,0xffe9ffe8,0xfff0ffef,0xfff7fff4,0xfffafffb,
-0xfffdfffd,0x00040007,0x00040005,0x00080008,0x00080008,0x00090007,0x00090005,0x00040007,
-0x00030002,0x00030003,0x0000fffe,0xfffdffff,0xfff5fffb,0xfff1fff4,0xffeffff4,0xffeaffed,
-0xffe4ffe7,0xffe5ffe7,0xffdeffe4,0xffdfffdd,0xffdcffdc,0xffd5ffd8,0xffd5ffd5,0xffd1ffd3,
-0xffcfffd0,0xffcfffd0,0xffd0ffd4,0xffcfffd1,0xffd3ffce,0xffd6ffd4,0xffdaffd5,0xffdcffda,
-0xffe0ffdc,0xffe3ffdf,0xffe7ffe4,0xffeaffe9,0xfff1fff3,0xfff4fff4,0xfff9fff9,0xfffd0002,
-0xfffe0001,0x00040003,0x00070009,0x0009000e,0x000e000d,0x00100011,0x00130012,0x00150017,
-0x001e0018,0x001c0019,0x0020001d,0x00210021,0x00260022,0x00260028,0x002c0026,0x0030002d,
-0x00330031,0x00390038,0x003b003b,0x003e003e,0x00430041,0x00420044,0x00440043,0x00430046,
-0x00410045,0x00440044,0x00420042,0x003f003f,0x00400040,0x003d003c,0x00370037,0x00320032,
-0x002a002f,0x0028002b,0x00250026,0x001e0021,0x0019001c,0x00160019,0x00110010,0x000d0010,
-0x0007000e,0x00030008,0x00010006,0xffff0003,0xfffd0002,0xfff9fffd,0xfffcfffa,0xfffafffc,
-0xfffafffa,0xfff5fffa,0xfff6fff7,0xfff8fff8,0xfffafff8,0xfff4fff7,0xfff2fff5,0xfff0fff1,
-0xffeeffef,0xffeaffeb,0xffe6ffe9,0xffe3ffe2,0xffdeffe0,0xffd8ffda,0xffd3ffd5,0xffd1ffd1,
-0xffccffcc,0xffcaffca,0xffc7ffc5,0xffc7ffc6,0xffc6ffc7,0xffc2ffc5,0xffbfffc1,0xffbcffc1,
-0xffbbffc0,0xffbcffbf,0xffbfffbe,0xffc0ffbe,0xffc1ffc1,0xffc3ffbf,0xffc5ffc2,0xffc9ffc5,
-0xffc9ffc7,0xffceffcb,0xffd0ffcc,0xffceffd0,0xffd3ffd2,0xffd5ffd7,0xffd7ffd7,0xffd7ffd5,
-0xffddffdc,0xffe1ffe1,0xffe6ffe4,0xffecffe8,0xffefffee,0xffedffee,0xfff0ffef,0xfff4fff3,
-0xfffafff7,0x0001fffb,0x00040003,0x00070006,0x00090006,0x000b000b,0x000d000e,0x00120011,
-0x00140014,0x00140012,0x00140011,0x00160014,0x00170014,0x00160012,0x00110010,0x0012000f,
-0x0012000e,0x000e000d,0x00090009,0x00090005,0x00080005,0x00040004,0xfffd0000,0xfff9fffa,
-0xfff9fff9,0xffeefff7,0xffecfff1,0xffe9ffee,0xffe3ffe9,0xffdeffe2,0xffd9ffde,0xffd9ffd9,
-0xffd9ffd4,0xffd3ffd6,0xffcfffd0,0xffceffcc,0xffcaffcb,0xffcdffcd,0xffcbffcd,0xffcbffcd,
-0xffd4ffd0,0xffd3ffd2,0xffd7ffd3,0xffddffd7,0xffe0ffda,0xffe3ffe0,0xffe9ffe8,0xfff0ffed,
-0xfff8fff7,0xfffafffa,0x0001fffd,0x00050005,0x000d0009,0x00130011,0x00170017,0x001e001c,
-0x0025001f,0x002f002a,0x00330032,0x00370037,0x003d003c,0x0041003f,0x00460040,0x004b0046,
-0x004c004a,0x0051004f,0x00530051,0x00570057,0x00560057,0x0059005a,0x005c005c,0x005e005e,
-0x0061005f,0x00630061,0x00610062,0x00630060,0x00650063,0x00630061,0x00630060,0x00640063,
-0x00620064,0x00630060,0x00650060,0x00620062,0x00630060,0x005f005f,0x005f0062,0x005d0065,
-0x005a005c,0x005b005a,0x0059005b,0x00590056,0x00550056,0x00530054,0x00500050,0x004f0051,
-0x004a004d,0x00460047,0x00430046,0x00400043,0x00400040,0x003e003f,0x00390038,0x00360034,
-0x00320033,0x002f002f,0x002a002e,0x00240029,0x00210024,0x001c0020,0x0018001d,0x00130016,
-0x00110012,0x000a000c,0x00080008,0xffff0001,0xfffbfffc,0xfff2fff7,0xffedffef,0xffe6ffe8,
-0xffe0ffe0,0xffd9ffdb,0xffd3ffd5,0xffcdffcf,0xffcaffc9,0xffc4ffc4,0xffbdffbf,0xffb6ffb7,
-0xffb3ffb2,0xffb0ffaf,0xffabffab,0xffa7ffaa,0xffa3ffa7,0xffa2ffa5,0xffa3ffa4,0xff9fffa0,
-0xffa1ffa0,0xffa4ffa2,0xffa4ffa5,0xffa3ffa3,0xffa6ffa5,0xffabffa8,0xffaaffa9,0xffaeffa8,
-0xffadffb0,0xffadffaf,0xffb2ffb2,0xffb5ffb5,0xffb6ffb5,0xffb3ffb7,0xffb9ffbb,0xffbaffb9,
-0xffbdffbe,0xffc0ffc0,0xffc1ffc0,0xffc4ffc2,0xffc3ffc3,0xffc9ffc4,0xffc8ffc7,0xffc7ffc7,
-0xffc8ffc4,0xffc2ffc5,0xffbfffc2,0xffbdffbe,0xffb9ffb9,0xffb6ffb9,0xffb0ffb4,0xffacffad,
-0xffaaffac,0xffa3ffa5,0xffa4ffa2,0xff9cffa1,0xff9bff9c,0xff9aff98,0xff99ff98,0xff95ff98,
-0xff97ff96,0xff96ff98,0xff9bff9a,0xffa0ffa0,0xffa3ff9f,0xffa7ffa2,0xffb1ffab,0xffb6ffb2,
-0xffbeffbb,0xffc6ffc4,0xffd0ffce,0xffd4ffd3,0xffdaffd7,0xffe2ffdc,0xffe7ffe3,0xffedffec,
-0xfff0ffef,0xfff7fff5,0xfffafffc,0x0001fffc,0x00050005,0x00080007,0x000a0008,0x000f000a,
-0x000f000e,0x00120010,0x00150013,0x00170018,0x00180017,0x001c001c,0x00230020,0x00230024,
-0x00260023,0x002c0026,0x002e002c,0x002f002e,0x00320032,0x00340034,0x003c003a,0x003c003b,
-0x0044003f,0x00420042,0x00420043,0x00450047,0x0048004b,0x004b0047,0x004b0047,0x004b004c,
-0x00480046,0x004a004b,0x004c004d,0x004e004b,0x0051004e,0x004f0050,0x0051004c,0x00510051,
-0x00560052,0x005a0054,0x005d0055,0x0060005a,0x0061005e,0x00660065,0x00670066,0x00690067,
-0x006b0069,0x006c006c,0x006f0070,0x00710071,0x006f0070,0x006f0070,0x006b006e,0x00660069,
-0x00650066,0x00620062,0x00600062,0x0058005b,0x00530055,0x004f004f,0x0048004a,0x00440044,
-0x00400040,0x0037003d,0x00300034,0x0029002b,0x00220025,0x001d0020,0x00180019,0x00100013,
-0x000a000d,0x00050007,0x00010002,0xfff9fffe,0xfff6fff8,0xfff1fff6,0xffecfff0,0xffebffea,
-0xffe6ffe9,0xffe6ffe5,0xffe7ffe5,0xffe5ffe4,0xffe4ffe6,0xffe5ffe6,0xffe4ffe2,0xffe6ffe4,
-0xffe7ffe5,0xffe7ffe5,0xffe6ffe4,0xffe5ffe7,0xffe7ffec,0xffe8ffea,0xffe7ffe8,0xffe5ffe7,
-0xffe4ffe4,0xffe2ffe4,0xffe1ffdf,0xffdeffdd,0xffddffd9,0xffdbffdb,0xffd6ffd8,0xffd5ffd6,
-0xffcdffd1,0xffd0ffd1,0xffceffd1,0xffc8ffd0,0xffc8ffce,0xffcaffcb,0xffc9ffca,0xffc8ffc9,
-0xffc7ffc8,0xffc8ffc8,0xffc4ffc7,0xffc4ffc4,0xffc3ffc2,0xffbeffbf,0xffbeffbd,0xffbeffbe,
-0xffbeffbd,0xffbdffbd,0xffbcffbf,0xffbdffbe,0xffbbffb9,0xffbdffbd,0xffbfffbd,0xffbeffbc,
-0xffbeffbf,0xffbcffc0,0xffbeffbe,0xffc4ffc0,0xffc0ffc4,0xffc8ffc4,0xffcbffc7,0xffd4ffce,
-0xffd4ffd1,0xffddffd7,0xffdfffdb,0xffe8ffe4,0xffeeffec,0xfff4fff7,0xfffffffb,0x00070003,
-0x0010000b,0x00150015,0x001c0019,0x0020001e,0x00250025,0x002b0028,0x002c002c,0x002e002d,
-0x00310030,0x00320032,0x0031002f,0x002a0030,0x002a002b,0x0026002a,0x00220025,0x00220024,
-0x001d001f,0x00180019,0x00150017,0x00100010,0x000c000d,0x0007000a,0x00030005,0x00040004,
-0x00030005,0x0000fffd,0xfffffffc,0xfffdfffd,0xfffffffd,0xfffdffff,0x0001fffe,0xffff0001,
-0x00040004,0x00080007,0x000c0008,0x0010000a,0x0013000f,0x00130012,0x00150012,0x0019001b,
-0x001d001d,0x001d001f,0x00230022,0x00230026,0x00260025,0x00250026,0x002a0026,0x00250025,
-0x00280026,0x00260026,0x00230025,0x00270028,0x00210027,0x00220024,0x00210025,0x001c001e,
-0x001e0021,0x001e0020,0x001a0020,0x001f001c,0x0021001d,0x001f001e,0x001e001d,0x001a001a,
-0x001c0018,0x001a001a,0x001a001b,0x00160019,0x00160015,0x00110014,0x000f0013,0x000e000f,
-0x0007000b,0x00030005,0x0000fffe,0xfffc0002,0xfff4fffb,0xfff0fff3,0xffeafff1,0xffeaffed,
-0xffe6ffe6,0xffe4ffe4,0xffddffdf,0xffdaffda,0xffd7ffd7,0xffd4ffd3,0xffcfffd0,0xffd1ffd2,
-0xffd2ffd2,0xffd2ffd4,0xffd0ffd0,0xffd2ffd0,0xffcfffd1,0xffd4ffd3,0xffd6ffd4,0xffd7ffd7,
-0xffdaffd7,0xffe1ffda,0xffdfffde,0xffdcffde,0xffddffdd,0xffdeffde,0xffddffde,0xffdeffdf,
-0xffdaffe0,0xffddffdb,0xffddffdb,0xffd8ffdb,0xffd3ffd4,0xffd2ffd1,0xffcbffce,0xffc9ffcb,
-0xffc8ffc8,0xffc5ffc6,0xffc5ffc6,0xffc3ffc4,0xffc3ffc3,0xffc3ffc2,0xffc2ffbd,0xffc5ffc1,
-0xffc5ffc5,0xffc6ffc4,0xffcaffc9,0xffceffce,0xffd3ffd2,0xffd4ffd2,0xffdaffd5,0xffddffdc,
-0xffe2ffe0,0xffe3ffe5,0xffe7ffe8,0xffe9ffe7,0xfff1ffed,0xfff0fff3,0xfff6fff6,0xfffbfff9,
-0xfffbfff7,0xfffefffc,0x0002fffb,0x00040000,0x00080002,0x00070002,0x00090006,0x000a000c,
-0x000d000d,0x00110012,0x00100010,0x00130015,0x00140014,0x00160015,0x00170017,0x001b0018,
-0x001b001a,0x00190019,0x001a0017,0x001c001a,0x001d001b,0x001a001c,0x001a001d,0x001b001e,
-0x001e001c,0x001e001d,0x0021001d,0x001c001e,0x001a001c,0x001d001a,0x001b0020,0x001f001f,
-0x00220022,0x00250025,0x00270022,0x00230026,0x00280027,0x002f002b,0x002f002e,0x0033002e,
-0x00330033,0x00330030,0x00350035,0x00360032,0x00340036,0x00330034,0x00320033,0x002d0032,
-0x002a002e,0x0029002d,0x0029002c,0x002a0027,0x00260026,0x00240024,0x00260025,0x00290026,
-0x002c0029,0x002a002c,0x002f002c,0x00310031,0x00380037,0x0039003a,0x003f0039,0x00420041,
-0x00460045,0x004a0049,0x004f004d,0x00510051,0x00500054,0x00510052,0x00520053,0x00510050,
-0x004f004f,0x004f004e,0x004d004c,0x004a004a,0x00430046,0x00400041,0x003d003d,0x0037003b,
-0x00340037,0x00330037,0x002f0031,0x002a002d,0x0029002a,0x00270026,0x00250026,0x00240026,
-0x001e0021,0x001d001c,0x001a001b,0x00140016,0x00110013,0x000b000e,0x00050007,0xfffd0001,
-0xfffcffff,0xfff7fffc,0xfff4fff4,0xfff2fff1,0xffedfff1,0xffe8ffe8,0xffe4ffe6,0xffe3ffe2,
-0xffdfffe3,0xffdbffdf,0xffd6ffd8,0xffd3ffd8,0xffd6ffd2,0xffd2ffd0,0xffcfffce,0xffc9ffc9,
-0xffc6ffc7,0xffbdffc3,0xffbbffba,0xffb4ffb6,0xffb0ffb2,0xffadffaf,0xffa7ffaf,0xffa3ffa5,
-0xffa2ffa1,0xff9cff9d,0xff9bff99,0xff96ff96,0xff93ff94,0xff95ff94,0xff90ff97,0xff8fff93,
-0xff8fff91,0xff92ff93,0xff95ff93,0xff96ff94,0xff9cff96,0xff9bff9c,0xff9fff9f,0xffa3ffa0,
-0xffa9ffa5,0xffabffaa,0xffaeffab,0xffafffaf,0xffb1ffb1,0xffb5ffb8,0xffb8ffb6,0xffbaffba,
-0xffbfffbb,0xffbeffbc,0xffc0ffbe,0xffbfffc3,0xffc3ffc0,0xffc5ffc4,0xffc7ffc3,0xffc9ffc8,
-0xffccffcb,0xffd1ffcd,0xffceffcd,0xffd4ffd1,0xffd7ffd0,0xffd9ffd8,0xffddffd8,0xffe0ffdd,
-0xffe6ffe4,0xffe9ffe8,0xffecffea,0xffedffec,0xffedffed,0xffecffee,0xffedffeb,0xffebffed,
-0xffecffea,0xffe9ffe9,0xffeaffea,0xffe5ffe8,0xffe4ffe7,0xffe3ffe7,0xffe0ffe4,0xffdfffe3,
-0xffe3ffe3,0xffe3ffe6,0xffe7ffe7,0xffeaffe7,0xffedffed,0xfff3fff0,0xfff5fff6,0xfffeffff,
-0x00060006,0x0010000a,0x0016000f,0x0020001b,0x00260021,0x002d0029,0x0034002e,0x00380038,
-0x003c003b,0x0041003b,0x00450041,0x004b0046,0x004b0048,0x004d004d,0x0052004d,0x0051004f,
-0x0050004c,0x0053004f,0x00520053,0x00540050,0x00560054,0x00570055,0x00570058,0x00540057,
-0x005b005a,0x005c005e,0x005e005f,0x005d005f,0x005e005f,0x005c005b,0x005f005c,0x0060005b,
-0x005a0059,0x005b005b,0x005a005b,0x00540056,0x00510053,0x004e0050,0x004b004d,0x004a004b,
-0x0048004a,0x00420045,0x00400041,0x00410042,0x003d003b,0x003b0038,0x003a0038,0x00390039,
-0x00380039,0x0036003b,0x00360036,0x00360037,0x00350036,0x00350037,0x00350037,0x00360037,
-0x00340036,0x00330035,0x00300033,0x00320030,0x002c0030,0x0026002b,0x00220026,0x001f0022,
-0x0019001c,0x00150018,0x00110012,0x000b000d,0x00080007,0x00010004,0xfffaffff,0xfff3fffa,
-0xfff2fff3,0xffefffee,0xffe8ffe8,0xffe0ffe4,0xffdbffe0,0xffd7ffda,0xffcfffd2,0xffceffce,
-0xffcaffcc,0xffc4ffc3,0xffc1ffc2,0xffbdffbe,0xffb9ffb9,0xffb5ffb5,0xffb7ffb5,0xffb5ffb1,
-0xffb2ffb1,0xffb2ffb4,0xffb2ffb6,0xffb3ffb2,0xffb2ffb2,0xffb3ffb2,0xffb5ffb7,0xffbaffb9,
-0xffbdffbd,0xffbfffbe,0xffc2ffbf,0xffcaffc3,0xffcdffc7,0xffd1ffcb,0xffd0ffcf,0xffd4ffd2,
-0xffd4ffd6,0xffd8ffd7,0xffdeffdc,0xffdfffde,0xffdeffdd,0xffe1ffe1,0xffe3ffe3,0xffdfffe1,
-0xffdeffe0,0xffe0ffe0,0xffe1ffdf,0xffdeffdf,0xffdfffdd,0xffdfffdc,0xffdbffdc,0xffd8ffde,
-0xffd2ffd8,0xffd6ffd5,0xffd3ffd5,0xffd0ffd1,0xffd1ffd0,0xffcfffd0,0xffcdffcd,0xffcaffce,
-0xffccffd2,0xffceffce,0xffceffd1,0xffd3ffd1,0xffd4ffd6,0xffdbffd6,0xffdeffdb,0xffdfffde,
-0xffe4ffe1,0xffeaffe7,0xfff0fff0,0xfff8fff0,0xfffffff7,0x0005ffff,0x00090004,0x000e0008,
-0x00170012,0x00180013,0x001a001a,0x001f001e,0x00250024,0x002b0029,0x002c002c,0x00320031,
-0x00350033,0x00390037,0x003a003b,0x003c0039,0x0040003f,0x003e003e,0x0042003e,0x00430042,
-0x003d003f,0x003e003e,0x003d003c,0x003d003d,0x0038003d,0x00360037,0x00330037,0x00300035,
-0x002e0030,0x002b002b,0x0026002a,0x00240023,0x00260024,0x00220023,0x001f001f,0x001d001f,
-0x001d001e,0x0019001b,0x00180019,0x00160018,0x00180018,0x00170018,0x00190019,0x00190019,
-0x00160015,0x001e0019,0x001c0019,0x001e001b,0x0020001b,0x001e001b,0x001e001a,0x001e001d,
-0x001f001e,0x001d001f,0x0021001e,0x00230020,0x00250024,0x00220026,0x00220025,0x00250025,
-0x00250023,0x00220022,0x001e0020,0x001e001d,0x001a0019,0x00100015,0x000c0010,0x0002000a,
-0xfffb0000,0xffeffff9,0xffe9ffef,0xffe0ffe6,0xffdaffdf,0xffceffd9,0xffcaffcf,0xffc6ffc9,
-0xffc2ffbf,0xffbbffbb,0xffb5ffb7,0xffb5ffb5,0xffafffb2,0xffb1ffb0,0xffafffae,0xffb2ffb1,
-0xffb2ffb1,0xffb2ffb2,0xffb8ffb6,0xffbaffbc,0xffbaffbb,0xffbfffbf,0xffc0ffc1,0xffc2ffc2,
-0xffc8ffc3,0xffc9ffc8,0xffcbffcb,0xffcbffcb,0xffcaffc8,0xffcaffca,0xffc9ffcb,0xffcdffcd,
-0xffc9ffcc,0xffceffca,0xffceffce,0xffd2ffd0,0xffd2ffd1,0xffd4ffd6,0xffd6ffd4,0xffdbffd6,
-0xffdbffdc,0xffe0ffde,0xffe6ffe3,0xffebffe7,0xffebffeb,0xffefffee,0xfff4fff2,0xfff6fff6,
-0xfffbfffc,0xfffdfffa,0xfffcfffc,0x0000fffe,0x0001fffe,0xfffdfffe,0xfffefffb,0xfffcfffd,
-0xfff8fffd,0xfff8fff9,0xfff6fff5,0xfff5fff6,0xfff0fff4,0xfff3fff3,0xffedffee,0xffeeffec,
-0xffeefff0,0xffecffed,0xffedffec,0xffefffed,0xfff2ffee,0xfff9fff4,0xfff9fff5,0xfffbfff8,
-0x00010000,0x00070002,0x00080008,0x0011000c,0x0010000f,0x00150016,0x001b0017,0x0020001e,
-0x00230022,0x00250025,0x0029002c,0x002d002d,0x0032002e,0x0034002e,0x00360032,0x00350033,
-0x00370035,0x003a003a,0x003e0039,0x003c003a,0x003b003c,0x003c003e,0x003c003d,0x003c003a,
-0x003a003b,0x003b003d,0x003b0037,0x003c0039,0x00390037,0x00380034,0x00360034,0x00380037,
-0x00310037,0x00320035,0x002e0037,0x002f0033,0x002e0031,0x002e0031,0x002c002b,0x002a002d,
-0x0029002c,0x002a002d,0x002a002a,0x0029002d,0x0028002a,0x0029002d,0x002b002d,0x002c002c,
-0x0032002a,0x0030002d,0x00310030,0x002e002e,0x002e0031,0x002d002d,0x00300031,0x002b002d,
-0x002d002c,0x002a002d,0x002d002e,0x002b0029,0x00280026,0x00240022,0x00240025,0x00230024,
-0x001f0021,0x00230020,0x001e001e,0x001b001a,0x00180017,0x00170016,0x00130014,0x00150014,
-0x00110013,0x000e0012,0x000c0010,0x000a000c,0x000a000a,0x00080006,0x00070007,0x00040006,
-0x00000005,0xffff0001,0xffffffff,0x0000ffff,0xfffc0002,0xfff9fffb,0xfffafffa,0xfff6fff8,
-0xfff5fff4,0xfff7fff7,0xfff0fff3,0xfff3fff1,0xffeefff0,0xffeaffed,0xffedffeb,0xffe5ffe8,
-0xffe3ffe2,0xffe0ffe1,0xffddffde,0xffdbffde,0xffd8ffda,0xffd4ffd6,0xffcfffd3,0xffcfffd0,
-0xffc9ffce,0xffc2ffc5,0xffbcffc0,0xffbcffbe,0xffb7ffbc,0xffb4ffb8,0xffb0ffb7,0xffafffb3,
-0xffaeffb0,0xffaeffaf,0xffacffac,0xffabffa9,0xffadffaa,0xffacffab,0xffabffaa,0xffabffa9,
-0xffacffad,0xffacffab,0xffacffb0,0xffacffab,0xffadffac,0xffacffac,0xffaeffac,0xffafffab,
-0xffafffb0,0xffadffaf,0xffabffaf,0xffadffad,0xffaaffae,0xffacffab,0xffa9ffa9,0xffacffa9,
-0xffacffa9,0xffa8ffa9,0xffaaffab,0xffaeffaf,0xffb3ffb3,0xffb4ffb6,0xffbaffb7,0xffbfffbb,
-0xffc3ffbf,0xffc9ffc2,0xffceffca,0xffd3ffcf,0xffd9ffd4,0xffdeffdb,0xffe4ffe1,0xffebffe8,
-0xfff0ffed,0xfff0fff2,0xfff7fff6,0xfffbfffa,0x0001fffd,0x00040001,0x00040003,0x00090006,
-0x000a0007,0x000a000a,0x000b000b,0x000d000f,0x000e0012,0x00110011,0x00170010,0x001a0016,
-0x001a0017,0x001c001e,0x0021001e,0x00210026,0x00270025,0x00270028,0x00260028,0x0027002a,
-0x002e002d,0x002e0030,0x00330035,0x00370036,0x00390038,0x003b0038,0x003b0038,0x003d0039,
-0x003c003e,0x0042003f,0x00420042,0x00430040,0x00430043,0x00440043,0x00490048,0x00490049,
-0x00490048,0x00490048,0x0049004b,0x004a0046,0x004a0049,0x004a004a,0x004a004a,0x004b004a,
-0x0048004b,0x00490049,0x004a004a,0x004c0047,0x004c004c,0x004b004e,0x004b004e,0x004d004f,
-0x0052004f,0x0052004d,0x00510052,0x00550053,0x00570054,0x00540051,0x00530050,0x0051004f,
-0x004e0050,0x004d0052,0x004a004c,0x00440047,0x00400044,0x0039003d,0x00310038,0x002a002e,
-0x00240024,0x001e001f,0x00160019,0x000e0012,0x0009000c,0x00030006,0xffff0002,0xfff7fffd,
-0xfff8fff8,0xfff6fff3,0xfff3fff2,0xfff3fff4,0xfff2fff0,0xfff5fff3,0xfff6fff4,0xfff5fff8,
-0xfff7fff8,0xfff7fff8,0xfff4fff6,0xfff8fff1,0xfff7fff8,0xfff4fffa,0xfff8fffa,0xfff8fffa,
-0xfff6fff5,0xfff4fff6,0xfff6fff6,0xfff5fff6,0xfff4fff3,0xfff4fff4,0xfff3fff1,0xffeeffec,
-0xffefffeb,0xffebffe7,0xffe8ffe7,0xffe0ffe2,0xffdcffda,0xffdbffd8,0xffd0ffd6,0xffcbffce,
-0xffc8ffcb,0xffc0ffc5,0xffb9ffbc,0xffb4ffb9,0xffaeffb1,0xffa9ffae,0xffa4ffa6,0xff9effa0,
-0xff9fff9d,0xff9aff9c,0xff99ff99,0xff9aff97,0xff9dff98,0xff99ff9a,0xff9dff9e,0xff9eff9e,
-0xffa1ffa2,0xffa7ffa3,0xffaaffa9,0xffaeffa9,0xffb2ffaf,0xffb6ffb2,0xffbeffb8,0xffc2ffbf,
-0xffc7ffc6,0xffc9ffca,0xffd1ffd0,0xffd7ffd5,0xffdfffda,0xffdfffdf,0xffe6ffe1,0xffeeffe9,
-0xfff0ffec,0xfff6fff1,0xfff8fff6,0xfffbfffa,0xfffdffff,0x00010004,0x00060005,0x000b000a,
-0x000d000b,0x000e000e,0x00170010,0x00150019,0x0018001a,0x00180017,0x001c0018,0x001e001b,
-0x001d001c,0x001d001d,0x00230021,0x001d001f,0x001e001f,0x001c001d,0x0019001d,0x001a001a,
-0x001c001a,0x00180017,0x00180017,0x00140016,0x00170019,0x00170018,0x00160018,0x00190019,
-0x001a0015,0x001d001a,0x001e001e,0x001f001f,0x00240022,0x002a0025,0x002c0029,0x0031002d,
-0x0032002f,0x00340033,0x00360036,0x003b003a,0x003c003d,0x003d0040,0x0041003f,0x00410043,
-0x00440043,0x00470049,0x00410045,0x00440042,0x003f0044,0x0041003f,0x003d003e,0x0038003a,
-0x00320038,0x002d002f,0x002d002c,0x00280028,0x00210021,0x001b001d,0x0014001c,0x00110014,
-0x000a000e,0x000a000d,0x00060008,0x00010004,0xfffbfffe,0xfffafff9,0xfff8fff9,0xfff9fff9,
-0xfff8fff6,0xfff6fff6,0xfff7fff5,0xfff7fff7,0xfff3fff6,0xfff4fff4,0xfff9fff7,0xfff9fffa,
-0xfff7fffb,0xfffafffb,0xfff8fff9,0xfffbfffa,0xfffbfff8,0xfff9fff7,0xfffafff6,0xfff6fff8,
-0xfff5fff9,0xfff3fff5,0xfff1fff3,0xffeffff1,0xffebffec,0xffedffea,0xffe8ffe7,0xffe7ffe5,
-0xffe4ffdd,0xffe1ffdd,0xffdbffdc,0xffdaffd9,0xffd4ffd6,0xffd1ffd4,0xffc9ffcd,0xffc9ffca,
-0xffc7ffc6,0xffc5ffc8,0xffc3ffc3,0xffc1ffc3,0xffc1ffc1,0xffc0ffc2,0xffbdffc0,0xffbeffbf,
-0xffbcffba,0xffbcffbb,0xffbbffbc,0xffbaffbc,0xffbeffbd,0xffc2ffc0,0xffc4ffc3,0xffc7ffc3,
-0xffc7ffc6,0xffcaffc8,0xffd1ffcc,0xffd4ffd0,0xffd5ffd8,0xffd7ffd9,0xffdbffd9,0xffe0ffdd,
-0xffe2ffdf,0xffe3ffe2,0xffe6ffe4,0xffe9ffe9,0xffebffe8,0xffebffea,0xffebffed,0xffeaffea,
-0xffecffec,0xffecffeb,0xffecffed,0xffecffed,0xffebffe8,0xffefffee,0xffedffeb,0xfff1ffee,
-0xffeefff1,0xfff0fff1,0xfff3fff0,0xfff5fff3,0xfff7fff4,0xfffdfff9,0xfff7fffd,0xfffdfffc,
-0x0000fffd,0x00050004,0x00040005,0x00080008,0x00090009,0x00090006,0x000c0006,0x000e000c,
-0x000f000b,0x000e000b,0x00130010,0x00120012,0x00120011,0x00150012,0x00160017,0x00180015,
-0x001b0015,0x001b0019,0x001f0022,0x00230021,0x00250024,0x00270025,0x002c0028,0x002e002f,
-0x002f0031,0x00310034,0x00320032,0x00330035,0x00370037,0x00360036,0x00390034,0x003b0036,
-0x003a0038,0x003c0038,0x0039003b,0x0037003c,0x0039003a,0x003c003b,0x003d003d,0x003e003d,
-0x003e003b,0x003c003c,0x003a003a,0x003b003c,0x003d003c,0x003b003a,0x00380038,0x00350037,
-0x00380038,0x00380039,0x00340037,0x00340035,0x00300033,0x00320031,0x002d0030,0x0030002f,
-0x002c002f,0x002d002d,0x002c0028,0x00280028,0x00260029,0x00240027,0x00260027,0x00250027,
-0x00240025,0x00240026,0x00230024,0x001f0022,0x00220020,0x00220021,0x0024001d,0x001e001d,
-0x001e001b,0x001f001b,0x001d001a,0x001c0018,0x001c0019,0x00170017,0x00140013,0x00120012,
-0x00150011,0x0010000e,0x000d000c,0x0008000c,0x00050009,0x00030002,0xfffe0002,0xfffa0000,
-0xfffafffb,0xfff7fffa,0xfff1fff3,0xffedffef,0xffedffed,0xffe5ffeb,0xffe3ffe4,0xffdeffe1,
-0xffdaffda,0xffd8ffda,0xffd6ffd6,0xffd3ffd3,0xffcfffd0,0xffcdffd0,0xffceffcc,0xffc9ffcb,
-0xffc9ffc9,0xffc7ffc8,0xffc6ffc6,0xffc6ffc6,0xffc4ffc6,0xffc4ffc5,0xffc2ffc2,0xffc5ffc6,
-0xffc3ffc2,0xffc5ffc3,0xffc3ffc2,0xffc6ffc0,0xffc5ffc5,0xffc7ffc3,0xffc6ffc8,0xffcaffc6,
-0xffcfffcb,0xffceffcc,0xffd0ffd1,0xffd5ffd4,0xffd7ffd5,0xffd8ffd5,0xffd8ffd8,0xffd9ffd8,
-0xffd8ffd8,0xffdaffda,0xffdaffdb,0xffdbffda,0xffd8ffda,0xffd5ffd6,0xffd6ffd7,0xffd8ffd6,
-0xffd2ffd4,0xffd4ffd1,0xffd4ffd3,0xffd2ffd6,0xffcfffd2,0xffd3ffd2,0xffd4ffd5,0xffd1ffd4,
-0xffd5ffd7,0xffd6ffd5,0xffd8ffd6,0xffdeffd7,0xffdfffdc,0xffe0ffdf,0xffdfffdf,0xffe3ffe4,
-0xffe8ffe4,0xffe8ffe9,0xffeaffe9,0xffeeffeb,0xffeefff0,0xffeeffef,0xffeeffee,0xfff2ffef,
-0xfff2fff0,0xfff2ffef,0xffeffff2,0xfff1fff1,0xfff5fff7,0xfff8fff8,0xfff9fffb,0xfffcfffe,
-0x00010000,0x00020006,0x00070005,0x000f0009,0x0012000d,0x00160011,0x001c0017,0x001d0019,
-0x001f001f,0x00220022,0x00280028,0x002b002b,0x002d002d,0x002e002f,0x0031002f,0x00310031,
-0x0031002f,0x00320030,0x002e002d,0x002d002c,0x002a0028,0x002b002a,0x00280026,0x00250025,
-0x00220026,0x00210026,0x001f0020,0x00210021,0x00230021,0x001f0022,0x00220020,0x00220022,
-0x00230021,0x00210024,0x00250022,0x00230025,0x00220023,0x00250022,0x00240025,0x00260023,
-0x00270027,0x00250024,0x00230026,0x00220027,0x00240026,0x00230023,0x00240023,0x00270023,
-0x00270026,0x00240025,0x00230024,0x001e0021,0x00210021,0x001a001c,0x001f001a,0x0018001a,
-0x00130014,0x00120015,0x000e0011,0x000a000e,0x0007000a,0x00040006,0x00050004,0x00010001,
-0xfffffffc,0xfff7fffa,0xfff5fff7,0xfff1fff3,0xfff2fff3,0xfff0fff2,0xffefffef,0xffecffec,
-0xffecffef,0xfff1ffee,0xffebffeb,0xffecffec,0xffedffee,0xffeeffed,0xffeefff0,0xffeffff0,
-0xfff0fff7,0xffeffff2,0xffedffef,0xfff4ffef,0xfff2fff3,0xfff2ffed,0xfff2ffef,0xffedfff0,
-0xffecffea,0xffe9ffeb,0xffe9ffe9,0xffe4ffe6,0xffe5ffe8,0xffe0ffe2,0xffdeffdf,0xffe0ffdf,
-0xffddffe0,0xffdbffda,0xffd9ffda,0xffd6ffd8,0xffd6ffd7,0xffd4ffd3,0xffd5ffd5,0xffd3ffd1,
-0xffd2ffd1,0xffceffd0,0xffcdffcd,0xffccffcc,0xffceffcb,0xffceffce,0xffccffce,0xffccffce,
-0xffcdffcc,0xffd0ffd0,0xffcdffd1,0xffcfffd0,0xffd0ffcf,0xffd6ffd3,0xffd6ffd4,0xffd9ffd3,
-0xffdeffd9,0xffe4ffe0,0xffe5ffe5,0xffebffe9,0xffedffe9,0xfff1ffee,0xfff7fff2,0xfffafff7,
-0x0000fffd,0x00070001,0x00080008,0x000d0009,0x000e000b,0x00120011,0x00150014,0x00170016,
-0x0018001a,0x001a001b,0x001d001d,0x001d001c,0x0021001f,0x0021001f,0x00210020,0x00240022,
-0x00230023,0x00270026,0x00260026,0x00260025,0x00240027,0x00260027,0x002b0029,0x00280029,
-0x00240025,0x00240024,0x00200022,0x001f0022,0x00210021,0x001f001f,0x0021001f,0x0020001c,
-0x0025001f,0x001d0020,0x001f0022,0x00230025,0x00220023,0x00260026,0x00250027,0x00240027,
-0x00240028,0x00250028,0x00250027,0x00250028,0x00290026,0x00280028,0x00260028,0x00260025,
-0x00250024,0x00240022,0x00240023,0x00240025,0x00250025,0x00260024,0x00260025,0x00260027,
-0x00250026,0x00250027,0x00260029,0x00280029,0x0028002a,0x00260028,0x00280027,0x00250026,
-0x00210027,0x001c0020,0x001c001d,0x0019001a,0x001a001a,0x00150017,0x00130015,0x00130014,
-0x000c0011,0x000c000c,0x0009000c,0x00070006,0x00040004,0xffff0001,0x00020001,0xfffbfffc,
-0xfff5fffa,0xfff6fff5,0xfff5fff5,0xfff0fff1,0xffefffef,0xffecffec,0xffecffeb,0xffebffea,
-0xffe8ffe5,0xffe7ffe4,0xffe3ffe4,0xffe2ffe3,0xffe4ffe5,0xffe3ffe8,0xffe2ffe4,0xffe5ffe3,
-0xffe4ffe3,0xffe6ffe3,0xffe3ffe3,0xffe3ffe1,0xffe1ffe2,0xffdfffe2,0xffe0ffe2,0xffe0ffe3,
-0xffdbffdf,0xffdaffde,0xffd7ffda,0xffd8ffd7,0xffd3ffd4,0xffd1ffd1,0xffd0ffcf,0xffcfffcb,
-0xffcaffc8,0xffc7ffc8,0xffc8ffc7,0xffc8ffc4,0xffc5ffc7,0xffc2ffc6,0xffc3ffc6,0xffc4ffc7,
-0xffc5ffc4,0xffc4ffc5,0xffc4ffc6,0xffc4ffc5,0xffc6ffc6,0xffc6ffc6,0xffc9ffc4,0xffc5ffc6,
-0xffc9ffc7,0xffc3ffc3,0xffc5ffc2,0xffc4ffc6,0xffc5ffc2,0xffc4ffc7,0xffc8ffc7,0xffcaffc8,
-0xffcaffc9,0xffcaffcd,0xffceffd0,0xffd1ffd0,0xffd2ffd1,0xffd5ffcf,0xffd5ffd6,0xffd6ffd4,
-0xffd8ffd6,0xffdaffd7,0xffddffdb,0xffdeffe0,0xffe1ffe0,0xffe5ffe1,0xffe6ffe2,0xffe8ffe4,
-0xffeaffe8,0xffeeffed,0xfff3fff0,0xfff7fff5,0xfff7fff8,0xfffffffd,0x00040000,0x00080004,
-0x000a0009,0x000f000c,0x00160014,0x00170016,0x00190018,0x001f001e,0x001f001f,0x00220022,
-0x00240023,0x00290028,0x00280028,0x00290028,0x002a0027,0x0029002d,0x002d002f,0x002a002d,
-0x0028002b,0x002e002b,0x0031002e,0x002b0031,0x0030002f,0x00340033,0x00340033,0x00340032,
-0x00370037,0x00350034,0x00390037,0x00360036,0x00360034,0x00380037,0x00350038,0x00380037,
-0x00390038,0x00380037,0x00390039,0x003b003d,0x0039003a,0x0038003b,0x0039003a,0x0038003a,
-0x00370036,0x00350036,0x00360037,0x00320034,0x00340034,0x002f0031,0x002d002c,0x002a0029,
-0x0027002a,0x002b0029,0x00260028,0x00250026,0x00230028,0x00210022,0x00210026,0x00240023,
-0x00210021,0x0024001d,0x00220022,0x0021001e,0x001e001d,0x001a001b,0x001e001c,0x001a001b,
-0x001b001c,0x0018001c,0x00170017,0x00130013,0x000b0011,0x000b000c,0x0009000a,0x00030004,
-0x00020003,0x00000002,0xfff7fffb,0xfff5fff9,0xfff5fff7,0xfff1fff2,0xffedffee,0xfff0ffed,
-0xffeeffee,0xffebffee,0xffedffec,0xffecffed,0xffe7ffeb,0xffe7ffe9,0xffeaffea,0xffe9ffeb,
-0xffedffea,0xfff0ffea,0xffecfff0,0xffefffec,0xfff1fff0,0xfff5fff2,0xfff1fff1,0xfff3fff2,
-0xfff2fff3,0xfff4fff3,0xfff1fff0,0xffefffee,0xffebfff1,0xffeaffed,0xffe6ffe8,0xffe4ffe8,
-0xffdfffe0,0xffdcffdd,0xffd7ffd9,0xffd6ffd8,0xffd4ffd5,0xffd0ffd0,0xffcdffcb,0xffc8ffc9,
-0xffc6ffc7,0xffc8ffc9,0xffcaffcc,0xffcbffcb,0xffd2ffcf,0xffd3ffd0,0xffd6ffd3,0xffd4ffd7,
-0xffd5ffd7,0xffdaffd9,0xffdfffdd,0xffdfffdd,0xffe4ffde,0xffe3ffe1,0xffe7ffe3,0xffe8ffe5,
-0xffeaffe6,0xffeaffe9,0xffeaffe8,0xffebffec,0xfff0ffed,0xfff1fff1,0xfff3fff3,0xfff1fff4,
-0xfff4fff5,0xfff6fff7,0xfffafff8,0xfff9fffb,0xfffafffa,0xfffbfffc,0xfffbfffc,0xfff9fffc,
-0xfffafff9,0xfff8fffc,0xfff6fffc,0xfff6fff8,0xfff8fff6,0xfff6fff7,0xfff6fff4,0xfff1fff2,
-0xfff7fff2,0xfff4fff2,0xfff2fff3,0xfff0fff1,0xfff5fff7,0xfff4fff6,0xfff4fff7,0xfff7fff9,
-0xfffefff7,0x0001fffc,0x0001fffd,0x00040001,0x00080005,0x00080007,0x000d000b,0x000f0010,
-0x0011000f,0x00130012,0x00130016,0x00180016,0x0018001a,0x001b001a,0x001b0018,0x00190017,
-0x001d001b,0x001f001c,0x001b001b,0x0019001a,0x001c001c,0x001d001f,0x001b001e,0x0019001d,
-0x001f001e,0x001b001c,0x001a001e,0x001c001a,0x001d001e,0x001f001e,0x001d001d,0x001a001c,
-0x001b001f,0x001a001b,0x0018001b,0x00180019,0x001c001a,0x001b0019,0x00170017,0x00160015,
-0x00140015,0x00130015,0x000e0012,0x000a000d,0x0009000a,0x00050007,0x00020001,0x0001fffd,
-0xfffdfffd,0xfff9fffb,0xfff7fffa,0xfff8fff6,0xfff5fff5,0xfff3fff4,0xfff5fff6,0xfff5fff7,
-0xfff7fff7,0xfff7fff6,0xfff7fff8,0xfff8fff8,0xfffafffa,0xfffbfffb,0xfffafff8,0xfffafffa,
-0xfffafffa,0xfffcfffb,0xfff9fffb,0xfffafffa,0xfffcfff9,0xfffbfff8,0xfffbfff9,0xfff9fffb,
-0xfff5fff8,0xfff6fff4,0xfff5fff3,0xfff2fff4,0xfff2fff0,0xfff2ffef,0xffeffff2,0xffefffef,
-0xffebffef,0xffebffed,0xffeaffeb,0xffe9ffe9,0xffe6ffe5,0xffe7ffea,0xffe4ffe5,0xffe8ffe4,
-0xffe2ffe4,0xffe4ffe3,0xffe5ffe2,0xffe4ffe3,0xffe0ffe4,0xffe3ffe3,0xffe4ffe5,0xffe2ffe3,
-0xffe5ffe3,0xffe7ffe9,0xffe6ffe7,0xffe6ffe8,0xffe5ffe8,0xffeaffe7,0xffe8ffe7,0xffebffe9,
-0xffebffe9,0xffedffea,0xffefffee,0xfff0ffee,0xfff4fff5,0xfff5fff3,0xfff8fff7,0xfffbfffb,
-0xfffcfffb,0xffffffff,0x00010002,0x00020002,0x00090004,0x00070006,0x00050004,0x000c0008,
-0x000b0009,0x000b000a,0x000c000a,0x000b000d,0x000e000d,0x000e0011,0x000e0011,0x00110011,
-0x00160017,0x00160014,0x00170013,0x00160017,0x00190014,0x001a0016,0x001c0019,0x001a001a,
-0x001c001d,0x001c001f,0x001a0021,0x001e0021,0x00220022,0x00200021,0x00240022,0x00260024,
-0x00280028,0x0027002a,0x002a002a,0x002a002b,0x002c002c,0x002e002b,0x002e002d,0x00300030,
-0x00310030,0x00340030,0x00320031,0x00330031,0x0031002e,0x0031002f,0x0030002f,0x002f0030,
-0x002e0032,0x002c002f,0x0029002f,0x0024002f,0x0025002b,0x0025002a,0x00270027,0x00240026,
-0x00260023,0x0027001e,0x0025001f,0x00230020,0x001d001f,0x00200020,0x001c0020,0x001a001e,
-0x0018001d,0x0017001b,0x00180019,0x00140014,0x00100010,0x000c000c,0x000a000a,0x00040005,
-0x00010003,0x00000002,0xfffafffe,0xfff9fffb,0xfff6fffb,0xfff2fff2,0xffedffef,0xffe7ffe9,
-0xffe5ffe6,0xffe4ffe6,0xffe2ffe1,0xffe1ffe1,0xffdcffdf,0xffd9ffdb,0xffd5ffd7,0xffd5ffd3,
-0xffd4ffd6,0xffd2ffd1,0xffd0ffce,0xffccffce,0xffceffcb,0xffcdffcb,0xffcdffca,0xffccffc9,
-0xffceffc9,0xffcbffc8,0xffceffcb,0xffcbffce,0xffcbffcd,0xffcbffcc,0xffcbffcf,0xffccffce,
-0xffcfffce,0xffd1ffd0,0xffd3ffd1,0xffd1ffd2,0xffd1ffcf,0xffd0ffd0,0xffcfffce,0xffd1ffce,
-0xffd0ffcd,0xffcdffcf,0xffcbffce,0xffcbffcf,0xffcdffcc,0xffcfffcd,0xffcaffcc,0xffcaffcb,
-0xffc7ffc9,0xffc4ffc9,0xffc4ffc5,0xffc2ffc0,0xffc3ffc1,0xffbfffbf,0xffbeffbd,0xffbdffbc,
-0xffbeffbc,0xffbeffbf,0xffc0ffc0,0xffc1ffc2,0xffc2ffc5,0xffc6ffc8,0xffcbffc9,0xffcdffcb,
-0xffd1ffcf,0xffd6ffd5,0xffdbffdc,0xffe1ffde,0xffe9ffe6,0xffeaffe3,0xffecffe8,0xfff1ffee,
-0xfff1fff1,0xfffbfff4,0xfff9fffa,0xfffdfffa,0xfffe0001,0x00000001,0x00030007,0x00070008,
-0x000b0007,0x000c000c,0x000a000a,0x0010000d,0x00130012,0x00140014,0x00190016,0x001b001c,
-0x001f001b,0x0022001f,0x00240024,0x00240025,0x0027002a,0x00260028,0x002e002e,0x0032002e,
-0x00310031,0x0031002e,0x00330032,0x00330033,0x00320030,0x00320032,0x00370032,0x00370034,
-0x00370038,0x00360035,0x00360037,0x00380036,0x00370038,0x00360039,0x0039003a,0x0036003a,
-0x003a003a,0x003c003a,0x003b003c,0x003c003a,0x003d003c,0x003d003d,0x00400040,0x0042003f,
-0x0040003f,0x0040003f,0x00410044,0x003e0040,0x0042003e,0x00420042,0x003f0041,0x00400042,
-0x003f0040,0x003e003e,0x003e0040,0x003a003b,0x00390039,0x0037003b,0x00340036,0x00330033,
-0x002a002f,0x002c002d,0x0027002a,0x00210024,0x001e0020,0x001a001b,0x00160016,0x00170016,
-0x00100012,0x000e0010,0x000c000e,0x00080009,0x00090009,0x00080009,0x00040004,0x00050005,
-0x00040003,0x0004ffff,0xffffffff,0xfffffffc,0xfffafff6,0xfffbfffd,0xfff9fffb,0xfff7fffa,
-0xfff9fffc,0xfff7fffa,0xfff7fff7,0xfffafff7,0xfff5fff8,0xfff2fff5,0xfff2fff3,0xfff2fff1,
-0xfff1ffee,0xffeeffef,0xffecffec,0xffeaffea,0xffe5ffe7,0xffe3ffe4,0xffdeffe0,0xffdeffde,
-0xffdcffdd,0xffd5ffd7,0xffd2ffd1,0xffcfffd1,0xffcaffcc,0xffc9ffce,0xffcaffcb,0xffc9ffc8,
-0xffc7ffc9,0xffccffc8,0xffc8ffc8,0xffc6ffc7,0xffc8ffc8,0xffcbffc9,0xffc7ffc8,0xffc9ffca,
-0xffcaffc8,0xffc7ffc8,0xffc8ffc8,0xffc9ffc7,0xffc9ffc8,0xffc4ffc2,0xffc7ffc6,0xffc8ffc7,
-0xffc7ffc8,0xffccffc9,0xffceffcb,0xffccffcd,0xffcfffcc,0xffd2ffd2,0xffd4ffd2,0xffd4ffd3,
-0xffdaffdb,0xffdaffdd,0xffdfffdf,0xffe3ffe1,0xffe9ffe6,0xffeeffeb,0xfff1ffee,0xfff7fff0,
-0xfff6fff5,0xfffcfffb,0xfffdfffe,0x00010004,0x00050006,0x0009000b,0x000b000c,0x000e000d,
-0x000f000e,0x00100010,0x00130010,0x00130012,0x00140013,0x00150013,0x00120013,0x0011000e,
-0x00110012,0x000f000d,0x000c000c,0x0006000b,0x00040008,0x00060008,0x00050005,0x00010003,
-0x00010005,0xffff0003,0x00020000,0x00010000,0xffffffff,0x0000fffe,0x00030001,0x00020003,
-0x00050007,0x00070007,0x000d0008,0x000f000c,0x00100010,0x00130010,0x00140015,0x00160014,
-0x00160018,0x001b0019,0x001b0018,0x001c001d,0x001d001e,0x0020001d,0x001e001d,0x0020001c,
-0x00200020,0x00220022,0x001f0021,0x0020001d,0x0021001e,0x0020001f,0x001e001d,0x001e001f,
-0x001f001d,0x001b001e,0x0019001a,0x001a001d,0x0017001b,0x0018001c,0x0016001a,0x001b001a,
-0x00180018,0x00180019,0x00180018,0x00190019,0x00150017,0x00190011,0x00180016,0x00150013,
-0x00130016,0x00120016,0x00110014,0x00100011,0x000b000a,0x000d000c,0x0008000c,0x00080008,
-0x00050008,0x00060004,0x00040005,0xffffffff,0xfffbfffc,0xfff9fffb,0xfff7fffb,0xfff5fff7,
-0xfff4fff5,0xfff1fff1,0xfff3fff2,0xfff1fff3,0xfff0ffee,0xfff0ffed,0xffedffec,0xffebffec,
-0xffe9ffec,0xffecffeb,0xffeaffeb,0xffeaffec,0xffe7ffe7,0xffe8ffe6,0xffe6ffe8,0xffe3ffe8,
-0xffe2ffe3,0xffdfffdf,0xffe1ffe1,0xffe1ffe1,0xffdfffdd,0xffdcffdd,0xffdaffd7,0xffd8ffda,
-0xffd9ffd9,0xffd6ffd6,0xffd4ffd3,0xffd0ffd0,0xffd0ffd2,0xffd1ffd2,0xffd2ffd2,0xffd0ffcf,
-0xffd2ffd0,0xffd3ffd2,0xffd6ffd2,0xffd6ffd5,0xffd6ffd5,0xffd9ffd9,0xffdeffde,0xffdeffe1,
-0xffe0ffe1,0xffe4ffe3,0xffe5ffe7,0xffeaffe8,0xffebffeb,0xffebffea,0xffefffef,0xfff2fff2,
-0xfff3fff8,0xfff7fff7,0xfff6fff8,0xfffafff8,0xfff8fffa,0xfffbfff8,0x0000fffa,0xffff0001,
-0x0000fffe,0x00010000,0x0001fffe,0x00000000,0x00020001,0x00030003,0x00030003,0x00030009,
-0x00030006,0x00070009,0x0009000a,0x000b000b,0x000a000a,0x00090009,0x000d000b,0x000e000c,
-0x000d000c,0x0010000f,0x000e0011,0x0012000e,0x0010000e,0x000f000e,0x00130013,0x00150013,
-0x00140014,0x00170019,0x0019001c,0x001a001e,0x001d001e,0x00200021,0x00210022,0x00240022,
-0x00230024,0x00270026,0x00250028,0x00240025,0x00250025,0x00230025,0x00240025,0x00220025,
-0x001e0022,0x001e0022,0x001f001f,0x001e001c,0x0021001f,0x001f001d,0x001b001d,0x001e0019,
-0x001b001a,0x0020001c,0x001f0020,0x001f001e,0x00240024,0x00280026,0x0026002b,0x002b0029,
-0x002f002c,0x00310031,0x00350031,0x00350031,0x00370035,0x00380037,0x00380038,0x0038003a,
-0x0034003a,0x00360037,0x00350035,0x00340035,0x00350032,0x002d0030,0x002b002d,0x00260029,
-0x0027002a,0x00240027,0x001f0022,0x00200021,0x001d0020,0x001d001d,0x0019001c,0x00190017,
-0x00180017,0x00170015,0x00140015,0x000f0013,0x000d0010,0x000b000b,0x00050008,0x00030003,
-0xfffb0000,0xfff8fffb,0xfff8fff8,0xfff2fff7,0xfff1fff3,0xffefffef,0xffedffed,0xffeaffea,
-0xffe3ffe9,0xffe4ffe8,0xffe4ffe4,0xffe1ffe4,0xffdcffe1,0xffdcffe1,0xffdeffdb,0xffdcffdc,
-0xffd9ffdb,0xffd8ffd9,0xffd5ffd3,0xffd2ffd4,0xffd3ffd1,0xffd0ffce,0xffc9ffcb,0xffc7ffcc,
-0xffc2ffc7,0xffc3ffc4,0xffbdffc0,0xffb8ffbc,0xffb6ffba,0xffb5ffb8,0xffb6ffb5,0xffb6ffb4,
-0xffb6ffb1,0xffb4ffb2,0xffb3ffb3,0xffb4ffb4,0xffb6ffb6,0xffbaffbc,0xffbaffba,0xffbdffbe,
-0xffbeffbc,0xffc0ffbf,0xffc2ffc3,0xffc5ffc3,0xffc8ffc5,0xffc8ffc9,0xffc8ffc6,0xffc8ffc8,
-0xffcaffc9,0xffcdffc8,0xffd3ffce,0xffd0ffcd,0xffd2ffce,0xffd4ffd0,0xffd1ffd3,0xffd7ffd0,
-0xffd8ffd5,0xffd9ffd5,0xffdeffd9,0xffdfffdc,0xffdeffde,0xffe1ffe2,0xffe2ffe4,0xffe4ffe9,
-0xffe7ffe7,0xffeaffe7,0xffecffe9,0xffefffec,0xffeeffec,0xffeeffef,0xfff0fff3,0xfff0ffef,
-0xfff1fff0,0xfff3ffee,0xfff3ffef,0xfff4fff1,0xfff4fff0,0xfff3fff0,0xfff1fff0,0xfff2fff2,
-0xfff1fff3,0xfff3fff4,0xfff1fff0,0xfff4fff4,0xfff7fff4,0xfffcfffa,0xfffdfffc,0x0001fffe,
-0x00060002,0x000a0005,0x000b000b,0x00100013,0x00140017,0x001a001c,0x00200020,0x00240022,
-0x00270028,0x002d002e,0x002f0031,0x00330035,0x00390034,0x003b0037,0x0038003b,0x0040003a,
-0x003d0040,0x003c003c,0x003e003f,0x0041003f,0x00400042,0x00410040,0x00460044,0x00450046,
-0x00480043,0x004b0046,0x004c004b,0x004a004b,0x004c004d,0x004b0052,0x004b004f,0x004c004e,
-0x004b004b,0x0048004c,0x00450049,0x00440047,0x00410048,0x003d0040,0x003e003c,0x0039003c,
-0x00370037,0x00340035,0x00330033,0x00330031,0x002f0031,0x002d002a,0x002c002a,0x0029002a,
-0x0028002a,0x00290029,0x00270029,0x00280028,0x0028002a,0x00270029,0x00230028,0x00230024,
-0x00250024,0x00200021,0x001e001d,0x001c001e,0x001a001c,0x00190016,0x00160016,0x00120017,
-0x00100010,0x000d0012,0x000b000c,0x00070007,0x00010004,0x00010005,0xfffefffe,0xfffc0000,
-0xfff7fff5,0xfff4fff3,0xffeffff2,0xffeaffeb,0xffeaffec,0xffe4ffea,0xffdfffe5,0xffd9ffe2,
-0xffdaffde,0xffd7ffd9,0xffd6ffd7,0xffd0ffd4,0xffd2ffd0,0xffd0ffd1,0xffceffcb,0xffcdffca,
-0xffccffca,0xffcbffcb,0xffcaffc9,0xffcaffcb,0xffccffce,0xffcdffca,0xffcbffcc,0xffccffc9,
-0xffcdffcc,0xffcfffcc,0xffd0ffcd,0xffd3ffd1,0xffd1ffd3,0xffd6ffd5,0xffd7ffd6,0xffdaffda,
-0xffd9ffdc,0xffdbffdd,0xffddffdc,0xffddffdc,0xffdfffdc,0xffdfffde,0xffdfffdd,0xffdcffde,
-0xffdfffdf,0xffddffe2,0xffe1ffdc,0xffe1ffdd,0xffddffdb,0xffdbffd9,0xffdaffd7,0xffd7ffd8,
-0xffd3ffd6,0xffd2ffd3,0xffd5ffd6,0xffd7ffd3,0xffd5ffd5,0xffd5ffd1,0xffd2ffd0,0xffd3ffd3,
-0xffd0ffd1,0xffd3ffd4,0xffd4ffd4,0xffd7ffd8,0xffdaffdb,0xffe0ffdd,0xffe0ffe1,0xffe4ffe2,
-0xffe5ffe6,0xffeaffea,0xffedffec,0xfff2fff1,0xfff6fff7,0xfffbfffa,0x0000fffc,0x00030000,
-0x00090004,0x000c000b,0x0011000f,0x00130012,0x00170013,0x001a0019,0x001d001a,0x0020001d,
-0x0020001f,0x00250024,0x00270028,0x00270028,0x002a002a,0x002a002d,0x0027002e,0x002c002e,
-0x002b002c,0x002b002b,0x002e002a,0x002c002a,0x002c002a,0x00270028,0x00280029,0x00250026,
-0x00260025,0x00260024,0x00230024,0x00220022,0x00220021,0x001f0021,0x001f0023,0x00210022,
-0x0022001f,0x001c001e,0x001c001f,0x001c001c,0x001a001b,0x0019001c,0x001b001d,0x001c001d,
-0x00180018,0x0017001a,0x001c001a,0x0019001b,0x0019001a,0x00190019,0x001c001b,0x001d001a,
-0x001b001b,0x001c001c,0x001c001d,0x001b001c,0x001c001b,0x0016001a,0x001b001c,0x001b0018,
-0x001b0019,0x00180019,0x00180019,0x00180014,0x00160016,0x000e0013,0x000e000b,0x000a0008,
-0x00040008,0xfffe0003,0xfff80000,0xfff7fff9,0xffeefff3,0xffeaffed,0xffe4ffe8,0xffe2ffe5,
-0xffddffdd,0xffd9ffd7,0xffd7ffd7,0xffd6ffd5,0xffd1ffd3,0xffd0ffd1,0xffceffd0,0xffcfffce,
-0xffd3ffd2,0xffd3ffd1,0xffd2ffd3,0xffd6ffd5,0xffdaffd9,0xffd9ffd8,0xffdbffd7,0xffdbffd9,
-0xffdeffdd,0xffdcffdd,0xffdeffe0,0xffe0ffe0,0xffe1ffe0,0xffe1ffe2,0xffe1ffdf,0xffe2ffdf,
-0xffe0ffe1,0xffe0ffe0,0xffe0ffdf,0xffdfffe0,0xffddffdc,0xffdfffe1,0xffe2ffe3,0xffe4ffe3,
-0xffe6ffe3,0xffe5ffe6,0xffe7ffe7,0xffecffe7,0xffecffea,0xffefffed,0xfff1fff1,0xfff3fff1,
-0xfff4fff5,0xfff4fff2,0xfff8fff3,0xfff9fff6,0xfff8fff6,0xfff4fff8,0xfff3fff6,0xfff4fff6,
-0xfff7fff7,0xfff2fff6,0xffeffff3,0xffecfff3,0xfff0fff0,0xffefffed,0xffefffea,0xfff0ffea,
-0xfff1ffec,0xfff0ffef,0xffecffed,0xffefffed,0xfff0fff0,0xffeefff3,0xfff1fff1,0xfff5fff1,
-0xfff8fff4,0xfffafffc,0xfffefffa,0xffff0000,0x00010003,0x00070003,0x00090007,0x000c000a,
-0x000f000c,0x0013000e,0x00130011,0x00150015,0x001b0019,0x001b001c,0x001f001d,0x001e001d,
-0x0022001e,0x00270023,0x00270025,0x00260025,0x00270027,0x00280028,0x002b0029,0x002b002e,
-0x002b002b,0x002d002b,0x002b002c,0x002d002e,0x002d002f,0x002a002b,0x0028002b,0x002b0028,
-0x002a0027,0x00270027,0x00250024,0x00240026,0x00220026,0x00240025,0x00220025,0x00230024,
-0x00250025,0x00210024,0x001f0022,0x00210022,0x00240020,0x00210020,0x00230023,0x00240024,
-0x00240023,0x00270022,0x00250027,0x00220021,0x00250024,0x00200027,0x00220026,0x00230023,
-0x00230022,0x00210021,0x001d0021,0x0020001f,0x0020001b,0x001c001d,0x001b001e,0x0017001a,
-0x00150019,0x00160018,0x00140018,0x00130014,0x0011000f,0x0010000e,0x000e000c,0x000a000b,
-0x000a000b,0x000a000a,0x0009000a,0x00050008,0x00050007,0x00070007,0x00060007,0x00040006,
-0x00040005,0x00030003,0xffff0000,0xfffdffff,0xfffcffff,0xfffcffff,0xfffcfffe,0xfffcfffa,
-0xfffbfffc,0xfff7fff9,0xfff8fff5,0xfff5fff4,0xfff3fff5,0xfff1fff1,0xffebffed,0xffedffec,
-0xffecfff0,0xffeaffec,0xffe8ffec,0xffe7ffe9,0xffe5ffe6,0xffe3ffe3,0xffe0ffe0,0xffddffe0,
-0xffdcffdb,0xffd6ffd9,0xffd0ffd2,0xffd0ffd0,0xffcbffcd,0xffcbffcc,0xffc8ffc8,0xffc6ffc5,
-0xffc5ffc3,0xffc1ffc3,0xffc6ffc4,0xffc3ffc3,0xffc0ffc4,0xffc1ffc4,0xffc0ffc3,0xffc0ffc4,
-0xffc1ffc4,0xffc1ffc5,0xffc3ffc3,0xffc5ffc7,0xffc9ffc8,0xffc9ffc6,0xffc6ffc6,0xffc4ffc5,
-0xffc5ffc4,0xffc4ffc7,0xffc4ffc5,0xffc4ffc4,0xffc1ffc5,0xffc5ffc5,0xffc7ffc3,0xffc4ffc3,
-0xffc5ffc5,0xffc5ffc5,0xffc7ffc6,0xffc9ffc7,0xffc9ffc7,0xffccffcb,0xffcdffcd,0xffceffcd,
-0xffd1ffd1,0xffd5ffd3,0xffdcffd9,0xffe0ffdf,0xffe0ffe0,0xffdeffe1,0xffe7ffe4,0xffe6ffe7,
-0xffecffeb,0xffedffed,0xfff3ffee,0xfff5fff0,0xfff5fff4,0xfffbfff7,0xfffdfffb,0xfffdfffd,
-0x00020001,0x00020005,0x00050007,0x00060007,0x0008000a,0x000a000a,0x000c000b,0x000d000d,
-0x0013000e,0x00110011,0x00130011,0x00130014,0x00140014,0x00180016,0x0019001a,0x0019001a,
-0x0020001d,0x0020001f,0x00220022,0x00220023,0x00250024,0x002b0026,0x002c0029,0x002c002b,
-0x0032002e,0x0031002f,0x0030002b,0x0033002f,0x0032002e,0x00330033,0x00340032,0x00330031,
-0x00370031,0x00350033,0x00360036,0x00340036,0x00340035,0x00350032,0x00340035,0x00320034,
-0x00370035,0x00330034,0x00340033,0x00310032,0x00310033,0x00330033,0x00320038,0x00310035,
-0x00300036,0x00300034,0x00330037,0x00360037,0x00340033,0x00330035,0x00340032,0x00340033,
-0x00330034,0x00320033,0x002e0033,0x002d002f,0x002b002e,0x0029002b,0x00290028,0x00230024,
-0x001f0020,0x001a001b,0x00170018,0x00140013,0x00100013,0x000b000f,0x0008000a,0x0006000c,
-0x00040007,0x00040004,0x00000004,0xfffc0002,0x00000001,0xfffefffd,0xfffbfffd,0xfffbfffc,
-0xfffafffc,0xfffafff8,0xfff9fff8,0xfffafff9,0xfff6fff9,0xfff5fff8,0xfff6fff3,0xfff8fff5,
-0xfff3fff4,0xfff2fff4,0xfff2fff1,0xfff4fff2,0xfff0fff0,0xfff0ffef,0xffeeffec,0xffedffef,
-0xffeaffed,0xffedffea,0xffebffeb,0xffeaffea,0xffe6ffea,0xffe7ffea,0xffe8ffe6,0xffe7ffe9,
-0xffe1ffe4,0xffdfffe1,0xffdcffdc,0xffdcffda,0xffd7ffd9,0xffd3ffd4,0xffd0ffd3,0xffd0ffcf,
-0xffccffce,0xffccffcd,0xffccffc9,0xffc9ffc8,0xffcaffc9,0xffcbffca,0xffcaffc7,0xffc9ffc7,
-0xffcaffcb,0xffcdffcd,0xffd0ffce,0xffcfffcf,0xffd2ffcf,0xffd1ffce,0xffd1ffd1,0xffd6ffd3,
-0xffd4ffd7,0xffd3ffd6,0xffd8ffd8,0xffdaffd8,0xffddffdc,0xffe0ffdf,0xffddffdd,0xffe1ffdf,
-0xffe2ffe3,0xffe7ffe4,0xffe9ffe5,0xffecffec,0xffeeffec,0xfff0fff2,0xfff7fff3,0xfff8fff6,
-0xfffafff8,0xfffbfff9,0xfffbfffa,0x00010000,0x00030003,0x00060006,0x00070008,0x000a0008,
-0x000d000e,0x0010000e,0x00120010,0x0014000f,0x00140012,0x00140012,0x00150015,0x00160015,
-0x001a0017,0x001a001a,0x0017001b,0x00170017,0x00170017,0x00170015,0x00190019,0x00180018,
-0x001b0019,0x0017001b,0x001b0018,0x001a001a,0x001b001a,0x001a001c,0x001e001e,0x001d001c,
-0x001d001d,0x001f0020,0x001e0020,0x0020001f,0x00210022,0x00220020,0x00210021,0x00240021,
-0x00250021,0x00280024,0x00250024,0x00260024,0x00240023,0x00260024,0x00210021,0x00230022,
-0x00230023,0x00220023,0x001d0023,0x001e0020,0x001d001e,0x001c0020,0x001c001e,0x001b001c,
-0x001d001e,0x001f001e,0x001b001c,0x001c001a,0x001d001c,0x001a001b,0x00140019,0x00180019,
-0x00180017,0x00190015,0x00160013,0x00120012,0x00150013,0x00130011,0x00130012,0x00120018,
-0x000e0015,0x00110012,0x000d000e,0x000e000d,0x0008000b,0x000b0007,0x00050009,0x00050005,
-0x00010001,0xfffffffc,0xfffdfffb,0xfff8fff8,0xfff7fff8,0xfff3fff6,0xfff1fff2,0xfff1fff0,
-0xfff2fff3,0xffecffef,0xffedffef,0xffeaffea,0xffe8ffea,0xffebffe8,0xffecffe9,0xffe9ffe7,
-0xffe8ffea,0xffe7ffeb,0xffe8ffe7,0xffe8ffe9,0xffe4ffe7,0xffe4ffe4,0xffe3ffe3,0xffe2ffe3,
-0xffe4ffe4,0xffe4ffe3,0xffe5ffe2,0xffe2ffe2,0xffe1ffe0,0xffdfffde,0xffe0ffdd,0xffdeffdc,
-0xffdcffda,0xffd8ffdb,0xffd8ffdb,0xffd7ffdb,0xffd4ffd7,0xffd5ffd8,0xffd5ffd6,0xffd4ffd3,
-0xffd1ffd4,0xffd2ffd1,0xffd2ffd1,0xffd1ffd2,0xffd1ffd3,0xffd0ffce,0xffd0ffd0,0xffd3ffd3,
-0xffd3ffd4,0xffd0ffd4,0xffd0ffd3,0xffd2ffd5,0xffd1ffd3,0xffd5ffd1,0xffd5ffd4,0xffd7ffd4,
-0xffd3ffd5,0xffd5ffd3,0xffd8ffd5,0xffd8ffd7,0xffd6ffd6,0xffd9ffd6,0xffdbffd7,0xffd9ffdb,
-0xffdcffdb,0xffdcffdd,0xffdcffdb,0xffe2ffdc,0xffe1ffde,0xffe6ffe0,0xffe5ffe5,0xffe8ffe9,
-0xffeaffeb,0xffebffeb,0xffedffe9,0xffeeffed,0xfff2fff2,0xfff6fff5,0xfff3fff5,0xfff9fff6,
-0xfffefffc,0x0003ffff,0x00050004,0x000a0007,0x000b0008,0x000b0008,0x000f000c,0x00120012,
-0x00150016,0x00160018,0x001a001b,0x001b001c,0x001d001c,0x00210021,0x00210022,0x00250024,
-0x00270026,0x00290025,0x00240025,0x00230023,0x00240023,0x00250024,0x00270023,0x00250027,
-0x00250027,0x00240027,0x00250027,0x002b0029,0x00290029,0x002d002a,0x002a0029,0x002f002c,
-0x0030002c,0x002f002c,0x0030002c,0x002f002e,0x002e002f,0x002d0030,0x0031002d,0x002f002f,
-0x00300031,0x00310032,0x002c0030,0x002b002c,0x002a0029,0x002a0029,0x00280029,0x00220026,
-0x00250026,0x00250025,0x00250026,0x00220025,0x00240025,0x00250023,0x00240021,0x001f0022,
-0x001b001b,0x001c0019,0x001c001f,0x001b001c,0x001b001d,0x0017001a,0x00190019,0x001a001b,
-0x00150018,0x00170016,0x00150015,0x00150015,0x00140013,0x00140011,0x00130010,0x00100011,
-0x000b000b,0x0009000d,0x00040007,0x00020005,0xffff0003,0x00000001,0xfffbfffd,0xfffafffa,
-0xfff6fff8,0xfff3fff8,0xfff1fff6,0xffeffff1,0xfff2fff1,0xffedffee,0xffedffef,0xffedffec,
-0xffeeffea,0xffefffeb,0xffeeffee,0xfff0ffec,0xfff2ffee,0xfff2fff1,0xfff4fff4,0xfff6fff6,
-0xfff5fff3,0xfff6fff5,0xfff5fff4,0xfff3fff4,0xfff6fff4,0xfff4fff8,0xfff3fff5,0xfff2fff3,
-0xffeeffef,0xffeeffeb,0xffeaffed,0xffe5ffe7,0xffe3ffe3,0xffe0ffe3,0xffddffde,0xffddffdd,
-0xffd9ffdb,0xffd6ffd9,0xffd6ffd8,0xffd9ffd6,0xffd6ffd4,0xffd3ffd2,0xffd7ffd3,0xffd6ffd4,
-0xffd7ffd6,0xffdaffda,0xffdbffdb,0xffdbffdc,0xffdfffdf,0xffe1ffe0,0xffe2ffdf,0xffe5ffe2,
-0xffe7ffe5,0xffe7ffe6,0xffe8ffe8,0xffebffeb,0xffecffed,0xffedffed,0xfff0ffef,0xffeffff0,
-0xfff3fff2,0xfff1fff3,0xfff5fff5,0xfff5fff7,0xfff3fff6,0xfff7fff8,0xfff9fff8,0xfff9fffb,
-0xfff7fffa,0xfffafff9,0xfff8fffa,0xfffafffd,0xfff8fff9,0xfff6fff5,0xfff7fff7,0xfff8fff3,
-0xfff7fff6,0xfff1fff5,0xfff0fff1,0xfff1fff1,0xfff0ffef,0xffeeffef,0xfff1ffed,0xffedfff2,
-0xffeffff2,0xffeffff2,0xfff0fff2,0xffeffff4,0xfff3fff6,0xfff6fff8,0xfff9fff9,0xfffbfffb,
-0x00020000,0x00030003,0x00070006,0x000b000a,0x000f000b,0x0012000d,0x0010000f,0x00110010,
-0x00130013,0x00150015,0x00150013,0x00160015,0x0019001b,0x00170018,0x00160018,0x00190016,
-0x001b0019,0x00180019,0x00180018,0x001a0015,0x001a001b,0x001b001a,0x0020001b,0x001d001c,
-0x001c001d,0x001f001f,0x001f001f,0x001f0020,0x00220021,0x00210024,0x00230022,0x00200023,
-0x00220021,0x00230023,0x0021001f,0x001e001f,0x001b001d,0x001a001b,0x00150014,0x00140013,
-0x00110011,0x000e000e,0x000a0009,0x00060009,0x00040004,0x00010003,0x00010003,0xfffbffff,
-0xffffffff,0xfffbfffe,0xfffefffd,0xfffbfffe,0xfffdfffa,0xfffcfffc,0xfffcfffa,0xfffcfffa,
-0xfffdfffb,0xfffefffc,0xfffefffd,0x0003ffff,0xfffffffe,0xfffffffc,0xfffdffff,0xfffdfffe,
-0xfffe0000,0xfffafffe,0xfffcfffc,0xfffcfffb,0xfff9fff8,0xfff8fffb,0xfff5fff7,0xfff5fff2,
-0xfff0fff2,0xffeeffed,0xffeaffee,0xffe9ffeb,0xffeaffeb,0xffecffec,0xffe9ffea,0xffe7ffe8,
-0xffe7ffe8,0xffe5ffe9,0xffe6ffe5,0xffe4ffe4,0xffe6ffe6,0xffe6ffe6,0xffe5ffe6,0xffe6ffe5,
-0xffe9ffe7,0xffe8ffea,0xffeaffea,0xffe9ffe9,0xffeaffe8,0xffebffeb,0xffefffec,0xffeeffee,
-0xffefffef,0xfff3fff3,0xfff4fff4,0xfff9fff4,0xfffafff5,0xfff9fff7,0xfff9fff8,0xfffcfffb,
-0x0000fffa,0x0000fffc,0x0000ffff,0xfffefffb,0x0001fffc,0xffffffff,0x00020000,0xfffd0000,
-0xfffefffe,0xfffeffff,0xfffcfffe,0xfffdffff,0xfffbfffe,0xfff9fffb,0xfff9fff8,0xfff9fff8,
-0xfff9fff9,0xfff7fff8,0xfff9fff7,0xfff8fff7,0xfff6fff5,0xfff9fff7,0xfff6fff6,0xfff6fff6,
-0xfff7fff6,0xfff7fff5,0xfff9fff8,0xfff8fff5,0xfffafff7,0xfff9fff9,0xfff9fff8,0xfffbfffb,
-0xfffbfffb,0xfffdffff,0xffffffff,0x00060003,0x00070007,0x00070004,0x000c000c,0x000b000e,
-0x000d0010,0x00120012,0x00150013,0x00190018,0x001a0019,0x001f001d,0x001f001c,0x0021001f,
-0x00240023,0x00220020,0x00240023,0x00240024,0x00250025,0x00260025,0x00240024,0x00210024,
-0x00250024,0x00270026,0x00240026,0x00240026,0x00250025,0x00240024,0x00230025,0x00250024,
-0x00220025,0x00230025,0x00250022,0x00230022,0x00220024,0x00210021,0x00200022,0x001f001f,
-0x0020001e,0x0020001f,0x001d0020,0x001c001d,0x001c001d,0x001c001b,0x001b001b,0x0016001a,
-0x00150017,0x00170014,0x00170016,0x00150015,0x0011000f,0x0010000e,0x000e0012,0x000c000e,
-0x00070007,0x0008000a,0x00010001,0x00010000,0xffff0001,0xfffbfffc,0xfffcfffc,0xfffafffb,
-0xfff8fff7,0xfff8fff9,0xfff6fff4,0xfff2fff5,0xfff0fff2,0xfff0fff1,0xffeefff1,0xffecffee,
-0xffedffee,0xffe9ffee,0xffeaffeb,0xffe9ffe8,0xffe8ffeb,0xffe5ffe8,0xffe4ffe6,0xffe1ffe5,
-0xffe1ffdf,0xffdfffe0,0xffdcffdd,0xffdeffde,0xffd9ffdd,0xffdbffda,0xffddffdb,0xffd7ffda,
-0xffd6ffd7,0xffd8ffd8,0xffd7ffd6,0xffd7ffd6,0xffd7ffd6,0xffd6ffd5,0xffd4ffd5,0xffd5ffd6,
-0xffd7ffd6,0xffd6ffd2,0xffd8ffd4,0xffd7ffd5,0xffd6ffd2,0xffd7ffd5,0xffd6ffd6,0xffd8ffd5,
-0xffd9ffd9,0xffdcffdd,0xffdfffdf,0xffdcffdf,0xffe0ffe0,0xffe2ffe3,0xffe4ffe1,0xffe4ffe2,
-0xffe7ffe3,0xffe7ffe6,0xffe6ffe7,0xffe8ffe8,0xffecffe9,0xffebffed,0xffebffed,0xffebffed,
-0xffeaffed,0xffeaffe9,0xffebffec,0xffebffeb,0xffecffe9,0xffebffea,0xffeaffe6,0xffe8ffe9,
-0xffeaffe9,0xffe8ffeb,0xffe6ffeb,0xffeaffec,0xffe7ffea,0xffeaffe6,0xffe9ffe8,0xffe9ffe6,
-0xffecffe9,0xffeeffec,0xfff0ffee,0xfff1fff1,0xfff1fff2,0xfff3fff3,0xfff5fff4,0xfff9fff8,
-0xfffcfffc,0xfffdfffe,0x00030003,0x00070005,0x000b0009,0x000d000a,0x0010000d,0x00110010,
-0x00130012,0x00120013,0x00150014,0x00160014,0x00170015,0x00170016,0x00150017,0x00180018,
-0x0019001a,0x0017001a,0x00170019,0x0019001b,0x001a001a,0x001a0018,0x001d0018,0x001e001b,
-0x001e001d,0x001d0020,0x00200021,0x00230024,0x00280026,0x00280026,0x002b0029,0x002f002a,
-0x002c002c,0x002c002a,0x002e002f,0x0031002f,0x00300033,0x002e0031,0x00320033,0x002e0032,
-0x002e002f,0x002e002d,0x002c002f,0x002c002a,0x002b002a,0x00290028,0x00290028,0x00270029,
-0x0028002b,0x00250027,0x00240025,0x00230025,0x00220024,0x00230022,0x00240023,0x00210023,
-0x001f001f,0x001f001b,0x001e001c,0x001b001b,0x00180018,0x0015001a,0x00120015,0x00100012,
-0x000f0011,0x000e000e,0x000a000c,0x000a000a,0x000b000a,0x000a0008,0x000a0008,0x00060005,
-0x00080006,0x00040007,0x00050007,0x00010005,0x00040003,0x00020003,0xfffcfffe,0xfffcfffd,
-0xfffbfffc,0xfff6fff7,0xfff7fff8,0xfff5fff6,0xfff2fff5,0xfff0fff0,0xffefffee,0xffeeffed,
-0xffedffec,0xffeaffeb,0xffebffeb,0xffeaffea,0xffebffe9,0xffeaffe9,0xffedffec,0xffecffec,
-0xffecffec,0xffeaffed,0xffeaffea,0xffe9ffea,0xffe8ffec,0xffe9ffe9,0xffe8ffe7,0xffeaffe5,
-0xffe7ffe5,0xffe3ffe2,0xffe4ffe3,0xffe3ffe4,0xffe1ffe3,0xffe1ffe1,0xffe0ffdf,0xffe1ffdf,
-0xffe0ffe2,0xffe1ffdf,0xffe0ffe0,0xffe0ffe0,0xffdfffe1,0xffe2ffe3,0xffe1ffe3,0xffe2ffe1,
-0xffe4ffe3,0xffe6ffe4,0xffe6ffe6,0xffe8ffe5,0xffe9ffe5,0xffe7ffe7,0xffebffea,0xffedffee,
-0xffecffec,0xffebffec,0xffecffec,0xffedffed,0xffebffec,0xffe9ffeb,0xffeaffe9,0xffebffe9,
-0xffe9ffe6,0xffe9ffe7,0xffe9ffe7,0xffeaffe9,0xffe6ffe7,0xffe9ffe9,0xffe6ffec,0xffe8ffeb,
-0xffecffec,0xffeeffed,0xfff0fff0,0xfff5fff2,0xfff8fff4,0xfff9fff5,0x0001fffc,0xfffeffff,
-0x00010001,0x00050005,0x000b0008,0x000b000b,0x000c000c,0x00100010,0x000f000e,0x000f0010,
-0x0010000f,0x0010000f,0x000e0011,0x000d000c,0x0010000f,0x00120011,0x00100012,0x000e000d,
-0x000e000d,0x0010000d,0x000d000d,0x000e0010,0x000c000d,0x000c000d,0x000b0010,0x000c000f,
-0x000a0010,0x000e000d,0x000d000f,0x000c000e,0x0009000c,0x00090008,0x00090004,0x000b0008,
-0x00090008,0x00090007,0x00050007,0x00080008,0x00050006,0x00050006,0x0008000a,0x0008000a,
-0x000c000b,0x000a000d,0x00090008,0x000e000b,0x000d000c,0x000c000b,0x000e000d,0x000f000c,
-0x0012000e,0x000e0012,0x000d0011,0x000c000e,0x000c000a,0x000d000c,0x000c000a,0x000b000c,
-0x000a000e,0x000c000c,0x000a000d,0x000d000b,0x000a000a,0x000d000c,0x000d000c,0x000e000e,
-0x0011000e,0x000c000d,0x000e000f,0x000e0010,0x000f000e,0x000d000e,0x000c000b,0x000b000b,
-0x00080007,0x00060008,0x00040008,0x00020004,0xffff0000,0xfffffffc,0xfffbfffe,0xfff8fff9,
-0xfff5fff8,0xfff4fff5,0xfff3fff3,0xffedfff0,0xffeeffec,0xffecffec,0xffebffeb,0xffe8ffea,
-0xffe9ffe8,0xffe7ffe8,0xffe8ffe8,0xffe9ffe8,0xffe5ffe6,0xffe8ffe6,0xffe9ffe9,0xffe7ffe8,
-0xffecffe9,0xffeaffe9,0xffe9ffeb,0xffedffed,0xffedffed,0xfff0ffed,0xfff3ffef,0xfff4fff2,
-0xfff0fff5,0xfff4fff6,0xfff3fff7,0xfff4fff5,0xfff4fff5,0xfff0fff6,0xfff0fff1,0xfff3fff3,
-0xffeffff1,0xfff1fff0,0xffecfff1,0xffedffee,0xffedffec,0xffedffef,0xffeaffec,0xffeaffe7,
-0xffeaffe8,0xffecffe9,0xffeaffea,0xffebffeb,0xffecffec,0xffecffef,0xffeeffef,0xffefffed,
-0xfff2ffef,0xfff4ffef,0xfff5fff3,0xfff7fff3,0xfff8fff5,0xfff9fffa,0xfffbfff8,0xfffefffb,
-0x0001fffe,0x00000001,0x00030003,0x00090009,0x000f000a,0x000f000b,0x000f000f,0x00150014,
-0x00150015,0x0016001a,0x00170018,0x001a001b,0x001e001b,0x001e001b,0x0021001b,0x001d001e,
-0x0020001e,0x001d0021,0x001d001f,0x001d001e,0x001c001d,0x001d001c,0x001c001e,0x001b001d,
-0x001b001b,0x001c001a,0x001c001b,0x001d001c,0x001e001b,0x001c001c,0x001a001a,0x001b001c,
-0x001a001d,0x001d0020,0x001c001b,0x001e001e,0x001c001c,0x001c001c,0x001c001c,0x001a001e,
-0x0019001b,0x001c001c,0x001b0018,0x001a0019,0x0018001b,0x00170018,0x00150017,0x00110014,
-0x0010000f,0x000f000f,0x00100010,0x000e000e,0x000e000e,0x000b000b,0x000c000b,0x000c000b,
-0x0008000b,0x00070008,0x0008000b,0x0007000c,0x0005000b,0x0009000a,0x000a000a,0x000a0007,
-0x00090009,0x0007000c,0x00080008,0x0006000a,0x00060004,0x00020007,0x00050005,0x00050004,
-0x00000000,0x0000ffff,0xfffffffd,0xfffdfffe,0xfffcfffb,0xfffbfffc,0xfffcfffa,0xfffbfffb,
-0xfff8fffa,0xfff7fffc,0xfff8fffc,0xfff9fffb,0xfff5fffa,0xfff7fff9,0xfff9fffe,0xfff4fffb,
-0xfff3fff7,0xfff6fff6,0xfff4fff5,0xfff3fff3,0xfff0fff2,0xffedffec,0xffeeffea,0xffe8ffe5,
-0xffe6ffe3,0xffe3ffe4,0xffe0ffe1,0xffd9ffe0,0xffd9ffdd,0xffd7ffda,0xffd6ffd9,0xffd7ffd9,
-0xffd3ffd6,0xffd2ffd6,0xffd4ffd7,0xffd1ffd5,0xffd3ffd5,0xffd3ffd3,0xffd4ffd4,0xffd4ffd3,
-0xffd3ffd2,0xffd2ffcf,0xffd4ffd4,0xffd3ffd4,0xffd4ffd4,0xffd3ffd5,0xffd6ffd4,0xffd4ffd4,
-0xffd8ffd7,0xffd3ffd5,0xffd4ffd5,0xffd4ffd6,0xffd7ffd5,0xffd9ffd8,0xffdaffd9,0xffdaffdb,
-0xffdcffdb,0xffdeffdb,0xffe1ffdf,0xffe2ffdf,0xffe7ffe1,0xffe9ffe5,0xffeaffe8,0xffecffea,
-0xffedfff2,0xffeffff3,0xfff2fff1,0xfff5fff4,0xfff7fff5,0xfffdfff8,0xfffefffb,0x0001fffe,
-0x00010002,0x00010004,0x00030002,0x00010003,0x00010003,0x00040005,0x00020005,0x00040005,
-0x00030007,0x00030004,0x00050007,0x00040004,0x00070006,0x00040003,0x00030002,0x00010003,
-0x00020001,0x00010000,0x00010006,0x00040004,0x00070004,0x00060003,0x00070003,0x00080008,
-0x000b0007,0x000c000b,0x000e000e,0x00110010,0x0014000f,0x00130011,0x00170015,0x0019001a,
-0x00190018,0x001c0018,0x001d001c,0x001f0020,0x001f0023,0x00210022,0x00220021,0x00210021,
-0x00230023,0x00250024,0x00230021,0x00250024,0x00270021,0x00270026,0x00220024,0x001f0024,
-0x00210023,0x00230021,0x00220021,0x001f0021,0x001e0020,0x001e001e,0x00200025,0x001f0023,
-0x00200020,0x00230021,0x00250022,0x00200020,0x00220021,0x00210022,0x00240023,0x00200021,
-0x00210020,0x00200020,0x0021001f,0x00220020,0x0022001d,0x001d001c,0x001a001b,0x001a001c,
-0x001a001b,0x00190019,0x0019001b,0x00160018,0x00170016,0x00150015,0x00150018,0x00140015,
-0x00150012,0x00130010,0x00100010,0x000f0012,0x000d000f,0x000f000f,0x000d000d,0x0008000c,
-0x0006000a,0x000a000b,0x00070007,0x00020006,0x00020005,0x00000003,0xfffeffff,0xfffafffb,
-0xfff9fffb,0xfff5fffa,0xfff3fff5,0xffeefff3,0xffefffef,0xffefffef,0xffedffeb,0xffe8ffe9,
-0xffebffea,0xffe8ffea,0xffe5ffe5,0xffe5ffe5,0xffe6ffe5,0xffe5ffe6,0xffe5ffe5,0xffe7ffe7,
-0xffe4ffe3,0xffe4ffe6,0xffe7ffe4,0xffe7ffe6,0xffe8ffe5,0xffe9ffe5,0xffe5ffe2,0xffe5ffe2,
-0xffe6ffe5,0xffe3ffe5,0xffe1ffe1,0xffdfffe2,0xffdfffe3,0xffe0ffe1,0xffe2ffe0,0xffdfffdf,
-0xffe2ffe2,0xffe2ffe0,0xffe2ffe3,0xffe2ffe5,0xffe8ffe7,0xffe7ffe7,0xffe8ffe8,0xffefffe9,
-0xffecffed,0xffeeffee,0xfff0fff0,0xfff1fff1,0xfff5ffef,0xfff1fff1,0xfff3ffee,0xfff2fff3,
-0xfff0fff4,0xffeefff0,0xfff1ffef,0xffefffef,0xffecffef,0xffecffee,0xffecffec,0xffeaffec,
-0xffecffea,0xffe9ffeb,0xffe9ffeb,0xffeaffeb,0xffebffec,0xffecffec,0xffeeffed,0xfff0ffee,
-0xfff2fff0,0xfff0fff0,0xfff5fff1,0xfff7fff6,0xfff9fff6,0xfffafffb,0xfffbfffb,0xfffbfffc,
-0xfffcffff,0x0000ffff,0x0004fffe,0x00010000,0x00010001,0x00020000,0x00020005,0x00010003,
-0x00030003,0x00060003,0x00040005,0x00080007,0x00050007,0x00090008,0x00090008,0x000a0009,
-0x000d000c,0x000e000b,0x000d000d,0x000e000c,0x000f000f,0x0012000e,0x00110012,0x00120012,
-0x00140013,0x00140015,0x00140015,0x00150016,0x00160015,0x00170018,0x001a001a,0x001d001a,
-0x001d001d,0x001c001e,0x001b001b,0x001b001f,0x001e001e,0x001e001f,0x0022001f,0x001f0020,
-0x001e001e,0x001a001d,0x00180019,0x001b001b,0x0019001a,0x0019001b,0x00180016,0x00160015,
-0x00130014,0x000f0013,0x0012000f,0x000d000e,0x000b000c,0x0007000b,0x0007000a,0x00030008,
-0x00000003,0xffff0001,0xfffdfffe,0xfffeffff,0xfffcfffc,0xfffbfffa,0xfff8fff8,0xfff5fff6,
-0xfff5fff4,0xfff2fff6,0xffeffff2,0xffedffef,0xffeeffee,0xffedffee,0xffedffed,0xffeaffeb,
-0xffebffe9,0xffebffea,0xffeaffe8,0xffe9ffea,0xffe9ffed,0xffebffed,0xffeeffed,0xfff0ffed,
-0xffeeffed,0xfff0ffed,0xfff1ffef,0xfff0fff2,0xfff0ffef,0xffeffff2,0xffeefff2,0xffedffee,
-0xfff1fff0,0xffedffef,0xffedffed,0xffedffec,0xffebffeb,0xffedffed,0xffecffeb,0xffedffea,
-0xffebffe9,0xffe9ffe8,0xffeaffea,0xffebffea,0xffedffec,0xffecffec,0xffebffee,0xffefffee,
-0xfff1fff2,0xfff3fff3,0xfff7fff5,0xfffbfff7,0xfffdfff9,0xfffdfffc,0x00000000,0xffffffff,
-0x0000ffff,0xfffe0001,0x0000ffff,0x00020001,0x0000ffff,0x00020000,0xfffd0000,0xfffcffff,
-0xfffdffff,0xfffcfffc,0xfffbfffa,0xfffafff8,0xfff9fffa,0xfff8fffb,0xfff9fff9,0xfffcfffa,
-0xfffcfffb,0xfffefffc,0xfffe0000,0xffffffff,0x00030001,0x00020004,0x00060003,0x00080007,
-0x00080006,0x00080008,0x0008000a,0x000c0009,0x0008000a,0x000a000b,0x0009000b,0x0009000c,
-0x0008000c,0x00050009,0x00090009,0x000c000a,0x000a0006,0x000c0009,0x000c000b,0x000b000b,
-0x000b000c,0x000b000d,0x000b000c,0x000e000d,0x000f000f,0x00120012,0x00140012,0x00150014,
-0x00150015,0x00190014,0x00190019,0x001e0019,0x001f001c,0x0020001d,0x0021001f,0x00210020,
-0x00230022,0x00220024,0x00240024,0x00230025,0x00240028,0x00280025,0x00280027,0x00270028,
-0x00250027,0x00260025,0x00250025,0x00230023,0x00230023,0x0020001f,0x0024001f,0x0024001e,
-0x001e001e,0x001d001c,0x001f001b,0x001c001e,0x001b001a,0x001b0019,0x00150018,0x00140016,
-0x00130014,0x00110015,0x000f0010,0x000e000e,0x000d000e,0x0008000c,0x0007000a,0x00070009,
-0x00070004,0x00080005,0x00030002,0x00000000,0xfffefffd,0xfffcfffc,0xfffcfffe,0xfff9fffb,
-0xfff8fffa,0xfff3fff6,0xfff4fff4,0xfff2fff4,0xffedfff0,0xffedffed,0xffe8ffed,0xffeaffeb,
-0xffe7ffe7,0xffe7ffe4,0xffe6ffe4,0xffe3ffe4,0xffe1ffe4,0xffe0ffe2,0xffdeffde,0xffdcffde,
-0xffdfffdd,0xffdcffdf,0xffdaffda,0xffdcffdb,0xffdaffda,0xffdaffdc,0xffdbffde,0xffd9ffda,
-0xffd7ffdd,0xffdcffd9,0xffdbffdd,0xffddffdb,0xffddffdd,0xffddffde,0xffdcffdd,0xffe0ffde,
-0xffe0ffe1,0xffdfffdf,0xffe0ffe1,0xffe1ffe1,0xffe1ffe0,0xffe2ffe1,0xffe0ffde,0xffe1ffdf,
-0xffe1ffdf,0xffe1ffe0,0xffe1ffdf,0xffe0ffdf,0xffe1ffe2,0xffe0ffe1,0xffe1ffe0,0xffe4ffe5,
-0xffe1ffe1,0xffdfffe0,0xffe1ffe1,0xffe2ffe3,0xffe0ffdf,0xffe3ffe1,0xffe3ffe1,0xffe4ffe2,
-0xffe5ffe7,0xffe2ffe9,0xffe6ffe6,0xffe8ffe6,0xffecffe8,0xffedffea,0xffecffeb,0xffecffed,
-0xffefffea,0xfff4ffeb,0xfff1fff3,0xfff4ffee,0xfff6fff2,0xfff6fff5,0xfff8fff5,0xfff6fff5,
-0xfff9fff7,0xfff9fff9,0xfff9fffa,0xfffcfff8,0xfff9fffa,0xfffafffa,0xfffcfffc,0xfff9fff9,
-0xfff9fffb,0xfffbfffc,0xfffdfffc,0xfffbfffe,0xfffcfffe,0xfffffffe,0xffff0000,0x00040003,
-0x00040004,0x00060006,0x000a000b,0x000f000d,0x000f000d,0x0013000e,0x00150012,0x001b0017,
-0x00180019,0x001d001b,0x001e001c,0x001d001f,0x0022001f,0x00220027,0x00270026,0x00260026,
-0x00270023,0x00240026,0x00260025,0x00270027,0x00260026,0x00260024,0x00230024,0x00260024,
-0x00240023,0x00230024,0x00270024,0x00250023,0x00220025,0x00230024,0x00210022,0x00230023,
-0x00210023,0x00220022,0x00200022,0x001f0021,0x00200020,0x001f001f,0x0021001f,0x0024001f,
-0x00210020,0x0023001f,0x0021001e,0x001e001e,0x001f001f,0x0022001e,0x0020001f,0x001d001f,
-0x001a001f,0x001e001e,0x001e001d,0x001c001c,0x001b001b,0x001a001c,0x001a0018,0x00160017,
-0x00140015,0x00110013,0x000f0012,0x000f000f,0x000c000e,0x00090008,0x00080007,0x00080009,
-0x00030006,0x00020004,0x00010004,0x00020003,0xfffe0000,0x00010001,0x0001ffff,0x00010000,
-0x00020000,0xffff0001,0xfffd0000,0x00010001,0x00060001,0x0002ffff,0x0001fffe,0xfffe0000,
-0xfffd0000,0xfffafffe,0xfff8fffd,0xfff7fffb,0xfff6fff7,0xfff6fff5,0xfff2fff3,0xffeffff0,
-0xffecffef,0xffebffec,0xffeaffec,0xffe7ffe7,0xffe7ffe4,0xffe5ffe4,0xffe2ffe3,0xffe5ffe4,
-0xffe2ffe6,0xffe1ffe6,0xffe0ffe0,0xffe2ffe1,0xffe5ffe3,0xffe4ffe2,0xffe3ffe2,0xffe1ffe3,
-0xffe2ffe3,0xffe0ffe2,0xffe0ffdf,0xffe1ffde,0xffe1ffdf,0xffdfffe2,0xffdfffe0,0xffe0ffdd,
-0xffe0ffe2,0xffe0ffdf,0xffdeffdf,0xffe0ffdf,0xffe1ffdf,0xffe1ffdf,0xffdfffe0,0xffe0ffde,
-0xffe2ffe1,0xffe3ffe1,0xffe5ffe5,0xffe5ffe5,0xffe6ffe6,0xffe7ffe9,0xffe8ffec,0xffedffed,
-0xfff2ffef,0xfff0fff0,0xfff1ffef,0xfff3fff2,0xfff6fff4,0xfff5fff9,0xfff7fffc,0xfff8fff9,
-0xfffbfffc,0xfffdfffb,0xfffdfffb,0xfffdfffd,0xfffdfffc,0xfffffffe,0xffffffff,0xfffffffd,
-0x0004fffe,0x00000000,0xffff0001,0x00010001,0x00010005,0x00020004,0x00050003,0x00040002,
-0x00060006,0x00080008,0x00070005,0x000a0008,0x000d000a,0x000a000c,0x000e000e,0x000d0010,
-0x000e000f,0x000f0010,0x0010000f,0x00130012,0x00140012,0x00130012,0x00130012,0x00130013,
-0x00120013,0x00150012,0x00140013,0x00100014,0x00120014,0x00120014,0x00140012,0x00130010,
-0x00130010,0x00140010,0x000e000e,0x000f000c,0x000d000c,0x000c0009,0x000b000a,0x0009000a,
-0x00080008,0x00050005,0x00040007,0x00030003,0x00010004,0x00000005,0x00020004,0x00030003,
-0x00020005,0x00030005,0x00040002,0x00030001,0x00030000,0x00030003,0x00010002,0x00000000,
-0x0003ffff,0x00020001,0x00030000,0x00030004,0x00040002,0x00070007,0x00080008,0x00070007,
-0x000a0006,0x00080009,0x000a000b,0x000b000d,0x000d000e,0x000f000e,0x000d000e,0x000d000e,
-0x000d000d,0x0009000b,0x00080008,0x0009000b,0x00070009,0x00030005,0x00020006,0x00010006,
-0x00020006,0x00030001,0x00020002,0xfffe0000,0xfffdfffc,0xfffafffc,0xfffafffa,0xfff9fffb,
-0xfff7fff7,0xfffafff6,0xfff5fff7,0xfff3fff2,0xfff3fff3,0xfff1ffee,0xffecffed,0xffeaffeb,
-0xffe8ffe9,0xffe7ffe6,0xffe6ffe4,0xffe2ffe2,0xffe0ffde,0xffdeffde,0xffddffdd,0xffdbffda,
-0xffd8ffd7,0xffd7ffda,0xffdbffdb,0xffd8ffdb,0xffdbffd8,0xffdaffd9,0xffdcffdb,0xffdbffda,
-0xffdcffdc,0xffdfffdf,0xffe2ffe0,0xffe2ffe3,0xffe5ffe6,0xffe7ffe8,0xffebffec,0xffedffed,
-0xffeffff0,0xfff2fff2,0xfff2fff3,0xfff6fff7,0xfff7fff9,0xfffafff8,0xfffbfffa,0xfffdfffd,
-0xfffefffe,0x00000000,0x00010001,0x00060003,0x00060004,0x00060004,0x00060006,0x00080005,
-0x000b0008,0x000a0008,0x000b000a,0x000e000c,0x000f000b,0x00100010,0x00110010,0x00130011,
-0x00130013,0x00150017,0x00130018,0x00170019,0x00180017,0x0018001a,0x00170018,0x00160019,
-0x00170015,0x00150013,0x00170013,0x00130010,0x00130012,0x00100012,0x00100010,0x000f0010,
-0x00130010,0x00100012,0x00120012,0x00110012,0x00130010,0x00120011,0x00140014,0x00160013,
-0x00180018,0x001c001b,0x001a001d,0x001e001b,0x001f001f,0x0022001f,0x00200022,0x00230022,
-0x00210021,0x00240023,0x00220021,0x00200021,0x00210022,0x00210023,0x001f0020,0x001d001d,
-0x001c001c,0x001a001b,0x00190018,0x00130017,0x00150013,0x00140012,0x00110013,0x00100012,
-0x000f0010,0x000e000e,0x000c000b,0x000f000e,0x0011000d,0x0010000d,0x000d000f,0x000c000f,
-0x00100013,0x00110013,0x00110012,0x00110012,0x00110013,0x00110011,0x00100011,0x0010000d,
-0x000d000d,0x0008000b,0x00080008,0x00050007,0x00020003,0x00010003,0x00030003,0xfffc0001,
-0xfffcfffc,0xfffdfffb,0xfff8fffd,0xfffafffa,0xfff8fff9,0xfff7fff6,0xfff9fff4,0xfff6fff5,
-0xfff5fff4,0xfff5fff3,0xfff1fff4,0xfff5fff2,0xfff6fff3,0xfff5fff4,0xfff2fff3,0xfff1fff2,
-0xffeffff1,0xffeeffed,0xffefffee,0xffecffeb,0xffeaffea,0xffe7ffe6,0xffe7ffe6,0xffdeffe5,
-0xffdbffe2,0xffd8ffdd,0xffd9ffda,0xffd5ffd7,0xffd4ffd4,0xffd6ffd2,0xffd4ffd0,0xffd3ffd0,
-0xffceffce,0xffcdffcb,0xffceffcd,0xffd0ffcf,0xffcfffce,0xffcfffcb,0xffd0ffd0,0xffd0ffd0,
-0xffd0ffd2,0xffd4ffd3,0xffd4ffd4,0xffd4ffd3,0xffd6ffd4,0xffd6ffd8,0xffd7ffd7,0xffd8ffd8,
-0xffd8ffd9,0xffdaffd8,0xffd9ffd9,0xffdaffd7,0xffdcffdb,0xffdeffdb,0xffe2ffdc,0xffe3ffdf,
-0xffe2ffe1,0xffe3ffe3,0xffe6ffe4,0xffe6ffe6,0xffeaffe8,0xffeeffea,0xffefffed,0xfff3fff2,
-0xfff2fff2,0xfff6fff5,0xfff7fff7,0xfff8fff8,0xfff8fff8,0xfffafff8,0xfffcfffc,0xfffbfffb,
-0xfffafffc,0xfffdfffb,0xfffafffc,0xfff9fff8,0xfff8fff9,0xfff9fffa,0xfff9fff9,0xfffbfffc,
-0xfffbfffd,0xfffcfffc,0x0000ffff,0x00000001,0x00030003,0x00060005,0x00080005,0x000b000a,
-0x000f000e,0x0014000e,0x00140013,0x00140015,0x00180016,0x001c0019,0x001b001a,0x001b001c,
-0x001c001f,0x001b001e,0x001e001d,0x00200020,0x00200021,0x00200021,0x00210022,0x00220022,
-0x00230022,0x00240026,0x00220025,0x00240023,0x00260026,0x00270026,0x00270026,0x00270027,
-0x00260024,0x00290026,0x00260026,0x00270026,0x00240025,0x00220024,0x00250024,0x00250026,
-0x00250025,0x00210025,0x00210022,0x00210022,0x00230020,0x00230022,0x001f0020,0x00200020,
-0x00200021,0x001e0020,0x001d001f,0x00220021,0x0020001e,0x001f001e,0x001d001b,0x001b001c,
-0x00190019,0x0019001a,0x00180019,0x00170019,0x00150018,0x00130016,0x00130017,0x00140014,
-0x00120014,0x00100011,0x00120012,0x000f000f,0x000e000f,0x000d000e,0x000c000b,0x0009000a,
-0x000a0009,0x000a0006,0x00060009,0x00050007,0x00050005,0x00020002,0x00030002,0x00000002,
-0x00010003,0xfffe0003,0xfffe0001,0xfffdffff,0xfff9fffd,0xfff9fffb,0xfff9fffa,0xfff8fff9,
-0xfff4fff5,0xfff3fff4,0xffeffff2,0xffefffee,0xffecffed,0xffe8ffe9,0xffe5ffe8,0xffe6ffe7,
-0xffe5ffe3,0xffe3ffe5,0xffe3ffe5,0xffe1ffe3,0xffe1ffdf,0xffe0ffe0,0xffe0ffe0,0xffdfffdc,
-0xffdeffdf,0xffdbffdd,0xffdcffdc,0xffdeffdf,0xffddffde,0xffddffdd,0xffdeffdf,0xffdeffe1,
-0xffdcffdf,0xffdeffdf,0xffdfffe0,0xffdbffdc,0xffdeffde,0xffdeffdd,0xffdfffdd,0xffe1ffe0,
-0xffe0ffdf,0xffe2ffe1,0xffe4ffe2,0xffe7ffe4,0xffe6ffe3,0xffe7ffe3,0xffe9ffe8,0xffe8ffe6,
-0xffeaffea,0xffe9ffe8,0xffeaffe9,0xffedffe9,0xffe9ffe9,0xffe9ffe7,0xffebffe5,0xffe8ffe9,
-0xffe7ffe7,0xffe5ffe7,0xffe4ffe5,0xffe1ffe5,0xffdfffe4,0xffe1ffe4,0xffe2ffe2,0xffe3ffe2,
-0xffe4ffe1,0xffe4ffe2,0xffe4ffe2,0xffe3ffe4,0xffe6ffe4,0xffe6ffe7,0xffe7ffe7,0xffeaffe9,
-0xffeaffea,0xffeaffed,0xffefffee,0xfff0ffec,0xfff2fff1,0xfff1fff3,0xfff2fff4,0xfff7fff6,
-0xfff9fff7,0xfff7fff9,0xfffafff7,0xfff8fff9,0xfff9fff9,0xfffcfffa,0xfffafff8,0xfffefffb,
-0xfffffffd,0x00000002,0x00000002,0x00020002,0x00030005,0x00050005,0x00060006,0x00090009,
-0x000e000c,0x0010000e,0x00130011,0x00140014,0x00180017,0x001a0019,0x001f001c,0x0022001d,
-0x00240021,0x00280027,0x002a002a,0x002a002a,0x002e002c,0x002e0031,0x002d002f,0x002e002e,
-0x002d002f,0x002f002d,0x002e002e,0x002d002e,0x002d002c,0x002c0029,0x002a0029,0x00290028,
-0x00250027,0x00250028,0x00220026,0x00250024,0x00230022,0x00200020,0x001f0020,0x00210020,
-0x0023001f,0x001f0022,0x00210020,0x00200023,0x001f0020,0x00210023,0x00200023,0x00240022,
-0x00220023,0x00210024,0x00230021,0x00240021,0x00240021,0x00250021,0x00230023,0x00210021,
-0x00230025,0x00210022,0x00220021,0x001d0020,0x001e001f,0x001b001c,0x0019001c,0x0019001c,
-0x001a0018,0x00160018,0x00130014,0x00100011,0x000d0010,0x0009000b,0x00060008,0x00030004,
-0x00010003,0xfffb0000,0xfff9fffd,0xfff8fff8,0xfff5fff5,0xfff5fff5,0xfff1fff0,0xffedffed,
-0xffecffec,0xffebffea,0xffe9ffe9,0xffe6ffe7,0xffe4ffe8,0xffe2ffe6,0xffe3ffe5,0xffe2ffe3,
-0xffe1ffe2,0xffe1ffe2,0xffe0ffe2,0xffe0ffe2,0xffdcffe3,0xffdcffde,0xffddffde,0xffdeffde,
-0xffdeffdc,0xffdeffdd,0xffdcffdf,0xffdfffde,0xffdeffdf,0xffdbffdb,0xffdcffdc,0xffdeffdb,
-0xffdfffdf,0xffe3ffe2,0xffe1ffe3,0xffe4ffe3,0xffe7ffe5,0xffe9ffe6,0xffe6ffea,0xffe9ffeb,
-0xffebffec,0xffedffee,0xffeeffee,0xfff0fff0,0xfff1fff1,0xfff0fff4,0xfff3fff3,0xffeffff0,
-0xffeffff0,0xffedffed,0xffedffec,0xffe9ffea,0xffe5ffe6,0xffe4ffe4,0xffe1ffe2,0xffdfffe1,
-0xffdeffde,0xffdaffdc,0xffd7ffda,0xffd8ffd9,0xffd7ffd6,0xffd8ffd7,0xffd9ffd9,0xffdaffda,
-0xffdcffda,0xffdcffdb,0xffdeffde,0xffe0ffe1,0xffe3ffe4,0xffe8ffe5,0xffebffea,0xffeeffeb,
-0xfff2ffee,0xfff4fff1,0xfff5fff3,0xfffbfff9,0xfffefffd,0x00020000,0x00060006,0x00080007,
-0x000d000c,0x000e000b,0x00120011,0x00120014,0x00130017,0x00160017,0x00170018,0x001b001a,
-0x001a001d,0x001b001b,0x001c001b,0x001b001b,0x001b001e,0x001d001b,0x001d001d,0x001e001d,
-0x001b001b,0x001d001d,0x001f001d,0x001d001d,0x001b001c,0x001e001b,0x001d001d,0x001c001d,
-0x001d0021,0x001e001f,0x0020001f,0x001d001e,0x0020001c,0x0020001d,0x001e001d,0x001a001d,
-0x001d001c,0x001b0019,0x001d0017,0x00190018,0x0016001a,0x00140014,0x00120016,0x000f0011,
-0x00100011,0x000e0011,0x000f000f,0x00110012,0x000f000e,0x000f000e,0x0011000d,0x0010000c,
-0x0014000f,0x0012000f,0x00120011,0x00130013,0x00160014,0x00160013,0x00170016,0x00170018,
-0x00170018,0x00160018,0x00170016,0x00170019,0x00150017,0x00120014,0x000e0010,0x000c000e,
-0x0008000a,0x00040005,0x00030002,0xfffcfffd,0xfff8fff9,0xfff3fff5,0xfff1fff2,0xffedffef,
-0xffeaffea,0xffe6ffe8,0xffe4ffe5,0xffe0ffe2,0xffe1ffe4,0xffe0ffe0,0xffdfffe0,0xffddffe1,
-0xffe1ffe0,0xffe2ffe5,0xffe4ffe5,0xffe3ffe1,0xffe9ffe3,0xffe9ffe8,0xffe8ffe6,0xffeaffe7,
-0xffeaffea,0xffeaffe9,0xffe9ffe8,0xffe9ffe8,0xffe9ffe7,0xffe8ffe6,0xffe7ffe5,0xffe4ffe5,
-0xffe4ffe1,0xffe2ffe3,0xffe2ffe2,0xffe3ffe2,0xffe2ffe0,0xffdfffe2,0xffe0ffe2,0xffdfffe2,
-0xffe1ffe1,0xffe0ffe0,0xffe1ffe1,0xffe2ffe0,0xffe3ffe1,0xffe4ffe4,0xffe1ffe1,0xffe3ffe2,
-0xffe6ffe4,0xffe1ffe2,0xffe2ffe3,0xffe3ffe4,0xffe5ffe7,0xffe6ffe8,0xffe7ffe7,0xffe8ffe6,
-0xffebffe7,0xffebffe8,0xffedffea,0xffedffec,0xfff0ffee,0xfff2fff1,0xfff5fff4,0xfff8fff7,
-0xfffafff7,0xfffdfffb,0xfffbfffc,0xffffffff,0x00020006,0x00030006,0x00050009,0x00060007,
-0x00060009,0x00080009,0x00090009,0x000a0007,0x000d000b,0x000e000c,0x000c000b,0x000e000c,
-0x000d000e,0x000d000e,0x000f0010,0x000f0013,0x00130012,0x00130013,0x00170013,0x00180015,
-0x00190016,0x001a0019,0x001a0018,0x001b001b,0x001f001f,0x001f001f,0x001c001e,0x001d001e,
-0x001f001f,0x001e0020,0x00200020,0x001e001f,0x001e0020,0x001f001e,0x001e001e,0x001e001d,
-0x001d001f,0x00200020,0x0022001e,0x00210022,0x00220023,0x00220022,0x00230022,0x00250022,
-0x00240026,0x00260025,0x00270024,0x00290028,0x00290029,0x00270028,0x00270028,0x0027002b,
-0x00260029,0x00260028,0x00260029,0x00250027,0x00270026,0x00250026,0x00230020,0x00210020,
-0x00200021,0x0019001c,0x00170019,0x00140016,0x00110013,0x000c0010,0x000b000b,0x00060007,
-0x00040004,0x00000002,0xfffbfffc,0xfff9fff9,0xfff6fff6,0xfff2fff0,0xfff1fff0,0xffedffec,
-0xffebffea,0xffe7ffe7,0xffeaffe8,0xffeaffea,0xffe6ffe8,0xffeaffe8,0xffe7ffeb,0xffe8ffea,
-0xffe9ffea,0xffeaffeb,0xffecffeb,0xffefffeb,0xfff2ffef,0xfff0fff2,0xfff3fff2,0xfff3fff4,
-0xfff5fff3,0xfff6fff7,0xfff7fff5,0xfff5fff6,0xfff5fff4,0xfff7fff5,0xfff7fff9,0xfff7fff9,
-0xfff7fff7,0xfff6fff7,0xfff5fff6,0xfff4fff1,0xfff2fff1,0xfff1ffef,0xfff1fff2,0xffeefff1,
-0xffeffff0,0xffeffff1,0xffefffee,0xffedffed,0xffecffeb,0xffeaffed,0xffe8ffeb,0xffe9ffea,
-0xffe8ffe8,0xffe6ffe8,0xffe5ffe6,0xffe3ffe4,0xffe0ffe4,0xffe1ffe1,0xffe0ffe1,0xffdeffe2,
-0xffdeffdc,0xffdcffda,0xffdcffd9,0xffdaffdb,0xffddffda,0xffd9ffda,0xffd9ffda,0xffdaffdb,
-0xffdbffdc,0xffddffdd,0xffdeffde,0xffe1ffde,0xffe5ffe0,0xffe4ffe3,0xffe4ffe5,0xffe7ffe6,
-0xffeaffe7,0xffebffea,0xfff0ffed,0xfff1fff2,0xfff1fff0,0xfff3fff2,0xfff7fff5,0xfff6fff7,
-0xfff7fff7,0xfff5fff5,0xfff6fff6,0xfff9fff8,0xfffafff9,0xfffafff8,0xfff8fff8,0xfffcfffb,
-0xfffcfffb,0x0001ffff,0xffffffff,0x00000000,0x00000003,0x00020004,0x00050004,0x00050005,
-0x00080006,0x00070008,0x00070007,0x0008000a,0x000b000a,0x000b000b,0x000b000a,0x0009000c,
-0x00090008,0x00090009,0x00080007,0x000c0008,0x000a0009,0x000a0009,0x000b000b,0x000a0009,
-0x000b000a,0x000a000a,0x000b000c,0x000d000e,0x0011000f,0x000e000d,0x0011000f,0x00120013,
-0x00120015,0x00150012,0x00140014,0x00130013,0x00150013,0x00160015,0x00180017,0x00190017,
-0x00180018,0x00190018,0x001b001c,0x0019001b,0x0019001b,0x00190019,0x00180019,0x00150019,
-0x00160016,0x00160016,0x00180015,0x00180015,0x00150014,0x00100014,0x00130012,0x000f0012,
-0x00120014,0x000f0012,0x000f0010,0x000f0010,0x00110010,0x000f000d,0x000d000c,0x000d000a,
-0x000e000d,0x000a000c,0x000c000c,0x000d000d,0x000a000c,0x0009000c,0x000b000b,0x000b0009,
-0x0008000a,0x00090009,0x000a000a,0x0006000b,0x0009000a,0x00090008,0x00070007,0x00070008,
-0x00070008,0x00060005,0x00050004,0x00040003,0x00040003,0x00040003,0x00040004,0x00070004,
-0x00030005,0x00020004,0x00020003,0x00000002,0xffff0000,0xfffefffd,0xfffdfffc,0xfffcffff,
-0xfff9fffc,0xfffafffa,0xfff9fffa,0xfff7fff6,0xfff7fff4,0xfff2fff1,0xfff2fff1,0xffeffff0,
-0xffedfff0,0xffecffef,0xffeaffeb,0xffeaffeb,0xffe6ffea,0xffe6ffe8,0xffe6ffe8,0xffe5ffe6,
-0xffe6ffe5,0xffe4ffe6,0xffe4ffe4,0xffe8ffe7,0xffe5ffe5,0xffe4ffe8,0xffe7ffe7,0xffe9ffec,
-0xffe8ffe8,0xffecffeb,0xffebffec,0xffefffee,0xffeffff0,0xfff2ffef,0xfff3ffef,0xfff4fff2,
-0xfff4fff2,0xfff7fff4,0xfff8fff4,0xfffcfffa,0xfffbfffa,0xfffcfffb,0xfffcfffa,0xfffcfffc,
-0xfffafffa,0xfffcfffe,0x0000fffd,0xfffefffe,0x00020000,0x00020002,0x00030002,0x00040004,
-0x00030006,0x00050005,0x00060006,0x00080005,0x00060008,0x000a0007,0x00090008,0x00090007,
-0x00090009,0x00090007,0x00070007,0x00080005,0x00080003,0x00050004,0x00030003,0x00050005,
-0x00020005,0x00030003,0x00020002,0x00000004,0x00010001,0x00000003,0x00010001,0x0000ffff,
-0xffff0001,0x0001ffff,0x00010001,0x00020003,0x0003ffff,0x00040002,0x00050000,0x00070003,
-0x00050002,0x00060002,0x00060004,0x00040005,0x00050003,0x00060007,0x00070007,0x000b0007,
-0x000b000b,0x000b000a,0x000a000a,0x000b000c,0x000c000b,0x000d000b,0x000b000f,0x0010000e,
-0x0011000c,0x000f000f,0x000f0011,0x000f0011,0x000e0012,0x000e000f,0x000f0011,0x000e000f,
-0x000f000e,0x000c000e,0x000b000b,0x000c000d,0x000a000c,0x00090008,0x0009000a,0x00090008,
-0x00080007,0x00080006,0x00050006,0x00060005,0x00050007,0x00020004,0x00040003,0x00010003,
-0x00050004,0x00000002,0xffff0001,0x0000fffe,0xfffeffff,0xfffe0001,0xfffeffff,0xfffdfffe,
-0xfffdfffd,0xfffefffc,0xfffdfffe,0xfffcfffc,0xfffbfffb,0xfff9fff7,0xfff9fffa,0xfff6fff9,
-0xfff7fff7,0xfff4fff6,0xfff3fff5,0xfff5fff3,0xfff2fff1,0xffeefff1,0xffeeffee,0xffedffec,
-0xffebffeb,0xffe8ffea,0xffe4ffe6,0xffe5ffe5,0xffe4ffe5,0xffe5ffe5,0xffe3ffe4,0xffe4ffe5,
-0xffe4ffe5,0xffe4ffe5,0xffe5ffe6,0xffe3ffe5,0xffe6ffe6,0xffe4ffe6,0xffe6ffe5,0xffe4ffe5,
-0xffe7ffe5,0xffe8ffe4,0xffe6ffe5,0xffe8ffe5,0xffe6ffe6,0xffe4ffe6,0xffe5ffe7,0xffe4ffe5,
-0xffe7ffe5,0xffe5ffe8,0xffe8ffe6,0xffe9ffe6,0xffe8ffe9,0xffeaffe5,0xffe8ffe8,0xffeaffeb,
-0xffeaffec,0xffedffef,0xffecffed,0xffefffee,0xfff0ffef,0xfff2fff3,0xfff5fff5,0xfff8fff6,
-0xfffcfff7,0xfff9fff7,0xfffefff8,0xfffefff9,0xfffe0000,0xffffffff,0x00010000,0x00010003,
-0x00010002,0x00020000,0x00010001,0x00010001,0x00000000,0xfffe0001,0xffffffff,0x0001ffff,
-0x00030001,0x00010003,0x00020001,0x00050002,0x00060005,0x00060005,0x00080005,0x00080008,
-0x000a000a,0x000a000c,0x000f0011,0x0010000f,0x00110011,0x00140011,0x00160013,0x00180019,
-0x0014001a,0x00170019,0x0018001a,0x0019001a,0x001c001b,0x001a001b,0x001b001b,0x001b001c,
-0x00170019,0x001a0019,0x001b0018,0x001c001a,0x00180019,0x001b001a,0x001b0019,0x001a001a,
-0x001d001a,0x001b001d,0x001d001d,0x001d001e,0x001f001c,0x001f001f,0x001b001e,0x001e001c,
-0x001d001b,0x001e001c,0x001f001e,0x001c001d,0x001e001d,0x001c0020,0x001e0022,0x0021001f,
-0x00210020,0x00200020,0x001f001d,0x0020001e,0x0021001f,0x001e001f,0x001f001c,0x001d001d,
-0x001c001c,0x001c001a,0x0019001a,0x00150017,0x00130015,0x00130014,0x000d0012,0x000e000d,
-0x000d000e,0x0006000b,0x00050003,0x00040006,0x00010003,0x00000001,0x00010002,0xfffeffff,
-0xffffffff,0xfffffffd,0xfffffffc,0xfffefffc,0xfffdfff8,0xfffdfff9,0xfffbfffa,0xfff9fffb,
-0xfffbfffe,0xfff7fffb,0xfffafffb,0xfff9fffc,0xfff7fffa,0xfff6fffa,0xfff6fff5,0xfff6fff7,
-0xfff5fff7,0xfff5fff5,0xfff4fff3,0xfff2fff1,0xfff2fff2,0xfff2ffef,0xfff0ffee,0xffedffed,
-0xffedffee,0xffe9ffed,0xffeaffea,0xffe9ffe9,0xffe9ffe9,0xffe8ffe7,0xffe8ffe8,0xffe6ffe7,
-0xffe5ffe9,0xffe5ffe8,0xffe6ffe7,0xffe7ffe7,0xffe8ffe5,0xffe6ffe4,0xffe6ffe7,0xffe6ffe8,
-0xffe8ffe7,0xffe6ffe6,0xffe7ffe5,0xffe7ffe8,0xffe8ffe7,0xffe6ffe7,0xffe7ffe6,0xffe5ffe6,
-0xffe4ffe5,0xffe4ffe6,0xffe5ffe4,0xffe4ffe6,0xffe6ffe5,0xffe7ffe6,0xffe1ffe5,0xffe2ffe2,
-0xffe1ffe2,0xffe3ffe2,0xffe2ffe4,0xffe1ffe2,0xffe3ffe4,0xffe2ffe4,0xffe1ffe4,0xffe2ffe2,
-0xffe4ffe1,0xffe2ffe1,0xffe4ffe0,0xffe3ffdf,0xffe4ffe1,0xffe6ffe1,0xffe6ffe3,0xffe9ffe4,
-0xffe9ffe6,0xffeaffe7,0xffe9ffe7,0xffeeffea,0xffebfff0,0xffecfff0,0xfff1fff1,0xfff1fff2,
-0xfff5fff4,0xfff4fff4,0xfff8fff4,0xfff9fff7,0xfffafff9,0xfffafffc,0xfffafffa,0xfffffffb,
-0x0000fffe,0x0002ffff,0x00020000,0x00060005,0x00060005,0x00050006,0x00080009,0x0008000a,
-0x000a000a,0x000c000c,0x000e000c,0x00110010,0x00120010,0x0013000f,0x00140012,0x00160014,
-0x00130015,0x00170018,0x00190018,0x00180018,0x00180017,0x0019001a,0x0018001b,0x001a001b,
-0x001c001c,0x0020001e,0x0020001d,0x001f001d,0x001e001c,0x0021001c,0x0023001d,0x0022001d,
-0x001f001e,0x001e001f,0x001d001b,0x001d001c,0x001b001b,0x0019001c,0x00190017,0x00190017,
-0x00150017,0x00160018,0x00100018,0x00100014,0x00100010,0x000f0010,0x000c000f,0x000c000c,
-0x000a000c,0x000c000c,0x000d000c,0x000b000c,0x000b000a,0x00090007,0x00080009,0x00040008,
-0x00070008,0x00080008,0x00060006,0x00070007,0x00090007,0x00070006,0x00070008,0x00090007,
-0x00080007,0x00080009,0x00070008,0x00070009,0x00040006,0x00050006,0x00030003,0xffff0004,
-0xffff0003,0xffff0003,0xfffeffff,0xfffcfffd,0xfffafffb,0xfffbfffd,0xfffcfffd,0xfffafffb,
-0xfffdfffa,0xfffcfffb,0xfffdfffb,0xfffefffe,0xfffdfffc,0xfffdfffc,0xfffdfffd,0xfffeffff,
-0x00000002,0x00000001,0x00020002,0x00020003,0x00020002,0xfffe0001,0xfffcfffe,0xfffbffff,
-0xfff7fffb,0xfff6fff8,0xfff8fff6,0xfff6fff8,0xfff5fff4,0xfff5fff0,0xfff2fff1,0xffefffef,
-0xffeefff0,0xffeeffef,0xffeeffee,0xffeeffee,0xffedfff0,0xffeffff0,0xfff0ffee,0xffefffee,
-0xfff1fff1,0xfff4fff3,0xfff2fff2,0xfff3fff2,0xfff2fff1,0xfff4fff5,0xfff3fff5,0xfff3fff3,
-0xfff1fff4,0xfff3fff1,0xfff3fff3,0xfff1fff1,0xfff1fff1,0xfff0fff0,0xfff1fff0,0xfff0fff3,
-0xfff0fff2,0xffedfff1,0xfff1fff0,0xfff0ffee,0xfff0ffee,0xfff1ffef,0xfff1ffef,0xfff0fff1,
-0xfff1fff3,0xfff2fff3,0xfff4fff4,0xfff6fff7,0xfff8fff6,0xfff8fff9,0xfffafff7,0xfffdfffa,
-0xfffefffc,0xfffe0000,0xfffffffe,0x00020001,0x00040003,0x00030002,0x00070006,0x00090009,
-0x000b0008,0x000c000a,0x000c000d,0x000d000d,0x000f0010,0x00120011,0x00120014,0x00140011,
-0x00130014,0x00130015,0x00160013,0x00160017,0x00170017,0x00170017,0x0017001b,0x001a0019,
-0x00180019,0x00180014,0x00150016,0x00130016,0x00130013,0x00140014,0x00130014,0x00150016,
-0x00150013,0x00100012,0x0011000f,0x0010000f,0x000e000d,0x000f000d,0x000e000c,0x000b000b,
-0x000b000a,0x000c000b,0x0008000a,0x00090008,0x00090009,0x00070007,0x00070007,0x00070006,
-0x00070006,0x00050004,0x00050004,0x00030003,0x00030003,0xfffe0002,0x00000002,0x00000003,
-0x00000001,0xfffe0002,0xfffe0001,0xfffe0000,0xffffffff,0xfffcffff,0xfffcfffa,0xfffcfffa,
-0xfff9fffa,0xfff6fff7,0xfff5fff6,0xfff3fff5,0xfff4fff3,0xfff2fff3,0xfff1fff1,0xffeefff3,
-0xffeffff3,0xffefffee,0xfff1ffef,0xfff1ffee,0xfff0ffef,0xfff2fff0,0xfff2ffee,0xfff2fff2,
-0xfff1fff1,0xfff3fff1,0xfff6fff3,0xfff5fff3,0xfff5fff6,0xfff2fff4,0xfff5fff8,0xfff3fff5,
-0xfff5fff6,0xfff2fff4,0xfff2ffee,0xfff4fff4,0xfff1ffef,0xfff0ffee,0xfff0ffee,0xffecffec,
-0xffebffee,0xffe8fff0,0xffe9ffeb,0xffe6ffea,0xffe9ffea,0xffe8ffe9,0xffe7ffe8,0xffe7ffe8,
-0xffe7ffe7,0xffeaffe6,0xffe9ffe8,0xffebffe9,0xffebffe9,0xffebffea,0xffeaffeb,0xffebffeb,
-0xffedffed,0xffedffed,0xffeaffee,0xffebffef,0xffecffed,0xffebffec,0xffecffe9,0xffefffeb,
-0xfff0ffec,0xffefffed,0xffebffeb,0xffeeffea,0xffefffed,0xffeffff1,0xffefffef,0xfff2fff0,
-0xfff3fff1,0xfff7fff6,0xfff9fff7,0xfff9fff8,0xfffdfffa,0xfffefffe,0xffff0000,0x00020000,
-0x00050003,0x00050004,0x00050005,0x00070006,0x00060008,0x0006000a,0x000a0009,0x000b000b,
-0x000e000d,0x000c000c,0x000c000c,0x000e000c,0x000f000e,0x000d000e,0x0011000f,0x00100010,
-0x00100010,0x00150011,0x00150011,0x00140012,0x00170012,0x00150013,0x00160015,0x00160018,
-0x0016001a,0x00160018,0x0016001a,0x0019001c,0x001a0018,0x00170018,0x00180017,0x00180017,
-0x00170017,0x0017001b,0x00180018,0x00180019,0x00190018,0x00190018,0x001c0019,0x001b001a,
-0x00180018,0x00190018,0x00170019,0x00190017,0x001a001a,0x001b001c,0x0019001b,0x0019001a,
-0x001b0019,0x001a0019,0x001b001b,0x0019001a,0x0018001a,0x0019001a,0x0017001a,0x00180018,
-0x00180018,0x0016001b,0x00140015,0x00120014,0x00140013,0x00140012,0x00100011,0x000e000f,
-0x000b000c,0x0009000d,0x00080008,0x00050007,0x00070007,0x00060003,0x00060006,0x00020005,
-0x00010001,0x00040002,0xffff0002,0x00010003,0x00020004,0x00010001,0x00010001,0x00050000,
-0x00030003,0x00030003,0x00040003,0x00030004,0x00050004,0x00040006,0x00010004,0x00030004,
-0x00030005,0x00000001,0x0001ffff,0x00010000,0x0000fffe,0xfffffffe,0xfffcfffd,0xfffcfffb,
-0xfff9fffb,0xfff8fff9,0xfff5fff6,0xfff5fff7,0xfff0fff4,0xffeefff2,0xffedffef,0xffeaffee,
-0xffebffeb,0xffe8ffea,0xffe8ffe8,0xffe7ffe7,0xffe6ffe6,0xffe3ffe3,0xffe2ffe5,0xffe1ffe2,
-0xffe1ffe0,0xffe0ffe0,0xffdfffdd,0xffe2ffe0,0xffdfffe1,0xffe0ffe0,0xffdfffe1,0xffdfffe0,
-0xffdeffdf,0xffe0ffe2,0xffe0ffe3,0xffdfffe1,0xffdfffe1,0xffe1ffe2,0xffdcffe0,0xffdeffe0,
-0xffdfffdd,0xffdeffdc,0xffe1ffdd,0xffe1ffe1,0xffe1ffe0,0xffe0ffe2,0xffe3ffe2,0xffe6ffe5,
-0xffe8ffe6,0xffe6ffe8,0xffe9ffe8,0xffeeffea,0xffedffeb,0xffeeffee,0xfff1fff0,0xfff4fff3,
-0xfff5fff5,0xfff6fff6,0xfff9fff8,0xfffafffa,0xfffcfffa,0xfffcfffd,0xfff8fff9,0xfff8fff8,
-0xfffafff7,0xfffbfffb,0xfffafffb,0xfffafff9,0xfffbfffb,0xfffcfffc,0xfffdfffd,0xfffdfffc,
-0xffffffff,0xffff0000,0x00000000,0x00010001,0x00040001,0x00040002,0x00010003,0x00030003,
-0x00020003,0x00050003,0x00040004,0x00040005,0x00060007,0x00070009,0x00060006,0x00060004,
-0x00060005,0x00080007,0x00080008,0x00080006,0x00090009,0x00080008,0x00080008,0x000a000b,
-0x0009000a,0x000b0009,0x000b0009,0x000b000b,0x000e000c,0x000d000e,0x000e000d,0x000f000e,
-0x000f0011,0x00130010,0x00130014,0x00150012,0x00150015,0x00150015,0x00180016,0x00160017,
-0x00120014,0x00140014,0x00130013,0x00130012,0x00120014,0x00120017,0x00140016,0x00150016,
-0x00140013,0x00120013,0x00140011,0x00120013,0x00150012,0x00140013,0x00150011,0x00130015,
-0x00130015,0x00170018,0x00160016,0x00170016,0x00190017,0x00150016,0x00140016,0x00120013,
-0x00130014,0x00120011,0x0011000f,0x000f0010,0x000f000f,0x000b000d,0x000c0009,0x000a000a,
-0x00080008,0x00070005,0x00040003,0xfffd0002,0x0000ffff,0xfffdfffe,0xfffbfffe,0xfffafffb,
-0xfff7fff7,0xfff6fff7,0xfff5fff7,0xfff6fff6,0xfff3fff8,0xfff4fff3,0xfff4fff3,0xfff4fff4,
-0xfff2fff1,0xfff1ffef,0xfff1fff0,0xfff0ffef,0xfff1fff2,0xffeffff0,0xffeffff0,0xfff0fff2,
-0xfff4fff4,0xfff4fff2,0xfff7fff4,0xfff5fff3,0xfff7fff6,0xfff7fff6,0xfff6fff6,0xfff6fff8,
-0xfff5fff6,0xfff8fff7,0xfff7fff8,0xfff7fff8,0xfff6fff8,0xfff5fff7,0xfff5fff7,0xfff3fff3,
-0xfff2fff2,0xfff1fff1,0xfff2fff1,0xfff0fff1,0xffecfff1,0xffeeffef,0xfff1ffef,0xffeefff3,
-0xffeefff0,0xffeefff0,0xffefffee,0xfff0ffee,0xfff0ffee,0xfff1ffef,0xfff0fff0,0xfff4fff2,
-0xfff5fff3,0xfff2fff4,0xfff5fff4,0xfff9fff6,0xfffafffb,0xfffbfffa,0xfffefffd,0x0000ffff,
-0x00020000,0x00040000,0x00070002,0x00060003,0x00080008,0x00090008,0x000a0009,0x00090008,
-0x000a0007,0x000b000a,0x000a0008,0x00080009,0x00070008,0x0007000a,0x0006000a,0x00070009,
-0x0009000a,0x0008000a,0x00070006,0x0007000a,0x000a0009,0x00070009,0x0007000b,0x0007000a,
-0x0009000a,0x00090009,0x00080008,0x0009000a,0x000b000b,0x0009000a,0x000c000a,0x0009000c,
-0x00090004,0x00070006,0x00070008,0x00060007,0x00060006,0x00030004,0x00050005,0x00070005,
-0x00060006,0x00040005,0x00050006,0x00070006,0x00050007,0x00040006,0x00060006,0x00070005,
-0x00070007,0x00080008,0x00060007,0x00090008,0x000a0007,0x00080009,0x0009000b,0x0009000c,
-0x0009000a,0x000a0009,0x000b0008,0x000a0007,0x00090009,0x00080009,0x000a0008,0x000d000d,
-0x000b000a,0x000b000c,0x000b000b,0x000c000b,0x000c000b,0x000b000a,0x0008000a,0x00060009,
-0x00070008,0x00060009,0x00050006,0x00020004,0x00010000,0xfffefffd,0xfffdfffd,0xfffafffc,
-0xfff8fff9,0xfff6fff8,0xfff5fff5,0xfff3fff3,0xfff2fff3,0xfff0fff3,0xffeffff1,0xffeffff0,
-0xfff1ffef,0xfff1ffed,0xffeefff0,0xffeffff2,0xffefffef,0xfff2fff2,0xfff2ffed,0xfff1ffef,
-0xfff1fff1,0xffeffff3,0xfff2fff1,0xfff3fff2,0xfff2fff1,0xfff0fff3,0xfff1fff0,0xfff0fff4,
-0xfff1fff2,0xfff1ffef,0xffedffed,0xffeeffee,0xffedffed,0xffebffeb,0xffecffea,0xffe9ffeb,
-0xffe8ffeb,0xffeaffeb,0xffebffe8,0xffebffe9,0xffe8ffea,0xffe8ffe8,0xffeaffeb,0xffecffeb,
-0xffeaffec,0xffedffec,0xffefffed,0xffeeffef,0xfff0ffee,0xfff2fff0,0xfff1fff1,0xfff0ffee,
-0xfff1ffee,0xfff2fff1,0xfff2fff0,0xfff1fff3,0xfff0fff1,0xffeffff3,0xffeefff1,0xfff1fff3,
-0xffeffff3,0xffedfff2,0xfff4fff0,0xfff1fff3,0xfff4fff0,0xfff4fff4,0xfff5fff5,0xfff8fff6,
-0xfff9fff5,0xfffafff8,0xfffdfffc,0xfffbfffd,0xfffefffc,0xfffdfffd,0xffffffff,0xffffffff,
-0x0000ffff,0x00020001,0x00040007,0x00030003,0x00030005,0x00030004,0x00050005,0x00080005,
-0x00080007,0x00080008,0x000b0009,0x000b0008,0x000a000a,0x000c000b,0x000e000e,0x000f000f,
-0x00120010,0x00120012,0x00140013,0x00140014,0x00120015,0x00160016,0x00160018,0x00160017,
-0x00170017,0x001a0018,0x001a0019,0x00180018,0x001a0019,0x001b001a,0x001a001a,0x001e001c,
-0x001f001e,0x001f0020,0x001e001e,0x001f001d,0x001e0020,0x001d0020,0x00200022,0x001f0021,
-0x001e001e,0x001f001e,0x001e001e,0x001f001c,0x001c001c,0x001d001c,0x001a001c,0x001a001d,
-0x0019001a,0x00170017,0x00150015,0x00160014,0x00130012,0x00120011,0x00110011,0x00130013,
-0x00120013,0x000f0012,0x00100010,0x000e000f,0x000d000f,0x000f000e,0x000f000f,0x000e0011,
-0x000b000e,0x000d000f,0x000c000f,0x000d000d,0x000d000d,0x000a0009,0x000a0008,0x00080009,
-0x00060005,0x00010004,0x00010003,0xfffeffff,0xfffdffff,0xfffbfffe,0xfff7fffb,0xfff6fff6,
-0xfff8fff5,0xfff3fff5,0xfff3fff3,0xfff2fff1,0xfff1ffef,0xfff0fff2,0xfff0fff0,0xfff1ffef,
-0xfff0fff3,0xfff0fff2,0xfff3fff0,0xfff0fff2,0xfff0ffef,0xfff3ffee,0xfff3fff2,0xfff4fff3,
-0xfff5fff1,0xfff2fff3,0xfff3fff2,0xfff0fff4,0xffeffff0,0xfff2ffef,0xfff2fff3,0xfff1fff0,
-0xffeffff3,0xffedfff0,0xffedfff2,0xffedfff0,0xffefffef,0xfff0fff0,0xffeeffee,0xffeaffed,
-0xffeaffea,0xffeaffed,0xffe9ffea,0xffe9ffe8,0xffe8ffe6,0xffe4ffe8,0xffe6ffe6,0xffe2ffe5,
-0xffe3ffe3,0xffe4ffe3,0xffe1ffe3,0xffe4ffe2,0xffe2ffe4,0xffe4ffe3,0xffe4ffe5,0xffe5ffe3,
-0xffe7ffe4,0xffe3ffe6,0xffe7ffe7,0xffe5ffe8,0xffe6ffe6,0xffe8ffe5,0xffe8ffe8,0xffe9ffe7,
-0xffe8ffe9,0xffe9ffe9,0xffebffe9,0xffebffec,0xffeeffeb,0xffebffeb,0xffefffec,0xffefffed,
-0xfff0ffef,0xfff2fff1,0xfff1fff3,0xfff2fff5,0xfff4fff3,0xfff5fff6,0xfff6fff6,0xfff5fff6,
-0xfff8fff8,0xfff8fffa,0xfff8fff8,0xfffafffc,0xfffefffb,0xfffbfffd,0xfffcfffd,0xfffffffc,
-0x0000fffe,0x00040002,0x00020003,0x00030004,0x00040005,0x00060005,0x00090007,0x000b0009,
-0x000d000d,0x000d000d,0x000e000d,0x000e000c,0x0011000f,0x00150011,0x00160012,0x00130013,
-0x00130011,0x00120011,0x00120010,0x00150012,0x00170014,0x00140014,0x00140013,0x00160013,
-0x00180014,0x00140015,0x00160013,0x00160018,0x00160018,0x00140018,0x00180019,0x00190019,
-0x00170019,0x00180018,0x00150018,0x00170019,0x00170018,0x00170018,0x00180017,0x00180017,
-0x00190019,0x00170017,0x00130017,0x00120016,0x00120012,0x00120014,0x00130012,0x00110012,
-0x000f0012,0x000e000f,0x000e000e,0x000b000b,0x000a0009,0x000a0006,0x00060008,0x00050006,
-0x00040003,0x00040000,0x0001fffe,0xfffffffc,0xfffeffff,0xfffafffd,0xfffafffb,0xfff9fffb,
-0xfff9fff8,0xfff9fff9,0xfff8fffa,0xfffafffb,0xfffbfffc,0xfffafffa,0xfff8fffa,0xfffbfff9,
-0xfffefffa,0xfffcfffa,0xfffbfffc,0xfffcfffa,0xfffcfffb,0xfffbfffb,0xfffbfffc,0xfffbfffe,
-0xfffcfffe,0xfffefffe,0xfffdfffd,0x0000fffd,0xffff0000,0x0000ffff,0x0000ffff,0xfffefffe,
-0xfffffffe,0x0000ffff,0x0000ffff,0xfffefffc,0xfffefffd,0xfffefffc,0xfffbfffd,0xfffafffd,
-0xfff9fffd,0xfff7fffa,0xfff9fffb,0xfff7fff8,0xfff6fff5,0xfff5fff3,0xfff3fff2,0xfff2fff0,
-0xfff2fff0,0xfff2fff0,0xfff0fff4,0xffeefff1,0xffeffff1,0xffeffff0,0xffeffff0,0xffeefff0,
-0xfff0fff1,0xffeffff0,0xfff1ffee,0xfff1fff0,0xfff0ffef,0xfff3fff1,0xfff3fff2,0xfff2fff1,
-0xfff4fff2,0xfff4fff2,0xfff5fff5,0xfff7fff6,0xfff7fff7,0xfff6fff8,0xfff7fff8,0xfff9fff8,
-0xfffbfffb,0xfffcfffd,0xfffcfffc,0xfffffffd,0x00010000,0x00020000,0x00000000,0xfffe0001,
-0xfffdffff,0xfffeffff,0xfffeffff,0xfffffffc,0xfffefffd,0xfffffffe,0xfffdfffc,0xfffefffd,
-0xfffdffff,0xfffdfffc,0xfffefffb,0xfffdfffd,0xfffffffe,0xfffffffe,0xffff0001,0xffff0001,
-0x00040004,0x00050005,0x00090006,0x00080008,0x000a000b,0x000d000d,0x0010000f,0x00120011,
-0x00130013,0x00140013,0x00140011,0x00150013,0x00160014,0x00150014,0x00140012,0x00140012,
-0x00150013,0x00130012,0x00140013,0x00150013,0x00130014,0x00110012,0x00100010,0x0011000f,
-0x00100010,0x000d000f,0x000d000e,0x000d000f,0x000f0012,0x00100010,0x000f000e,0x000f000e,
-0x000f000d,0x000f000d,0x000d000b,0x000b000c,0x000b000c,0x000b000b,0x000b000a,0x00070007,
-0x00060007,0x00040003,0x00020001,0x00020002,0xffff0002,0xfffdfffe,0xfffafffc,0xfffafffb,
-0xfff9fffa,0xfff9fff9,0xfff7fff6,0xfff7fff6,0xfff5fff6,0xfff5fff6,0xfff5fff6,0xfff6fff5,
-0xfff6fff6,0xfff6fff6,0xfff5fff6,0xfff7fff6,0xfff9fffa,0xfff8fff6,0xfffbfffa,0xfffdfffc,
-0xfffcfffd,0xfffcfffc,0xfffdfffd,0xfffdfffa,0xfffbfffd,0xfffdfffc,0xfffafffe,0xfffbfffc,
-0xfffafffa,0xfff8fff9,0xfff9fff6,0xfff8fff7,0xfff5fff7,0xfff5fff6,0xfff3fff6,0xfff2fff5,
-0xfff2fff4,0xfff3fff2,0xfff1fff1,0xfff2fff2,0xfff1fff0,0xffeeffee,0xffeeffee,0xffebffec,
-0xffedffec,0xffebffed,0xffe9ffe8,0xffe8ffe9,0xffe6ffe7,0xffe5ffe6,0xffe6ffe4,0xffe6ffe6,
-0xffe4ffe7,0xffe6ffe6,0xffe7ffe8,0xffe8ffe9,0xffeaffe9,0xffeaffe9,0xffe9ffea,0xffefffeb,
-0xffefffef,0xfff1fff3,0xfff4fff4,0xfff4fff4,0xfff4fff6,0xfff8fffa,0xfffafffa,0xfffbfff8,
-0xfffbfff8,0xfffafff9,0xfff9fffa,0xfff8fffa,0xfff8fff9,0xfff7fff9,0xfff9fff7,0xfff6fff7,
-0xfff6fff5,0xfff6fff5,0xfff6fff4,0xfff4fff5,0xfff3fff6,0xfff4fff4,0xfff5fff4,0xfff6fff6,
-0xfff7fff6,0xfff6fff5,0xfff9fff8,0xfffcfff9,0xfffdfffb,0x0001fffd,0xffff0000,0x0000ffff,
-0x00010000,0x00010003,0x00050003,0x00050007,0x00060005,0x00070006,0x00080009,0x000b000a,
-0x000e000c,0x000b000c,0x000e000c,0x000e000f,0x000f000e,0x0010000f,0x000e0010,0x00100010,
-0x00120010,0x0012000d,0x0016000f,0x00130011,0x00120012,0x00120013,0x00120012,0x00100014,
-0x00130015,0x00150016,0x00160014,0x00160014,0x00180017,0x00150016,0x00170019,0x00170019,
-0x0019001a,0x001b001b,0x001a001c,0x001c001a,0x001c001f,0x001e001e,0x001c001e,0x001b001d,
-0x001c001c,0x001b001c,0x0019001a,0x0019001b,0x001a001b,0x00190018,0x00180019,0x00190017,
-0x00170016,0x00170014,0x00180019,0x00170017,0x00170016,0x00150016,0x00170017,0x00170015,
-0x00180017,0x00180017,0x00150014,0x00140016,0x00150012,0x00130013,0x00150011,0x00110011,
-0x00110011,0x00110012,0x000f0010,0x000d000e,0x000b000e,0x0009000a,0x00060009,0x00040006,
-0x00030004,0x00010002,0x00010001,0xfffeffff,0xfffe0001,0xfffbffff,0xfff9fffd,0xfff9fff9,
-0xfff9fff8,0xfff5fff6,0xfff4fff4,0xfff1fff4,0xfff2fff1,0xfff0ffef,0xffefffed,0xfff0ffed,
-0xffecffeb,0xffedffec,0xffeaffec,0xffeaffeb,0xffe8ffeb,0xffe8ffea,0xffe8ffea,0xffe9ffe9,
-0xffe9ffeb,0xffe7ffea,0xffe8ffe8,0xffe7ffe9,0xffe7ffe5,0xffe6ffe6,0xffe6ffe6,0xffe5ffe5,
-0xffe5ffe4,0xffe4ffe4,0xffe3ffe5,0xffe4ffe5,0xffe6ffe4,0xffe4ffe4,0xffe3ffe3,0xffe4ffe5,
-0xffe7ffe4,0xffe5ffe6,0xffe5ffe7,0xffe7ffe6,0xffe7ffe6,0xffe6ffe7,0xffe8ffe7,0xffeaffe9,
-0xffeaffe9,0xffe7ffe9,0xffe7ffea,0xffe9ffea,0xffe9ffeb,0xffeaffeb,0xffebffea,0xffebffeb,
-0xffeeffeb,0xfff0ffec,0xfff1fff0,0xfff4fff1,0xfff2fff2,0xffeeffef,0xffeffff0,0xffeffff1,
-0xfff0fff1,0xfff2fff1,0xfff2fff2,0xffeffff5,0xfff2fff2,0xfff2fff2,0xfff5fff5,0xfff3fff2,
-0xfff3fff4,0xfff4fff3,0xfff4fff4,0xfff5fff4,0xfff6fff6,0xfff6fff4,0xfff7fff8,0xfffbfffa,
-0xfffcfffd,0xfffefffe,0x00000000,0x0002ffff,0xffff0000,0x00030001,0x00040003,0x00050006,
-0x00060005,0x00080006,0x00080008,0x000a0006,0x00090009,0x0009000b,0x000b000a,0x000b000b,
-0x000d000b,0x000e000c,0x0009000c,0x000c000f,0x000d000d,0x000f000d,0x0010000d,0x000c000d,
-0x0010000e,0x000f0010,0x00110011,0x0010000f,0x00100010,0x00100011,0x00110011,0x00110013,
-0x00110011,0x00110011,0x00130010,0x00140011,0x00140014,0x00130013,0x00140013,0x00130015,
-0x00150012,0x00140013,0x00140015,0x00160017,0x00140016,0x00110016,0x00150015,0x00120014,
-0x00120010,0x0012000f,0x00130011,0x0010000f,0x00100011,0x000d0010,0x000f000e,0x0012000f,
-0x0010000e,0x000f000e,0x000f000e,0x000d000e,0x000e000c,0x000e000c,0x000f000e,0x000e0010,
-0x000d000e,0x000c000f,0x000d000f,0x000d000e,0x000d000c,0x000c000a,0x000a000a,0x000b000b,
-0x000a000d,0x000a000c,0x000a0009,0x00080008,0x00070005,0x00070004,0x00050001,0x00040001,
-0x00010000,0xffff0001,0xfffd0001,0xfffdfffd,0xfffafffb,0xfff8fffa,0xfff6fff9,0xfff6fff8,
-0xfff2fff7,0xfff3fff6,0xfff1fff4,0xfff2fff3,0xfff1ffef,0xfff0ffed,0xffefffec,0xffebffe9,
-0xffecffe8,0xffebffe5,0xffeaffe7,0xffeaffe7,0xffe7ffe7,0xffe7ffe9,0xffe7ffe8,0xffe5ffe7,
-0xffe3ffe7,0xffe5ffe5,0xffe3ffe3,0xffe2ffe2,0xffe2ffe0,0xffe2ffe1,0xffe0ffe1,0xffe0ffe0,
-0xffe0ffe1,0xffe3ffe4,0xffe2ffe1,0xffe2ffe2,0xffe3ffe2,0xffe7ffe3,0xffe8ffe7,0xffeaffe9,
-0xffe9ffea,0xffedffea,0xffefffed,0xfff0ffec,0xffefffee,0xfff0fff1,0xfff2fff1,0xfff2fff3,
-0xfff4fff2,0xfff4fff2,0xfff5fff3,0xfff4fff6,0xfff6fff7,0xfff8fff5,0xfff4fff7,0xfff5fff6,
-0xfff7fff5,0xfff6fff6,0xfff9fff9,0xfff9fffa,0xfffafff9,0xfffbfff9,0xfffcfffb,0xfffafffa,
-0xfffcfffc,0xfffafffe,0xfffbfffe,0xfffdfffc,0xfffffffc,0xfffefffc,0xfffcfffd,0x0000fffe,
-0xfffd0000,0xffffffff,0x00010000,0x00000001,0x00020002,0x00040005,0x00090006,0x000a0008,
-0x000c000b,0x000d000b,0x000f000c,0x0013000f,0x00130011,0x00130011,0x00150013,0x00150017,
-0x00190015,0x001b0017,0x001b0019,0x001c001b,0x001a001c,0x001d001d,0x001d001c,0x001c001c,
-0x001b001e,0x001d001d,0x001c001d,0x001b001c,0x001d001c,0x001d001c,0x001e001a,0x001c001c,
-0x001c001d,0x001d001c,0x001c001b,0x001b001c,0x001b001b,0x001a001b,0x001d001c,0x001b001d,
-0x001b001b,0x001e001b,0x001c001c,0x001e001c,0x001c001c,0x001d001e,0x001c001d,0x001b001d,
-0x001d001a,0x001c001b,0x001a001a,0x00190019,0x0017001a,0x00150019,0x00160018,0x00120016,
-0x00120013,0x00110011,0x00110010,0x0012000e,0x000f000e,0x000f000d,0x000e000f,0x000d000e,
-0x000c000b,0x000a000c,0x0009000b,0x0008000a,0x0008000a,0x00090009,0x00080005,0x00030004,
-0x00030004,0x00010003,0x00020002,0x00010002,0xffffffff,0xfffffffd,0xfffdfffc,0xfffbfffa,
-0xfff9fffa,0xfff7fff9,0xfff8fff6,0xfff6fff6,0xfff6fff6,0xfff4fff2,0xfff3fff1,0xffeffff1,
-0xffecfff1,0xffebffee,0xffe9ffeb,0xffe9ffe8,0xffe4ffe5,0xffe3ffe4,0xffe4ffe3,0xffe1ffe2,
-0xffe4ffe0,0xffe0ffe1,0xffe0ffe2,0xffdfffe0,0xffe0ffe0,0xffe1ffe1,0xffdfffe1,0xffe0ffdf,
-0xffe0ffde,0xffe1ffe3,0xffe0ffe2,0xffe0ffdf,0xffe2ffdf,0xffe1ffe0,0xffe0ffdf,0xffe0ffe0,
-0xffe2ffe0,0xffe2ffe2,0xffddffe1,0xffdeffdf,0xffe1ffe0,0xffdfffdf,0xffddffde,0xffdeffdd,
-0xffdcffdd,0xffdeffe0,0xffdeffe0,0xffdeffde,0xffe2ffe0,0xffe3ffe1,0xffe4ffe5,0xffe6ffe3,
-0xffe6ffe4,0xffe8ffe6,0xffebffe9,0xffeaffed,0xffebffeb,0xffedffeb,0xffedffeb,0xfff0ffee,
-0xfff1fff0,0xfff3fff3,0xfff4fff3,0xfff5fff4,0xfff5fff6,0xfff7fff7,0xfff8fff9,0xfff9fff8,
-0xfffcfffa,0xfffbfff8,0xfffcfffa,0xfffbfffb,0xfffcfffc,0xffffffff,0xfffd0000,0xfffefffe,
-0xffff0000,0x0000ffff,0x00000000,0x00010000,0x00000000,0x00030002,0x00020003,0x00020001,
-0x00030004,0x00060004,0x00050005,0x00050003,0x00080004,0x00080008,0x00070007,0x000a0008,
-0x0009000a,0x000c0009,0x000c000a,0x000c000a,0x000c000b,0x000d000d,0x000e000e,0x000f000d,
-0x0011000f,0x000f0011,0x00120011,0x00110010,0x00120011,0x00110013,0x00100012,0x00120012,
-0x00140013,0x00120014,0x00130013,0x00150012,0x00150014,0x00140014,0x00140014,0x00120013,
-0x00110012,0x00110011,0x0011000f,0x00100011,0x0011000f,0x00110011,0x00130012,0x00120010,
-0x00120011,0x00150014,0x00160015,0x00150015,0x00170017,0x00150018,0x00160017,0x00190017,
-0x00160018,0x00140018,0x0014001a,0x00150017,0x00140016,0x00130017,0x00120016,0x00160014,
-0x00140018,0x00120013,0x00120013,0x00110014,0x00120012,0x00110011,0x000d000e,0x000d000f,
-0x000a000b,0x000a0008,0x00080009,0x000a0008,0x00080006,0x00060006,0x00020006,0x00030003,
-0x00020002,0xfffeffff,0xfffdfffe,0xfffcfffe,0xfff7fffb,0xfff7fff8,0xfff7fffa,0xfff7fff8,
-0xfff7fff6,0xfff7fff4,0xfff6fff5,0xfff9fff7,0xfff7fff8,0xfff5fff6,0xfff6fff6,0xfff7fff7,
-0xfff8fff7,0xfff9fff7,0xfff9fffc,0xfff8fffb,0xfff9fffa,0xfffafffb,0xfffbfffa,0xfffdfffb,
-0xfffcfffc,0xfffbfffb,0xfff9fff8,0xfff7fff8,0xfff7fff7,0xfff7fff9,0xfff7fffa,0xfff8fff8,
-0xfff6fff7,0xfff4fff4,0xfff3fff2,0xfff3fff1,0xfff2fff1,0xffeefff0,0xfff1fff0,0xffeeffef,
-0xffefffef,0xffeefff2,0xfff0fff1,0xffefffef,0xfff0ffee,0xfff1ffef,0xfff0fff0,0xfff0ffee,
-0xffefffee,0xffeeffef,0xffeeffef,0xffeeffef,0xffedffed,0xffecffee,0xffebffee,0xffe9ffec,
-0xffecffed,0xffeaffea,0xffeaffe8,0xffeaffe8,0xffe7ffe7,0xffe7ffe6,0xffe7ffe7,0xffe7ffe6,
-0xffeaffe8,0xffeaffeb,0xffedffeb,0xffecffed,0xffefffee,0xfff0fff0,0xfff3fff2,0xfff6fff6,
-0xfffbfffa,0xfffcfff9,0xfffffffb,0x00020000,0x00040002,0x00050004,0x00090007,0x00090007,
-0x000a000d,0x000a000b,0x000b000d,0x000d000f,0x000e000f,0x000f000d,0x000d000f,0x000f000d,
-0x000f000e,0x000d000c,0x000e000f,0x000b000c,0x000b000b,0x000c000c,0x000b000e,0x000c000d,
-0x000b000d,0x000c000e,0x000f000d,0x000f000d,0x0010000d,0x000e000d,0x000f0011,0x00100010,
-0x000d0011,0x000d000e,0x000f000d,0x000c000c,0x000f000c,0x000e000c,0x0010000f,0x0011000e,
-0x00130011,0x00120010,0x00120013,0x00110012,0x00150013,0x00140015,0x00140015,0x00160017,
-0x00140016,0x00170016,0x00150015,0x00160016,0x00170015,0x00150014,0x00160016,0x00130013,
-0x00120012,0x00150013,0x00130016,0x000f0011,0x000f0011,0x000f0011,0x000e0010,0x000e000d,
-0x000a000b,0x00070008,0x00060007,0x00030004,0x00030002,0x00030001,0x00000000,0xfffdfffd,
-0xfffbfff9,0xfff8fffa,0xfff6fff8,0xfff0fff4,0xfff0fff1,0xffedfff2,0xffeffff0,0xffecfff0,
-0xffebffee,0xffedffed,0xffe9ffeb,0xffeaffea,0xffe9ffea,0xffe9ffea,0xffe7ffe9,0xffe7ffe8,
-0xffe8ffea,0xffeaffea,0xffeaffe9,0xffebffed,0xffedffed,0xffedffec,0xffebffec,0xffeeffec,
-0xffedffed,0xffefffed,0xffefffee,0xffeeffee,0xffefffef,0xfff0ffee,0xffefffee,0xfff3ffee,
-0xffefffef,0xffeeffef,0xffefffee,0xffecffec,0xffecffed,0xffecffed,0xffe9ffed,0xffeaffea,
-0xffeaffea,0xffe9ffe8,0xffe8ffea,0xffe7ffe8,0xffe6ffe7,0xffe5ffe6,0xffe5ffe4,0xffe4ffe3,
-0xffe4ffe4,0xffe6ffe6,0xffe5ffe4,0xffe6ffe6,0xffe8ffe5,0xffe7ffe8,0xffe7ffe8,0xffe9ffe7,
-0xffe8ffe8,0xffebffe9,0xffebffea,0xffedffeb,0xffeeffee,0xffeefff0,0xfff2fff1,0xfff4fff3,
-0xfff6fff6,0xfff7fff8,0xfff9fff7,0xfffafffa,0xfffcfffc,0xfffdfffc,0x0000ffff,0x00020002,
-0x0003ffff,0x00060002,0x00070004,0x00080004,0x000a0007,0x000c000c,0x000b0009,0x000d000a,
-0x000e000e,0x000d000f,0x00100010,0x0012000e,0x0012000f,0x00110013,0x00120011,0x00120011,
-0x00130013,0x00100014,0x00130015,0x00160014,0x00120013,0x00170014,0x00160015,0x00130015,
-0x00160017,0x00170019,0x001a0019,0x0019001a,0x001c001b,0x001d001c,0x001e001e,0x001f0021,
-0x00210024,0x00210023,0x00230023,0x00230023,0x00240022,0x00230024,0x00260023,0x00260024,
-0x00260024,0x00250023,0x00250023,0x00240022,0x00210023,0x00210022,0x00210023,0x00210020,
-0x001f0021,0x001f001d,0x0020001e,0x001d001c,0x001c001c,0x001c001c,0x001d001d,0x0019001d,
-0x0019001a,0x00160019,0x00140015,0x00140014,0x00110012,0x00120012,0x000e0010,0x000c000c,
-0x000a000b,0x00070009,0x00050005,0x00040004,0x00000002,0x00000000,0xfffdffff,0xfffcfffd,
-0xfffbfffc,0xfffafffb,0xfff8fffa,0xfff8fff8,0xfff8fff8,0xfff6fff7,0xfff8fff9,0xfff8fff9,
-0xfff9fffa,0xfff9fffa,0xfff6fff8,0xfffafff7,0xfffafff8,0xfff9fff8,0xfff7fff5,0xfffbfff9,
-0xfff9fff8,0xfff9fff7,0xfff6fff5,0xfff4fff5,0xfff1fff4,0xfff3fff2,0xfff0fff3,0xffedfff0,
-0xffedfff0,0xffefffee,0xffedffee,0xffebffec,0xffecffed,0xffecffe8,0xffebffec,0xffeaffe9,
-0xffe9ffe7,0xffe8ffe8,0xffe7ffe6,0xffe6ffea,0xffe7ffea,0xffe5ffe8,0xffe6ffe8,0xffe5ffe3,
-0xffe3ffe1,0xffe4ffe1,0xffe0ffe1,0xffe0ffe0,0xffe0ffe2,0xffdfffde,0xffddffdf,0xffddffde,
-0xffddffde,0xffddffdc,0xffdbffdc,0xffddffdb,0xffdaffda,0xffdcffdd,0xffdeffdc,0xffddffde,
-0xffdeffdf,0xffe1ffdf,0xffe2ffe1,0xffe1ffe1,0xffe5ffe5,0xffe3ffe6,0xffe6ffe7,0xffe8ffe9,
-0xffe9ffea,0xffecffea,0xffeaffed,0xffebffec,0xffefffee,0xfff0ffef,0xfff0fff1,0xfff1fff0,
-0xfff3fff1,0xffeffff2,0xfff2fff1,0xfff3fff2,0xfff4fff3,0xfff7fff6,0xfff5fff6,0xfff9fff7,
-0xfffbfff9,0xfffcfff9,0xfffffffa,0xfffffffe,0x0000ffff,0x00020000,0x00060003,0x00060005,
-0x00070005,0x000b0005,0x00090007,0x000a0006,0x000b0008,0x000c000a,0x000e000c,0x000e000e,
-0x000e000f,0x00110012,0x00100015,0x00110011,0x00150011,0x00120014,0x00150016,0x00150016,
-0x00160017,0x00170018,0x00190019,0x00170019,0x00190019,0x00190019,0x001c001a,0x001a001a,
-0x00180018,0x00190019,0x00180017,0x00160019,0x00130017,0x00140014,0x00110011,0x00120013,
-0x00100011,0x00100011,0x000c000c,0x000c000c,0x000d000b,0x000d000c,0x000c000b,0x000d000d,
-0x000d000e,0x000e000e,0x000f0010,0x000e000f,0x000f000f,0x000f0011,0x00100011,0x00100011,
-0x00130014,0x00120010,0x000f0011,0x00100011,0x00110011,0x000f0010,0x0010000e,0x000f000f,
-0x000c000d,0x000c000c,0x000d000c,0x000c0009,0x0008000a,0x00080009,0x000a000a,0x00060009,
-0x00070009,0x00070005,0x00070005,0x00050005,0x00050003,0x00050008,0x00050007,0x00040004,
-0x00040005,0x00050002,0x00030004,0x00040004,0x00030003,0x00030003,0x00020002,0x00000000,
-0xffff0001,0xffff0001,0x00010000,0xfffffffe,0xfffefffd,0x0000fffe,0xffffffff,0xfffeffff,
-0xfffcfffd,0xfffcfffc,0xfffcfff9,0xfffafffa,0xfff9fffb,0xfff9fff9,0xfff7fff7,0xfff8fff7,
-0xfff6fff6,0xfff7fff5,0xfff3fff6,0xfff1fff3,0xfff0fff2,0xffeffff1,0xfff0ffef,0xffedffed,
-0xffecffeb,0xffeaffee,0xffeaffeb,0xffeaffea,0xffeaffec,0xffe8ffea,0xffe9ffeb,0xffeaffea,
-0xffecffeb,0xffebffea,0xffedffed,0xffeeffeb,0xffedffed,0xffefffed,0xffeeffee,0xffeffff1,
-0xfff0fff4,0xfff2fff1,0xfff2fff1,0xfff2fff1,0xfff3fff2,0xfff4fff2,0xfff2fff2,0xfff4fff3,
-0xfff5fff3,0xfff7fff5,0xfff7fff7,0xfff7fff5,0xfff6fff5,0xfff8fff8,0xfff9fff9,0xfff7fff8,
-0xfff9fff7,0xfffbfff8,0xfffafff7,0xfffbfffd,0xfffbfffe,0xfffcfffa,0xfffbfffc,0xfffefffc,
-0xfffefffe,0xfffefffe,0x0000fffd,0x00010002,0x00040001,0x00030004,0x00050006,0x00060008,
-0x00050006,0x00060006,0x00090009,0x000a000a,0x000d0009,0x0009000b,0x0009000c,0x000b000a,
-0x00090008,0x00080009,0x000a000a,0x000b000c,0x00090008,0x000a000a,0x000b000b,0x000b000b,
-0x000c000d,0x000c000b,0x000d000c,0x000d000c,0x000d000c,0x000e000e,0x000d000e,0x000e000f,
-0x000f0010,0x000e000f,0x000e000e,0x000d000d,0x000f000f,0x000e000e,0x000c000e,0x000f000c,
-0x000c000b,0x000a0009,0x000a000c,0x0009000c,0x000a000b,0x000a0009,0x000b0009,0x00050008,
-0x00060009,0x00060006,0x00020006,0x00020003,0x00020001,0x00010002,0xffff0002,0x00000002,
-0x00000002,0x0001fffe,0xffff0000,0xffffffff,0x00000001,0x00000000,0x00020001,0x00030001,
-0x00030002,0x00070004,0x00080006,0x00060005,0x00080005,0x00070008,0x00060009,0x000a0008,
-0x00070008,0x00060008,0x0009000b,0x00050009,0x00070006,0x00060005,0x00040004,0x00030003,
-0x00000001,0xffff0001,0xffff0001,0xfffdffff,0xfffbfffc,0xfffafffa,0xfff7fff8,0xfff7fff5,
-0xfff3fff5,0xfff1fff2,0xfff0fff1,0xfff0ffef,0xfff0ffed,0xffedffed,0xffedffec,0xffeaffea,
-0xffeaffea,0xffe8ffe8,0xffe9ffe7,0xffe8ffe8,0xffe8ffe6,0xffe8ffe7,0xffe7ffe7,0xffe6ffe5,
-0xffe5ffe7,0xffe6ffe8,0xffe7ffe6,0xffe7ffe7,0xffe8ffe7,0xffe7ffe8,0xffe8ffe6,0xffe7ffe8,
-0xffe8ffe7,0xffe4ffe9,0xffe6ffe6,0xffe6ffe9,0xffe9ffe8,0xffe8ffe8,0xffeaffe7,0xffeaffe7,
-0xffecffe9,0xffebffea,0xffebffeb,0xffefffef,0xfff0ffef,0xfff2ffef,0xfff2ffef,0xfff4fff3,
-0xfff4fff4,0xfff7fff8,0xfff6fff8,0xfff7fff9,0xfff9fff9,0xfff9fff9,0xfffbfffb,0xfffafffb,
-0xfffbfffb,0xfffcfffe,0xfffcfffc,0xfffefffc,0xfffefffb,0xfffefffd,0xfffefffd,0xfffffffe,
-0x0000ffff,0x0000fffe,0x0000ffff,0x00000000,0xfffffffe,0xfffefffe,0x00010000,0x00020003,
-0x00030007,0x00050004,0x00060004,0x00080008,0x00080009,0x000b000a,0x000d000b,0x0010000b,
-0x0011000d,0x0010000f,0x0013000f,0x00150010,0x00120012,0x00130014,0x00160015,0x00170016,
-0x0018001a,0x0019001a,0x001b001c,0x001d001b,0x001d001c,0x001e001c,0x001d001e,0x001c001d,
-0x001c001a,0x001e001c,0x001c001b,0x001b001b,0x0019001b,0x001c001c,0x001b001a,0x00180018,
-0x001b0019,0x001c001b,0x001c0018,0x001c0017,0x0019001a,0x0016001a,0x00150019,0x00150019,
-0x00160018,0x00170017,0x00170017,0x00180017,0x00190018,0x00180016,0x00190014,0x00170014,
-0x00160014,0x00160017,0x00160016,0x00140014,0x00130014,0x00120013,0x00130014,0x00100010,
-0x00100011,0x000e0010,0x000f000f,0x000f000f,0x000d000d,0x000b000b,0x000a000a,0x00090008,
-0x00070008,0x00050005,0x00040005,0x00030003,0x00010004,0x00030003,0xffff0003,0xffff0002,
-0xfffe0000,0xfffd0000,0xfffdfffe,0xfffafffc,0xfffcfffa,0xfff8fffa,0xfff5fff7,0xfff4fff7,
-0xfff2fff4,0xfff0fff2,0xffeeffed,0xffedffed,0xffebffea,0xffeaffea,0xffe8ffe6,0xffe6ffe7,
-0xffe7ffe6,0xffe5ffe7,0xffe3ffe6,0xffe3ffe6,0xffe2ffe6,0xffe4ffe4,0xffe4ffe6,0xffe3ffe4,
-0xffe5ffe4,0xffe7ffe5,0xffe6ffe5,0xffe8ffe6,0xffe7ffe7,0xffe8ffe8,0xffe6ffe8,0xffe8ffea,
-0xffecffeb,0xffecffeb,0xffeaffe9,0xffecffeb,0xffedffeb,0xffecffee,0xffecffec,0xffedffec,
-0xffecffeb,0xffebffeb,0xffeaffec,0xffebffea,0xffe7ffea,0xffeaffea,0xffe9ffea,0xffebffea,
-0xffebffea,0xffebffea,0xffe9ffeb,0xffe9ffe9,0xffe8ffe8,0xffecffe8,0xffe9ffe9,0xffeaffe9,
-0xffecffeb,0xffeaffea,0xffebffec,0xffedffed,0xffedffed,0xffedffef,0xffefffef,0xfff2fff0,
-0xfff3fff0,0xfff2fff2,0xfff3fff1,0xfff5fff2,0xfff5fff5,0xfff7fff6,0xfffbfff8,0xfffafff8,
-0xfffbfffa,0xfffdfffd,0xffffffff,0x0002ffff,0x00020002,0x00040004,0x00060007,0x00050006,
-0x00080006,0x00090007,0x000a0008,0x00090009,0x000a000b,0x000a000c,0x000c000c,0x000c000e,
-0x000e000c,0x000d000e,0x000c0010,0x0010000d,0x0011000e,0x00100010,0x000f0010,0x00100011,
-0x00100012,0x00110011,0x00150012,0x00140012,0x00130013,0x00140014,0x00140015,0x00140014,
-0x00150013,0x00160012,0x00150015,0x00100014,0x00120015,0x00120013,0x00120014,0x00120014,
-0x00110014,0x00100011,0x000e0011,0x000f0011,0x00110011,0x000f0010,0x000f0011,0x000d000f,
-0x000d000c,0x000a000e,0x000b000c,0x000d000d,0x000d000c,0x000a0009,0x000b0009,0x0009000a,
-0x00090008,0x000a0009,0x00090008,0x00060007,0x00060008,0x00040005,0x00080008,0x00080008,
-0x00060006,0x00040005,0x00040006,0x00040003,0x00040003,0x00020003,0x00050004,0x00020003,
-0x00010002,0xfffeffff,0xfffe0000,0xfffefffd,0xfffdffff,0xfffdfffd,0xfffdfffc,0xfffcfffd,
-0xfffafffa,0xfffafff9,0xfffbfff8,0xfff8fff6,0xfff8fff7,0xfff7fff5,0xfff7fff7,0xfff5fff4,
-0xfff4fff4,0xfff4fff4,0xfff6fff7,0xfff3fff5,0xfff3fff5,0xfff4fff3,0xfff6fff4,0xfff4fff3,
-0xfff5fff3,0xfff4fff6,0xfff4fff4,0xfff4fff4,0xfff4fff4,0xfff2fff6,0xfff7fff5,0xfff6fff6,
-0xfff7fff5,0xfff8fff5,0xfff7fff7,0xfff8fff7,0xfff8fff6,0xfffafff9,0xfff9fff7,0xfffafff9,
-0xfffbfffa,0xfffbfffb,0xfffbfffc,0xfffcfffe,0xfffdfffd,0xfffcfffc,0xfffdfffb,0xfffcfffc,
-0xfffcfffc,0xfffdfffd,0xfffffffd,0xfffe0000,0xfffffffe,0xfffdffff,0xfffefffd,0xfffcfffd,
-0xfffcfffa,0xfffefffc,0xfffcfffa,0xfffcfffb,0xfffbfffc,0xfffdfffd,0xfffefffc,0xfffcfffb,
-0xfffbfffc,0xfffcfffd,0xfffdfffb,0xfffdfffc,0xfffcfffc,0x00000000,0x00010001,0x00030004,
-0x00040005,0x00060004,0x00070004,0x00080007,0x00070007,0x00090009,0x0009000a,0x000b000a,
-0x0008000b,0x000b000a,0x000c000a,0x000c000c,0x000a000b,0x0009000a,0x0009000c,0x000b000c,
-0x000c000c,0x000b000a,0x000e000b,0x000e000a,0x000c000b,0x0009000b,0x000a000b,0x0008000b,
-0x000a000a,0x000c000c,0x000a000c,0x0009000c,0x0009000a,0x000b000b,0x000a000a,0x000a000a,
-0x000a000c,0x00090007,0x00090009,0x00080007,0x00060006,0x00040004,0x00040005,0x00010004,
-0x00010002,0xfffeffff,0xffff0000,0xfffeffff,0xfffefffe,0xfffcfffe,0xfffbfffc,0xfffbfffb,
-0xfffbfffc,0xfffbfffa,0xfffbfffa,0xfffcfffb,0xfffafff9,0xfffdfffa,0xfffbfffc,0xfffafffb,
-0xfffbfffd,0xfffafffd,0xfffcfffc,0xfffdfffd,0xfffdfffe,0xfffffffe,0x0000fffd,0xfffefffd,
-0xfffdfffb,0xfffcfffb,0xfffefffc,0xfffcfffc,0xfffafffc,0xfffafffc,0xfff9fffc,0xfff7fffb,
-0xfff7fffb,0xfff6fff9,0xfff5fff7,0xfff5fff7,0xfff5fff5,0xfff5fff5,0xfff7fff5,0xfff4fff6,
-0xfff6fff5,0xfff3fff3,0xffeffff3,0xffeffff0,0xffedffef,0xffeeffec,0xffefffed,0xffecffeb,
-0xffecffeb,0xffeaffeb,0xffebffea,0xffe9ffea,0xffecffec,0xffecffec,0xffedffed,0xffeeffed,
-0xffeeffeb,0xfff0ffef,0xfff2fff3,0xfff2fff0,0xfff3fff3,0xfff3fff5,0xfff7fff5,0xfff7fff6,
-0xfff9fff6,0xfff9fffa,0xfff9fffb,0xfffbfffa,0xfffdfffc,0xfffbfffb,0xfffbfff9,0xfffbfff8,
-0xfffafff8,0xfff8fff9,0xfff7fffb,0xfff8fff9,0xfff8fff9,0xfff7fff8,0xfff9fff5,0xfff9fff8,
-0xfff5fff7,0xfff7fff5,0xfff6fff5,0xfff6fff6,0xfff6fff7,0xfffafff9,0xfffbfff9,0xfffafffb,
-0xfffcfffc,0xfffffffd,0xfffefffd,0x00010001,0x00010003,0x00030002,0x00040004,0x00050008,
-0x00050005,0x00050006,0x00080008,0x00090009,0x00090008,0x0009000a,0x000a000b,0x000c000b,
-0x000d000b,0x000e000d,0x000c000c,0x000c000d,0x000c000e,0x000d000e,0x000c000e,0x000f000d,
-0x0010000d,0x0010000f,0x00100010,0x0012000f,0x0010000f,0x000f0011,0x00110010,0x00120013,
-0x00120013,0x00140012,0x00120013,0x00150013,0x00160015,0x00170015,0x00190016,0x00170015,
-0x00180016,0x00160017,0x00150016,0x00150016,0x00150017,0x00150018,0x00150015,0x00150015,
-0x00140016,0x00130016,0x00120015,0x00140014,0x00130013,0x00140014,0x00130012,0x00110014,
-0x00120012,0x00130012,0x00120012,0x00110010,0x00100010,0x0010000f,0x00110012,0x00100010,
-0x00120010,0x000f0010,0x000f0010,0x000f000f,0x000e000f,0x000b000e,0x000a000b,0x000a000b,
-0x00070009,0x00060008,0x00050007,0x00040006,0x00040004,0x00030002,0xffffffff,0xfffdffff,
-0xfffdfffe,0xfff9fffc,0xfffbfffa,0xfff9fff9,0xfff7fff8,0xfff6fff6,0xfff4fff4,0xfff3fff5,
-0xfff4fff4,0xfff4fff2,0xfff0fff2,0xfff1fff2,0xfff1fff1,0xfff0ffef,0xffefffef,0xffecffef,
-0xffecffed,0xffebffee,0xffebffeb,0xffebffeb,0xffebffe9,0xffecffea,0xffecffeb,0xffebffeb,
-0xffecffe9,0xffe9ffec,0xffe9ffeb,0xffeaffe9,0xffe9ffeb,0xffeaffe9,0xffe8ffe9,0xffe9ffeb,
-0xffe9ffe9,0xffe9ffe7,0xffe7ffe7,0xffe8ffea,0xffe6ffe9,0xffe8ffe8,0xffecffe8,0xffeaffe9,
-0xffeaffe9,0xffebffe9,0xffeeffed,0xffecffec,0xffedffec,0xffefffec,0xffefffed,0xffedffef,
-0xfff0ffef,0xfff0ffef,0xfff2fff2,0xfff1fff2,0xfff1fff0,0xfff2fff2,0xfff1fff3,0xfff4fff4,
-0xfff4fff4,0xfff3fff4,0xfff4fff6,0xfff7fff5,0xfff8fff5,0xfff7fff5,0xfff7fff4,0xfff6fff8,
-0xfff6fff6,0xfff7fff7,0xfff6fff5,0xfff7fff8,0xfff6fff6,0xfff6fff7,0xfff7fff7,0xfff8fff8,
-0xfff7fff7,0xfff7fffa,0xfffcfffb,0xfffffff9,0xfffefffd,0xffffffff,0xfffffffe,0x00010000,
-0x0004ffff,0x00040003,0x00050003,0x00080004,0x00070005,0x00070006,0x00090006,0x00090008,
-0x000a0008,0x000b000a,0x000b000b,0x000c000c,0x000c000c,0x000d000e,0x000c0010,0x000c000d,
-0x000e000e,0x000d000d,0x000e000c,0x000f000f,0x0011000f,0x0010000d,0x000e000e,0x0010000e,
-0x0011000e,0x000f000e,0x000e000c,0x000d000a,0x000e000c,0x000c000e,0x0010000f,0x000d0010,
-0x000e000e,0x000f000d,0x000e000d,0x000e000e,0x000a000d,0x000c000d,0x000c000e,0x000d000c,
-0x000c000d,0x000e000c,0x000d000b,0x000e000c,0x000d000d,0x000d000d,0x000b000d,0x000e000b,
-0x000b000c,0x000d000b,0x000d000d,0x000f000d,0x000e000c,0x000c000c,0x000d000c,0x000b000d,
-0x000d000c,0x000b000f,0x000c000e,0x000d000e,0x000f000d,0x000e000e,0x000c000c,0x000c000d,
-0x000c000b,0x000d000a,0x000a000b,0x00080009,0x0008000b,0x00090008,0x00060006,0x00030006,
-0x00020004,0x00040002,0x00030003,0x00000001,0xfffffffe,0xfffcfffd,0xfffbfffb,0xfff8fffa,
-0xfff8fff9,0xfff4fff7,0xfff6fff6,0xfff5fff5,0xfff3fff2,0xfff0fff2,0xffeffff1,0xffeffff0,
-0xffefffee,0xffedfff0,0xffecffee,0xffefffee,0xffeeffed,0xffecffed,0xffecffeb,0xffedffeb,
-0xffecffeb,0xffeeffed,0xffeeffee,0xffedffed,0xffeffff1,0xffedffef,0xffefffef,0xfff2fff0,
-0xfff2fff2,0xfff0fff2,0xfff3fff0,0xfff3fff3,0xfff1fff3,0xfff4fff4,0xfff5fff4,0xfff4fff4,
-0xfff5fff8,0xfff4fff7,0xfff7fff8,0xfff8fff8,0xfff8fff8,0xfffafffb,0xfff8fff9,0xfffcfffa,
-0xfffafffa,0xfffbfffb,0xfffafffa,0xfffafff8,0xfffafff9,0xfffbfff8,0xfffafffb,0xfff9fffa,
-0xfff9fffb,0xfff8fff9,0xfff8fffa,0xfff9fff9,0xfff8fff8,0xfff7fff8,0xfffafff7,0xfffbfff9,
-0xfffbfffb,0xfffcfffc,0xfffdfffc,0xfffffffe,0xfffffffe,0xffffffff,0x00020000,0x00010002,
-0x00010003,0x00050005,0x00070008,0x00090008,0x00090008,0x000a0009,0x000b0007,0x00090007,
-0x000b000b,0x000d0009,0x000e000c,0x000d000c,0x000c000c,0x000c000e,0x000c000e,0x000c000c,
-0x000d000e,0x000f000d,0x000d000e,0x000d000c,0x000e000c,0x000d000d,0x000e000e,0x000c000f,
-0x000c000c,0x000d000d,0x000b000b,0x000c000c,0x000b000c,0x000b000b,0x000b000a,0x000d000c,
-0x000b0009,0x000b000c,0x000b000b,0x000c000d,0x000c000d,0x000d000f,0x000d000f,0x000f000f,
-0x00110010,0x0011000f,0x00120010,0x000f0010,0x00100011,0x00100011,0x00100011,0x00100011,
-0x0010000e,0x000e000d,0x000d000d,0x000b000c,0x000c000a,0x000a000b,0x000a0008,0x00080007,
-0x00060006,0x00030003,0x00020002,0x0000ffff,0xfffdfffe,0xfffdffff,0xfffdfffd,0xfffffffd,
-0xfffcfffe,0xfffbfffb,0xfff9fffb,0xfffbfffc,0xfffafffa,0xfff9fff9,0xfff9fffb,0xfff9fff9,
-0xfff9fff7,0xfff8fff7,0xfff8fff6,0xfff8fff6,0xfff6fff7,0xfff6fff7,0xfff4fff6,0xfff3fff5,
-0xfff3fff4,0xfff2fff2,0xfff0fff3,0xfff2fff1,0xfff2fff1,0xfff0fff0,0xffeeffee,0xffefffee,
-0xffeeffef,0xffeffff0,0xfff0fff1,0xffefffef,0xfff0fff1,0xfff2fff0,0xfff3fff1,0xfff3fff2,
-0xfff3fff2,0xfff3fff2,0xfff3fff2,0xfff2fff3,0xfff2fff2,0xfff2ffef,0xfff0fff0,0xfff0fff1,
-0xfff2fff0,0xfff0fff2,0xfff0fff0,0xffefffef,0xffecffed,0xffecffec,0xffeaffeb,0xffebffec,
-0xffe9ffec,0xffebffe9,0xffe9ffea,0xffeaffea,0xffedffea,0xffecffeb,0xffecffeb,0xffe9ffe9,
-0xffeaffea,0xffe9ffec,0xffebffec,0xffebffed,0xffecffee,0xffedffef,0xfff0ffed,0xffefffed,
-0xfff0fff0,0xfff1fff0,0xfff2fff1,0xfff2fff2,0xfff3fff3,0xfff5fff4,0xfff4fff3,0xfff9fff6,
-0xfffafff9,0xfffbfffa,0xfffefffb,0xfffdfffd,0xfffcfffc,0x00000000,0x00010003,0x00000002,
-0x0002ffff,0x00010002,0x00020002,0x00050006,0x00070008,0x0006000a,0x00090008,0x00080007,
-0x00090008,0x00090008,0x000a0009,0x00090008,0x00090009,0x0009000a,0x000b000b,0x000c000a,
-0x000e0009,0x000f000c,0x000b000a,0x000b000c,0x000d000e,0x000d000b,0x000e000b,0x000c000c,
-0x000d000d,0x000f000f,0x000f0010,0x000d000e,0x000e0011,0x000f000f,0x00100011,0x00110012,
-0x00140010,0x00120012,0x00130010,0x00140010,0x00140014,0x00110012,0x00130013,0x00140016,
-0x00130015,0x00140015,0x00140015,0x00140015,0x00110013,0x00130015,0x00140014,0x00130013,
-0x00150016,0x00120013,0x00140016,0x00130015,0x00130015,0x00130012,0x00140012,0x00120011,
-0x00130011,0x00130010,0x00120010,0x00110011,0x000f0011,0x000f000e,0x000e000d,0x000e000c,
-0x000e000b,0x000a000a,0x00090008,0x000a0008,0x00090009,0x00080007,0x00070008,0x00060005,
-0x00050005,0x00050005,0x00040005,0x00060006,0x00040006,0x00040003,0x00040005,0x00010003,
-0x00020004,0x00000001,0xffff0000,0xffff0000,0xfffefffe,0xfffe0001,0xfffc0000,0xfffdfffe,
-0xfffdfffc,0xfffcfffb,0xfffcfffc,0xfffafffc,0xfff9fff9,0xfff8fffc,0xfff8fff9,0xfffafff8,
-0xfffbfff7,0xfffafff7,0xfff8fff9,0xfff9fff8,0xfff8fffa,0xfff9fffa,0xfff9fffb,0xfffafff9,
-0xfff8fff9,0xfff6fff8,0xfff4fff5,0xfff3fff6,0xfff4fff6,0xfff2fff5,0xfff1fff4,0xfff1fff2,
-0xffedfff1,0xfff1fff0,0xffeeffef,0xffeeffed,0xffeeffee,0xffebffed,0xffeaffeb,0xffeaffec,
-0xffe8ffe9,0xffebffea,0xffeaffea,0xffe9ffe8,0xffe9ffe7,0xffe9ffe6,0xffebffe7,0xffebffea,
-0xffe9ffea,0xffeaffea,0xffedffeb,0xffecffec,0xffecffec,0xffeeffef,0xfff0fff0,0xfff1fff2,
-0xfff0fff2,0xfff2fff2,0xfff5fff5,0xfff5fff4,0xfff6fff6,0xfff7fff6,0xfff8fff7,0xfff9fff7,
-0xfff9fff9,0xfffdfff9,0xfffcfffc,0xfffdfffd,0xfffcfffb,0xfffdfffb,0xfffffffc,0xfffffffe,
-0xfffffffc,0xfffffffd,0xfffcfffd,0xfffefffb,0xfffdfffd,0xfffdfffc,0xfffefffd,0xfffdfffc,
-0xfffcfffd,0xfffdfffc,0xfffcfffd,0xfffdfffb,0xfffdffff,0xfffcfffd,0xfffdfffe,0xffffffff,
-0xffff0000,0x0001ffff,0x00020000,0x00040002,0x00030004,0x00050005,0x00090009,0x00090009,
-0x000a000a,0x000c000d,0x000f0010,0x000f0011,0x00120012,0x00140013,0x00160014,0x00160014,
-0x00170015,0x00160017,0x00160016,0x00160017,0x00140016,0x00160015,0x00160014,0x00150014,
-0x00120013,0x00140013,0x00110011,0x0011000f,0x000f0012,0x000f000e,0x000e000e,0x000a000d,
-0x000b000d,0x0009000b,0x000a0009,0x00080009,0x000a0009,0x00090009,0x00070005,0x00060005,
-0x00060006,0x00080007,0x00060009,0x00060007,0x00080008,0x00090008,0x000b0008,0x000b0009,
-0x000b0008,0x000a0008,0x000b0007,0x000b000a,0x000b000a,0x0008000a,0x00090009,0x00080008,
-0x00050007,0x00040006,0x00050006,0x00030006,0x00020004,0x00030001,0x00020001,0x00000000,
-0xfffe0000,0x0000fffd,0xfffdfffe,0xfffcfffc,0xfff8fff9,0xfff6fff7,0xfff7fff5,0xfff4fff6,
-0xfff5fff3,0xfff3fff1,0xffeffff1,0xffedffef,0xffebffed,0xffe9ffec,0xffe7ffeb,0xffe6ffe7,
-0xffe6ffe5,0xffe4ffe3,0xffe3ffe3,0xffe1ffe1,0xffdfffe1,0xffe0ffe0,0xffdfffe0,0xffdfffdd,
-0xffdfffde,0xffdeffde,0xffe1ffdf,0xffe0ffdf,0xffe2ffdf,0xffe3ffe1,0xffe3ffe3,0xffe1ffe5,
-0xffe6ffe7,0xffe6ffe8,0xffebffe8,0xffedffec,0xfff0fff0,0xffeeffef,0xfff0ffef,0xfff5fff2,
-0xfff6fff5,0xfff9fff7,0xfff7fff7,0xfff7fff8,0xfff9fff9,0xfffafffa,0xfffbfffa,0xfffcfffc,
-0xfffbfffc,0xfffbfffb,0xfffdfffd,0x0001fffe,0xfffcfffc,0xfffbfffc,0xfffdfffe,0xfffefffe,
-0xfffefffe,0xfffdfffb,0xfffdfffe,0xfffcfffc,0xfffbfffc,0xfffafffd,0xfff9fffc,0xfffbfffd,
-0xfffcfffb,0xfffdfffb,0xfffcfff9,0xfffdfff8,0xfffffffe,0x00020000,0x00030001,0x00010001,
-0x00050002,0x00080005,0x00080006,0x000a000a,0x000c000c,0x000e000d,0x00110010,0x00130011,
-0x00160013,0x00170015,0x00180018,0x00190018,0x001b0019,0x001a001b,0x001a001b,0x001b001a,
-0x001a001b,0x001b001d,0x001b001a,0x00190019,0x00190018,0x00190018,0x00190019,0x00190016,
-0x00160016,0x00160017,0x00180018,0x001b0018,0x00180016,0x00180016,0x00160017,0x00160017,
-0x00170018,0x00170017,0x00170017,0x00170017,0x00170018,0x00150018,0x00140016,0x00150016,
-0x00150016,0x00160013,0x00150015,0x00150014,0x00130012,0x00140010,0x00120011,0x00150011,
-0x00110010,0x00100010,0x00100012,0x000e0010,0x000d000d,0x000d000d,0x000d000b,0x000b000b,
-0x000b000b,0x0009000b,0x00070008,0x00080008,0x00080007,0x0008000a,0x00040007,0x00050006,
-0x00040007,0x00030004,0x00020004,0x00020003,0x00010002,0x00000004,0x00010002,0x00010002,
-0xfffffffd,0xfffdfffc,0xfffafffd,0xfff9fffd,0xfff9fffa,0xfff6fff9,0xfff7fff6,0xfff6fff4,
-0xfff4fff4,0xfff0fff1,0xffefffee,0xffecffec,0xffeaffeb,0xffeaffe9,0xffe9ffe9,0xffe7ffe8,
-0xffe8ffe9,0xffe8ffe7,0xffe7ffe6,0xffe5ffe6,0xffe4ffe6,0xffe3ffe4,0xffe2ffe2,0xffe4ffe3,
-0xffe4ffe4,0xffe5ffe6,0xffe7ffe6,0xffe7ffe6,0xffe8ffe7,0xffe7ffe6,0xffe6ffe6,0xffe5ffe7,
-0xffe6ffe5,0xffe5ffe6,0xffe6ffe7,0xffe4ffe7,0xffe3ffe5,0xffe4ffe5,0xffe6ffe5,0xffe5ffe5,
-0xffe5ffe5,0xffe5ffe5,0xffe7ffe7,0xffe6ffe5,0xffe6ffe4,0xffe8ffe8,0xffe9ffe9,0xffeaffe9,
-0xffe9ffea,0xffecffeb,0xffedffec,0xffeeffef,0xfff0ffef,0xfff0ffef,0xfff1ffef,0xfff2fff1,
-0xfff4fff4,0xfff5fff4,0xfff8fff6,0xfff8fff7,0xfff7fff6,0xfff8fff7,0xfffafff9,0xfff7fffb,
-0xfffafffc,0xfffafffc,0xfffcfffa,0xfffefffa,0xfffdfffd,0xfffdfffe,0xfffffffe,0xfffefffd,
-0x0000fffe,0x00000000,0x00010002,0x00010001,0xffff0001,0x00000002,0x00000000,0x00000002,
-0x00030004,0x00040003,0x00050005,0x00040002,0x00060006,0x00070006,0x00090007,0x00070008,
-0x00080007,0x00080007,0x00080007,0x000a0009,0x000a0009,0x000b000a,0x000a000b,0x000b000b,
-0x000b000d,0x000b000c,0x000d000f,0x000e000d,0x000e000c,0x000f000e,0x000f000d,0x000d000d,
-0x000d000d,0x000e000d,0x000d000f,0x000e000e,0x000f000f,0x000e0010,0x000d000d,0x000b000c,
-0x000c000c,0x000d000c,0x000d000e,0x000e000d,0x000d000a,0x000d000c,0x000e000d,0x000b000e,
-0x000e000e,0x0010000f,0x000e0010,0x0010000f,0x00100010,0x00100011,0x000f0011,0x00110010,
-0x00120010,0x00140012,0x00120011,0x00110011,0x00110012,0x00140013,0x00100012,0x000f0011,
-0x00110012,0x00120013,0x00120012,0x00120011,0x0011000f,0x0012000f,0x000f0010,0x000d000e,
-0x000e000d,0x000b000c,0x000b000e,0x000b000d,0x0008000a,0x00080008,0x00090009,0x00060007,
-0x00040007,0x00030003,0x00020001,0xffff0000,0xffff0000,0xffffffff,0xfffcfffd,0xfffdfffa,
-0xfffcfffb,0xfffbfffb,0xfffafffb,0xfff8fff9,0xfff8fff9,0xfff9fffa,0xfff9fffa,0xfffafffc,
-0xfffefffc,0xfffcfffc,0xfffdfffd,0xfffffffe,0xfffdfffe,0x0002ffff,0x00000001,0xfffffffe,
-0xffff0000,0xfffe0000,0xffffffff,0xfffefffd,0xfffdfffd,0xfffafffb,0xfffafffa,0xfffbfffa,
-0xfff9fffb,0xfff7fffa,0xfff7fff8,0xfff5fff5,0xfff6fff6,0xfff4fff4,0xfff3fff5,0xfff2fff4,
-0xfff1fff0,0xfff2ffef,0xfff1ffef,0xfff0fff2,0xffeffff2,0xfff0fff0,0xfff0fff0,0xfff1ffef,
-0xfff0ffee,0xffefffef,0xffefffef,0xffeeffef,0xffeeffee,0xffedffef,0xffecffee,0xffebffed,
-0xffebffeb,0xffebffeb,0xffe9ffe8,0xffe9ffea,0xffe9ffe7,0xffe9ffe8,0xffebffe8,0xffe8ffe7,
-0xffe9ffe6,0xffe8ffe9,0xffe9ffea,0xffedffea,0xfff1ffeb,0xffefffee,0xfff2fff0,0xfff3fff3,
-0xfff5fff4,0xfff9fff8,0xfffafffb,0xfffdfffc,0xffff0000,0x00010002,0x00040003,0x00090005,
-0x00090006,0x00080007,0x000a0009,0x000a000a,0x0009000b,0x000a000b,0x000c000a,0x000a000a,
-0x000a000a,0x0009000a,0x0009000a,0x00090009,0x0008000a,0x000a0009,0x00090007,0x00080006,
-0x00070007,0x00070008,0x00050007,0x00080007,0x00070009,0x00070008,0x00060007,0x00050008,
-0x00070007,0x00070006,0x00080009,0x0006000a,0x00060009,0x0007000b,0x00070008,0x00090007,
-0x000b000a,0x000c000a,0x000c000b,0x000e000d,0x000f0010,0x000f000d,0x000f0010,0x000f000f,
-0x00120010,0x00130012,0x00110013,0x00120012,0x00130013,0x00120011,0x00120013,0x00120010,
-0x00110011,0x00130010,0x00110013,0x000f0010,0x000f000d,0x000d000f,0x000c000d,0x000b000c,
-0x000a000a,0x000a0009,0x00080007,0x00040005,0x00030006,0x00020004,0x00000002,0xffff0000,
-0xfffcfffd,0xfffdfffd,0xfffbfffb,0xfff9fffa,0xfff9fff7,0xfff8fff6,0xfff6fff4,0xfff5fff2,
-0xfff2fff0,0xfff2fff0,0xfff2fff0,0xfff1fff0,0xfff1fff1,0xfff1fff3,0xfff3fff4,0xfff1fff2,
-0xfff2fff3,0xfff2fff1,0xfff3fff4,0xfff3fff3,0xfff3fff4,0xfff6fff5,0xfff5fff4,0xfff5fff4,
-0xfff4fff4,0xfff6fff6,0xfff7fff7,0xfff7fff8,0xfff5fff8,0xfff6fff6,0xfff7fff7,0xfff6fff8,
-0xfff4fff7,0xfff4fff5,0xfff6fff4,0xfff5fff6,0xfff5fff3,0xfff3fff1,0xfff2fff2,0xffeefff1,
-0xffeefff0,0xffefffee,0xffefffee,0xffeeffee,0xffeaffec,0xffe9ffeb,0xffe9ffea,0xffe9ffe9,
-0xffeaffe8,0xffeaffe9,0xffeaffe9,0xffe8ffea,0xffe8ffeb,0xffe8ffea,0xffebffed,0xffebffeb,
-0xffebffed,0xffedffec,0xffeeffeb,0xffefffec,0xfff1fff0,0xfff3fff1,0xfff5fff3,0xfff5fff4,
-0xfff6fff6,0xfff7fff7,0xfff9fff9,0xfffafffb,0xfffafffc,0xfffdffff,0xfffffffe,0x00000000,
-0x00030000,0x00040002,0x00060006,0x00080007,0x00080009,0x0009000a,0x000c000b,0x000a000b,
-0x000c000d,0x000c000c,0x0010000e,0x0010000c,0x000e000f,0x000f0010,0x0010000f,0x000f000e,
-0x0010000e,0x0010000e,0x000f000e,0x0010000e,0x00110010,0x000f0010,0x00100011,0x00130010,
-0x00120012,0x00120011,0x00120012,0x00140012,0x00140014,0x00120015,0x00160017,0x00160017,
-0x00170015,0x00190018,0x00190017,0x00190018,0x001b001a,0x0018001c,0x001c001a,0x001d0019,
-0x001b0019,0x0019001a,0x0019001b,0x0018001d,0x0019001a,0x00180019,0x00180017,0x00180018,
-0x00170017,0x00170017,0x00170018,0x00160016,0x00150017,0x00160016,0x00160014,0x00150016,
-0x00130014,0x00140013,0x00130012,0x00120011,0x000f0010,0x000f000f,0x000c000e,0x000a000d,
-0x0009000b,0x00060007,0x00030005,0x00020004,0x00000001,0xfffefffd,0xfffdfffe,0xfffcfffd,
-0xfff8fffc,0xfff7fff8,0xfff8fff8,0xfff8fff7,0xfff8fff8,0xfff9fff8,0xfff7fff8,0xfff9fff7,
-0xfff9fff7,0xfffafff9,0xfff8fff9,0xfff8fff9,0xfff9fff8,0xfff9fffb,0xfff9fffc,0xfffbfffc,
-0xfffafffc,0xfff9fffc,0xfff9fffa,0xfff7fff8,0xfff9fff8,0xfff6fff7,0xfff6fff5,0xfff4fff4,
-0xfff2fff5,0xfff2fff2,0xfff0fff2,0xfff1ffef,0xfff3ffee,0xfff0fff0,0xfff0fff1,0xffeefff1,
-0xffedfff0,0xffedfff0,0xffedffee,0xffeeffed,0xffedffed,0xffebffed,0xffeaffeb,0xffe8ffec,
-0xffe7ffec,0xffe8ffeb,0xffe8ffeb,0xffe7ffe8,0xffe5ffe4,0xffe6ffe4,0xffe6ffe5,0xffe4ffe2,
-0xffe3ffe3,0xffe4ffe3,0xffe2ffe4,0xffe1ffe2,0xffe1ffe1,0xffe1ffe1,0xffdfffe1,0xffe1ffe0,
-0xffe2ffe1,0xffe1ffe3,0xffe3ffe2,0xffe6ffe4,0xffe8ffe6,0xffe8ffe6,0xffe9ffe6,0xffe9ffe8,
-0xffedffea,0xffecffee,0xffeeffef,0xffefffee,0xffeefff0,0xfff0fff0,0xfff1fff1,0xfff3fff4,
-0xfff4fff4,0xfff5fff4,0xfff6fff4,0xfff7fff5,0xfff8fff7,0xfff8fff7,0xfff9fff7,0xfffbfff9,
-0xfffbfffb,0xfffefffa,0xfffefffc,0xfffdfffe,0x0000fffe,0x00020000,0x00020002,0x00050003,
-0x00040005,0x00050006,0x00060007,0x00080009,0x00080009,0x000a0008,0x000a0009,0x000b000a,
-0x000b000b,0x000d000d,0x000e000c,0x0010000c,0x0011000f,0x0010000f,0x00120010,0x00100011,
-0x00140012,0x00140015,0x00150015,0x00130014,0x00160015,0x00150018,0x00140016,0x00160015,
-0x00160015,0x00170016,0x00140014,0x00140014,0x00120012,0x00100011,0x00100010,0x000f0010,
-0x000e000e,0x000f000e,0x000d000d,0x000b000b,0x0009000b,0x0009000a,0x000a000a,0x0009000a,
-0x000a000a,0x000a000b,0x000b000b,0x000c000a,0x000e000c,0x000e000d,0x000e0010,0x000d000e,
-0x000d000e,0x000d000e,0x000d000d,0x000d000d,0x000d000c,0x000d000e,0x000e000e,0x000b000a,
-0x000e000a,0x00090009,0x000a000a,0x00070009,0x00090007,0x00080009,0x00060009,0x00090006,
-0x00090008,0x00080008,0x00060007,0x00070008,0x00060006,0x00070007,0x00060007,0x00080007,
-0x000a0009,0x00090008,0x00080008,0x00050005,0x00060006,0x00050005,0x00060005,0x00040006,
-0x00060005,0x00030004,0x00060004,0x00050005,0x00050003,0x00040002,0x00020002,0x00000001,
-0xffff0000,0xffff0001,0xffff0000,0xfffefffe,0xffff0000,0xfffefffe,0xfffefffd,0xfffafffb,
-0xfff8fffb,0xfff9fff9,0xfff9fff9,0xfff9fff9,0xfff9fff6,0xfff6fff6,0xfff6fff3,0xfff4fff5,
-0xfff2fff3,0xfff0fff1,0xfff0fff1,0xfff2fff0,0xfff0ffee,0xfff0fff1,0xfff0fff0,0xffefffef,
-0xfff0fff0,0xfff0ffee,0xfff0ffee,0xffeffff0,0xfff1fff2,0xffeffff1,0xfff1fff2,0xfff4fff3,
-0xfff5fff4,0xfff6fff7,0xfff7fff5,0xfff7fff6,0xfff7fff5,0xfff8fff6,0xfff8fff8,0xfff7fff8,
-0xfff5fff6,0xfff5fff7,0xfff6fff5,0xfff5fff6,0xfff3fff4,0xfff4fff5,0xfff7fff4,0xfff6fff4,
-0xfff6fff5,0xfff4fff2,0xfff2fff4,0xfff2fff2,0xfff1fff3,0xfff3fff3,0xfff3fff4,0xfff2fff6,
-0xfff4fff8,0xfff2fff7,0xfff6fff6,0xfff7fffa,0xfff9fff9,0xfffdfff9,0xfffdfffc,0xfffefffb,
-0xfffefffe,0xfffffffe,0xfffeffff,0x00000002,0x00030001,0x00040002,0x00050005,0x00070004,
-0x00050007,0x00060006,0x00060007,0x00060006,0x00070006,0x00080006,0x00060007,0x00080008,
-0x0007000a,0x00070008,0x00070007,0x00070007,0x00090007,0x00080008,0x00090009,0x00090008,
-0x000a0009,0x000a000a,0x0007000a,0x00090009,0x000b000a,0x000b000a,0x000a0009,0x0008000a,
-0x0008000a,0x00090009,0x00090009,0x00070008,0x00070006,0x00060007,0x00050006,0x00060003,
-0x00030003,0x00010002,0x0001ffff,0x00030001,0x00010002,0x00000001,0x00000001,0xfffe0001,
-0xfffffffe,0xfffffffe,0x0001ffff,0xfffeffff,0x0000ffff,0xffff0003,0x00000001,0x00010001,
-0x00030003,0x00040005,0x00060006,0x00070006,0x00080007,0x00090009,0x000b0009,0x0009000b,
-0x000a000b,0x000b000c,0x000b000b,0x000e000c,0x000c000d,0x000b000c,0x000b000b,0x000b000b,
-0x0009000a,0x00080008,0x00050004,0x00040005,0x00020003,0x00010000,0xfffdffff,0xfffefffb,
-0xfff9fffd,0xfff9fff8,0xfff7fff6,0xfff4fff5,0xfff3fff4,0xfff2fff3,0xfff3fff2,0xfff0fff1,
-0xffeffff1,0xffeffff0,0xffeeffee,0xffeefff0,0xffeefff0,0xffefffed,0xfff0ffef,0xffefffee,
-0xffeeffed,0xffedffed,0xffeeffed,0xffefffee,0xffefffef,0xffeeffee,0xffefffef,0xfff0fff0,
-0xfff1fff0,0xffeefff1,0xffeffff2,0xfff1fff3,0xfff1fff2,0xfff1fff1,0xfff0fff1,0xfff1fff1,
-0xfff3fff2,0xfff4fff2,0xfff5fff3,0xfff5fff4,0xfff5fff5,0xfff4fff4,0xfff5fff6,0xfff6fff5,
-0xfff6fff5,0xfff8fff5,0xfff8fff7,0xfff7fff9,0xfff6fff9,0xfffafffa,0xfff8fffa,0xfff9fffc,
-0xfff8fffb,0xfff9fffa,0xfff9fffa,0xfffbfff8,0xfffafff8,0xfffafff8,0xfffafff9,0xfff8fff9,
-0xfff8fff7,0xfff7fff7,0xfff9fff9,0xfff8fffb,0xfffcfffb,0xfffbfffc,0xfffcfffa,0xfffcfffc,
-0xfffdfffe,0xfffeffff,0x0000ffff,0x00030001,0x00050002,0x00040003,0x00070006,0x00080007,
-0x000c000a,0x000c000a,0x000c000e,0x000e000e,0x0011000f,0x0012000f,0x00130012,0x00140013,
-0x00150014,0x00170017,0x0018001a,0x00180019,0x001b0019,0x001a001a,0x001b001b,0x001b001c,
-0x001c001d,0x001a001c,0x001d001a,0x001a001b,0x0019001c,0x001a001a,0x001a001b,0x00180018,
-0x00180017,0x00180018,0x00160016,0x00150015,0x00160013,0x00150015,0x00140013,0x00110015,
-0x00110014,0x00110013,0x00130012,0x00110013,0x00110012,0x00110015,0x00120013,0x00110013,
-0x00100013,0x00100013,0x0010000f,0x00100011,0x00110010,0x000f0010,0x000c000f,0x000d000b,
-0x000d000c,0x000d000c,0x0009000b,0x000a0009,0x0009000a,0x00070007,0x00060008,0x00060008,
-0x00050007,0x00050004,0x00050005,0x00040004,0x00030003,0x00020003,0x00020003,0x00020002,
-0x00000001,0x00000000,0xfffdfffe,0xfffcfffd,0xfffdfffb,0xfffbfff9,0xfffafffa,0xfff8fff8,
-0xfff5fff7,0xfff3fff5,0xffeffff2,0xffedffef,0xffedffee,0xffebffef,0xffebffed,0xffeaffeb,
-0xffe7ffeb,0xffe7ffe7,0xffe7ffe7,0xffe6ffe4,0xffe6ffe5,0xffe6ffe5,0xffe6ffe5,0xffe6ffe6,
-0xffe6ffe6,0xffe7ffe7,0xffe9ffe8,0xffeaffe9,0xffecffe9,0xffedffec,0xffecffec,0xffeeffed,
-0xfff1fff1,0xfff0fff1,0xfff0fff0,0xffeffff0,0xfff1fff1,0xfff0fff0,0xffefffed,0xfff2fff0,
-0xfff1fff2,0xffeffff1,0xfff0ffef,0xfff1fff3,0xffeefff0,0xffefffef,0xffefffef,0xffefffee,
-0xffeeffee,0xffecffed,0xffecffec,0xffebffeb,0xffe9ffe9,0xffecffea,0xffeaffe9,0xffe7ffea,
-0xffe9ffea,0xffe8ffea,0xffe9ffe9,0xffe9ffe8,0xffe8ffe8,0xffe9ffea,0xffe9ffeb,0xffeaffeb,
-0xffebffea,0xffeaffe9,0xffebffea,0xffeeffeb,0xffebffed,0xffefffee,0xffedffee,0xfff3fff0,
-0xfff3fff2,0xfff5fff2,0xfff5fff3,0xfff6fff6,0xfff8fff9,0xfffafffb,0xfffbfffd,0xfffdfffc,
-0x0000fffe,0x00010001,0x00020002,0x00040003,0x00050003,0x00060004,0x00060005,0x00080007,
-0x00090007,0x000a0008,0x000b000a,0x000b000b,0x000b000e,0x000d000d,0x000c000d,0x0010000e,
-0x0012000f,0x000f000f,0x00110011,0x00110012,0x00110012,0x00130012,0x00140014,0x00140015,
-0x00160015,0x00150015,0x00140015,0x00150015,0x00170016,0x00160016,0x00160017,0x00160016,
-0x00170018,0x00180018,0x00180018,0x00190018,0x00190016,0x00170017,0x00180019,0x001a0018,
-0x00160017,0x00150016,0x00150017,0x00160016,0x00160017,0x00160017,0x00190016,0x00170014,
-0x00170016,0x00160013,0x00140012,0x00120011,0x00110011,0x00110011,0x000f0010,0x000d000d,
-0x000d000f,0x000d000d,0x000d000f,0x0009000c,0x00090008,0x00050006,0x00030005,0x00040003,
-0x00000001,0x00000001,0x00000000,0xfffcfffe,0xfffcfffe,0xfffcfffb,0xfffbfffa,0xfff8fffa,
-0xfff8fff8,0xfff5fff4,0xfff7fff5,0xfff3fff5,0xfff4fff5,0xfff3fff5,0xfff4fff4,0xfff2fff2,
-0xfff2fff2,0xfff4fff2,0xfff4fff2,0xfff6fff5,0xfff5fff7,0xfff7fff7,0xfff7fff7,0xfff8fff8,
-0xfffafff8,0xfffbfff8,0xfffbfffb,0xfffefffe,0x0001fffe,0x00000001,0x0000ffff,0x0001ffff,
-0x00000000,0x00010000,0x00020000,0x00020001,0x00030004,0x00050005,0x00050005,0x00060007,
-0x00040005,0x00040003,0x00030004,0x00040004,0x00020004,0x00030004,0x00010003,0x00020003,
-0x00000004,0x00010001,0x00010001,0x0000ffff,0xffffffff,0xfffefffc,0xfffbfffb,0xfffafffb,
-0xfffafffd,0xfff9fffb,0xfffafff8,0xfff7fff8,0xfff5fff6,0xfff5fff8,0xfff6fff6,0xfff6fff5,
-0xfff6fff5,0xfff5fff3,0xfff3fff4,0xfff5fff4,0xfff4ffef,0xfff3fff2,0xfff2fff4,0xfff1fff0,
-0xfff1fff1,0xfff0fff1,0xfff1fff1,0xfff0fff0,0xfff1ffee,0xffefffee,0xfff0ffef,0xffeffff0,
-0xfff0fff1,0xfff1fff5,0xfff2fff3,0xfff4fff3,0xfff5fff4,0xfff7fff5,0xfff7fff5,0xfff9fff6,
-0xfff9fff6,0xfff9fff8,0xfffafffa,0xfffbfffb,0xfffcfffd,0xfffcfffc,0xfffefffd,0xfffcfffd,
-0xfffcfffd,0xfffcfffd,0xfffdfffe,0xfffefffd,0xfffefffd,0x0000fffe,0x0000ffff,0x0000ffff,
-0x0000ffff,0x00010001,0x00010000,0x00010002,0x00030002,0x00030004,0x00030003,0x00050006,
-0x00060007,0x00080006,0x00080006,0x000b0009,0x000b000a,0x000c000a,0x000b000c,0x000e000e,
-0x00100010,0x0011000f,0x000f000e,0x0011000f,0x00100010,0x000f000f,0x0010000f,0x000f0010,
-0x000b000f,0x000d000d,0x000d000f,0x000d000c,0x000a000d,0x0009000c,0x0008000b,0x0009000a,
-0x00050009,0x00050008,0x00050006,0x00060006,0x00040005,0x00050006,0x00020005,0x00030003,
-0x00020003,0x00030002,0x00030003,0x00010002,0x00010001,0xfffefffe,0xfffefffd,0xfffcfffc,
-0xfffafffa,0xfffafffb,0xfff7fff9,0xfff7fff9,0xfff7fff8,0xfff7fff7,0xfff7fff8,0xfff5fff5,
-0xfff5fff6,0xfff4fff6,0xfff5fff6,0xfff5fff6,0xfff4fff6,0xfff4fff4,0xfff5fff5,0xfff7fff5,
-0xfffafff7,0xfff9fff8,0xfff8fff7,0xfff9fff7,0xfffbfffb,0xfffbfffa,0xfffcfffb,0xfffefffd,
-0xfffefffe,0xfffe0001,0x00000001,0x00000001,0x00000001,0x00010001,0x00000001,0x00000002,
-0x0000ffff,0x00020001,0x00010003,0xfffe0003,0xffff0000,0xfffeffff,0xfffafffd,0xfffcfffb,
-0xfffafffa,0xfffafff7,0xfff7fff6,0xfff3fff4,0xfff2fff3,0xfff0fff1,0xffefffef,0xffebffee,
-0xffeaffec,0xffebffec,0xffe9ffee,0xffe9ffeb,0xffe9ffec,0xffeaffee,0xffedffee,0xffedffee,
-0xfff0ffee,0xffefffee,0xfff0fff2,0xfff3fff2,0xfff5fff5,0xfff8fff6,0xfff9fff8,0xfffbfff7,
-0xfffcfffa,0xfffdfffc,0xfffcfffd,0xfffefffd,0xfffdfffd,0x00000001,0x00020000,0x00020003,
-0x00010002,0x00010002,0x00010002,0x00020002,0x00010001,0x00020001,0x00020001,0x00020002,
-0x00020000,0x00020002,0x00020003,0x00020003,0x00030003,0x00030002,0x00040003,0x00060006,
-0x00080007,0x00060007,0x00060007,0x00060007,0x00070008,0x00080009,0x00080008,0x00090007,
-0x00090009,0x00090008,0x000a000b,0x000a000a,0x000b000c,0x000d000b,0x000e000b,0x000d000d,
-0x000f000f,0x000f000f,0x00100013,0x00140011,0x00130013,0x00140014,0x00160015,0x00150015,
-0x00160016,0x00170016,0x00170018,0x00190017,0x001a0019,0x00190019,0x001a001a,0x00190017,
-0x001a0018,0x001a0019,0x001a0019,0x001c001a,0x001a0019,0x001b0019,0x001b001c,0x001a001a,
-0x0019001c,0x0018001c,0x00170019,0x00180018,0x00170017,0x00150015,0x00120012,0x00110012,
-0x00100011,0x000b000b,0x000b000c,0x0006000a,0x00050006,0x00030006,0x00030005,0x00000001,
-0x0001fffe,0xfffdfffe,0xfffcfffc,0xfffbfffc,0xfffdfffe,0xfffafffb,0xfffafff9,0xfffafffb,
-0xfffcfffa,0xfffdfffc,0xfffcfffc,0xfffcfffb,0xfffcfffd,0xfffcfffc,0xfffafffd,0xfffafffa,
-0xfff7fffb,0xfff9fffa,0xfff9fff9,0xfff8fff8,0xfff7fff8,0xfff6fff6,0xfff4fff6,0xfff4fff3,
-0xfff2fff2,0xfff1fff2,0xfff1fff2,0xffefffef,0xffeeffef,0xffecffec,0xffecffee,0xffebffec,
-0xffecffec,0xffebffeb,0xffe9ffe9,0xffe8ffe9,0xffecffea,0xffeaffeb,0xffe9ffe9,0xffe8ffeb,
-0xffe9ffe9,0xffe8ffe8,0xffe7ffe9,0xffe4ffe6,0xffe6ffe6,0xffe3ffe4,0xffe2ffe3,0xffe4ffe4,
-0xffe3ffe3,0xffe2ffe2,0xffe4ffe2,0xffe4ffe3,0xffe2ffe2,0xffe5ffe3,0xffe5ffe4,0xffe6ffe8,
-0xffe9ffe7,0xffebffe8,0xffecffe9,0xffeeffeb,0xfff0ffed,0xfff2ffee,0xfff5fff1,0xfff5fff3,
-0xfff6fff4,0xfff8fff6,0xfffafff7,0xfffafffa,0xfff8fff9,0xfff9fff9,0xfffafff8,0xfff8fff9,
-0xfff7fff8,0xfff7fff9,0xfff9fff8,0xfffafffc,0xfffafff9,0xfff6fff8,0xfff6fff7,0xfff6fff8,
-0xfff7fff7,0xfff8fff8,0xfffbfffa,0xfffdfffa,0xfffdfffb,0xfffcfffc,0xfffefffc,0xfffffffe,
-0x0001fffe,0x0001ffff,0x00030001,0x00040003,0x00030005,0x00050005,0x00040005,0x00050005,
-0x00030004,0x00020003,0x00040003,0x00030003,0x00020003,0x00050004,0x00040004,0x00040002,
-0x00020002,0x00030001,0x00040002,0x00040002,0x00050004,0x00060006,0x00050006,0x00060007,
-0x00070008,0x00080007,0x000c0009,0x000e000c,0x000e000e,0x00110010,0x00120012,0x00140015,
-0x00150014,0x00160015,0x00160016,0x00160016,0x00130015,0x00140016,0x00150017,0x00130015,
-0x00130013,0x00120012,0x00100011,0x000f000f,0x000e000e,0x000d000d,0x000c000d,0x000c000b,
-0x000b000b,0x000a000b,0x0009000b,0x000c000b,0x000c000c,0x000e000d,0x000f000f,0x000e000e,
-0x000e000e,0x00100010,0x0010000f,0x0012000f,0x0013000f,0x00130012,0x00130012,0x00140013,
-0x00140013,0x00130013,0x00130012,0x00130014,0x00130014,0x00130012,0x00110013,0x00110010,
-0x000f0010,0x000c000e,0x000b000c,0x000b000b,0x00090009,0x0007000a,0x00050006,0x00060008,
-0x00050006,0x00010004,0x00000003,0x00000002,0xfffd0002,0xfffdfffe,0xfffbfffb,0xfff9fffb,
-0xfff8fffa,0xfff6fff6,0xfff5fff6,0xfff4fff6,0xfff2fff4,0xfff1fff2,0xffeffff2,0xfff1ffef,
-0xffeeffed,0xffedffea,0xffebffe9,0xffecffe9,0xffeaffe8,0xffe8ffe6,0xffe9ffe7,0xffe8ffe9,
-0xffe8ffe7,0xffe9ffe8,0xffebffea,0xffebffea,0xffebffec,0xffefffec,0xfff0ffef,0xfff3fff1,
-0xfff5fff3,0xfff5fff5,0xfff7fff6,0xfff8fff8,0xfffcfffa,0xfffcfffb,0xfffdffff,0x0001ffff,
-0x00000001,0x00000001,0x00020001,0x00010001,0x00030004,0x00050003,0x00040004,0x00040004,
-0x00050003,0x00070004,0x00050006,0x00030005,0x00050004,0x00050005,0x00030004,0x00020003,
-0x00020003,0x00020003,0x00020000,0x00000001,0x00000000,0xffffffff,0xfffdffff,0xfffdfffd,
-0xfffffffd,0xfffcfffd,0xfffdfffb,0xfffdfffb,0xfffafffa,0xfffafffa,0xfff7fffa,0xfff7fff8,
-0xfff7fff8,0xfff8fff9,0xfffafff9,0xfffafff6,0xfffafff9,0xfff9fff9,0xfff7fff8,0xfff6fff8,
-0xfff6fff8,0xfff8fff8,0xfff8fff8,0xfff7fffa,0xfffafff9,0xfffcfff7,0xfffafffa,0xfffafffa,
-0xfffafff9,0xfffdfffc,0xfffffffc,0xfffcfffe,0xfff9fffc,0xfffbfffc,0xfffdfffe,0xfffefffe,
-0x0002ffff,0x00010001,0x00020000,0x00020002,0x00030004,0x00030003,0x00040003,0x00060004,
-0x00050004,0x00070005,0x00060005,0x00050005,0x00040004,0x00060005,0x00060005,0x00030005,
-0x00040005,0x00020004,0x00050003,0x00030003,0x00030003,0x00040004,0x00030003,0x00020003,
-0x00020003,0x00050003,0x00030003,0x00020002,0x00030005,0x00040006,0x00050006,0x00080007,
-0x00080004,0x00080007,0x00080005,0x00080006,0x00080007,0x000a0008,0x00080008,0x00090009,
-0x0008000b,0x0009000a,0x000a0008,0x00090008,0x00070007,0x00060006,0x00040006,0x00050004,
-0x00030004,0x00010000,0x00000001,0xfffe0001,0xfffcfffd,0xfffdfffc,0xfffafff9,0xfff9fffa,
-0xfff8fff9,0xfff8fff8,0xfff7fff8,0xfff5fff6,0xfff4fff5,0xfff3fff4,0xfff4fff4,0xfff3fff4,
-0xfff2fff0,0xfff1fff1,0xfff0fff1,0xffeffff0,0xfff0fff1,0xfff2fff2,0xfff2fff0,0xfff2fff0,
-0xfff0fff0,0xfff1fff3,0xfff3fff3,0xfff2fff4,0xfff4fff4,0xfff5fff2,0xfff4fff5,0xfff3fff5,
-0xfff4fff4,0xfff4fff6,0xfff4fff5,0xfff6fff6,0xfff5fff6,0xfff6fff7,0xfff7fff9,0xfff6fff8,
-0xfff8fff7,0xfffafff6,0xfffbfff7,0xfffbfff9,0xfffdfffb,0xfffdfffb,0xfffcfffe,0xfffdffff,
-0xffff0002,0xfffc0000,0xffff0000,0xfffe0001,0xffff0001,0xffff0000,0x00010001,0xffffffff,
-0x00000002,0xffff0001,0x00010000,0xffffffff,0xfffffffe,0xfffdffff,0xfffffffd,0xfffeffff,
-0xffffffff,0xfffefffe,0xfffdfffe,0xfffcfffd,0xfffcfffd,0xffffffff,0x00010000,0xffffffff,
-0x0001ffff,0x00040000,0x00030001,0x00050001,0x00040003,0x00060005,0x00090007,0x00090009,
-0x0009000b,0x000b000a,0x000b000c,0x000d000d,0x000e000c,0x000f000d,0x000c000e,0x000d000f,
-0x000d000d,0x000d000c,0x000e000c,0x000d000c,0x000d000c,0x000e000d,0x000c000d,0x000c000c,
-0x000d000c,0x000d000c,0x000c000c,0x000a000b,0x000b000c,0x000b000b,0x000d000c,0x000d000b,
-0x000c000b,0x000e000b,0x000d000c,0x000c000b,0x000b000c,0x000c000d,0x000c000d,0x000d000c,
-0x000c000d,0x000c000d,0x000e000f,0x000d000f,0x000e0010,0x000f000f,0x000e0011,0x000f0011,
-0x000e000f,0x00100010,0x000e000f,0x000e000f,0x000e0010,0x000e000e,0x000d0010,0x000f000d,
-0x000d000d,0x000c000b,0x000b000c,0x000a000a,0x000a0009,0x000b0009,0x000a0009,0x00070008,
-0x00060006,0x00050007,0x00060007,0x00060007,0x00070007,0x00050006,0x00050004,0x00050005,
-0x00040003,0x00020002,0x00020001,0x00010000,0x00000000,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffcfffd,0xfff9fffb,0xfffbfffb,0xfff9fff9,0xfff7fff8,0xfff6fff8,0xfff3fff7,0xfff2fff4,
-0xfff3fff4,0xfff3fff4,0xfff2fff5,0xfff3fff3,0xfff1fff1,0xfff2fff0,0xfff0ffef,0xfff0fff0,
-0xffeffff0,0xffefffee,0xffeeffef,0xffeeffed,0xffedffed,0xffecffef,0xffeeffed,0xffeeffee,
-0xffedffee,0xffedffea,0xffeeffed,0xffeeffee,0xffecffed,0xffedffee,0xffefffee,0xffeefff0,
-0xffefffee,0xffeefff0,0xffefffee,0xfff0fff1,0xffeefff0,0xffeeffef,0xffedffec,0xffedffee,
-0xffebffed,0xffebffeb,0xffeaffe9,0xffeaffe9,0xffe8ffea,0xffeaffe9,0xffe8ffe8,0xffe8ffe9,
-0xffe8ffea,0xffe9ffe7,0xffe8ffea,0xffe9ffe8,0xffe8ffe9,0xffe8ffe9,0xffeaffeb,0xffebffeb,
-0xffecffe9,0xffedffeb,0xffeeffec,0xffeeffed,0xffefffef,0xfff1fff1,0xfff2fff2,0xfff2fff4,
-0xfff5fff4,0xfff4fff5,0xfff8fff8,0xfffafff9,0xfffbfffa,0xfffdfffb,0xfffefffc,0x0000fffd,
-0x0002fffe,0x00010000,0x00040001,0x00040002,0x00070003,0x00080004,0x00090007,0x00070007,
-0x00070009,0x00090008,0x00090009,0x000a0009,0x0008000c,0x0009000a,0x000a000a,0x000a000a,
-0x000c0009,0x000c000c,0x000d000c,0x000c000b,0x000d000d,0x000c000d,0x000b000a,0x000b000b,
-0x000b000b,0x000c000a,0x000d000b,0x000b000a,0x000c000a,0x000c000b,0x000c000c,0x000e000c,
-0x000f000d,0x000d000f,0x000e0010,0x000e0010,0x000f000e,0x0010000e,0x000d000e,0x000d000d,
-0x000e000d,0x000d000e,0x000e000d,0x000d000e,0x000d000e,0x000e000d,0x000e000d,0x000d000c,
-0x000b000d,0x000d000d,0x000f000e,0x000f000f,0x000e000e,0x000e000d,0x000e000e,0x000f000d,
-0x0010000e,0x000f0011,0x0010000f,0x0011000f,0x0010000f,0x00100011,0x00100010,0x00100011,
-0x000c0010,0x000b000d,0x000a000e,0x000a000c,0x0008000a,0x00070008,0x00050006,0x00060005,
-0x00040004,0x00010004,0x00020005,0x00020003,0xffff0003,0x00000000,0x0002ffff,0x00010001,
-0x00010001,0x00010001,0x00020001,0x00020001,0x00030002,0x00050002,0x00040004,0x00050005,
-0x00060007,0x00050004,0x00040005,0x00060004,0x00060005,0x00050005,0x00040005,0x00050003,
-0x00020004,0x00000002,0xffff0000,0xfffe0000,0xfffcfffc,0xfffcfffc,0xfffcfff9,0xfffbfff9,
-0xfff8fff9,0xfff6fff6,0xfff5fff7,0xfff5fff6,0xfff2fff5,0xfff3fff5,0xfff3fff5,0xfff2fff5,
-0xfff4fff4,0xfff2fff2,0xfff2fff1,0xfff2fff2,0xfff0fff2,0xfff3fff2,0xfff1fff2,0xfff0fff1,
-0xffeffff0,0xfff1fff1,0xfff1fff1,0xffefffef,0xffeeffef,0xffedffee,0xffefffed,0xffecffec,
-0xffedffeb,0xffedffee,0xffeeffec,0xffeffff0,0xfff0fff3,0xfff1fff3,0xfff3fff4,0xfff4fff5,
-0xfff5fff6,0xfff7fff7,0xfff8fff8,0xfffafffc,0xfffbfffb,0x0000ffff,0x00010001,0x00020001,
-0x00020002,0x00010002,0x00020003,0x00040004,0x00060003,0x00050004,0x00060005,0x00060006,
-0x00080007,0x00080006,0x00070007,0x00090006,0x00080006,0x000a0007,0x00080008,0x00080008,
-0x00090007,0x00080005,0x000a0008,0x00070009,0x00060007,0x00050007,0x00060006,0x00050004,
-0x00030003,0x00030003,0x00030003,0x00010002,0xffff0001,0x00010001,0xffff0000,0x0000ffff,
-0x0001ffff,0xfffefffe,0xfffdffff,0x00000001,0xfffe0001,0xfffc0000,0xfffd0000,0xfffefffe,
-0xfffcfffe,0xfffeffff,0xfffcfffd,0xfffdfffd,0xfffefffd,0xfffcfffc,0xfffdfffe,0xfffcfffd,
-0xfffdfffc,0xfffcfffc,0xfffffffe,0xfffffffd,0xfffefffd,0xfffffffe,0x0000fffe,0x00000000,
-0xfffeffff,0xffffffff,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffcfffc,0xfffefffd,
-0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffdfffb,0xfffdfffd,
-0xfffbfffd,0xfffdfffd,0xfffbfffb,0xfffafffc,0xfffdfffe,0xfffdfffd,0xfffdfffc,0x0000fffe,
-0x0000ffff,0x00000001,0xfffd0002,0xffff0001,0x00000001,0x00020000,0x00020001,0x00040001,
-0x00020003,0x00030003,0x00040004,0x00010003,0x00020001,0x00020002,0x00000000,0xffff0000,
-0xffffffff,0x0000fffe,0xffffffff,0xfffefffe,0xfffdffff,0xfffc0000,0xfffcfffe,0xfffbfffb,
-0xfffafffc,0xfffcfffa,0xfffafffb,0xfff9fffb,0xfffbfffb,0xfff9fffa,0xfff8fffa,0xfffafff9,
-0xfffafffc,0xfff8fff9,0xfff9fff8,0xfff8fff8,0xfff8fff7,0xfff8fff6,0xfff8fff6,0xfff7fff5,
-0xfff4fff4,0xfff4fff2,0xfff5fff4,0xfff4fff6,0xfff4fff5,0xfff1fff5,0xfff3fff4,0xfff4fff4,
-0xfff5fff4,0xfff7fff6,0xfff7fff5,0xfff6fff7,0xfff8fff6,0xfffafffa,0xfffafffb,0xfffcfffb,
-0xfffcfffb,0xfffffffe,0xffffffff,0x00000000,0x00000000,0x00020002,0x00020003,0x00020003,
-0x00030002,0x00040005,0x00040004,0x00050005,0x00050006,0x00050004,0x00030003,0x00060005,
-0x00040007,0x00060006,0x00060007,0x00070007,0x000a0008,0x000b0009,0x000b0009,0x00090009,
-0x00080008,0x000a000b,0x000a000a,0x0008000a,0x000a0009,0x000b000a,0x000a0008,0x000c0009,
-0x000a0009,0x00090007,0x00090008,0x00070006,0x00090009,0x00080009,0x00070008,0x0008000a,
-0x00080009,0x00080009,0x000a0009,0x00080009,0x00080008,0x000a0008,0x000b0008,0x000b0008,
-0x000c000b,0x000d000c,0x000d000d,0x000e000e,0x000f0010,0x00100012,0x0010000f,0x00110011,
-0x00110010,0x0010000f,0x00100011,0x00110011,0x000f0011,0x000f0010,0x000f000f,0x000f000d,
-0x000c000c,0x000b000c,0x000b000b,0x00090009,0x00060007,0x00050006,0x00060007,0x00040007,
-0x00040004,0x00020005,0x00020006,0x00020004,0x00020003,0x00010004,0x00030004,0x00040003,
-0x00050003,0x00070004,0x00040005,0x00060006,0x00070006,0x00060007,0x00080006,0x00060006,
-0x00060006,0x00040007,0x00040005,0x00050005,0x00040004,0x00040003,0x00030003,0x00010003,
-0x00010002,0xffff0000,0xfffdfffe,0xfffefffd,0xfffbfffd,0xfffafffb,0xfff8fffb,0xfff7fff8,
-0xfff6fff8,0xfff5fff7,0xfff6fff5,0xfff5fff3,0xfff4fff4,0xfff5fff4,0xfff4fff3,0xfff3fff3,
-0xfff3fff3,0xfff3fff3,0xfff0fff1,0xffeefff1,0xffefffef,0xfff0ffef,0xfff0ffef,0xfff0ffee,
-0xffeeffee,0xffeeffed,0xffeeffed,0xffeeffed,0xffedffed,0xffeaffeb,0xffedffec,0xffebffee,
-0xffeaffea,0xffecffec,0xffebffeb,0xffebffea,0xffeaffeb,0xffe9ffea,0xffe9ffea,0xffebffea,
-0xffeaffe9,0xffeaffea,0xffebffe7,0xffebffec,0xffedffeb,0xffecffec,0xffecffed,0xffeeffee,
-0xffeffff0,0xffeffff2,0xffeffff0,0xfff0ffee,0xfff4fff2,0xfff4fff1,0xfff5fff4,0xfff5fff2,
-0xfff4fff5,0xfff5fff5,0xfff4fff5,0xfff6fff8,0xfff6fff7,0xfff7fff6,0xfff7fff5,0xfff8fff7,
-0xfff7fff7,0xfff7fff7,0xfff7fff7,0xfff7fff6,0xfff8fff8,0xfff8fffa,0xfff8fff9,0xfffbfff8,
-0xfffbfffb,0xfffafffb,0xfffcfffc,0xfffcfffb,0xfffcfffd,0xfffbfffd,0xfffefffd,0xfffefffc,
-0xfffefffe,0xfffdfffe,0x0000ffff,0x0000ffff,0x0000fffe,0x00020000,0x00040001,0x00050002,
-0x00040002,0x00070004,0x00080007,0x00090008,0x000b0009,0x000c000a,0x000d000c,0x000c000d,
-0x000d000d,0x000e000d,0x0010000e,0x00100010,0x00100011,0x00110010,0x00110010,0x00110012,
-0x00100012,0x00120013,0x00100012,0x00110010,0x00110011,0x00110011,0x00110013,0x00120011,
-0x00110011,0x000f0010,0x00100011,0x0011000f,0x00100010,0x000f0010,0x000f000f,0x000f000e,
-0x000f000e,0x000e000e,0x000c000d,0x000b000c,0x000c000b,0x000b000c,0x0009000a,0x0009000a,
-0x0009000a,0x000a000a,0x000a000a,0x000a0009,0x00090009,0x0009000a,0x000b000a,0x0008000b,
-0x00080008,0x00090008,0x00080009,0x000a0009,0x00090009,0x00090007,0x00090007,0x00090008,
-0x0008000a,0x00070008,0x00070006,0x00060009,0x00050008,0x00050006,0x00030005,0x00030002,
-0x00020003,0x00000001,0x00000000,0xffff0000,0xfffdffff,0xfffcfffe,0xfffcfffd,0xfffbfffd,
-0xfffbfffd,0xfffdfffe,0xfffffffd,0xfffcfffd,0xfffefffd,0xfffcfffc,0xfffcfffc,0xfffdfffc,
-0xfffbfffa,0xfffdfffc,0xfffdfffe,0xfffdfffd,0xfffdffff,0xfffefffe,0xfffe0000,0xfffffffe,
-0xfffe0000,0xfffcffff,0xfffd0000,0xfffdffff,0xfffcffff,0xfffcfffe,0xfffcfffd,0xfffcfffc,
-0xfffafffb,0xfffbfffc,0xfff9fff9,0xfff8fff8,0xfff9fff8,0xfff8fff8,0xfff7fff7,0xfff8fff7,
-0xfff8fff6,0xfff8fff8,0xfff7fff7,0xfff6fff6,0xfff7fff6,0xfff7fff6,0xfff6fff5,0xfff7fff6,
-0xfff7fff7,0xfff7fff6,0xfff8fff7,0xfff7fff7,0xfff8fff7,0xfff7fff7,0xfff8fffa,0xfff7fff9,
-0xfff8fff8,0xfff7fff7,0xfff7fff6,0xfff7fff6,0xfff4fff5,0xfff4fff4,0xfff4fff4,0xfff5fff4,
-0xfff7fff6,0xfff6fff4,0xfff6fff6,0xfff6fff6,0xfff6fff6,0xfff7fff6,0xfff7fff6,0xfffafff8,
-0xfffafffa,0xfffbfffb,0xfffbfffb,0xfffefffd,0xfffdfffc,0xfffdfffd,0xfffefffe,0xfffefffe,
-0xffff0000,0x00020002,0x00030003,0x00050002,0x00040003,0x00030004,0x00040004,0x00030004,
-0x00030003,0x00030005,0x00040006,0x00050006,0x00040005,0x00040005,0x00040006,0x00030007,
-0x00060006,0x00050006,0x00050005,0x00040004,0x00040006,0x00050004,0x00050004,0x00050004,
-0x00050003,0x00030002,0x00030004,0x00040005,0x00050005,0x00060006,0x00070006,0x00050005,
-0x00050006,0x00050005,0x00060008,0x00080007,0x00070009,0x00070006,0x00090006,0x00090007,
-0x00070007,0x00080007,0x00070009,0x00060008,0x00060006,0x00050007,0x00060005,0x00060006,
-0x00050003,0x00040005,0x00030006,0x00020005,0x00030001,0x00020001,0x00010001,0x00000001,
-0x0001fffe,0x0000ffff,0x00000000,0xfffeffff,0xfffdfffe,0xfffcfffd,0xfffefffe,0xfffdffff,
-0xfffefffd,0xfffefffe,0xffff0000,0xfffffffd,0xfffdfffd,0xfffcfffd,0xfffdfffc,0xfffdfffd,
-0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffbfffa,0xfffbfffb,0xfffcfffc,
-0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffefffd,0xfffdfffc,0xfffefffd,0xfffcfffe,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00010001,0x00010000,0x00030001,0x00040001,
-0x00010001,0x0000ffff,0x0000fffe,0x00000000,0xfffdfffd,0xfffefffb,0xfffafffb,0xfffafffc,
-0xfff9fffa,0xfff8fff9,0xfff7fff8,0xfff7fff7,0xfff5fff8,0xfff6fff6,0xfff5fff4,0xfff4fff5,
-0xfff3fff4,0xfff3fff2,0xfff4fff3,0xfff3fff1,0xfff2fff0,0xfff2fff1,0xfff1fff1,0xfff4fff1,
-0xfff3fff2,0xfff4fff0,0xfff5fff3,0xfff6fff3,0xfff4fff3,0xfff5fff4,0xfff4fff4,0xfff5fff4,
-0xfff5fff5,0xfff7fff7,0xfff6fff7,0xfff7fff7,0xfff7fff8,0xfffafff8,0xfffbfffb,0xfffafffc,
-0xfffcfffc,0xfffdfffd,0x0000fffc,0xfffffffe,0xffffffff,0x00010001,0x00020003,0x00020003,
-0x00010004,0x00020004,0x00040005,0x00060006,0x00070006,0x00060007,0x00070005,0x00060005,
-0x00070005,0x00060006,0x00040005,0x00040004,0x00040005,0x00040004,0x00050005,0x00030004,
-0x00050003,0x00040003,0x00020004,0x00040004,0x00060006,0x00040005,0x00040005,0x00050004,
-0x00060007,0x000a0007,0x000c000a,0x000d000c,0x000c000c,0x000c000d,0x000e000d,0x000d000e,
-0x000e000d,0x000f0010,0x00110010,0x00140010,0x00130013,0x00130015,0x00150014,0x00130013,
-0x00160014,0x00130015,0x00120012,0x00130012,0x00110013,0x000f0012,0x00100010,0x000e000f,
-0x000d000d,0x000c000b,0x000a000a,0x00080008,0x00070007,0x00070005,0x00040003,0x00010003,
-0xffff0003,0xffffffff,0x00000001,0xfffd0000,0xfffcffff,0xfffe0001,0xffff0000,0xfffd0000,
-0xfffbfffe,0xfffcfffe,0xfffefffe,0xfffffffc,0xfffffffe,0xffff0000,0xfffefffe,0xfffefffd,
-0xfffefffd,0xfffffffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffcfffd,0xfffefffe,0xfffdffff,
-0xfffefffd,0xfffdfffd,0xfffbfffa,0xfff9fff9,0xfff8fff8,0xfff8fff9,0xfff6fff9,0xfff4fff8,
-0xfff5fff7,0xfff4fff6,0xfff4fff3,0xfff4fff4,0xfff5fff4,0xfff3fff4,0xfff3fff4,0xfff3fff3,
-0xfff3fff2,0xfff4fff3,0xfff4fff3,0xfff3fff3,0xfff1fff2,0xfff2fff2,0xfff1fff2,0xfff2fff4,
-0xfff1fff0,0xfff1fff1,0xfff0fff2,0xffeefff0,0xffeffff2,0xffeffff0,0xffeffff1,0xfff0fff1,
-0xfff0ffef,0xfff0ffee,0xfff1ffef,0xfff0fff0,0xfff2fff0,0xfff2fff1,0xfff3fff2,0xfff2fff2,
-0xfff3fff4,0xfff4fff5,0xfff5fff4,0xfff4fff6,0xfff6fff7,0xfff7fff8,0xfff8fff9,0xfff9fffb,
-0xfffcfffa,0xfffcfffc,0xfffefffc,0xfffefffd,0xfffffffd,0x00010000,0x00010001,0x00030002,
-0x00000003,0x00010002,0x00020003,0x00030004,0x00020004,0x00020000,0x00040003,0x00040002,
-0x00020002,0x00010002,0x00010001,0x00000000,0xfffefffe,0x0000fffd,0xfffffffe,0xfffeffff,
-0xfffdfffd,0xfffffffc,0x0000fffc,0x0001fffd,0x0001fffe,0xfffffffe,0xfffffffe,0xffff0000,
-0x00010001,0x00020002,0x00050003,0x00060008,0x00080007,0x000a000a,0x000b000c,0x000b000c,
-0x000d000e,0x000d000d,0x000e000e,0x0010000e,0x0010000f,0x000f000f,0x00120010,0x00110012,
-0x00100010,0x00100011,0x00100011,0x00120011,0x0010000f,0x0010000f,0x00120011,0x000f0010,
-0x000f0010,0x000f000f,0x00110010,0x00110011,0x00100011,0x000f0012,0x000f0010,0x000f000e,
-0x000f000f,0x000e000e,0x000d000c,0x000d000e,0x000c000c,0x000b000d,0x000b000c,0x0009000c,
-0x0008000b,0x00080009,0x00070007,0x00060008,0x00040008,0x00060005,0x00060004,0x00080004,
-0x00060004,0x00050004,0x00040004,0x00050004,0x00050004,0x00050004,0x00050004,0x00060003,
-0x00040005,0x00040006,0x00040006,0x00030005,0x00040005,0x00030005,0x00040003,0x00020003,
-0x00040004,0x00000002,0x0000ffff,0x00000000,0x0000fffe,0xfffefffe,0xfffdfffe,0xfffcfffd,
-0xfffcfffc,0xfffbfffc,0xfff9fffb,0xfffafffa,0xfff9fffb,0xfff9fffb,0xfff9fff9,0xfff7fff9,
-0xfff7fff7,0xfff7fff5,0xfff6fff5,0xfff5fff4,0xfff3fff3,0xfff3fff2,0xfff2fff1,0xfff0fff1,
-0xffeeffef,0xffedffee,0xffecffed,0xffebffed,0xffecffec,0xffebffeb,0xffecffed,0xffecffec,
-0xffecffec,0xffeeffef,0xffedffee,0xffedffef,0xffefffee,0xfff0ffef,0xfff0fff0,0xfff2fff1,
-0xfff2fff1,0xfff3fff3,0xfff4fff3,0xfff5fff3,0xfff7fff4,0xfff6fff7,0xfff6fff5,0xfff6fff7,
-0xfff8fff7,0xfff8fff7,0xfffafffa,0xfff9fff9,0xfff9fffb,0xfff9fffb,0xfffafffa,0xfff9fffb,
-0xfff9fffa,0xfffafffb,0xfffbfffa,0xfff9fffb,0xfffafffb,0xfffbfffc,0xfffefffc,0xfffefffb,
-0xfffdfffb,0xfffbfffd,0xfffcfffc,0xfffbfffa,0xfff8fffb,0xfff8fffa,0xfff9fff9,0xfff9fff9,
-0xfff7fff9,0xfff5fff6,0xfff5fff5,0xfff4fff3,0xfff3fff3,0xfff6fff4,0xfff4fff3,0xfff3fff4,
-0xfff5fff3,0xfff5fff2,0xfff4fff3,0xfff3fff4,0xfff6fff5,0xfff5fff6,0xfff8fff7,0xfff9fff7,
-0xfff9fff9,0xfffcfffb,0xfffffffd,0x0000fffd,0x00010000,0x00020002,0x00030004,0x00050005,
-0x00070006,0x00090009,0x000b000a,0x000c000b,0x000e000d,0x000e000d,0x0011000f,0x0010000f,
-0x00130010,0x00120010,0x00120011,0x00110010,0x00110011,0x00110012,0x000e0012,0x00100011,
-0x00100010,0x00110011,0x00110011,0x00120010,0x0011000f,0x000e000f,0x000e000f,0x000d000e,
-0x000c000d,0x000d000c,0x000c000e,0x000c000e,0x000c000d,0x000e000c,0x000c000c,0x000b000e,
-0x000d000d,0x000c000d,0x000c000d,0x000e000d,0x000c000c,0x000c000c,0x000d000d,0x000d000e,
-0x000a000d,0x000b000b,0x000a0009,0x000b0009,0x000a000a,0x00080008,0x00090008,0x00080007,
-0x00080008,0x00080005,0x00060006,0x00050007,0x00050006,0x00040005,0x00050005,0x00040003,
-0x00030003,0x00040005,0x00020005,0x00030002,0x00030002,0x00040003,0x00030002,0x00010002,
-0x00010001,0x00000000,0xffff0001,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffcfffb,0xfffbfffb,
-0xfffbfffc,0xfff9fffa,0xfff8fffa,0xfff8fff7,0xfff7fff8,0xfff7fff7,0xfff6fff6,0xfff3fff5,
-0xfff5fff6,0xfff4fff4,0xfff6fff5,0xfff5fff6,0xfff5fff4,0xfff4fff5,0xfff5fff6,0xfff4fff4,
-0xfff4fff5,0xfff5fff3,0xfff4fff3,0xfff4fff4,0xfff4fff3,0xfff4fff4,0xfff4fff4,0xfff3fff4,
-0xfff3fff5,0xfff2fff3,0xfff2fff4,0xfff2fff3,0xfff4fff5,0xfff6fff5,0xfff5fff4,0xfff6fff6,
-0xfff6fff4,0xfff5fff5,0xfff7fff6,0xfff6fff6,0xfff6fff7,0xfff7fff5,0xfff7fff6,0xfff6fff6,
-0xfff6fff5,0xfff4fff6,0xfff5fff6,0xfff7fff6,0xfff7fff6,0xfff7fff5,0xfff7fff4,0xfff5fff4,
-0xfff4fff7,0xfff7fff8,0xfff7fff7,0xfff7fff8,0xfffafff9,0xfffbfffa,0xfffefffd,0xfffdfffd,
-0xfffffffd,0x0001ffff,0x0001ffff,0x00030002,0x00040003,0x00050007,0x00060006,0x00050007,
-0x00060006,0x00080007,0x00070007,0x00080007,0x00060008,0x00090007,0x00060009,0x00070006,
-0x00060005,0x00050005,0x00030005,0x00040005,0x00040004,0x00030002,0x00030003,0x00020003,
-0x00020002,0x00030003,0x00040003,0x00040004,0x00030003,0x00030004,0x00040004,0x00030005,
-0x00040004,0x00050002,0x00050004,0x00060004,0x00060005,0x00030004,0x00050005,0x00060005,
-0x00050005,0x00060005,0x00060007,0x00060007,0x00080008,0x00060009,0x00050008,0x00060005,
-0x00060005,0x00050004,0x00060005,0x00050005,0x00050004,0x00050007,0x00050005,0x00040003,
-0x00040006,0x00030004,0x00040005,0x00050003,0x00060005,0x00060004,0x00040004,0x00040003,
-0x00030003,0x00020004,0x00010003,0x00010001,0x00000000,0x00010001,0x00010002,0xffff0002,
-0xffff0001,0xfffefffe,0xfffeffff,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffcfffd,
-0xfffdfffc,0xfffcfffc,0xfffafff9,0xfffbfffb,0xfffafffa,0xfff9fff9,0xfff7fff9,0xfff9fff8,
-0xfff8fff8,0xfff6fff7,0xfff9fff8,0xfff9fff9,0xfff9fff8,0xfff8fff9,0xfffafff9,0xfff9fff9,
-0xfffafffa,0xfff8fffa,0xfffafff9,0xfffbfff9,0xfffdfffb,0xfffbfffa,0xfffbfffb,0xfffafffa,
-0xfffafffa,0xfffafff9,0xfffafffb,0xfff9fffb,0xfff8fff8,0xfff7fff7,0xfff8fff7,0xfff6fff7,
-0xfff7fff7,0xfff4fff8,0xfff4fff6,0xfff3fff6,0xfff4fff6,0xfff3fff4,0xfff4fff4,0xfff3fff5,
-0xfff6fff8,0xfff5fff8,0xfff8fff7,0xfff9fff7,0xfffafffa,0xfffafff9,0xfffbfffa,0xfffcfffa,
-0xfffbfffb,0xfffafffb,0xfffcfffc,0xfffefffb,0xfffefffe,0xfffd0000,0xffff0000,0x0000fffe,
-0x0000fffe,0x0000ffff,0x00010000,0x00000000,0x00010000,0x00020001,0x00020003,0x00030003,
-0x00040005,0x00030006,0x00040005,0x00050005,0x00060007,0x00060005,0x00070006,0x00070008,
-0x00080009,0x00080007,0x00090007,0x00080007,0x00090006,0x00090008,0x00090009,0x000a0007,
-0x000a000a,0x00080008,0x00090008,0x00090009,0x0008000a,0x00080009,0x00090008,0x00070007,
-0x000a0007,0x00090008,0x00070009,0x0008000a,0x0009000a,0x000a0009,0x000a0009,0x000b000a,
-0x000b000b,0x000d000d,0x000d000c,0x000e000f,0x000f000e,0x000f000e,0x000e000e,0x000f000e,
-0x000e000e,0x0010000f,0x000d000d,0x000b000d,0x000c000b,0x000b000c,0x000a000b,0x000b000b,
-0x000a000b,0x000a0009,0x00090008,0x00070008,0x00050006,0x00070008,0x00050007,0x00030004,
-0x00050005,0x00050005,0x00020004,0x00040003,0x00040004,0x00070004,0x00050004,0x00050004,
-0x00050004,0x00050004,0x00060006,0x00060005,0x00040007,0x00060004,0x00060006,0x00050004,
-0x00040004,0x00030004,0x00040004,0x00040004,0x00010002,0x00000000,0xfffe0001,0xfffe0000,
-0xffffffff,0xfffdfffe,0xfffbfffb,0xfffafffc,0xfffbfffa,0xfff7fffa,0xfff6fff9,0xfff7fff8,
-0xfff7fff9,0xfff5fff6,0xfff5fff6,0xfff6fff6,0xfff4fff5,0xfff4fff5,0xfff4fff5,0xfff2fff3,
-0xfff3fff3,0xfff3fff2,0xfff2fff0,0xfff3fff2,0xfff1fff1,0xfff2fff0,0xfff1ffef,0xffeffff0,
-0xfff0ffef,0xfff0ffef,0xffefffef,0xfff1fff0,0xffedfff0,0xffecffef,0xffedffee,0xffedffee,
-0xffecffee,0xffeeffef,0xffeeffed,0xffecffed,0xffecffec,0xffedffeb,0xffecffec,0xffedffec,
-0xffeeffed,0xffeeffee,0xffefffef,0xfff1ffee,0xfff1ffee,0xfff1fff0,0xfff1fff0,0xfff1fff1,
-0xfff1fff1,0xfff3fff4,0xfff4fff4,0xfff5fff5,0xfff5fff6,0xfff6fff6,0xfff5fff6,0xfff9fff6,
-0xfff7fff7,0xfff6fff7,0xfff8fff6,0xfff7fff7,0xfff7fff7,0xfff8fff7,0xfff6fff8,0xfff8fff8,
-0xfffbfff9,0xfff9fff8,0xfffcfffa,0xfff9fffa,0xfffafffb,0xfffafffb,0xfff9fffc,0xfffbfffc,
-0xfffcfffb,0xfffbfffc,0xfffcfffb,0xfffbfffc,0xfffdfffc,0xffffffff,0xfffefffe,0xfffeffff,
-0xfffeffff,0x0001ffff,0x00010000,0x00030002,0x00030003,0x00040004,0x00040005,0x00050005,
-0x00070004,0x00070005,0x00070008,0x00090008,0x0008000a,0x0009000a,0x000b000c,0x000e000e,
-0x000d0010,0x000d000f,0x000e000e,0x000e000f,0x000f000f,0x0010000f,0x0010000f,0x0010000f,
-0x0010000f,0x0010000e,0x000e000f,0x000f000f,0x000f000d,0x000f000e,0x000e000e,0x000e000e,
-0x000d000f,0x000e000e,0x000d000f,0x000c000e,0x000d000d,0x000d000d,0x000d000c,0x000b000c,
-0x000d000c,0x000c000c,0x0009000a,0x0009000a,0x000a000a,0x00080008,0x00080008,0x00080009,
-0x00080008,0x00070006,0x00090006,0x00090006,0x00080009,0x0008000a,0x00070007,0x00090009,
-0x00080009,0x00090008,0x00080009,0x00060007,0x00070008,0x00060008,0x00080007,0x00060006,
-0x00050007,0x00050006,0x00060005,0x00050004,0x00050003,0x00030004,0x00030003,0x00020003,
-0x00000001,0x0000ffff,0xfffffffe,0xfffefffc,0xfffdfffd,0xfffdfffc,0xfffcfffc,0xfffdfffd,
-0xfffcfffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffdffff,0xfffdfffc,
-0xfffffffe,0xfffcfffd,0xffffffff,0xffffffff,0xfffffffe,0xfffe0000,0xfffeffff,0xfffdfffe,
-0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffe0000,0xfffdfffd,0xfffdfffe,0xfffbfffd,0xfff9fffc,
-0xfffcfffa,0xfffcfffb,0xfffbfffa,0xfff9fff9,0xfff9fff8,0xfff7fff7,0xfff8fff9,0xfff8fff9,
-0xfff7fff9,0xfff8fff9,0xfff9fffa,0xfffafffa,0xfffbfff9,0xfffbfffa,0xfffdfffb,0xfffbfffb,
-0xfffbfffb,0xfffbfffb,0xfffbfffa,0xfffbfff9,0xfffcfffc,0xfffafffa,0xfffbfffb,0xfffcfffa,
-0xfffbfffa,0xfff9fffa,0xfff7fff9,0xfff7fff7,0xfff6fff8,0xfff8fff9,0xfff8fff7,0xfff9fff8,
-0xfff8fff7,0xfff6fff7,0xfff7fff8,0xfff8fff8,0xfffafff8,0xfffafff9,0xfffbfffb,0xfffbfffa,
-0xfffcfffc,0xfffdfffe,0xfffefffd,0xffffffff,0x00000000,0xffffffff,0x0000ffff,0x00010001,
-0x00020001,0x00030001,0x00030001,0x00010001,0x00030002,0x00040004,0x00030002,0x00030004,
-0x00020005,0x00010005,0x00020003,0x00020003,0x00030003,0x00030003,0x00020002,0x00020002,
-0x00000001,0x00010003,0x00020001,0x00000002,0x00000001,0x00000000,0x00010001,0x0000ffff,
-0x00010000,0x00010000,0x00010001,0x00000001,0x00000001,0x00000000,0x00010001,0x00010001,
-0x00030001,0x00030004,0x00030005,0x00020005,0x00050005,0x00030003,0x00040003,0x00030003,
-0x00040004,0x00000003,0x00010002,0x00000000,0xffffffff,0xffffffff,0xfffefffe,0xfffcfffe,
-0xfffbfffc,0xfff9fffb,0xfffcfffb,0xfffbfffc,0xfffcfff9,0xfff9fff8,0xfffbfff8,0xfff9fff9,
-0xfff8fff9,0xfff8fff8,0xfff8fff8,0xfff8fffa,0xfff8fff9,0xfffafffa,0xfff9fffb,0xfffafff9,
-0xfffafffa,0xfffbfff9,0xfffcfffb,0xfffbfffb,0xfffafffa,0xfffafffa,0xfffbfffb,0xfffafffa,
-0xfffbfffb,0xfff9fffb,0xfff9fffa,0xfff8fffa,0xfff8fffa,0xfff9fffa,0xfffcfffc,0xfffcfffb,
-0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffefffd,0xfffefffc,0xfffffffe,0x0000ffff,0xffffffff,
-0x00010002,0x00020001,0x00040003,0x00030003,0x00030002,0x00040004,0x00060006,0x00030006,
-0x00030004,0x00030004,0x00030003,0x00010004,0x00000001,0x00010001,0xffff0000,0xffff0000,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffcfffd,0xfffbfffb,0xfffafffa,0xfff9fff9,0xfff9fff9,
-0xfff7fff7,0xfff8fff8,0xfff8fff9,0xfff7fff8,0xfff8fff6,0xfff7fff8,0xfff6fff6,0xfff5fff8,
-0xfff6fff7,0xfff6fff9,0xfff6fff7,0xfff7fff9,0xfff8fff8,0xfff8fffa,0xfff9fff9,0xfff9fffb,
-0xfffbfffb,0xfffcfffc,0xfffefffc,0xfffeffff,0x00010000,0x00010000,0x00030003,0x00050005,
-0x00070004,0x00080005,0x00080007,0x00090009,0x000a0008,0x000b000b,0x000b000a,0x000d000a,
-0x000c000b,0x000c000e,0x000e000f,0x000d000d,0x000c000d,0x000f000d,0x000e000f,0x000d000e,
-0x000d000e,0x000d000f,0x000d000e,0x000d000c,0x000f000f,0x000c000e,0x0010000d,0x000f000f,
-0x000e000c,0x000d000c,0x000c000b,0x000c000a,0x000b000b,0x00090009,0x000a0009,0x00090008,
-0x0009000a,0x00080009,0x0008000a,0x00070009,0x00060008,0x00070006,0x00070007,0x00070006,
-0x00070006,0x00070005,0x000a0008,0x00080009,0x00080008,0x00070008,0x00080008,0x00080007,
-0x00070008,0x00060008,0x00060008,0x00060006,0x00070007,0x00060006,0x00040005,0x00050005,
-0x00040005,0x00020003,0x00040003,0x00030003,0x00040003,0x00040004,0x00020003,0x00010002,
-0x00010000,0xfffe0002,0x0000ffff,0xffffffff,0xfffefffe,0xfffcfffe,0xfffdfffe,0xfffbfffc,
-0xfffcfffc,0xfffdfffc,0xfffbfffc,0xfffbfffc,0xfffbfffb,0xfffdfffa,0xfffbfffb,0xfffafff9,
-0xfffafffa,0xfffafffb,0xfffafff9,0xfffbfff9,0xfff9fffa,0xfffbfffa,0xfffafffa,0xfffafffa,
-0xfffafffb,0xfffafffb,0xfffbfffb,0xfffbfffb,0xfff9fffb,0xfffcfffc,0xfffafffb,0xfff9fffc,
-0xfffafffb,0xfff9fffb,0xfff8fff9,0xfff8fff7,0xfff6fff8,0xfff8fff8,0xfff8fff7,0xfff7fff8,
-0xfff5fff6,0xfff4fff5,0xfff4fff4,0xfff3fff5,0xfff5fff5,0xfff4fff4,0xfff2fff2,0xfff3fff3,
-0xfff3fff2,0xfff4fff4,0xfff2fff2,0xfff2fff2,0xfff1fff1,0xfff3fff2,0xfff3fff2,0xfff2fff0,
-0xfff1fff0,0xfff1fff1,0xfff0fff0,0xfff0fff0,0xfff1ffef,0xffeffff1,0xfff0fff0,0xfff0fff0,
-0xfff1fff1,0xfff0fff0,0xffeeffef,0xffeeffef,0xfff0fff0,0xffefffee,0xfff0fff1,0xfff1ffef,
-0xfff1fff1,0xffeffff1,0xfff0fff1,0xfff2fff1,0xfff3fff2,0xfff4fff4,0xfff5fff6,0xfff7fff5,
-0xfff8fff6,0xfff8fff7,0xfffafff9,0xfff8fffa,0xfffcfffa,0xfffcfffc,0xfffdfffd,0x0000fffe,
-0x00010000,0x00020001,0x00030003,0x00040003,0x00050004,0x00050006,0x00070006,0x00050006,
-0x00070007,0x00060006,0x00060006,0x00070006,0x00070008,0x00060007,0x00070007,0x00050006,
-0x00050005,0x00060004,0x00040004,0x00050004,0x00050003,0x00040005,0x00040004,0x00020004,
-0x00050004,0x00060006,0x00050004,0x00060006,0x00070005,0x00060006,0x00070006,0x00080007,
-0x00090009,0x00090008,0x000a0009,0x000a000a,0x000b000a,0x000b000a,0x000b000a,0x0009000b,
-0x000b000c,0x000d000d,0x000d000e,0x000e000c,0x000c000b,0x000c000c,0x000c000b,0x000d000b,
-0x000b000d,0x000a000c,0x0008000a,0x00080009,0x0008000a,0x0008000a,0x000b0008,0x00070008,
-0x00070008,0x00070007,0x00070007,0x00070007,0x00070008,0x00080007,0x00070007,0x00080008,
-0x00080008,0x00080008,0x00070006,0x00070006,0x00060006,0x00060007,0x00060007,0x00070005,
-0x00060006,0x00070006,0x00070005,0x00060006,0x00050005,0x00050005,0x00030003,0x00030004,
-0x00040005,0x00040005,0x00060007,0x00050004,0x00040003,0x00040004,0x00030004,0x00020002,
-0x00020001,0x00020001,0x00020002,0x00010002,0x00020000,0x00020002,0x00000001,0x0001ffff,
-0x00010000,0x00010002,0x00010001,0x00000001,0xfffe0001,0xffff0000,0xffff0000,0xfffdffff,
-0xfffdfffe,0xfffbfffe,0xfffcfffc,0xfffcfffd,0xfffbfffa,0xfffbfffa,0xfffbfffa,0xfffbfff8,
-0xfff9fffa,0xfff8fff7,0xfff9fff8,0xfff8fff9,0xfff8fffa,0xfff7fffa,0xfff9fff8,0xfff8fff8,
-0xfff7fffa,0xfff8fff9,0xfff9fffa,0xfff9fffa,0xfff9fff9,0xfffbfffa,0xfffafffb,0xfffbfffa,
-0xfffbfffa,0xfffcfffc,0xfffbfffd,0xfffcfffb,0xfffcfffb,0xfffbfffb,0xfffafffa,0xfffcfffb,
-0xfff9fffa,0xfffafffa,0xfffbfff9,0xfffafffa,0xfffafff9,0xfffafffb,0xfffcfffd,0xfffcfffb,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffdfffb,0xfffdfffb,0xfffcfffd,0xfffdfffb,
-0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffbfffe,0xfffcfffc,0xfffbfffc,
-0xfffbfffe,0xfffcfffd,0xfffbfffd,0xfffbfffe,0xfffcfffc,0xfffdfffe,0xfffdfffe,0xfffcfffd,
-0xfffcfffd,0xfffdfffe,0xfffcfffd,0xfffdfffe,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffffffe,0xffff0000,0x00010001,0x00010000,0x00020000,0x00030000,0x00030003,0x00030003,
-0x00030001,0x00030003,0x00030001,0x00040005,0x00050004,0x00050003,0x00050005,0x00060005,
-0x00060006,0x00050006,0x00070006,0x00060006,0x00050006,0x00050004,0x00030003,0x00020003,
-0x00040002,0x00030004,0x00020003,0x00010000,0x00000000,0xfffdfffe,0xfffdfffc,0xfffcfffd,
-0xfffcfffd,0xfffcfffc,0xfffbfffa,0xfffcfffb,0xfff9fff9,0xfff8fffa,0xfffafffb,0xfffcfffc,
-0xfffcfffc,0xfffbfffa,0xfffdfffc,0xfffcfffd,0xfffcfffd,0xfffbfffb,0xfffefffc,0xfffefffc,
-0xfffefffd,0xfffbfffd,0xfffcfffd,0xfffcfffb,0xfffcfffa,0xfff9fffc,0xfffafffb,0xfffafffa,
-0xfff8fffb,0xfff8fff9,0xfff8fff8,0xfff7fff8,0xfff5fff5,0xfff6fff4,0xfff5fff6,0xfff6fff4,
-0xfff7fff4,0xfff6fff5,0xfff6fff7,0xfff7fff7,0xfff7fff9,0xfff7fff9,0xfff7fffa,0xfffafffa,
-0xfffbfffb,0xfffafffb,0xfffbfffb,0xfffdfffd,0xfffdffff,0xfffdfffe,0xffffffff,0xfffffffd,
-0xffff0000,0xffffffff,0x00000000,0x00000000,0xffff0000,0x0000ffff,0x0000ffff,0x00010000,
-0x00010001,0x0000ffff,0x00000001,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0x00000001,
-0xfffe0001,0x00000001,0x00010002,0x00030003,0x00020003,0x00030004,0x00040005,0x00060005,
-0x00060005,0x00060005,0x00060005,0x00070006,0x00070006,0x00070007,0x00070007,0x00080008,
-0x00060007,0x00050006,0x00060005,0x00050005,0x00040004,0x00050002,0x00040003,0x00000001,
-0x00010000,0x00010001,0xfffeffff,0xffffffff,0xfffffffe,0xfffdfffe,0xfffdffff,0xfffffffe,
-0xfffdfffe,0xfffefffd,0xfffefffd,0x0000fffd,0x0000ffff,0x00010002,0x00010002,0x00030004,
-0x00050005,0x00060005,0x00070007,0x00080006,0x00090008,0x0009000a,0x000a000a,0x000b000c,
-0x000c000e,0x000e000d,0x0010000f,0x00110010,0x00100010,0x00110010,0x00100011,0x000f000e,
-0x000e000d,0x000f000e,0x000f000f,0x000c000e,0x000b000c,0x000b000b,0x000a000a,0x0009000c,
-0x000a000a,0x000a0009,0x0009000a,0x0009000a,0x0009000a,0x00070008,0x00070006,0x00070008,
-0x00060007,0x00080007,0x00060006,0x00050005,0x00050004,0x00040004,0x00030003,0x00040005,
-0x00030005,0x00020005,0x00030004,0x00030004,0x00030002,0x00030000,0x0002ffff,0x0001ffff,
-0x0001fffe,0x0000ffff,0x00000000,0xfffdffff,0xfffdffff,0xfffdfffe,0xfffdfffc,0xfffafffc,
-0xfffafffa,0xfffbfffc,0xfffcfffc,0xfffcfffb,0xfff9fffa,0xfff9fff9,0xfff9fff9,0xfffafffa,
-0xfff9fff8,0xfff9fff8,0xfff9fffa,0xfff9fffb,0xfff9fff9,0xfff7fff9,0xfff7fff9,0xfff7fff9,
-0xfff8fff7,0xfff8fff7,0xfff6fff6,0xfff6fff5,0xfff6fff6,0xfff5fff6,0xfff4fff4,0xfff4fff4,
-0xfff4fff4,0xfff3fff5,0xfff3fff3,0xfff4fff4,0xfff4fff3,0xfff4fff5,0xfff5fff5,0xfff4fff6,
-0xfff3fff4,0xfff6fff4,0xfff5fff6,0xfff7fff6,0xfff8fff7,0xfff9fff8,0xfff9fff9,0xfffafff9,
-0xfffafff9,0xfffafffa,0xfffbfffb,0xfffcfffa,0xfffcfffc,0xfffdfffc,0xfffdfffb,0xfffcfffb,
-0xfff9fffb,0xfff9fffa,0xfff9fffa,0xfff9fffc,0xfff8fffa,0xfff9fffb,0xfff6fff8,0xfff6fff7,
-0xfff6fff8,0xfff7fff7,0xfff5fff6,0xfff5fff6,0xfff4fff5,0xfff4fff3,0xfff3fff4,0xfff3fff4,
-0xfff2fff3,0xfff3fff3,0xfff2fff3,0xfff2fff2,0xfff3fff1,0xfff4fff1,0xfff3fff3,0xfff3fff2,
-0xfff3fff4,0xfff6fff7,0xfff4fff5,0xfff7fff5,0xfff8fff6,0xfff9fff9,0xfffafffa,0xfffbfffa,
-0xfffbfffb,0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffefffe,0xfffffffd,0xfffffffe,0xfffefffe,
-0xffffffff,0xffff0000,0x00000000,0xffff0000,0x00000000,0x0002ffff,0x00010000,0x00000001,
-0x00010001,0x00030001,0x00040003,0x00030002,0x00030003,0x00040004,0x00050006,0x00060007,
-0x00080007,0x00080007,0x00080006,0x00090008,0x00090009,0x00090009,0x00080008,0x0008000b,
-0x00090009,0x0009000b,0x00090009,0x00090009,0x00080009,0x00090008,0x00090008,0x00090008,
-0x00090007,0x00080008,0x00080009,0x00090008,0x00080008,0x00090009,0x00080008,0x0009000a,
-0x000a0008,0x000b000a,0x000a000b,0x000b000b,0x000b000b,0x000c000b,0x000c000b,0x000c000a,
-0x000c000d,0x000c000e,0x000c000e,0x000e000d,0x000d000d,0x000e000d,0x000e000c,0x000d000c,
-0x000d000c,0x000c000c,0x000c000c,0x000c000a,0x000b000a,0x000a0009,0x00090009,0x0007000b,
-0x0005000a,0x00060007,0x00060007,0x00060006,0x00030004,0x00030003,0x00010001,0x00000000,
-0x00030000,0xffffffff,0xffffffff,0xfffffffe,0xfffdffff,0xfffd0000,0xfffdfffe,0xfffefffe,
-0xfffcfffa,0xfffefffc,0xfffcfffc,0xfffbfffb,0xfffdfffc,0xfffcfffb,0xfffcfffd,0xfffbfffe,
-0xfffdfffd,0xffffffff,0xfffefffd,0x0000ffff,0xffffffff,0x00000000,0x00010000,0x00010000,
-0x00020001,0x00010001,0x0000ffff,0x0000ffff,0x00000000,0x00000000,0xfffe0000,0xffffffff,
-0xfffffffe,0xfffdfffe,0xfffdfffe,0xfffcfffd,0xfffbfffc,0xfffbfffc,0xfffcfffb,0xfffcfffc,
-0xfffbfffb,0xfffdfffb,0xfffdfffc,0xfffdfffc,0xfffcfffb,0xfffcfffc,0xfffbfffa,0xfffafffb,
-0xfffafffa,0xfffbfffb,0xfffafffa,0xfff9fffa,0xfffbfffa,0xfffafff9,0xfffafffb,0xfffafffa,
-0xfff9fff9,0xfff8fff8,0xfffafff8,0xfffafffa,0xfff8fff9,0xfff8fff8,0xfff8fff8,0xfff9fff9,
-0xfffbfffb,0xfffafffa,0xfffbfffa,0xfffbfffc,0xfffefffe,0xffffffff,0xffffffff,0x00000000,
-0x00000001,0x00020001,0x00020001,0x00030003,0x00020004,0x00010004,0x00020004,0x00030003,
-0x00030003,0x00020002,0x00010002,0x00000000,0x0001ffff,0x00020002,0x00000001,0x00010000,
-0x00000000,0xffffffff,0x0000ffff,0x00000000,0xffff0000,0xfffefffe,0xfffcfffe,0xfffcfffc,
-0xfffefffb,0xfffcfffc,0xfffafffc,0xfff9fffb,0xfffafffa,0xfff9fff9,0xfffbfff9,0xfffafffa,
-0xfffafffb,0xfffbfffb,0xfffafffb,0xfffafffa,0xfffbfffb,0xfffcfffa,0xfffcfffb,0xfffdfffd,
-0xfffefffd,0xfffefffd,0xfffffffe,0x0000fffe,0x0001ffff,0x00010000,0x0000ffff,0x0000ffff,
-0x00010002,0x00020002,0x00010002,0x00010000,0x00000000,0x00010001,0x00000000,0x00010000,
-0x00020000,0x00030002,0x00000002,0x00000001,0x00010001,0x00010002,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00010001,0xfffffffe,0xfffefffe,0x0000ffff,0xfffdfffd,0xfffefffd,
-0xfffcfffc,0xfffbfffb,0xfffdfffb,0xfffafffa,0xfffafffa,0xfff9fffa,0xfff8fffa,0xfff6fff8,
-0xfff7fff6,0xfff6fff6,0xfff5fff6,0xfff5fff6,0xfff6fff7,0xfff6fff7,0xfff6fff6,0xfff8fff7,
-0xfff8fff6,0xfff9fff8,0xfffafff9,0xfffafff9,0xfffafffa,0xfffcfffc,0xfffcfffc,0xfffdfffe,
-0xfffefffe,0xfffffffe,0x0000fffe,0x0001ffff,0x00010000,0x00000002,0xffff0000,0x00010001,
-0x00000001,0x00000000,0x00000000,0xfffe0001,0xfffdffff,0xfffdffff,0xfffcfffe,0xfffcfffd,
-0xfffcfffd,0xfffcfffd,0xfffdfffe,0xfffcfffe,0xfffcfffe,0xfffcfffe,0xfffbfffd,0xfffdfffb,
-0xfffefffc,0xfffefffe,0xfffefffd,0xffffffff,0x0000ffff,0xffffffff,0x0002fffe,0x00010001,
-0x00010002,0x00010001,0x00000002,0x00010003,0x00040004,0x00050004,0x00060004,0x00060004,
-0x00060005,0x00070007,0x00070008,0x00080007,0x00070009,0x00070005,0x00090008,0x00090009,
-0x00080009,0x000a0009,0x000a0009,0x0009000a,0x0009000c,0x000b000a,0x000b000c,0x000b000b,
-0x000a000a,0x000b0009,0x000b000c,0x000a000b,0x00090009,0x00080009,0x00090009,0x00080008,
-0x00080008,0x00070007,0x00070007,0x00080006,0x00050007,0x00050007,0x00040005,0x00020003,
-0x00030002,0x00020003,0x00040002,0x00030002,0x00010002,0x00020001,0x00030003,0x00020002,
-0x00020003,0x00030004,0x00030003,0x00030003,0x00030004,0x00030004,0x00040005,0x00060006,
-0x00060006,0x00070005,0x00080007,0x00090007,0x00080007,0x00080008,0x00090008,0x0009000a,
-0x0009000a,0x0009000b,0x0009000a,0x00090009,0x00090009,0x0009000a,0x00080007,0x00090008,
-0x00070009,0x00080006,0x00070006,0x00070005,0x00060005,0x00040003,0x00010004,0x00000002,
-0x00010001,0xfffeffff,0xfffdffff,0xfffefffe,0xfffdfffe,0xfffcfffc,0xfffbfffc,0xfffbfffb,
-0xfffbfffc,0xfffafffc,0xfff8fffb,0xfff9fffa,0xfffafff9,0xfffafffb,0xfff9fff9,0xfffbfffa,
-0xfffcfff9,0xfffbfffa,0xfffafff9,0xfffbfff9,0xfffafffa,0xfffafff8,0xfff9fffa,0xfff9fffa,
-0xfffafffb,0xfff9fffa,0xfffafffb,0xfff9fffd,0xfff8fffa,0xfff6fff8,0xfff8fff8,0xfff8fff6,
-0xfff7fff6,0xfff6fff6,0xfff6fff5,0xfff6fff6,0xfff6fff5,0xfff5fff6,0xfff5fff6,0xfff4fff6,
-0xfff5fff6,0xfff5fff5,0xfff6fff5,0xfff6fff6,0xfff5fff5,0xfff6fff6,0xfff7fff7,0xfff8fff7,
-0xfff6fff7,0xfff6fff5,0xfff6fff6,0xfff5fff5,0xfff6fff4,0xfff6fff4,0xfff6fff4,0xfff6fff5,
-0xfff6fff5,0xfff4fff4,0xfff3fff4,0xfff2fff4,0xfff3fff2,0xfff4fff3,0xfff3fff3,0xfff3fff3,
-0xfff3fff3,0xfff2fff4,0xfff3fff2,0xfff4fff3,0xfff4fff3,0xfff4fff5,0xfff5fff5,0xfff7fff6,
-0xfff8fff8,0xfff9fff9,0xfffafff8,0xfffbfffa,0xfffbfffb,0xfffcfffc,0xfffdfffd,0xfffefffe,
-0xfffdffff,0xfffffffe,0x0000ffff,0x0001ffff,0x00010002,0x00020001,0x00020000,0x00020001,
-0x00000003,0x00000001,0x0000ffff,0x00000000,0xffff0000,0x0000ffff,0x0000ffff,0xfffcfffe,
-0xfffeffff,0xfffdffff,0xfffcfffd,0xfffdfffd,0xfffeffff,0xfffdffff,0xfffeffff,0xffffffff,
-0x0000ffff,0x0000fffe,0xffffffff,0x00020000,0x00020001,0x00030003,0x00030003,0x00020002,
-0x00020002,0x00040004,0x00040005,0x00040006,0x00050006,0x00070005,0x00070006,0x00050006,
-0x00060007,0x00050007,0x00040006,0x00050007,0x00060005,0x00080008,0x00080008,0x000a0008,
-0x00090008,0x000a0009,0x000a000a,0x0009000a,0x000b000b,0x000a000c,0x000b000c,0x000c000b,
-0x000b000c,0x000b000c,0x000b000b,0x000b000b,0x000a0008,0x0009000a,0x00090008,0x00090009,
-0x00080009,0x0009000a,0x00070007,0x00070006,0x00060007,0x00060006,0x00050004,0x00030004,
-0x00020003,0x00040004,0x00030004,0x00050003,0x00060004,0x00040005,0x00040004,0x00040004,
-0x00020005,0x00030004,0x00030005,0x00020005,0x00050004,0x00040005,0x00030003,0x00040005,
-0x00030004,0x00020004,0x00030003,0x00030003,0x00050004,0x00040003,0x00050004,0x00060005,
-0x00050004,0x00040004,0x00050005,0x00030005,0x00030005,0x00040004,0x00020002,0x00030003,
-0x00020004,0x00010002,0x00010001,0x00010002,0x00010000,0x00000001,0xfffe0001,0xfffefffe,
-0xfffefffe,0xfffefffd,0xfffffffd,0xfffcfffd,0xfffbfffd,0xfffbfffc,0xfffbfffa,0xfff9fffa,
-0xfffafff9,0xfffafff9,0xfffafffb,0xfff9fffb,0xfffafffa,0xfffafff9,0xfffcfff9,0xfffbfffa,
-0xfff9fff9,0xfffcfffa,0xfff9fff9,0xfffbfff9,0xfffbfffb,0xfffcfffb,0xfffcfffd,0xfffcfffc,
-0xfffdfffd,0xfffffffd,0xfffefffd,0xfffeffff,0xfffeffff,0x0000ffff,0x00000000,0x00000001,
-0x00000000,0xffff0000,0x00020001,0x00020002,0x00020002,0x00010001,0x00000002,0x00010001,
-0x00000002,0x00000000,0xffffffff,0xfffeffff,0x0000ffff,0xfffefffd,0xfffdfffd,0xfffdfffe,
-0xfffcfffd,0xfffdfffc,0xfffbfffe,0xfffafffc,0xfffbfffa,0xfffafffa,0xfffbfffa,0xfffcfffb,
-0xfffbfffa,0xfffbfffb,0xfffbfffb,0xfffdfffc,0xfffdfffd,0xfffefffd,0xfffdffff,0x0000fffe,
-0x00000000,0x00000001,0x00020001,0x00020000,0x00010001,0x00020001,0x00020002,0x00030003,
-0x00020002,0x00020002,0x00020003,0x00020003,0x00020002,0x00030002,0x00030003,0x00020001,
-0x0000ffff,0xffff0000,0xfffffffd,0xffffffff,0xffff0000,0xfffefffe,0xfffcfffc,0xfffbfffc,
-0xfffdfffb,0xfffdffff,0xfffdfffe,0xfffcfffd,0xfffafffc,0xfffafffb,0xfffbfffb,0xfffbfffa,
-0xfffcfffc,0xfffafff9,0xfffbfff9,0xfffbfffa,0xfffbfffb,0xfffbfffb,0xfffafffa,0xfffafffc,
-0xfffbfffb,0xfffbfffc,0xfffafffb,0xfffbfffc,0xfffcfffc,0xfffefffc,0xfffdfffc,0xfffcfffb,
-0xfffcfffc,0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffcfffd,0xfffdfffc,0xfffefffd,0xfffcfffd,
-0xfffbfffb,0xfffefffc,0xfffdfffd,0xfffdfffd,0xfffcfffe,0xfffdfffe,0xfffdfffe,0xfffcfffe,
-0xfffdfffd,0xfffdfffc,0xfffdfffe,0xfffbfffd,0xfffbfffc,0xfffbfffa,0xfffcfffc,0xfffbfffa,
-0xfffafffa,0xfffcfffb,0xfffafffb,0xfffafff9,0xfffafffa,0xfff9fffb,0xfff9fffa,0xfffafffa,
-0xfffafffb,0xfffbfffb,0xfffcfffa,0xfffafffb,0xfffbfffa,0xfffafffc,0xfffbfffb,0xfffcfffc,
-0xfffbfffc,0xfffdfffd,0xfffdfffe,0xfffefffe,0xfffdfffe,0xffffffff,0xfffffffe,0xfffffffe,
-0xfffefffe,0xffffffff,0x00000000,0x00000000,0x00000001,0x00010000,0x00040003,0x00020002,
-0x00030001,0x00030002,0x00030002,0x00040003,0x00040003,0x00050003,0x00040003,0x00040005,
-0x00030003,0x00040004,0x00040005,0x00040003,0x00020002,0x00030003,0x00020003,0x00030004,
-0x00040005,0x00040004,0x00040003,0x00040003,0x00060003,0x00030004,0x00040004,0x00040005,
-0x00040004,0x00040004,0x00060003,0x00050006,0x00050006,0x00050007,0x00050006,0x00080008,
-0x00070006,0x00070007,0x00080007,0x00070007,0x00080006,0x00060007,0x00070006,0x00070007,
-0x00060007,0x00060007,0x00070007,0x00060005,0x00060007,0x00060006,0x00070007,0x00080006,
-0x00080006,0x00090008,0x00090008,0x000a000b,0x00090009,0x00080009,0x000a0009,0x000a000a,
-0x000b000b,0x000a000c,0x000a000b,0x000c000b,0x000c000b,0x000b000a,0x000c000b,0x000a000a,
-0x000a000a,0x00090008,0x00070008,0x00050008,0x00060008,0x00050007,0x00050006,0x00050005,
-0x00050006,0x00040006,0x00040004,0x00030003,0x00040002,0x00010001,0x00010003,0x00020002,
-0x00010001,0x00010001,0x00010000,0xfffe0000,0xffffffff,0xfffefffe,0xfffefffe,0xfffffffc,
-0xfffdfffe,0xfffcfffd,0xfffbfffb,0xfffbfffc,0xfffcfffc,0xfffbfffb,0xfffcfffa,0xfffbfffa,
-0xfffafffb,0xfffafffa,0xfff7fffa,0xfff8fff8,0xfff8fffa,0xfff7fff7,0xfff7fff6,0xfff5fff7,
-0xfff6fff5,0xfff4fff5,0xfff6fff3,0xfff3fff3,0xfff2fff3,0xfff2fff2,0xfff4fff3,0xfff2fff2,
-0xfff0fff0,0xfff0fff2,0xfff2fff0,0xfff0ffef,0xfff1fff0,0xfff0fff0,0xfff1fff2,0xfff1fff0,
-0xfff1fff0,0xfff1fff2,0xfff1fff1,0xfff2fff2,0xfff2fff1,0xfff3fff3,0xfff4fff4,0xfff4fff4,
-0xfff3fff4,0xfff5fff5,0xfff5fff4,0xfff6fff6,0xfff7fff5,0xfff7fff7,0xfff7fff5,0xfff7fff5,
-0xfff6fff5,0xfff8fff6,0xfff8fff7,0xfff6fff7,0xfff7fff7,0xfff8fff8,0xfff9fffb,0xfff9fff9,
-0xfffbfff9,0xfffafffa,0xfffafff9,0xfff9fffa,0xfffcfffa,0xfffbfffb,0xfffdfffc,0xfffcfffc,
-0xfffefffc,0xfffffffd,0xfffefffd,0xfffdfffd,0xfffcfffd,0xfffbfffc,0xfffcfffc,0xfffafffb,
-0xfffcfffb,0xfffafffa,0xfffbfffc,0xfff9fffc,0xfffbfffb,0xfffcfffc,0xfffafffb,0xfffdfffb,
-0xfffdfffd,0xfffdfffd,0xfffefffe,0x0001fffe,0x00010000,0x00030000,0x00050002,0x00030003,
-0x00040004,0x00050004,0x00090005,0x00080007,0x00080008,0x00070008,0x000a0009,0x000c000a,
-0x000d000b,0x000a000b,0x000b000a,0x000b000c,0x000c000c,0x000c000c,0x000b000e,0x000c000d,
-0x000c000c,0x000c000b,0x000c000c,0x000d000c,0x000f000d,0x000e000c,0x000d000d,0x000e000d,
-0x000e000e,0x000f000e,0x000e000e,0x000e000e,0x000c000d,0x000c000e,0x000d000f,0x000c000e,
-0x000c000d,0x000b000b,0x000c000c,0x000b000b,0x0009000a,0x000a0009,0x000b0009,0x000a0008,
-0x000a0008,0x000a0008,0x000a0008,0x00080007,0x00080008,0x00080009,0x00080009,0x00060007,
-0x00080008,0x00080009,0x00080008,0x00090009,0x00070007,0x00070008,0x00070008,0x00070008,
-0x00060006,0x00060006,0x00060005,0x00050002,0x00040003,0x00020004,0x00020003,0x00020002,
-0x00000001,0x00000001,0xffffffff,0xffffffff,0xfffdfffe,0xfffcfffd,0xfffcfffc,0xfffbfffc,
-0xfffafffb,0xfff8fffa,0xfff8fff9,0xfff8fff9,0xfff8fff7,0xfff7fff7,0xfff6fff6,0xfff5fff6,
-0xfff4fff4,0xfff5fff4,0xfff4fff3,0xfff4fff4,0xfff4fff4,0xfff6fff5,0xfff4fff4,0xfff4fff4,
-0xfff4fff2,0xfff5fff3,0xfff5fff4,0xfff5fff4,0xfff4fff5,0xfff5fff6,0xfff7fff5,0xfff7fff6,
-0xfff8fff8,0xfff7fff7,0xfff8fff8,0xfff9fff9,0xfff9fff9,0xfffafffa,0xfffafffa,0xfffafffb,
-0xfffbfffa,0xfffafffa,0xfffafffa,0xfffafffb,0xfffcfffb,0xfffcfffa,0xfffbfffa,0xfffafffb,
-0xfffbfffb,0xfffbfffa,0xfffbfffb,0xfffafffb,0xfff8fff8,0xfff9fff9,0xfff8fff7,0xfff9fff8,
-0xfff9fff8,0xfff9fff9,0xfff8fff8,0xfff8fff8,0xfff7fffa,0xfff7fff9,0xfff8fff9,0xfff8fff9,
-0xfff8fff9,0xfff8fff9,0xfffbfffa,0xfffcfffc,0xfffafffc,0xfffcfffb,0xfffffffb,0xfffffffd,
-0xfffefffe,0x0000fffe,0x0001ffff,0x00000002,0x00030001,0x00040003,0x00020004,0x00050004,
-0x00050005,0x00060006,0x00070005,0x00080008,0x00070007,0x00070006,0x00090008,0x00090009,
-0x00090009,0x00090009,0x00090009,0x000a000a,0x0009000b,0x000a0008,0x00090009,0x0008000a,
-0x00080009,0x00080008,0x00080007,0x00070007,0x00050007,0x00060005,0x00050005,0x00070004,
-0x00060005,0x00050004,0x00040005,0x00040004,0x00050005,0x00030005,0x00030004,0x00030006,
-0x00030004,0x00020004,0x00040002,0x00030002,0x00020002,0x00040001,0x00050005,0x00020004,
-0x00020003,0x00040003,0x00050005,0x00040004,0x00050005,0x00040005,0x00040004,0x00060005,
-0x00060005,0x00050005,0x00040004,0x00040004,0x00050005,0x00060004,0x00050004,0x00040003,
-0x00040004,0x00020001,0x00010001,0x00010001,0xffff0002,0xfffeffff,0xfffefffe,0xfffbfffc,
-0xfff9fffb,0xfff9fffa,0xfff9fff8,0xfff7fff7,0xfff5fff6,0xfff5fff5,0xfff4fff3,0xfff4fff4,
-0xfff4fff4,0xfff4fff3,0xfff3fff4,0xfff3fff4,0xfff3fff5,0xfff4fff4,0xfff3fff4,0xfff6fff6,
-0xfff6fff5,0xfff5fff6,0xfff5fff4,0xfff5fff7,0xfff6fff5,0xfff8fff7,0xfff8fff7,0xfff8fff7,
-0xfff8fff8,0xfff8fff7,0xfff7fff8,0xfff8fff8,0xfff8fff8,0xfff8fff8,0xfff8fff8,0xfff7fff7,
-0xfff8fff7,0xfff9fff8,0xfffafffa,0xfffafff9,0xfffbfffa,0xfffbfffa,0xfffbfffb,0xfffbfffd,
-0xfffdfffc,0xfffefffd,0xfffdfffc,0xfffdffff,0xfffeffff,0xfffefffe,0x0000ffff,0xffffffff,
-0x0000ffff,0xffffffff,0x0000ffff,0xfffffffe,0x0000ffff,0xfffeffff,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffcffff,0xfffcfffe,0xfffdfffc,0xfffbfffd,0xfffbfffd,0xfffcfffe,0xfffcfffd,
-0xfffdfffd,0xfffffffd,0x0000fffd,0xfffffffd,0x0000ffff,0x00000000,0x00010001,0x00010001,
-0x00010002,0x00030003,0x00020004,0x00050005,0x00060005,0x00050004,0x00060005,0x00060005,
-0x00070006,0x00080007,0x00070008,0x00070009,0x00070009,0x00080009,0x00090008,0x00090008,
-0x000a0009,0x0008000a,0x00070008,0x00070007,0x000a0008,0x00090009,0x00090008,0x00090007,
-0x00090008,0x00090009,0x00080008,0x00080008,0x00080009,0x00070006,0x00070006,0x00070007,
-0x00050005,0x00070005,0x00070007,0x00050007,0x00060007,0x00060007,0x00070006,0x00060006,
-0x00060006,0x00060006,0x00070006,0x00060007,0x00060006,0x00070007,0x00060006,0x00060007,
-0x00060007,0x00060008,0x00080007,0x00060008,0x00060007,0x00050007,0x00050007,0x00040007,
-0x00050006,0x00040007,0x00050007,0x00050005,0x00070004,0x00050002,0x00040003,0x00060003,
-0x00030003,0x00030003,0x00020004,0x00030001,0x00030002,0x00020003,0x00010002,0x00010002,
-0x00010002,0x00010000,0x00010000,0x00000000,0x00000001,0xffff0001,0xfffeffff,0xffff0000,
-0xfffe0000,0xfffeffff,0x0001fffe,0xfffffffe,0xfffffffd,0xfffefffd,0xfffefffe,0xfffdfffe,
-0xfffcfffd,0xfffbfffd,0xfffbfffd,0xfffdfffd,0xfffbfffd,0xfffafffd,0xfffafffb,0xfffafffc,
-0xfff9fffb,0xfff8fff9,0xfff8fff9,0xfff8fff7,0xfff7fff7,0xfff6fff7,0xfff7fff6,0xfff6fff5,
-0xfff5fff5,0xfff4fff4,0xfff6fff5,0xfff3fff4,0xfff2fff3,0xfff2fff4,0xfff3fff2,0xfff1fff3,
-0xfff2fff2,0xfff0fff2,0xfff3fff3,0xfff5fff4,0xfff4fff3,0xfff2fff4,0xfff3fff3,0xfff3fff5,
-0xfff3fff4,0xfff2fff2,0xfff4fff2,0xfff1fff3,0xfff2fff3,0xfff2fff2,0xfff3fff2,0xfff3fff3,
-0xfff3fff3,0xfff4fff3,0xfff3fff3,0xfff3fff3,0xfff3fff3,0xfff2fff2,0xfff4fff3,0xfff3fff3,
-0xfff3fff3,0xfff3fff4,0xfff5fff6,0xfff6fff5,0xfff5fff6,0xfff7fff7,0xfff8fff6,0xfff9fff7,
-0xfff8fff8,0xfffbfff9,0xfffbfffb,0xfffcfffb,0xfffdfffd,0xfffdfffe,0xfffefffe,0x0000ffff,
-0xffff0001,0xffffffff,0x0001ffff,0x00010000,0x00010001,0x00020001,0x00030001,0x00030001,
-0x00010001,0x00020001,0x00020003,0x00040002,0x00030003,0x00030003,0x00040004,0x00040005,
-0x00050006,0x00060005,0x00050006,0x00070006,0x00060006,0x00070006,0x00080007,0x00080008,
-0x00080008,0x00090008,0x00090008,0x00090009,0x00090007,0x00090008,0x0009000a,0x0009000a,
-0x00090009,0x000a000b,0x000c000b,0x000a000c,0x000a000b,0x000a000a,0x000b000a,0x000b000a,
-0x000c000a,0x000b000a,0x000b000b,0x000a000b,0x000c000b,0x000c000a,0x000c000b,0x000b000c,
-0x000b0009,0x000a000b,0x000b0009,0x000b000a,0x000b000a,0x000d000c,0x000c000c,0x000f000d,
-0x000d000d,0x000e000d,0x000c000c,0x000b000c,0x000b000c,0x000a000a,0x000b000a,0x0009000a,
-0x0009000b,0x0008000a,0x00090009,0x00060007,0x00050007,0x00030005,0x00030003,0x00030002,
-0x00020002,0xffff0001,0xfffe0000,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffffffe,
-0xfffdfffd,0xfffdfffe,0xfffefffe,0xfffffffd,0xfffdfffd,0xffffffff,0xffffffff,0xfffefffe,
-0xfffeffff,0xfffeffff,0xfffdfffe,0xfffefffd,0xfffffffd,0xfffefffe,0xfffdffff,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffdfffc,0xfffefffe,0xfffcfffc,0xfffdfffe,0xfffafffc,0xfffbfffc,
-0xfffcfffb,0xfffbfffb,0xfff8fff9,0xfff7fff8,0xfff7fff6,0xfff5fff7,0xfff4fff6,0xfff3fff3,
-0xfff4fff3,0xfff3fff3,0xfff1fff3,0xfff3fff2,0xfff3fff1,0xfff0fff0,0xfff0fff1,0xffeffff1,
-0xfff0fff0,0xfff0fff1,0xffeffff1,0xfff2ffef,0xfff2fff1,0xfff2fff1,0xfff2fff3,0xfff2fff2,
-0xfff3fff3,0xfff4fff4,0xfff5fff4,0xfff6fff5,0xfff7fff7,0xfff8fff6,0xfff8fff9,0xfffafff9,
-0xfffbfff9,0xfffbfffa,0xfffcfffa,0xfffdfffc,0xfffcfffc,0xfffefffd,0xfffefffd,0xfffffffe,
-0xfffe0000,0x00000000,0x00010001,0x00020001,0x00020001,0x00010003,0x00020002,0x00030002,
-0x00020003,0x00040003,0x00040003,0x00040003,0x00050003,0x00060004,0x00050003,0x00060003,
-0x00040004,0x00040003,0x00020003,0x00020005,0x00030005,0x00020004,0x00030005,0x00040003,
-0x00030002,0x00040003,0x00030003,0x00030003,0x00040004,0x00030002,0x00040002,0x00050005,
-0x00050005,0x00070005,0x00070006,0x00070006,0x00070007,0x00090007,0x00090007,0x000a0008,
-0x00090008,0x00080008,0x00090009,0x000a0009,0x00090009,0x000a0009,0x00090009,0x000b000b,
-0x0009000b,0x000a0009,0x000a000b,0x00070008,0x00070007,0x00080008,0x00070008,0x00050005,
-0x00050005,0x00040004,0x00020005,0x00010003,0x00000002,0x00010001,0x00000001,0x00000000,
-0xffff0000,0xfffefffe,0xfffffffe,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffdffff,
-0xfffdfffe,0xfffffffe,0xfffefffe,0xfffefffe,0xffff0000,0xfffeffff,0xfffffffe,0xfffefffe,
-0xfffdffff,0xfffeffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffd,0xfffefffe,
-0xfffcfffe,0xfffcfffc,0xfffcfffc,0xfffafffc,0xfffbfffa,0xfffcfffc,0xfffafffa,0xfffafff9,
-0xfff9fff8,0xfff8fff8,0xfff8fff9,0xfff8fff8,0xfff7fff7,0xfff7fff6,0xfff7fff8,0xfff6fff6,
-0xfff6fff5,0xfff5fff6,0xfff5fff6,0xfff6fff6,0xfff7fff6,0xfff4fff5,0xfff4fff3,0xfff5fff6,
-0xfff4fff6,0xfff7fff7,0xfff7fff7,0xfff8fff7,0xfff7fff6,0xfff7fff7,0xfff8fff8,0xfffafff7,
-0xfff9fff7,0xfff9fff9,0xfffafffa,0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffcfffa,0xfffcfffa,
-0xfffafffc,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffdfffe,0xfffefffd,0xfffcfffd,0xfffcfffb,0xfffcfffc,0xfffdfffd,0xfffcfffd,0xfffdfffd,
-0xfffefffe,0xfffefffd,0xffffffff,0xffffffff,0x0000ffff,0x00000001,0x00010002,0x00000001,
-0x00010002,0x00010001,0x00010001,0x00020001,0x00020000,0x00000002,0x00010000,0x00020002,
-0x00030002,0x00040001,0x00040003,0x00020003,0x00040003,0x00050004,0x00050003,0x00040005,
-0x00060004,0x00060005,0x00060007,0x00060007,0x00050006,0x00060007,0x00060008,0x00070007,
-0x00070007,0x00070008,0x00090007,0x00090008,0x00080009,0x00090009,0x000a0009,0x00090009,
-0x00090009,0x00090009,0x00090009,0x00080007,0x00070008,0x00090007,0x000a0008,0x00080008,
-0x0009000a,0x00090009,0x00080009,0x00080009,0x00080009,0x00070008,0x00080007,0x00080006,
-0x00080007,0x00070007,0x00070006,0x00060007,0x00060007,0x00060007,0x00050007,0x00050006,
-0x00060006,0x00050007,0x00060005,0x00060005,0x00050005,0x00060005,0x00060004,0x00040004,
-0x00030003,0x00030003,0x00050005,0x00050005,0x00060003,0x00060005,0x00040004,0x00030004,
-0x00030004,0x00020003,0x00020003,0x00000002,0x00010002,0x00020001,0x00020002,0x00010003,
-0x00010002,0x00000000,0x00000001,0x00000000,0xffffffff,0xfffdfffe,0xfffcfffd,0xfffcfffe,
-0xfffcfffd,0xfffbfffc,0xfffafffb,0xfffafffb,0xfffbfffa,0xfff9fffb,0xfffafffa,0xfffafff9,
-0xfffafffa,0xfff9fff9,0xfff9fff7,0xfff7fff6,0xfff6fff6,0xfff6fff5,0xfff8fff6,0xfff7fff7,
-0xfff7fff6,0xfff8fff5,0xfff7fff6,0xfff7fff6,0xfff6fff7,0xfff6fff5,0xfff6fff7,0xfff7fff7,
-0xfff7fff8,0xfff7fff8,0xfff6fff8,0xfff7fff6,0xfff8fff7,0xfff8fff8,0xfff7fff8,0xfff9fff8,
-0xfff9fff8,0xfffbfff9,0xfff9fff9,0xfffbfff9,0xfff9fffa,0xfff9fffa,0xfffbfffb,0xfffafffa,
-0xfff9fff9,0xfffafffa,0xfffafff9,0xfff9fff9,0xfff8fff9,0xfff8fff9,0xfff9fff9,0xfffafff9,
-0xfff8fff9,0xfff9fff8,0xfff9fff9,0xfff9fff9,0xfff9fff9,0xfff9fff9,0xfffafff8,0xfffafffb,
-0xfffafffc,0xfffafffb,0xfff9fffc,0xfff9fffb,0xfffcfffb,0xfffcfffb,0xfffcfffc,0xfffdfffc,
-0xfffefffe,0xfffdfffd,0xfffefffc,0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffeffff,0xfffdfffd,
-0xfffdfffd,0xfffefffe,0xfffeffff,0xfffe0000,0xffffffff,0x00000000,0x00010000,0x00020001,
-0x00030001,0x00040001,0x00040003,0x00060003,0x00050004,0x00060005,0x00070004,0x00060005,
-0x00070007,0x00060006,0x00060006,0x00060007,0x00070008,0x00060007,0x00050008,0x00040007,
-0x00070004,0x00060005,0x00050006,0x00050006,0x00070004,0x00060004,0x00050005,0x00060004,
-0x00040005,0x00050005,0x00050004,0x00040005,0x00040004,0x00050004,0x00060004,0x00050004,
-0x00040006,0x00050005,0x00040004,0x00040005,0x00040005,0x00050004,0x00050005,0x00050006,
-0x00060005,0x00060006,0x00030007,0x00050005,0x00040006,0x00050005,0x00050005,0x00030005,
-0x00040005,0x00020005,0x00020003,0x00030004,0x00020003,0x00020003,0x00010003,0x00010001,
-0x00010001,0x0002ffff,0x0000ffff,0xfffffffe,0xffff0000,0x0000ffff,0xffff0000,0xfffdffff,
-0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffefffb,0xfffffffb,0xfffefffd,0xfffeffff,0xfffefffd,
-0xfffefffc,0xfffefffd,0xfffefffd,0xfffffffe,0xfffdffff,0xfffefffe,0xfffefffe,0xfffdfffd,
-0xfffffffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xfffcfffd,0xfffefffe,0xfffdfffe,0xfffdffff,
-0xfffffffd,0xfffffffe,0xfffdfffc,0xfffefffc,0xfffdfffc,0xfffbfffb,0xfffbfffa,0xfffafffb,
-0xfffafffa,0xfffbfff9,0xfffafffa,0xfffafffb,0xfffbfffa,0xfffafffa,0xfffafffa,0xfffafffa,
-0xfffafffa,0xfffafffa,0xfffafffb,0xfffafffa,0xfff8fff9,0xfff9fffa,0xfff9fffa,0xfff9fffa,
-0xfff9fffa,0xfff9fff9,0xfffafffc,0xfffbfffb,0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffdfffd,
-0xfffefffe,0x0000fffd,0x00020000,0x00010000,0x00010001,0x00000002,0x00020003,0x00000003,
-0x00040004,0x00040003,0x00040003,0x00030002,0x00040004,0x00040004,0x00040005,0x00040004,
-0x00050004,0x00040005,0x00040005,0x00050005,0x00050004,0x00060005,0x00040005,0x00040003,
-0x00030003,0x00030004,0x00030004,0x00030004,0x00040002,0x00030002,0x00030003,0x00030004,
-0x00020002,0x00010003,0x00000002,0x00020001,0x00010001,0x00030001,0x00020001,0x00010002,
-0x00030001,0x00030001,0x00020002,0x00010000,0x00030002,0x00030003,0x00020004,0x00010003,
-0x00020003,0x00020002,0x00010000,0x00010001,0x00020001,0x00020001,0x00020001,0x00010000,
-0x00000000,0x0000ffff,0x0001ffff,0x00000000,0x00000000,0x00000001,0xffff0000,0x00000001,
-0xffffffff,0x00000000,0x0001ffff,0x00000000,0x00000000,0x00000001,0xffff0000,0xfffeffff,
-0xfffdfffd,0xfffdfffd,0x0000fffd,0xfffffffe,0xfffefffd,0xfffdfffc,0xfffdfffc,0xfffdfffd,
-0xfffcfffb,0xfffbfffb,0xfffbfffc,0xfffafffb,0xfffafff9,0xfffafffa,0xfffafff8,0xfffbfffa,
-0xfffafffa,0xfff9fffb,0xfff9fff9,0xfff9fffb,0xfffbfffa,0xfffafffb,0xfff9fff9,0xfffafff9,
-0xfffafff8,0xfffafff9,0xfffbfffb,0xfffbfffc,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffcfffd,
-0xfffcfffd,0xfffdfffd,0xfffffffd,0xfffefffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xffffffff,
-0xfffefffe,0xfffcfffc,0xfffdfffc,0xfffcfffb,0xfffbfffc,0xfffbfffb,0xfffcfffb,0xfffbfffc,
-0xfffbfffb,0xfffafffa,0xfffcfffc,0xfffbfffc,0xfffcfffa,0xfffdfffb,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffb,0xfffdfffb,0xfffcfffd,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,0x00010001,0x00000000,0x00000000,0xffff0000,
-0x00000000,0x00010002,0x00010002,0x00010003,0x00010002,0x00020003,0x00020003,0x00030002,
-0x00020002,0x00040004,0x00050004,0x00040004,0x00060005,0x00050005,0x00060006,0x00060008,
-0x00060006,0x00060006,0x00060005,0x00070005,0x00070006,0x00080006,0x00060007,0x00060005,
-0x00050005,0x00050004,0x00040006,0x00040005,0x00030007,0x00040005,0x00040005,0x00040004,
-0x00050004,0x00050004,0x00040005,0x00020003,0x00030003,0x00040003,0x00040004,0x00040002,
-0x00040004,0x00050004,0x00050003,0x00050004,0x00040004,0x00040004,0x00040004,0x00030004,
-0x00060004,0x00040004,0x00040004,0x00040004,0x00040004,0x00050005,0x00040005,0x00040003,
-0x00040004,0x00040003,0x00030004,0x00040004,0x00040004,0x00030003,0x00030003,0x00040003,
-0x00030004,0x00030003,0x00030002,0x00020003,0x00010002,0x00000000,0x00000000,0x0000ffff,
-0xfffffffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffdfffd,0xfffcfffb,
-0xfffcfffc,0xfffbfffc,0xfffbfffd,0xfffbfffc,0xfffcfffb,0xfffcfffc,0xfffbfffb,0xfffcfffc,
-0xfffbfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffbfffc,0xfffcfffb,0xfffcfffc,0xfffdfffc,
-0xfffdfffd,0xfffdfffe,0xfffffffe,0xfffdffff,0xfffefffd,0xfffffffe,0x00000000,0x0000ffff,
-0x00000000,0x00000001,0x0000ffff,0x00010000,0x00010000,0x0001ffff,0x00000001,0x00000001,
-0x00000000,0x00010001,0xfffeffff,0xfffefffe,0xfffdffff,0xfffeffff,0xfffcfffe,0xfffcfffe,
-0xfffbfffc,0xfffdfffd,0xfffcfffd,0xfffbfffb,0xfffbfffa,0xfffbfffa,0xfffbfffa,0xfffbfffa,
-0xfffbfffa,0xfffdfffa,0xfffdfffd,0xfffcfffc,0xfffdfffb,0xfffefffd,0xfffdfffd,0xfffdfffc,
-0xfffefffe,0x0001ffff,0x00000000,0x00000001,0x00010001,0x00010001,0x00010001,0x00020000,
-0x00010002,0x00020002,0x00010002,0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,
-0x00000000,0xfffe0000,0xfffeffff,0xfffdfffe,0xfffefffd,0xfffdfffd,0xfffbfffb,0xfffafffb,
-0xfffafffb,0xfffafffa,0xfffcfffb,0xfffbfffb,0xfffcfff9,0xfffafffa,0xfffafffb,0xfff9fffa,
-0xfffafffc,0xfffbfffc,0xfffbfffb,0xfffbfffb,0xfffcfffb,0xfffcfffc,0xfffbfffa,0xfffdfffd,
-0xfffcfffe,0xfffcfffd,0xfffcfffe,0xfffdfffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffffffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xffff0000,0xffffffff,0xfffffffe,
-0xfffffffd,0x0000ffff,0x0000ffff,0x0000ffff,0xfffefffe,0xffffffff,0xfffffffe,0xffffffff,
-0x0000fffe,0xffff0000,0xfffdfffe,0xfffefffe,0x0000ffff,0xfffe0000,0xfffffffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffbfffc,0xfffcfffb,0xfffefffd,0xfffdfffd,
-0xfffefffc,0xfffbfffb,0xfffdfffc,0xfffdfffc,0xfffcfffb,0xfffcfffa,0xfffcfffb,0xfffcfffb,
-0xfffcfffc,0xfffdfffc,0xfffdfffb,0xfffefffd,0xfffeffff,0xfffdfffd,0xfffefffe,0xfffffffe,
-0xfffffffe,0xffffffff,0xfffeffff,0xffff0001,0xffff0001,0x00010000,0x00000001,0x00000001,
-0x00010002,0x00020001,0x00020003,0x00020002,0x00030001,0x00020001,0x00030003,0x00040003,
-0x00030003,0x00040004,0x00020005,0x00010003,0x00020003,0x00020002,0x00030002,0x00040002,
-0x00030002,0x00030002,0x00020002,0x00010002,0x00020001,0x00020001,0x00030002,0x00020002,
-0x00030002,0x00040004,0x00040003,0x00050005,0x00030004,0x00040004,0x00050005,0x00060005,
-0x00060007,0x00070008,0x00060007,0x00070007,0x00080009,0x00070008,0x00070007,0x00080007,
-0x00080006,0x00080007,0x00080007,0x00090007,0x00090006,0x00080005,0x00070007,0x00060007,
-0x00070006,0x00080008,0x00080008,0x00070006,0x00070006,0x00060006,0x00070008,0x00080007,
-0x00070007,0x00080008,0x00070008,0x00080008,0x00080009,0x00090009,0x0009000a,0x00090009,
-0x00070006,0x00060005,0x00060006,0x00050004,0x00040003,0x00040004,0x00020002,0x00020002,
-0x00010002,0x00000000,0xffff0000,0xffffffff,0xfffeffff,0xffffffff,0xfffffffe,0xfffefffe,
-0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffffffd,0xfffefffe,0xfffefffd,0xfffffffd,0xffffffff,
-0xfffefffe,0xfffe0000,0xfffe0001,0xfffe0001,0x00000001,0x00010001,0x00010001,0x0000ffff,
-0x0001ffff,0x00000000,0x00000001,0xffff0000,0x00000000,0x0000ffff,0xffffffff,0xfffeffff,
-0xfffcfffd,0xfffdfffd,0xfffdfffc,0xfffcfffc,0xfffbfffc,0xfffbfffa,0xfffafffc,0xfffafffa,
-0xfff9fff9,0xfff9fffb,0xfff8fffa,0xfff6fff7,0xfff8fff8,0xfff8fff8,0xfff6fff8,0xfff6fff7,
-0xfff5fff6,0xfff6fff6,0xfff5fff5,0xfff7fff5,0xfff7fff5,0xfff6fff6,0xfff5fff6,0xfff6fff6,
-0xfff7fff5,0xfff7fff5,0xfff8fff6,0xfff6fff8,0xfff7fff8,0xfff7fff7,0xfff8fff7,0xfff9fff8,
-0xfff9fff7,0xfff7fff8,0xfff9fff8,0xfff8fff7,0xfff7fff8,0xfff6fff7,0xfff8fff8,0xfff9fff9,
-0xfffafff9,0xfffafffa,0xfffbfff9,0xfff9fff9,0xfff9fffa,0xfff9fffa,0xfffafffa,0xfff8fff9,
-0xfff9fff9,0xfff9fff9,0xfffafff9,0xfffafffb,0xfffafffa,0xfff9fff9,0xfff9fffa,0xfff9fffa,
-0xfff9fffa,0xfffbfffb,0xfffcfffb,0xfffbfffa,0xfffbfffa,0xfffbfffb,0xfffcfffc,0xfffcfffb,
-0xfffbfffb,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x00030000,0x00000002,0x00010001,0x00020000,0x00030001,0x00020001,
-0x00020001,0x00010002,0x00010002,0x00010001,0x00020002,0x00010002,0x00020002,0x00030003,
-0x00010003,0x00010002,0x00020002,0x00040003,0x00040002,0x00030002,0x00020002,0x00030002,
-0x00030003,0x00050004,0x00060004,0x00060003,0x00040004,0x00040003,0x00040004,0x00030004,
-0x00020004,0x00030003,0x00030003,0x00040003,0x00030004,0x00030004,0x00030004,0x00030004,
-0x00020003,0x00020004,0x00040002,0x00040002,0x00040002,0x00020002,0x00020002,0x00030003,
-0x00040003,0x00030004,0x00040004,0x00030004,0x00040004,0x00060005,0x00050006,0x00060004,
-0x00040005,0x00050005,0x00040004,0x00050004,0x00030005,0x00030003,0x00050005,0x00050004,
-0x00050003,0x00040004,0x00050004,0x00040004,0x00040004,0x00050003,0x00040003,0x00060003,
-0x00060006,0x00040006,0x00050004,0x00060005,0x00050006,0x00050005,0x00060007,0x00060006,
-0x00040005,0x00040005,0x00040005,0x00040004,0x00040004,0x00040003,0x00030003,0x00030002,
-0x00010002,0x00030002,0x00020002,0x00010001,0xffff0001,0xffff0000,0x00000001,0x00000001,
-0x00000001,0x00010001,0x00010002,0x00010001,0x00030001,0x00030002,0x00020002,0x00010000,
-0x00010001,0x00010002,0x00030002,0x00040003,0x00030002,0x00030001,0x00020003,0x00010001,
-0x00030002,0x00010002,0x00000001,0x00000000,0xffff0000,0xffffffff,0xfffeffff,0xfffefffe,
-0xfffcfffd,0xfffcfffb,0xfffcfffa,0xfffcfffc,0xfffbfffc,0xfffbfffb,0xfffbfffa,0xfffcfffb,
-0xfffbfffc,0xfffbfffd,0xfffbfffc,0xfffafffb,0xfffbfffb,0xfffbfffc,0xfffdfffc,0xfffcfffd,
-0xfffafffb,0xfffbfffc,0xfffafffc,0xfffbfffb,0xfffbfffb,0xfffafffb,0xfffbfffb,0xfffcfffb,
-0xfffafffb,0xfffafffa,0xfffbfffa,0xfffcfffb,0xfffcfffb,0xfffdfffb,0xfffcfffc,0xfffefffe,
-0xfffdfffd,0xfffdffff,0xfffdfffe,0xfffeffff,0xffff0000,0xfffdfffe,0x0000ffff,0x00000000,
-0xfffffffe,0x0000ffff,0xffff0001,0x00010000,0x00020001,0x00020001,0x00020002,0x00000001,
-0x00010000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,0xfffe0000,0xfffffffe,
-0x0000fffe,0xfffeffff,0xfffefffd,0xfffdfffc,0xfffdfffc,0xfffcfffd,0xfffdfffb,0xfffdfffc,
-0xfffcfffc,0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffcfffc,0xfffcfffd,0xfffeffff,0xfffdffff,
-0xfffeffff,0xfffffffe,0xffff0000,0xffff0001,0xffff0000,0x00000000,0x0000fffe,0x0001ffff,
-0x00000000,0x00010001,0x00000000,0x00010000,0xffffffff,0xffffffff,0xfffeffff,0xfffdffff,
-0xfffdfffe,0xfffcfffd,0xfffcfffc,0xfffbfffb,0xfffcfffc,0xfffbfffb,0xfffafffa,0xfff9fff9,
-0xfff8fff9,0xfff7fff9,0xfff8fff8,0xfff8fff9,0xfff7fffa,0xfff7fff9,0xfff7fff7,0xfff8fff7,
-0xfffbfff8,0xfffcfffc,0xfffafffb,0xfffbfffc,0xfffcfffd,0xfffefffd,0xfffdfffd,0xfffffffd,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffd,0xfffdfffe,
-0x0000ffff,0xfffd0000,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,
-0xfffefffe,0xfffefffe,0x00000001,0xffff0000,0x0000ffff,0x00010000,0x00010000,0x00010001,
-0x00010001,0x00020001,0x00010000,0x00010001,0x00000000,0x00010002,0x00010001,0x00030000,
-0x00010001,0x00010000,0x0002ffff,0x00000000,0x0000ffff,0xffff0000,0xfffffffe,0xffffffff,
-0xffffffff,0xfffeffff,0xfffffffe,0xfffeffff,0xfffdfffd,0xfffefffe,0xfffeffff,0xfffeffff,
-0xffff0000,0xffffffff,0x00000000,0xffff0000,0x00020000,0x00010000,0x00020002,0x00030003,
-0x00030005,0x00050003,0x00060004,0x00060004,0x00060006,0x00060004,0x00060007,0x00080007,
-0x00060007,0x00070007,0x00070007,0x00070007,0x00060008,0x00060007,0x00060007,0x00070008,
-0x00060007,0x00060006,0x00050006,0x00050007,0x00050006,0x00070006,0x00050006,0x00050006,
-0x00070006,0x00070006,0x00050005,0x00050004,0x00040005,0x00050006,0x00050005,0x00050005,
-0x00060005,0x00060005,0x00060006,0x00060007,0x00060006,0x00060006,0x00070007,0x00070007,
-0x00070007,0x00060005,0x00060007,0x00060008,0x00070007,0x00060006,0x00060006,0x00060006,
-0x00070005,0x00060007,0x00060006,0x00060006,0x00050006,0x00050005,0x00070006,0x00050005,
-0x00050005,0x00040005,0x00030004,0x00020003,0x00020003,0x00030005,0x00020003,0x00010002,
-0x00000001,0x00000001,0xffff0001,0xffff0000,0xfffffffe,0xfffdfffe,0xfffefffd,0xfffdfffe,
-0xfffdfffe,0xfffdfffd,0xfffdfffc,0xfffbfffb,0xfffafffb,0xfff9fff9,0xfffafff9,0xfff9fff9,
-0xfff9fff9,0xfff8fffa,0xfff8fff9,0xfff8fff8,0xfff7fff8,0xfff9fff8,0xfff9fff9,0xfff8fff8,
-0xfff8fff8,0xfff9fff9,0xfff9fff7,0xfff8fff8,0xfff9fffa,0xfff9fffa,0xfffafff9,0xfffbfffb,
-0xfffcfffa,0xfffafffa,0xfffbfffb,0xfffbfffd,0xfffbfffc,0xfffcfffa,0xfffcfffb,0xfffcfffc,
-0xfffdfffd,0xfffbfffd,0xfffbfffd,0xfffdfffd,0xfffbfffc,0xfffbfffd,0xfffbfffb,0xfffbfffb,
-0xfffafff9,0xfff9fff9,0xfff9fff9,0xfffafff8,0xfff8fffa,0xfff8fff9,0xfff8fff9,0xfff8fff9,
-0xfff7fff8,0xfff7fff7,0xfff7fff6,0xfff8fff7,0xfff8fff6,0xfff7fff6,0xfff6fff7,0xfff6fff6,
-0xfff7fff8,0xfff8fff7,0xfff9fff8,0xfff9fff8,0xfffafff9,0xfffafffa,0xfffbfffb,0xfffcfffb,
-0xfffcfffb,0xfffbfffc,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffcfffe,0xfffefffc,0xfffdfffd,
-0xfffdfffd,0xfffefffd,0xfffdfffc,0xfffefffe,0xfffcfffd,0xfffdfffd,0xfffefffc,0xfffdfffd,
-0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffefffd,0xfffdfffd,0xfffdfffc,0xfffefffc,0xfffdfffc,
-0xfffdfffe,0xfffefffe,0xfffeffff,0xffffffff,0xfffffffe,0xfffefffe,0xffffffff,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffffffe,0xffffffff,0xffff0000,0xffff0000,0x00000000,0x0001ffff,
-0xffffffff,0x00010000,0x00010000,0x0001ffff,0x00000001,0x00010001,0x00010001,0x00010002,
-0x00020001,0x00010002,0x00020003,0x00030003,0x00040004,0x00050003,0x00070004,0x00070006,
-0x00070005,0x00080006,0x00060006,0x00060006,0x00080006,0x00070006,0x00070007,0x00070007,
-0x00070007,0x00060005,0x00070007,0x00050006,0x00060006,0x00050005,0x00060005,0x00040006,
-0x00050004,0x00040005,0x00040004,0x00030004,0x00030003,0x00030002,0x00030003,0x00030004,
-0x00040003,0x00040004,0x00040003,0x00030004,0x00040004,0x00040003,0x00050004,0x00050004,
-0x00040004,0x00040005,0x00050004,0x00050005,0x00030005,0x00030004,0x00040004,0x00040004,
-0x00040004,0x00030003,0x00030004,0x00020003,0x00030003,0x00030003,0x00020002,0x00040001,
-0x00020003,0x00010002,0x00010003,0x00010003,0x00010002,0x00020002,0x00010002,0x00020002,
-0x00020001,0x00030001,0x00030002,0x00020002,0x00020002,0x00030002,0x00020003,0x00040002,
-0x00030003,0x00010002,0x00010002,0x00000002,0x00000001,0x00000000,0x00000001,0xffff0000,
-0xfffeffff,0xfffefffe,0xfffffffd,0xfffffffe,0xfffdfffe,0xfffefffe,0xfffdffff,0xfffdfffe,
-0xfffffffe,0xfffffffe,0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffe0000,0x00000000,0x00010000,0x0000ffff,0x0000ffff,0xffff0000,0x00000001,0x00010002,
-0x00020002,0x00000002,0x00010001,0x00010001,0x00020001,0x00020000,0x00020002,0x00020002,
-0x00010000,0xffff0001,0x0000ffff,0x00010000,0x00010000,0xffff0000,0xfffeffff,0xfffeffff,
-0xfffdfffe,0xfffbfffe,0xfffcfffc,0xfffbfffc,0xfffbfffc,0xfffafffa,0xfff9fffa,0xfffbfff9,
-0xfff9fff9,0xfff8fffa,0xfffafffa,0xfffafff9,0xfffafffa,0xfffbfff9,0xfffafffa,0xfffafffa,
-0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffcfffb,0xfffdfffc,0xfffdfffd,0xfffffffd,0xfffffffd,
-0xfffffffe,0x0001fffe,0xffff0000,0xffffffff,0x0001ffff,0xffffffff,0xfffeffff,0xffffffff,
-0xfffeffff,0xfffefffe,0xfffdfffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffffffe,0xfffffffe,
-0xfffffffd,0xfffefffe,0xfffeffff,0xffffffff,0xffff0000,0xffffffff,0x0000ffff,0xffff0000,
-0xffff0000,0xffff0001,0xffff0000,0xffffffff,0x0000fffe,0xffff0000,0xffff0000,0xfffeffff,
-0xfffefffe,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffb,0xfffdfffb,0xfffcfffc,
-0xfffbfff9,0xfffbfffb,0xfffbfffa,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffbfffc,0xfffbfffc,
-0xfffcfffd,0xfffdfffc,0xfffcfffc,0xfffbfffd,0xfffdfffb,0xfffdfffd,0xfffbfffd,0xfffefffd,
-0xfffcfffc,0xfffefffd,0xfffefffe,0xfffefffd,0xfffffffc,0xfffefffe,0xfffefffd,0xfffdfffc,
-0xfffdfffc,0xfffcfffd,0xfffbfffc,0xfffcfffc,0xfffafffc,0xfffbfffc,0xfffcfffc,0xfff9fffa,
-0xfffafffa,0xfffafffb,0xfffafffb,0xfffafffa,0xfffafff8,0xfffafffa,0xfffbfffa,0xfffbfff9,
-0xfffbfffa,0xfffbfffb,0xfffcfffc,0xfffcfffb,0xfffdfffb,0xfffcfffc,0xfffefffd,0x0000ffff,
-0x0000ffff,0x00000001,0x00000001,0x00010000,0x00020002,0x00020002,0x00020002,0x00030003,
-0x00020003,0x00050004,0x00050004,0x00040003,0x00040005,0x00050004,0x00040005,0x00040004,
-0x00050004,0x00040005,0x00040003,0x00030003,0x00050003,0x00040003,0x00040004,0x00050003,
-0x00050005,0x00050005,0x00070006,0x00040005,0x00040004,0x00050004,0x00050005,0x00040005,
-0x00050006,0x00040005,0x00040006,0x00040005,0x00050004,0x00050003,0x00050004,0x00040004,
-0x00060003,0x00040004,0x00040005,0x00040004,0x00030003,0x00040003,0x00030002,0x00030002,
-0x00020002,0x00020002,0x00040003,0x00050004,0x00030004,0x00040004,0x00040004,0x00040004,
-0x00050005,0x00050006,0x00060006,0x00050006,0x00060007,0x00080007,0x00080007,0x00080007,
-0x00080007,0x00070007,0x00070007,0x00060006,0x00070006,0x00060006,0x00050006,0x00050005,
-0x00050004,0x00040004,0x00040004,0x00030004,0x00030003,0x00020003,0x00030003,0x00030003,
-0x00020002,0x00020001,0x00010001,0x00010001,0x00000002,0x00020000,0x00010001,0x00000001,
-0x00030002,0x00010001,0x00020001,0x00010001,0x00010001,0x00020001,0x00020002,0x00020003,
-0x00000002,0x00020002,0x00020002,0x00010002,0x00010001,0x00020001,0x00010001,0x00010001,
-0x00000000,0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffefffd,
-0xfffcfffc,0xfffcfffc,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffbfffb,0xfffafffb,
-0xfff9fffa,0xfffbfffa,0xfffbfffa,0xfff9fff9,0xfff9fffa,0xfff9fff9,0xfff8fff8,0xfffafff9,
-0xfff9fffa,0xfff8fff9,0xfff9fff9,0xfff9fffa,0xfff9fff9,0xfffafffa,0xfffafffa,0xfff9fffa,
-0xfff8fff9,0xfff8fff9,0xfff9fffa,0xfffafffa,0xfffbfffa,0xfffbfffb,0xfffafffa,0xfffafff9,
-0xfffafff9,0xfffafff9,0xfffbfffa,0xfff9fffa,0xfff9fff9,0xfff8fffa,0xfff8fff8,0xfffafff8,
-0xfffbfffa,0xfff9fffa,0xfff9fff9,0xfff8fff8,0xfff9fff8,0xfff9fff8,0xfffafff9,0xfffafffa,
-0xfff9fffa,0xfffbfffa,0xfffafffa,0xfff9fffa,0xfff8fff9,0xfff9fffa,0xfffafff9,0xfff9fff8,
-0xfffafff9,0xfff9fff8,0xfff9fff9,0xfff8fff9,0xfff8fff8,0xfff8fff8,0xfff8fff8,0xfff7fff9,
-0xfff8fff9,0xfff8fff8,0xfff9fff9,0xfff9fffa,0xfffbfffb,0xfffafffc,0xfffbfffa,0xfffcfffc,
-0xfffdfffd,0xfffffffd,0x0001fffe,0x00010000,0x00010001,0x00010000,0x00010002,0x00010001,
-0x00010002,0x00030002,0x00030002,0x00020004,0x00030002,0x00010003,0x00010002,0x00030002,
-0x00020002,0x00020001,0x00020002,0x00010002,0x00020001,0x00020002,0x00030003,0x00010002,
-0x00010002,0x00010002,0x00020003,0x00020001,0x00000001,0x00020001,0x00030002,0x00030003,
-0x00030002,0x00030003,0x00030003,0x00030003,0x00040004,0x00030005,0x00050005,0x00060005,
-0x00070006,0x00060007,0x00060005,0x00060005,0x00040005,0x00040005,0x00040005,0x00050004,
-0x00050005,0x00040004,0x00030004,0x00030003,0x00030003,0x00030003,0x00040003,0x00030002,
-0x00030002,0x00020003,0x00010000,0x00010001,0x00020001,0x00030002,0x00020002,0x00010003,
-0x00020003,0x00020002,0x00020001,0x00010001,0x00020002,0x00020003,0x00030003,0x00030003,
-0x00030003,0x00030003,0x00020003,0x00030003,0x00020003,0x00030002,0x00030003,0x00030004,
-0x00020003,0x00030002,0x00020003,0x00020002,0x00030003,0x00010003,0x00010002,0x00020002,
-0x00020002,0x00030001,0x00020002,0x00030002,0x00030003,0x00030003,0x00030002,0x00030003,
-0x00030003,0x00030004,0x00030004,0x00030004,0x00030003,0x00040003,0x00030004,0x00030002,
-0x00020003,0x00030002,0x00030003,0x00010001,0x00020002,0x00010001,0x00010000,0x00010001,
-0x00000001,0xffff0000,0x00010001,0x00000000,0x00000001,0x00000001,0x00000001,0x00000000,
-0xffffffff,0xffff0000,0xffff0000,0xfffe0000,0xffffffff,0xfffeffff,0xffffffff,0xfffeffff,
-0xffffffff,0xfffffffe,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,
-0xfffcfffc,0xfffbfffc,0xfffcfffd,0xfffdfffd,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffefffd,
-0xfffefffc,0xfffdfffc,0xfffefffd,0xfffcfffd,0xfffdfffd,0xfffdffff,0x00000000,0xffff0000,
-0x0000ffff,0xffff0000,0x00020000,0x00010001,0x00000000,0x00000001,0x00020001,0x00010000,
-0x00010000,0x00010000,0x00010000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,
-0xfffffffe,0xffffffff,0xfffefffe,0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xfffffffe,
-0xfffffffe,0xffffffff,0xfffffffd,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffbfffc,0xfffbfffb,0xfffbfffc,0xfffcfffd,0xfffbfffc,0xfffbfffb,0xfffcfffb,0xfffbfffb,
-0xfffcfffc,0xfffbfffb,0xfffafffc,0xfffbfffa,0xfffbfffa,0xfffbfffc,0xfffdfffb,0xfffdfffc,
-0xfffcfffd,0xfffcfffb,0xfffbfffc,0xfffcfffb,0xfffbfffc,0xfffbfffc,0xfffbfffb,0xfffbfffc,
-0xfffdfffd,0xfffcfffc,0xfffbfffc,0xfffcfffb,0xfffbfffa,0xfff9fffa,0xfffafffa,0xfffafffb,
-0xfffafffa,0xfffbfffc,0xfffcfffb,0xfffbfffa,0xfffcfffb,0xfffbfffb,0xfffbfffa,0xfffbfffc,
-0xfffcfffc,0xfffcfffd,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffdfffd,
-0xfffdfffd,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffffffe,0xfffeffff,
-0xfffffffe,0xffffffff,0xfffeffff,0x0000ffff,0x00000000,0xfffe0000,0xfffeffff,0xfffeffff,
-0x0000ffff,0x0000fffe,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffff0000,0x00000000,
-0x00000000,0x00010000,0xffffffff,0xffff0000,0xffff0000,0x0000ffff,0x00000002,0x0000ffff,
-0x00000000,0xffff0000,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffd,0x0000fffe,0xfffffffe,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xfffdfffe,0xfffeffff,
-0x0000ffff,0x0001ffff,0x00010000,0xffff0000,0x00000001,0x00010002,0x00030002,0x00040002,
-0x00040003,0x00060005,0x00060005,0x00060007,0x00050007,0x00050007,0x00050006,0x00060007,
-0x00070007,0x00070008,0x00060007,0x00080007,0x00080007,0x00080006,0x00080008,0x00060006,
-0x00060006,0x00050006,0x00050006,0x00060006,0x00040006,0x00060005,0x00040005,0x00060006,
-0x00050005,0x00050005,0x00050005,0x00050005,0x00050005,0x00050004,0x00050005,0x00050005,
-0x00050005,0x00040006,0x00040006,0x00040004,0x00040004,0x00040005,0x00050005,0x00040005,
-0x00050002,0x00040003,0x00040003,0x00030003,0x00030004,0x00020003,0x00020004,0x00020003,
-0x00010003,0x00020002,0x00030004,0x00020005,0x00020005,0x00030004,0x00030004,0x00040005,
-0x00040004,0x00050005,0x00040006,0x00040005,0x00050004,0x00040004,0x00060005,0x00050005,
-0x00050004,0x00050004,0x00050004,0x00040003,0x00050003,0x00040003,0x00020002,0x00000001,
-0x00000001,0x00010000,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffffffe,0xfffefffd,
-0xfffefffd,0xfffcfffc,0xfffdfffc,0xfffcfffd,0xfffbfffc,0xfffafffb,0xfffbfffc,0xfffafffc,
-0xfffbfffc,0xfffbfffb,0xfffbfffc,0xfffafffb,0xfffcfffa,0xfffcfffb,0xfffefffc,0xfffdfffc,
-0xfffdfffc,0xfffdfffd,0xfffcfffb,0xfffcfffc,0xfffafffc,0xfffbfffa,0xfffcfffb,0xfffbfffb,
-0xfffafffa,0xfff9fff9,0xfff8fffa,0xfff8fff8,0xfff9fff8,0xfff8fff8,0xfff8fff7,0xfff8fff8,
-0xfff8fff8,0xfff8fff8,0xfff8fff8,0xfff8fff7,0xfff7fff7,0xfff7fff6,0xfff7fff6,0xfff7fff6,
-0xfff8fff6,0xfff7fff7,0xfff8fff7,0xfff9fff8,0xfff8fff8,0xfff8fff9,0xfff8fff8,0xfff8fff9,
-0xfff8fff9,0xfff8fff8,0xfff7fff8,0xfff8fff8,0xfff9fff8,0xfffafff8,0xfffcfff9,0xfffafffa,
-0xfffcfffa,0xfffdfffc,0xfffdfffb,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffcfffb,
-0xfffdfffc,0xfffdfffe,0xfffeffff,0xfffffffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffdfffe,
-0xfffefffe,0xfffffffd,0xfffffffe,0xffffffff,0xfffffffe,0xfffeffff,0xffffffff,0xffff0000,
-0xfffe0000,0xfffdfffe,0xfffffffe,0xfffefffe,0xffffffff,0xfffefffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffdffff,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0x00000000,
-0x00000001,0x00000001,0x00000000,0x00010000,0x00030001,0x00020002,0x00020002,0x00040002,
-0x00040003,0x00060005,0x00050006,0x00060005,0x00060006,0x00060007,0x00070006,0x00060007,
-0x00060006,0x00060006,0x00070006,0x00060006,0x00060006,0x00050005,0x00060005,0x00040004,
-0x00040005,0x00040005,0x00040004,0x00040004,0x00040003,0x00030003,0x00030003,0x00030004,
-0x00040003,0x00030004,0x00030003,0x00040004,0x00040004,0x00030003,0x00030003,0x00020002,
-0x00030002,0x00020003,0x00020003,0x00030002,0x00020002,0x00030002,0x00020003,0x00020002,
-0x00030004,0x00040003,0x00040004,0x00040003,0x00030003,0x00020003,0x00030003,0x00030003,
-0x00020002,0x00030003,0x00020003,0x00020003,0x00030003,0x00010003,0x00000002,0x00000001,
-0x00010001,0x00000001,0xffff0000,0x0001ffff,0x0001ffff,0x0000ffff,0xffffffff,0xffff0000,
-0xffff0000,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xffffffff,0x0000ffff,
-0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0x00010000,0x00000001,0x00010000,0x00000000,
-0x00000000,0x00010001,0x00020002,0x00020002,0x00010003,0x00020003,0x00010004,0x00040004,
-0x00040003,0x00050003,0x00040002,0x00050003,0x00040004,0x00050003,0x00040003,0x00050005,
-0x00040005,0x00040003,0x00040004,0x00030003,0x00030002,0x00020003,0x00010003,0x00000002,
-0x00010001,0x00010000,0x0000ffff,0xfffe0000,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffdfffd,0xfffefffd,0xfffdfffc,0xfffefffc,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffcfffc,0xfffafffc,0xfffbfffb,0xfffafffb,0xfffbfffc,0xfffbfffa,0xfffafffa,
-0xfff9fffa,0xfffafffb,0xfff9fff9,0xfffafff9,0xfffbfff9,0xfff9fffa,0xfffafffa,0xfffafffb,
-0xfff9fffb,0xfffcfffb,0xfffdfffc,0xfffdfffc,0xfffcfffd,0xfffefffd,0xfffefffc,0x0000fffe,
-0xffffffff,0xffffffff,0xffff0000,0xffff0000,0x00000000,0x0001ffff,0x00010000,0x00000000,
-0x00000000,0xffff0000,0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,0xfffefffe,
-0xfffdfffe,0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffc,0xfffcfffc,0xfffdfffc,
-0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffcfffd,0xfffcfffd,0xfffdfffc,0xfffefffe,0xfffcfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffbfffc,0xfffdfffc,0xfffdfffe,
-0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffffffc,0xfffffffd,0xfffdfffc,
-0xfffefffd,0xfffdfffe,0xfffefffe,0xfffefffd,0xfffdfffc,0xfffdfffd,0xfffdfffc,0xfffcfffd,
-0xfffdfffd,0xfffbfffc,0xfffafffc,0xfffafffb,0xfffafffb,0xfffafffb,0xfff9fffa,0xfffafffa,
-0xfffafff9,0xfffbfffa,0xfffafff9,0xfffafffa,0xfffbfffb,0xfffafffb,0xfffcfffa,0xfffcfffc,
-0xfffcfffb,0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffdffff,
-0xffffffff,0x0001ffff,0x0001ffff,0x00000000,0x0001ffff,0x00010000,0x00030001,0x00020002,
-0x00010002,0x00040001,0x00040003,0x00040003,0x00030004,0x00030002,0x00020002,0x00040004,
-0x00030005,0x00030004,0x00040003,0x00040004,0x00030003,0x00050005,0x00040003,0x00040003,
-0x00030003,0x00020003,0x00020002,0x00010002,0x00010002,0x00010001,0x00020001,0x00000001,
-0x00000000,0x0000ffff,0x00000000,0xffff0001,0xffff0000,0x00000000,0x00000000,0x00020001,
-0x00020001,0x00020001,0x00020001,0x00020002,0x00030003,0x00030003,0x00040004,0x00030004,
-0x00050004,0x00040005,0x00050004,0x00060005,0x00060006,0x00050005,0x00060004,0x00050005,
-0x00070007,0x00060006,0x00060006,0x00080008,0x00090008,0x00090009,0x00090009,0x00090008,
-0x0009000a,0x000a0009,0x0009000b,0x000a000a,0x0009000a,0x0009000a,0x00090009,0x00090009,
-0x00080009,0x00070008,0x00060008,0x00060006,0x00050006,0x00050006,0x00050005,0x00030002,
-0x00030003,0x00020001,0x00010002,0x00010001,0x00010002,0x00010000,0x00010000,0x00000001,
-0xffff0001,0x00000000,0x00000000,0x0001ffff,0x00010001,0x00010002,0x00010002,0x00010000,
-0x00000000,0x00000001,0x00000000,0x00010001,0x00000000,0xffff0000,0x00000000,0xffffffff,
-0x0000fffe,0x0000ffff,0xfffffffd,0xfffffffe,0xfffeffff,0xffff0000,0xffff0000,0xfffe0000,
-0xffffffff,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffdfffb,0xfffcfffb,0xfffcfff9,0xfffbfffa,0xfffafffb,
-0xfff8fffa,0xfff8fffa,0xfff8fff9,0xfff7fff9,0xfff8fff8,0xfff8fff9,0xfff8fff9,0xfff8fff9,
-0xfff7fff8,0xfff8fff9,0xfff8fff8,0xfff8fff8,0xfff8fff7,0xfff9fff8,0xfff8fff8,0xfff9fff8,
-0xfffafff9,0xfffafffa,0xfffafffa,0xfffafffa,0xfffcfffa,0xfffafffa,0xfffbfffa,0xfffbfffb,
-0xfffbfffc,0xfffbfffb,0xfffbfffb,0xfffafffc,0xfffcfffa,0xfffcfffb,0xfffbfffc,0xfffcfffc,
-0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffbfffb,0xfffbfffc,0xfffbfffa,0xfffafffa,
-0xfffafffa,0xfff9fffa,0xfffafffa,0xfff9fff9,0xfff9fffa,0xfff8fff9,0xfff8fff8,0xfff9fff8,
-0xfff9fff8,0xfff9fff8,0xfff9fff9,0xfffbfffa,0xfffbfffa,0xfffafff9,0xfffbfffb,0xfffafffb,
-0xfffafff9,0xfffcfffb,0xfffcfffb,0xfffdfffb,0xfffefffd,0xfffefffe,0xfffffffe,0x00000000,
-0x00000001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010002,0x00010001,0x00010002,
-0x00020003,0x00020003,0x00040004,0x00010003,0x00010003,0x00020001,0x00010001,0x00020002,
-0x00020001,0x00020002,0x00010002,0x00010001,0x00010001,0x00020001,0x00020002,0x00010002,
-0x00020002,0x00020001,0x00020002,0x00020001,0x00020002,0x00010001,0x00010001,0x00010001,
-0x00020002,0x00010002,0x00020002,0x00020002,0x00020003,0x00020003,0x00010002,0x00010002,
-0x00020002,0x00020002,0x00020002,0x00020001,0x00020002,0x00010001,0x00020002,0x00030003,
-0x00030003,0x00030003,0x00030003,0x00030002,0x00040003,0x00040003,0x00040004,0x00050004,
-0x00060005,0x00060005,0x00050004,0x00060005,0x00050005,0x00050005,0x00050005,0x00030004,
-0x00040003,0x00030004,0x00030003,0x00020003,0x00020003,0x00020002,0x00010002,0x00020002,
-0x00030001,0x00020002,0x00020002,0x00020002,0x00020003,0x00030002,0x00030002,0x00030003,
-0x00040004,0x00030004,0x00050003,0x00040003,0x00050003,0x00040004,0x00020002,0x00020002,
-0x00020003,0x00020002,0x00000002,0x00010001,0x00000001,0x00010001,0x00010001,0x0000ffff,
-0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0xffff0001,0x00000001,0x00010001,0x00010002,
-0x00020001,0x00000002,0x00010001,0x00020001,0x00020001,0x00020002,0x00030002,0x00020002,
-0x00020002,0x00020003,0x00020001,0x00000001,0x00020001,0x00000002,0x00000001,0xffff0000,
-0xffff0000,0xfffffffe,0xfffdfffe,0xfffcfffd,0xfffcfffb,0xfffcfffc,0xfffcfffd,0xfffbfffd,
-0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffbfffb,0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffdfffe,
-0xfffefffe,0xfffffffe,0x0000ffff,0x00000000,0x00010000,0x00020002,0x00020001,0x00010001,
-0x00010002,0x00020001,0x00020002,0x00010002,0x00010002,0x00010001,0x00000001,0x00000002,
-0x00010001,0x00000000,0x00000001,0x00010001,0x0000ffff,0xffffffff,0xfffeffff,0xfffffffe,
-0xffffffff,0xfffffffd,0xfffffffe,0xfffefffe,0xfffefffd,0xfffffffe,0xffffffff,0xffffffff,
-0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffdfffe,
-0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffbfffb,0xfffcfffc,0xfffbfffc,0xfffcfffc,0xfffafffc,
-0xfffafffb,0xfffbfffa,0xfffbfffb,0xfffcfffc,0xfffbfffa,0xfffcfffc,0xfffbfffc,0xfffcfffc,
-0xfffefffe,0xfffdfffe,0xfffffffd,0xfffdfffe,0xfffefffe,0xfffffffe,0xfffeffff,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffb,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,
-0xfffbfffd,0xfffcfffd,0xfffdfffd,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffcfffb,
-0xfffbfffc,0xfffcfffc,0xfffdfffd,0xfffcfffb,0xfffbfffb,0xfffdfffb,0xfffbfffb,0xfffbfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffcfffd,0xfffbfffc,0xfffcfffb,0xfffcfffd,
-0xfffcfffd,0xfffcfffc,0xfffcfffe,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffdfffb,
-0xfffefffd,0xfffefffd,0xfffefffe,0xfffffffd,0xfffffffc,0xfffefffd,0xfffffffd,0xfffffffd,
-0xfffeffff,0xfffffffe,0xfffffffe,0xfffffffd,0xfffdfffe,0xfffeffff,0xffffffff,0xfffe0000,
-0xffff0000,0x0001ffff,0x0000ffff,0x00000000,0xffffffff,0x00000001,0x00000001,0x00000002,
-0x00020001,0x00010001,0x00000002,0x00020003,0x00010002,0x00020002,0x00010001,0x00020002,
-0x00020001,0x00030002,0x00020002,0x00020002,0x00040003,0x00040004,0x00050004,0x00060006,
-0x00060007,0x00070006,0x00070007,0x00060006,0x00060007,0x00070007,0x00070006,0x00080007,
-0x00070008,0x00070007,0x00070008,0x00080008,0x00080008,0x00070007,0x00060007,0x00060005,
-0x00060006,0x00070007,0x00050006,0x00060005,0x00040006,0x00050005,0x00050005,0x00040003,
-0x00050004,0x00040003,0x00030003,0x00030003,0x00030003,0x00030004,0x00030004,0x00040003,
-0x00040004,0x00040005,0x00030004,0x00040003,0x00030002,0x00030002,0x00030002,0x00030003,
-0x00020003,0x00030002,0x00040004,0x00040004,0x00030004,0x00040004,0x00030004,0x00040004,
-0x00050004,0x00040004,0x00050003,0x00030004,0x00030004,0x00030004,0x00030003,0x00030003,
-0x00030003,0x00020002,0x00020002,0x00020002,0x00030001,0x00020002,0x00010002,0x00020002,
-0x00000001,0x00000001,0x00010000,0xffff0000,0x0000ffff,0x00000000,0x0000ffff,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffefffd,0xfffdfffe,0xfffdfffd,0xfffcfffe,0xfffdfffd,0xfffcfffd,
-0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffdfffb,0xfffdfffd,0xfffcfffc,0xfffefffd,0xfffdfffd,
-0xfffefffe,0xfffcfffe,0xfffefffd,0xfffdfffd,0xfffefffc,0xfffdfffc,0xfffdfffd,0xfffdfffd,
-0xfffdfffc,0xfffdfffc,0xfffafffb,0xfffafffa,0xfffafffb,0xfffafffa,0xfffafffa,0xfff9fffa,
-0xfff9fffa,0xfff8fffa,0xfff8fff8,0xfffafff8,0xfff8fff9,0xfff8fff8,0xfff7fff9,0xfff8fff8,
-0xfffafff8,0xfff9fff9,0xfff8fff8,0xfff7fff7,0xfff7fff7,0xfff7fff7,0xfff8fff8,0xfff8fff8,
-0xfff9fff9,0xfffafff8,0xfffafff9,0xfff9fff9,0xfffafffa,0xfffafffa,0xfffafffa,0xfffafffa,
-0xfffafffa,0xfffbfff9,0xfffbfffb,0xfffafffa,0xfffbfffa,0xfffafffb,0xfffafffa,0xfffbfffc,
-0xfffbfffc,0xfffbfffb,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffbfffd,
-0xfffefffd,0xfffffffe,0xfffffffe,0xffffffff,0xffff0000,0x00000000,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffdfffd,0xfffdfffc,
-0xfffdfffd,0xfffdfffc,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffd,0xfffefffd,
-0xfffefffe,0xffffffff,0xffffffff,0xfffefffe,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,
-0xfffffffe,0x00000000,0x00010000,0x00010001,0x00010001,0x00010002,0x00030001,0x00030001,
-0x00020003,0x00030004,0x00040003,0x00040003,0x00040004,0x00040004,0x00050005,0x00040006,
-0x00040006,0x00050005,0x00050004,0x00050005,0x00050005,0x00050005,0x00050004,0x00030004,
-0x00040003,0x00030003,0x00020001,0x00020001,0x00010001,0x00030001,0x00020001,0x00020001,
-0x00030001,0x00020002,0x00010001,0x00020002,0x00030001,0x00030002,0x00030002,0x00030003,
-0x00040004,0x00030004,0x00020003,0x00040004,0x00040004,0x00040005,0x00050004,0x00050003,
-0x00040004,0x00030003,0x00040003,0x00040003,0x00040003,0x00040002,0x00040003,0x00020003,
-0x00030003,0x00030004,0x00030004,0x00030004,0x00040003,0x00030003,0x00030002,0x00020002,
-0x00040003,0x00030003,0x00030003,0x00020004,0x00020002,0x00040002,0x00030002,0x00030002,
-0x00010002,0xffff0001,0x0000ffff,0xffffffff,0x0000ffff,0xfffefffe,0xffffffff,0xffffffff,
-0xfffffffe,0xfffefffd,0xfffefffc,0x0000ffff,0xfffefffe,0xfffdfffe,0xfffdfffe,0xffff0000,
-0xffffffff,0xffffffff,0xffff0000,0xffff0000,0xfffe0000,0xffffffff,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00000000,0x00010000,0x00010001,0x00020001,0x00010001,0x00010001,
-0x00010001,0x00000001,0x00010002,0x00010001,0x00010001,0x00020002,0x00010001,0x00020000,
-0x00020001,0x00010002,0x00010000,0x00000001,0x00010000,0x00010000,0x00010000,0x00010002,
-0x00000001,0x00000000,0xffffffff,0xffffffff,0xfffefffe,0xffffffff,0xfffffffe,0xfffeffff,
-0xffffffff,0xfffeffff,0xfffffffe,0xfffffffe,0xfffeffff,0xfffefffe,0xfffeffff,0xfffffffe,
-0xfffe0000,0xfffeffff,0xffff0000,0xfffd0000,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffffffe,0xffffffff,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffefffe,0xfffffffe,0xffffffff,
-0xffffffff,0xffff0000,0xffff0000,0x0000ffff,0x0000ffff,0xffffffff,0x0001ffff,0xffff0000,
-0xffffffff,0xffff0000,0x00000000,0xffff0000,0xffffffff,0x0000ffff,0xffffffff,0xfffefffe,
-0xfffdfffe,0xfffdfffe,0xfffcfffe,0xfffcfffd,0xfffcfffc,0xfffbfffc,0xfffcfffa,0xfffbfffa,
-0xfffbfffb,0xfffcfffb,0xfffbfffb,0xfffbfffa,0xfffafffa,0xfffbfffb,0xfffafffc,0xfffafffa,
-0xfffafffa,0xfffbfffa,0xfffafffa,0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffbfffb,0xfffbfffb,
-0xfffcfffc,0xfffafffb,0xfffcfffa,0xfffbfffb,0xfffbfffa,0xfffbfffb,0xfffbfffb,0xfffbfffb,
-0xfffbfffa,0xfffbfffb,0xfffafffb,0xfffbfffc,0xfffbfffc,0xfffdfffd,0xfffdfffe,0xfffdfffe,
-0xfffffffe,0xfffefffe,0xfffffffe,0xffffffff,0xfffefffe,0x00010000,0x00000000,0x00010000,
-0x00010001,0x00000001,0xffff0000,0x00000000,0xfffeffff,0xfffffffd,0xfffdfffe,0xfffcfffd,
-0xfffdfffd,0xfffcfffe,0xfffcfffc,0xfffbfffb,0xfffcfffb,0xfffcfffc,0xfffcfffb,0xfffcfffb,
-0xfffcfffb,0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffdfffe,0xfffefffe,0xfffefffe,0xffffffff,
-0x00000001,0x00010000,0x00010001,0x00010000,0x00030001,0x00020001,0x00020002,0x00010002,
-0x00020001,0x00030002,0x00020003,0x00020003,0x00030002,0x00010002,0x00020001,0x00010003,
-0x00010002,0x00020002,0x00020002,0x00010001,0x00010001,0x00020001,0x00020001,0x00020002,
-0x00010002,0x00000001,0x00010002,0x00010002,0x00020002,0x00020002,0x00010002,0x00020002,
-0x00010003,0x00010002,0x00010001,0x00010002,0x00020002,0x00030002,0x00030003,0x00030002,
-0x00040003,0x00030002,0x00030003,0x00030003,0x00040003,0x00040004,0x00050005,0x00040005,
-0x00050005,0x00050006,0x00070006,0x00070007,0x00070007,0x00080007,0x00080008,0x00090009,
-0x00080008,0x00080009,0x00080007,0x00080007,0x00080008,0x00080008,0x00070008,0x00070007,
-0x00070007,0x00070006,0x00060006,0x00050006,0x00050005,0x00040005,0x00040006,0x00030004,
-0x00030004,0x00030004,0x00040004,0x00030004,0x00020003,0x00020003,0x00010003,0x00010001,
-0x00010002,0x00020001,0x00010001,0x00010000,0x0000ffff,0xffff0001,0x00000000,0x00000001,
-0xffff0000,0xffff0000,0x00000000,0x0000fffe,0xffffffff,0x00010000,0x0001ffff,0x00000000,
-0x00000000,0x0000ffff,0x00010000,0xffff0000,0x00000000,0x00010001,0x00000001,0x00000001,
-0x00010001,0x00010000,0xffffffff,0xfffefffe,0xffff0000,0xfffeffff,0xffffffff,0xfffefffd,
-0xfffefffd,0xfffcfffd,0xfffcfffd,0xfffefffe,0xfffcfffd,0xfffefffd,0xfffdfffd,0xfffcfffd,
-0xfffefffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffbfffc,0xfffdfffd,0xfffafffb,
-0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffafffb,0xfffbfffb,0xfffafffb,0xfffbfffa,0xfffbfffa,
-0xfffafffa,0xfff9fffa,0xfff9fff9,0xfffafff9,0xfff9fff9,0xfff9fff8,0xfff9fff8,0xfff9fff8,
-0xfffafff8,0xfff9fff9,0xfff9fffa,0xfffafff9,0xfffafffa,0xfff9fffa,0xfffafffb,0xfffafffc,
-0xfffbfffb,0xfffbfffb,0xfffcfffb,0xfffcfffb,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffbfffa,
-0xfffbfffa,0xfffafffb,0xfffbfffa,0xfffafff8,0xfff9fff8,0xfff8fff9,0xfff8fff9,0xfff9fffa,
-0xfffafff9,0xfff9fff9,0xfff8fff8,0xfff9fff7,0xfff8fff7,0xfff7fff8,0xfff8fff9,0xfff8fff9,
-0xfff9fffa,0xfff9fff9,0xfffafffa,0xfffafffa,0xfffcfffc,0xfffcfffd,0xfffefffd,0xfffffffd,
-0xfffefffe,0xfffffffe,0xffff0000,0x00000001,0x00000000,0x00000000,0x00010001,0x00020001,
-0x00010002,0x00020002,0x00030003,0x00030003,0x00030003,0x00030003,0x00030003,0x00030002,
-0x00020002,0x00030002,0x00020002,0x00030004,0x00020002,0x00040003,0x00020004,0x00010002,
-0x00020003,0x00020003,0x00010003,0x00010001,0x00020001,0x00030002,0x00010002,0x00010001,
-0x00010001,0x00020002,0x00020003,0x00020002,0x00020002,0x00020000,0x00020002,0x00010001,
-0x00010001,0x00010001,0x00010002,0x00020002,0x00020001,0x00000000,0x00000000,0x00000001,
-0x00000001,0x00000000,0x00020002,0x00000000,0x00020000,0x00020001,0x00030001,0x00030002,
-0x00040004,0x00040004,0x00040004,0x00040004,0x00050005,0x00060006,0x00050006,0x00050006,
-0x00040006,0x00050006,0x00040006,0x00050005,0x00040006,0x00040005,0x00040004,0x00030004,
-0x00040003,0x00030003,0x00020002,0x00010001,0x00010001,0x00010001,0x00000000,0x00000000,
-0xffff0000,0x0000ffff,0xfffffffe,0x0000ffff,0xffff0000,0x00000000,0x00000000,0x00000001,
-0x00010001,0x00020001,0x00020002,0x00010001,0x00010000,0x00010001,0x00020002,0x00020002,
-0x00010001,0x00010001,0x00010001,0x00000002,0x00000000,0x00010001,0x00010001,0x00000001,
-0x00010000,0x00010001,0x00000000,0x00010001,0x00010000,0x00010000,0x00020001,0x00010001,
-0x00010002,0x00010001,0x00010003,0x00010001,0x00020002,0x00010002,0x00010001,0x00010002,
-0x00010001,0x00010001,0x00000000,0x00010000,0x00010000,0x00010000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00000001,0xffff0000,0xffff0000,0xffff0000,0xffff0000,0xfffffffe,
-0xffffffff,0xfffffffe,0x0000ffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,
-0xfffffffe,0x0000ffff,0xfffefffe,0xffffffff,0xffffffff,0xffff0000,0x00000000,0xffffffff,
-0xffff0000,0x00000001,0xffff0001,0x00000001,0x00000000,0x00000000,0x00000000,0xffff0000,
-0xffff0000,0x00000000,0x0000ffff,0x00000000,0xffffffff,0xfffffffe,0xfffeffff,0xfffefffe,
-0xffff0000,0xfffefffe,0xfffefffc,0xfffffffd,0xfffefffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,
-0xfffbfffe,0xfffcfffd,0xfffcfffd,0xfffdfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffdfffd,
-0xfffdfffc,0xfffdfffd,0xfffcfffd,0xfffdfffc,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffdfffd,0xfffefffe,0xfffefffe,0xffffffff,0xfffefffd,0xfffefffd,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffcfffd,0xfffdfffc,0xfffdfffc,0xfffdfffd,0xfffdfffd,
-0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffbfffd,0xfffcfffd,0xfffcfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffefffc,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffcfffd,
-0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffdfffd,
-0xfffcfffb,0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffdfffe,0xfffcfffe,0xfffefffe,
-0xfffdffff,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffdffff,0xfffdfffe,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffdffff,
-0xfffdfffe,0xfffffffe,0xffffffff,0xfffffffe,0xffffffff,0xffff0000,0xffffffff,0xfffffffe,
-0xfffeffff,0xfffeffff,0xffff0001,0xfffeffff,0x00000000,0xffff0000,0x00000001,0xffffffff,
-0x0001ffff,0x00010000,0x0000ffff,0xffffffff,0x00010000,0x00000001,0x00000000,0xffffffff,
-0x00000000,0x00000001,0x00010002,0x00010002,0x00010002,0x00020002,0x00020002,0x00030003,
-0x00020003,0x00030003,0x00040003,0x00050004,0x00040005,0x00040004,0x00060004,0x00060005,
-0x00050005,0x00030004,0x00040004,0x00030004,0x00040004,0x00030005,0x00030003,0x00030004,
-0x00030003,0x00030002,0x00030004,0x00020003,0x00020001,0x00010000,0x00020001,0x00010002,
-0x00020002,0x00030002,0x00030004,0x00030003,0x00030004,0x00040003,0x00030003,0x00040003,
-0x00040003,0x00050005,0x00060006,0x00050006,0x00040006,0x00050006,0x00060007,0x00050006,
-0x00070006,0x00060006,0x00060007,0x00080007,0x00080008,0x00080007,0x00070007,0x00070007,
-0x00070008,0x00070007,0x00080007,0x00070007,0x00060006,0x00060006,0x00060006,0x00050005,
-0x00060006,0x00060005,0x00050005,0x00040004,0x00040004,0x00020003,0x00030004,0x00030003,
-0x00030002,0x00020002,0x00010001,0x00000001,0x00000001,0xffff0000,0xffffffff,0xffffffff,
-0xfffdfffe,0xfffdfffe,0xfffdffff,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffefffd,
-0xfffdfffd,0xfffcfffc,0xfffdfffb,0xfffdfffc,0xfffcfffb,0xfffcfffc,0xfffcfffb,0xfffdfffb,
-0xfffcfffc,0xfffbfffb,0xfffbfffb,0xfffafffc,0xfff9fffb,0xfffafffb,0xfffafffa,0xfffafffa,
-0xfffafffb,0xfffbfff9,0xfffcfffb,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffbfffc,0xfffdfffb,
-0xfffcfffc,0xfffbfffc,0xfffcfffb,0xfffbfffd,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffdfffd,
-0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffa,0xfffbfffb,0xfffafffb,0xfffafffb,
-0xfffafffa,0xfff9fffa,0xfff9fffb,0xfff9fff9,0xfff9fff9,0xfffafff9,0xfffafff9,0xfffafff9,
-0xfffafff9,0xfff9fff8,0xfffbfff9,0xfffafff9,0xfffcfffa,0xfffbfffb,0xfffbfffc,0xfffcfffb,
-0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffcfffc,
-0xfffbfffc,0xfffcfffc,0xfffbfffb,0xfffcfffb,0xfffcfffb,0xfffbfffc,0xfffcfffb,0xfffcfffc,
-0xfffbfffc,0xfffbfffb,0xfffbfffc,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffdfffd,
-0xfffdfffd,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0x0000ffff,0x0000ffff,
-0xfffffffe,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,
-0xffff0000,0x00000000,0x00010001,0x00010001,0x00020001,0x00010001,0x00020001,0x00020002,
-0x00030003,0x00030004,0x00040004,0x00040004,0x00040004,0x00050004,0x00050003,0x00060004,
-0x00050004,0x00050004,0x00050004,0x00050004,0x00050004,0x00040003,0x00040004,0x00040004,
-0x00030005,0x00030003,0x00030002,0x00040003,0x00030003,0x00020002,0x00020002,0x00010002,
-0x00010003,0x00000000,0x00000000,0x00000000,0x00010001,0x00010001,0x00010002,0x00010001,
-0x00010001,0x00020001,0x0001ffff,0x00010001,0x00010002,0x00000001,0x00010001,0x00010001,
-0x00010000,0x00010001,0x00020001,0x00000001,0x00010002,0x00010002,0x00010002,0x00010001,
-0x00010001,0x00000001,0x00020001,0x00030000,0x00020001,0x00020003,0x00030002,0x00030003,
-0x00020003,0x00020003,0x00040004,0x00040004,0x00040003,0x00040004,0x00030002,0x00030003,
-0x00030003,0x00040002,0x00040004,0x00030004,0x00030003,0x00020004,0x00020003,0x00020003,
-0x00030003,0x00020003,0x00020000,0x00010001,0x00000001,0x00020001,0x00020000,0x00010000,
-0x00000000,0x0000ffff,0xffff0000,0xffff0001,0xffff0000,0x00000000,0x00000000,0x00000000,
-0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000001,
-0x00010001,0x00010001,0x00020001,0x00020001,0x00020001,0x00020002,0x00010001,0x00010001,
-0x00010000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,0xfffeffff,0xfffefffe,
-0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffcfffc,
-0xfffcfffd,0xfffdfffd,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0x0000ffff,
-0x0000ffff,0xffffffff,0x0000ffff,0xffffffff,0x0000ffff,0x0000ffff,0xffff0000,0xffff0000,
-0x00000000,0xffff0000,0x00000000,0xffff0000,0xffff0000,0xfffe0000,0xfffeffff,0xffffffff,
-0xffffffff,0xfffeffff,0xffffffff,0x0000ffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffffffe,0xfffffffe,0xffff0000,0xffffffff,0xfffefffe,0xfffffffe,0xfffefffe,
-0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,
-0xfffefffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffcfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffdfffd,0xfffcfffe,0xfffcfffc,0xfffbfffb,
-0xfffbfffc,0xfffcfffb,0xfffcfffc,0xfffbfffb,0xfffcfffb,0xfffdfffc,0xfffcfffd,0xfffcfffd,
-0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffc,0xfffdfffc,
-0xfffdfffc,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffdfffc,0xfffcfffc,0xfffdfffc,
-0xfffcfffc,0xfffcfffb,0xfffdfffc,0xfffdfffd,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffcfffc,
-0xfffdfffc,0xfffdfffe,0xfffdfffe,0xfffcfffc,0xfffefffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,
-0xfffdfffc,0xfffdfffb,0xfffefffd,0xfffdfffd,0xfffbfffc,0xfffbfffc,0xfffcfffd,0xfffeffff,
-0xfffefffd,0xfffefffe,0xfffffffe,0x00000000,0x00010000,0x00010001,0x00020001,0x00030002,
-0x00010003,0x00020002,0x00040002,0x00030003,0x00020002,0x00030003,0x00020003,0x00020002,
-0x00020002,0x00020003,0x00010002,0x00010001,0x00000000,0x00010001,0xffff0000,0x00000000,
-0x00000000,0x00000001,0x00000000,0xffffffff,0x0001ffff,0x0000ffff,0x0001ffff,0x00010000,
-0x00010000,0x00000001,0x00000002,0x00020003,0x00010002,0x00020003,0x00020003,0x00030003,
-0x00030004,0x00020002,0x00020003,0x00040003,0x00030003,0x00030003,0x00030002,0x00040003,
-0x00040004,0x00040004,0x00040004,0x00050005,0x00040005,0x00040005,0x00050005,0x00050006,
-0x00050006,0x00060005,0x00060005,0x00070005,0x00060006,0x00070006,0x00070006,0x00060006,
-0x00060006,0x00050007,0x00060007,0x00050005,0x00040005,0x00050005,0x00050004,0x00040005,
-0x00050004,0x00050004,0x00040004,0x00040004,0x00030005,0x00040004,0x00040004,0x00030004,
-0x00030005,0x00020003,0x00040003,0x00040003,0x00030004,0x00030002,0x00030002,0x00020002,
-0x00020003,0x00010003,0x00010002,0x00020001,0x00010001,0x00000001,0x00010002,0x00030001,
-0x00010002,0x00020002,0x00010001,0x00010001,0x00020002,0x00020001,0x00010000,0x00010001,
-0x00010000,0x00020000,0x00010001,0x00010001,0x00000002,0x00010000,0x00000000,0x00000001,
-0x00000000,0xffff0000,0xfffffffe,0xffffffff,0xfffeffff,0xfffefffe,0xfffdfffe,0xfffcfffd,
-0xfffcfffc,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffafff9,0xfffafff9,0xfff8fff9,0xfff8fff9,
-0xfff8fff8,0xfff7fff9,0xfff8fff8,0xfff8fff8,0xfff9fff9,0xfffafff9,0xfff9fff9,0xfff9fff9,
-0xfff9fff9,0xfff8fff8,0xfff9fff9,0xfff9fff8,0xfff9fff9,0xfffafff9,0xfff9fff9,0xfffafffa,
-0xfffbfffc,0xfffbfffb,0xfffbfffc,0xfffbfffc,0xfffbfffc,0xfffbfffb,0xfffbfffb,0xfffbfffb,
-0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffb,
-0xfffdfffb,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,
-0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffbfffd,0xfffbfffc,0xfffbfffc,0xfffbfffb,
-0xfffafffa,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffcfffc,
-0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffefffe,0xffffffff,0xffff0000,0xffff0000,
-0x00010000,0x00000001,0x0000ffff,0x00010000,0x00010000,0x00000000,0x00010000,0x00010002,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0xffffffff,0x00000000,0xffffffff,
-0x0000ffff,0x00000000,0xffff0000,0x0000ffff,0x00010001,0x00010000,0x00010000,0x00020001,
-0x00020002,0x00020001,0x00030003,0x00030003,0x00050004,0x00040004,0x00040004,0x00040004,
-0x00040005,0x00040005,0x00040004,0x00060005,0x00050004,0x00040004,0x00030004,0x00040004,
-0x00040004,0x00040004,0x00050004,0x00030005,0x00030004,0x00030004,0x00030004,0x00030003,
-0x00030003,0x00040003,0x00040004,0x00040003,0x00040004,0x00030002,0x00030002,0x00040003,
-0x00030003,0x00030003,0x00030002,0x00020003,0x00030003,0x00020003,0x00030004,0x00020003,
-0x00010002,0x00010002,0x00020002,0x00010001,0x00010001,0x00020001,0x00020002,0x00010001,
-0x00010001,0x00020002,0x00010002,0x00000002,0x00010000,0x00010000,0x00000000,0x0000ffff,
-0x00000000,0x0001ffff,0x00010000,0x0001ffff,0x0001ffff,0x0000ffff,0x00000000,0xffffffff,
-0x0000ffff,0x0000ffff,0xffffffff,0xffffffff,0x00000001,0x00010000,0x00000000,0xffff0000,
-0xffff0000,0xffff0000,0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x0001ffff,0x00000000,
-0x00010000,0xffff0001,0xffff0000,0x00010000,0x0000ffff,0x00010001,0x00010001,0x0000ffff,
-0x00010001,0x00000000,0x00000000,0xffff0001,0x00000000,0x00000000,0x00010001,0x00000000,
-0x00010000,0x0000ffff,0xffff0000,0x00000000,0xffff0001,0xffff0000,0xffff0000,0xffffffff,
-0xffff0000,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,
-0x00000000,0x00010001,0x00010001,0x00000000,0x00010000,0x00010000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xffffffff,0xfffeffff,0xffffffff,0x0000ffff,0xfffefffe,0xfffdfffe,
-0xfffeffff,0xfffdfffe,0xfffffffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffcfffd,
-0xfffdfffa,0xfffcfffc,0xfffdfffc,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffcfffd,0xfffcfffd,
-0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffefffd,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffe0000,0xffffffff,0xffffffff,0xffff0000,0xffff0000,0x00010000,
-0x00000000,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0xfffffffe,0xfffeffff,0xfffeffff,
-0xfffdfffe,0xfffcfffd,0xfffdfffd,0xfffefffc,0xfffdfffd,0xfffcfffb,0xfffdfffa,0xfffcfffc,
-0xfffcfffd,0xfffbfffc,0xfffbfffc,0xfffbfffc,0xfffbfffc,0xfffcfffb,0xfffcfffb,0xfffbfffc,
-0xfffbfffb,0xfffcfffb,0xfffcfffc,0xfffbfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,
-0xfffcfffd,0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffefffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,
-0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffffffe,0xfffdffff,0xfffefffe,
-0xfffefffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xfffdfffd,
-0xfffefffd,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0x0000fffd,0x0000fffe,
-0xfffffffe,0x0000ffff,0xffff0000,0xffff0000,0xffffffff,0xffff0000,0x00000000,0x00000000,
-0x00010000,0x00010000,0x00010000,0x00010001,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00030003,0x00050004,0x00040005,0x00050004,0x00040004,0x00040004,0x00050003,0x00050004,
-0x00050004,0x00050005,0x00040005,0x00040005,0x00030005,0x00040004,0x00040005,0x00050004,
-0x00050003,0x00050005,0x00040004,0x00050005,0x00030004,0x00040004,0x00030004,0x00030004,
-0x00030004,0x00030004,0x00030004,0x00020003,0x00030003,0x00020003,0x00030004,0x00020002,
-0x00010002,0x00010001,0x00010002,0x00020002,0x00030002,0x00020003,0x00020002,0x00020002,
-0x00030002,0x00030003,0x00020002,0x00030001,0x00030002,0x00030003,0x00030002,0x00030003,
-0x00020002,0x00020002,0x00020002,0x00020001,0x00020002,0x00020002,0x00030003,0x00030003,
-0x00040003,0x00020003,0x00030003,0x00030003,0x00040004,0x00040003,0x00040004,0x00040004,
-0x00040003,0x00040004,0x00030003,0x00020003,0x00020003,0x00020003,0x00020003,0x00020002,
-0x00030002,0x00020002,0x00030003,0x00020002,0x00000002,0x00000001,0x00000000,0x0001ffff,
-0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000001,0xffff0001,0x00000000,0x00010000,
-0x00000000,0x00000000,0xffff0000,0xffffffff,0xfffffffe,0xffffffff,0xfffffffe,0xfffefffd,
-0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffe,
-0xfffdfffd,0xfffcfffc,0xfffdfffd,0xfffcfffd,0xfffcfffb,0xfffbfffb,0xfffbfffb,0xfffbfffb,
-0xfffafffb,0xfffafffb,0xfffafffa,0xfffafffa,0xfffafffa,0xfff9fff9,0xfff9fff9,0xfff8fff8,
-0xfff7fff9,0xfff7fff8,0xfff7fff7,0xfff9fff8,0xfff8fff8,0xfff6fff7,0xfff7fff7,0xfff6fff6,
-0xfff6fff6,0xfff6fff6,0xfff8fff7,0xfff8fff7,0xfff9fff8,0xfff8fff9,0xfff9fffa,0xfffafffa,
-0xfffbfffb,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffdfffe,0xfffefffe,0xfffffffe,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffbfffb,0xfffcfffa,0xfffcfffb,0xfffcfffb,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffdfffb,0xfffcfffb,0xfffcfffc,0xfffdfffd,0xfffefffd,0xffffffff,
-0xfffe0000,0xfffffffe,0xfffeffff,0x0000ffff,0x00000000,0x00000001,0x00010001,0x00010000,
-0x00020001,0x00010000,0x00010000,0x00010001,0x00010002,0x00010002,0x00010002,0x00010001,
-0x00020001,0x00010002,0x00010002,0x00020003,0x00030002,0x00030003,0x00020003,0x00040003,
-0x00030003,0x00010003,0x00030002,0x00020002,0x00020002,0x00020001,0x00020001,0x00030001,
-0x00030001,0x00030002,0x00030003,0x00020002,0x00030001,0x00030002,0x00040002,0x00030003,
-0x00020003,0x00030003,0x00030002,0x00010003,0x00010001,0x00010002,0x00010002,0x00020001,
-0x00030002,0x00020002,0x00010001,0x00010001,0x00020001,0x00020002,0x00020003,0x00010002,
-0x00010001,0x00010001,0x00020002,0x00020002,0x00010001,0x00020001,0x00010002,0x00020002,
-0x00030003,0x00030003,0x00030002,0x00030002,0x00030002,0x00030002,0x00040003,0x00030003,
-0x00030003,0x00030003,0x00030004,0x00030003,0x00030004,0x00020003,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00000001,0x00000000,0x00000000,0x00000000,0xffffffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00020001,0x00010001,
-0x00020001,0x00010001,0x00020001,0x00000001,0x00010001,0x00010001,0x00010001,0x00010000,
-0x00010000,0x00010000,0x00010000,0x00000000,0xffff0000,0x0000ffff,0x00000000,0xffff0000,
-0xffff0000,0xffff0000,0x00000000,0x0000ffff,0x00000000,0x0000ffff,0xffffffff,0xfffeffff,
-0x0000ffff,0x00000000,0x00000000,0xffff0000,0x00000000,0x00000001,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0x00000000,0xffff0000,0xffff0000,0x0000ffff,0x0000fffe,0x0000ffff,
-0x0000ffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffefffd,0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000001,0x00000000,0x00020001,0x00010001,
-0x00000000,0x00010001,0x00010000,0x00000001,0x00000000,0x00010000,0x00010001,0x00010001,
-0xffff0000,0xffff0000,0xfffe0000,0xffff0000,0xfffe0000,0xfffefffe,0xffffffff,0xfffeffff,
-0xfffeffff,0xfffffffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffefffd,
-0xfffdfffc,0xfffefffc,0xfffefffc,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffdfffc,0xfffdfffd,
-0xfffcfffd,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffdfffe,
-0xfffcfffe,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffe,
-0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffcfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,
-0xfffcfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffcfffd,0xfffdfffc,0xfffdfffc,
-0xfffcfffc,0xfffdfffc,0xfffdfffd,0xfffdfffe,0xfffcfffe,0xfffdfffd,0xfffefffd,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xfffeffff,0x00000000,0xffffffff,0x0000fffe,0x0000ffff,
-0x00000001,0x00000001,0x00000000,0x00010001,0x00010000,0x00010000,0x00010000,0x00010000,
-0x00020001,0x0001ffff,0x00010000,0x00010000,0x00010001,0x00010001,0x00010000,0x00010001,
-0x00000001,0x00000001,0x00010001,0x00010002,0x00010000,0x00000001,0x00000001,0xffff0001,
-0xffff0001,0x00000000,0xffff0000,0xffffffff,0xffff0000,0x00000000,0x00000001,0xffff0000,
-0xffffffff,0xffff0000,0x0000ffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0x00000001,0x00000000,0x00000000,0x0000ffff,0x00010000,0x00000000,0x00010000,
-0x00010001,0x00020000,0x00010002,0x00020002,0x00010003,0x00020003,0x00030003,0x00030004,
-0x00040004,0x00050004,0x00050005,0x00050004,0x00050004,0x00060005,0x00070006,0x00070006,
-0x00060006,0x00060007,0x00070007,0x00070007,0x00060006,0x00060007,0x00060006,0x00060006,
-0x00050006,0x00050005,0x00060005,0x00050006,0x00030005,0x00040004,0x00030004,0x00030004,
-0x00030004,0x00020004,0x00030002,0x00030002,0x00030002,0x00030003,0x00020002,0x00020003,
-0x00020001,0x00020002,0x00020002,0x00010001,0x00010002,0x00020002,0x00010002,0x00010001,
-0x00010002,0x00010002,0x00020001,0x00020001,0x00030002,0x00020002,0x00010001,0x00010001,
-0x00020002,0x00010002,0x00020001,0x00020001,0x00010002,0x00000001,0x00010001,0x00010002,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xfffffffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffcfffd,0xfffbfffb,
-0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffcfffb,0xfffcfffa,0xfffafffb,0xfffbfffb,0xfffbfffb,
-0xfffcfffb,0xfffcfffb,0xfffbfffb,0xfffbfffc,0xfffbfffb,0xfffcfffc,0xfffbfffc,0xfffcfffc,
-0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffbfffc,0xfffafffc,0xfffcfffb,0xfffcfffd,0xfffbfffc,
-0xfffbfffb,0xfffdfffb,0xfffdfffb,0xfffbfffb,0xfffbfffc,0xfffbfffb,0xfffcfffb,0xfffbfffc,
-0xfffbfffb,0xfffbfffb,0xfffafffc,0xfffbfffa,0xfffcfffa,0xfffafffb,0xfffbfffb,0xfffbfffb,
-0xfffafffb,0xfffafffa,0xfff9fffa,0xfffafff9,0xfffafff9,0xfffafff9,0xfff9fffa,0xfffafffa,
-0xfff9fffa,0xfff9fffa,0xfffafffb,0xfff9fffa,0xfffafffa,0xfffbfffb,0xfffcfffb,0xfffbfffb,
-0xfffcfffb,0xfffdfffc,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xffffffff,
-0x0000ffff,0xffff0000,0x00000000,0x00000000,0x0001ffff,0x00000000,0x00010000,0x00000000,
-0x00010001,0x00010001,0x00010001,0xffff0001,0x00000001,0x0000ffff,0xffff0000,0xffffffff,
-0xfffeffff,0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,0x0000fffe,0x0000ffff,0x0001ffff,
-0x00010001,0x00010001,0x00010002,0x00010001,0x00030001,0x00030001,0x00020002,0x00030002,
-0x00030003,0x00030002,0x00040002,0x00040003,0x00040003,0x00050004,0x00050004,0x00040004,
-0x00030004,0x00030003,0x00030003,0x00030003,0x00020003,0x00020002,0x00020003,0x00020004,
-0x00030003,0x00020002,0x00020002,0x00010002,0x00020002,0x00020001,0x00020001,0x00030002,
-0x00030002,0x00030002,0x00030003,0x00020003,0x00010002,0x00020002,0x00030003,0x00020002,
-0x00020001,0x00020002,0x00020002,0x00020002,0x00010002,0x00020001,0x00020002,0x00010002,
-0x00010002,0x00010002,0x00010000,0x00020002,0x00020001,0x00010000,0x00020001,0x00020000,
-0x00020000,0x00020000,0x00010001,0x00000000,0x00000000,0x00000000,0xffff0001,0xffff0001,
-0x00000000,0xffff0000,0x0000ffff,0x00000000,0xffff0000,0x00000001,0x00020001,0x00020000,
-0x00010001,0x00010000,0x00010000,0x00010001,0x00010001,0x00020001,0x00020003,0x00010002,
-0x00000002,0x00000002,0x00020002,0x00020002,0x00010001,0x00010001,0x00020002,0x00020000,
-0x00020001,0x00010001,0x00000000,0x0000ffff,0x00000000,0x0000ffff,0xffff0000,0xffff0000,
-0xffff0001,0xffff0001,0x00000000,0x00000001,0x00000001,0xffff0000,0x00000000,0x00010000,
-0x00010000,0x00000000,0x00000000,0x00000000,0x00000001,0x0000ffff,0xfffeffff,0xfffe0000,
-0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0x0000ffff,
-0xffff0000,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0x0000ffff,0x00000000,
-0xffffffff,0xfffe0000,0x00000000,0x00000000,0xffff0000,0x00000000,0x00010001,0xffff0000,
-0x00000000,0xffffffff,0xffffffff,0xfffe0000,0xfffe0000,0xfffeffff,0xfffdffff,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffdfffd,0xfffefffd,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffe,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffffffe,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffc,0xfffcfffc,
-0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,
-0xfffefffd,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,
-0xfffefffd,0xfffefffd,0xfffefffd,0xfffffffd,0xfffefffe,0xfffcfffd,0xfffdfffe,0xfffefffe,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffdfffe,
-0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffefffe,
-0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00020002,0x00030002,
-0x00020002,0x00030002,0x00030003,0x00020003,0x00030003,0x00020003,0x00030003,0x00030003,
-0x00020003,0x00030002,0x00020002,0x00020002,0x00030002,0x00030003,0x00040002,0x00030003,
-0x00040003,0x00030004,0x00030003,0x00040004,0x00020003,0x00040003,0x00040004,0x00040003,
-0x00030004,0x00020003,0x00020002,0x00040004,0x00030004,0x00030003,0x00020003,0x00030003,
-0x00030002,0x00020003,0x00030002,0x00020003,0x00020002,0x00030002,0x00030001,0x00030002,
-0x00020002,0x00010002,0x00020002,0x00030002,0x00010002,0x00030002,0x00020002,0x00020003,
-0x00010002,0x00030003,0x00030003,0x00030002,0x00030003,0x00030004,0x00040005,0x00050005,
-0x00040005,0x00040005,0x00040004,0x00060004,0x00050004,0x00040005,0x00030004,0x00040004,
-0x00030004,0x00040005,0x00030004,0x00020002,0x00030002,0x00030002,0x00020002,0x00000001,
-0x00020001,0x00010000,0x00000000,0xffff0000,0xffffffff,0xffff0000,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffffffe,0xffff0000,
-0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffffffff,0x0000ffff,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffdfffd,
-0xfffcfffc,0xfffbfffc,0xfffbfffc,0xfffcfffc,0xfffbfffc,0xfffcfffb,0xfffbfffa,0xfffafffa,
-0xfff9fff9,0xfffbfff9,0xfffafffa,0xfff9fffa,0xfff9fff9,0xfff9fff9,0xfffafffa,0xfffafff9,
-0xfffafffa,0xfff9fffb,0xfffafffa,0xfffafff9,0xfffbfffa,0xfffbfffb,0xfffcfffb,0xfffcfffb,
-0xfffbfffb,0xfffbfffb,0xfffcfffc,0xfffbfffb,0xfffbfffb,0xfffbfffb,0xfffafffc,0xfffbfffc,
-0xfffbfffc,0xfffcfffc,0xfffbfffc,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffbfffc,
-0xfffdfffc,0xfffcfffc,0xfffdfffc,0xfffdfffd,0xfffdfffc,0xfffcfffd,0xfffefffe,0xfffdfffd,
-0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xffffffff,
-0xffffffff,0xfffefffe,0xfffefffe,0xffff0000,0x0000ffff,0xffffffff,0xffffffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010000,0x00010001,0x00020001,0x00020002,0x00020003,
-0x00010002,0x00020002,0x00020002,0x00020002,0x00030002,0x00010001,0x00030002,0x00010003,
-0x00010001,0x00020002,0x00020001,0x00020001,0x00010001,0x00010002,0x00010001,0x00010002,
-0x00010000,0x00010001,0x00010001,0x00020002,0x00000002,0x00010002,0x00020002,0x00010002,
-0x00020001,0x00020002,0x00020003,0x00020002,0x00030003,0x00030003,0x00040002,0x00040003,
-0x00030003,0x00030004,0x00030003,0x00040004,0x00040005,0x00030004,0x00040004,0x00030004,
-0x00030003,0x00040003,0x00030003,0x00030003,0x00030003,0x00020003,0x00020003,0x00020003,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020001,0x00020002,0x00020001,0x00010001,
-0x00010001,0x00010001,0x00010002,0x00010001,0x00010000,0x00010000,0xffff0000,0x00000000,
-0x00000000,0x00010000,0x00000001,0x00000000,0x00000001,0xffffffff,0xffff0000,0xffff0000,
-0xfffeffff,0xffffffff,0x00000000,0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0x00010001,
-0x00000000,0x00010000,0x00000001,0x00010000,0x00000000,0x00000001,0x00010001,0x00010000,
-0x00010000,0x0000ffff,0x00010001,0x00000001,0x00010001,0x00010000,0x00000001,0x00000000,
-0x00010001,0x00000001,0x00010000,0x00000001,0x00000000,0x0000ffff,0xffffffff,0x00000000,
-0x00000001,0x00000000,0x00000000,0xfffeffff,0xffffffff,0xffffffff,0x00000000,0xffffffff,
-0xfffffffe,0xfffffffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffdfffe,
-0xfffefffd,0xfffdfffd,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffeffff,0xfffdfffe,0xfffeffff,
-0xfffe0000,0xfffeffff,0xffffffff,0x0000ffff,0x00000000,0x00010000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,0x0000ffff,0x0000ffff,
-0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0x0000ffff,0xfffffffe,0xfffefffe,0xffffffff,
-0xffffffff,0xfffefffe,0xffffffff,0x0000ffff,0xfffffffe,0xfffffffe,0xfffeffff,0xffff0000,
-0xffff0000,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdffff,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffefffe,0xfffdfffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffe0000,0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffeffff,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,
-0xfffdfffc,0xfffcfffd,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffdfffc,
-0xfffdfffc,0xfffdfffc,0xfffefffd,0xfffefffd,0xfffefffd,0xfffdfffe,0xfffdfffe,0xfffefffd,
-0xfffefffe,0xffffffff,0xfffeffff,0xfffeffff,0xfffffffe,0xfffefffe,0xfffefffe,0xffffffff,
-0xffffffff,0xffffffff,0x00000000,0xffff0000,0x00010000,0x00020001,0x00020002,0x00020002,
-0x00010002,0x00010001,0x00010000,0x00010000,0x00020002,0x00020001,0x00020002,0x00020002,
-0x00020001,0x00020002,0x00010001,0x00020001,0x00010002,0x00010002,0x00000002,0x00010001,
-0x00000001,0x00010000,0x00000000,0x00010001,0x00010001,0x00000001,0xffff0001,0xffffffff,
-0xffff0000,0xffffffff,0x0000ffff,0x00000000,0xffff0000,0x00000000,0x00000000,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00020001,0x00020001,0x00020002,0x00020002,0x00030003,
-0x00030004,0x00030004,0x00030003,0x00040004,0x00040004,0x00040003,0x00030004,0x00040003,
-0x00040004,0x00040004,0x00040004,0x00030004,0x00040004,0x00040004,0x00040004,0x00040004,
-0x00040004,0x00030004,0x00040003,0x00030003,0x00030003,0x00030002,0x00030002,0x00030002,
-0x00010003,0x00010002,0x00020002,0x00020001,0x00020002,0x00010002,0x00020002,0x00010001,
-0x00010001,0x00020001,0x00020002,0x00020002,0x00010002,0x00020002,0x00020001,0x00020001,
-0x00020002,0x00010002,0x00010002,0x00010002,0x00020002,0x00010002,0x00010002,0x00020002,
-0x00020001,0x00030003,0x00030003,0x00010002,0x00010002,0x00010002,0x00020001,0x00010001,
-0x00020001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00000000,
-0xffff0000,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffcfffc,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffb,0xfffdfffd,
-0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffdfffc,0xfffdfffc,0xfffdfffd,0xfffefffd,
-0xfffdfffd,0xfffefffd,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffefffd,
-0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffbfffc,
-0xfffdfffc,0xfffafffc,0xfffbfffb,0xfffafffa,0xfffbfffb,0xfffafffb,0xfffafffb,0xfffafffb,
-0xfff9fffa,0xfffafffa,0xfffbfffa,0xfff9fff9,0xfff9fff9,0xfff9fff8,0xfffafff9,0xfffafffa,
-0xfffbfffa,0xfffafffb,0xfffafffa,0xfffafffb,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffefffd,
-0xfffdfffd,0xfffefffc,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffd,0xfffeffff,0xfffefffe,0xfffdfffd,
-0xfffdfffe,0xfffefffe,0xfffeffff,0xfffffffe,0xffffffff,0xffff0000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00010000,0x00010000,0x00010001,0x00010002,0x00010001,0x00010002,
-0x00020003,0x00030003,0x00030003,0x00040002,0x00030003,0x00040003,0x00030002,0x00030001,
-0x00040002,0x00030001,0x00030003,0x00020003,0x00010001,0x00020002,0x00030003,0x00030002,
-0x00030002,0x00030003,0x00030003,0x00040003,0x00040004,0x00040004,0x00030004,0x00030005,
-0x00040004,0x00050005,0x00040005,0x00040005,0x00040004,0x00040004,0x00040003,0x00030004,
-0x00030005,0x00030004,0x00020003,0x00020002,0x00010001,0x00020001,0x00000001,0x00000001,
-0x00000001,0x00000001,0x00010001,0x00010000,0x00010000,0x00010000,0x00020001,0x00010001,
-0x00010001,0x00000000,0x00000001,0x00000002,0x00010001,0x00010001,0x00010001,0x00020001,
-0x00020001,0x00010001,0x00010001,0x00000001,0x00000001,0xffff0001,0x00000001,0x00000000,
-0x00000000,0x00000000,0xffff0000,0x00000000,0x00010000,0x00000000,0x00010000,0x00000001,
-0x00000000,0xffffffff,0xffff0000,0x0000ffff,0xffff0000,0x00000000,0x0000ffff,0x0000ffff,
-0x0000ffff,0x00000000,0xffffffff,0x0000fffe,0x00010000,0x0000ffff,0xffffffff,0xfffe0000,
-0xfffffffe,0xffffffff,0xfffe0000,0x0000ffff,0x00000000,0xffff0000,0xffff0000,0x0000ffff,
-0xffffffff,0x0000ffff,0x00010000,0x00010001,0x00010000,0x00010000,0x00010000,0x00010001,
-0x00000000,0x00010001,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0xffff0000,0xffffffff,0xfffeffff,0x0000ffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,
-0xffffffff,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,0xfffffffe,0xffffffff,0xffff0000,
-0xffffffff,0xffff0000,0xffffffff,0xffff0000,0x0000ffff,0xffffffff,0x0000ffff,0x0000ffff,
-0x0000ffff,0x00000000,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffefffd,0xfffefffd,0xfffefffd,0xfffffffe,0xfffefffe,0xfffffffe,0xfffffffe,
-0xfffffffe,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,
-0xffff0000,0xffff0000,0xfffeffff,0xfffeffff,0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,
-0xfffefffe,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffdfffe,0xfffdfffc,
-0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffd,
-0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffd,
-0xfffefffd,0xfffefffe,0xfffeffff,0xfffffffe,0xfffffffe,0xffffffff,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffd,0xfffefffe,0xfffeffff,0xfffdffff,
-0xfffdfffd,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,
-0xffffffff,0x00000001,0x00000000,0x00010001,0x0000ffff,0x00000000,0x00000000,0xffffffff,
-0x0000ffff,0x00000001,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffffffff,0xffffffff,
-0xfffffffe,0x0000ffff,0xfffffffe,0xfffeffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0x00000001,0xffff0000,0x00010000,0x00010001,0x00010002,0x00010002,
-0x00020002,0x00020002,0x00020002,0x00030003,0x00030002,0x00020003,0x00030002,0x00030002,
-0x00030003,0x00020003,0x00020003,0x00020002,0x00030001,0x00020002,0x00030002,0x00020001,
-0x00010002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020001,0x00010002,
-0x00010002,0x00020002,0x00020001,0x00020001,0x00010001,0x00020002,0x00010001,0x00010002,
-0x00010001,0x00010002,0x00010002,0x00020001,0x00010001,0x00010001,0x00010001,0x00010002,
-0x00010001,0x00010002,0x00020001,0x00010001,0x00020001,0x00030002,0x00020001,0x00030001,
-0x00020002,0x00030003,0x00020003,0x00030003,0x00030003,0x00030004,0x00030005,0x00040004,
-0x00040003,0x00040003,0x00040004,0x00030004,0x00030003,0x00040003,0x00030003,0x00030003,
-0x00020002,0x00020003,0x00020002,0x00010001,0x00010001,0x00020002,0x00000002,0x00000001,
-0x00010000,0x00010001,0x00010001,0x00000000,0x00000000,0x00020000,0x00010001,0x00010000,
-0x00000000,0x00010000,0x0000ffff,0xffffffff,0x0000ffff,0xffffffff,0x0000fffe,0xfffffffe,
-0x0000ffff,0xffff0000,0xfffffffe,0xfffeffff,0xfffffffe,0xfffe0000,0xfffeffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,
-0xfffffffe,0xfffffffe,0xfffefffe,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffcfffd,
-0xfffcfffc,0xfffcfffc,0xfffafffb,0xfffbfffb,0xfffafffb,0xfffbfffa,0xfffbfffb,0xfffbfffb,
-0xfffafffa,0xfffafffb,0xfffbfffb,0xfffafffb,0xfffbfffb,0xfffbfffb,0xfffcfffc,0xfffcfffc,
-0xfffcfffb,0xfffbfffb,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffb,
-0xfffcfffc,0xfffcfffc,0xfffbfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffcfffe,0xfffdfffd,0xfffcfffc,0xfffdfffd,0xfffdfffc,
-0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffeffff,0xfffefffe,
-0xfffdfffe,0xfffdfffe,0xfffeffff,0xffffffff,0xfffeffff,0xffff0000,0xffff0000,0x00000000,
-0x00000000,0x00010001,0x00010000,0x00020001,0x00010001,0x00010002,0x00020001,0x00020002,
-0x00030002,0x00010002,0x00020002,0x00020003,0x00010001,0x00010001,0x00000001,0x00010001,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00010001,0x00000000,0x0000ffff,
-0x00000000,0x0000ffff,0x00000000,0x00000001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00020000,0x00020001,0x00020001,0x00020002,0x00020002,0x00020002,0x00020003,0x00030003,
-0x00030003,0x00030004,0x00040004,0x00030004,0x00040004,0x00050004,0x00050004,0x00040003,
-0x00040004,0x00050004,0x00050005,0x00040005,0x00040004,0x00040005,0x00030004,0x00030004,
-0x00030004,0x00030003,0x00030002,0x00020003,0x00020003,0x00020003,0x00020002,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00000001,0x0000ffff,0x00000000,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00000001,0xffff0000,0x0000ffff,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffeffff,0xfffffffe,0xfffffffd,0xfffffffe,0xfffffffe,0xfffeffff,
-0xfffffffe,0xffffffff,0xffff0000,0xffffffff,0xffff0000,0x0000ffff,0xffff0000,0xffffffff,
-0xfffffffe,0x0000ffff,0xffffffff,0xffff0000,0xffff0000,0x00000000,0xffff0000,0xffff0000,
-0xffffffff,0xffff0000,0xfffeffff,0xffffffff,0xffffffff,0x00000000,0xffff0001,0xffffffff,
-0x0000ffff,0x0000ffff,0x0000ffff,0xffff0000,0xffff0000,0xfffe0000,0xffffffff,0x0000ffff,
-0xfffefffe,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xfffefffe,0xfffeffff,0xfffeffff,
-0xfffffffe,0xfffeffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffeffff,0xfffdfffe,0xfffffffe,
-0xfffeffff,0xffffffff,0xffffffff,0xfffefffe,0xfffffffe,0xfffefffe,0xfffffffe,0xfffffffe,
-0xfffffffe,0xffffffff,0xfffefffe,0xfffeffff,0xfffffffe,0xfffefffe,0xfffffffe,0xfffefffe,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffefffe,0xfffeffff,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffeffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xffffffff,0xfffeffff,0xffffffff,0xffff0000,
-0xfffeffff,0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,0xffff0000,0x0000ffff,
-0x0000ffff,0x0000fffe,0x0001ffff,0x0000fffe,0xffffffff,0x0000ffff,0x0000ffff,0xfffffffe,
-0xffffffff,0xfffffffe,0xffffffff,0xffff0000,0xfffdffff,0xffff0000,0xfffefffe,0xfffffffe,
-0xfffffffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffffffe,0xfffffffe,
-0xfffeffff,0xfffffffd,0xfffeffff,0xfffefffe,0xfffeffff,0xfffe0000,0xffff0000,0xfffeffff,
-0xfffeffff,0xffffffff,0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xfffffffe,0xffffffff,
-0x0000ffff,0xffffffff,0x0001ffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffff0000,0xffff0000,0xffff0000,0x00000000,0x0000ffff,0x00010000,0x00010000,0x0001ffff,
-0x00010000,0x00010000,0x00010001,0x00020001,0x00010002,0x00010001,0x00000001,0x00000001,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00010002,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010002,0x00000000,0x00000000,0x00000000,0x00010001,0x00010000,
-0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00020001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,
-0x00000001,0x00010000,0x00010000,0x00010000,0x00010000,0x00010001,0x00010001,0x00010001,
-0x00000002,0x00010001,0x00020002,0x00020001,0x00010001,0x00020002,0x00030002,0x00030002,
-0x00030003,0x00030002,0x00030003,0x00020003,0x00020003,0x00030003,0x00020002,0x00010003,
-0x00020002,0x00020002,0x00020002,0x00010002,0x00010002,0x00010001,0x00010001,0x00020001,
-0x00010001,0x00020001,0x00010001,0x00010001,0x00010000,0x00010001,0x00000001,0x00000001,
-0x00000001,0x00000000,0x00000000,0x00010000,0x00010001,0x00000001,0x00000000,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00010002,0x00010000,
-0x00000000,0x00000000,0xffff0000,0xffffffff,0x0000ffff,0xffffffff,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffdfffd,0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffdfffd,0xfffcfffc,
-0xfffbfffc,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffdfffd,0xfffdfffc,
-0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffdfffe,0xfffdfffd,0xfffcfffd,0xfffcfffc,
-0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffdfffc,0xfffcfffc,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,
-0xfffcfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,
-0xfffdfffc,0xfffdfffb,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffdfffd,
-0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,
-0xfffefffd,0xfffdfffd,0xfffdfffc,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffe,0xfffffffe,
-0xfffefffe,0xffffffff,0x00000000,0xffffffff,0x00000000,0x00000000,0xffff0000,0x00000000,
-0x00000000,0x00010000,0x00010000,0x00010000,0x00000000,0x00000000,0x00020001,0x00010000,
-0x00010001,0x00020000,0x00000001,0x00000001,0x00010001,0x00000000,0xffff0000,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00010000,0x00010000,0x00010001,0x00000000,0x00010001,
-0x00010001,0x00020000,0x00020001,0x00020001,0x00020002,0x00020002,0x00020002,0x00030003,
-0x00020003,0x00030003,0x00030003,0x00030003,0x00030003,0x00030003,0x00030003,0x00030003,
-0x00030003,0x00030003,0x00030003,0x00030002,0x00030003,0x00030003,0x00030002,0x00020002,
-0x00010001,0x00010001,0x00010002,0x00010001,0x00020001,0x00020001,0x00020001,0x00010001,
-0x00010002,0x00010001,0x00010001,0x00020001,0x00020002,0x00020001,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020003,0x00020003,0x00010003,0x00020002,
-0x00010002,0x00020002,0x00020002,0x00010002,0x00020002,0x00020003,0x00020002,0x00020002,
-0x00020002,0x00020001,0x00020001,0x00020002,0x00010002,0x00020002,0x00020003,0x00020003,
-0x00010002,0x00010002,0x00010001,0x00020001,0x00020002,0x00010000,0x00010000,0x00010001,
-0x00010002,0x00020001,0x00010001,0x00000001,0x00000000,0xffff0001,0xffff0000,0xfffffffe,
-0xfffefffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffcfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,
-0xfffeffff,0xfffeffff,0xfffeffff,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffdfffd,0xfffefffd,
-0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffe,0xfffefffe,0xffffffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,
-0xffff0000,0x00000001,0xffff0000,0x0000ffff,0x00000000,0xffffffff,0xffff0000,0xffffffff,
-0xffffffff,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,0xfffefffe,0xffffffff,0xffffffff,
-0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffffffe,0xfffffffe,0x0000ffff,
-0x00000000,0xffff0000,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xfffeffff,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffefffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffcfffd,0xfffdfffc,0xfffdfffc,
-0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffffffe,0xfffeffff,0xfffefffe,
-0xffffffff,0x0000ffff,0x0000ffff,0x00000000,0x00000000,0xffff0000,0x00000000,0x00010000,
-0x00000001,0x00000000,0x00010000,0x00000000,0x00010000,0x00010000,0x00010001,0x00000000,
-0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000000,0xffffffff,0x00000000,0xfffeffff,
-0xffffffff,0x0000ffff,0xfffffffe,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffffffe,
-0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xfffffffe,0xffffffff,0xffff0000,0xffff0000,
-0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010000,
-0x00010000,0x0001ffff,0x00010000,0x00000000,0x00000001,0xffff0001,0x00000001,0x00010001,
-0x00010001,0x00010002,0x00010001,0x00020001,0x00020001,0x00010001,0x00020001,0x00020001,
-0x00020002,0x00020001,0x00020001,0x00020002,0x00020002,0x00010002,0x00010002,0x00020001,
-0x00020002,0x00010001,0x00010001,0x00020001,0x00020002,0x00010001,0x00010000,0x00010002,
-0x00010002,0x00010002,0x00010002,0x00020001,0x00020002,0x00020001,0x00020002,0x00030001,
-0x00020001,0x00020001,0x00030002,0x00020003,0x00030002,0x00030003,0x00030003,0x00030002,
-0x00030002,0x00020003,0x00030003,0x00030003,0x00030003,0x00030002,0x00030002,0x00020002,
-0x00010002,0x00010002,0x00010002,0x00010002,0x00020002,0x00010001,0x00010001,0x00000001,
-0xffff0000,0x00000000,0xffffffff,0xffff0000,0xffff0000,0x0000ffff,0x0000ffff,0x00000000,
-0x0000ffff,0x0000ffff,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0x0000ffff,0xffff0000,
-0xffff0000,0xfffeffff,0xfffeffff,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,0xfffffffe,
-0xfffffffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xfffffffd,0xfffffffe,0xfffffffe,
-0xffffffff,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffeffff,0xffffffff,0xfffeffff,
-0xfffefffe,0xfffffffe,0xfffefffe,0xfffffffd,0xfffffffe,0xfffefffe,0xfffefffd,0xfffefffe,
-0xfffdfffe,0xfffdfffd,0xfffdfffc,0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffbfffb,
-0xfffbfffc,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffb,0xfffcfffb,0xfffdfffc,
-0xfffdfffc,0xfffcfffd,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffcfffc,0xfffbfffc,
-0xfffcfffc,0xfffdfffc,0xfffdfffd,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffdfffc,
-0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffefffd,0xfffefffe,0xffffffff,0xffffffff,
-0xffffffff,0x0000ffff,0xffffffff,0x0000fffe,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00020001,0x00030002,0x00020002,
-0x00020002,0x00020002,0x00020003,0x00020003,0x00020003,0x00030002,0x00030003,0x00030003,
-0x00010003,0x00020002,0x00020002,0x00020002,0x00020002,0x00030003,0x00030002,0x00020003,
-0x00030002,0x00030003,0x00030002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00010002,0x00010002,0x00020002,0x00020002,0x00020001,0x00020003,
-0x00020004,0x00020002,0x00020002,0x00020002,0x00030002,0x00030003,0x00030002,0x00030002,
-0x00020002,0x00030002,0x00030003,0x00030002,0x00030003,0x00020003,0x00030003,0x00030002,
-0x00030002,0x00030002,0x00020002,0x00020002,0x00010001,0x00010002,0x00010001,0x00010001,
-0x00000002,0x00000001,0x00000001,0x00000000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffff0000,0xffffffff,0x0000fffe,0x0000fffe,0x0000fffe,0x0000fffe,0x0000ffff,0x0000ffff,
-0x0001fffe,0x0001ffff,0x0000ffff,0x00000000,0xffffffff,0xffffffff,0x0000ffff,0x00000000,
-0x00000001,0x00010000,0x00000000,0x00000001,0x00000001,0xffff0000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0xffff0000,0xffff0000,0xffffffff,0x00000000,0xffffffff,
-0x0000fffe,0xffffffff,0xffffffff,0xfffe0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x0000ffff,0xfffffffd,
-0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,
-0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffcfffc,0xfffdfffc,
-0xfffdfffc,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x0000ffff,0x0000ffff,0x00000000,0xffff0000,0x00000000,0x00000001,0x00000000,
-0x00000000,0x0000ffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffefffe,0xfffffffe,0xfffeffff,0xfffefffe,0xfffffffe,0xfffefffe,0xfffdfffe,
-0xfffdfffe,0xfffefffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x0000ffff,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00010000,0x00000000,0xffff0000,0x00000000,0x00000000,0xffffffff,
-0xffffffff,0xfffffffe,0x0000ffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffdfffd,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffefffe,
-0xfffdfffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffd,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,
-0x0000ffff,0x0000ffff,0x00000000,0x0000ffff,0x00000000,0x00000000,0xffff0000,0x00000000,
-0x00010001,0x00010001,0x00010001,0x00000000,0x00010000,0x00000001,0x00000001,0x00000000,
-0x00010000,0x00010000,0x0001ffff,0x00000001,0x00000001,0x00000000,0xffff0000,0x00000000,
-0x00000001,0x00000000,0x00010000,0x0001ffff,0x00010000,0x0001ffff,0x00010001,0x00000001,
-0x00010001,0x00010001,0x00020002,0x00010002,0x00010001,0x00010002,0x00010003,0x00020002,
-0x00020002,0x00020001,0x00020002,0x00020002,0x00010003,0x00020002,0x00010002,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00030002,0x00020002,0x00010002,0x00020002,0x00020002,0x00010002,0x00020002,
-0x00010001,0x00010001,0x00010000,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00000001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00020001,0x00020001,
-0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010002,0x00010002,0x00010001,0x00010001,0x00000001,0x00010000,0x00010000,0x00000000,
-0x00010001,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffffffff,0xffff0000,
-0xfffe0000,0xffffffff,0xfffefffe,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xfffffffe,
-0xfffefffe,0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffdfffe,0xfffdfffd,0xfffcfffd,0xfffefffd,
-0xfffdfffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffcfffe,0xfffdfffd,0xfffcfffe,
-0xfffcfffd,0xfffbfffc,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffcfffd,0xfffcfffc,0xfffdfffc,
-0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffbfffc,0xfffbfffc,0xfffcfffb,0xfffcfffc,
-0xfffcfffc,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffcfffb,0xfffcfffc,0xfffbfffb,
-0xfffbfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffe,0xfffdfffe,
-0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffe,0xfffffffe,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffff0000,0xffff0000,0x00000000,0x00000000,0x00010000,
-0x00000000,0xffff0001,0xfffe0000,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x00000000,
-0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffff0000,0xfffffffe,0xffffffff,
-0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffff0000,0x00000000,0x00000000,0x00000000,
-0x00010001,0x00010001,0x00020001,0x00020002,0x00030002,0x00030002,0x00020002,0x00020002,
-0x00020003,0x00030003,0x00020002,0x00020003,0x00030003,0x00030004,0x00030004,0x00020003,
-0x00010002,0x00020003,0x00020002,0x00030003,0x00030002,0x00020002,0x00020002,0x00020003,
-0x00020003,0x00020002,0x00030002,0x00030002,0x00030002,0x00030003,0x00030003,0x00020003,
-0x00020003,0x00030003,0x00030003,0x00030002,0x00020002,0x00030003,0x00020002,0x00020002,
-0x00010002,0x00010001,0x00010000,0x00010001,0x00010001,0x00010002,0x00010001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010000,0x00010000,0x00010001,0x00010001,0x00000001,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00000000,0x00000001,0x00010001,0x00000000,
-0x00010000,0x00000000,0x00010001,0x00010001,0x00000001,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xffff0000,0x00000000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0xfffeffff,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,
-0x0000ffff,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0xfffffffe,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0x0000ffff,0x0000ffff,0xfffffffe,0xffffffff,
-0xfffffffe,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xfffdffff,0xfffefffe,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffefffe,
-0xfffefffe,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffff0000,0x00000000,0x00010000,0x00010000,0x00010000,0x00010000,0x00000001,0x00000001,
-0xffff0000,0x00000000,0x0000ffff,0x00000000,0xffffffff,0xffff0000,0xffffffff,0xfffeffff,
-0xfffffffe,0xffffffff,0xfffffffe,0xfffeffff,0xfffffffe,0xfffefffe,0xfffdfffe,0xfffefffd,
-0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffdffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0x0000ffff,0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0x0000ffff,0xffff0000,
-0x0000ffff,0x00000000,0x00000001,0x00000001,0xffff0000,0x00000000,0x0000ffff,0xfffe0000,
-0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffefffd,
-0xfffefffd,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffffffe,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0x00000000,0x00000000,0x00010001,0x00010001,0x00000001,0x00000001,0x00010000,
-0x00010000,0x00010000,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010000,
-0x00010001,0x00010001,0x00010002,0x00010001,0x00010001,0x00010000,0x00010000,0x00000000,
-0x00010000,0x00010001,0x00010000,0x00010000,0x00010001,0x00010002,0x00010001,0x00000002,
-0x00010001,0x00010001,0x00000001,0x00000001,0x00000001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00020002,0x00020002,0x00020002,0x00030002,0x00030001,
-0x00020002,0x00030003,0x00030003,0x00030004,0x00030003,0x00030003,0x00030003,0x00020003,
-0x00020003,0x00030004,0x00020004,0x00030003,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010002,0x00020001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0xffff0000,
-0x00000001,0x00000001,0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0xffff0000,0x00000000,0x00000000,0xffff0000,0xffff0000,0x0000ffff,
-0xffffffff,0xfffefffe,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffefffd,
-0xfffdfffe,0xfffcfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffdfffc,0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffcfffd,
-0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffefffd,0xfffcfffd,0xfffdfffd,
-0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffdfffd,
-0xfffcfffd,0xfffcfffc,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffd,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00010000,0x00010001,0x00010001,0x00020001,0x00020002,0x00020002,
-0x00020003,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00030003,0x00030002,
-0x00020002,0x00020002,0x00020003,0x00020001,0x00020002,0x00020001,0x00010000,0x00010000,
-0x00010000,0x00010001,0x00010000,0x00010000,0x00000000,0x00020001,0x00010000,0x00000000,
-0x00010000,0x00000002,0x00000000,0x00000001,0x00000001,0x00000000,0xffff0000,0x00010001,
-0x00010001,0x00020001,0x00010001,0x00020001,0x00010001,0x00020002,0x00010002,0x00020002,
-0x00010003,0x00020002,0x00030003,0x00030002,0x00030003,0x00030003,0x00030002,0x00030003,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020003,0x00020002,0x00020003,0x00020002,
-0x00020002,0x00030002,0x00010003,0x00010002,0x00010001,0x00010000,0x00010002,0x00020001,
-0x00000002,0x00010001,0x00000001,0x00000000,0x00000001,0x00010000,0x00000000,0x0000ffff,
-0x00000000,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,
-0xfffeffff,0xffffffff,0x0000fffe,0xffffffff,0xfffe0000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,
-0x00000000,0x0000ffff,0x00000000,0x0000ffff,0xffffffff,0xffffffff,0x0000fffe,0xfffffffe,
-0xfffffffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffefffe,
-0xfffcfffe,0xfffcfffe,0xfffdfffd,0xfffcfffd,0xfffdfffc,0xfffdfffc,0xfffefffd,0xfffdfffd,
-0xfffdfffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffd,0xffffffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0001ffff,0x0000ffff,0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,0x0001ffff,0x00000000,0x0000ffff,
-0x00000000,0xffff0000,0xffffffff,0x0000ffff,0x00000000,0xffffffff,0xffffffff,0xfffeffff,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffeffff,0xfffdffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffff0000,0x0000ffff,
-0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0xffff0000,
-0xffff0001,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffffff,0xffffffff,0x0000ffff,0xfffffffe,0xffffffff,0xfffefffe,0xfffffffe,0xfffffffe,
-0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffe,
-0xfffdfffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,
-0xfffffffe,0xfffffffe,0xfffefffd,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,0xfffffffe,0x0000ffff,0x0000ffff,
-0x0000ffff,0xffff0000,0xffffffff,0x00000000,0x00000000,0xffff0000,0x0000ffff,0xffffffff,
-0x00000000,0x00000000,0xffff0000,0xfffeffff,0xffff0000,0xffff0000,0xffffffff,0xffffffff,
-0xfffe0000,0xfffeffff,0xfffefffe,0xfffffffe,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0x0000ffff,0x0000ffff,0x00010000,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x00000001,0x00010001,0x00020001,0x00010002,0x00030001,
-0x00020002,0x00030002,0x00020002,0x00020002,0x00030002,0x00030003,0x00020003,0x00020003,
-0x00030003,0x00030003,0x00030003,0x00030003,0x00020003,0x00030003,0x00020002,0x00030003,
-0x00030002,0x00020003,0x00030002,0x00020002,0x00030002,0x00020002,0x00030002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00010002,0x00010002,0x00010002,0x00010002,0x00010001,
-0x00030002,0x00020002,0x00010002,0x00020002,0x00020001,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00010001,0x00010001,0x00020001,0x00000001,
-0x00010001,0x00000000,0x00010002,0x00010001,0x00010000,0x00000001,0x00000001,0x0001ffff,
-0x00000000,0xffff0000,0xffff0000,0x0000ffff,0x0000ffff,0x0000ffff,0x00000000,0x0000ffff,
-0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,
-0xfffeffff,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffcfffd,0xfffcfffc,0xfffcfffd,
-0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffcfffc,
-0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xffffffff,0xfffeffff,0xfffefffe,0xfffffffe,
-0xfffffffe,0xfffffffe,0xfffefffe,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xfffefffe,
-0xfffdfffe,0xfffefffe,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffcfffe,
-0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffcfffe,0xfffdfffd,0xfffdfffe,0xfffdfffd,
-0xfffefffe,0xfffefffe,0xfffffffd,0xfffefffe,0xfffdfffe,0xfffefffd,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffeffff,0xffffffff,0x0000ffff,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,
-0x00010000,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00030003,0x00020003,0x00030002,0x00020003,0x00030002,0x00030003,0x00030003,0x00040003,
-0x00040003,0x00040003,0x00030004,0x00040004,0x00030003,0x00030003,0x00030003,0x00030002,
-0x00030002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010001,0x00000001,0x00000000,
-0x00000000,0x00000000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffff0000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00010001,0x00010001,0x00010001,0x00020002,
-0x00010001,0x00020002,0x00010002,0x00020001,0x00020002,0x00010001,0x00010001,0x00000001,
-0x00000001,0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0xffffffff,
-0x0000ffff,0x00000000,0x0000ffff,0x0000ffff,0x00000000,0xffffffff,0x00000000,0x00000000,
-0xffffffff,0xffff0000,0x00000000,0x00000000,0x0000ffff,0x00000000,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,0xfffeffff,
-0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffefffe,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffd,
-0xfffefffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffeffff,0xffffffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffffffe,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00000001,0x00000001,
-0x00010001,0x00010002,0x00020001,0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,
-0x00000001,0x00000001,0x00000002,0x00000000,0x00010000,0x00000000,0x00010001,0x00010001,
-0x00010000,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffff0000,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0x0000ffff,0xffff0000,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,
-0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xfffeffff,
-0xfffffffe,0xfffefffe,0xfffeffff,0xffffffff,0xffff0000,0xffffffff,0xfffeffff,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,
-0xfffdffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,
-0xffffffff,0xfffeffff,0xfffffffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffffffd,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0x0000ffff,0x0000ffff,
-0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0xffff0000,0x0000ffff,
-0x00000000,0xffff0000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00010000,0x00000000,0x00000001,0x00000000,0x00000001,0x00010001,0x00000000,0x00000001,
-0x00000001,0x00010001,0x00020002,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010000,0x00010001,0x00010001,0x00010002,0x00000001,0x00010001,0x00010001,
-0x00020001,0x00020002,0x00010002,0x00010001,0x00020002,0x00020001,0x00020001,0x00020001,
-0x00020001,0x00020002,0x00020002,0x00020002,0x00010002,0x00020002,0x00010002,0x00020002,
-0x00020002,0x00020003,0x00020002,0x00030002,0x00030002,0x00040002,0x00030003,0x00030003,
-0x00030003,0x00020002,0x00020001,0x00020002,0x00010002,0x00010002,0x00010002,0x00010001,
-0x00010002,0x00010002,0x00010001,0x00000001,0x00000000,0x00010000,0x00010000,0x00010000,
-0x00010000,0x00010001,0x00010001,0x00010000,0x00010001,0x00020000,0x00010000,0x00010000,
-0x00010001,0x00010001,0x00020001,0x00010001,0x00010001,0x00010002,0x00010002,0x00010001,
-0x00010001,0x00010000,0x00000001,0x00000000,0x00010000,0x00010000,0x0000ffff,0x00000000,
-0xffff0000,0xffffffff,0xffffffff,0xfffffffe,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffc,0xfffcfffc,
-0xfffbfffc,0xfffcfffb,0xfffcfffb,0xfffcfffb,0xfffbfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffc,
-0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffdffff,0xfffeffff,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffd,0xfffffffe,0xfffeffff,
-0xfffefffe,0xfffeffff,0xffffffff,0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xffffffff,0x0000ffff,0x0000fffe,0x0001ffff,0x00000000,0x0000ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00010001,0x00010001,0x00000000,
-0x00010000,0x00020001,0x00010001,0x00020001,0x00010001,0x00010002,0x00010001,0x00010001,
-0x00010002,0x00010002,0x00010002,0x00010001,0x00020001,0x00010002,0x00010002,0x00010001,
-0x00010000,0x00010001,0x00020000,0x00010001,0x00010001,0x00010002,0x00020001,0x00020001,
-0x00010002,0x00020002,0x00020001,0x00020002,0x00020002,0x00030003,0x00030003,0x00020003,
-0x00020003,0x00020003,0x00020003,0x00020003,0x00020003,0x00020002,0x00020002,0x00030003,
-0x00030003,0x00030003,0x00020003,0x00030003,0x00020003,0x00030002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020001,0x00010001,0x00010001,0x00000000,
-0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,0xffff0000,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffffffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,
-0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0x0000fffe,0xffffffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000001,
-0x00010001,0x00000000,0x00000001,0x00000001,0x00000000,0x00000001,0x00000001,0xffff0000,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,
-0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffeffff,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xfffffffe,
-0xfffeffff,0xfffeffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0x00000000,0x00000000,0x00010000,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010001,0xffff0000,0x00000000,0x00000001,0x00000000,
-0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0x0000ffff,0x00000000,0x0000ffff,0x00010000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x00010001,0x00000000,0x0000ffff,0x00000000,0x00000000,
-0x00000000,0x00000001,0x00000001,0x00000000,0x00000001,0x00000000,0x00000000,0xffff0000,
-0xffff0000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,
-0xfffffffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,
-0xfffffffe,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffffffe,
-0xffffffff,0x0000ffff,0xfffeffff,0xffffffff,0xfffffffe,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0x0000ffff,0x00000000,0xffff0000,0xffff0000,0xffff0000,0xffff0000,0xfffeffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffeffff,0xffffffff,0xffff0000,
-0xffffffff,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,0xffffffff,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00010000,0x00010001,0x00010001,0x00010001,0x00000002,
-0x00000001,0x00000002,0x00010002,0x00010001,0x00020002,0x00020002,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00020001,0x00010002,0x00010002,0x00010001,0x00020001,0x00020002,
-0x00020002,0x00020001,0x00010000,0x00020001,0x00020001,0x00020002,0x00020002,0x00020002,
-0x00030002,0x00030002,0x00020002,0x00030002,0x00030002,0x00030003,0x00020003,0x00020003,
-0x00020003,0x00020003,0x00030003,0x00020002,0x00020002,0x00030002,0x00030003,0x00030003,
-0x00040003,0x00030002,0x00030002,0x00030003,0x00030002,0x00020002,0x00030002,0x00020002,
-0x00020002,0x00010002,0x00010002,0x00010002,0x00020002,0x00020001,0x00000001,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0x0000ffff,0xffff0000,0xffff0000,0x00000000,0xffff0000,
-0xffff0000,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,
-0xffffffff,0xfffefffe,0xffffffff,0xffffffff,0xfffefffd,0xffffffff,0xfffeffff,0xfffdfffe,
-0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffc,0xfffdfffc,0xfffdfffc,0xfffcfffd,0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffcfffc,
-0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffcfffb,0xfffcfffc,0xfffcfffc,0xfffbfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffcfffc,0xfffdfffc,
-0xfffcfffd,0xfffdfffc,0xfffcfffc,0xfffdfffc,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffff0000,0x0000ffff,0xffff0000,0xffff0000,0x00000001,0x00010001,0x00000001,0x00000000,
-0x00010000,0x00010000,0x00010001,0x00000001,0x00000001,0x00000001,0x00000001,0x00010000,
-0x00010000,0x00010000,0x00010001,0x00000001,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00010000,0x00020001,0x00020001,0x00010001,0x00010001,0x00010002,
-0x00020002,0x00020002,0x00030002,0x00020002,0x00030002,0x00020002,0x00030002,0x00030003,
-0x00020002,0x00020002,0x00020003,0x00010002,0x00020002,0x00020002,0x00020002,0x00010002,
-0x00010002,0x00020001,0x00010001,0x00020001,0x00020001,0x00020001,0x00020002,0x00020002,
-0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,
-0x00010001,0x00010000,0x00010000,0x00010000,0x00010001,0x00010000,0x00000001,0x00010000,
-0x00000000,0xffff0000,0x00000000,0x00000000,0xffff0000,0x00000000,0xffff0000,0xffffffff,
-0x00000000,0x0000ffff,0xffffffff,0x0000ffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffeffff,
-0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffd,
-0xfffffffd,0xfffffffe,0xfffffffd,0xfffefffe,0xfffefffd,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xfffffffe,0xfffeffff,0xfffefffe,0xffffffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,
-0xfffe0000,0xffff0000,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0x0000ffff,0x0000ffff,
-0x0000ffff,0xffff0000,0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0x00000001,0x00010001,0x00010001,0x00010001,0x00000000,0x00000001,0x00010000,
-0x00000000,0x00000001,0x00010000,0x00010001,0x00010000,0x00000001,0x00010001,0x00010001,
-0x00000001,0x00010000,0x00000001,0x00010001,0x00010001,0x00010001,0x00010000,0x00000001,
-0x00010001,0x00010000,0x00010000,0x00000000,0x00000001,0x00010001,0x00010001,0x00010000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,0x00010000,0x00000000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00010000,0x00010002,0x00010001,0x00010001,
-0x00010000,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,
-0x00010000,0x00010001,0x00000001,0x00000000,0x00000001,0xffff0000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xfffefffe,
-0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffdfffe,
-0xfffdfffe,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffdfffd,
-0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffefffd,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0x00000000,
-0xffff0000,0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00010001,0x00010001,
-0x00010001,0x00010000,0x00010001,0x00010001,0x00000001,0x00000001,0x00010000,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00010002,0x00020002,0x00020002,0x00020001,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020003,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00030002,0x00020002,0x00030002,0x00030003,
-0x00020003,0x00030003,0x00030003,0x00030003,0x00030003,0x00030003,0x00020003,0x00020003,
-0x00020002,0x00020003,0x00020002,0x00020001,0x00010002,0x00010001,0x00010001,0x00000000,
-0x00010001,0x00000000,0x0000ffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffefffe,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffffffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffefffe,0xfffffffe,0xffffffff,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffd,0xfffcfffc,0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffcfffd,0xfffcfffc,
-0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0xfffffffe,0xffffffff,0xffffffff,0xffff0000,0x00010000,0x0000ffff,0x00010000,
-0x00010000,0x00010000,0x00010000,0x00000000,0x00000000,0x00010000,0x00000000,0x00000001,
-0x00000001,0x00010001,0x00000001,0x00010000,0x00000000,0x00000001,0x00010001,0x00000000,
-0x00010001,0x00010000,0x00010000,0x00010000,0x00010001,0x00020002,0x00010001,0x00020002,
-0x00010002,0x00010001,0x00020001,0x00020002,0x00020002,0x00030002,0x00030002,0x00030002,
-0x00020002,0x00020002,0x00020003,0x00010003,0x00020002,0x00030002,0x00030002,0x00020002,
-0x00020002,0x00030003,0x00030002,0x00030002,0x00030002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00030002,0x00020002,0x00020003,0x00020002,0x00020003,0x00020002,0x00010002,
-0x00020002,0x00010001,0x00010001,0x00010000,0x00010000,0x00010001,0x00000000,0x00000000,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0xffff0000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x00000000,0xffff0000,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xfffeffff,
-0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffdfffe,0xfffdfffe,
-0xfffefffe,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffc,0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffeffff,0xffffffff,0xfffffffe,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0xffff0000,0xffffffff,0xffffffff,0xffff0000,
-0xfffeffff,0x00000000,0xffff0000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00010001,0x00010001,0x00010001,0x00020001,0x00020002,0x00020002,
-0x00020002,0x00030002,0x00020002,0x00030003,0x00030003,0x00030002,0x00030003,0x00030003,
-0x00030003,0x00030002,0x00030002,0x00020003,0x00030003,0x00020003,0x00020002,0x00010002,
-0x00020003,0x00020002,0x00020002,0x00010002,0x00010001,0x00000001,0x00010001,0x00010000,
-0x00010000,0x00010001,0x00000000,0x00010001,0x00000000,0x00000000,0xffff0000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010001,0x00010002,0x00010000,0x00010000,0x00000000,
-0x00010000,0x00010000,0x00000001,0x00000001,0x00010000,0x00010000,0x00010000,0x00000000,
-0x00000000,0xffffffff,0x00000000,0xffff0000,0xffffffff,0xffff0000,0xffff0000,0xffff0000,
-0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0xfffffffe,0xffffffff,0xffffffff,0xffff0000,0x00000000,0x0000ffff,0x00000000,0x00000000,
-0xffffffff,0x00000000,0x00000000,0xffff0000,0x00000000,0x0000ffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,
-0xffffffff,0xffffffff,0x00000000,0xffffffff,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,
-0x0000ffff,0xffffffff,0x0000ffff,0xffff0000,0xffffffff,0x00000000,0xffffffff,0x0000ffff,
-0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00010000,0x00010000,0x00010001,0x00010001,0x00000001,0x00010001,0x00010001,0x00010001,
-0x00000001,0x00000001,0x00010001,0x00010000,0x00010001,0x00000001,0x00010000,0x00010000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00000000,0x00000001,
-0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00000001,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000001,0xffff0000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,
-0xfffffffe,0xffffffff,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffeffff,0xfffffffe,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00020002,0x00020002,0x00020001,0x00020002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010002,0x00020002,0x00020002,
-0x00020002,0x00020003,0x00020002,0x00020002,0x00020002,0x00020002,0x00030002,0x00020002,
-0x00020002,0x00020003,0x00020002,0x00020002,0x00020003,0x00020001,0x00020002,0x00020001,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010000,0x00000000,
-0x00000000,0xffff0000,0x0000ffff,0x00000000,0xffff0000,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffeffff,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffd,
-0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffefffc,0xfffdfffd,
-0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffbfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,0xfffdfffc,
-0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffefffe,0xfffeffff,0xfffefffe,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,
-0xfffeffff,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010001,0x00000001,0x00000000,0x00000001,0x00000001,
-0x00010000,0x00010000,0x00010000,0x0001ffff,0x00000000,0x00010000,0x00000000,0x00010000,
-0x00000000,0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00010000,0x00010000,0x00000001,0x00010000,0x00010000,0x00010001,0x00020001,0x00020002,
-0x00030001,0x00030002,0x00030002,0x00030002,0x00020002,0x00020002,0x00010002,0x00020002,
-0x00020002,0x00010002,0x00020002,0x00020002,0x00020001,0x00010002,0x00010001,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,
-0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010000,
-0x00010000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0xffff0000,0x00000000,0x00000000,0x0000ffff,0xffff0000,0xffff0000,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffffffe,0x0000ffff,0xffffffff,
-0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0x0000ffff,0xffff0000,0xffffffff,0x0000ffff,
-0xffff0000,0xffffffff,0xffffffff,0xfffe0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,
-0x0000fffe,0xffffffff,0x0000ffff,0xfffeffff,0xffffffff,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffe0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffff0000,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,0xffff0000,0x0000ffff,0xffff0000,
-0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,0x00000000,0x00000000,0x00000001,
-0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00000001,0x00010001,0x00010001,
-0x00010001,0x00000000,0x00010001,0x00010000,0x00010000,0x00000000,0x00010000,0x00010000,
-0x00000001,0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x0000ffff,
-0x0000ffff,0x0000ffff,0x0000ffff,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffefffd,
-0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffeffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffff0000,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00010001,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0xffff0000,0xffff0000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000001,0x00000000,
-0x00000000,0x00010001,0x00000001,0x00020001,0x00010001,0x00020001,0x00020001,0x00010002,
-0x00020002,0x00010002,0x00020001,0x00020002,0x00020002,0x00010002,0x00020002,0x00020002,
-0x00020001,0x00020002,0x00020001,0x00020001,0x00020002,0x00010002,0x00020002,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00010002,0x00010001,
-0x00020001,0x00020001,0x00020002,0x00010002,0x00020002,0x00020002,0x00010002,0x00020002,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,0x00010001,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,0x00010001,0x00000001,0x00010001,
-0x00000001,0x00010000,0x00000001,0x00000000,0x00000000,0x00000000,0x0000ffff,0xfffffffe,
-0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xffffffff,0xfffffffe,0xfffefffe,
-0xfffffffd,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,
-0xfffcfffd,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffc,0xfffdfffc,
-0xfffcfffc,0xfffdfffd,0xfffcfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffeffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000000,
-0x00000000,0x00010001,0x00010001,0x00010001,0x00010000,0x00010000,0x00010001,0x00000001,
-0x00000001,0x00010000,0x00010001,0x00010000,0x00010001,0x00000001,0x00010001,0x00010002,
-0x00010002,0x00010002,0x00020002,0x00010002,0x00020002,0x00020001,0x00020001,0x00020002,
-0x00010002,0x00020001,0x00020002,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00010001,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020002,0x00020001,
-0x00010001,0x00000001,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010000,0x00010001,0x00010000,0x00000001,0x00000000,0xffff0000,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffff0000,
-0xffff0000,0x00000000,0xffffffff,0xffff0000,0xffff0000,0x00000000,0xffff0000,0x00000000,
-0x00000000,0xffff0000,0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffd,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffd,0xfffcfffe,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffe,0xfffeffff,0xfffffffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,
-0xffffffff,0xffffffff,0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,
-0x00000000,0x00010000,0x00010000,0x00010000,0x00010000,0x00000000,0x00010001,0x00010000,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00010001,
-0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000001,0x00000001,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffefffe,0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0xfffeffff,0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0x0000ffff,0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x0000ffff,0x00010000,0x00010000,0x00000000,0x00010000,0x00010000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x0000ffff,0xffff0000,
-0xffff0000,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffffffe,0xfffefffe,0xfffdfffd,
-0xfffefffd,0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffcfffd,0xfffcfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffeffff,
-0xffffffff,0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020002,
-0x00020002,0x00020002,0x00020001,0x00020002,0x00020002,0x00020001,0x00020001,0x00020002,
-0x00010002,0x00010002,0x00010002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010001,
-0x00010001,0x00010001,0x00010000,0x00010001,0x00010000,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00020002,0x00020002,0x00020002,0x00020003,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020001,
-0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00010002,0x00010001,0x00000001,
-0x00000001,0x00000000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x0000ffff,0x00000000,
-0x0000ffff,0xffffffff,0x00000000,0x00000001,0x00010000,0x00000000,0x00000001,0x00000001,
-0xffff0001,0xffff0000,0x00000000,0xffff0000,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,0xffffffff,0xfffeffff,0xffffffff,
-0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,
-0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffcfffc,0xfffdfffd,0xfffdfffc,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00020001,0x00010002,0x00020002,0x00030003,0x00030002,0x00020002,0x00030003,0x00030003,
-0x00030003,0x00020003,0x00020003,0x00020003,0x00020003,0x00020003,0x00030003,0x00020003,
-0x00020003,0x00030002,0x00030002,0x00020002,0x00030002,0x00030002,0x00020003,0x00020003,
-0x00020002,0x00020002,0x00010001,0x00010002,0x00020002,0x00020001,0x00010002,0x00020001,
-0x00010001,0x00010000,0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00010001,0x00000001,0x00000001,0x00000000,0x00000001,
-0x00000000,0x00000000,0x0001ffff,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,
-0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x00000000,0x0000ffff,0xffffffff,
-0xffff0000,0xffffffff,0xffff0000,0x00000000,0xffff0000,0xffff0000,0x0000ffff,0xffffffff,
-0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffdfffd,0xfffdfffe,
-0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffefffd,
-0xfffefffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,
-0x0000ffff,0xffffffff,0x00000000,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x0000ffff,
-0xffff0000,0x00000000,0x00000000,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,
-0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00010000,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00010001,0x00010002,0x00010002,
-0x00000002,0x00010002,0x00010002,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010002,0x00010001,0x00010001,0x00000000,0x00000000,0x00000000,
-0x0000ffff,0x00000000,0xffff0000,0x0000ffff,0x00010000,0xffff0000,0x0000ffff,0x0000ffff,
-0xffffffff,0xffffffff,0x00000000,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xfffefffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffdfffe,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,
-0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000000,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,
-0x0000ffff,0x0000ffff,0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffffffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,0xfffefffe,0xfffffffe,0xffffffff,
-0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffff0000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00020001,0x00020001,0x00010001,0x00020001,0x00020002,0x00020003,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010002,0x00020002,
-0x00020003,0x00020002,0x00020002,0x00020003,0x00020002,0x00020002,0x00020002,0x00020002,
-0x00020002,0x00020001,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00020001,
-0x00010002,0x00020001,0x00010002,0x00010002,0x00010002,0x00010002,0x00000001,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00010000,0x00000001,0x00000000,
-0xffff0000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,
-0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffdffff,
-0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffd,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffc,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,
-0xffffffff,0xffffffff,0x0000ffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000001,0x00010000,0x00010000,0x00010000,0x00010000,0x00010000,0x00010000,0x00010000,
-0x00010000,0x00010000,0x00010001,0x00020001,0x00020001,0x00020001,0x00020001,0x00010001,
-0x00020002,0x00020001,0x00010002,0x00010001,0x00010002,0x00010002,0x00010001,0x00010001,
-0x00010001,0x00020002,0x00020002,0x00010002,0x00010002,0x00020002,0x00020003,0x00020003,
-0x00030002,0x00020003,0x00020002,0x00030002,0x00030002,0x00030002,0x00020002,0x00020002,
-0x00020003,0x00030003,0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010002,
-0x00010002,0x00020002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00000000,
-0x00000001,0x00000000,0xffffffff,0xffffffff,0x00000000,0xffff0000,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffdfffe,
-0xfffdfffe,0xfffdfffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00010001,0x00000001,
-0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,0x00000000,
-0x0000ffff,0x0000ffff,0xffff0000,0x00000000,0x0000ffff,0xffffffff,0x0000ffff,0x00000000,
-0x00000000,0x0000ffff,0x0000ffff,0x00000000,0x00000000,0xffff0000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00010001,0x00010001,
-0x00010000,0x00000001,0x00000001,0x00010001,0x00000001,0x00010000,0x00000000,0x00010000,
-0x00010001,0x00000000,0x00000000,0x00010000,0x00000000,0x00010000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xffff0000,0x00000000,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffeffff,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffefffe,
-0xffffffff,0xffffffff,0xfffefffe,0xfffeffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffeffff,
-0xfffffffe,0xfffeffff,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffffffe,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0x00000000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00010000,0x00000000,0x00010000,0x00000000,0x00000001,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,
-0x00000000,0x00000001,0x00000000,0x00010000,0x00010001,0x00010001,0x00010001,0x00010000,
-0x00010000,0x00000001,0x00000001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010000,0x00000000,0x00010000,
-0x00010000,0x00010000,0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00020001,0x00020002,0x00010001,0x00020002,0x00010002,
-0x00020002,0x00020002,0x00010002,0x00010001,0x00020002,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00000000,0x00000000,0x00010001,0x00010000,0x00000000,0x00010000,0x00000000,0x00000000,
-0xffffffff,0xffff0000,0x00000000,0x00000000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffcfffc,0xfffdfffc,
-0xfffdfffd,0xfffdfffc,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffffffe,0xfffefffe,0xfffffffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00010000,0x00000000,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00020001,0x00020002,0x00010001,0x00020001,
-0x00020001,0x00010002,0x00020001,0x00020001,0x00020001,0x00020002,0x00020001,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020002,0x00020002,0x00010002,0x00010002,0x00020002,
-0x00020002,0x00020002,0x00020002,0x00020001,0x00020002,0x00020002,0x00020002,0x00010002,
-0x00020001,0x00020001,0x00010001,0x00020001,0x00020001,0x00010001,0x00010000,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00010001,0x00010001,0x00010001,
-0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,
-0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffdfffe,0xfffefffd,0xfffefffd,
-0xfffdfffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffefffd,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xffffffff,0xfffffffe,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,
-0x0000fffe,0xffffffff,0xfffefffe,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,
-0xfffffffe,0xfffffffe,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,
-0x00000001,0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010001,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00010000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00010001,0x00000000,0x00000000,
-0x00000000,0x00010001,0x00010001,0x00000001,0x00000000,0x00000000,0x00000000,0xffff0000,
-0x00000000,0xffffffff,0x0000ffff,0x00000000,0xffff0000,0xffffffff,0xffffffff,0xfffeffff,
-0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffdfffe,0xfffefffd,0xfffefffe,0xfffdfffd,
-0xfffefffd,0xfffefffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0xffffffff,0xffffffff,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffffffff,0x00000000,0x0000ffff,0xffffffff,0x0000ffff,
-0x00000000,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0xffffffff,0xfffeffff,0xffff0000,0x0000ffff,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00010000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00020002,
-0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00010002,0x00010001,0x00010002,
-0x00000002,0x00010001,0x00010000,0x00010000,0x00010000,0x00010001,0x00010000,0x00010001,
-0x00010001,0x00010001,0x00000001,0x00010001,0x00010001,0x00010000,0x00010001,0x00000001,
-0x00010001,0x00010001,0x00000001,0x00000001,0x00000001,0x00010000,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00000000,0x00000000,
-0x00010001,0x00000001,0x00000001,0x00010001,0x00000000,0x00000001,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x0000ffff,0x0000ffff,
-0x00000000,0x0000ffff,0x00000000,0xffffffff,0xffff0000,0xffff0000,0xffff0000,0xffff0000,
-0x0000ffff,0xffffffff,0x00000000,0x0000ffff,0x0000ffff,0x0000fffe,0xffffffff,0xfffffffe,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffefffd,0xfffdfffe,0xfffdfffe,0xfffdfffd,0xfffefffd,0xfffdfffd,
-0xfffefffd,0xfffefffd,0xfffefffd,0xfffefffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffe,0xfffefffd,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffdfffd,
-0xfffefffd,0xfffdfffd,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0xffffffff,0x00000000,
-0xffff0000,0x00000000,0xffff0000,0x00000000,0x00000000,0xffff0000,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010000,0x00010000,0x00010000,0x00000001,0x00010000,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020002,0x00010002,0x00010002,
-0x00020002,0x00010002,0x00010002,0x00010002,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010002,0x00020001,0x00020001,0x00020001,0x00020001,0x00020002,
-0x00010002,0x00010002,0x00010002,0x00010002,0x00020002,0x00020002,0x00020002,0x00010002,
-0x00010002,0x00020001,0x00020002,0x00010001,0x00020001,0x00020001,0x00010001,0x00010001,
-0x00010001,0x00000001,0x00000001,0x00000001,0x00000001,0x00000000,0x0000ffff,0xffff0000,
-0x00000000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffeffff,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffdfffe,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffcfffd,0xfffdfffd,0xfffdfffd,
-0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,0xfffdfffd,
-0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0xffffffff,
-0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x00000000,0x0000ffff,0x00000000,0x00010000,
-0x00010000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000001,0x00010000,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,
-0x00010000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000001,0x00000001,
-0x00000001,0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010002,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010000,0x00010000,
-0x00000000,0x00000000,0x00000001,0xffff0000,0xffffffff,0x0000ffff,0xffffffff,0xffff0000,
-0x00000000,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0x0000fffe,0xffffffff,0xffffffff,
-0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffff0000,0x00000000,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffdfffd,0xfffefffd,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xffffffff,0xfffffffe,
-0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0x00000000,0xffff0000,0xffff0000,0x0000ffff,0x00000000,0x00000000,0xffff0000,
-0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00000000,0x00010000,
-0x00010001,0x00000001,0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00000001,0x00000000,0x00000001,0x00010001,
-0x00010001,0x00000000,0x00010000,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010001,0x00000001,0x00000001,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0xffff0000,0x00000000,
-0x0000ffff,0x00000000,0xffff0000,0x00000000,0xffffffff,0xffff0000,0xffff0000,0xffffffff,
-0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffeffff,0xfffffffe,0xffffffff,0xfffeffff,0xfffffffe,
-0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffffffe,0xfffffffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,
-0xfffffffe,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0xffff0000,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,0x0000ffff,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00010001,0x00010000,0x00010001,0x00010001,0x00000001,
-0x00010000,0x00000001,0x00000001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00000001,0x00000000,0x00000000,0x00000001,0x00010001,0x00000001,0x00010000,
-0x00000000,0x00010000,0x00010000,0x00010000,0x00000000,0x00000000,0x00000001,0x00000000,
-0x00010000,0x00000000,0x00010001,0x00000001,0x00000001,0x00000001,0x00000000,0x00000001,
-0x00000001,0x00000000,0x00000000,0x00010001,0x00010000,0x00010001,0x00010000,0x00010000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,0xffffffff,
-0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xffffffff,
-0x0000ffff,0xffffffff,0x0000ffff,0x00000000,0x0000ffff,0x00000000,0xffff0000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,0x00000000,
-0x00010001,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,0x00010001,0x00010001,
-0x00010001,0x00010000,0x00010000,0x00000000,0x00000000,0x00010000,0x00000001,0x00000000,
-0x00000001,0x00000001,0x00000000,0x00000001,0x00000001,0x00000000,0x00010000,0x00010000,
-0x00010000,0x00010000,0x00000000,0x00010000,0x00000000,0x00000001,0x00010001,0x00000001,
-0x00000001,0x00000001,0x00000000,0x00000000,0x00010001,0x00010001,0x00010000,0x00000001,
-0x00000001,0x00000000,0x00010000,0x00010000,0x00000001,0x00010001,0x00000000,0x00000001,
-0x00000001,0x00000001,0x00000001,0x00000001,0x00000001,0x00010000,0x00000000,0x00010000,
-0x00000000,0x0000ffff,0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000000,0xffff0000,
-0xffff0000,0x0000ffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffeffff,0xfffeffff,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffeffff,0xfffffffe,0xffffffff,0xfffffffe,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000001,0x00000001,0x00000001,0x00010001,0x00000001,
-0x00010000,0x00010000,0x00010000,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,
-0x00000001,0x00000000,0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00020001,0x00020001,0x00020001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010000,0x00000001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010000,0x00010001,0x00000001,0x00000001,0x00000001,0x00010001,0x00010001,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,
-0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0xffffffff,0xffffffff,0xffff0000,0xffff0000,0xffffffff,
-0xffffffff,0x0000ffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0xffffffff,
-0x0000ffff,0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,
-0x0000ffff,0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xffff0000,0xffff0000,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000001,
-0x00010001,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0x00000000,0x0000ffff,0x0000ffff,
-0x00000000,0x0000ffff,0x0000ffff,0xffffffff,0xffff0000,0xffff0000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0x00000000,0x0000ffff,
-0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffefffe,0xfffeffff,
-0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x00000000,0xffff0000,0xffffffff,0x0000ffff,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00010000,0x00000000,0x00010000,0x00000001,0x00000001,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00010000,0x00010000,0x00010000,0x00000001,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00000001,0x00010001,0x00010001,0x00010000,0x00010001,0x00000000,0x00010000,
-0x00010000,0x00000000,0x00000000,0x00010000,0x00000001,0x00010000,0x00010001,0x00010000,
-0x00000001,0x00010001,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0001,0x00000000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xfffffffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,
-0xfffffffe,0xfffffffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffefffd,
-0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffffffe,0xffffffff,0xfffffffe,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0x00000000,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010001,0x00010001,0x00010000,0x00010000,0x00000001,
-0x00000001,0x00000001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,0x00010000,0x00010001,0x00020001,
-0x00010001,0x00020001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00010001,0x00010000,0x00010001,0x00000001,0x00000001,0x00000001,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffffff,0xffff0000,0xffff0000,0x00000000,0xffff0000,0x0000ffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffdfffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffff0000,0xffff0000,0x00000000,
-0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0000ffff,0x0000ffff,0xffff0000,0x0000ffff,0x0000ffff,0x00000000,0xffffffff,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000000,0x00000000,0x00010000,0x00000001,0x00010000,0x00010000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xffffffff,0x0000ffff,0x00000000,0xffff0000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffeffff,0xffffffff,0xfffffffe,0xfffffffe,0xffffffff,0xfffefffe,0xfffefffe,0xfffeffff,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xffffffff,0xffffffff,
-0xfffffffe,0xfffefffe,0xfffffffe,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,
-0x0000ffff,0xffffffff,0xffffffff,0xffff0000,0x00000000,0xffff0000,0xffffffff,0x00000000,
-0xffffffff,0x00000000,0x00000000,0x00000000,0xffff0000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00010001,0x00000001,0x00000000,0x00000001,0x00000000,0x00000001,
-0x00010001,0x00000001,0x00010000,0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,
-0x00010000,0x00000000,0x00000001,0x00000001,0x00000000,0x00010000,0x00010001,0x00000000,
-0x00010001,0x00010001,0x00010000,0x00010001,0x00010001,0x00010000,0x00010000,0x00010000,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00000001,0x00000001,0x00010001,0x00000001,0x00000000,0x00000000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x0000ffff,0xffffffff,0x0000ffff,0x00000000,0xffffffff,
-0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,0xfffeffff,0xffffffff,
-0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffd,0xfffefffe,0xfffefffe,0xfffdfffe,
-0xfffefffe,0xfffefffd,0xfffefffe,0xfffdfffe,0xfffdfffd,0xfffdfffe,0xfffdfffe,0xfffdfffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,
-0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffff0000,
-0xffff0000,0x0000ffff,0x0000ffff,0xffffffff,0x00000000,0x00000000,0x00000001,0x00000000,
-0x00000000,0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010002,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00020002,0x00010001,0x00010001,0x00010001,0x00010001,
-0x00020001,0x00020002,0x00010002,0x00010001,0x00010001,0x00010001,0x00020001,0x00010001,
-0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00000001,0x00010001,
-0x00010000,0x00010001,0x00010001,0x00000001,0x00010000,0x00010001,0x00000000,0x00000000,
-0x00010000,0x00000000,0x00010000,0x00010001,0x00000000,0x00010000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffffffe,0xffffffff,0xffffffff,0xfffffffe,0xfffeffff,0xffffffff,0xfffeffff,0xfffefffe,
-0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xffffffff,0xfffffffe,0xfffffffe,
-0xffffffff,0xfffeffff,0xfffefffe,0xffffffff,0xfffffffe,0xfffefffe,0xffffffff,0xfffeffff,
-0xfffefffe,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffffffe,0xfffffffe,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffeffff,
-0xfffefffe,0xfffffffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffeffff,0xffffffff,0xfffffffe,
-0xffffffff,0xfffffffe,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0x0000ffff,0xffff0000,
-0x0000ffff,0xffff0000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00010001,0x00000000,0x00000001,0x00000000,0x00000001,0x00000000,0x00010000,
-0x00010000,0x00010001,0x00010001,0x00010001,0x00010001,0x00010001,0x00010000,0x00000000,
-0x00000001,0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00000001,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xffff0000,0xffff0000,0xffff0000,0x00000000,0x00000000,0xffffffff,0xffffffff,
-0xffffffff,0xfffffffe,0xffffffff,0xfffeffff,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,
-0xfffffffe,0xfffeffff,0xfffefffe,0xffffffff,0xfffefffe,0xfffffffe,0xfffffffe,0xfffeffff,
-0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00010000,
-0x00010001,0x00010001,0x00010001,0x00000001,0x00000000,0x00000000,0x00010000,0x00010000,
-0x00010000,0x00010000,0x00010000,0x00010001,0x00000000,0x00000001,0x00000000,0x00000000,
-0x00010000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00010001,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffff0000,0xffff0000,0xffff0000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffefffe,0xffffffff,0xfffffffe,0xffffffff,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffefffe,0xfffffffe,0xfffefffe,0xfffeffff,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,
-0xfffefffe,0xfffffffe,0xfffefffe,0xfffefffe,0xfffffffe,0xfffffffe,0xfffffffe,0xfffefffe,
-0xfffefffe,0xfffefffe,0xfffefffe,0xfffefffe,0xfffeffff,0xfffefffe,0xfffefffe,0xfffefffe,
-0xfffefffe,0xffffffff,0xfffffffe,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0xffff0000,0xffffffff,0xffffffff,0x00000000,0xffffffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00010000,0x00000001,0x00010000,0x00010000,0x00000000,0x00000001,0x00010001,0x00000001,
-0x00000001,0x00010000,0x00000000,0x00010000,0x00010000,0x00010000,0x00010001,0x00010001,
-0x00000001,0x00000001,0x00010000,0x00010001,0x00000001,0x00000001,0x00000001,0x00000001,
-0x00010000,0x00010000,0x00010001,0x00010000,0x00010000,0x00010001,0x00010001,0x00000001,
-0x00000001,0x00010001,0x00010001,0x00000001,0x00010001,0x00010000,0x00000000,0x00000001,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0x0000ffff,0xffff0000,0xffffffff,
-0xffffffff,0xffff0000,0x00000000,0x0000ffff,0x0000ffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xfffefffe,0xfffeffff,0xfffefffe,0xfffeffff,
-0xfffefffe,0xfffefffe,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xfffffffe,0xfffffffe,
-0xfffefffe,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x0000ffff,0x0000ffff,0x00000000,0x0000ffff,
-0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0x00000000,
-0x00000000,0xffff0000,0xffff0000,0xffffffff,0xffff0000,0x0000ffff,0x0000ffff,0xffffffff,
-0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffffffe,0xfffeffff,0xfffeffff,0xffffffff,0xffffffff,0xfffeffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,
-0xffffffff,0xffff0000,0xffffffff,0x0000ffff,0x0000ffff,0x0000ffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00010000,
-0x00010000,0x00010000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000001,0x00000001,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xfffeffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0x0000ffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffff0000,
-0xffff0000,0xffff0000,0xffffffff,0x0000ffff,0xffff0000,0x0000ffff,0x0000ffff,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,
-0x0000ffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffff0000,0xffff0000,0xffff0000,
-0xffff0000,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffff0000,
-0xffff0000,0x00000000,0x0000ffff,0x0000ffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffff0000,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,
-0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffff0000,0xffffffff,
-0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0x0000ffff,0x0000ffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x0000ffff,0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000000,0x0000ffff,
-0x00000000,0xffff0000,0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xffffffff,0xffffffff,0x0000ffff,0xffff0000,0x00000000,
-0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,0x0000ffff,0xffff0000,0xffffffff,
-0x0000ffff,0x00000000,0xffff0000,0xffffffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000ffff,0xffff0000,0x0000ffff,
-0xffffffff,0xffffffff,0x0000ffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,
-0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0x00000000,0x00000000,0xffffffff,0x00000000,0xffff0000,0x00000000,0x0000ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffffffff,
-0x0000ffff,0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x0000ffff,0xffffffff,0x0000ffff,0x00000000,0xffffffff,0x00000000,0x00000000,0xffffffff,
-0xffffffff,0x0000ffff,0x00000000,0x00000000,0xffff0000,0x0000ffff,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0xffff0000,0xffffffff,0x00000000,0x00000000,0x00000000,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x00000000,0x00000000,0x0000ffff,0x00000000,0x00000000,0xffff0000,0xffffffff,0xffffffff,
-0x00000000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0x0000ffff,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,
-0xffffffff,0x00000000,0x0000ffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0xffff0000,0xffffffff,0xffff0000,0xffffffff,0xffffffff,0x0000ffff,0xffff0000,
-0x0000ffff,0x00000000,0xffffffff,0xffffffff,0x00000000,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0x00000000,0xffff0000,0xffffffff,0x00000000,0x00000000,0xffff0000,0xffffffff,0x0000ffff,
-0xffff0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0x00000000,0x00000000,0x00000000,0xffff0000,0x0000ffff,
-0x00000000,0x00000000,0xffffffff,0x0000ffff,0xffff0000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0xffff0000,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0x0000ffff,0x00000000,0xffff0000,0x0000ffff,0x00000000,0xffffffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xffffffff,0xffffffff,0x00000000,0xffffffff,0x0000ffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0xffffffff,0x0000ffff,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0xffff0000,0x0000ffff,0x0000ffff,0x00000000,0xffffffff,0xffffffff,
-0xffffffff,0xffff0000,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0xffffffff,
-0x00000000,0xffffffff,0xffffffff,0xffff0000,0xffffffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x00000000,0x0000ffff,
-0x00000000,0xffffffff,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xffff0000,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,0xffffffff,
-0xffffffff,0xffffffff,0xffffffff,0xffffffff,0x0000ffff,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-};
-
-static const AudioSynthWavetable::sample_data simpletimp_samples[1] = {
-	{
-		(int16_t*)sample_0_simpletimp_timpani_g3, // sample
-		false, // LOOP
-		18, // LENGTH_BITS
-		(1 << (32 - 18)) * WAVETABLE_CENTS_SHIFT(0) * 44100.0 / WAVETABLE_NOTE_TO_FREQUENCY(67) / AUDIO_SAMPLE_RATE_EXACT + 0.5, // PER_HERTZ_PHASE_INCREMENT
-		((uint32_t)151925 - 1) << (32 - 18), // MAX_PHASE
-		((uint32_t)151924 - 1) << (32 - 18), // LOOP_PHASE_END
-		(((uint32_t)151924 - 1) << (32 - 18)) - (((uint32_t)0 - 1) << (32 - 18)), // LOOP_PHASE_LENGTH
-		uint16_t(UINT16_MAX * WAVETABLE_DECIBEL_SHIFT(0)), // INITIAL_ATTENUATION_SCALAR
-		uint32_t(0.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // DELAY_COUNT
-		uint32_t(1.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // ATTACK_COUNT
-		uint32_t(0.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // HOLD_COUNT
-		uint32_t(1.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // DECAY_COUNT
-		uint32_t(100.02 * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // RELEASE_COUNT
-		int32_t((1.0 - WAVETABLE_DECIBEL_SHIFT(0.0)) * AudioSynthWavetable::UNITY_GAIN), // SUSTAIN_MULT
-		uint32_t(0.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / (2 * AudioSynthWavetable::LFO_PERIOD)), // VIBRATO_DELAY
-		uint32_t(8.2 * AudioSynthWavetable::LFO_PERIOD * (UINT32_MAX / AUDIO_SAMPLE_RATE_EXACT)), // VIBRATO_INCREMENT
-		(WAVETABLE_CENTS_SHIFT(0) - 1.0) * 4, // VIBRATO_PITCH_COEFFICIENT_INITIAL
-		(1.0 - WAVETABLE_CENTS_SHIFT(0)) * 4, // VIBRATO_COEFFICIENT_SECONDARY
-		uint32_t(0.00 * AudioSynthWavetable::SAMPLES_PER_MSEC / (2 * AudioSynthWavetable::LFO_PERIOD)), // MODULATION_DELAY
-		uint32_t(8.2 * AudioSynthWavetable::LFO_PERIOD * (UINT32_MAX / AUDIO_SAMPLE_RATE_EXACT)), // MODULATION_INCREMENT
-		(WAVETABLE_CENTS_SHIFT(0) - 1.0) * 4, // MODULATION_PITCH_COEFFICIENT_INITIAL
-		(1.0 - WAVETABLE_CENTS_SHIFT(0)) * 4, // MODULATION_PITCH_COEFFICIENT_SECOND
-		int32_t(UINT16_MAX * (WAVETABLE_DECIBEL_SHIFT(0) - 1.0)) * 4, // MODULATION_AMPLITUDE_INITIAL_GAIN
-		int32_t(UINT16_MAX * (1.0 - WAVETABLE_DECIBEL_SHIFT(0))) * 4, // MODULATION_AMPLITUDE_FINAL_GAIN
-	},
-};
-
-static const uint8_t simpletimp_ranges[] = {127, };
-
-const AudioSynthWavetable::instrument_data simpletimp = {1, simpletimp_ranges, simpletimp_samples };
-
@@ -1,3 +0,0 @@
-#pragma once
-#include <Audio.h>
-extern const AudioSynthWavetable::instrument_data simpletimp;
@@ -0,0 +1,423 @@
+#include "voice_renderer.h"
+
+static const int ENVELOPE_PERIOD = AudioSynthWavetable::ENVELOPE_PERIOD;
+
+// The decay stage is exponential and covers 60 dB towards the sustain level
+// in DECAY_COUNT periods, so looped samples can follow a natural decay. A
+// sustain level below the same floor ends the note.
+static const float DECAY_END_RATIO = 0.001f;
+
+// Fraction bits below the sample units in the resonator states. Rounding
+// leaves a resonator stuck at up to 0.5 / (1 - a1 + a2) units, several LSB
+// on low partials without them.
+static const int TAIL_SHIFT = 14;
+// ModalPartial frequencies and decays are at the recordings' rate
+static const double TAIL_SAMPLE_RATE = 44100.0;
+
+// Plain globals are placed in DTCM on the Teensy 4, which reads in a single
+// cycle, where sample data in QSPI flash misses the cache on a new note
+static uint8_t attackCacheBuffer[ATTACK_CACHE_BYTES] __attribute__((aligned(4)));
+
+static inline int16_t saturate16(int32_t value) {
+  if (value > 32767) return 32767;
+  if (value < -32768) return -32768;
+  return value;
+}
+
+AudioVoiceRenderer::AudioVoiceRenderer()
+    : AudioStream(0, nullptr), masterGain(1.0), cachedAttackCount(0), attackCacheUsed(0),
+      attackCacheEnabled(true), worstUpdateCycles(0) {
+  for (int i = 0; i < MAX_VOICES; i++) {
+    voices[i].cursorCount = 0;
+    voices[i].envState = ENV_IDLE;
+  }
+}
+
+uint32_t AudioVoiceRenderer::cacheAttacks(const RenderInstrument &instrument, float ms) {
+  uint32_t used = 0;
+  for (int i = 0; i < instrument.data->sample_count && cachedAttackCount < MAX_CACHED_ATTACKS; i++) {
+    const AudioSynthWavetable::sample_data *s = &instrument.data->samples[i];
+    uint32_t length = (s->MAX_PHASE >> (32 - s->INDEX_BITS)) + 1;
+    uint32_t wanted = min(length, (uint32_t)(ms * 44.1f));
+    
+    const void *source;
+    uint32_t bytes;
+    if (instrument.compressed != nullptr) {
+      wanted &= ~1u;  // Whole code bytes
+      source = instrument.compressed[i].codes;
+      bytes = wanted / 2;
+    } else {
+      source = s->sample;
+      bytes = wanted * sizeof(int16_t);
+    }
+    if (wanted == 0 || attackCacheUsed + bytes > ATTACK_CACHE_BYTES) {
+      break;
+    }
+    
+    memcpy(&attackCacheBuffer[attackCacheUsed], source, bytes);
+    cachedAttacks[cachedAttackCount++] = {s, &attackCacheBuffer[attackCacheUsed], wanted};
+    attackCacheUsed += (bytes + 3) & ~3u;
+    used += bytes;
+  }
+  return used;
+}
+
+const AudioVoiceRenderer::CachedAttack *AudioVoiceRenderer::findCachedAttack(
+    const AudioSynthWavetable::sample_data *sample) const {
+  if (!attackCacheEnabled) {
+    return nullptr;
+  }
+  for (int i = 0; i < cachedAttackCount; i++) {
+    if (cachedAttacks[i].sample == sample) {
+      return &cachedAttacks[i];
+    }
+  }
+  return nullptr;
+}
+
+void AudioVoiceRenderer::startCursor(SampleCursor &cursor, const RenderInstrument &layer, int midiNote, float gain) {
+  const AudioSynthWavetable::instrument_data *instrument = layer.data;
+  
+  // Each sample covers the notes up to its range limit
+  int index = 0;
+  while (index < instrument->sample_count - 1 && midiNote > instrument->sample_note_ranges[index]) {
+    index++;
+  }
+  const AudioSynthWavetable::sample_data *s = &instrument->samples[index];
+  
+  float frequency = 440.0f * powf(2.0f, (midiNote - 69) / 12.0f);
+  const CachedAttack *cached = findCachedAttack(s);
+  cursor.sample = s;
+  cursor.adpcm = (layer.compressed != nullptr) ? &layer.compressed[index] : nullptr;
+  cursor.phase = 0;
+  cursor.phaseIncrement = s->PER_HERTZ_PHASE_INCREMENT * frequency;
+  cursor.cachedPcm = nullptr;
+  if (cursor.adpcm != nullptr && cached != nullptr) {
+    cursor.decoder.reset(cursor.adpcm, (const uint8_t *)cached->data, cached->length);
+  } else if (cursor.adpcm != nullptr) {
+    cursor.decoder.reset(cursor.adpcm);
+  } else if (cached != nullptr) {
+    // A period reads up to ENVELOPE_PERIOD - 1 steps on, plus the next sample
+    uint64_t lastPhase = (uint64_t)(cached->length - 1) << (32 - s->INDEX_BITS);
+    uint64_t periodSpan = (uint64_t)cursor.phaseIncrement * (ENVELOPE_PERIOD - 1);
+    if (lastPhase > periodSpan) {
+      cursor.cachedPcm = (const int16_t *)cached->data;
+      cursor.cachedPhaseEnd = lastPhase - periodSpan;
+    }
+  }
+  cursor.gain = gain * s->INITIAL_ATTENUATION_SCALAR / 65535.0f;
+  cursor.sampleFinished = false;
+  cursor.finished = false;
+  cursor.resonatorCount = 0;
+  if (layer.tails != nullptr) {
+    startTail(cursor, layer.tails[index]);
+  }
+}
+
+// Sets each resonator up so its first output is the partial at the tail
+// start, scaled in time like the sample
+void AudioVoiceRenderer::startTail(SampleCursor &cursor, const ModalTail &tail) {
+  // Sample steps per output sample
+  float ratio = ldexpf(cursor.phaseIncrement, -(32 - cursor.sample->INDEX_BITS));
+  
+  int count = 0;
+  for (int i = 0; i < tail.partialCount && count < MAX_MODAL_PARTIALS; i++) {
+    const ModalPartial &p = tail.partials[i];
+    double w = 2.0 * PI * p.frequency * ratio / TAIL_SAMPLE_RATE;
+    if (w >= PI) {
+      continue;  // Above Nyquist at this pitch
+    }
+    // Double precision, since r is within 1e-4 of 1 on long partials
+    double r = exp(-p.decay * ratio / TAIL_SAMPLE_RATE);
+    double amplitude = ldexp(p.amplitude, TAIL_SHIFT);
+    Resonator &res = cursor.resonators[count++];
+    res.a1 = lround(ldexp(2.0 * r * cos(w), 29));
+    res.a2 = lround(ldexp(r * r, 29));
+    res.y1 = amplitude / r * cos(p.phase - w);
+    res.y2 = amplitude / (r * r) * cos(p.phase - 2.0 * w);
+  }
+  cursor.resonatorCount = count;
+  cursor.tailDelay = tail.start / ratio;
+  cursor.tailRemaining = tail.length / ratio;
+  cursor.tailFade = 0;
+  cursor.tailFadeStep = (tail.fadeLength > 0) ? ENVELOPE_PERIOD * ratio / tail.fadeLength : 1.0f;
+}
+
+void AudioVoiceRenderer::playNote(int voice, int midiNote, int velocity, float pan, const RenderInstrument &layer,
+                                  const RenderInstrument *blendLayer, float blend) {
+  float velocityCurve = powf(velocity / 127.0f, 4);
+  if (blendLayer == nullptr) {
+    blend = 0;
+  }
+  
+  AudioNoInterrupts();
+  Voice &v = voices[voice];
+  startCursor(v.cursors[0], layer, midiNote, velocityCurve * (1.0f - blend));
+  v.cursorCount = 1;
+  if (blend > 0) {
+    startCursor(v.cursors[1], *blendLayer, midiNote, velocityCurve * blend);
+    v.cursorCount = 2;
+  }
+  v.amplitude = 1.0;
+  // Balance law: centre keeps both sides at unity, like the old mono feed
+  v.panLeft = (pan > 0) ? 1.0f - pan : 1.0f;
+  v.panRight = (pan < 0) ? 1.0f + pan : 1.0f;
+  v.envLevel = 0;
+  enterStage(v, ENV_DELAY);
+  AudioInterrupts();
+}
+
+void AudioVoiceRenderer::stop(int voice) {
+  AudioNoInterrupts();
+  Voice &v = voices[voice];
+  if (v.envState != ENV_IDLE && v.envState != ENV_RELEASE) {
+    enterStage(v, ENV_RELEASE);
+  }
+  AudioInterrupts();
+}
+
+void AudioVoiceRenderer::amplitude(int voice, float gain) {
+  voices[voice].amplitude = constrain(gain, 0.0f, 1.0f);
+}
+
+void AudioVoiceRenderer::setMasterGain(float gain) {
+  masterGain = constrain(gain, 0.0f, 1.0f);
+}
+
+void AudioVoiceRenderer::enterStage(Voice &v, EnvelopeState state) {
+  const AudioSynthWavetable::sample_data *s = v.cursors[0].sample;
+  
+  float sustainLevel = 1.0f - (float)s->SUSTAIN_MULT / AudioSynthWavetable::UNITY_GAIN;
+  
+  // Stages with a zero count jump straight to their end level
+  while (true) {
+    uint32_t count;
+    float target;
+    switch (state) {
+      case ENV_DELAY:   count = s->DELAY_COUNT;   target = 0; break;
+      case ENV_ATTACK:  count = s->ATTACK_COUNT;  target = 1; break;
+      case ENV_HOLD:    count = s->HOLD_COUNT;    target = 1; break;
+      case ENV_DECAY:   count = s->DECAY_COUNT;   target = sustainLevel; break;
+      case ENV_RELEASE: count = s->RELEASE_COUNT; target = 0; break;
+      default:
+        // Sustain holds until stop(), idle ends the note
+        v.envStep = 0;
+        v.envState = (state == ENV_SUSTAIN && sustainLevel <= DECAY_END_RATIO) ? ENV_IDLE : state;
+        return;
+    }
+    
+    if (count > 0 && state == ENV_DECAY) {
+      v.envTarget = target;
+      v.envStep = powf(DECAY_END_RATIO, 1.0f / count);
+      v.envCount = count;
+      v.envState = state;
+      return;
+    }
+    if (count > 0) {
+      v.envStep = (target - v.envLevel) / count;
+      v.envCount = count;
+      v.envState = state;
+      return;
+    }
+    v.envLevel = target;
+    state = (state == ENV_RELEASE) ? ENV_IDLE : (EnvelopeState)(state + 1);
+  }
+}
+
+// Fills one envelope period of interpolated samples and returns how many
+// were produced before a non-looping sample ran out, which also marks it
+// finished
+int AudioVoiceRenderer::readPcm(SampleCursor &c, int32_t *out) {
+  const AudioSynthWavetable::sample_data *s = c.sample;
+  const int indexShift = 32 - s->INDEX_BITS;
+  uint32_t phase = c.phase;
+  const int16_t *waveform = (c.cachedPcm != nullptr && phase < c.cachedPhaseEnd) ? c.cachedPcm : s->sample;
+  
+  for (int j = 0; j < ENVELOPE_PERIOD; j++) {
+    // Linear interpolation with a 14-bit fraction keeps the product in 32 bits
+    uint32_t index = phase >> indexShift;
+    int32_t s1 = waveform[index];
+    int32_t s2 = waveform[index + 1];
+    int32_t fraction = (phase << s->INDEX_BITS) >> 18;
+    out[j] = s1 + (((s2 - s1) * fraction) >> 14);
+    
+    phase += c.phaseIncrement;
+    if (s->LOOP && phase >= s->LOOP_PHASE_END) {
+      phase -= s->LOOP_PHASE_LENGTH;
+    } else if (phase >= s->MAX_PHASE) {
+      c.sampleFinished = true;
+      return j + 1;
+    }
+  }
+  c.phase = phase;
+  return ENVELOPE_PERIOD;
+}
+
+int AudioVoiceRenderer::readAdpcm(SampleCursor &c, int32_t *out) {
+  const AudioSynthWavetable::sample_data *s = c.sample;
+  const int indexShift = 32 - s->INDEX_BITS;
+  uint32_t phase = c.phase;
+  
+  for (int j = 0; j < ENVELOPE_PERIOD; j++) {
+    c.decoder.moveTo(phase >> indexShift);
+    int32_t s1 = c.decoder.before();
+    int32_t s2 = c.decoder.last();
+    int32_t fraction = (phase << s->INDEX_BITS) >> 18;
+    out[j] = s1 + (((s2 - s1) * fraction) >> 14);
+    
+    phase += c.phaseIncrement;
+    if (s->LOOP && phase >= s->LOOP_PHASE_END) {
+      phase -= s->LOOP_PHASE_LENGTH;
+    } else if (phase >= s->MAX_PHASE) {
+      c.sampleFinished = true;
+      return j + 1;
+    }
+  }
+  c.phase = phase;
+  return ENVELOPE_PERIOD;
+}
+
+// Adds one envelope period of the tail to the sample output, which has count
+// samples before the stored attack ran out, and returns how many samples the
+// two cover
+int AudioVoiceRenderer::addTail(SampleCursor &c, int32_t *out, int count) {
+  for (int j = count; j < ENVELOPE_PERIOD; j++) {
+    out[j] = 0;
+  }
+  
+  int first = (c.tailDelay < ENVELOPE_PERIOD) ? c.tailDelay : ENVELOPE_PERIOD;
+  c.tailDelay -= first;
+  int last = (c.tailRemaining < (uint32_t)(ENVELOPE_PERIOD - first)) ? first + c.tailRemaining : ENVELOPE_PERIOD;
+  c.tailRemaining -= last - first;
+  if (first == last) {
+    return (c.tailDelay > 0) ? ENVELOPE_PERIOD : count;
+  }
+  
+  // One partial at a time keeps its state in registers across the period
+  int32_t tail[ENVELOPE_PERIOD] = {};
+  for (int k = 0; k < c.resonatorCount; k++) {
+    Resonator &r = c.resonators[k];
+    int32_t y1 = r.y1;
+    int32_t y2 = r.y2;
+    for (int j = first; j < last; j++) {
+      // Rounded, since truncation bias builds up a large offset at low frequencies
+      int32_t y = ((int64_t)r.a1 * y1 - (int64_t)r.a2 * y2 + (1 << 28)) >> 29;
+      y2 = y1;
+      y1 = y;
+      tail[j] += y >> TAIL_SHIFT;
+    }
+    r.y1 = y1;
+    r.y2 = y2;
+  }
+  
+  // The stored attack already fades out, so the tail fades in over it
+  int32_t fade = c.tailFade * 32767.0f;
+  for (int j = first; j < last; j++) {
+    out[j] += (tail[j] * fade) >> 15;
+  }
+  c.tailFade = min(c.tailFade + c.tailFadeStep, 1.0f);
+  return (c.tailRemaining > 0) ? ENVELOPE_PERIOD : max(count, last);
+}
+
+void AudioVoiceRenderer::renderVoice(Voice &v, int32_t *left, int32_t *right) {
+  int32_t period[ENVELOPE_PERIOD];
+  
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i += ENVELOPE_PERIOD) {
+    float level = v.envLevel * v.amplitude * masterGain;
+    bool sounding = false;
+    
+    for (int c = 0; c < v.cursorCount; c++) {
+      SampleCursor &cursor = v.cursors[c];
+      if (cursor.finished) {
+        continue;
+      }
+      
+      // Gains are held for one envelope period, in Q15
+      int32_t gainLeft = level * cursor.gain * v.panLeft * 32767.0f;
+      int32_t gainRight = level * cursor.gain * v.panRight * 32767.0f;
+      
+      int count = 0;
+      if (!cursor.sampleFinished) {
+        count = (cursor.adpcm != nullptr) ? readAdpcm(cursor, period) : readPcm(cursor, period);
+      }
+      if (cursor.resonatorCount > 0) {
+        count = addTail(cursor, period, count);
+      }
+      for (int j = 0; j < count; j++) {
+        left[i + j] += (period[j] * gainLeft) >> 15;
+        right[i + j] += (period[j] * gainRight) >> 15;
+      }
+      if (count < ENVELOPE_PERIOD) {
+        cursor.finished = true;
+      } else {
+        sounding = true;
+      }
+    }
+    if (!sounding) {
+      v.envState = ENV_IDLE;
+      return;
+    }
+    
+    if (v.envState != ENV_SUSTAIN) {
+      if (v.envState == ENV_DECAY) {
+        v.envLevel = v.envTarget + (v.envLevel - v.envTarget) * v.envStep;
+      } else {
+        v.envLevel += v.envStep;
+      }
+      if (--v.envCount == 0) {
+        enterStage(v, (v.envState == ENV_RELEASE) ? ENV_IDLE : (EnvelopeState)(v.envState + 1));
+        if (v.envState == ENV_IDLE) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+// Timed, for the worst case with and without the attack cache
+void AudioVoiceRenderer::update() {
+  uint32_t start = ARM_DWT_CYCCNT;
+  renderBlock();
+  uint32_t cycles = ARM_DWT_CYCCNT - start;
+  if (cycles > worstUpdateCycles) {
+    worstUpdateCycles = cycles;
+  }
+}
+
+void AudioVoiceRenderer::renderBlock() {
+  int32_t left[AUDIO_BLOCK_SAMPLES] = {};
+  int32_t right[AUDIO_BLOCK_SAMPLES] = {};
+  bool sounding = false;
+  
+  for (int i = 0; i < MAX_VOICES; i++) {
+    if (voices[i].envState != ENV_IDLE) {
+      renderVoice(voices[i], left, right);
+      sounding = true;
+    }
+  }
+  
+  // Nothing transmitted means silence at the output, as with an idle wavetable
+  if (!sounding) {
+    return;
+  }
+  
+  audio_block_t *blockLeft = allocate();
+  if (blockLeft == nullptr) {
+    return;
+  }
+  audio_block_t *blockRight = allocate();
+  if (blockRight == nullptr) {
+    release(blockLeft);
+    return;
+  }
+  
+  for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+    blockLeft->data[i] = saturate16(left[i]);
+    blockRight->data[i] = saturate16(right[i]);
+  }
+  
+  transmit(blockLeft, 0);
+  transmit(blockRight, 1);
+  release(blockLeft);
+  release(blockRight);
+}
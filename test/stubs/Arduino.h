@@ -0,0 +1,38 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Just enough of the Teensy core for the native tests to compile the
+// hardware-free parts of src/ on the host. Time only moves when a test
+// sets it.
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+#define INPUT 0
+#define OUTPUT 1
+
+const int A0 = 14;
+const int A1 = 15;
+const int A12 = 26;
+
+#define PI 3.1415926535897932384626433832795
+
+template <class A, class B>
+inline typename std::common_type<A, B>::type min(A a, B b) { return b < a ? b : a; }
+template <class A, class B>
+inline typename std::common_type<A, B>::type max(A a, B b) { return a < b ? b : a; }
+template <class T, class L, class H>
+inline T constrain(T x, L low, H high) { return x < low ? low : (x > high ? high : x); }
+
+inline unsigned long stubMicros = 0;
+inline int stubAnalogValue = 0;
+inline uint32_t ARM_DWT_CYCCNT = 0;  // Never counts; time renders with the host clock
+
+inline unsigned long micros() { return stubMicros; }
+inline unsigned long millis() { return stubMicros / 1000; }
+inline void pinMode(int, int) {}
+inline int analogRead(int) { return stubAnalogValue; }
+
+#endif // ARDUINO_H
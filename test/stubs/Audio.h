@@ -0,0 +1,87 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+// The parts of the Teensy Audio Library that AudioVoiceRenderer and the
+// generated instrument tables use. Blocks come from a small ring instead of
+// the audio memory pool, and transmit() keeps the last block sent on each
+// output for the test to read.
+#include <Arduino.h>
+
+#define AUDIO_BLOCK_SAMPLES 128
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706f
+
+typedef struct audio_block_struct {
+  uint8_t ref_count;
+  uint8_t reserved1;
+  uint16_t memory_pool_index;
+  int16_t data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+inline audio_block_t stubAudioBlocks[4];
+inline int stubNextAudioBlock = 0;
+inline audio_block_t *stubTransmitted[2] = {nullptr, nullptr};
+
+class AudioStream {
+public:
+  AudioStream(unsigned char, audio_block_t **) {}
+  virtual ~AudioStream() {}
+  virtual void update() = 0;
+  
+protected:
+  static audio_block_t *allocate() {
+    audio_block_t *block = &stubAudioBlocks[stubNextAudioBlock];
+    stubNextAudioBlock = (stubNextAudioBlock + 1) % 4;
+    return block;
+  }
+  static void release(audio_block_t *) {}
+  void transmit(audio_block_t *block, unsigned char index = 0) { stubTransmitted[index] = block; }
+};
+
+inline void AudioNoInterrupts() {}
+inline void AudioInterrupts() {}
+
+class AudioSynthWavetable {
+public:
+  static const int ENVELOPE_PERIOD = 8;
+  static const int32_t UNITY_GAIN = INT32_MAX;
+  static constexpr float SAMPLES_PER_MSEC = AUDIO_SAMPLE_RATE_EXACT / 1000.0f;
+  
+  struct sample_data {
+    const int16_t *sample;
+    bool LOOP;
+    int INDEX_BITS;
+    float PER_HERTZ_PHASE_INCREMENT;
+    uint32_t MAX_PHASE;
+    uint32_t LOOP_PHASE_END;
+    uint32_t LOOP_PHASE_LENGTH;
+    uint16_t INITIAL_ATTENUATION_SCALAR;
+    uint32_t DELAY_COUNT;
+    uint32_t ATTACK_COUNT;
+    uint32_t HOLD_COUNT;
+    uint32_t DECAY_COUNT;
+    uint32_t RELEASE_COUNT;
+    int32_t SUSTAIN_MULT;
+    uint32_t VIBRATO_DELAY;
+    uint32_t VIBRATO_INCREMENT;
+    float VIBRATO_PITCH_COEFFICIENT_INITIAL;
+    float VIBRATO_PITCH_COEFFICIENT_SECOND;
+    uint32_t MODULATION_DELAY;
+    uint32_t MODULATION_INCREMENT;
+    float MODULATION_PITCH_COEFFICIENT_INITIAL;
+    float MODULATION_PITCH_COEFFICIENT_SECOND;
+    int32_t MODULATION_AMPLITUDE_INITIAL_GAIN;
+    int32_t MODULATION_AMPLITUDE_SECOND_GAIN;
+  };
+  
+  struct instrument_data {
+    const uint8_t sample_count;
+    const uint8_t *sample_note_ranges;
+    const sample_data *samples;
+  };
+};
+
+#define WAVETABLE_CENTS_SHIFT(C) (pow(2.0, (C) / 1200.0))
+#define WAVETABLE_NOTE_TO_FREQUENCY(N) (440.0 * pow(2.0, ((N) - 69) / 12.0))
+#define WAVETABLE_DECIBEL_SHIFT(dB) (pow(10.0, (dB) / 20.0))
+
+#endif // AUDIO_H
@@ -0,0 +1,144 @@
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include "voice_renderer.h"
+#include "deferred_log_stub.h"
+#include "samples/instruments.h"
+#include "samples/simpletimp_reference.h"
+#include "samples/simpletimp_adpcm_reference.h"
+#include "samples/simpletimp_soft_adpcm_reference.h"
+#include "samples/simpletimp_modal_reference.h"
+#include "samples/simpletimp_soft_modal_reference.h"
+
+// Decodes every generated ADPCM zone and checks it sample for sample, by
+// checksum, against what the converter's encoder reconstructed; then
+// checks that serving attacks from the DTCM cache changes nothing in the
+// rendered output.
+
+const RenderInstrument PCM = {&simpletimp, nullptr, nullptr};
+const RenderInstrument LOOPED = {&simpletimp_adpcm, simpletimp_adpcm_samples, nullptr};
+const RenderInstrument SOFT_LOOPED = {&simpletimp_soft_adpcm, simpletimp_soft_adpcm_samples, nullptr};
+const RenderInstrument MODAL = {&simpletimp_modal, simpletimp_modal_samples, simpletimp_modal_tails};
+const RenderInstrument SOFT_MODAL = {&simpletimp_soft_modal, simpletimp_soft_modal_samples, simpletimp_soft_modal_tails};
+
+static AudioVoiceRenderer renderer;
+
+// Every sample of a zone in order, the way playback at the root pitch
+// walks through it
+static std::vector<int16_t> decodeAll(const AdpcmSample &sample, const uint8_t *cachedCodes = nullptr,
+                                      uint32_t cachedLength = 0) {
+  AdpcmDecoder decoder;
+  decoder.reset(&sample, cachedCodes, cachedLength);
+  std::vector<int16_t> decoded;
+  for (uint32_t i = 0; i + 1 < sample.length; i++) {
+    decoder.moveTo(i);
+    decoded.push_back(decoder.before());
+    if (i + 2 == sample.length) {
+      decoded.push_back(decoder.last());
+    }
+  }
+  return decoded;
+}
+
+static uint32_t checksum(const std::vector<int16_t> &samples) {
+  uint32_t hash = SAMPLE_CHECKSUM_START;
+  for (int16_t sample : samples) {
+    hash = sampleChecksum(hash, sample);
+  }
+  return hash;
+}
+
+static void checkDecoding(const RenderInstrument &instrument, const ZoneReference *reference) {
+  for (int z = 0; z < instrument.data->sample_count; z++) {
+    const AdpcmSample &sample = instrument.compressed[z];
+    TEST_ASSERT_EQUAL_UINT32(reference[z].length, sample.length);
+    std::vector<int16_t> decoded = decodeAll(sample);
+    TEST_ASSERT_EQUAL_HEX32(reference[z].checksum, checksum(decoded));
+
+    // A loop wrap or a jump ahead re-seeks from the stored block state
+    AdpcmDecoder decoder;
+    decoder.reset(&sample);
+    for (uint32_t block = sample.length / ADPCM_BLOCK_SAMPLES; block-- > 0;) {
+      uint32_t index = block * ADPCM_BLOCK_SAMPLES;
+      decoder.moveTo(index);
+      TEST_ASSERT_EQUAL_INT(decoded[index], decoder.before());
+    }
+  }
+}
+
+void test_adpcm_zones_decode_as_encoded() {
+  checkDecoding(LOOPED, simpletimp_adpcm_reference);
+  checkDecoding(SOFT_LOOPED, simpletimp_soft_adpcm_reference);
+  checkDecoding(MODAL, simpletimp_modal_reference);
+  checkDecoding(SOFT_MODAL, simpletimp_soft_modal_reference);
+}
+
+void test_pcm_zones_match_converter() {
+  for (int z = 0; z < simpletimp.sample_count; z++) {
+    const AudioSynthWavetable::sample_data &s = simpletimp.samples[z];
+    uint32_t length = (s.MAX_PHASE >> (32 - s.INDEX_BITS)) + 1;
+    TEST_ASSERT_EQUAL_UINT32(simpletimp_reference[z].length, length);
+    TEST_ASSERT_EQUAL_HEX32(simpletimp_reference[z].checksum, checksum(std::vector<int16_t>(s.sample, s.sample + length)));
+  }
+}
+
+// The cache holds a copy of the first codes at another address
+void test_cached_codes_decode_identically() {
+  const uint32_t CACHED = 882;  // 20 ms, whole code bytes
+  for (int z = 0; z < simpletimp_adpcm.sample_count; z++) {
+    const AdpcmSample &sample = simpletimp_adpcm_samples[z];
+    std::vector<uint8_t> cached(sample.codes, sample.codes + CACHED / 2);
+    TEST_ASSERT_EQUAL_HEX32(simpletimp_adpcm_reference[z].checksum,
+                            checksum(decodeAll(sample, cached.data(), CACHED)));
+  }
+}
+
+// Both channels of one note, long enough to pass the cached region and
+// reach the loop or tail
+static std::vector<int16_t> renderNote(const RenderInstrument &instrument, int note) {
+  const int BLOCKS = 200;
+  std::vector<int16_t> output;
+  renderer.playNote(0, note, 127, 0.3f, instrument);
+  for (int i = 0; i < BLOCKS; i++) {
+    stubTransmitted[0] = stubTransmitted[1] = nullptr;
+    renderer.update();
+    for (int channel = 0; channel < 2; channel++) {
+      for (int j = 0; j < AUDIO_BLOCK_SAMPLES; j++) {
+        output.push_back(stubTransmitted[channel] != nullptr ? stubTransmitted[channel]->data[j] : 0);
+      }
+    }
+  }
+  renderer.stop(0);
+  while (renderer.isPlaying(0)) {
+    renderer.update();
+  }
+  return output;
+}
+
+void test_attack_cache_render_is_bit_identical() {
+  const RenderInstrument *instruments[] = {&LOOPED, &MODAL, &PCM};
+  const int notes[] = {36, 43, 67, 90};
+  for (const RenderInstrument *instrument : instruments) {
+    TEST_ASSERT_TRUE(renderer.cacheAttacks(*instrument, ATTACK_CACHE_MS) > 0);
+  }
+
+  for (const RenderInstrument *instrument : instruments) {
+    for (int note : notes) {
+      renderer.useAttackCache(false);
+      std::vector<int16_t> flash = renderNote(*instrument, note);
+      renderer.useAttackCache(true);
+      std::vector<int16_t> cached = renderNote(*instrument, note);
+      TEST_ASSERT_EQUAL_UINT32(flash.size(), cached.size());
+      TEST_ASSERT_EQUAL_INT16_ARRAY(flash.data(), cached.data(), flash.size());
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_adpcm_zones_decode_as_encoded);
+  RUN_TEST(test_pcm_zones_match_converter);
+  RUN_TEST(test_cached_codes_decode_identically);
+  RUN_TEST(test_attack_cache_render_is_bit_identical);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+#include <unity.h>
+#include <stdio.h>
+#include "drum_trigger.h"
+#include "config.h"
+#include "deferred_log_stub.h"
+
+// Compares the velocity each trigger mode fires with against the true peak
+// of synthesized hits. The hits mimic the conditioning board's output: a
+// smooth rise to the peak within 100 us of the rise time the early mode is
+// tuned for, an exponential ring-out and a few LSB of noise, sampled at the
+// DMA sampler's 25 kHz. They stand in for recorded piezo hits, which the
+// repository has none of: the true peak of a synthesized hit is known
+// exactly, and the set covers the whole velocity range every run.
+
+const int HIT_SAMPLES = 300000 / SAMPLE_PERIOD_US;  // 300 ms per hit, past mask and ring-out
+const int NUM_HITS = 40;
+const int BASELINE = 20;  // Idle output of the conditioning board
+
+// Same mapping as AudioManager::peakToVelocity()
+static int velocity(int peak) {
+  long v = (long)(peak - TRIGGER_VALUE) * (127 - 40) / (4095 - TRIGGER_VALUE) + 40;
+  return constrain(v, 40L, 127L);
+}
+
+struct HitResult {
+  int truePeak;
+  int firedPeak;
+  unsigned long fireDelayUs;  // From the hit's threshold crossing
+  bool corrected;
+};
+
+static uint32_t noiseState = 1;
+
+static int noise() {
+  noiseState = noiseState * 1664525 + 1013904223;
+  return (int)(noiseState >> 29) - 3;  // -3 to 4
+}
+
+// Plays hit n of the sequence through a fresh stretch of samples
+static HitResult playHit(DrumTrigger &trigger, int n, unsigned long &clockUs) {
+  int height = 150 + n * (3900 / NUM_HITS);
+  float riseUs = EARLY_SLOPE_TIME_US + EARLY_RISE_TIME_US - 100 + (n % 5) * 50;
+
+  HitResult result = {height + BASELINE, 0, 0, false};
+  bool crossed = false;
+  unsigned long crossingUs = 0;
+  uint16_t block[SAMPLE_BLOCK_SIZE];
+
+  for (int start = 0; start < HIT_SAMPLES; start += SAMPLE_BLOCK_SIZE) {
+    unsigned long blockUs = clockUs + start * SAMPLE_PERIOD_US;
+    for (int i = 0; i < SAMPLE_BLOCK_SIZE; i++) {
+      float t = (start + i) * SAMPLE_PERIOD_US;
+      float clean = t < riseUs ? height * 0.5f * (1 - cosf((float)PI * t / riseUs))
+                               : height * expf(-(t - riseUs) / 15000.0f);
+      int value = constrain((int)clean + BASELINE + noise(), 0, 4095);
+      block[i] = value;
+      if (!crossed && value > THRESHOLD) {
+        crossed = true;
+        crossingUs = blockUs + i * SAMPLE_PERIOD_US;
+      }
+    }
+    trigger.processBlock(block, SAMPLE_BLOCK_SIZE, blockUs, SAMPLE_PERIOD_US);
+
+    if (trigger.wasTriggered()) {
+      result.firedPeak = trigger.getPeakValue();
+      result.fireDelayUs = trigger.getFireTime() - crossingUs;
+      trigger.clearTriggered();
+    }
+    if (trigger.wasPeakCorrected()) {
+      result.corrected = true;
+      trigger.clearPeakCorrected();
+    }
+  }
+
+  clockUs += HIT_SAMPLES * SAMPLE_PERIOD_US;
+  return result;
+}
+
+struct ModeStats {
+  int hits;
+  float meanError;
+  int maxError;
+  unsigned long maxDelayUs;
+  int corrections;
+};
+
+static ModeStats runMode(TriggerMode mode) {
+  DrumTrigger trigger(A0, 1);
+  trigger.setMode(mode);
+  trigger.setAdaptiveThreshold(false);
+  noiseState = 1;
+
+  // Past the mask a new trigger starts with, as if it had been idle a while
+  ModeStats stats = {0, 0, 0, 0, 0};
+  unsigned long clockUs = 1000000;
+  int errorSum = 0;
+  for (int n = 0; n < NUM_HITS; n++) {
+    HitResult hit = playHit(trigger, n, clockUs);
+    if (hit.firedPeak == 0) {
+      continue;
+    }
+    int error = abs(velocity(hit.firedPeak) - velocity(hit.truePeak));
+    stats.hits++;
+    errorSum += error;
+    stats.maxError = max(stats.maxError, error);
+    stats.maxDelayUs = max(stats.maxDelayUs, hit.fireDelayUs);
+    stats.corrections += hit.corrected;
+  }
+  stats.meanError = stats.hits > 0 ? (float)errorSum / stats.hits : 0;
+  return stats;
+}
+
+void test_peak_mode_fires_measured_peak() {
+  ModeStats peak = runMode(TRIGGER_PEAK);
+  TEST_ASSERT_EQUAL_INT(NUM_HITS, peak.hits);
+  TEST_ASSERT_LESS_OR_EQUAL_INT(1, peak.maxError);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(SCAN_TIME_US + SAMPLE_PERIOD_US, peak.maxDelayUs);
+}
+
+void test_early_mode_velocity_error_is_bounded() {
+  ModeStats peak = runMode(TRIGGER_PEAK);
+  ModeStats early = runMode(TRIGGER_EARLY);
+
+  // Every hit fires EARLY_SLOPE_TIME_US after the crossing instead of a
+  // whole scan later. The rise is steepest mid-way, where most crossings
+  // land, so straight-line extrapolation overshoots: about 9 velocity steps
+  // on average against 0.1 for the peak method. Overshoot is the safe side,
+  // as the correction scales the voice down once the peak is measured.
+  TEST_ASSERT_EQUAL_INT(NUM_HITS, early.hits);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(EARLY_SLOPE_TIME_US + SAMPLE_PERIOD_US, early.maxDelayUs);
+  char summary[96];
+  snprintf(summary, sizeof(summary), "Velocity error mean/max: peak %.1f/%d, early %.1f/%d",
+           peak.meanError, peak.maxError, early.meanError, early.maxError);
+  TEST_MESSAGE(summary);
+  TEST_ASSERT_TRUE(early.meanError <= 10);
+  TEST_ASSERT_LESS_OR_EQUAL_INT(25, early.maxError);
+
+  // Each early hit is followed by its measured peak for correction
+  TEST_ASSERT_EQUAL_INT(EARLY_FIRE_CORRECTION ? NUM_HITS : 0, early.corrections);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_peak_mode_fires_measured_peak);
+  RUN_TEST(test_early_mode_velocity_error_is_bounded);
+  return UNITY_END();
+}
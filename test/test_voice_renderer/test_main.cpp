@@ -0,0 +1,206 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+#include "voice_renderer.h"
+#include "deferred_log_stub.h"
+#include "samples/instruments.h"
+#include "samples/simpletimp_adpcm_reference.h"
+#include "samples/simpletimp_modal_reference.h"
+
+// Plays the generated instruments through AudioVoiceRenderer on the host:
+// looped and synthesized zones must decay the way the converter's offline
+// render said they would, and the render cost per voice is printed for the
+// README's table.
+
+const RenderInstrument PCM = {&simpletimp, nullptr, nullptr};
+const RenderInstrument LOOPED = {&simpletimp_adpcm, simpletimp_adpcm_samples, nullptr};
+const RenderInstrument MODAL = {&simpletimp_modal, simpletimp_modal_samples, simpletimp_modal_tails};
+
+// The converter renders at 44.1 kHz and the Teensy plays at 44.117 kHz, so
+// windows are matched by time rather than by sample count
+const double WINDOW_SAMPLES = AUDIO_SAMPLE_RATE_EXACT * REFERENCE_WINDOW_MS / 1000;
+const float COMPARED_RANGE_DB = 40;  // Below the peak, where the level is still audible over other drums
+const float MAX_SHAPE_ERROR_DB = 1;
+
+static AudioVoiceRenderer renderer;
+
+// Left output of the next block, zeros if the renderer sent nothing
+static const int16_t *renderBlock() {
+  static const int16_t silence[AUDIO_BLOCK_SAMPLES] = {};
+  stubTransmitted[0] = nullptr;
+  renderer.update();
+  return stubTransmitted[0] != nullptr ? stubTransmitted[0]->data : silence;
+}
+
+// RMS level in dB of each window, as the converter measures its render
+static void renderLevels(const RenderInstrument &instrument, int note, float *levels, int count) {
+  renderer.playNote(0, note, 127, 0, instrument);
+  const int16_t *block = renderBlock();
+  int position = 0;
+  long rendered = 0;
+  for (int w = 0; w < count; w++) {
+    long end = lround((w + 1) * WINDOW_SAMPLES);
+    long length = end - rendered;
+    double sum = 0;
+    for (; rendered < end; rendered++) {
+      if (position == AUDIO_BLOCK_SAMPLES) {
+        block = renderBlock();
+        position = 0;
+      }
+      double sample = block[position++];
+      sum += sample * sample;
+    }
+    levels[w] = 10 * log10(max(sum / length, 1e-9));
+  }
+  renderer.stop(0);
+  while (renderer.isPlaying(0)) {
+    renderBlock();
+  }
+}
+
+// The renderer's output gain differs from the converter's, so only the
+// shape of the decay is compared: the difference in each window after
+// removing the mean difference
+static void checkZones(const RenderInstrument &instrument, const ZoneReference *reference, const char *name) {
+  for (int z = 0; z < instrument.data->sample_count; z++) {
+    const ZoneReference &zone = reference[z];
+    TEST_ASSERT_NOT_NULL(zone.levels);
+    std::vector<float> levels(zone.levelCount);
+    renderLevels(instrument, zone.rootNote, levels.data(), zone.levelCount);
+
+    float peak = -1000;
+    for (int w = 0; w < zone.levelCount; w++) {
+      peak = max(peak, zone.levels[w] / 100.0f);
+    }
+    float offset = 0;
+    int compared = 0;
+    for (int w = 0; w < zone.levelCount; w++) {
+      if (zone.levels[w] / 100.0f >= peak - COMPARED_RANGE_DB) {
+        offset += levels[w] - zone.levels[w] / 100.0f;
+        compared++;
+      }
+    }
+    offset /= compared;
+
+    float worst = 0;
+    for (int w = 0; w < zone.levelCount; w++) {
+      if (zone.levels[w] / 100.0f >= peak - COMPARED_RANGE_DB) {
+        worst = max(worst, fabsf(levels[w] - zone.levels[w] / 100.0f - offset));
+      }
+    }
+    char message[96];
+    snprintf(message, sizeof(message), "%s zone %d: %d windows, worst level error %.2f dB", name, z, compared, worst);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE_MESSAGE(worst <= MAX_SHAPE_ERROR_DB, message);
+  }
+}
+
+void test_looped_zones_match_converter_render() {
+  checkZones(LOOPED, simpletimp_adpcm_reference, "simpletimp_adpcm");
+}
+
+void test_synthesized_tails_match_converter_render() {
+  checkZones(MODAL, simpletimp_modal_reference, "simpletimp_modal");
+}
+
+// Best of several runs of blocks [first, first + count) of one note, or -1
+// if the note ended before the last of them
+static float nsPerSample(const RenderInstrument &instrument, int note, int first, int count) {
+  const int RUNS = 20;
+  double best = 1e9;
+  bool sounding = true;
+  for (int run = 0; run < RUNS; run++) {
+    renderer.playNote(0, note, 127, 0, instrument);
+    for (int i = 0; i < first; i++) {
+      renderer.update();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+      renderer.update();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    sounding = sounding && renderer.isPlaying(0);
+    best = std::min(best, std::chrono::duration<double, std::nano>(elapsed).count());
+    renderer.stop(0);
+    while (renderer.isPlaying(0)) {
+      renderer.update();
+    }
+  }
+  return sounding ? best / (count * AUDIO_BLOCK_SAMPLES) : -1;
+}
+
+// Host numbers, for comparing storage formats with each other. Use the b
+// serial command for the Teensy.
+void test_render_cost_per_voice() {
+  const int NOTE = 43;
+  const int ATTACK_BLOCKS = 34;  // 100 ms
+  const int TAIL_FIRST = 172;    // 500 ms, well into the loop or synthesized tail
+  const int TAIL_BLOCKS = 690;   // 2 s
+
+  struct Case {
+    const char *name;
+    const RenderInstrument &instrument;
+    int first, count;
+  } cases[] = {
+    {"PCM", PCM, 0, ATTACK_BLOCKS},
+    {"ADPCM attack", LOOPED, 0, ATTACK_BLOCKS},
+    {"ADPCM, looped", LOOPED, TAIL_FIRST, TAIL_BLOCKS},
+    {"Synthesized tail, 12 partials", MODAL, TAIL_FIRST, TAIL_BLOCKS},
+  };
+  for (const Case &c : cases) {
+    float ns = nsPerSample(c.instrument, NOTE, c.first, c.count);
+    char message[96];
+    snprintf(message, sizeof(message), "note %d, %s: %.1f ns per output sample", NOTE, c.name, ns);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE_MESSAGE(ns > 0, "note ended inside the timed blocks");
+  }
+}
+
+// The fused half of the b benchmark: notes held at full velocity on the
+// default drum notes, as a share of one audio block's 2.9 ms
+void test_render_cost_by_voice_count() {
+  const int BLOCKS = 172;  // 500 ms after the notes start
+  const RenderInstrument *instruments[] = {&PCM, &LOOPED};
+  const char *names[] = {"PCM", "ADPCM"};
+  const int counts[] = {2, 8, MAX_VOICES};
+
+  for (int i = 0; i < 2; i++) {
+    for (int count : counts) {
+      double best = 1e9;
+      for (int run = 0; run < 5; run++) {
+        for (int v = 0; v < count; v++) {
+          renderer.playNote(v, defaultDrumNote(v % NUM_DRUMS), 127, 0, *instruments[i]);
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < BLOCKS; b++) {
+          renderer.update();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration<double, std::micro>(elapsed).count() / BLOCKS);
+        for (int v = 0; v < count; v++) {
+          TEST_ASSERT_TRUE(renderer.isPlaying(v));
+          renderer.stop(v);
+        }
+        for (int v = 0; v < count; v++) {
+          while (renderer.isPlaying(v)) {
+            renderer.update();
+          }
+        }
+      }
+      char message[96];
+      snprintf(message, sizeof(message), "%s, %d voices: %.1f us per block, %.2f%% of the block period", names[i],
+               count, best, best * 100 / (AUDIO_BLOCK_SAMPLES * 1e6 / AUDIO_SAMPLE_RATE_EXACT));
+      TEST_MESSAGE(message);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_looped_zones_match_converter_render);
+  RUN_TEST(test_synthesized_tails_match_converter_render);
+  RUN_TEST(test_render_cost_per_voice);
+  RUN_TEST(test_render_cost_by_voice_count);
+  return UNITY_END();
+}
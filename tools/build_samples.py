@@ -0,0 +1,41 @@
+# PlatformIO pre-build step: builds tools/sample_convert.cpp for the host and
+# regenerates src/samples/ from samples/manifest.txt whenever the manifest,
+# a WAV file or the converter has changed. A failed conversion, including
+# an instrument set over its flash budget, stops the build.
+import glob
+import os
+import subprocess
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+converter_source = os.path.join(project, "tools", "sample_convert.cpp")
+converter = os.path.join(env.subst("$PROJECT_BUILD_DIR"), "sample_convert")
+manifest = os.path.join(project, "samples", "manifest.txt")
+output_dir = os.path.join(project, "src", "samples")
+output_stamp = os.path.join(output_dir, "instruments.h")
+
+
+def mtime(path):
+    return os.path.getmtime(path) if os.path.exists(path) else 0
+
+
+converter_inputs = [converter_source] + [os.path.join(project, "include", h)
+                                        for h in ("adpcm_sample.h", "modal_tail.h", "sample_reference.h")]
+if mtime(converter) < max(mtime(p) for p in converter_inputs):
+    print("Building sample converter")
+    os.makedirs(os.path.dirname(converter), exist_ok=True)
+    if subprocess.call([os.environ.get("HOST_CXX", "c++"), "-O2", "-std=c++17",
+                        "-I", os.path.join(project, "include"),
+                        "-o", converter, converter_source]) != 0:
+        env.Exit(1)
+
+sample_inputs = [manifest, converter] + glob.glob(os.path.join(project, "samples", "*.wav"))
+if mtime(output_stamp) < max(mtime(p) for p in sample_inputs):
+    print("Converting samples")
+    os.makedirs(output_dir, exist_ok=True)
+    if subprocess.call([converter, manifest, output_dir]) != 0:
+        # Don't leave a stamp that would skip the conversion next time
+        if os.path.exists(output_stamp):
+            os.remove(output_stamp)
+        env.Exit(1)
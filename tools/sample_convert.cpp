@@ -0,0 +1,1005 @@
+// Host-side sample converter for the wavetable and AudioVoiceRenderer
+// instruments, run before each build by tools/build_samples.py.
+//
+// Reads samples/manifest.txt and the WAV files it names, and writes one
+// .cpp/.h pair of AudioSynthWavetable::instrument_data tables per instrument
+// plus an instruments.h that includes them all. Prints the flash used and
+// the encoding error per zone, and fails if an instrument set is over its
+// budget.
+//
+//   c++ -O2 -std=c++17 -I include -o sample_convert tools/sample_convert.cpp
+//   ./sample_convert samples/manifest.txt src/samples [--render <dir>]
+//
+// Manifest lines (# starts a comment):
+//   budget <bytes> <instrument>...     Flash limit for instruments that ship together
+//   instrument <name> <pcm|adpcm>      Starts an instrument; the lines below apply to it
+//   envelope <delay> <attack> <hold> <decay> <sustain dB> <release>   Times in ms
+//   lowpass <Hz>                       Filters the recordings before encoding
+//   loop <start ms> <length ms> <crossfade ms>   Loops every zone's tail, see buildLoop()
+//   modes <attack ms> <fade ms> <partials>        Synthesizes every zone's tail, see fitModes()
+//   zone <wav> <wav root> <zone root> <max note> [<loop start> <loop end>]
+//
+// A zone whose root differs from its recording's is resampled offline with
+// a windowed sinc, keeping the whole recording. Loop points are in
+// samples of the zone as stored.
+//
+// Each instrument also gets a <name>_reference.h holding the levels of that
+// offline render and a checksum of each zone's samples as the encoder's
+// decoder model reconstructs them, which the native tests check
+// AudioVoiceRenderer and AdpcmDecoder against. With --render <dir>, each looped or synthesized zone's render is
+// also written next to the original zone as WAV files.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <complex>
+#include "adpcm_sample.h"
+#include "modal_tail.h"
+#include "sample_reference.h"
+
+static const double SAMPLE_RATE = 44100.0;
+
+struct Zone {
+  std::string file;
+  int fileRoot;
+  int rootNote;
+  int maxNote;
+  long loopStart;  // -1 when not looped
+  long loopEnd;
+};
+
+struct Instrument {
+  std::string name;
+  bool compressed;
+  double delayMs = 0, attackMs = 1, holdMs = 0, decayMs = 1, sustainDb = 0, releaseMs = 100.02;
+  double lowpassHz = 0;
+  bool autoLoop = false;
+  double loopStartMs = 0, loopLengthMs = 0, crossfadeMs = 0;
+  int partialCount = 0;  // 0 without a synthesized tail
+  double modalAttackMs = 0, modalFadeMs = 0;
+  std::vector<Zone> zones;
+};
+
+struct Budget {
+  size_t bytes;
+  std::vector<std::string> instruments;
+};
+
+struct EncodedZone {
+  std::vector<int16_t> pcm;
+  long loopStart;  // -1 when not looped
+  long loopEnd;
+  double holdMs, decayMs, sustainDb;
+  double t60;                          // Measured decay, looped zones only
+  std::vector<ModalPartial> partials;  // Synthesized tail, see fitModes()
+  long tailStart, tailFade, tailLength;
+  double levelErrorMaxDb, levelErrorMeanDb;
+  std::vector<long> codes;
+  std::vector<long> predictors;
+  std::vector<long> stepIndices;
+  std::vector<double> renderedLevels;  // See ZoneReference, looped or synthesized zones only
+  uint32_t checksum;                   // Of the samples a decoder will produce
+  size_t bytes;
+  double rmsError;
+  long peakError;
+  double snr;
+};
+
+// Picks the code whose decoded value lands closest to the input, rather
+// than the usual bit-by-bit quantiser. The decoder is unchanged.
+static uint8_t encodeSample(AdpcmState &state, int16_t sample) {
+  uint8_t best = 0;
+  long bestError = -1;
+  for (uint8_t code = 0; code < 16; code++) {
+    AdpcmState trial = state;
+    long error = std::labs((long)adpcmDecodeNibble(trial, code) - sample);
+    if (bestError < 0 || error < bestError) {
+      bestError = error;
+      best = code;
+    }
+  }
+  adpcmDecodeNibble(state, best);
+  return best;
+}
+
+// Two cascaded one-pole sections, 12 dB/octave
+static void lowPass(std::vector<int16_t> &pcm, double cutoffHz) {
+  double a = 1.0 - std::exp(-2.0 * M_PI * cutoffHz / SAMPLE_RATE);
+  double y1 = 0, y2 = 0;
+  for (int16_t &sample : pcm) {
+    y1 += a * (sample - y1);
+    y2 += a * (y1 - y2);
+    sample = (int16_t)std::lround(y2);
+  }
+}
+
+// Blackman-windowed sinc, 16 zero crossings each side. step is input samples
+// per output sample; above 1 the cutoff drops to band-limit the result.
+// The whole recording is kept, so a zone pitched down lasts longer than it.
+static std::vector<int16_t> resample(const std::vector<int16_t> &in, double step) {
+  const double ZERO_CROSSINGS = 16;
+  double cutoff = std::min(1.0, 1.0 / step);
+  double halfWidth = ZERO_CROSSINGS / cutoff;
+  size_t length = (size_t)((in.size() - 1) / step);
+  std::vector<int16_t> out(length);
+
+  for (size_t n = 0; n < length; n++) {
+    double t = n * step;
+    long first = std::max(0L, (long)std::ceil(t - halfWidth));
+    long last = std::min((long)in.size() - 1, (long)std::floor(t + halfWidth));
+    double sum = 0;
+    for (long k = first; k <= last; k++) {
+      double x = t - k;
+      double sinc = (x == 0) ? 1.0 : std::sin(M_PI * x * cutoff) / (M_PI * x * cutoff);
+      double window = 0.42 + 0.5 * std::cos(M_PI * x / halfWidth) + 0.08 * std::cos(2 * M_PI * x / halfWidth);
+      sum += in[k] * sinc * window * cutoff;
+    }
+    out[n] = (int16_t)std::max(-32768L, std::min(32767L, std::lround(sum)));
+  }
+  return out;
+}
+
+// Mono 16-bit PCM at 44.1 kHz only, which is all the renderer plays
+static bool readWav(const std::string &path, std::vector<int16_t> &pcm) {
+  std::ifstream in(path, std::ios::binary);
+  char riff[12];
+  if (!in.read(riff, 12) || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) {
+    fprintf(stderr, "%s: not a WAV file\n", path.c_str());
+    return false;
+  }
+
+  bool formatOk = false;
+  char header[8];
+  while (in.read(header, 8)) {
+    uint32_t size;
+    memcpy(&size, header + 4, 4);
+    if (memcmp(header, "fmt ", 4) == 0) {
+      std::vector<char> fmt(size);
+      in.read(fmt.data(), size);
+      uint16_t format, channels, bits;
+      uint32_t rate;
+      memcpy(&format, &fmt[0], 2);
+      memcpy(&channels, &fmt[2], 2);
+      memcpy(&rate, &fmt[4], 4);
+      memcpy(&bits, &fmt[14], 2);
+      formatOk = (format == 1 && channels == 1 && bits == 16 && rate == 44100);
+    } else if (memcmp(header, "data", 4) == 0) {
+      if (!formatOk) {
+        fprintf(stderr, "%s: needs mono 16-bit 44.1 kHz PCM\n", path.c_str());
+        return false;
+      }
+      pcm.resize(size / 2);
+      in.read((char *)pcm.data(), pcm.size() * 2);
+      return pcm.size() >= 2;
+    } else {
+      in.seekg(size + (size & 1), std::ios::cur);
+    }
+  }
+  fprintf(stderr, "%s: no data chunk\n", path.c_str());
+  return false;
+}
+
+// RMS level of each 50 ms window, in dB
+static std::vector<double> windowLevels(const std::vector<double> &signal) {
+  const size_t WINDOW = SAMPLE_RATE * REFERENCE_WINDOW_MS / 1000;
+  std::vector<double> levels;
+  for (size_t start = 0; start + WINDOW <= signal.size(); start += WINDOW) {
+    double sum = 0;
+    for (size_t i = start; i < start + WINDOW; i++) {
+      sum += signal[i] * signal[i];
+    }
+    levels.push_back(10 * std::log10(std::max(sum / WINDOW, 1e-9)));
+  }
+  return levels;
+}
+
+// Plays a zone at its root pitch the way AudioVoiceRenderer does: the loop
+// wraps, and the envelope steps every 8 samples with an exponential decay
+// covering 60 dB
+static std::vector<double> renderZone(const EncodedZone &e, const Instrument &instrument, size_t length) {
+  const int PERIOD = 8;
+  auto periods = [&](double ms) { return (long)(ms * SAMPLE_RATE / 1000 / PERIOD + 0.5); };
+  long delay = periods(instrument.delayMs);
+  long attack = periods(instrument.attackMs);
+  long hold = periods(e.holdMs);
+  long decay = periods(e.decayMs);
+  double sustain = std::pow(10, e.sustainDb / 20);
+  double factor = (decay > 0) ? std::pow(0.001, 1.0 / decay) : 0;
+
+  std::vector<double> out(length, 0);
+  for (size_t n = 0; n < length; n++) {
+    long p = n / PERIOD;
+    double level;
+    if (p < delay) {
+      level = 0;
+    } else if (p < delay + attack) {
+      level = (double)(p - delay) / attack;
+    } else if (p < delay + attack + hold) {
+      level = 1;
+    } else if (p < delay + attack + hold + decay) {
+      level = sustain + (1 - sustain) * std::pow(factor, p - delay - attack - hold);
+    } else {
+      level = (sustain <= 0.001) ? 0 : sustain;
+    }
+
+    size_t index = n;
+    if (e.loopStart >= 0 && (long)index >= e.loopEnd) {
+      index = e.loopStart + (index - e.loopStart) % (e.loopEnd - e.loopStart);
+    }
+    out[n] = (index < e.pcm.size()) ? e.pcm[index] * level : 0;
+  }
+
+  for (const ModalPartial &p : e.partials) {
+    double w = 2 * M_PI * p.frequency / SAMPLE_RATE;
+    double r = std::exp(-p.decay / SAMPLE_RATE);
+    for (long t = 0; t < e.tailLength && e.tailStart + t < (long)length; t++) {
+      double fade = std::min(1.0, (double)t / e.tailFade);
+      out[e.tailStart + t] += fade * p.amplitude * std::pow(r, t) * std::cos(w * t + p.phase);
+    }
+  }
+  return out;
+}
+
+// Compares a render with the original zone in 50 ms windows, while the
+// original is within 60 dB of its peak
+static void compareLevels(EncodedZone &e, const Instrument &instrument, const std::vector<int16_t> &original) {
+  std::vector<double> reference(original.begin(), original.end());
+  std::vector<double> referenceLevels = windowLevels(reference);
+  std::vector<double> renderedLevels = windowLevels(renderZone(e, instrument, original.size()));
+  double peak = *std::max_element(referenceLevels.begin(), referenceLevels.end());
+  double sum = 0;
+  int count = 0;
+  e.levelErrorMaxDb = 0;
+  for (size_t i = 0; i < referenceLevels.size(); i++) {
+    if (referenceLevels[i] < peak - 60) {
+      continue;
+    }
+    double error = std::fabs(renderedLevels[i] - referenceLevels[i]);
+    e.levelErrorMaxDb = std::max(e.levelErrorMaxDb, error);
+    sum += error;
+    count++;
+  }
+  e.levelErrorMeanDb = count ? sum / count : 0;
+}
+
+// Replaces a zone's tail with a short loop and an envelope that recreates
+// its decay:
+//  - the decay rate after the loop start is fitted from 50 ms RMS levels
+//  - the loop region is gained up by that rate so it holds a steady level
+//  - the loop length is an even number of root periods (timpani partials
+//    sit near half-harmonics), nudged to the best-correlating end point
+//  - the last crossfade ms of the loop blend into the audio just before the
+//    loop start
+// The envelope then holds full level until the loop start and decays 60 dB
+// over the measured T60.
+static bool buildLoop(EncodedZone &e, const Zone &zone, const Instrument &instrument, const char *label) {
+  const std::vector<int16_t> original = e.pcm;
+  long start = std::lround(instrument.loopStartMs * SAMPLE_RATE / 1000);
+  long crossfade = std::lround(instrument.crossfadeMs * SAMPLE_RATE / 1000);
+  double period = SAMPLE_RATE / (440.0 * std::pow(2.0, (zone.rootNote - 69) / 12.0));
+  if (start < crossfade || start + 4 * period >= (long)original.size()) {
+    fprintf(stderr, "%s: loop start out of range\n", label);
+    return false;
+  }
+
+  // Fit the decay from the loop start until 60 dB down or the end
+  std::vector<double> tail(original.begin() + start, original.end());
+  std::vector<double> levels = windowLevels(tail);
+  size_t used = 0;
+  while (used < levels.size() && levels[used] > levels[0] - 60) {
+    used++;
+  }
+  double sumT = 0, sumL = 0, sumTT = 0, sumTL = 0;
+  for (size_t i = 0; i < used; i++) {
+    double t = i * 0.05;
+    sumT += t;
+    sumL += levels[i];
+    sumTT += t * t;
+    sumTL += t * levels[i];
+  }
+  double slope = (used * sumTL - sumT * sumL) / (used * sumTT - sumT * sumT);  // dB per second
+  if (used < 3 || !(slope < 0)) {
+    fprintf(stderr, "%s: no decay to loop after the loop start\n", label);
+    return false;
+  }
+  e.t60 = 60 / -slope;
+
+  // Steady-level copy of the audio around the loop
+  auto flat = [&](long n) {
+    return original[n] * std::pow(10, -slope * (n - start) / SAMPLE_RATE / 20);
+  };
+
+  int cycles = std::max(2L, 2 * std::lround(instrument.loopLengthMs / 1000 * SAMPLE_RATE / period / 2));
+  long nominal = std::lround(cycles * period);
+  long length = nominal;
+  double bestCorrelation = -2;
+  for (long candidate = nominal - (long)(period / 2); candidate <= nominal + (long)(period / 2); candidate++) {
+    if (candidate <= crossfade || start + candidate + 1 >= (long)original.size()) {
+      continue;
+    }
+    double ab = 0, aa = 0, bb = 0;
+    for (long i = -crossfade; i < 0; i++) {
+      double a = flat(start + i), b = flat(start + candidate + i);
+      ab += a * b;
+      aa += a * a;
+      bb += b * b;
+    }
+    double correlation = ab / std::sqrt(std::max(aa * bb, 1e-9));
+    if (correlation > bestCorrelation) {
+      bestCorrelation = correlation;
+      length = candidate;
+    }
+  }
+  long end = start + length;
+
+  e.pcm.assign(original.begin(), original.begin() + end + 1);
+  for (long n = start; n < end; n++) {
+    e.pcm[n] = (int16_t)std::lround(flat(n));
+  }
+  for (long i = 0; i < crossfade; i++) {
+    double w = (i + 1.0) / (crossfade + 1);
+    long n = end - crossfade + i;
+    e.pcm[n] = (int16_t)std::lround(flat(n) * (1 - w) + flat(start - crossfade + i) * w);
+  }
+  e.pcm[end] = e.pcm[start];  // Read by interpolation at the wrap
+  e.loopStart = start;
+  e.loopEnd = end;
+
+  e.holdMs = std::max(0.0, instrument.loopStartMs - instrument.delayMs - instrument.attackMs);
+  e.decayMs = e.t60 * 1000;
+  e.sustainDb = -100;
+
+  compareLevels(e, instrument, original);
+  return true;
+}
+
+static void fft(std::vector<std::complex<double>> &x) {
+  size_t n = x.size();
+  for (size_t i = 1, j = 0; i < n; i++) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(x[i], x[j]);
+    }
+  }
+  for (size_t length = 2; length <= n; length <<= 1) {
+    std::complex<double> step = std::polar(1.0, -2 * M_PI / length);
+    for (size_t i = 0; i < n; i += length) {
+      std::complex<double> w = 1;
+      for (size_t k = 0; k < length / 2; k++) {
+        std::complex<double> a = x[i + k], b = x[i + k + length / 2] * w;
+        x[i + k] = a + b;
+        x[i + k + length / 2] = a - b;
+        w *= step;
+      }
+    }
+  }
+}
+
+// Solves a x = b in place by Gaussian elimination with partial pivoting
+static void solve(std::vector<std::vector<double>> &a, std::vector<double> &b) {
+  size_t n = b.size();
+  for (size_t col = 0; col < n; col++) {
+    size_t pivot = col;
+    for (size_t row = col + 1; row < n; row++) {
+      if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) {
+        pivot = row;
+      }
+    }
+    std::swap(a[col], a[pivot]);
+    std::swap(b[col], b[pivot]);
+    for (size_t row = col + 1; row < n; row++) {
+      double f = a[row][col] / a[col][col];
+      for (size_t k = col; k < n; k++) {
+        a[row][k] -= f * a[col][k];
+      }
+      b[row] -= f * b[col];
+    }
+  }
+  for (size_t col = n; col-- > 0;) {
+    for (size_t k = col + 1; k < n; k++) {
+      b[col] -= a[col][k] * b[k];
+    }
+    b[col] /= a[col][col];
+  }
+}
+
+// Keeps only a zone's attack and fits damped sinusoids to the rest:
+//  - partial frequencies are the strongest peaks of the spectrum after the
+//    attack, interpolated between FFT bins
+//  - each partial's decay is fitted from its level in successive windows
+//  - amplitudes and phases at the tail start are fitted jointly by least
+//    squares over 100 ms, so the tail continues the recorded waveform
+// The stored attack fades out over the last fade ms while the renderer
+// fades the tail in.
+static bool fitModes(EncodedZone &e, const Instrument &instrument, const char *label) {
+  const std::vector<int16_t> original = e.pcm;
+  long attack = std::lround(instrument.modalAttackMs * SAMPLE_RATE / 1000);
+  long fade = std::max(1L, std::lround(instrument.modalFadeMs * SAMPLE_RATE / 1000));
+  long start = attack - fade;
+  const size_t SPECTRUM_LENGTH = 32768;
+  if (start < 0 || start + (long)SAMPLE_RATE / 2 >= (long)original.size()) {
+    fprintf(stderr, "%s: attack out of range for a synthesized tail\n", label);
+    return false;
+  }
+  if (instrument.partialCount > MAX_MODAL_PARTIALS) {
+    fprintf(stderr, "%s: at most %d partials\n", label, MAX_MODAL_PARTIALS);
+    return false;
+  }
+
+  // Zero-padded to four times the window for finer peak positions
+  std::vector<std::complex<double>> spectrum(4 * SPECTRUM_LENGTH, 0);
+  for (size_t i = 0; i < SPECTRUM_LENGTH && start + i < original.size(); i++) {
+    double window = 0.5 - 0.5 * std::cos(2 * M_PI * i / SPECTRUM_LENGTH);
+    spectrum[i] = original[start + i] * window;
+  }
+  fft(spectrum);
+  double binHz = SAMPLE_RATE / spectrum.size();
+  std::vector<double> magnitude(spectrum.size() / 2);
+  for (size_t k = 0; k < magnitude.size(); k++) {
+    magnitude[k] = std::log(std::abs(spectrum[k]) + 1e-9);
+  }
+
+  // Peaks at least 5 Hz from anything stronger, down to 60 dB below the largest
+  const long SPACING = 5 / binHz;
+  std::vector<std::pair<double, size_t>> peaks;
+  for (size_t k = std::max<size_t>(SPACING, 20 / binHz); k + SPACING < magnitude.size(); k++) {
+    bool isPeak = true;
+    for (long d = -SPACING; d <= SPACING && isPeak; d++) {
+      isPeak = (d == 0 || magnitude[k + d] < magnitude[k]);
+    }
+    if (isPeak) {
+      peaks.push_back({magnitude[k], k});
+    }
+  }
+  std::sort(peaks.rbegin(), peaks.rend());
+  std::vector<double> frequencies;
+  for (const auto &peak : peaks) {
+    if ((int)frequencies.size() == instrument.partialCount || peak.first < peaks[0].first - std::log(1000.0)) {
+      break;
+    }
+    size_t k = peak.second;
+    double a = magnitude[k - 1], b = magnitude[k], c = magnitude[k + 1];
+    frequencies.push_back((k + 0.5 * (a - c) / (a - 2 * b + c)) * binHz);
+  }
+
+  // Decay from each partial's level in 93 ms windows, until 40 dB down
+  const size_t WINDOW = 4096;
+  std::vector<double> decays;
+  for (double frequency : frequencies) {
+    double w = 2 * M_PI * frequency / SAMPLE_RATE;
+    std::vector<double> levels;
+    for (size_t at = start; at + WINDOW <= original.size(); at += WINDOW / 2) {
+      std::complex<double> sum = 0;
+      for (size_t i = 0; i < WINDOW; i++) {
+        double window = 0.5 - 0.5 * std::cos(2 * M_PI * i / WINDOW);
+        sum += original[at + i] * window * std::polar(1.0, -w * i);
+      }
+      double level = std::log(std::abs(sum) + 1e-9);
+      if (!levels.empty() && level < levels[0] - std::log(100.0)) {
+        break;
+      }
+      levels.push_back(level);
+    }
+    double sumT = 0, sumL = 0, sumTT = 0, sumTL = 0;
+    for (size_t i = 0; i < levels.size(); i++) {
+      double t = i * (WINDOW / 2) / SAMPLE_RATE;
+      sumT += t;
+      sumL += levels[i];
+      sumTT += t * t;
+      sumTL += t * levels[i];
+    }
+    double n = levels.size();
+    double slope = (n >= 3) ? (n * sumTL - sumT * sumL) / (n * sumTT - sumT * sumT) : -10;
+    decays.push_back(std::max(0.05, -slope));
+  }
+
+  // Amplitudes and phases by joint least squares over 100 ms
+  size_t fitLength = std::min<size_t>(SAMPLE_RATE / 10, original.size() - start);
+  size_t unknowns = 2 * frequencies.size();
+  std::vector<std::vector<double>> normal(unknowns, std::vector<double>(unknowns, 0));
+  std::vector<double> rhs(unknowns, 0);
+  std::vector<double> basis(unknowns);
+  for (size_t n = 0; n < fitLength; n++) {
+    for (size_t k = 0; k < frequencies.size(); k++) {
+      double envelope = std::exp(-decays[k] * n / SAMPLE_RATE);
+      double w = 2 * M_PI * frequencies[k] / SAMPLE_RATE;
+      basis[2 * k] = envelope * std::cos(w * n);
+      basis[2 * k + 1] = envelope * std::sin(w * n);
+    }
+    for (size_t i = 0; i < unknowns; i++) {
+      rhs[i] += basis[i] * original[start + n];
+      for (size_t j = 0; j < unknowns; j++) {
+        normal[i][j] += basis[i] * basis[j];
+      }
+    }
+  }
+  for (size_t i = 0; i < unknowns; i++) {
+    normal[i][i] *= 1 + 1e-9;  // Keeps close partials solvable
+  }
+  solve(normal, rhs);
+
+  // c cos(wn) + s sin(wn) = A cos(wn + phase)
+  e.partials.clear();
+  double tailSeconds = 0;
+  for (size_t k = 0; k < frequencies.size(); k++) {
+    double c = rhs[2 * k], s = rhs[2 * k + 1];
+    float amplitude = std::hypot(c, s);
+    e.partials.push_back({(float)frequencies[k], (float)decays[k], amplitude, (float)std::atan2(-s, c)});
+    tailSeconds = std::max(tailSeconds, std::log(std::max(amplitude / 0.5, 1.0)) / decays[k]);
+  }
+  e.tailStart = start;
+  e.tailFade = fade;
+  e.tailLength = std::min((long)(tailSeconds * SAMPLE_RATE), (long)original.size() - start);
+
+  e.pcm.assign(original.begin(), original.begin() + attack + 1);
+  for (long i = 0; i < fade; i++) {
+    e.pcm[start + i] = (int16_t)std::lround(e.pcm[start + i] * (1 - (double)i / fade));
+  }
+  e.pcm[attack] = 0;
+
+  compareLevels(e, instrument, original);
+  return true;
+}
+
+static bool writeWav(const std::string &path, const std::vector<double> &signal) {
+  FILE *out = fopen(path.c_str(), "wb");
+  if (out == nullptr) {
+    perror(path.c_str());
+    return false;
+  }
+  uint32_t dataBytes = signal.size() * 2;
+  uint32_t riffBytes = 36 + dataBytes;
+  uint32_t fmtBytes = 16, rate = SAMPLE_RATE, byteRate = SAMPLE_RATE * 2;
+  uint16_t format = 1, channels = 1, align = 2, bits = 16;
+  fwrite("RIFF", 1, 4, out);
+  fwrite(&riffBytes, 4, 1, out);
+  fwrite("WAVEfmt ", 1, 8, out);
+  fwrite(&fmtBytes, 4, 1, out);
+  fwrite(&format, 2, 1, out);
+  fwrite(&channels, 2, 1, out);
+  fwrite(&rate, 4, 1, out);
+  fwrite(&byteRate, 4, 1, out);
+  fwrite(&align, 2, 1, out);
+  fwrite(&bits, 2, 1, out);
+  fwrite("data", 1, 4, out);
+  fwrite(&dataBytes, 4, 1, out);
+  for (double value : signal) {
+    int16_t sample = (int16_t)std::max(-32768.0, std::min(32767.0, std::round(value)));
+    fwrite(&sample, 2, 1, out);
+  }
+  fclose(out);
+  return true;
+}
+
+// Encodes, saving the decoder state at each block start
+static void encodeAdpcm(EncodedZone &zone) {
+  uint32_t length = zone.pcm.size();
+  zone.codes.assign((length + 1) / 2, 0);
+  AdpcmState state = {0, 0};
+  double squaredError = 0, squaredSignal = 0;
+  zone.peakError = 0;
+  zone.checksum = SAMPLE_CHECKSUM_START;
+
+  for (uint32_t i = 0; i < length; i++) {
+    if (i % ADPCM_BLOCK_SAMPLES == 0) {
+      zone.predictors.push_back(state.predictor);
+      zone.stepIndices.push_back(state.stepIndex);
+    }
+    uint8_t code = encodeSample(state, zone.pcm[i]);
+    zone.codes[i / 2] |= code << ((i & 1) * 4);
+    zone.checksum = sampleChecksum(zone.checksum, state.predictor);
+
+    long error = state.predictor - zone.pcm[i];
+    squaredError += (double)error * error;
+    squaredSignal += (double)zone.pcm[i] * zone.pcm[i];
+    zone.peakError = std::max(zone.peakError, std::labs(error));
+  }
+
+  zone.bytes = zone.codes.size() + zone.predictors.size() * (sizeof(int16_t) + sizeof(uint8_t));
+  zone.rmsError = std::sqrt(squaredError / length);
+  zone.snr = 10 * std::log10(squaredSignal / std::max(squaredError, 1.0));
+}
+
+static void printArray(FILE *out, const char *type, const std::string &name, const std::vector<long> &values) {
+  fprintf(out, "static const %s %s[%zu] = {\n", type, name.c_str(), values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    fprintf(out, "%ld,%s", values[i], (i % 16 == 15) ? "\n" : "");
+  }
+  fprintf(out, "\n};\n\n");
+}
+
+// Same packing as the original wavetable generator: two samples per word
+static void printPcmArray(FILE *out, const std::string &name, const std::vector<int16_t> &pcm) {
+  size_t words = (pcm.size() + 1) / 2;
+  fprintf(out, "static const uint32_t %s[%zu] = {\n", name.c_str(), words);
+  for (size_t i = 0; i < words; i++) {
+    uint16_t low = pcm[2 * i];
+    uint16_t high = (2 * i + 1 < pcm.size()) ? pcm[2 * i + 1] : 0;
+    fprintf(out, "0x%08x,%s", ((uint32_t)high << 16) | low, (i % 8 == 7) ? "\n" : "");
+  }
+  fprintf(out, "\n};\n\n");
+}
+
+static void printSampleData(FILE *out, const Instrument &instrument, const Zone &zone,
+                            const EncodedZone &encoded, const std::string &sampleName) {
+  // Index bits as small as the length allows, like the wavetable generator
+  uint32_t length = encoded.pcm.size();
+  int indexBits = 1;
+  while ((1UL << indexBits) < length) {
+    indexBits++;
+  }
+  int shift = 32 - indexBits;
+  bool loop = encoded.loopStart >= 0;
+  uint32_t loopStart = loop ? encoded.loopStart : 0;
+  uint32_t loopEnd = loop ? encoded.loopEnd : length - 1;
+
+  fprintf(out, "\t{\n");
+  if (instrument.compressed) {
+    fprintf(out, "\t\tnullptr, // sample, see %s_samples\n", instrument.name.c_str());
+  } else {
+    fprintf(out, "\t\t(int16_t*)%s, // sample\n", sampleName.c_str());
+  }
+  fprintf(out, "\t\t%s, // LOOP\n", loop ? "true" : "false");
+  fprintf(out, "\t\t%d, // LENGTH_BITS\n", indexBits);
+  fprintf(out, "\t\t(1 << (32 - %d)) * WAVETABLE_CENTS_SHIFT(0) * 44100.0 / WAVETABLE_NOTE_TO_FREQUENCY(%d) / AUDIO_SAMPLE_RATE_EXACT + 0.5, // PER_HERTZ_PHASE_INCREMENT\n", indexBits, zone.rootNote);
+  fprintf(out, "\t\t(uint32_t)%u << %d, // MAX_PHASE\n", length - 1, shift);
+  fprintf(out, "\t\t(uint32_t)%u << %d, // LOOP_PHASE_END\n", loopEnd, shift);
+  fprintf(out, "\t\t(uint32_t)%u << %d, // LOOP_PHASE_LENGTH\n", loopEnd - loopStart, shift);
+  fprintf(out, "\t\tuint16_t(UINT16_MAX * WAVETABLE_DECIBEL_SHIFT(0)), // INITIAL_ATTENUATION_SCALAR\n");
+  const char *counts[] = {"DELAY_COUNT", "ATTACK_COUNT", "HOLD_COUNT", "DECAY_COUNT"};
+  const double times[] = {instrument.delayMs, instrument.attackMs, encoded.holdMs, encoded.decayMs};
+  for (int i = 0; i < 4; i++) {
+    fprintf(out, "\t\tuint32_t(%.2f * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // %s\n", times[i], counts[i]);
+  }
+  fprintf(out, "\t\tuint32_t(%.2f * AudioSynthWavetable::SAMPLES_PER_MSEC / AudioSynthWavetable::ENVELOPE_PERIOD + 0.5), // RELEASE_COUNT\n", instrument.releaseMs);
+  fprintf(out, "\t\tint32_t((1.0 - WAVETABLE_DECIBEL_SHIFT(%.1f)) * AudioSynthWavetable::UNITY_GAIN), // SUSTAIN_MULT\n", encoded.sustainDb);
+  // LFOs are not used by these instruments, so they are left at rest
+  fprintf(out, "\t\t0, 0, 0, 0, // VIBRATO\n");
+  fprintf(out, "\t\t0, 0, 0, 0, 0, 0, // MODULATION\n");
+  fprintf(out, "\t},\n");
+}
+
+// Test-only data, so it lives in a header of its own rather than the .cpp
+static bool writeReference(const Instrument &instrument, const std::vector<EncodedZone> &encoded,
+                           const std::string &outDir) {
+  const std::string &name = instrument.name;
+  FILE *out = fopen((outDir + "/" + name + "_reference.h").c_str(), "w");
+  if (out == nullptr) {
+    perror(outDir.c_str());
+    return false;
+  }
+
+  fprintf(out, "#pragma once\n// Generated by tools/sample_convert.cpp from samples/manifest.txt\n");
+  fprintf(out, "// For the native tests only, see sample_reference.h\n");
+  fprintf(out, "#include \"sample_reference.h\"\n\n");
+  for (size_t z = 0; z < encoded.size(); z++) {
+    if (encoded[z].renderedLevels.empty()) {
+      continue;
+    }
+    fprintf(out, "static const int16_t %s_%zu_levels[] = {", name.c_str(), z);
+    for (size_t i = 0; i < encoded[z].renderedLevels.size(); i++) {
+      fprintf(out, "%s%ld,", (i % 16 == 0) ? "\n\t" : " ", std::lround(encoded[z].renderedLevels[i] * 100));
+    }
+    fprintf(out, "\n};\n\n");
+  }
+
+  fprintf(out, "static const ZoneReference %s_reference[%zu] = {\n", name.c_str(), encoded.size());
+  for (size_t z = 0; z < encoded.size(); z++) {
+    const EncodedZone &e = encoded[z];
+    std::string levels = e.renderedLevels.empty() ? "nullptr" : name + "_" + std::to_string(z) + "_levels";
+    fprintf(out, "\t{%d, %zu, 0x%08x, %s, %zu},\n", instrument.zones[z].rootNote, e.pcm.size(), e.checksum,
+            levels.c_str(), e.renderedLevels.size());
+  }
+  fprintf(out, "};\n");
+  fclose(out);
+  return true;
+}
+
+static bool parseManifest(const std::string &path, std::vector<Instrument> &instruments, std::vector<Budget> &budgets) {
+  std::ifstream in(path);
+  if (!in) {
+    perror(path.c_str());
+    return false;
+  }
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(in, line)) {
+    lineNumber++;
+    line = line.substr(0, line.find('#'));
+    std::istringstream words(line);
+    std::string keyword;
+    if (!(words >> keyword)) {
+      continue;
+    }
+
+    bool ok = true;
+    Instrument *current = instruments.empty() ? nullptr : &instruments.back();
+    if (keyword == "budget") {
+      Budget budget;
+      ok = (bool)(words >> budget.bytes);
+      std::string name;
+      while (words >> name) {
+        budget.instruments.push_back(name);
+      }
+      budgets.push_back(budget);
+    } else if (keyword == "instrument") {
+      Instrument instrument;
+      std::string mode;
+      ok = (bool)(words >> instrument.name >> mode) && (mode == "pcm" || mode == "adpcm");
+      instrument.compressed = (mode == "adpcm");
+      instruments.push_back(instrument);
+    } else if (current == nullptr) {
+      ok = false;
+    } else if (keyword == "envelope") {
+      ok = (bool)(words >> current->delayMs >> current->attackMs >> current->holdMs
+                        >> current->decayMs >> current->sustainDb >> current->releaseMs);
+    } else if (keyword == "lowpass") {
+      ok = (bool)(words >> current->lowpassHz);
+    } else if (keyword == "loop") {
+      ok = (bool)(words >> current->loopStartMs >> current->loopLengthMs >> current->crossfadeMs);
+      current->autoLoop = true;
+    } else if (keyword == "modes") {
+      ok = (bool)(words >> current->modalAttackMs >> current->modalFadeMs >> current->partialCount);
+    } else if (keyword == "zone") {
+      Zone zone;
+      ok = (bool)(words >> zone.file >> zone.fileRoot >> zone.rootNote >> zone.maxNote);
+      zone.loopStart = zone.loopEnd = -1;
+      if (ok && (words >> zone.loopStart)) {
+        ok = (bool)(words >> zone.loopEnd) && zone.loopEnd > zone.loopStart;
+      }
+      current->zones.push_back(zone);
+    } else {
+      ok = false;
+    }
+
+    if (!ok) {
+      fprintf(stderr, "%s:%d: can't parse \"%s\"\n", path.c_str(), lineNumber, line.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool convert(const Instrument &instrument, const std::string &wavDir, const std::string &outDir,
+                    const std::string &renderDir, size_t &bytes) {
+  std::vector<EncodedZone> encoded(instrument.zones.size());
+  std::map<std::string, std::vector<int16_t>> recordings;
+
+  for (size_t z = 0; z < instrument.zones.size(); z++) {
+    const Zone &zone = instrument.zones[z];
+    if (recordings.find(zone.file) == recordings.end()) {
+      std::vector<int16_t> pcm;
+      if (!readWav(wavDir + "/" + zone.file, pcm)) {
+        return false;
+      }
+      if (instrument.lowpassHz > 0) {
+        lowPass(pcm, instrument.lowpassHz);
+      }
+      recordings[zone.file] = pcm;
+    }
+
+    const std::vector<int16_t> &pcm = recordings[zone.file];
+    EncodedZone &e = encoded[z];
+    if (zone.rootNote == zone.fileRoot) {
+      e.pcm = pcm;
+    } else {
+      double step = std::pow(2.0, (zone.rootNote - zone.fileRoot) / 12.0);
+      e.pcm = resample(pcm, step);
+    }
+    e.loopStart = zone.loopStart;
+    e.loopEnd = zone.loopEnd;
+    e.holdMs = instrument.holdMs;
+    e.decayMs = instrument.decayMs;
+    e.sustainDb = instrument.sustainDb;
+    if (zone.loopStart >= 0 && (size_t)zone.loopEnd >= e.pcm.size()) {
+      fprintf(stderr, "%s zone %zu: loop end past the sample's end\n", instrument.name.c_str(), z);
+      return false;
+    }
+
+    e.partials.clear();
+    if (instrument.autoLoop || instrument.partialCount > 0) {
+      std::string label = instrument.name + " zone " + std::to_string(z);
+      std::vector<int16_t> unprocessed = e.pcm;
+      bool ok = instrument.autoLoop ? buildLoop(e, zone, instrument, label.c_str())
+                                    : fitModes(e, instrument, label.c_str());
+      if (!ok) {
+        return false;
+      }
+      e.renderedLevels = windowLevels(renderZone(e, instrument, unprocessed.size()));
+      if (!renderDir.empty()) {
+        std::string base = renderDir + "/" + instrument.name + "_" + std::to_string(z);
+        std::vector<double> original(unprocessed.begin(), unprocessed.end());
+        if (!writeWav(base + "_original.wav", original) ||
+            !writeWav(base + "_rendered.wav", renderZone(e, instrument, unprocessed.size()))) {
+          return false;
+        }
+      }
+    }
+
+    if (instrument.compressed) {
+      encodeAdpcm(e);
+    } else {
+      e.bytes = (e.pcm.size() + 1) / 2 * sizeof(uint32_t);
+      e.rmsError = e.peakError = 0;
+      e.snr = INFINITY;
+      e.checksum = SAMPLE_CHECKSUM_START;
+      for (int16_t sample : e.pcm) {
+        e.checksum = sampleChecksum(e.checksum, sample);
+      }
+    }
+    e.bytes += e.partials.size() * sizeof(ModalPartial);
+  }
+
+  const std::string &name = instrument.name;
+  FILE *header = fopen((outDir + "/" + name + ".h").c_str(), "w");
+  FILE *out = fopen((outDir + "/" + name + ".cpp").c_str(), "w");
+  if (header == nullptr || out == nullptr) {
+    perror(outDir.c_str());
+    return false;
+  }
+
+  fprintf(header, "#pragma once\n// Generated by tools/sample_convert.cpp from samples/manifest.txt\n");
+  fprintf(header, "#include <Audio.h>\n#include \"adpcm_sample.h\"\n#include \"modal_tail.h\"\n");
+  fprintf(header, "extern const AudioSynthWavetable::instrument_data %s;\n", name.c_str());
+  if (instrument.compressed) {
+    fprintf(header, "extern const AdpcmSample %s_samples[];\n", name.c_str());
+  }
+  if (instrument.partialCount > 0) {
+    fprintf(header, "extern const ModalTail %s_tails[];\n", name.c_str());
+  }
+  fclose(header);
+
+  fprintf(out, "#include \"%s.h\"\n\n", name.c_str());
+  fprintf(out, "// Generated by tools/sample_convert.cpp from samples/manifest.txt\n\n");
+  for (size_t z = 0; z < encoded.size(); z++) {
+    std::string prefix = name + "_" + std::to_string(z);
+    if (instrument.compressed) {
+      printArray(out, "uint8_t", prefix + "_codes", encoded[z].codes);
+      printArray(out, "int16_t", prefix + "_block_predictors", encoded[z].predictors);
+      printArray(out, "uint8_t", prefix + "_block_step_indices", encoded[z].stepIndices);
+    } else {
+      printPcmArray(out, prefix + "_sample", encoded[z].pcm);
+    }
+  }
+
+  if (instrument.compressed) {
+    fprintf(out, "const AdpcmSample %s_samples[%zu] = {\n", name.c_str(), encoded.size());
+    for (size_t z = 0; z < encoded.size(); z++) {
+      std::string prefix = name + "_" + std::to_string(z);
+      fprintf(out, "\t{%s_codes, %s_block_predictors, %s_block_step_indices, %zu},\n",
+              prefix.c_str(), prefix.c_str(), prefix.c_str(), encoded[z].pcm.size());
+    }
+    fprintf(out, "};\n\n");
+  }
+
+  if (instrument.partialCount > 0) {
+    for (size_t z = 0; z < encoded.size(); z++) {
+      fprintf(out, "static const ModalPartial %s_%zu_partials[] = {\n", name.c_str(), z);
+      for (const ModalPartial &p : encoded[z].partials) {
+        fprintf(out, "\t{%.3ff, %.4ff, %.2ff, %.5ff},\n", p.frequency, p.decay, p.amplitude, p.phase);
+      }
+      fprintf(out, "};\n\n");
+    }
+    fprintf(out, "const ModalTail %s_tails[%zu] = {\n", name.c_str(), encoded.size());
+    for (size_t z = 0; z < encoded.size(); z++) {
+      const EncodedZone &e = encoded[z];
+      fprintf(out, "\t{%s_%zu_partials, %zu, %ld, %ld, %ld},\n", name.c_str(), z, e.partials.size(),
+              e.tailStart, e.tailFade, e.tailLength);
+    }
+    fprintf(out, "};\n\n");
+  }
+
+  fprintf(out, "static const AudioSynthWavetable::sample_data %s_sample_data[%zu] = {\n", name.c_str(), encoded.size());
+  for (size_t z = 0; z < encoded.size(); z++) {
+    printSampleData(out, instrument, instrument.zones[z], encoded[z], name + "_" + std::to_string(z) + "_sample");
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "static const uint8_t %s_ranges[] = {", name.c_str());
+  for (const Zone &zone : instrument.zones) {
+    fprintf(out, "%d, ", zone.maxNote);
+  }
+  fprintf(out, "};\n\n");
+  fprintf(out, "const AudioSynthWavetable::instrument_data %s = {%zu, %s_ranges, %s_sample_data };\n",
+          name.c_str(), encoded.size(), name.c_str(), name.c_str());
+  fclose(out);
+
+  if (!writeReference(instrument, encoded, outDir)) {
+    return false;
+  }
+
+  bytes = 0;
+  printf("%s (%s):\n", name.c_str(), instrument.compressed ? "adpcm" : "pcm");
+  for (size_t z = 0; z < encoded.size(); z++) {
+    const Zone &zone = instrument.zones[z];
+    const EncodedZone &e = encoded[z];
+    bytes += e.bytes;
+    printf("  zone %zu, root %d, notes to %d: %zu samples, %zu bytes", z, zone.rootNote, zone.maxNote, e.pcm.size(), e.bytes);
+    if (e.loopStart >= 0) {
+      printf(", loop %ld-%ld", e.loopStart, e.loopEnd);
+    }
+    if (instrument.compressed) {
+      printf(", error rms %.1f peak %ld SNR %.1f dB", e.rmsError, e.peakError, e.snr);
+    }
+    printf("\n");
+    if (instrument.partialCount > 0) {
+      printf("    %zu partials, tail %.2f s, synthesized render vs original: level error max %.1f dB, mean %.1f dB\n",
+             e.partials.size(), e.tailLength / SAMPLE_RATE, e.levelErrorMaxDb, e.levelErrorMeanDb);
+    } else if (instrument.autoLoop) {
+      printf("    decay T60 %.2f s, looped render vs original: level error max %.1f dB, mean %.1f dB\n",
+             e.t60, e.levelErrorMaxDb, e.levelErrorMeanDb);
+    }
+  }
+  printf("  total %zu bytes\n", bytes);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--render") == 0)) {
+    fprintf(stderr, "Usage: %s <manifest> <output dir> [--render <dir>]\n", argv[0]);
+    return 1;
+  }
+  std::string manifest = argv[1];
+  std::string outDir = argv[2];
+  std::string renderDir = (argc == 5) ? argv[4] : "";
+  size_t slash = manifest.find_last_of('/');
+  std::string wavDir = (slash == std::string::npos) ? "." : manifest.substr(0, slash);
+
+  std::vector<Instrument> instruments;
+  std::vector<Budget> budgets;
+  if (!parseManifest(manifest, instruments, budgets)) {
+    return 1;
+  }
+
+  std::map<std::string, size_t> sizes;
+  for (const Instrument &instrument : instruments) {
+    if (!convert(instrument, wavDir, outDir, renderDir, sizes[instrument.name])) {
+      return 1;
+    }
+  }
+
+  FILE *all = fopen((outDir + "/instruments.h").c_str(), "w");
+  if (all == nullptr) {
+    perror(outDir.c_str());
+    return 1;
+  }
+  fprintf(all, "#pragma once\n// Generated by tools/sample_convert.cpp from samples/manifest.txt\n");
+  for (const Instrument &instrument : instruments) {
+    fprintf(all, "#include \"%s.h\"\n", instrument.name.c_str());
+  }
+  fclose(all);
+
+  bool overBudget = false;
+  for (const Budget &budget : budgets) {
+    size_t total = 0;
+    for (const std::string &name : budget.instruments) {
+      if (sizes.find(name) == sizes.end()) {
+        fprintf(stderr, "budget names unknown instrument %s\n", name.c_str());
+        return 1;
+      }
+      total += sizes[name];
+    }
+    printf("Budget:");
+    for (const std::string &name : budget.instruments) {
+      printf(" %s", name.c_str());
+    }
+    printf(" = %zu of %zu bytes\n", total, budget.bytes);
+    if (total > budget.bytes) {
+      fprintf(stderr, "Sample data over budget by %zu bytes\n", total - budget.bytes);
+      overBudget = true;
+    }
+  }
+  return overBudget ? 1 : 0;
+}